@@ -0,0 +1,138 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Measures push_back, counting, finding set bits and bitwise AND in bit_vector,
+//std::vector<bool> and vector<char>
+
+#include "boost/container/bit_vector.hpp"
+#include "boost/container/vector.hpp"
+
+#include <boost/timer/timer.hpp>
+#include <algorithm>
+#include <vector>
+#include <iostream>
+
+using boost::timer::cpu_timer;
+
+#ifdef NDEBUG
+static const std::size_t NElements = 10000000;
+static const std::size_t NIter = 20;
+#else
+static const std::size_t NElements = 100000;
+static const std::size_t NIter = 5;
+#endif
+
+typedef boost::container::bit_vector<>       bit_vector_t;
+typedef std::vector<bool>                    std_vector_bool_t;
+typedef boost::container::vector<char>       vector_char_t;
+
+//Generic operations for containers of bools, bit_vector uses its block operations
+template<class C>
+std::size_t count_bits(const C &c)
+{  return std::size_t(std::count(c.begin(), c.end(), true));  }
+
+std::size_t count_bits(const bit_vector_t &c)
+{  return c.count();  }
+
+template<class C>
+std::size_t sum_set_positions(const C &c)
+{
+   std::size_t sum = 0u;
+   for(std::size_t i = 0, n = c.size(); i != n; ++i){
+      if(c[i])
+         sum += i;
+   }
+   return sum;
+}
+
+std::size_t sum_set_positions(const bit_vector_t &c)
+{
+   std::size_t sum = 0u;
+   for(std::size_t i = c.find_first(); i != bit_vector_t::npos; i = c.find_next(i)){
+      sum += i;
+   }
+   return sum;
+}
+
+template<class C>
+void and_assign(C &c, const C &other)
+{
+   for(std::size_t i = 0, n = c.size(); i != n; ++i){
+      c[i] = c[i] && other[i];
+   }
+}
+
+void and_assign(bit_vector_t &c, const bit_vector_t &other)
+{  c &= other;  }
+
+//Fills a container with a bit set every "period" positions
+template<class C>
+void fill_periodic(C &c, std::size_t n, std::size_t period)
+{
+   c.clear();
+   for(std::size_t i = 0; i != n; ++i){
+      c.push_back((i % period) == 0u);
+   }
+}
+
+template<class C>
+void launch_tests(const char *cont_name)
+{
+   std::cout << cont_name << std::endl;
+   cpu_timer timer;
+   std::size_t sum = 0u;
+
+   C c;
+   timer.start();
+   for(std::size_t i = 0; i != NIter; ++i){
+      fill_periodic(c, NElements, 3u);
+      sum += c.size();
+   }
+   timer.stop();
+   std::cout << "   push_back:  " << timer.elapsed().wall/(NIter*NElements) << " ns/bit" << std::endl;
+
+   timer.start();
+   for(std::size_t i = 0; i != NIter; ++i){
+      sum += count_bits(c);
+   }
+   timer.stop();
+   std::cout << "   count:      " << timer.elapsed().wall*1000u/(NIter*NElements) << " ps/bit" << std::endl;
+
+   //Sparse bits
+   C sparse;
+   fill_periodic(sparse, NElements, 1000u);
+   timer.start();
+   for(std::size_t i = 0; i != NIter; ++i){
+      sum += sum_set_positions(sparse);
+   }
+   timer.stop();
+   std::cout << "   find (1/1000 set): " << timer.elapsed().wall*1000u/(NIter*NElements) << " ps/bit" << std::endl;
+
+   C other;
+   fill_periodic(other, NElements, 2u);
+   timer.start();
+   for(std::size_t i = 0; i != NIter; ++i){
+      and_assign(c, other);
+      sum += c.size();
+   }
+   timer.stop();
+   std::cout << "   &=:         " << timer.elapsed().wall*1000u/(NIter*NElements) << " ps/bit"
+             << " (" << (sum % 2u) << ")" << std::endl;
+}
+
+int main()
+{
+   std::cout << "Bit containers with " << NElements << " elements" << std::endl;
+   launch_tests<bit_vector_t>     ("bit_vector");
+   launch_tests<std_vector_bool_t>("std::vector<bool>");
+   launch_tests<vector_char_t>    ("vector<char>");
+   std::cout << "----------------------------------------------" << '\n' << std::endl;
+   return 0;
+}
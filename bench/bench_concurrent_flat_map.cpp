@@ -0,0 +1,211 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Measures the lookup throughput of a shared configuration map read by a growing
+//number of threads while another thread republishes it now and then:
+//concurrent_flat_map against a flat_map guarded by a single lock
+
+#include "boost/container/concurrent_flat_map.hpp"
+#include "boost/container/flat_map.hpp"
+#include "boost/container/detail/mutex.hpp"
+
+#include <boost/timer/timer.hpp>
+#include <iostream>
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD)
+#include <thread>
+#include <vector>
+#endif
+
+using boost::timer::cpu_timer;
+using boost::timer::cpu_times;
+using boost::timer::nanosecond_type;
+
+#ifdef NDEBUG
+static const std::size_t NOperations = 8000000;
+#else
+static const std::size_t NOperations = 200000;
+#endif
+
+static const unsigned NKeys = 1u << 10u;
+static const unsigned MaxThreads = 32u;
+//Lookups between two publications
+static const std::size_t NLookupsPerUpdate = 200000;
+
+typedef boost::container::concurrent_flat_map<unsigned, unsigned> concurrent_map_t;
+typedef boost::container::flat_map<unsigned, unsigned>            flat_map_t;
+
+//Small and fast per-thread pseudo random generator (xorshift32)
+struct rng
+{
+   explicit rng(unsigned seed) : m_state(seed*2654435761u + 1u) {}
+
+   unsigned operator()()
+   {
+      m_state ^= m_state << 13u;
+      m_state ^= m_state >> 17u;
+      m_state ^= m_state << 5u;
+      return m_state;
+   }
+
+   unsigned m_state;
+};
+
+struct read_setting
+{
+   explicit read_setting(unsigned &sum) : m_sum(sum) {}
+
+   void operator()(const std::pair<unsigned, unsigned> &p) const
+   {  m_sum += p.second;  }
+
+   unsigned &m_sum;
+};
+
+//Changes every setting
+struct bump_settings
+{
+   void operator()(flat_map_t &m) const
+   {
+      for(flat_map_t::iterator it = m.begin(); it != m.end(); ++it)
+         ++it->second;
+   }
+};
+
+void fill(flat_map_t &m)
+{
+   for(unsigned i = 0; i != NKeys; ++i)
+      m.insert(std::pair<unsigned, unsigned>(i, i));
+}
+
+//Thread 0 republishes the map every NLookupsPerUpdate operations, the rest only read
+struct concurrent_worker
+{
+   static unsigned run(concurrent_map_t &m, unsigned id, std::size_t n)
+   {
+      rng r(id);
+      unsigned sum = 0;
+      for(std::size_t i = 0; i != n; ++i){
+         if(id == 0u && (i % NLookupsPerUpdate) == 0u){
+            m.update(bump_settings());
+         }
+         m.cvisit(r() % NKeys, read_setting(sum));
+      }
+      return sum;
+   }
+};
+
+struct locked_worker
+{
+   typedef boost::container::container_detail::default_mutex      mutex_t;
+   typedef boost::container::container_detail::scoped_lock<mutex_t> lock_t;
+
+   static unsigned run(flat_map_t &m, mutex_t &mtx, unsigned id, std::size_t n)
+   {
+      rng r(id);
+      unsigned sum = 0;
+      for(std::size_t i = 0; i != n; ++i){
+         const unsigned key = r() % NKeys;
+         lock_t lock(mtx);
+         if(id == 0u && (i % NLookupsPerUpdate) == 0u){
+            bump_settings()(m);
+         }
+         flat_map_t::const_iterator it = m.find(key);
+         if(it != m.end())
+            sum += it->second;
+      }
+      return sum;
+   }
+};
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD)
+
+cpu_times concurrent_time(unsigned nthreads)
+{
+   flat_map_t init;
+   fill(init);
+   concurrent_map_t m(boost::move(init));
+   cpu_timer timer;
+   std::vector<std::thread> threads;
+   for(unsigned t = 0; t != nthreads; ++t){
+      threads.push_back(std::thread(&concurrent_worker::run, std::ref(m), t, NOperations/nthreads));
+   }
+   for(unsigned t = 0; t != nthreads; ++t){
+      threads[t].join();
+   }
+   timer.stop();
+   return timer.elapsed();
+}
+
+cpu_times locked_time(unsigned nthreads)
+{
+   flat_map_t m;
+   fill(m);
+   locked_worker::mutex_t mtx;
+   cpu_timer timer;
+   std::vector<std::thread> threads;
+   for(unsigned t = 0; t != nthreads; ++t){
+      threads.push_back(std::thread(&locked_worker::run, std::ref(m), std::ref(mtx), t, NOperations/nthreads));
+   }
+   for(unsigned t = 0; t != nthreads; ++t){
+      threads[t].join();
+   }
+   timer.stop();
+   return timer.elapsed();
+}
+
+void print_throughput(const char *name, cpu_times t)
+{
+   const double seconds = double(t.wall)/1e9;
+   std::cout << "   " << name << boost::timer::format(t, boost::timer::default_places, "%ws ")
+             << "(" << (double(NOperations)/seconds/1e6) << " Mops/s)" << std::endl;
+}
+
+int main()
+{
+   std::cout << "Configuration lookup benchmark, " << NOperations << " operations, "
+             << NKeys << " settings" << '\n' << std::endl;
+   for(unsigned nthreads = 1u; nthreads <= MaxThreads; nthreads *= 2u){
+      std::cout << nthreads << " thread(s):" << std::endl;
+      const cpu_times c = concurrent_time(nthreads);
+      const cpu_times l = locked_time(nthreads);
+      print_throughput("concurrent_flat_map       ", c);
+      print_throughput("flat_map + one lock       ", l);
+      std::cout << "   concurrent/locked: " << (double(c.wall)/double(l.wall)) << std::endl;
+      std::cout << "----------------------------------------------" << '\n' << std::endl;
+   }
+   return 0;
+}
+
+#else    //#if !defined(BOOST_NO_CXX11_HDR_THREAD)
+
+int main()
+{
+   //Without a thread library only the single threaded cost of the reader counters can be measured
+   flat_map_t init;
+   fill(init);
+   concurrent_map_t cm(boost::move(init));
+   cpu_timer timer;
+   concurrent_worker::run(cm, 0u, NOperations);
+   timer.stop();
+   const cpu_times c = timer.elapsed();
+
+   flat_map_t fm;
+   fill(fm);
+   locked_worker::mutex_t mtx;
+   timer.start();
+   locked_worker::run(fm, mtx, 0u, NOperations);
+   timer.stop();
+   const cpu_times l = timer.elapsed();
+
+   std::cout << "concurrent_flat_map/flat_map (single thread): " << (double(c.wall)/double(l.wall)) << std::endl;
+   return 0;
+}
+
+#endif   //#if !defined(BOOST_NO_CXX11_HDR_THREAD)
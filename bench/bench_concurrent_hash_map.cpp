@@ -0,0 +1,219 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Measures the throughput of a shared session table updated by a growing number
+//of threads: concurrent_hash_map against a flat_hash_map guarded by a single lock
+
+#include "boost/container/concurrent_hash_map.hpp"
+#include "boost/container/flat_hash_map.hpp"
+#include "boost/container/detail/mutex.hpp"
+
+#include <boost/timer/timer.hpp>
+#include <iostream>
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD)
+#include <thread>
+#include <vector>
+#endif
+
+using boost::timer::cpu_timer;
+using boost::timer::cpu_times;
+using boost::timer::nanosecond_type;
+
+#ifdef NDEBUG
+static const std::size_t NOperations = 4000000;
+#else
+static const std::size_t NOperations = 100000;
+#endif
+
+static const unsigned NKeys = 1u << 16u;
+static const unsigned MaxThreads = 32u;
+
+//Session table: mapped values count the requests of each session
+typedef boost::container::concurrent_hash_map<unsigned, unsigned> concurrent_map_t;
+typedef boost::container::flat_hash_map<unsigned, unsigned>       flat_map_t;
+
+//Small and fast per-thread pseudo random generator (xorshift32)
+struct rng
+{
+   explicit rng(unsigned seed) : m_state(seed*2654435761u + 1u) {}
+
+   unsigned operator()()
+   {
+      m_state ^= m_state << 13u;
+      m_state ^= m_state >> 17u;
+      m_state ^= m_state << 5u;
+      return m_state;
+   }
+
+   unsigned m_state;
+};
+
+struct increment_session
+{
+   void operator()(std::pair<unsigned, unsigned> &p) const
+   {  ++p.second;  }
+};
+
+struct expired_session
+{
+   bool operator()(const std::pair<unsigned, unsigned> &p) const
+   {  return p.second > 4u;  }
+};
+
+struct read_session
+{
+   explicit read_session(unsigned &sum) : m_sum(sum) {}
+
+   void operator()(const std::pair<unsigned, unsigned> &p) const
+   {  m_sum += p.second;  }
+
+   unsigned &m_sum;
+};
+
+//Each operation is either a request (insert_or_visit, 80%), a lookup (10%)
+//or an expiration attempt (erase_if, 10%)
+struct concurrent_worker
+{
+   static unsigned run(concurrent_map_t &m, unsigned id, std::size_t n)
+   {
+      rng r(id);
+      unsigned sum = 0;
+      for(std::size_t i = 0; i != n; ++i){
+         const unsigned v = r();
+         const unsigned key = v % NKeys;
+         const unsigned op = (v >> 20u) % 10u;
+         if(op < 8u){
+            m.insert_or_visit(std::pair<unsigned, unsigned>(key, 1u), increment_session());
+         }
+         else if(op == 8u){
+            m.cvisit(key, read_session(sum));
+         }
+         else{
+            m.erase_if(key, expired_session());
+         }
+      }
+      return sum;
+   }
+};
+
+struct locked_worker
+{
+   typedef boost::container::container_detail::default_mutex      mutex_t;
+   typedef boost::container::container_detail::scoped_lock<mutex_t> lock_t;
+
+   static unsigned run(flat_map_t &m, mutex_t &mtx, unsigned id, std::size_t n)
+   {
+      rng r(id);
+      unsigned sum = 0;
+      for(std::size_t i = 0; i != n; ++i){
+         const unsigned v = r();
+         const unsigned key = v % NKeys;
+         const unsigned op = (v >> 20u) % 10u;
+         lock_t lock(mtx);
+         if(op < 8u){
+            std::pair<flat_map_t::iterator, bool> ret = m.insert(std::pair<unsigned, unsigned>(key, 1u));
+            if(!ret.second)
+               ++ret.first->second;
+         }
+         else if(op == 8u){
+            flat_map_t::const_iterator it = m.find(key);
+            if(it != m.end())
+               sum += it->second;
+         }
+         else{
+            flat_map_t::iterator it = m.find(key);
+            if(it != m.end() && it->second > 4u)
+               m.erase(it);
+         }
+      }
+      return sum;
+   }
+};
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD)
+
+cpu_times concurrent_time(unsigned nthreads)
+{
+   concurrent_map_t m;
+   cpu_timer timer;
+   std::vector<std::thread> threads;
+   for(unsigned t = 0; t != nthreads; ++t){
+      threads.push_back(std::thread(&concurrent_worker::run, std::ref(m), t, NOperations/nthreads));
+   }
+   for(unsigned t = 0; t != nthreads; ++t){
+      threads[t].join();
+   }
+   timer.stop();
+   return timer.elapsed();
+}
+
+cpu_times locked_time(unsigned nthreads)
+{
+   flat_map_t m;
+   locked_worker::mutex_t mtx;
+   cpu_timer timer;
+   std::vector<std::thread> threads;
+   for(unsigned t = 0; t != nthreads; ++t){
+      threads.push_back(std::thread(&locked_worker::run, std::ref(m), std::ref(mtx), t, NOperations/nthreads));
+   }
+   for(unsigned t = 0; t != nthreads; ++t){
+      threads[t].join();
+   }
+   timer.stop();
+   return timer.elapsed();
+}
+
+void print_throughput(const char *name, cpu_times t)
+{
+   const double seconds = double(t.wall)/1e9;
+   std::cout << "   " << name << boost::timer::format(t, boost::timer::default_places, "%ws ")
+             << "(" << (double(NOperations)/seconds/1e6) << " Mops/s)" << std::endl;
+}
+
+int main()
+{
+   std::cout << "Session table update benchmark, " << NOperations << " operations, "
+             << NKeys << " sessions" << '\n' << std::endl;
+   for(unsigned nthreads = 1u; nthreads <= MaxThreads; nthreads *= 2u){
+      std::cout << nthreads << " thread(s):" << std::endl;
+      const cpu_times c = concurrent_time(nthreads);
+      const cpu_times l = locked_time(nthreads);
+      print_throughput("concurrent_hash_map       ", c);
+      print_throughput("flat_hash_map + one lock  ", l);
+      std::cout << "   concurrent/locked: " << (double(c.wall)/double(l.wall)) << std::endl;
+      std::cout << "----------------------------------------------" << '\n' << std::endl;
+   }
+   return 0;
+}
+
+#else    //#if !defined(BOOST_NO_CXX11_HDR_THREAD)
+
+int main()
+{
+   //Without a thread library only the single threaded cost of sharding can be measured
+   concurrent_map_t cm;
+   cpu_timer timer;
+   concurrent_worker::run(cm, 0u, NOperations);
+   timer.stop();
+   const cpu_times c = timer.elapsed();
+
+   flat_map_t fm;
+   locked_worker::mutex_t mtx;
+   timer.start();
+   locked_worker::run(fm, mtx, 0u, NOperations);
+   timer.stop();
+   const cpu_times l = timer.elapsed();
+
+   std::cout << "concurrent_hash_map/flat_hash_map (single thread): " << (double(c.wall)/double(l.wall)) << std::endl;
+   return 0;
+}
+
+#endif   //#if !defined(BOOST_NO_CXX11_HDR_THREAD)
@@ -0,0 +1,157 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Measures insertions at the beginning, at the end and a sliding window
+//(push_back + pop_front) in devector, deque and vector
+
+#include "boost/container/devector.hpp"
+#include "boost/container/deque.hpp"
+#include "boost/container/vector.hpp"
+
+#include <boost/timer/timer.hpp>
+#include <iostream>
+
+using boost::timer::cpu_timer;
+using boost::timer::cpu_times;
+using boost::timer::nanosecond_type;
+
+#ifdef NDEBUG
+static const std::size_t NElements = 1000000;
+static const std::size_t NIter = 20;
+#else
+static const std::size_t NElements = 10000;
+static const std::size_t NIter = 5;
+#endif
+
+//vector has no push_front, insertions at the front are measured with fewer elements
+static const std::size_t NFrontVectorElements = NElements/100u;
+static const std::size_t NWindow = 1000;
+
+template<class C>
+struct push_front_op
+{
+   static const char *name() { return "push_front"; }
+
+   static unsigned run(C &c, std::size_t n)
+   {
+      for(std::size_t i = 0; i != n; ++i){
+         c.push_front(unsigned(i));
+      }
+      return c.front();
+   }
+};
+
+template<class T, class A, class O>
+struct push_front_op< boost::container::vector<T, A, O> >
+{
+   static const char *name() { return "insert(begin)"; }
+
+   static unsigned run(boost::container::vector<T, A, O> &c, std::size_t n)
+   {
+      for(std::size_t i = 0; i != n; ++i){
+         c.insert(c.begin(), unsigned(i));
+      }
+      return c.front();
+   }
+};
+
+template<class C>
+struct push_back_op
+{
+   static const char *name() { return "push_back"; }
+
+   static unsigned run(C &c, std::size_t n)
+   {
+      for(std::size_t i = 0; i != n; ++i){
+         c.push_back(unsigned(i));
+      }
+      return c.back();
+   }
+};
+
+template<class C>
+struct window_op
+{
+   static const char *name() { return "push_back + pop_front window"; }
+
+   static unsigned run(C &c, std::size_t n)
+   {
+      unsigned sum = 0;
+      for(std::size_t i = 0; i != n; ++i){
+         c.push_back(unsigned(i));
+         if(c.size() > NWindow){
+            sum += c.front();
+            c.pop_front();
+         }
+      }
+      return sum;
+   }
+};
+
+template<class T, class A, class O>
+struct window_op< boost::container::vector<T, A, O> >
+{
+   static const char *name() { return "push_back + erase(begin) window"; }
+
+   static unsigned run(boost::container::vector<T, A, O> &c, std::size_t n)
+   {
+      unsigned sum = 0;
+      for(std::size_t i = 0; i != n; ++i){
+         c.push_back(unsigned(i));
+         if(c.size() > NWindow){
+            sum += c.front();
+            c.erase(c.begin());
+         }
+      }
+      return sum;
+   }
+};
+
+template<template<class> class Op, class C>
+void launch_test(const char *cont_name, std::size_t n)
+{
+   unsigned sum = 0;
+   cpu_timer timer;
+   timer.resume();
+   for(std::size_t i = 0; i != NIter; ++i){
+      C c;
+      sum += Op<C>::run(c, n);
+   }
+   timer.stop();
+   const nanosecond_type ns = timer.elapsed().wall/(NIter*n);
+   std::cout << "   " << cont_name << " " << Op<C>::name() << ": " << ns << " ns/element"
+             << " (" << (sum % 2u) << ")" << std::endl;
+}
+
+int main()
+{
+   typedef boost::container::devector<unsigned> devector_t;
+   typedef boost::container::deque<unsigned>    deque_t;
+   typedef boost::container::vector<unsigned>   vector_t;
+
+   std::cout << "Insertion at the beginning, " << NElements << " elements" << std::endl;
+   launch_test<push_front_op, devector_t>("devector", NElements);
+   launch_test<push_front_op, deque_t>   ("deque   ", NElements);
+   launch_test<push_front_op, vector_t>  ("vector  ", NFrontVectorElements);
+   std::cout << "----------------------------------------------" << '\n' << std::endl;
+
+   std::cout << "Insertion at the end, " << NElements << " elements" << std::endl;
+   launch_test<push_back_op, devector_t>("devector", NElements);
+   launch_test<push_back_op, deque_t>   ("deque   ", NElements);
+   launch_test<push_back_op, vector_t>  ("vector  ", NElements);
+   std::cout << "----------------------------------------------" << '\n' << std::endl;
+
+   std::cout << "Sliding window of " << NWindow << " elements, " << NElements << " insertions" << std::endl;
+   launch_test<window_op, devector_t>("devector", NElements);
+   launch_test<window_op, deque_t>   ("deque   ", NElements);
+   launch_test<window_op, vector_t>  ("vector  ", NFrontVectorElements);
+   std::cout << "----------------------------------------------" << '\n' << std::endl;
+   return 0;
+}
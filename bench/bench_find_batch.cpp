@@ -0,0 +1,141 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Compares resolving batches of keys with find_batch against
+//a loop of find() calls on tree-based and flat containers
+
+#include "boost/container/set.hpp"
+#include "boost/container/map.hpp"
+#include "boost/container/flat_set.hpp"
+#include "boost/container/flat_map.hpp"
+#include "boost/container/vector.hpp"
+
+#include <boost/timer/timer.hpp>
+#include <iostream>
+#include <iomanip>
+#include <algorithm> //random_shuffle
+#include <cstdlib>   //srand
+
+using boost::timer::cpu_timer;
+using boost::timer::cpu_times;
+using boost::timer::nanosecond_type;
+
+#ifdef NDEBUG
+static const std::size_t MaxElements = 10000000;
+static const std::size_t NLookups    = 4000000;
+#else
+static const std::size_t MaxElements = 10000;
+static const std::size_t NLookups    = 40000;
+#endif
+
+static const std::size_t BatchSizes[] = { 64u, 256u, 1024u };
+
+template<class C>
+std::size_t lookup_loop(const C &c, const boost::container::vector<int> &keys, std::size_t batch
+                       , boost::container::vector<typename C::const_iterator> &its)
+{
+   std::size_t found = 0;
+   for(std::size_t done = 0; done < NLookups; done += batch){
+      const std::size_t b = done % (keys.size() - batch + 1u);
+      for(std::size_t i = 0; i != batch; ++i){
+         its[i] = c.find(keys[b + i]);
+      }
+      for(std::size_t i = 0; i != batch; ++i){
+         found += its[i] != c.end();
+      }
+   }
+   return found;
+}
+
+template<class C>
+std::size_t lookup_batch(const C &c, const boost::container::vector<int> &keys, std::size_t batch
+                        , boost::container::vector<typename C::const_iterator> &its)
+{
+   std::size_t found = 0;
+   for(std::size_t done = 0; done < NLookups; done += batch){
+      const std::size_t b = done % (keys.size() - batch + 1u);
+      c.find_batch(keys.begin() + b, keys.begin() + b + batch, its.begin());
+      for(std::size_t i = 0; i != batch; ++i){
+         found += its[i] != c.end();
+      }
+   }
+   return found;
+}
+
+double ns_per_op(cpu_times t, std::size_t n)
+{  return double(t.wall)/double(n);  }
+
+template<class C>
+void bench_container(const C &c, const boost::container::vector<int> &keys, const char *name)
+{
+   boost::container::vector<typename C::const_iterator> its(BatchSizes[sizeof(BatchSizes)/sizeof(BatchSizes[0]) - 1u]);
+   for(std::size_t i = 0; i != sizeof(BatchSizes)/sizeof(BatchSizes[0]); ++i){
+      const std::size_t batch = BatchSizes[i];
+      if(batch > keys.size())
+         break;
+      cpu_timer timer;
+      std::size_t found = lookup_loop(c, keys, batch, its);
+      timer.stop();
+      const cpu_times loop_t = timer.elapsed();
+
+      timer.start();
+      found -= lookup_batch(c, keys, batch, its);
+      timer.stop();
+      const cpu_times batch_t = timer.elapsed();
+
+      if(found != 0u){
+         std::cout << "ERROR! lookups returned different results" << std::endl;
+      }
+
+      std::cout << std::setw(14) << name << std::setw(9) << c.size() << " elements, batch " << std::setw(5) << batch
+                << " | find loop " << std::setw(6) << ns_per_op(loop_t, NLookups)
+                << " find_batch " << std::setw(6) << ns_per_op(batch_t, NLookups) << " ns/lookup" << std::endl;
+   }
+}
+
+void bench_size(std::size_t n)
+{
+   using namespace boost::container;
+
+   vector<int> keys;
+   set<int> s;
+   map<int, int> m;
+   flat_set<int> fs;
+   flat_map<int, int> fm;
+   fs.reserve(n);
+   fm.reserve(n);
+   for(std::size_t i = 0; i != n; ++i){
+      const int v = int(i*2u);
+      s.insert(s.end(), v);
+      m.insert(m.end(), std::pair<const int, int>(v, v));
+      fs.insert(fs.end(), v);
+      fm.insert(fm.end(), std::pair<int, int>(v, v));
+      keys.push_back(v);
+      //Half of the lookups miss
+      keys.push_back(v + 1);
+   }
+   std::srand(0);
+   std::random_shuffle(keys.begin(), keys.end());
+
+   bench_container(s,  keys, "set");
+   bench_container(m,  keys, "map");
+   bench_container(fs, keys, "flat_set");
+   bench_container(fm, keys, "flat_map");
+   std::cout << "----------------------------------------------" << std::endl;
+}
+
+int main()
+{
+   std::cout << std::fixed << std::setprecision(1);
+   for(std::size_t n = 1000u; n <= MaxElements; n *= 10u){
+      bench_size(n);
+   }
+   return 0;
+}
@@ -0,0 +1,174 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Compares the open addressing flat_hash_map against node based hash_map,
+//flat_map and map: insertion, successful and unsuccessful lookups and erasure
+
+#include "boost/container/flat_hash_map.hpp"
+#include "boost/container/hash_map.hpp"
+#include "boost/container/flat_map.hpp"
+#include "boost/container/map.hpp"
+#include "boost/container/vector.hpp"
+#include "boost/container/string.hpp"
+
+#include <boost/timer/timer.hpp>
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm> //random_shuffle
+#include <cstdlib>   //srand
+
+using boost::timer::cpu_timer;
+using boost::timer::cpu_times;
+using boost::timer::nanosecond_type;
+
+#ifdef NDEBUG
+static const std::size_t NElements = 20000;
+#else
+static const std::size_t NElements = 1000;
+#endif
+
+#ifdef NDEBUG
+static const std::size_t NIter = 10;
+#else
+static const std::size_t NIter = 2;
+#endif
+
+void compare_times(cpu_times time_numerator, cpu_times time_denominator){
+   std::cout << ((double)time_numerator.wall/(double)time_denominator.wall) << std::endl;
+   std::cout << "----------------------------------------------" << '\n' << std::endl;
+}
+
+template<class T>
+struct key_maker;
+
+template<>
+struct key_maker<int>
+{
+   static int make(std::size_t i)
+   {  return static_cast<int>(i);  }
+};
+
+template<>
+struct key_maker<boost::container::string>
+{
+   static boost::container::string make(std::size_t i)
+   {
+      std::stringstream sstr;
+      sstr << std::setfill('0') << std::setw(20) << i;
+      const std::string &s = sstr.str();
+      return boost::container::string(s.begin(), s.end());
+   }
+};
+
+//Fills "present" with NElements shuffled keys and "absent" with keys not in "present"
+template<class Key>
+void fill_keys(boost::container::vector<Key> &present, boost::container::vector<Key> &absent)
+{
+   present.clear();
+   absent.clear();
+   for(std::size_t i = 0; i != NElements; ++i){
+      present.push_back(key_maker<Key>::make(i*2u));
+      absent.push_back(key_maker<Key>::make(i*2u + 1u));
+   }
+   std::srand(0);
+   std::random_shuffle(present.begin(), present.end());
+   std::random_shuffle(absent.begin(), absent.end());
+}
+
+template<class C>
+cpu_times bench_map(const boost::container::vector<typename C::key_type> &present
+                   , const boost::container::vector<typename C::key_type> &absent)
+{
+   cpu_timer insert_timer, find_timer, miss_timer, erase_timer, total_time;
+   insert_timer.stop(); find_timer.stop(); miss_timer.stop(); erase_timer.stop(); total_time.stop();
+   std::size_t found = 0;
+
+   for(std::size_t iter = 0; iter != NIter; ++iter){
+      C c;
+      total_time.resume();
+      insert_timer.resume();
+      for(std::size_t i = 0, max = present.size(); i != max; ++i){
+         c[present[i]] = static_cast<int>(i);
+      }
+      insert_timer.stop();
+
+      find_timer.resume();
+      for(std::size_t i = 0, max = present.size(); i != max; ++i){
+         found += c.find(present[i]) != c.end();
+      }
+      find_timer.stop();
+
+      miss_timer.resume();
+      for(std::size_t i = 0, max = absent.size(); i != max; ++i){
+         found += c.find(absent[i]) != c.end();
+      }
+      miss_timer.stop();
+
+      erase_timer.resume();
+      for(std::size_t i = 0, max = present.size(); i != max; ++i){
+         c.erase(present[i]);
+      }
+      erase_timer.stop();
+      total_time.stop();
+      if(!c.empty()){
+         std::cout << "ERROR! elements not erased" << std::endl;
+      }
+   }
+   if(found != NIter*present.size()){
+      std::cout << "ERROR! lookups returned wrong results" << std::endl;
+   }
+
+   std::cout << " Insert        " << boost::timer::format(insert_timer.elapsed(), boost::timer::default_places, "%ws\n");
+   std::cout << " Find (hit)    " << boost::timer::format(find_timer.elapsed(), boost::timer::default_places, "%ws\n");
+   std::cout << " Find (miss)   " << boost::timer::format(miss_timer.elapsed(), boost::timer::default_places, "%ws\n");
+   std::cout << " Erase         " << boost::timer::format(erase_timer.elapsed(), boost::timer::default_places, "%ws\n");
+   std::cout << " Total time =  " << boost::timer::format(total_time.elapsed(), boost::timer::default_places, "%ws\n") << std::endl;
+   return total_time.elapsed();
+}
+
+template<class Key>
+void launch_tests(const char *KeyName)
+{
+   using namespace boost::container;
+   boost::container::vector<Key> present, absent;
+   fill_keys(present, absent);
+
+   std::cout << "**********************************************" << '\n';
+   std::cout << "**********************************************" << '\n';
+   std::cout << '\n';
+   std::cout << "Key type: " << KeyName << '\n';
+   std::cout << '\n';
+   std::cout << "**********************************************" << '\n';
+   std::cout << "**********************************************" << '\n' << std::endl;
+
+   std::cout << "flat_hash_map:" << std::endl;
+   cpu_times flat_hash_time = bench_map< flat_hash_map<Key, int> >(present, absent);
+   std::cout << "hash_map:" << std::endl;
+   cpu_times hash_time = bench_map< hash_map<Key, int> >(present, absent);
+   std::cout << "flat_map:" << std::endl;
+   cpu_times flat_time = bench_map< flat_map<Key, int> >(present, absent);
+   std::cout << "map:" << std::endl;
+   cpu_times map_time = bench_map< map<Key, int> >(present, absent);
+
+   std::cout << "flat_hash_map/hash_map: ";
+   compare_times(flat_hash_time, hash_time);
+   std::cout << "flat_hash_map/flat_map: ";
+   compare_times(flat_hash_time, flat_time);
+   std::cout << "flat_hash_map/map: ";
+   compare_times(flat_hash_time, map_time);
+}
+
+int main()
+{
+   launch_tests<int>("int");
+   launch_tests<boost::container::string>("string");
+   return 0;
+}
@@ -0,0 +1,81 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Compares building, looking up and destroying many small flat_maps stored in
+//vector, small_vector, static_vector and deque sequences
+
+#include "boost/container/flat_map.hpp"
+
+#include <boost/timer/timer.hpp>
+#include <iostream>
+#include <iomanip>
+
+using boost::timer::cpu_timer;
+using boost::timer::cpu_times;
+using boost::timer::nanosecond_type;
+
+#ifdef NDEBUG
+static const std::size_t NMaps = 2000000;
+#else
+static const std::size_t NMaps = 20000;
+#endif
+
+static const int NEntries = 6;
+
+template<class Map>
+std::size_t build_and_lookup()
+{
+   std::size_t found = 0;
+   for(std::size_t n = 0; n != NMaps; ++n){
+      Map m;
+      for(int i = 0; i != NEntries; ++i){
+         m.insert(typename Map::value_type(int((n + std::size_t(i)*7u) % 13u), i));
+      }
+      for(int i = 0; i != NEntries; ++i){
+         found += m.count(i);
+      }
+   }
+   return found;
+}
+
+template<class Map>
+void bench(const char *name, std::size_t expected)
+{
+   cpu_timer timer;
+   const std::size_t found = build_and_lookup<Map>();
+   timer.stop();
+   if(found != expected){
+      std::cout << "ERROR! lookups returned different results" << std::endl;
+   }
+   std::cout << std::setw(14) << name << ": "
+             << std::setw(7) << double(timer.elapsed().wall)/double(NMaps) << " ns/map" << std::endl;
+}
+
+int main()
+{
+   using namespace boost::container;
+   typedef new_allocator<std::pair<int, int> > alloc_t;
+   typedef flat_map<int, int, std::less<int>, alloc_t>   vector_map_t;
+   typedef flat_map<int, int, std::less<int>, alloc_t, flat_assoc_options
+      < sequence_storage<small_vector_sequence>, sequence_capacity<8> >::type>   small_vector_map_t;
+   typedef flat_map<int, int, std::less<int>, alloc_t, flat_assoc_options
+      < sequence_storage<static_vector_sequence>, sequence_capacity<8> >::type>  static_vector_map_t;
+   typedef flat_map<int, int, std::less<int>, alloc_t, flat_assoc_options
+      < sequence_storage<deque_sequence> >::type>                                 deque_map_t;
+
+   std::cout << std::fixed << std::setprecision(1);
+   std::cout << NMaps << " maps of " << NEntries << " entries" << std::endl;
+   const std::size_t expected = build_and_lookup<vector_map_t>();
+   bench<vector_map_t>("vector", expected);
+   bench<small_vector_map_t>("small_vector", expected);
+   bench<static_vector_map_t>("static_vector", expected);
+   bench<deque_map_t>("deque", expected);
+   return 0;
+}
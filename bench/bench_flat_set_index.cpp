@@ -0,0 +1,101 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Compares lookups of a flat_set with and without the search_index option
+//and reports the cost of building the index
+
+#include "boost/container/flat_set.hpp"
+#include "boost/container/vector.hpp"
+
+#include <boost/timer/timer.hpp>
+#include <iostream>
+#include <iomanip>
+#include <algorithm> //random_shuffle
+#include <cstdlib>   //srand
+
+using boost::timer::cpu_timer;
+using boost::timer::cpu_times;
+using boost::timer::nanosecond_type;
+
+#ifdef NDEBUG
+static const std::size_t MaxElements = 10000000;
+static const std::size_t NLookups    = 4000000;
+#else
+static const std::size_t MaxElements = 10000;
+static const std::size_t NLookups    = 40000;
+#endif
+
+template<class Set>
+std::size_t lookup(const Set &s, const boost::container::vector<int> &keys)
+{
+   std::size_t found = 0;
+   for(std::size_t i = 0; i != NLookups; ++i){
+      found += s.find(keys[i % keys.size()]) != s.end();
+   }
+   return found;
+}
+
+double ns_per_op(cpu_times t, std::size_t n)
+{  return double(t.wall)/double(n);  }
+
+void bench_size(std::size_t n)
+{
+   using namespace boost::container;
+   typedef flat_set<int>   plain_set_t;
+   typedef flat_set<int, std::less<int>, new_allocator<int>
+                   , flat_assoc_options< search_index<true> >::type> indexed_set_t;
+
+   vector<int> keys;
+   plain_set_t plain;
+   indexed_set_t indexed;
+   plain.reserve(n);
+   indexed.reserve(n);
+   for(std::size_t i = 0; i != n; ++i){
+      keys.push_back(int(i*2u));
+      plain.insert(plain.end(), int(i*2u));
+      indexed.insert(indexed.end(), int(i*2u));
+      //Half of the lookups miss
+      keys.push_back(int(i*2u + 1u));
+   }
+   std::srand(0);
+   std::random_shuffle(keys.begin(), keys.end());
+
+   cpu_timer timer;
+   indexed.rebuild_index();
+   timer.stop();
+   const cpu_times build = timer.elapsed();
+
+   timer.start();
+   std::size_t found = lookup(plain, keys);
+   timer.stop();
+   const cpu_times plain_t = timer.elapsed();
+
+   timer.start();
+   found -= lookup(indexed, keys);
+   timer.stop();
+   const cpu_times indexed_t = timer.elapsed();
+
+   if(found != 0u){
+      std::cout << "ERROR! lookups returned different results" << std::endl;
+   }
+
+   std::cout << std::setw(9) << n << " elements: build " << std::setw(6) << ns_per_op(build, n) << " ns/element"
+             << " | find: binary search " << std::setw(6) << ns_per_op(plain_t, NLookups)
+             << " indexed " << std::setw(6) << ns_per_op(indexed_t, NLookups) << " ns/lookup" << std::endl;
+}
+
+int main()
+{
+   std::cout << std::fixed << std::setprecision(1);
+   for(std::size_t n = 100u; n <= MaxElements; n *= 10u){
+      bench_size(n);
+   }
+   return 0;
+}
@@ -0,0 +1,149 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Measures the cost of building a frozen_hash_map from a flat_map and compares its
+//lookups against flat_map::find, reporting how many lookups amortize the build
+
+#include "boost/container/frozen_hash_map.hpp"
+#include "boost/container/flat_map.hpp"
+#include "boost/container/vector.hpp"
+#include "boost/container/string.hpp"
+
+#include <boost/timer/timer.hpp>
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm> //random_shuffle
+#include <cstdlib>   //srand
+
+using boost::timer::cpu_timer;
+using boost::timer::cpu_times;
+using boost::timer::nanosecond_type;
+
+#ifdef NDEBUG
+static const std::size_t MaxElements = 1000000;
+static const std::size_t NLookups    = 4000000;
+#else
+static const std::size_t MaxElements = 10000;
+static const std::size_t NLookups    = 40000;
+#endif
+
+template<class T>
+struct key_maker;
+
+template<>
+struct key_maker<int>
+{
+   static int make(std::size_t i)
+   {  return static_cast<int>(i);  }
+};
+
+template<>
+struct key_maker<boost::container::string>
+{
+   static boost::container::string make(std::size_t i)
+   {
+      std::stringstream sstr;
+      sstr << std::setfill('0') << std::setw(20) << i;
+      const std::string &s = sstr.str();
+      return boost::container::string(s.begin(), s.end());
+   }
+};
+
+template<class Map>
+std::size_t lookup(const Map &m, const boost::container::vector<typename Map::key_type> &keys)
+{
+   std::size_t found = 0;
+   for(std::size_t i = 0; i != NLookups; ++i){
+      found += m.find(keys[i % keys.size()]) != m.end();
+   }
+   return found;
+}
+
+double ns_per_op(cpu_times t, std::size_t n)
+{  return double(t.wall)/double(n);  }
+
+template<class Key>
+void bench_size(std::size_t n)
+{
+   using namespace boost::container;
+   typedef flat_map<Key, int>          flat_map_t;
+   typedef frozen_hash_map<Key, int>   frozen_map_t;
+
+   vector<Key> present, absent;
+   flat_map_t fm;
+   fm.reserve(n);
+   for(std::size_t i = 0; i != n; ++i){
+      present.push_back(key_maker<Key>::make(i*2u));
+      absent.push_back(key_maker<Key>::make(i*2u + 1u));
+      fm.insert(fm.end(), typename flat_map_t::value_type(present.back(), int(i)));
+   }
+   std::srand(0);
+   std::random_shuffle(present.begin(), present.end());
+   std::random_shuffle(absent.begin(), absent.end());
+
+   cpu_timer timer;
+   const frozen_map_t frozen(fm);
+   timer.stop();
+   const cpu_times build = timer.elapsed();
+
+   timer.start();
+   std::size_t found = lookup(fm, present);
+   timer.stop();
+   const cpu_times flat_hit = timer.elapsed();
+   timer.start();
+   found += lookup(fm, absent);
+   timer.stop();
+   const cpu_times flat_miss = timer.elapsed();
+
+   timer.start();
+   found -= lookup(frozen, present);
+   timer.stop();
+   const cpu_times frozen_hit = timer.elapsed();
+   timer.start();
+   found -= lookup(frozen, absent);
+   timer.stop();
+   const cpu_times frozen_miss = timer.elapsed();
+
+   if(found != 0u || frozen.size() != fm.size()){
+      std::cout << "ERROR! lookups returned different results" << std::endl;
+   }
+
+   std::cout << std::setw(8) << n << " elements: build " << std::setw(8) << ns_per_op(build, n) << " ns/element"
+             << " | hit: flat_map " << std::setw(6) << ns_per_op(flat_hit, NLookups)
+             << " frozen " << std::setw(6) << ns_per_op(frozen_hit, NLookups)
+             << " | miss: flat_map " << std::setw(6) << ns_per_op(flat_miss, NLookups)
+             << " frozen " << std::setw(6) << ns_per_op(frozen_miss, NLookups) << " ns/lookup";
+   const double saved = ns_per_op(flat_hit, NLookups) - ns_per_op(frozen_hit, NLookups);
+   if(saved > 0.0){
+      std::cout << " | break-even after " << std::setw(4) << (double(build.wall)/saved/double(n)) << " lookups/element";
+   }
+   std::cout << std::endl;
+}
+
+template<class Key>
+void launch_tests(const char *KeyName)
+{
+   std::cout << "**********************************************" << '\n';
+   std::cout << "Key type: " << KeyName << '\n';
+   std::cout << "**********************************************" << '\n' << std::endl;
+   for(std::size_t n = 100u; n <= MaxElements; n *= 10u){
+      bench_size<Key>(n);
+   }
+   std::cout << std::endl;
+}
+
+int main()
+{
+   std::cout << std::fixed << std::setprecision(1);
+   launch_tests<int>("int");
+   launch_tests<boost::container::string>("string");
+   return 0;
+}
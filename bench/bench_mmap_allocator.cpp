@@ -0,0 +1,122 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Grows a huge vector<uint64_t> with push_back using new_allocator and mmap_allocator
+//with several flags. Each test runs in its own process to measure its peak resident memory.
+//An optional argument sets the final size of the vector in megabytes.
+
+#include <boost/config.hpp>
+#include <iostream>
+
+#if defined(BOOST_HAS_UNISTD_H)
+
+#include "boost/container/vector.hpp"
+#include "boost/container/new_allocator.hpp"
+#include "boost/container/mmap_allocator.hpp"
+#include <boost/cstdint.hpp>
+#include <boost/timer/timer.hpp>
+
+#include <cstdlib>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+using boost::timer::cpu_timer;
+using boost::uint64_t;
+using namespace boost::container;
+
+#ifdef NDEBUG
+static const std::size_t DefaultMegabytes = 16u*1024u;
+#else
+static const std::size_t DefaultMegabytes = 256u;
+#endif
+
+template<class Allocator>
+void grow_vector(std::size_t n)
+{
+   cpu_timer timer;
+   timer.resume();
+   vector<uint64_t, Allocator> v;
+   std::size_t reallocations = 0u;
+   const uint64_t *data = v.data();
+   for(std::size_t i = 0; i != n; ++i){
+      v.push_back(uint64_t(i));
+      if(v.data() != data){
+         data = v.data();
+         ++reallocations;
+      }
+   }
+   timer.stop();
+   uint64_t sum = 0u;
+   for(std::size_t i = 0; i < n; i += 4096u){
+      sum += v[i];
+   }
+   std::cout << timer.elapsed().wall/1000000u << " ms, "
+             << reallocations << " reallocations (" << (sum % 2u) << ")";
+}
+
+template<class Allocator>
+void launch_test(const char *alloc_name, std::size_t n)
+{
+   std::cout << "   " << alloc_name << ": " << std::flush;
+   const pid_t pid = ::fork();
+   if(pid == 0){
+      grow_vector<Allocator>(n);
+      std::cout << std::flush;
+      std::_Exit(0);
+   }
+   int status = 0;
+   struct rusage usage;
+   if(pid < 0 || ::wait4(pid, &status, 0, &usage) != pid || !WIFEXITED(status)){
+      std::cout << "failed" << std::endl;
+      return;
+   }
+   //ru_maxrss is measured in kilobytes
+   std::cout << ", peak RSS " << usage.ru_maxrss/1024 << " MB" << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+   std::size_t megabytes = argc > 1 ? std::size_t(std::strtoul(argv[1], 0, 10)) : DefaultMegabytes;
+   //Leave room for the copy that new_allocator performs
+   const std::size_t phys_megabytes =
+      std::size_t(uint64_t(::sysconf(_SC_PHYS_PAGES))*uint64_t(::sysconf(_SC_PAGESIZE))/(1024u*1024u));
+   if(megabytes > phys_megabytes/3u){
+      megabytes = phys_megabytes/3u;
+      std::cout << "Not enough memory, the size is reduced to " << megabytes << " MB" << std::endl;
+   }
+   const std::size_t n = std::size_t(uint64_t(megabytes)*1024u*1024u/sizeof(uint64_t));
+
+   std::cout << "Growing vector<uint64_t> to " << megabytes << " MB (" << n << " elements)" << std::endl;
+   launch_test< new_allocator<uint64_t> >
+      ("new_allocator                             ", n);
+   launch_test< mmap_allocator<uint64_t, 0u> >
+      ("mmap_allocator<0>                         ", n);
+   launch_test< mmap_allocator<uint64_t, mmap_huge_pages> >
+      ("mmap_allocator<mmap_huge_pages>           ", n);
+   launch_test< mmap_allocator<uint64_t, mmap_huge_pages | mmap_populate> >
+      ("mmap_allocator<mmap_huge_pages | populate>", n);
+   launch_test< mmap_allocator<uint64_t, mmap_huge_pages | mmap_prefault> >
+      ("mmap_allocator<mmap_huge_pages | prefault>", n);
+   std::cout << "----------------------------------------------" << '\n' << std::endl;
+   return 0;
+}
+
+#else
+
+int main()
+{
+   std::cout << "mmap_allocator is not available in this platform" << std::endl;
+   return 0;
+}
+
+#endif   //#if defined(BOOST_HAS_UNISTD_H)
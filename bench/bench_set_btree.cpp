@@ -0,0 +1,36 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "boost/container/set.hpp"
+#include <set>
+
+#include "bench_set.hpp"
+
+int main()
+{
+   using namespace boost::container;
+
+   fill_range_ints();
+   fill_range_strings();
+
+   //set(B-tree) vs set(RB)
+   launch_tests< set<int, std::less<int>, std::allocator<int>, tree_assoc_options< tree_type<btree> >::type >, set<int> >
+      ("set<int>(B-tree)", "set<int>(RB)");
+   launch_tests< set<string, std::less<string>, std::allocator<string>, tree_assoc_options< tree_type<btree> >::type >, set<string> >
+      ("set<string>(B-tree)", "set<string>(RB)");
+
+   //multiset(B-tree) vs multiset(RB)
+   launch_tests< multiset<int, std::less<int>, std::allocator<int>, tree_assoc_options< tree_type<btree> >::type >, multiset<int> >
+      ("multiset<int>(B-tree)", "multiset<int>(RB)");
+   launch_tests< multiset<string, std::less<string>, std::allocator<string>, tree_assoc_options< tree_type<btree> >::type >, multiset<string> >
+      ("multiset<string>(B-tree)", "multiset<string>(RB)");
+
+   return 0;
+}
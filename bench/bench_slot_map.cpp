@@ -0,0 +1,133 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Measures insertion, a linear update of all the elements, lookups and erasures
+//through stable handles in slot_map (keys) and stable_vector (iterators)
+
+#include "boost/container/slot_map.hpp"
+#include "boost/container/stable_vector.hpp"
+#include "boost/container/vector.hpp"
+
+#include <boost/timer/timer.hpp>
+#include <iostream>
+
+using boost::timer::cpu_timer;
+
+#ifdef NDEBUG
+static const std::size_t NElements = 10000000;
+static const std::size_t NTicks = 10;
+#else
+static const std::size_t NElements = 100000;
+static const std::size_t NTicks = 2;
+#endif
+
+//stable_vector's erasure is linear, so few handles are erased
+static const std::size_t NErase = 1000;
+
+struct entity
+{
+   explicit entity(float v = 0.f)
+      : x(0.f), y(0.f), vx(v), vy(-v)
+   {}
+
+   float x, y, vx, vy;
+};
+
+typedef boost::container::slot_map<entity>      slot_map_t;
+typedef boost::container::stable_vector<entity> stable_vector_t;
+
+//Handles of slot_map are keys, handles of stable_vector are iterators
+template<class C>
+struct handle_traits
+{
+   typedef typename C::key_type handle_type;
+
+   static handle_type insert(C &c, const entity &e)
+   {  return c.insert(e);  }
+
+   static entity &get(C &c, const handle_type &h)
+   {  return c[h];  }
+
+   static void erase(C &c, const handle_type &h)
+   {  c.erase(h);  }
+};
+
+template<>
+struct handle_traits<stable_vector_t>
+{
+   typedef stable_vector_t::iterator handle_type;
+
+   static handle_type insert(stable_vector_t &c, const entity &e)
+   {
+      c.push_back(e);
+      return c.end() - 1;
+   }
+
+   static entity &get(stable_vector_t &, const handle_type &h)
+   {  return *h;  }
+
+   static void erase(stable_vector_t &c, const handle_type &h)
+   {  c.erase(h);  }
+};
+
+template<class C>
+void launch_tests(const char *cont_name)
+{
+   typedef handle_traits<C> traits;
+   typedef typename traits::handle_type handle_type;
+   std::cout << cont_name << std::endl;
+   cpu_timer timer;
+   float sum = 0.f;
+
+   C c;
+   boost::container::vector<handle_type> handles;
+   handles.reserve(NElements);
+   timer.start();
+   for(std::size_t i = 0; i != NElements; ++i){
+      handles.push_back(traits::insert(c, entity(float(i % 100u))));
+   }
+   timer.stop();
+   std::cout << "   insert:        " << timer.elapsed().wall/NElements << " ns/element" << std::endl;
+
+   timer.start();
+   for(std::size_t t = 0; t != NTicks; ++t){
+      for(typename C::iterator it = c.begin(), itend = c.end(); it != itend; ++it){
+         it->x += it->vx;
+         it->y += it->vy;
+      }
+   }
+   timer.stop();
+   std::cout << "   linear update: " << timer.elapsed().wall*1000u/(NTicks*NElements) << " ps/element" << std::endl;
+
+   //Visits elements through handles in a scattered order
+   timer.start();
+   for(std::size_t i = 0, j = 0; i != NElements; ++i, j = (j + 7919u) % NElements){
+      sum += traits::get(c, handles[j]).x;
+   }
+   timer.stop();
+   std::cout << "   lookup:        " << timer.elapsed().wall/NElements << " ns/element" << std::endl;
+
+   timer.start();
+   for(std::size_t i = 0; i != NErase; ++i){
+      traits::erase(c, handles[i*(NElements/NErase)]);
+   }
+   timer.stop();
+   std::cout << "   erase:         " << timer.elapsed().wall/NErase << " ns/element"
+             << " (" << (sum > 0.f) << ")" << std::endl;
+}
+
+int main()
+{
+   std::cout << "Entities: " << NElements << ", ticks: " << NTicks << std::endl;
+   launch_tests<slot_map_t>     ("slot_map");
+   launch_tests<stable_vector_t>("stable_vector");
+   std::cout << "----------------------------------------------" << '\n' << std::endl;
+   return 0;
+}
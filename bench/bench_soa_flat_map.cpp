@@ -0,0 +1,127 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Compares lookups in flat_map and soa_flat_map with small and big mapped values
+
+#include "boost/container/soa_flat_map.hpp"
+#include "boost/container/flat_map.hpp"
+#include "boost/container/vector.hpp"
+
+#include <boost/timer/timer.hpp>
+#include <iostream>
+#include <iomanip>
+#include <algorithm> //random_shuffle
+#include <cstdlib>   //srand
+
+using boost::timer::cpu_timer;
+using boost::timer::cpu_times;
+using boost::timer::nanosecond_type;
+
+#ifdef NDEBUG
+static const std::size_t MaxElements = 1000000;
+static const std::size_t NLookups    = 4000000;
+#else
+static const std::size_t MaxElements = 10000;
+static const std::size_t NLookups    = 40000;
+#endif
+
+template<std::size_t Size>
+struct payload
+{
+   payload()
+   {  data[0] = 0;  }
+
+   explicit payload(std::size_t i)
+   {  data[0] = static_cast<unsigned char>(i);  }
+
+   unsigned char data[Size];
+};
+
+template<class Map>
+std::size_t lookup(const Map &m, const boost::container::vector<int> &keys)
+{
+   std::size_t found = 0;
+   for(std::size_t i = 0; i != NLookups; ++i){
+      typename Map::const_iterator it = m.find(keys[i % keys.size()]);
+      found += it != m.end() ? (*it).second.data[0] : 1u;
+   }
+   return found;
+}
+
+double ns_per_op(cpu_times t, std::size_t n)
+{  return double(t.wall)/double(n);  }
+
+template<std::size_t Size>
+void bench_size(std::size_t n)
+{
+   using namespace boost::container;
+   typedef payload<Size>                  mapped_t;
+   typedef flat_map<int, mapped_t>        flat_map_t;
+   typedef soa_flat_map<int, mapped_t>    soa_map_t;
+
+   vector<int> keys, lookups;
+   vector<mapped_t> values;
+   flat_map_t fm;
+   fm.reserve(n);
+   for(std::size_t i = 0; i != n; ++i){
+      keys.push_back(int(i*2u));
+      values.push_back(mapped_t(i));
+      fm.insert(fm.end(), typename flat_map_t::value_type(int(i*2u), mapped_t(i)));
+      //Half of the lookups miss
+      lookups.push_back(int(i*2u));
+      lookups.push_back(int(i*2u + 1u));
+   }
+   std::srand(0);
+   std::random_shuffle(lookups.begin(), lookups.end());
+
+   //Keys and values are adopted without copying
+   cpu_timer timer;
+   soa_map_t sm(ordered_unique_range, boost::move(keys), boost::move(values));
+   timer.stop();
+   const cpu_times adopt = timer.elapsed();
+
+   timer.start();
+   std::size_t found = lookup(fm, lookups);
+   timer.stop();
+   const cpu_times flat_t = timer.elapsed();
+
+   timer.start();
+   found -= lookup(sm, lookups);
+   timer.stop();
+   const cpu_times soa_t = timer.elapsed();
+
+   if(found != 0u || sm.size() != fm.size()){
+      std::cout << "ERROR! lookups returned different results" << std::endl;
+   }
+
+   std::cout << std::setw(8) << n << " elements: adopt " << std::setw(8) << double(adopt.wall) << " ns"
+             << " | find: flat_map " << std::setw(6) << ns_per_op(flat_t, NLookups)
+             << " soa_flat_map " << std::setw(6) << ns_per_op(soa_t, NLookups) << " ns/lookup" << std::endl;
+}
+
+template<std::size_t Size>
+void launch_tests()
+{
+   std::cout << "**********************************************" << '\n';
+   std::cout << "Mapped type size: " << Size << '\n';
+   std::cout << "**********************************************" << '\n' << std::endl;
+   for(std::size_t n = 1000u; n <= MaxElements; n *= 10u){
+      bench_size<Size>(n);
+   }
+   std::cout << std::endl;
+}
+
+int main()
+{
+   std::cout << std::fixed << std::setprecision(1);
+   launch_tests<8>();
+   launch_tests<200>();
+   return 0;
+}
@@ -0,0 +1,1435 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_BIT_VECTOR_HPP
+#define BOOST_CONTAINER_BIT_VECTOR_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/is_trivially_relocatable.hpp>
+#include <boost/container/new_allocator.hpp> //new_allocator
+#include <boost/container/throw_exception.hpp>
+#include <boost/container/vector.hpp>
+// container/detail
+#include <boost/container/detail/bit_ops.hpp>
+#include <boost/container/detail/hash.hpp>
+#include <boost/container/detail/iterators.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/to_raw_pointer.hpp>
+#include <boost/container/detail/type_traits.hpp>
+// move
+#include <boost/move/adl_move_swap.hpp>
+#include <boost/move/traits.hpp>
+#include <boost/move/utility_core.hpp>
+// other
+#include <boost/assert.hpp>
+// std
+#include <algorithm> //std::copy, std::copy_backward, std::fill
+#include <climits>
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+#include <initializer_list>   //for std::initializer_list
+#endif
+
+namespace boost {
+namespace container {
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace container_detail {
+
+static const std::size_t bit_vector_bits_per_block = sizeof(std::size_t)*CHAR_BIT;
+
+inline std::size_t bit_vector_mask(std::size_t pos)
+{  return std::size_t(1u) << (pos % bit_vector_bits_per_block);  }
+
+//Proxy returned when a bit of a non-const bit_vector is accessed
+class bit_vector_reference
+{
+   public:
+   bit_vector_reference(std::size_t *block, std::size_t mask) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_block(block), m_mask(mask)
+   {}
+
+   bit_vector_reference(const bit_vector_reference &x) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_block(x.m_block), m_mask(x.m_mask)
+   {}
+
+   operator bool() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return (*m_block & m_mask) != 0u;  }
+
+   bool operator~() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return (*m_block & m_mask) == 0u;  }
+
+   bit_vector_reference &operator=(bool x) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(x)
+         *m_block |= m_mask;
+      else
+         *m_block &= ~m_mask;
+      return *this;
+   }
+
+   bit_vector_reference &operator=(const bit_vector_reference &x) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return *this = bool(x);  }
+
+   bit_vector_reference &flip() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      *m_block ^= m_mask;
+      return *this;
+   }
+
+   friend void swap(bit_vector_reference x, bit_vector_reference y) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const bool tmp = x;
+      x = bool(y);
+      y = tmp;
+   }
+
+   private:
+   std::size_t *m_block;
+   std::size_t m_mask;
+};
+
+//Random access iterator that holds the address of the blocks and the position of the bit
+template<bool IsConst>
+class bit_vector_iterator
+{
+   public:
+   typedef std::random_access_iterator_tag                                    iterator_category;
+   typedef bool                                                               value_type;
+   typedef std::ptrdiff_t                                                     difference_type;
+   typedef void                                                               pointer;
+   typedef typename if_c<IsConst, bool, bit_vector_reference>::type           reference;
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   typedef typename if_c<IsConst, const std::size_t, std::size_t>::type       block_type;
+   block_type *m_blocks;
+   std::size_t m_pos;
+
+   static bool priv_ref(const std::size_t *block, std::size_t mask)
+   {  return (*block & mask) != 0u;  }
+
+   static bit_vector_reference priv_ref(std::size_t *block, std::size_t mask)
+   {  return bit_vector_reference(block, mask);  }
+
+   public:
+   block_type *get_blocks() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_blocks;  }
+
+   std::size_t get_pos() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_pos;  }
+
+   bit_vector_iterator(block_type *blocks, std::size_t pos) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_blocks(blocks), m_pos(pos)
+   {}
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+
+   //Constructors
+   bit_vector_iterator() BOOST_NOEXCEPT_OR_NOTHROW
+      : m_blocks(), m_pos()
+   {}
+
+   bit_vector_iterator(bit_vector_iterator<false> const& other) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_blocks(other.get_blocks()), m_pos(other.get_pos())
+   {}
+
+   reference operator*() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return priv_ref(m_blocks + m_pos/bit_vector_bits_per_block, bit_vector_mask(m_pos));  }
+
+   reference operator[](difference_type off) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return *(*this + off);   }
+
+   //Increment / Decrement
+   bit_vector_iterator& operator++() BOOST_NOEXCEPT_OR_NOTHROW
+   { ++m_pos;  return *this; }
+
+   bit_vector_iterator operator++(int) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return bit_vector_iterator(m_blocks, m_pos++); }
+
+   bit_vector_iterator& operator--() BOOST_NOEXCEPT_OR_NOTHROW
+   {  --m_pos; return *this;  }
+
+   bit_vector_iterator operator--(int) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return bit_vector_iterator(m_blocks, m_pos--); }
+
+   //Arithmetic
+   bit_vector_iterator& operator+=(difference_type off) BOOST_NOEXCEPT_OR_NOTHROW
+   {  m_pos += std::size_t(off); return *this;   }
+
+   bit_vector_iterator& operator-=(difference_type off) BOOST_NOEXCEPT_OR_NOTHROW
+   {  m_pos -= std::size_t(off); return *this;   }
+
+   friend bit_vector_iterator operator+(bit_vector_iterator x, difference_type off) BOOST_NOEXCEPT_OR_NOTHROW
+   {  x.m_pos += std::size_t(off);  return x;  }
+
+   friend bit_vector_iterator operator+(difference_type off, bit_vector_iterator x) BOOST_NOEXCEPT_OR_NOTHROW
+   {  x.m_pos += std::size_t(off);  return x; }
+
+   friend bit_vector_iterator operator-(bit_vector_iterator x, difference_type off) BOOST_NOEXCEPT_OR_NOTHROW
+   {  x.m_pos -= std::size_t(off);  return x; }
+
+   friend difference_type operator-(const bit_vector_iterator &l, const bit_vector_iterator& r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return difference_type(l.m_pos - r.m_pos);   }
+
+   //Comparison operators
+   friend bool operator==   (const bit_vector_iterator& l, const bit_vector_iterator& r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_pos == r.m_pos;  }
+
+   friend bool operator!=   (const bit_vector_iterator& l, const bit_vector_iterator& r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_pos != r.m_pos;  }
+
+   friend bool operator<    (const bit_vector_iterator& l, const bit_vector_iterator& r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_pos < r.m_pos;  }
+
+   friend bool operator<=   (const bit_vector_iterator& l, const bit_vector_iterator& r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_pos <= r.m_pos;  }
+
+   friend bool operator>    (const bit_vector_iterator& l, const bit_vector_iterator& r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_pos > r.m_pos;  }
+
+   friend bool operator>=   (const bit_vector_iterator& l, const bit_vector_iterator& r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_pos >= r.m_pos;  }
+};
+
+}  //namespace container_detail {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! A bit_vector is a sequence of bits with the interface of std::vector<bool>
+//! that packs bits in blocks (machine words) obtained from the allocator, so each
+//! element uses a single bit. Bits not used in the last block are always zero.
+//!
+//! In addition to the sequence interface it offers bitset operations that work
+//! a block at a time: count() (population count), find_first() / find_next(),
+//! any(), all(), set(), reset(), flip() and bitwise &=, |= and ^= with another
+//! bit_vector of the same size. These bulk operations process 32 bytes per
+//! instruction with AVX2 when the compiler targets it.
+//!
+//! Elements are accessed through a proxy reference, so iterators are not true random
+//! access iterators as required by the standard, just like std::vector<bool>'s.
+//!
+//! \tparam Allocator The allocator whose rebound copy allocates the blocks. Its value_type should be bool.
+template <class Allocator BOOST_CONTAINER_DOCONLY(= new_allocator<bool>) >
+class bit_vector
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   typedef allocator_traits<Allocator>                                        allocator_traits_type;
+   typedef typename allocator_traits_type::template
+      portable_rebind_alloc<std::size_t>::type                                block_allocator_type;
+   typedef vector<std::size_t, block_allocator_type>                          block_vector_t;
+   BOOST_COPYABLE_AND_MOVABLE(bit_vector)
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //                    types
+   //
+   //////////////////////////////////////////////
+
+   typedef bool                                                                        value_type;
+   typedef typename ::boost::container::allocator_traits<Allocator>::size_type         size_type;
+   typedef typename ::boost::container::allocator_traits<Allocator>::difference_type   difference_type;
+   typedef Allocator                                                                   allocator_type;
+   typedef std::size_t                                                                 block_type;
+   typedef BOOST_CONTAINER_IMPDEF(container_detail::bit_vector_reference)              reference;
+   typedef bool                                                                        const_reference;
+   typedef BOOST_CONTAINER_IMPDEF(container_detail::bit_vector_iterator<false>)        iterator;
+   typedef BOOST_CONTAINER_IMPDEF(container_detail::bit_vector_iterator<true>)         const_iterator;
+   typedef BOOST_CONTAINER_IMPDEF(boost::container::reverse_iterator<iterator>)        reverse_iterator;
+   typedef BOOST_CONTAINER_IMPDEF(boost::container::reverse_iterator<const_iterator>)  const_reverse_iterator;
+
+   //! Number of bits stored in each block
+   static const size_type bits_per_block = container_detail::bit_vector_bits_per_block;
+
+   //! Value returned by find_first() and find_next() when no bit is found
+   static const size_type npos = size_type(-1);
+
+   //////////////////////////////////////////////
+   //
+   //          construct/copy/destroy
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Constructs a bit_vector taking the allocator as parameter.
+   //!
+   //! <b>Throws</b>: If allocator_type's default constructor throws.
+   //!
+   //! <b>Complexity</b>: Constant.
+   bit_vector()
+      : m_blocks(), m_size(0u)
+   {}
+
+   //! <b>Effects</b>: Constructs a bit_vector taking the allocator as parameter.
+   //!
+   //! <b>Throws</b>: Nothing
+   //!
+   //! <b>Complexity</b>: Constant.
+   explicit bit_vector(const allocator_type &a) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_blocks(block_allocator_type(a)), m_size(0u)
+   {}
+
+   //! <b>Effects</b>: Constructs a bit_vector that holds n false bits.
+   //!
+   //! <b>Throws</b>: If allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to n/bits_per_block.
+   explicit bit_vector(size_type n)
+      : m_blocks(priv_num_blocks(n)), m_size(n)
+   {}
+
+   //! <b>Effects</b>: Constructs a bit_vector that will use a copy of allocator a
+   //!   and holds n false bits.
+   //!
+   //! <b>Throws</b>: If allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to n/bits_per_block.
+   bit_vector(size_type n, const allocator_type &a)
+      : m_blocks(priv_num_blocks(n), block_allocator_type(a)), m_size(n)
+   {}
+
+   //! <b>Effects</b>: Constructs a bit_vector that holds n copies of value.
+   //!
+   //! <b>Throws</b>: If allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to n/bits_per_block.
+   bit_vector(size_type n, bool value)
+      : m_blocks(priv_num_blocks(n), priv_fill_block(value)), m_size(n)
+   {  this->priv_clear_unused_bits();  }
+
+   //! <b>Effects</b>: Constructs a bit_vector that will use a copy of allocator a
+   //!   and holds n copies of value.
+   //!
+   //! <b>Throws</b>: If allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to n/bits_per_block.
+   bit_vector(size_type n, bool value, const allocator_type &a)
+      : m_blocks(priv_num_blocks(n), priv_fill_block(value), block_allocator_type(a)), m_size(n)
+   {  this->priv_clear_unused_bits();  }
+
+   //! <b>Effects</b>: Constructs a bit_vector that holds the range [first, last)
+   //!   converted to bool.
+   //!
+   //! <b>Throws</b>: If allocation throws or dereferencing InIt throws.
+   //!
+   //! <b>Complexity</b>: Linear to the range [first, last).
+   template <class InIt>
+   bit_vector(InIt first, InIt last
+      BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename container_detail::disable_if_convertible
+         <InIt BOOST_MOVE_I size_type>::type * = 0)
+      )
+      : m_blocks(), m_size(0u)
+   {  this->assign(first, last);  }
+
+   //! <b>Effects</b>: Constructs a bit_vector that will use a copy of allocator a
+   //!   and holds the range [first, last) converted to bool.
+   //!
+   //! <b>Throws</b>: If allocation throws or dereferencing InIt throws.
+   //!
+   //! <b>Complexity</b>: Linear to the range [first, last).
+   template <class InIt>
+   bit_vector(InIt first, InIt last, const allocator_type &a
+      BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename container_detail::disable_if_convertible
+         <InIt BOOST_MOVE_I size_type>::type * = 0)
+      )
+      : m_blocks(block_allocator_type(a)), m_size(0u)
+   {  this->assign(first, last);  }
+
+   //! <b>Effects</b>: Copy constructs a bit_vector.
+   //!
+   //! <b>Postcondition</b>: x == *this.
+   //!
+   //! <b>Throws</b>: If allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to x.size()/bits_per_block.
+   bit_vector(const bit_vector &x)
+      : m_blocks(x.m_blocks), m_size(x.m_size)
+   {}
+
+   //! <b>Effects</b>: Copy constructs a bit_vector using the specified allocator.
+   //!
+   //! <b>Postcondition</b>: x == *this.
+   //!
+   //! <b>Throws</b>: If allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to x.size()/bits_per_block.
+   bit_vector(const bit_vector &x, const allocator_type &a)
+      : m_blocks(x.m_blocks, block_allocator_type(a)), m_size(x.m_size)
+   {}
+
+   //! <b>Effects</b>: Move constructor. Moves x's resources to *this.
+   //!
+   //! <b>Postcondition</b>: x.empty().
+   //!
+   //! <b>Throws</b>: Nothing
+   //!
+   //! <b>Complexity</b>: Constant.
+   bit_vector(BOOST_RV_REF(bit_vector) x) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_blocks(boost::move(x.m_blocks)), m_size(x.m_size)
+   {  x.m_size = 0u;  }
+
+   //! <b>Effects</b>: Move constructor using the specified allocator.
+   //!   Moves x's resources to *this if a == x.get_allocator().
+   //!   Otherwise copies the blocks of x.
+   //!
+   //! <b>Postcondition</b>: x.empty().
+   //!
+   //! <b>Throws</b>: If allocation throws.
+   //!
+   //! <b>Complexity</b>: Constant if a == x.get_allocator(), linear otherwise.
+   bit_vector(BOOST_RV_REF(bit_vector) x, const allocator_type &a)
+      : m_blocks(boost::move(x.m_blocks), block_allocator_type(a)), m_size(x.m_size)
+   {  x.priv_reset_moved_from();  }
+
+   #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Constructs a bit_vector that will use a copy of allocator a
+   //!   and holds the bits of il.
+   //!
+   //! <b>Throws</b>: If allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to il.size().
+   bit_vector(std::initializer_list<bool> il, const allocator_type& a = allocator_type())
+      : m_blocks(block_allocator_type(a)), m_size(0u)
+   {  this->assign(il.begin(), il.end());  }
+   #endif
+
+   //! <b>Effects</b>: Makes *this contain the same bits as x.
+   //!
+   //! <b>Postcondition</b>: x == *this.
+   //!
+   //! <b>Throws</b>: If allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to x.size()/bits_per_block.
+   bit_vector& operator=(BOOST_COPY_ASSIGN_REF(bit_vector) x)
+   {
+      if(&x != this){
+         this->m_blocks = x.m_blocks;
+         this->m_size   = x.m_size;
+      }
+      return *this;
+   }
+
+   //! <b>Effects</b>: Move assignment. All x's bits are transferred to *this.
+   //!
+   //! <b>Postcondition</b>: x.empty().
+   //!
+   //! <b>Throws</b>: If allocator_traits_type::propagate_on_container_move_assignment
+   //!   is false and allocation throws.
+   //!
+   //! <b>Complexity</b>: Constant if the allocator is propagated or
+   //!   this->get_allocator() == x.get_allocator(). Linear otherwise.
+   bit_vector& operator=(BOOST_RV_REF(bit_vector) x)
+      BOOST_NOEXCEPT_IF(allocator_traits_type::propagate_on_container_move_assignment::value
+                                  || allocator_traits_type::is_always_equal::value)
+   {
+      if(&x != this){
+         this->m_blocks = boost::move(x.m_blocks);
+         this->m_size   = x.m_size;
+         x.priv_reset_moved_from();
+      }
+      return *this;
+   }
+
+   #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Makes *this contain the bits of il.
+   //!
+   //! <b>Complexity</b>: Linear to il.size().
+   bit_vector& operator=(std::initializer_list<bool> il)
+   {
+      this->assign(il.begin(), il.end());
+      return *this;
+   }
+   #endif
+
+   //! <b>Effects</b>: Assigns the range [first, last) converted to bool to *this.
+   //!
+   //! <b>Throws</b>: If allocation throws or dereferencing InIt throws.
+   //!
+   //! <b>Complexity</b>: Linear to the range [first, last).
+   template <class InIt>
+   void assign(InIt first, InIt last
+      BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename container_detail::disable_if_convertible
+         <InIt BOOST_MOVE_I size_type>::type * = 0)
+      )
+   {
+      this->clear();
+      for(; first != last; ++first){
+         this->push_back(bool(*first));
+      }
+   }
+
+   #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Assigns the bits of il to *this.
+   //!
+   //! <b>Complexity</b>: Linear to il.size().
+   void assign(std::initializer_list<bool> il)
+   {  this->assign(il.begin(), il.end());  }
+   #endif
+
+   //! <b>Effects</b>: Assigns n copies of value to *this.
+   //!
+   //! <b>Throws</b>: If allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to n/bits_per_block.
+   void assign(size_type n, bool value)
+   {
+      this->m_blocks.assign(priv_num_blocks(n), priv_fill_block(value));
+      this->m_size = n;
+      this->priv_clear_unused_bits();
+   }
+
+   //! <b>Effects</b>: Returns a copy of the internal allocator.
+   //!
+   //! <b>Throws</b>: If allocator's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Constant.
+   allocator_type get_allocator() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return allocator_type(this->m_blocks.get_allocator());  }
+
+   //////////////////////////////////////////////
+   //
+   //                iterators
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns an iterator to the first bit.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   iterator begin() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return iterator(this->priv_blocks(), 0u);  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the first bit.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator begin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return const_iterator(this->priv_blocks(), 0u);  }
+
+   //! <b>Effects</b>: Returns an iterator to the end of the bit_vector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   iterator end() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return iterator(this->priv_blocks(), this->m_size);  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the end of the bit_vector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator end() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return const_iterator(this->priv_blocks(), this->m_size);  }
+
+   //! <b>Effects</b>: Returns a reverse_iterator pointing to the beginning
+   //! of the reversed bit_vector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   reverse_iterator rbegin() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return reverse_iterator(this->end());  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the beginning
+   //! of the reversed bit_vector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reverse_iterator rbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return const_reverse_iterator(this->end());  }
+
+   //! <b>Effects</b>: Returns a reverse_iterator pointing to the end
+   //! of the reversed bit_vector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   reverse_iterator rend() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return reverse_iterator(this->begin());  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end
+   //! of the reversed bit_vector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reverse_iterator rend() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return const_reverse_iterator(this->begin());  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the first bit.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator cbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->begin();  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the end of the bit_vector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator cend() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->end();  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the beginning
+   //! of the reversed bit_vector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reverse_iterator crbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->rbegin();  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end
+   //! of the reversed bit_vector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reverse_iterator crend() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->rend();  }
+
+   //////////////////////////////////////////////
+   //
+   //                capacity
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns true if the bit_vector contains no bits.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   bool empty() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !this->m_size;  }
+
+   //! <b>Effects</b>: Returns the number of bits.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_size;  }
+
+   //! <b>Effects</b>: Returns the largest possible size of the bit_vector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type max_size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const size_type max_blocks = this->m_blocks.max_size();
+      return max_blocks < size_type(-1)/bits_per_block ? size_type(max_blocks*bits_per_block) : size_type(-1);
+   }
+
+   //! <b>Effects</b>: Number of bits the bit_vector can hold without reallocating.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type capacity() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return size_type(this->m_blocks.capacity()*bits_per_block);  }
+
+   //! <b>Effects</b>: If n is less than or equal to capacity(), this call has no
+   //!   effect. Otherwise, it is a request for allocation of additional memory.
+   //!   If the request is successful, then capacity() is greater than or equal to
+   //!   n; otherwise, capacity() is unchanged. In either case, size() is unchanged.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or n > max_size().
+   void reserve(size_type n)
+   {
+      if(n > this->max_size()){
+         boost::container::throw_length_error("bit_vector::reserve max_size() exceeded");
+      }
+      this->m_blocks.reserve(priv_num_blocks(n));
+   }
+
+   //! <b>Effects</b>: Tries to deallocate the excess of memory created
+   //!   with previous allocations. The size of the bit_vector is unchanged
+   //!
+   //! <b>Throws</b>: If memory allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to size()/bits_per_block.
+   void shrink_to_fit()
+   {  this->m_blocks.shrink_to_fit();  }
+
+   //! <b>Effects</b>: Inserts or erases bits at the end such that
+   //!   the size becomes n. New bits are copies of value.
+   //!
+   //! <b>Throws</b>: If memory allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to the difference between size() and new_size, divided by bits_per_block.
+   void resize(size_type new_size, bool value = false)
+   {
+      const size_type old_size = this->m_size;
+      const size_type old_pos  = old_size % bits_per_block;
+      if(value && new_size > old_size && old_pos){
+         //Bits after new_size are cleared below
+         this->m_blocks.back() |= ~block_type(0u) << old_pos;
+      }
+      this->m_blocks.resize(priv_num_blocks(new_size), priv_fill_block(value));
+      this->m_size = new_size;
+      this->priv_clear_unused_bits();
+   }
+
+   //////////////////////////////////////////////
+   //
+   //               element access
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Returns a reference to the first bit.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   reference front() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return (*this)[0u];  }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Returns the value of the first bit.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reference front() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return (*this)[0u];  }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Returns a reference to the last bit.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   reference back() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return (*this)[this->m_size - 1u];  }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Returns the value of the last bit.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reference back() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return (*this)[this->m_size - 1u];  }
+
+   //! <b>Requires</b>: size() > n.
+   //!
+   //! <b>Effects</b>: Returns a reference to the nth bit.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   reference operator[](size_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(n < this->m_size);
+      return reference(this->priv_blocks() + n/bits_per_block, container_detail::bit_vector_mask(n));
+   }
+
+   //! <b>Requires</b>: size() > n.
+   //!
+   //! <b>Effects</b>: Returns the value of the nth bit.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reference operator[](size_type n) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(n < this->m_size);
+      return (this->priv_blocks()[n/bits_per_block] & container_detail::bit_vector_mask(n)) != 0u;
+   }
+
+   //! <b>Effects</b>: Returns a reference to the nth bit.
+   //!
+   //! <b>Throws</b>: std::out_of_range if n >= size()
+   //!
+   //! <b>Complexity</b>: Constant.
+   reference at(size_type n)
+   {
+      this->priv_check_range(n);
+      return (*this)[n];
+   }
+
+   //! <b>Effects</b>: Returns the value of the nth bit.
+   //!
+   //! <b>Throws</b>: std::out_of_range if n >= size()
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reference at(size_type n) const
+   {
+      this->priv_check_range(n);
+      return (*this)[n];
+   }
+
+   //! <b>Effects</b>: Returns the value of the nth bit.
+   //!
+   //! <b>Throws</b>: std::out_of_range if n >= size()
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   bool test(size_type n) const
+   {  return this->at(n);  }
+
+   //////////////////////////////////////////////
+   //
+   //                modifiers
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Inserts a bit with value x at the end of the bit_vector.
+   //!
+   //! <b>Throws</b>: If memory allocation throws.
+   //!
+   //! <b>Complexity</b>: Amortized constant time.
+   void push_back(bool x)
+   {
+      const size_type pos = this->m_size % bits_per_block;
+      if(!pos){
+         this->m_blocks.push_back(block_type(x));
+      }
+      else{
+         this->m_blocks.back() |= block_type(x) << pos;
+      }
+      ++this->m_size;
+   }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Removes the last bit.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant time.
+   void pop_back() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(!this->empty());
+      const size_type pos = --this->m_size % bits_per_block;
+      if(!pos){
+         this->m_blocks.pop_back();
+      }
+      else{
+         this->m_blocks.back() &= ~(block_type(1u) << pos);
+      }
+   }
+
+   //! <b>Requires</b>: p must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Inserts a bit with value x before p.
+   //!
+   //! <b>Returns</b>: an iterator to the inserted bit.
+   //!
+   //! <b>Throws</b>: If memory allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to the distance between p and end().
+   iterator insert(const_iterator p, bool x)
+   {
+      const size_type pos = this->priv_index_of(p);
+      if(pos == this->m_size){
+         this->push_back(x);
+      }
+      else{
+         this->priv_open_gap(pos, 1u);
+         (*this)[pos] = x;
+      }
+      return this->begin() + difference_type(pos);
+   }
+
+   //! <b>Requires</b>: p must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Inserts n copies of x before p.
+   //!
+   //! <b>Returns</b>: an iterator to the first inserted bit or p if n is 0.
+   //!
+   //! <b>Throws</b>: If memory allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to n plus the distance between p and end().
+   iterator insert(const_iterator p, size_type n, bool x)
+   {
+      const size_type pos = this->priv_index_of(p);
+      this->priv_open_gap(pos, n);
+      const iterator first(this->begin() + difference_type(pos));
+      std::fill(first, first + difference_type(n), x);
+      return first;
+   }
+
+   //! <b>Requires</b>: p must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Inserts the range [first, last) converted to bool before p.
+   //!
+   //! <b>Returns</b>: an iterator to the first inserted bit or p if first == last.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or dereferencing InIt throws.
+   //!
+   //! <b>Complexity</b>: Linear to the range [first, last) plus the distance between p and end().
+   template <class InIt>
+   iterator insert(const_iterator p, InIt first, InIt last
+      BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename container_detail::disable_if_convertible
+         <InIt BOOST_MOVE_I size_type>::type * = 0)
+      )
+   {
+      const size_type pos = this->priv_index_of(p);
+      if(pos == this->m_size){
+         for(; first != last; ++first){
+            this->push_back(bool(*first));
+         }
+      }
+      else{
+         //Single pass ranges are stored before making room for them
+         const bit_vector tmp(first, last, this->get_allocator());
+         this->priv_open_gap(pos, tmp.size());
+         std::copy(tmp.begin(), tmp.end(), this->begin() + difference_type(pos));
+      }
+      return this->begin() + difference_type(pos);
+   }
+
+   #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Requires</b>: p must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Inserts the bits of il before p.
+   //!
+   //! <b>Returns</b>: an iterator to the first inserted bit or p if il is empty.
+   //!
+   //! <b>Complexity</b>: Linear to il.size() plus the distance between p and end().
+   iterator insert(const_iterator p, std::initializer_list<bool> il)
+   {  return this->insert(p, il.begin(), il.end());  }
+   #endif
+
+   //! <b>Effects</b>: Erases the bit at p.
+   //!
+   //! <b>Returns</b>: an iterator to the bit that followed the erased one.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to the distance between p and end().
+   iterator erase(const_iterator p) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->erase(p, p + 1);  }
+
+   //! <b>Effects</b>: Erases the bits in the range [first, last).
+   //!
+   //! <b>Returns</b>: an iterator to the bit that followed the erased ones.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to the distance between first and end().
+   iterator erase(const_iterator first, const_iterator last) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const size_type pos = this->priv_index_of(first);
+      const size_type n   = size_type(last - first);
+      if(n){
+         const iterator b(this->begin());
+         std::copy(b + difference_type(pos + n), this->end(), b + difference_type(pos));
+         this->priv_erase_last_n(n);
+      }
+      return this->begin() + difference_type(pos);
+   }
+
+   //! <b>Effects</b>: Swaps the contents of *this and x.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   void swap(bit_vector& x)
+      BOOST_NOEXCEPT_IF( allocator_traits_type::propagate_on_container_swap::value
+                                || allocator_traits_type::is_always_equal::value)
+   {
+      this->m_blocks.swap(x.m_blocks);
+      ::boost::adl_move_swap(this->m_size, x.m_size);
+   }
+
+   //! <b>Effects</b>: Erases all the bits of the bit_vector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   void clear() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      this->m_blocks.clear();
+      this->m_size = 0u;
+   }
+
+   //////////////////////////////////////////////
+   //
+   //           bitset operations
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Sets all the bits to true.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to size()/bits_per_block.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   bit_vector &set() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      this->priv_fill(true);
+      return *this;
+   }
+
+   //! <b>Effects</b>: Sets the nth bit to value.
+   //!
+   //! <b>Throws</b>: std::out_of_range if n >= size()
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   bit_vector &set(size_type n, bool value = true)
+   {
+      this->at(n) = value;
+      return *this;
+   }
+
+   //! <b>Effects</b>: Sets all the bits to false.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to size()/bits_per_block.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   bit_vector &reset() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      this->priv_fill(false);
+      return *this;
+   }
+
+   //! <b>Effects</b>: Sets the nth bit to false.
+   //!
+   //! <b>Throws</b>: std::out_of_range if n >= size()
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   bit_vector &reset(size_type n)
+   {  return this->set(n, false);  }
+
+   //! <b>Effects</b>: Toggles all the bits.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to size()/bits_per_block.
+   bit_vector &flip() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      block_type *p = this->priv_blocks();
+      for(block_type *const e = p + this->m_blocks.size(); p != e; ++p){
+         *p = ~*p;
+      }
+      this->priv_clear_unused_bits();
+      return *this;
+   }
+
+   //! <b>Effects</b>: Toggles the nth bit.
+   //!
+   //! <b>Throws</b>: std::out_of_range if n >= size()
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   bit_vector &flip(size_type n)
+   {
+      this->at(n).flip();
+      return *this;
+   }
+
+   //! <b>Effects</b>: Returns the number of bits set to true.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to size()/bits_per_block.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   size_type count() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return size_type(container_detail::bit_count_blocks(this->priv_blocks(), this->m_blocks.size()));  }
+
+   //! <b>Effects</b>: Returns true if any bit is set to true.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to size()/bits_per_block.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   bool any() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->priv_find_from_block(0u) != npos;  }
+
+   //! <b>Effects</b>: Returns true if no bit is set to true.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to size()/bits_per_block.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   bool none() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !this->any();  }
+
+   //! <b>Effects</b>: Returns true if all the bits are set to true (or the bit_vector is empty).
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to size()/bits_per_block.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   bool all() const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const block_type *const p = this->priv_blocks();
+      const size_type full_blocks = this->m_size / bits_per_block;
+      for(size_type i = 0; i != full_blocks; ++i){
+         if(p[i] != ~block_type(0u))
+            return false;
+      }
+      const size_type last_bits = this->m_size % bits_per_block;
+      return !last_bits || p[full_blocks] == ~(~block_type(0u) << last_bits);
+   }
+
+   //! <b>Effects</b>: Returns the position of the first bit set to true or npos if there is none.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to the position of the found bit divided by bits_per_block.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   size_type find_first() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->priv_find_from_block(0u);  }
+
+   //! <b>Effects</b>: Returns the position of the first bit set to true after pos
+   //!   or npos if there is none.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to the distance between pos and the found bit divided by bits_per_block.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   size_type find_next(size_type pos) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(pos >= this->m_size || ++pos == this->m_size){
+         return npos;
+      }
+      const size_type blk = pos / bits_per_block;
+      const block_type b = this->priv_blocks()[blk] >> (pos % bits_per_block);
+      return b ? size_type(pos + container_detail::bit_ctz(b)) : this->priv_find_from_block(blk + 1u);
+   }
+
+   //! <b>Requires</b>: size() == x.size()
+   //!
+   //! <b>Effects</b>: Sets each bit to the result of its logical AND with the bit of x in the same position.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to size()/bits_per_block.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   bit_vector &operator&=(const bit_vector &x) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->priv_transform<container_detail::bit_and_op>(x);  }
+
+   //! <b>Requires</b>: size() == x.size()
+   //!
+   //! <b>Effects</b>: Sets each bit to the result of its logical OR with the bit of x in the same position.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to size()/bits_per_block.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   bit_vector &operator|=(const bit_vector &x) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->priv_transform<container_detail::bit_or_op>(x);  }
+
+   //! <b>Requires</b>: size() == x.size()
+   //!
+   //! <b>Effects</b>: Sets each bit to the result of its logical XOR with the bit of x in the same position.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to size()/bits_per_block.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   bit_vector &operator^=(const bit_vector &x) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->priv_transform<container_detail::bit_xor_op>(x);  }
+
+   //! <b>Effects</b>: Returns a copy of *this with all the bits toggled.
+   //!
+   //! <b>Complexity</b>: Linear to size()/bits_per_block.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   bit_vector operator~() const
+   {
+      bit_vector r(*this);
+      r.flip();
+      return boost::move(r);
+   }
+
+   //! <b>Requires</b>: x.size() == y.size()
+   //!
+   //! <b>Effects</b>: Returns the logical AND of x and y.
+   //!
+   //! <b>Complexity</b>: Linear to size()/bits_per_block.
+   friend bit_vector operator&(const bit_vector &x, const bit_vector &y)
+   {
+      bit_vector r(x);
+      r &= y;
+      return boost::move(r);
+   }
+
+   //! <b>Requires</b>: x.size() == y.size()
+   //!
+   //! <b>Effects</b>: Returns the logical OR of x and y.
+   //!
+   //! <b>Complexity</b>: Linear to size()/bits_per_block.
+   friend bit_vector operator|(const bit_vector &x, const bit_vector &y)
+   {
+      bit_vector r(x);
+      r |= y;
+      return boost::move(r);
+   }
+
+   //! <b>Requires</b>: x.size() == y.size()
+   //!
+   //! <b>Effects</b>: Returns the logical XOR of x and y.
+   //!
+   //! <b>Complexity</b>: Linear to size()/bits_per_block.
+   friend bit_vector operator^(const bit_vector &x, const bit_vector &y)
+   {
+      bit_vector r(x);
+      r ^= y;
+      return boost::move(r);
+   }
+
+   //! <b>Effects</b>: Returns true if x and y are equal
+   //!
+   //! <b>Complexity</b>: Linear to size()/bits_per_block.
+   friend bool operator==(const bit_vector& x, const bit_vector& y)
+   {  return x.m_size == y.m_size && x.m_blocks == y.m_blocks;  }
+
+   //! <b>Effects</b>: Returns true if x and y are unequal
+   //!
+   //! <b>Complexity</b>: Linear to size()/bits_per_block.
+   friend bool operator!=(const bit_vector& x, const bit_vector& y)
+   {  return !(x == y); }
+
+   //! <b>Effects</b>: Returns the hash value of x. Equal containers have equal hash values.
+   //!
+   //! <b>Complexity</b>: Linear to size()/bits_per_block.
+   friend std::size_t hash_value(const bit_vector& x)
+   {
+      return container_detail::hash_bytes
+         (x.priv_blocks(), x.m_blocks.size()*sizeof(block_type), std::size_t(x.m_size));
+   }
+
+   //! <b>Effects</b>: Returns true if x is lexicographically less than y
+   //!
+   //! <b>Complexity</b>: Linear to the number of bits in the container.
+   friend bool operator<(const bit_vector& x, const bit_vector& y)
+   {
+      const_iterator first1(x.cbegin()), first2(y.cbegin());
+      const const_iterator last1(x.cend()), last2(y.cend());
+      for ( ; (first1 != last1) && (first2 != last2); ++first1, ++first2 ) {
+         if (*first1 != *first2) return *first2;
+      }
+      return (first1 == last1) && (first2 != last2);
+   }
+
+   //! <b>Effects</b>: Returns true if x is greater than y
+   //!
+   //! <b>Complexity</b>: Linear to the number of bits in the container.
+   friend bool operator>(const bit_vector& x, const bit_vector& y)
+   {  return y < x;  }
+
+   //! <b>Effects</b>: Returns true if x is equal or less than y
+   //!
+   //! <b>Complexity</b>: Linear to the number of bits in the container.
+   friend bool operator<=(const bit_vector& x, const bit_vector& y)
+   {  return !(y < x);  }
+
+   //! <b>Effects</b>: Returns true if x is equal or greater than y
+   //!
+   //! <b>Complexity</b>: Linear to the number of bits in the container.
+   friend bool operator>=(const bit_vector& x, const bit_vector& y)
+   {  return !(x < y);  }
+
+   //! <b>Effects</b>: x.swap(y)
+   //!
+   //! <b>Complexity</b>: Constant.
+   friend void swap(bit_vector& x, bit_vector& y)
+   {  x.swap(y);  }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+
+   static size_type priv_num_blocks(size_type n)
+   {  return size_type(n/bits_per_block + size_type((n % bits_per_block) != 0u));  }
+
+   static block_type priv_fill_block(bool value)
+   {  return value ? ~block_type(0u) : block_type(0u);  }
+
+   block_type *priv_blocks() const
+   {  return const_cast<block_type*>(container_detail::to_raw_pointer(this->m_blocks.data()));  }
+
+   size_type priv_index_of(const_iterator p) const
+   {
+      BOOST_ASSERT(p.get_pos() <= this->m_size);
+      return size_type(p.get_pos());
+   }
+
+   void priv_check_range(size_type n) const
+   {
+      if(n >= this->m_size){
+         throw_out_of_range("bit_vector::at out of range");
+      }
+   }
+
+   //Keeps the invariant: bits after size() in the last block are zero
+   void priv_clear_unused_bits() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const size_type last_bits = this->m_size % bits_per_block;
+      if(last_bits){
+         this->m_blocks.back() &= ~(~block_type(0u) << last_bits);
+      }
+   }
+
+   void priv_fill(bool value) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      block_type *const p = this->priv_blocks();
+      std::fill(p, p + this->m_blocks.size(), priv_fill_block(value));
+      this->priv_clear_unused_bits();
+   }
+
+   void priv_reset_moved_from() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      this->m_blocks.clear();
+      this->m_size = 0u;
+   }
+
+   void priv_erase_last_n(size_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(n <= this->m_size);
+      this->m_size -= n;
+      this->m_blocks.erase(this->m_blocks.nth(priv_num_blocks(this->m_size)), this->m_blocks.cend());
+      this->priv_clear_unused_bits();
+   }
+
+   //Shifts the bits in [pos, size()) n positions towards the end
+   void priv_open_gap(size_type pos, size_type n)
+   {
+      BOOST_ASSERT(pos <= this->m_size);
+      if(this->max_size() - this->m_size < n){
+         boost::container::throw_length_error("bit_vector::insert max_size() exceeded");
+      }
+      const size_type old_size = this->m_size;
+      this->resize(old_size + n);
+      const iterator b(this->begin());
+      std::copy_backward(b + difference_type(pos), b + difference_type(old_size), this->end());
+   }
+
+   size_type priv_find_from_block(size_type blk) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const block_type *const p = this->priv_blocks();
+      for(const size_type num_blocks = this->m_blocks.size(); blk < num_blocks; ++blk){
+         if(p[blk]){
+            return size_type(blk*bits_per_block + container_detail::bit_ctz(p[blk]));
+         }
+      }
+      return npos;
+   }
+
+   template<class Op>
+   bit_vector &priv_transform(const bit_vector &x) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(this->m_size == x.m_size);
+      container_detail::bit_transform_blocks<Op>(this->priv_blocks(), x.priv_blocks(), this->m_blocks.size());
+      return *this;
+   }
+
+   block_vector_t m_blocks;
+   size_type      m_size;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+template <class Allocator>
+const typename bit_vector<Allocator>::size_type bit_vector<Allocator>::bits_per_block;
+
+template <class Allocator>
+const typename bit_vector<Allocator>::size_type bit_vector<Allocator>::npos;
+
+//!is_trivially_relocatable<> specialization: the bit_vector only holds
+//!a vector of blocks and its size
+template <class Allocator>
+struct is_trivially_relocatable<bit_vector<Allocator> >
+   : container_detail::is_trivially_relocatable_container
+      <typename allocator_traits<Allocator>::template portable_rebind_alloc<std::size_t>::type>
+{};
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+}} //namespace boost::container
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace boost {
+
+//!has_trivial_destructor_after_move<> == true_type
+//!specialization for optimizations
+template <class Allocator>
+struct has_trivial_destructor_after_move<boost::container::bit_vector<Allocator> >
+{
+   typedef typename ::boost::container::allocator_traits<Allocator>::template
+      portable_rebind_alloc<std::size_t>::type block_allocator_type;
+   static const bool value = ::boost::has_trivial_destructor_after_move
+      < ::boost::container::vector<std::size_t, block_allocator_type> >::value;
+};
+
+}
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+namespace std {
+
+//!std::hash specialization, equivalent to boost::hash
+template <class Allocator>
+struct hash< ::boost::container::bit_vector<Allocator> >
+{
+   std::size_t operator()(const ::boost::container::bit_vector<Allocator> &x) const
+   {  return ::boost::hash< ::boost::container::bit_vector<Allocator> >()(x);  }
+};
+
+}  //namespace std {
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif //   #ifndef  BOOST_CONTAINER_BIT_VECTOR_HPP
@@ -0,0 +1,631 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_CONCURRENT_FLAT_MAP_HPP
+#define BOOST_CONTAINER_CONCURRENT_FLAT_MAP_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/flat_map.hpp>
+#include <boost/container/new_allocator.hpp> //new_allocator
+// container/detail
+#include <boost/container/detail/atomic.hpp>
+#include <boost/container/detail/math_functions.hpp>
+#include <boost/container/detail/mutex.hpp>
+#include <boost/container/detail/to_raw_pointer.hpp>
+// move
+#include <boost/move/utility_core.hpp>
+// intrusive/detail
+#include <boost/intrusive/detail/minimal_pair_header.hpp>      //pair
+#include <boost/intrusive/detail/minimal_less_equal_header.hpp>//less, equal
+// other
+#include <boost/assert.hpp>
+#include <boost/core/no_exceptions_support.hpp>
+// std
+#include <climits>   //CHAR_BIT
+
+namespace boost {
+namespace container {
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace container_detail {
+
+//Assumed size of a cache line, used to keep the reader counters of different slots apart
+static const std::size_t concurrent_flat_map_cache_line_size = 64u;
+
+//A published, immutable version of the map. The container holds a reference
+//to the current version and each snapshot holds another one.
+template<class Map>
+struct concurrent_flat_map_version
+{
+   typedef typename Map::allocator_type                     allocator_type;
+   typedef typename allocator_traits<allocator_type>::template
+      portable_rebind_alloc<concurrent_flat_map_version>::type version_allocator_type;
+   typedef allocator_traits<version_allocator_type>         version_allocator_traits;
+   typedef typename version_allocator_traits::pointer       version_pointer;
+
+   explicit concurrent_flat_map_version(BOOST_RV_REF(Map) m)
+      : m_map(boost::move(m)), m_use_count(1u)
+   {}
+
+   static concurrent_flat_map_version *create(BOOST_RV_REF(Map) m)
+   {
+      version_allocator_type a(m.get_allocator());
+      const version_pointer p = version_allocator_traits::allocate(a, 1u);
+      BOOST_TRY{
+         version_allocator_traits::construct(a, container_detail::to_raw_pointer(p), boost::move(m));
+      }
+      BOOST_CATCH(...){
+         version_allocator_traits::deallocate(a, p, 1u);
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      return container_detail::to_raw_pointer(p);
+   }
+
+   void add_ref()
+   {  container_detail::atomic_fetch_add(&m_use_count, 1u);  }
+
+   //Destroys the version when the last reference is released
+   void release()
+   {
+      if(container_detail::atomic_fetch_sub(&m_use_count, 1u) == 1u){
+         version_allocator_type a(m_map.get_allocator());
+         version_allocator_traits::destroy(a, this);
+         version_allocator_traits::deallocate(a, version_pointer(this), 1u);
+      }
+   }
+
+   Map m_map;
+   volatile std::size_t m_use_count;
+
+   private:
+   concurrent_flat_map_version(const concurrent_flat_map_version &);
+   concurrent_flat_map_version &operator=(const concurrent_flat_map_version &);
+};
+
+//Number of readers inside a read-side critical section, one counter
+//for each epoch parity. Readers are spread between several slots so
+//that they don't write to the same cache line.
+struct concurrent_flat_map_reader_slot
+{
+   concurrent_flat_map_reader_slot()
+   {  m_readers[0] = m_readers[1] = 0u;  }
+
+   char m_padding[concurrent_flat_map_cache_line_size];
+   volatile std::size_t m_readers[2];
+};
+
+//Keeps the reader counted in the slot during its lifetime
+class concurrent_flat_map_read_guard
+{
+   public:
+   concurrent_flat_map_read_guard(concurrent_flat_map_reader_slot &s, const volatile std::size_t &epoch)
+      : m_counter(&s.m_readers[container_detail::atomic_load(&epoch) & 1u])
+   {  container_detail::atomic_fetch_add(m_counter, 1u);  }
+
+   ~concurrent_flat_map_read_guard()
+   {  container_detail::atomic_fetch_sub(m_counter, 1u);  }
+
+   private:
+   concurrent_flat_map_read_guard(const concurrent_flat_map_read_guard &);
+   concurrent_flat_map_read_guard &operator=(const concurrent_flat_map_read_guard &);
+
+   volatile std::size_t *m_counter;
+};
+
+//Reference counted handle to a version of the map
+template<class Map>
+class concurrent_flat_map_snapshot
+{
+   typedef concurrent_flat_map_version<Map> version_t;
+   BOOST_COPYABLE_AND_MOVABLE(concurrent_flat_map_snapshot)
+
+   template <class, class, class, class>
+   friend class boost::container::concurrent_flat_map;
+
+   explicit concurrent_flat_map_snapshot(version_t *v)
+      : mp_version(v)
+   {  mp_version->add_ref();  }
+
+   public:
+   typedef Map map_type;
+
+   //! <b>Effects</b>: Constructs an empty snapshot.
+   concurrent_flat_map_snapshot()
+      : mp_version(0)
+   {}
+
+   //! <b>Effects</b>: Constructs a snapshot of the same version as x.
+   concurrent_flat_map_snapshot(const concurrent_flat_map_snapshot &x)
+      : mp_version(x.mp_version)
+   {
+      if(mp_version)
+         mp_version->add_ref();
+   }
+
+   //! <b>Effects</b>: Move constructor. x becomes empty.
+   concurrent_flat_map_snapshot(BOOST_RV_REF(concurrent_flat_map_snapshot) x)
+      : mp_version(x.mp_version)
+   {  x.mp_version = 0;  }
+
+   //! <b>Effects</b>: Releases the version. The last snapshot of a version
+   //!   that is no longer published destroys it.
+   ~concurrent_flat_map_snapshot()
+   {
+      if(mp_version)
+         mp_version->release();
+   }
+
+   concurrent_flat_map_snapshot &operator=(BOOST_COPY_ASSIGN_REF(concurrent_flat_map_snapshot) x)
+   {
+      concurrent_flat_map_snapshot tmp(x);
+      this->swap(tmp);
+      return *this;
+   }
+
+   concurrent_flat_map_snapshot &operator=(BOOST_RV_REF(concurrent_flat_map_snapshot) x)
+   {
+      concurrent_flat_map_snapshot tmp(boost::move(x));
+      this->swap(tmp);
+      return *this;
+   }
+
+   void swap(concurrent_flat_map_snapshot &x)
+   {
+      version_t *const tmp = mp_version;
+      mp_version = x.mp_version;
+      x.mp_version = tmp;
+   }
+
+   friend void swap(concurrent_flat_map_snapshot &l, concurrent_flat_map_snapshot &r)
+   {  l.swap(r);  }
+
+   //! <b>Returns</b>: true if the snapshot holds no version.
+   bool empty() const
+   {  return !mp_version;  }
+
+   //! <b>Requires</b>: !empty().
+   //!
+   //! <b>Returns</b>: The map of the version, that is never modified.
+   const map_type &get() const
+   {  BOOST_ASSERT(mp_version); return mp_version->m_map;  }
+
+   const map_type &operator*() const
+   {  return this->get();  }
+
+   const map_type *operator->() const
+   {  return &this->get();  }
+
+   private:
+   version_t *mp_version;
+};
+
+}  //namespace container_detail {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! A concurrent_flat_map is a read-mostly map that can be read and replaced by several
+//! threads at the same time without external synchronization.
+//!
+//! The contents are an immutable flat_map published through an atomically swapped pointer.
+//! Readers never lock or wait: they announce themselves in one of several per-epoch reader
+//! counters (spread over different cache lines so that readers on different cores don't
+//! write to the same one), load the current version and either read it in place
+//! (visitation) or take a reference counted snapshot of it that can be kept indefinitely.
+//!
+//! Writers are serialized by a lock. A writer copies the current map, applies a whole batch
+//! of mutations to the copy and publishes it. The previous version is reclaimed once all
+//! readers that could have loaded it have left (epoch-based reclamation) and its last
+//! snapshot is released. Each publication costs a copy of the map, so it suits maps that are
+//! read all the time and replaced or updated in batches now and then.
+//!
+//! Visitation functions must not access the container and should be short,
+//! as a writer waits for the readers of the previous version before returning.
+//!
+//! \tparam Key is the key_type of the map
+//! \tparam T is the <code>mapped_type</code>
+//! \tparam Compare is the ordering function for Keys (e.g. <i>std::less<Key></i>).
+//! \tparam Allocator is the allocator to allocate the <code>value_type</code>s
+//!   (e.g. <i>allocator< std::pair<Key, T> > </i>).
+#ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
+template < class Key, class T, class Compare = std::less<Key>
+         , class Allocator = new_allocator< std::pair< Key, T> > >
+#else
+template <class Key, class T, class Compare, class Allocator>
+#endif
+class concurrent_flat_map
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   typedef typename container_detail::default_mutex                       mutex_type;
+   typedef container_detail::scoped_lock<mutex_type>                      scoped_lock;
+   typedef container_detail::concurrent_flat_map_reader_slot              slot_type;
+   typedef container_detail::concurrent_flat_map_read_guard               read_guard;
+   typedef typename allocator_traits<Allocator>::template
+      portable_rebind_alloc<slot_type>::type                               slot_allocator_type;
+   typedef allocator_traits<slot_allocator_type>                          slot_allocator_traits;
+   typedef typename slot_allocator_traits::pointer                        slot_pointer;
+
+   //Non-copyable and non-movable as readers and writers synchronize through its members
+   concurrent_flat_map(const concurrent_flat_map &);
+   concurrent_flat_map &operator=(const concurrent_flat_map &);
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //                    types
+   //
+   //////////////////////////////////////////////
+
+   typedef flat_map<Key, T, Compare, Allocator>                                     map_type;
+   typedef Key                                                                      key_type;
+   typedef T                                                                        mapped_type;
+   typedef std::pair<Key, T>                                                        value_type;
+   typedef Compare                                                                  key_compare;
+   typedef Allocator                                                                allocator_type;
+   typedef typename boost::container::allocator_traits<Allocator>::size_type        size_type;
+   typedef BOOST_CONTAINER_IMPDEF
+      (container_detail::concurrent_flat_map_snapshot<map_type>)                    snapshot_type;
+
+   //! The number of reader slots used by default.
+   static const size_type default_reader_slot_count = 64u;
+
+   //////////////////////////////////////////////
+   //
+   //          construct/destroy
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Constructs an empty concurrent_flat_map with at least reader_slot_count
+   //!   reader slots (rounded up to a power of two) using the specified comparison object
+   //!   and allocator.
+   //!
+   //! <b>Complexity</b>: Linear in reader_slot_count.
+   explicit concurrent_flat_map( size_type reader_slot_count = default_reader_slot_count
+                               , const Compare &comp = Compare()
+                               , const allocator_type &a = allocator_type())
+      : m_epoch(0u), mp_current(0), m_alloc(a), m_slots(), m_slot_count(0u), m_slot_shift(0u), m_write_mutex()
+   {  this->priv_init(map_type(comp, a), reader_slot_count);  }
+
+   //! <b>Effects</b>: Constructs an empty concurrent_flat_map with the default number of
+   //!   reader slots using the specified allocator.
+   //!
+   //! <b>Complexity</b>: Linear in the default number of reader slots.
+   explicit concurrent_flat_map(const allocator_type &a)
+      : m_epoch(0u), mp_current(0), m_alloc(a), m_slots(), m_slot_count(0u), m_slot_shift(0u), m_write_mutex()
+   {  this->priv_init(map_type(a), default_reader_slot_count);  }
+
+   //! <b>Effects</b>: Constructs a concurrent_flat_map whose first version are the contents of m,
+   //!   that are moved, with at least reader_slot_count reader slots.
+   //!
+   //! <b>Complexity</b>: Linear in reader_slot_count.
+   explicit concurrent_flat_map( BOOST_RV_REF(map_type) m
+                               , size_type reader_slot_count = default_reader_slot_count)
+      : m_epoch(0u), mp_current(0), m_alloc(m.get_allocator()), m_slots(), m_slot_count(0u), m_slot_shift(0u), m_write_mutex()
+   {  this->priv_init(boost::move(m), reader_slot_count);  }
+
+   //! <b>Effects</b>: Releases the current version and destroys the concurrent_flat_map.
+   //!   No other thread can access the container. Snapshots keep their version alive.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements if no snapshot of the
+   //!   current version is alive.
+   ~concurrent_flat_map()
+   {
+      this->priv_current()->release();
+      this->priv_destroy_slots();
+   }
+
+   //////////////////////////////////////////////
+   //
+   //                observers
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns a copy of the allocator that was passed to the object's constructor.
+   //!
+   //! <b>Complexity</b>: Constant.
+   allocator_type get_allocator() const
+   {  return m_alloc;  }
+
+   //! <b>Effects</b>: Returns the comparison object out of which a was constructed.
+   //!
+   //! <b>Complexity</b>: Constant.
+   key_compare key_comp() const
+   {  return this->snapshot()->key_comp();  }
+
+   //! <b>Effects</b>: Returns the number of reader slots.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type reader_slot_count() const
+   {  return m_slot_count;  }
+
+   //////////////////////////////////////////////
+   //
+   //                  readers
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns a snapshot of the current version. The snapshot
+   //!   is not affected by later publications.
+   //!
+   //! <b>Complexity</b>: Constant. Never waits for other threads.
+   snapshot_type snapshot() const
+   {
+      read_guard g(this->priv_reader_slot(), m_epoch);
+      return snapshot_type(this->priv_current());
+   }
+
+   //! <b>Effects</b>: Returns the number of elements of the current version.
+   //!
+   //! <b>Complexity</b>: Constant. Never waits for other threads.
+   size_type size() const
+   {
+      read_guard g(this->priv_reader_slot(), m_epoch);
+      return this->priv_current()->m_map.size();
+   }
+
+   //! <b>Effects</b>: Returns true if the current version contains no elements.
+   //!
+   //! <b>Complexity</b>: Constant. Never waits for other threads.
+   bool empty() const
+   {
+      read_guard g(this->priv_reader_slot(), m_epoch);
+      return this->priv_current()->m_map.empty();
+   }
+
+   //! <b>Returns</b>: The number of elements of the current version with key equivalent to k (0 or 1).
+   //!
+   //! <b>Complexity</b>: Logarithmic. Never waits for other threads.
+   size_type count(const key_type &k) const
+   {
+      read_guard g(this->priv_reader_slot(), m_epoch);
+      return this->priv_current()->m_map.count(k);
+   }
+
+   //! <b>Effects</b>: Invokes f with a const reference to the element of the current
+   //!   version whose key is equivalent to k, if any.
+   //!
+   //! <b>Returns</b>: The number of visited elements (0 or 1).
+   //!
+   //! <b>Complexity</b>: Logarithmic. Never waits for other threads.
+   template<class F>
+   size_type visit(const key_type &k, F f) const
+   {
+      read_guard g(this->priv_reader_slot(), m_epoch);
+      const map_type &m = this->priv_current()->m_map;
+      const typename map_type::const_iterator it = m.find(k);
+      if(it == m.end())
+         return 0u;
+      f(*it);
+      return 1u;
+   }
+
+   //! <b>Effects</b>: Equivalent to visit(k, f).
+   template<class F>
+   size_type cvisit(const key_type &k, F f) const
+   {  return this->visit(k, f);  }
+
+   //! <b>Effects</b>: Invokes f with a const reference to each element of the current version,
+   //!   in key order. Writers publishing during the call wait until it returns, so long
+   //!   traversals should use a snapshot instead.
+   //!
+   //! <b>Returns</b>: The number of visited elements.
+   //!
+   //! <b>Complexity</b>: Linear in the number of elements. Never waits for other threads.
+   template<class F>
+   size_type visit_all(F f) const
+   {
+      read_guard g(this->priv_reader_slot(), m_epoch);
+      const map_type &m = this->priv_current()->m_map;
+      for(typename map_type::const_iterator it = m.begin(), itend = m.end(); it != itend; ++it){
+         f(*it);
+      }
+      return m.size();
+   }
+
+   //! <b>Effects</b>: Equivalent to visit_all(f).
+   template<class F>
+   size_type cvisit_all(F f) const
+   {  return this->visit_all(f);  }
+
+   //////////////////////////////////////////////
+   //
+   //                  writers
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Copies the current version, invokes f with a reference to the copy
+   //!   so that it applies a batch of mutations and publishes the result. f must not access
+   //!   the container. If f throws nothing is published.
+   //!
+   //! <b>Complexity</b>: Linear in the number of elements plus the cost of f. Waits for
+   //!   the readers of the previous version and for other writers.
+   template<class F>
+   void update(F f)
+   {
+      scoped_lock lock(m_write_mutex);
+      map_type m(this->priv_current()->m_map);
+      f(m);
+      this->priv_publish(boost::move(m));
+   }
+
+   //! <b>Effects</b>: Publishes the contents of m, that are moved, as the new version.
+   //!
+   //! <b>Complexity</b>: Constant plus the destruction of the previous version if no
+   //!   snapshot holds it. Waits for the readers of the previous version and for other writers.
+   void replace(BOOST_RV_REF(map_type) m)
+   {
+      scoped_lock lock(m_write_mutex);
+      this->priv_publish(boost::move(m));
+   }
+
+   //! <b>Effects</b>: Publishes a copy of m as the new version.
+   //!
+   //! <b>Complexity</b>: Linear in m.size(). Waits for the readers of the previous
+   //!   version and for other writers.
+   void replace(const map_type &m)
+   {
+      map_type tmp(m);
+      this->replace(boost::move(tmp));
+   }
+
+   //! <b>Effects</b>: Publishes a new version that also contains x if there is no element
+   //!   with an equivalent key. Updates that change several elements should use update().
+   //!
+   //! <b>Returns</b>: true if the element was inserted.
+   //!
+   //! <b>Complexity</b>: Linear in the number of elements if the element is inserted, logarithmic otherwise.
+   bool insert(const value_type &x)
+   {
+      scoped_lock lock(m_write_mutex);
+      const map_type &cur = this->priv_current()->m_map;
+      if(cur.count(x.first))
+         return false;
+      map_type m(cur);
+      m.insert(x);
+      this->priv_publish(boost::move(m));
+      return true;
+   }
+
+   //! <b>Effects</b>: Publishes a new version without the element whose key is equivalent to k, if any.
+   //!   Updates that change several elements should use update().
+   //!
+   //! <b>Returns</b>: The number of erased elements (0 or 1).
+   //!
+   //! <b>Complexity</b>: Linear in the number of elements if an element is erased, logarithmic otherwise.
+   size_type erase(const key_type &k)
+   {
+      scoped_lock lock(m_write_mutex);
+      const map_type &cur = this->priv_current()->m_map;
+      if(!cur.count(k))
+         return 0u;
+      map_type m(cur);
+      m.erase(k);
+      this->priv_publish(boost::move(m));
+      return 1u;
+   }
+
+   //! <b>Effects</b>: Publishes an empty version.
+   //!
+   //! <b>Complexity</b>: Constant plus the destruction of the previous version if no
+   //!   snapshot holds it. Waits for the readers of the previous version and for other writers.
+   void clear()
+   {
+      scoped_lock lock(m_write_mutex);
+      const map_type &cur = this->priv_current()->m_map;
+      this->priv_publish(map_type(cur.key_comp(), cur.get_allocator()));
+   }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   typedef container_detail::concurrent_flat_map_version<map_type>        version_t;
+
+   version_t *priv_current() const
+   {  return static_cast<version_t*>(container_detail::atomic_load_ptr(&mp_current));  }
+
+   slot_type &priv_slot(size_type i) const
+   {  return container_detail::to_raw_pointer(m_slots)[i];  }
+
+   //Threads run on different stacks, so the address of a local variable
+   //spreads them between the slots without thread-specific storage
+   slot_type &priv_reader_slot() const
+   {
+      const char c = 0;
+      const std::size_t h = container_detail::fibonacci_hash<>::mix(std::size_t(&c) >> 12u);
+      return this->priv_slot(size_type(h >> (m_slot_shift - 1u) >> 1u));
+   }
+
+   //Precondition: the write lock is held
+   void priv_publish(BOOST_RV_REF(map_type) m)
+   {
+      version_t *const v = version_t::create(boost::move(m));
+      version_t *const old = static_cast<version_t*>
+         (container_detail::atomic_exchange_ptr(&mp_current, v));
+      this->priv_synchronize();
+      old->release();
+   }
+
+   //Waits until every reader that could have loaded the previous version has left.
+   //A reader counts itself in the parity of the epoch before loading the version, so
+   //after both parities have drained once no reader can hold the old pointer. The
+   //epoch is flipped before waiting so that new readers use the other counter and the
+   //writer is not starved.
+   void priv_synchronize()
+   {
+      for(unsigned phase = 0; phase != 2u; ++phase){
+         const std::size_t old_parity = container_detail::atomic_fetch_add(&m_epoch, 1u) & 1u;
+         for(size_type i = 0; i != m_slot_count; ++i){
+            const volatile std::size_t &readers = this->priv_slot(i).m_readers[old_parity];
+            while(container_detail::atomic_load(&readers) != 0u){
+               container_detail::thread_yield();
+            }
+         }
+      }
+   }
+
+   void priv_init(BOOST_RV_REF(map_type) m, size_type slot_count)
+   {
+      slot_count = slot_count ? container_detail::upper_power_of_2(slot_count) : size_type(1u);
+      slot_allocator_type a(m_alloc);
+      m_slots = slot_allocator_traits::allocate(a, slot_count);
+      slot_type *const raw_slots = container_detail::to_raw_pointer(m_slots);
+      for(size_type i = 0; i != slot_count; ++i){
+         slot_allocator_traits::construct(a, raw_slots + i);
+      }
+      m_slot_count = slot_count;
+      m_slot_shift = size_type(sizeof(std::size_t)*CHAR_BIT - container_detail::floor_log2(slot_count));
+      BOOST_TRY{
+         mp_current = version_t::create(boost::move(m));
+      }
+      BOOST_CATCH(...){
+         this->priv_destroy_slots();
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+   }
+
+   void priv_destroy_slots()
+   {
+      //Slots are trivially destructible
+      slot_allocator_type a(m_alloc);
+      slot_allocator_traits::deallocate(a, m_slots, m_slot_count);
+   }
+
+   volatile std::size_t m_epoch;
+   void * volatile      mp_current;
+   allocator_type       m_alloc;
+   slot_pointer         m_slots;
+   size_type            m_slot_count;
+   size_type            m_slot_shift;
+   mutex_type           m_write_mutex;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_CONCURRENT_FLAT_MAP_HPP
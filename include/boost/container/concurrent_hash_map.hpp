@@ -0,0 +1,660 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_CONCURRENT_HASH_MAP_HPP
+#define BOOST_CONTAINER_CONCURRENT_HASH_MAP_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/flat_hash_map.hpp>
+#include <boost/container/new_allocator.hpp> //new_allocator
+// container/detail
+#include <boost/container/detail/destroyers.hpp>
+#include <boost/container/detail/math_functions.hpp>
+#include <boost/container/detail/mutex.hpp>
+#include <boost/container/detail/to_raw_pointer.hpp>
+#include <boost/container/detail/type_traits.hpp>
+// move
+#include <boost/move/utility_core.hpp>
+// move/detail
+#if defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+#include <boost/move/detail/fwd_macros.hpp>
+#endif
+// intrusive/detail
+#include <boost/intrusive/detail/minimal_pair_header.hpp>      //pair
+#include <boost/intrusive/detail/minimal_less_equal_header.hpp>//less, equal
+// other
+#include <boost/core/no_exceptions_support.hpp>
+#include <boost/functional/hash.hpp>
+// std
+#include <climits>   //CHAR_BIT
+
+namespace boost {
+namespace container {
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace container_detail {
+
+//Assumed size of a cache line, used to keep the locks of different shards apart
+static const std::size_t concurrent_hash_map_cache_line_size = 64u;
+
+template<class Map, class Mutex>
+struct concurrent_hash_map_shard
+{
+   typedef typename Map::hasher           hasher;
+   typedef typename Map::key_equal        key_equal;
+   typedef typename Map::allocator_type   allocator_type;
+
+   concurrent_hash_map_shard(const hasher &hf, const key_equal &eql, const allocator_type &a)
+      : m_mutex(), m_map(0u, hf, eql, a)
+   {}
+
+   //Keeps the mutex and the table header of this shard off the cache line
+   //of the previous shard so that threads locking neighbour shards don't
+   //invalidate each other's cache lines
+   char  m_padding[concurrent_hash_map_cache_line_size];
+   Mutex m_mutex;
+   Map   m_map;
+
+   private:
+   concurrent_hash_map_shard(const concurrent_hash_map_shard &);
+   concurrent_hash_map_shard &operator=(const concurrent_hash_map_shard &);
+};
+
+//void selects the lock used by the node pools of this library
+template<class Mutex>
+struct concurrent_hash_map_mutex
+{
+   typedef Mutex type;
+};
+
+template<>
+struct concurrent_hash_map_mutex<void>
+{
+   typedef default_mutex type;
+};
+
+}  //namespace container_detail {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! A concurrent_hash_map is a hash map that can be accessed and modified by several
+//! threads at the same time without external synchronization.
+//!
+//! Keys are distributed between a power of two number of shards using the high bits of
+//! their hash value. Each shard is a flat_hash_map protected by its own lock, so
+//! threads working on keys of different shards don't contend. The lock type is selected
+//! with the Mutex parameter: by default it's a spin lock or the platform mutex, the same
+//! lock selected by the node pools of this library.
+//!
+//! As references to elements could be invalidated at any time by other threads, the interface
+//! does not provide iterators. Elements are accessed through visitation: a function object
+//! is invoked on the element while the lock of its shard is held. Visitation functions must not
+//! access the container and should be short, as they block other threads using the same shard.
+//! Modifying the key of a visited element is undefined behavior.
+//!
+//! The allocator is shared between all shards and must support concurrent allocations.
+//!
+//! \tparam Key is the key_type of the map
+//! \tparam T is the <code>mapped_type</code>
+//! \tparam Hash is the hash function used to compute the hash value of keys
+//! \tparam Pred is the equality predicate used to compare keys
+//! \tparam Allocator is the allocator to allocate the <code>value_type</code>s
+//!   (e.g. <i>allocator< std::pair<Key, T> > </i>).
+//! \tparam Mutex is the lock of each shard: a default constructible type with
+//!   <code>lock()</code> and <code>unlock()</code> members (e.g. <code>std::mutex</code>
+//!   or a spin lock). <code>void</code> selects the default lock.
+#ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
+template < class Key, class T, class Hash = boost::hash<Key>, class Pred = std::equal_to<Key>
+         , class Allocator = new_allocator< std::pair< Key, T> >, class Mutex = void >
+#else
+template <class Key, class T, class Hash, class Pred, class Allocator, class Mutex>
+#endif
+class concurrent_hash_map
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   typedef flat_hash_map<Key, T, Hash, Pred, Allocator>                          map_type;
+   typedef typename container_detail::concurrent_hash_map_mutex<Mutex>::type    mutex_type;
+   typedef container_detail::scoped_lock<mutex_type>                            scoped_lock;
+   typedef container_detail::concurrent_hash_map_shard<map_type, mutex_type>    shard_type;
+   typedef typename allocator_traits<Allocator>::template
+      portable_rebind_alloc<shard_type>::type                                    shard_allocator_type;
+   typedef allocator_traits<shard_allocator_type>                               shard_allocator_traits;
+   typedef typename shard_allocator_traits::pointer                             shard_pointer;
+
+   //Non-copyable and non-movable as the shard locks
+   concurrent_hash_map(const concurrent_hash_map &);
+   concurrent_hash_map &operator=(const concurrent_hash_map &);
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //                    types
+   //
+   //////////////////////////////////////////////
+
+   typedef Key                                                                      key_type;
+   typedef T                                                                        mapped_type;
+   typedef std::pair<Key, T>                                                        value_type;
+   typedef Hash                                                                     hasher;
+   typedef Pred                                                                     key_equal;
+   typedef Allocator                                                                allocator_type;
+   typedef typename boost::container::allocator_traits<Allocator>::size_type        size_type;
+   typedef typename BOOST_CONTAINER_IMPDEF(map_type::movable_value_type)            movable_value_type;
+
+   //! The number of shards used by default.
+   static const size_type default_shard_count = 64u;
+
+   //////////////////////////////////////////////
+   //
+   //          construct/destroy
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Constructs an empty concurrent_hash_map with at least shard_count shards
+   //!   (rounded up to a power of two) using the specified hash function, equality predicate
+   //!   and allocator.
+   //!
+   //! <b>Complexity</b>: Linear in shard_count.
+   explicit concurrent_hash_map( size_type shard_count = default_shard_count
+                               , const hasher &hf = hasher()
+                               , const key_equal &eql = key_equal()
+                               , const allocator_type &a = allocator_type())
+      : m_hasher(hf), m_alloc(a), m_shards(), m_shard_count(0u), m_shard_shift(0u)
+   {  this->priv_create_shards(shard_count, eql);  }
+
+   //! <b>Effects</b>: Constructs an empty concurrent_hash_map with the default number of shards
+   //!   using the specified allocator.
+   //!
+   //! <b>Complexity</b>: Linear in the default number of shards.
+   explicit concurrent_hash_map(const allocator_type &a)
+      : m_hasher(), m_alloc(a), m_shards(), m_shard_count(0u), m_shard_shift(0u)
+   {  this->priv_create_shards(default_shard_count, key_equal());  }
+
+   //! <b>Effects</b>: Destroys the concurrent_hash_map. All stored values are destroyed
+   //!   and used memory is deallocated. No other thread can access the container.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements.
+   ~concurrent_hash_map()
+   {  this->priv_destroy_shards(m_shard_count);  }
+
+   //////////////////////////////////////////////
+   //
+   //                observers
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns a copy of the allocator that was passed to the object's constructor.
+   //!
+   //! <b>Complexity</b>: Constant.
+   allocator_type get_allocator() const
+   {  return m_alloc;  }
+
+   //! <b>Effects</b>: Returns the hash function object.
+   //!
+   //! <b>Complexity</b>: Constant.
+   hasher hash_function() const
+   {  return m_hasher;  }
+
+   //! <b>Effects</b>: Returns the key equality predicate.
+   //!
+   //! <b>Complexity</b>: Constant.
+   key_equal key_eq() const
+   {  return container_detail::to_raw_pointer(m_shards)->m_map.key_eq();  }
+
+   //! <b>Effects</b>: Returns the number of shards.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type shard_count() const
+   {  return m_shard_count;  }
+
+   //////////////////////////////////////////////
+   //
+   //                capacity
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns the number of elements. If other threads are modifying
+   //!   the container the result is only a snapshot as shards are counted one by one.
+   //!
+   //! <b>Complexity</b>: Linear in the number of shards.
+   size_type size() const
+   {
+      size_type n = 0u;
+      for(size_type i = 0; i != m_shard_count; ++i){
+         shard_type &s = this->priv_shard(i);
+         scoped_lock lock(s.m_mutex);
+         n += s.m_map.size();
+      }
+      return n;
+   }
+
+   //! <b>Effects</b>: Returns true if the container contains no elements.
+   //!   The same caveat as size() applies.
+   //!
+   //! <b>Complexity</b>: Linear in the number of shards.
+   bool empty() const
+   {
+      for(size_type i = 0; i != m_shard_count; ++i){
+         shard_type &s = this->priv_shard(i);
+         scoped_lock lock(s.m_mutex);
+         if(!s.m_map.empty())
+            return false;
+      }
+      return true;
+   }
+
+   //! <b>Effects</b>: Makes sure every shard can hold its share of n elements,
+   //!   assuming keys are evenly distributed, without rehashing.
+   //!
+   //! <b>Complexity</b>: Linear in the number of elements.
+   void reserve(size_type n)
+   {
+      const size_type per_shard = n / m_shard_count + size_type(n % m_shard_count != 0u);
+      for(size_type i = 0; i != m_shard_count; ++i){
+         shard_type &s = this->priv_shard(i);
+         scoped_lock lock(s.m_mutex);
+         s.m_map.reserve(per_shard);
+      }
+   }
+
+   //////////////////////////////////////////////
+   //
+   //                modifiers
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Inserts x if and only if there is no element with an equivalent key.
+   //!
+   //! <b>Returns</b>: true if the element was inserted.
+   //!
+   //! <b>Complexity</b>: Average constant, worst case linear in the size of the shard.
+   bool insert(const value_type &x)
+   {
+      shard_type &s = this->priv_shard_for(x.first);
+      scoped_lock lock(s.m_mutex);
+      return s.m_map.insert(x).second;
+   }
+
+   //! <b>Effects</b>: Move inserts x if and only if there is no element with an equivalent key.
+   //!
+   //! <b>Returns</b>: true if the element was inserted.
+   //!
+   //! <b>Complexity</b>: Average constant, worst case linear in the size of the shard.
+   bool insert(BOOST_RV_REF(value_type) x)
+   {
+      shard_type &s = this->priv_shard_for(x.first);
+      scoped_lock lock(s.m_mutex);
+      return s.m_map.insert(boost::move(x)).second;
+   }
+
+   //! <b>Effects</b>: Move inserts x if and only if there is no element with an equivalent key.
+   //!
+   //! <b>Returns</b>: true if the element was inserted.
+   //!
+   //! <b>Complexity</b>: Average constant, worst case linear in the size of the shard.
+   bool insert(BOOST_RV_REF(movable_value_type) x)
+   {
+      shard_type &s = this->priv_shard_for(x.first);
+      scoped_lock lock(s.m_mutex);
+      return s.m_map.insert(boost::move(x)).second;
+   }
+
+   #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   //! <b>Effects</b>: Inserts an object x of type value_type constructed with
+   //!   std::forward<Args>(args)... if and only if there is no element with an equivalent key.
+   //!   The object is constructed before the lock of its shard is acquired.
+   //!
+   //! <b>Returns</b>: true if the element was inserted.
+   //!
+   //! <b>Complexity</b>: Average constant, worst case linear in the size of the shard.
+   template <class... Args>
+   bool emplace(BOOST_FWD_REF(Args)... args)
+   {
+      typename container_detail::aligned_storage
+         <sizeof(movable_value_type), container_detail::alignment_of<movable_value_type>::value>::type v;
+      movable_value_type &val = *static_cast<movable_value_type *>(static_cast<void *>(&v));
+      value_allocator_type a(m_alloc);
+      value_allocator_traits::construct(a, &val, ::boost::forward<Args>(args)... );
+      container_detail::value_destructor<value_allocator_type> d(a, val);
+      return this->insert(::boost::move(val));
+   }
+
+   #else // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   #define BOOST_CONTAINER_CONCURRENT_HASH_MAP_EMPLACE_CODE(N) \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   bool emplace(BOOST_MOVE_UREF##N)\
+   {\
+      typename container_detail::aligned_storage\
+         <sizeof(movable_value_type), container_detail::alignment_of<movable_value_type>::value>::type v;\
+      movable_value_type &val = *static_cast<movable_value_type *>(static_cast<void *>(&v));\
+      value_allocator_type a(m_alloc);\
+      value_allocator_traits::construct(a, &val BOOST_MOVE_I##N BOOST_MOVE_FWD##N);\
+      container_detail::value_destructor<value_allocator_type> d(a, val);\
+      return this->insert(::boost::move(val));\
+   }\
+   //
+   BOOST_MOVE_ITERATE_0TO9(BOOST_CONTAINER_CONCURRENT_HASH_MAP_EMPLACE_CODE)
+   #undef BOOST_CONTAINER_CONCURRENT_HASH_MAP_EMPLACE_CODE
+
+   #endif   // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   //! <b>Effects</b>: Inserts x if there is no element with an equivalent key,
+   //!   otherwise invokes f with a reference to the existing element.
+   //!
+   //! <b>Returns</b>: true if the element was inserted.
+   //!
+   //! <b>Complexity</b>: Average constant, worst case linear in the size of the shard.
+   template<class F>
+   bool insert_or_visit(const value_type &x, F f)
+   {
+      shard_type &s = this->priv_shard_for(x.first);
+      scoped_lock lock(s.m_mutex);
+      const std::pair<typename map_type::iterator, bool> r = s.m_map.insert(x);
+      if(!r.second)
+         f(*r.first);
+      return r.second;
+   }
+
+   //! <b>Effects</b>: Move inserts x if there is no element with an equivalent key,
+   //!   otherwise invokes f with a reference to the existing element (x is not moved from).
+   //!
+   //! <b>Returns</b>: true if the element was inserted.
+   //!
+   //! <b>Complexity</b>: Average constant, worst case linear in the size of the shard.
+   template<class F>
+   bool insert_or_visit(BOOST_RV_REF(value_type) x, F f)
+   {
+      shard_type &s = this->priv_shard_for(x.first);
+      scoped_lock lock(s.m_mutex);
+      const std::pair<typename map_type::iterator, bool> r = s.m_map.insert(boost::move(x));
+      if(!r.second)
+         f(*r.first);
+      return r.second;
+   }
+
+   //! <b>Effects</b>: Move inserts x if there is no element with an equivalent key,
+   //!   otherwise invokes f with a reference to the existing element (x is not moved from).
+   //!
+   //! <b>Returns</b>: true if the element was inserted.
+   //!
+   //! <b>Complexity</b>: Average constant, worst case linear in the size of the shard.
+   template<class F>
+   bool insert_or_visit(BOOST_RV_REF(movable_value_type) x, F f)
+   {
+      shard_type &s = this->priv_shard_for(x.first);
+      scoped_lock lock(s.m_mutex);
+      const std::pair<typename map_type::iterator, bool> r = s.m_map.insert(boost::move(x));
+      if(!r.second)
+         f(*r.first);
+      return r.second;
+   }
+
+   //! <b>Effects</b>: Erases the element whose key is equivalent to k, if any.
+   //!
+   //! <b>Returns</b>: The number of erased elements (0 or 1).
+   //!
+   //! <b>Complexity</b>: Average constant, worst case linear in the size of the shard.
+   size_type erase(const key_type &k)
+   {
+      shard_type &s = this->priv_shard_for(k);
+      scoped_lock lock(s.m_mutex);
+      return s.m_map.erase(k);
+   }
+
+   //! <b>Effects</b>: Erases the element whose key is equivalent to k if f returns
+   //!   true when invoked with a reference to it.
+   //!
+   //! <b>Returns</b>: The number of erased elements (0 or 1).
+   //!
+   //! <b>Complexity</b>: Average constant, worst case linear in the size of the shard.
+   template<class F>
+   size_type erase_if(const key_type &k, F f)
+   {
+      shard_type &s = this->priv_shard_for(k);
+      scoped_lock lock(s.m_mutex);
+      const typename map_type::iterator it = s.m_map.find(k);
+      if(it != s.m_map.end() && f(*it)){
+         s.m_map.erase(it);
+         return 1u;
+      }
+      return 0u;
+   }
+
+   //! <b>Effects</b>: Erases all elements for which f returns true. Shards are
+   //!   locked one by one.
+   //!
+   //! <b>Returns</b>: The number of erased elements.
+   //!
+   //! <b>Complexity</b>: Linear in the number of elements.
+   template<class F>
+   size_type erase_if(F f)
+   {
+      size_type n = 0u;
+      for(size_type i = 0; i != m_shard_count; ++i){
+         shard_type &s = this->priv_shard(i);
+         scoped_lock lock(s.m_mutex);
+         for(typename map_type::iterator it = s.m_map.begin(), itend = s.m_map.end(); it != itend; ){
+            if(f(*it)){
+               it = s.m_map.erase(it);
+               ++n;
+            }
+            else{
+               ++it;
+            }
+         }
+      }
+      return n;
+   }
+
+   //! <b>Effects</b>: Erases all elements. Shards are cleared one by one.
+   //!
+   //! <b>Complexity</b>: Linear in the number of elements.
+   void clear()
+   {
+      for(size_type i = 0; i != m_shard_count; ++i){
+         shard_type &s = this->priv_shard(i);
+         scoped_lock lock(s.m_mutex);
+         s.m_map.clear();
+      }
+   }
+
+   //////////////////////////////////////////////
+   //
+   //                visitation
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Invokes f with a reference to the element whose key is equivalent
+   //!   to k, if any.
+   //!
+   //! <b>Returns</b>: The number of visited elements (0 or 1).
+   //!
+   //! <b>Complexity</b>: Average constant, worst case linear in the size of the shard.
+   template<class F>
+   size_type visit(const key_type &k, F f)
+   {
+      shard_type &s = this->priv_shard_for(k);
+      scoped_lock lock(s.m_mutex);
+      const typename map_type::iterator it = s.m_map.find(k);
+      if(it == s.m_map.end())
+         return 0u;
+      f(*it);
+      return 1u;
+   }
+
+   //! <b>Effects</b>: Invokes f with a const reference to the element whose key is equivalent
+   //!   to k, if any.
+   //!
+   //! <b>Returns</b>: The number of visited elements (0 or 1).
+   //!
+   //! <b>Complexity</b>: Average constant, worst case linear in the size of the shard.
+   template<class F>
+   size_type visit(const key_type &k, F f) const
+   {
+      shard_type &s = this->priv_shard_for(k);
+      scoped_lock lock(s.m_mutex);
+      const map_type &m = s.m_map;
+      const typename map_type::const_iterator it = m.find(k);
+      if(it == m.end())
+         return 0u;
+      f(*it);
+      return 1u;
+   }
+
+   //! <b>Effects</b>: Equivalent to static_cast<const concurrent_hash_map&>(*this).visit(k, f).
+   template<class F>
+   size_type cvisit(const key_type &k, F f) const
+   {  return this->visit(k, f);  }
+
+   //! <b>Effects</b>: Invokes f with a reference to each element. Shards are locked one by one,
+   //!   so elements inserted or erased by other threads during the call might be missed or visited.
+   //!
+   //! <b>Returns</b>: The number of visited elements.
+   //!
+   //! <b>Complexity</b>: Linear in the number of elements.
+   template<class F>
+   size_type visit_all(F f)
+   {
+      size_type n = 0u;
+      for(size_type i = 0; i != m_shard_count; ++i){
+         shard_type &s = this->priv_shard(i);
+         scoped_lock lock(s.m_mutex);
+         for(typename map_type::iterator it = s.m_map.begin(), itend = s.m_map.end(); it != itend; ++it, ++n){
+            f(*it);
+         }
+      }
+      return n;
+   }
+
+   //! <b>Effects</b>: Invokes f with a const reference to each element. The same caveats
+   //!   as the non-const version apply.
+   //!
+   //! <b>Returns</b>: The number of visited elements.
+   //!
+   //! <b>Complexity</b>: Linear in the number of elements.
+   template<class F>
+   size_type visit_all(F f) const
+   {
+      size_type n = 0u;
+      for(size_type i = 0; i != m_shard_count; ++i){
+         shard_type &s = this->priv_shard(i);
+         scoped_lock lock(s.m_mutex);
+         const map_type &m = s.m_map;
+         for(typename map_type::const_iterator it = m.begin(), itend = m.end(); it != itend; ++it, ++n){
+            f(*it);
+         }
+      }
+      return n;
+   }
+
+   //! <b>Effects</b>: Equivalent to static_cast<const concurrent_hash_map&>(*this).visit_all(f).
+   template<class F>
+   size_type cvisit_all(F f) const
+   {  return this->visit_all(f);  }
+
+   //////////////////////////////////////////////
+   //
+   //                lookup
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Returns</b>: The number of elements with key equivalent to k (0 or 1).
+   //!
+   //! <b>Complexity</b>: Average constant, worst case linear in the size of the shard.
+   size_type count(const key_type &k) const
+   {
+      shard_type &s = this->priv_shard_for(k);
+      scoped_lock lock(s.m_mutex);
+      return s.m_map.count(k);
+   }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   typedef typename allocator_traits<Allocator>::template
+      portable_rebind_alloc<movable_value_type>::type                           value_allocator_type;
+   typedef allocator_traits<value_allocator_type>                               value_allocator_traits;
+
+   shard_type &priv_shard(size_type i) const
+   {  return container_detail::to_raw_pointer(m_shards)[i];  }
+
+   //Shards are selected with the high bits of the mixed hash value while the
+   //flat_hash_map of each shard uses the low ones, so that keys of a shard don't
+   //cluster in its table
+   shard_type &priv_shard_for(const key_type &k) const
+   {
+      const std::size_t h = container_detail::fibonacci_hash<>::mix(m_hasher(k));
+      //Two shifts as m_shard_shift equals the number of bits of std::size_t if there is a single shard
+      return this->priv_shard(size_type((h >> (m_shard_shift - 1u)) >> 1u));
+   }
+
+   void priv_create_shards(size_type shard_count, const key_equal &eql)
+   {
+      shard_count = shard_count ? container_detail::upper_power_of_2(shard_count) : size_type(1u);
+      shard_allocator_type a(m_alloc);
+      m_shards = shard_allocator_traits::allocate(a, shard_count);
+      m_shard_shift = size_type(sizeof(std::size_t)*CHAR_BIT - container_detail::floor_log2(shard_count));
+      shard_type *const raw_shards = container_detail::to_raw_pointer(m_shards);
+      size_type i = 0;
+      BOOST_TRY{
+         for(; i != shard_count; ++i){
+            shard_allocator_traits::construct(a, raw_shards + i, m_hasher, eql, m_alloc);
+         }
+      }
+      BOOST_CATCH(...){
+         m_shard_count = shard_count;
+         this->priv_destroy_shards(i);
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      m_shard_count = shard_count;
+   }
+
+   void priv_destroy_shards(size_type constructed)
+   {
+      shard_allocator_type a(m_alloc);
+      shard_type *const raw_shards = container_detail::to_raw_pointer(m_shards);
+      for(size_type i = 0; i != constructed; ++i){
+         shard_allocator_traits::destroy(a, raw_shards + i);
+      }
+      shard_allocator_traits::deallocate(a, m_shards, m_shard_count);
+   }
+
+   hasher         m_hasher;
+   allocator_type m_alloc;
+   shard_pointer  m_shards;
+   size_type      m_shard_count;
+   size_type      m_shard_shift;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_CONCURRENT_HASH_MAP_HPP
@@ -24,6 +24,9 @@
 //!   - boost::container::vector
 //!   - boost::container::stable_vector
 //!   - boost::container::static_vector
+//!   - boost::container::devector
+//!   - boost::container::bit_vector
+//!   - boost::container::slot_map
 //!   - boost::container::slist
 //!   - boost::container::list
 //!   - boost::container::set
@@ -34,6 +37,17 @@
 //!   - boost::container::flat_multiset
 //!   - boost::container::flat_map
 //!   - boost::container::flat_multimap
+//!   - boost::container::soa_flat_map
+//!   - boost::container::hash_set
+//!   - boost::container::hash_multiset
+//!   - boost::container::hash_map
+//!   - boost::container::hash_multimap
+//!   - boost::container::flat_hash_set
+//!   - boost::container::flat_hash_map
+//!   - boost::container::concurrent_hash_map
+//!   - boost::container::concurrent_flat_map
+//!   - boost::container::frozen_hash_set
+//!   - boost::container::frozen_hash_map
 //!   - boost::container::basic_string
 //!   - boost::container::string
 //!   - boost::container::wstring
@@ -42,6 +56,7 @@
 //!   - boost::container::allocator
 //!   - boost::container::node_allocator
 //!   - boost::container::adaptive_pool
+//!   - boost::container::mmap_allocator
 //!
 //! And finally it defines the following types
 
@@ -61,6 +76,11 @@ namespace boost{ namespace container{ namespace container_detail{
    namespace bi = boost::intrusive;
 }}}
 
+namespace boost{
+   //Default hash function for hashed containers, see <boost/functional/hash_fwd.hpp>
+   template<class T> struct hash;
+}
+
 #include <cstddef>
 
 #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
@@ -79,7 +99,34 @@ enum tree_type_enum
    red_black_tree,
    avl_tree,
    scapegoat_tree,
-   splay_tree
+   splay_tree,
+   //! Values are stored in the nodes of a B-tree, several values per node.
+   //! Insertions and erasures invalidate iterators and references.
+   btree
+};
+
+//! Enumeration used to configure flat associative containers
+//! with the sequence that stores their elements.
+enum sequence_storage_enum
+{
+   vector_sequence,
+   small_vector_sequence,
+   static_vector_sequence,
+   deque_sequence
+};
+
+//! Flags that configure how mmap_allocator maps its blocks.
+//! They can be combined with a bitwise OR.
+enum mmap_allocator_flags
+{
+   //! Blocks are advised with MADV_HUGEPAGE so that the kernel
+   //! backs them with transparent huge pages.
+   mmap_huge_pages = 1u,
+   //! Committed memory is populated by the kernel (MADV_POPULATE_WRITE)
+   //! before it is returned, falling back to mmap_prefault if not supported.
+   mmap_populate   = 2u,
+   //! Committed memory is touched page by page before it is returned.
+   mmap_prefault   = 4u
 };
 
 #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
@@ -87,37 +134,66 @@ enum tree_type_enum
 template<class T>
 class new_allocator;
 
+template<class GrowthFactor>
+struct vector_opt;
+
+struct growth_factor_100;
+
+typedef vector_opt<growth_factor_100> vector_defaults;
+
 template <class T
-         ,class Allocator = new_allocator<T> >
+         ,class Allocator = new_allocator<T>
+         ,class Options = vector_defaults >
 class vector;
 
 template <class T
-         ,class Allocator = new_allocator<T> >
+         ,class Allocator = new_allocator<T>
+         ,class Options = vector_defaults >
 class stable_vector;
 
 template <class T, std::size_t Capacity>
 class static_vector;
 
 template < class T, std::size_t N
-         , class Allocator= new_allocator<T> >
+         , class Allocator= new_allocator<T>
+         , class Options = vector_defaults >
 class small_vector;
 
+template <class T
+         ,class Allocator = new_allocator<T>
+         ,class Options = vector_defaults >
+class devector;
+
+template <class Allocator = new_allocator<bool> >
+class bit_vector;
+
 template <class T
          ,class Allocator = new_allocator<T> >
-class deque;
+class slot_map;
 
 template <class T
          ,class Allocator = new_allocator<T> >
+class deque;
+
+template<std::size_t PrivateNodePool>
+struct list_opt;
+
+typedef list_opt<0u> list_defaults;
+
+template <class T
+         ,class Allocator = new_allocator<T>
+         ,class Options = list_defaults >
 class list;
 
 template <class T
-         ,class Allocator = new_allocator<T> >
+         ,class Allocator = new_allocator<T>
+         ,class Options = list_defaults >
 class slist;
 
-template<tree_type_enum TreeType, bool OptimizeSize>
+template<tree_type_enum TreeType, bool OptimizeSize, bool OrderStatistics, std::size_t PrivateNodePool>
 struct tree_opt;
 
-typedef tree_opt<red_black_tree, true> tree_assoc_defaults;
+typedef tree_opt<red_black_tree, true, false, 0u> tree_assoc_defaults;
 
 template <class Key
          ,class Compare  = std::less<Key>
@@ -145,31 +221,113 @@ template <class Key
          ,class Options = tree_assoc_defaults >
 class multimap;
 
+template<bool SearchIndex, sequence_storage_enum SequenceStorage, std::size_t SequenceCapacity>
+struct flat_tree_opt;
+
+typedef flat_tree_opt<false, vector_sequence, 0u> flat_assoc_defaults;
+
 template <class Key
          ,class Compare  = std::less<Key>
-         ,class Allocator = new_allocator<Key> >
+         ,class Allocator = new_allocator<Key>
+         ,class Options = flat_assoc_defaults >
 class flat_set;
 
 template <class Key
          ,class Compare  = std::less<Key>
-         ,class Allocator = new_allocator<Key> >
+         ,class Allocator = new_allocator<Key>
+         ,class Options = flat_assoc_defaults >
 class flat_multiset;
 
 template <class Key
          ,class T
          ,class Compare  = std::less<Key>
-         ,class Allocator = new_allocator<std::pair<Key, T> > >
+         ,class Allocator = new_allocator<std::pair<Key, T> >
+         ,class Options = flat_assoc_defaults >
 class flat_map;
 
 template <class Key
          ,class T
          ,class Compare  = std::less<Key>
-         ,class Allocator = new_allocator<std::pair<Key, T> > >
+         ,class Allocator = new_allocator<std::pair<Key, T> >
+         ,class Options = flat_assoc_defaults >
 class flat_multimap;
 
+template <class Key
+         ,class T
+         ,class Compare  = std::less<Key>
+         ,class Allocator = new_allocator<std::pair<Key, T> > >
+class soa_flat_map;
+
+template <class Key
+         ,class T
+         ,class Compare  = std::less<Key>
+         ,class Allocator = new_allocator<std::pair<Key, T> > >
+class concurrent_flat_map;
+
+template <class Key
+         ,class Hash = boost::hash<Key>
+         ,class Pred = std::equal_to<Key>
+         ,class Allocator = new_allocator<Key> >
+class hash_set;
+
+template <class Key
+         ,class Hash = boost::hash<Key>
+         ,class Pred = std::equal_to<Key>
+         ,class Allocator = new_allocator<Key> >
+class hash_multiset;
+
+template <class Key
+         ,class T
+         ,class Hash = boost::hash<Key>
+         ,class Pred = std::equal_to<Key>
+         ,class Allocator = new_allocator<std::pair<const Key, T> > >
+class hash_map;
+
+template <class Key
+         ,class T
+         ,class Hash = boost::hash<Key>
+         ,class Pred = std::equal_to<Key>
+         ,class Allocator = new_allocator<std::pair<const Key, T> > >
+class hash_multimap;
+
+template <class Key
+         ,class Hash = boost::hash<Key>
+         ,class Pred = std::equal_to<Key>
+         ,class Allocator = new_allocator<Key> >
+class flat_hash_set;
+
+template <class Key
+         ,class T
+         ,class Hash = boost::hash<Key>
+         ,class Pred = std::equal_to<Key>
+         ,class Allocator = new_allocator<std::pair<Key, T> > >
+class flat_hash_map;
+
+template <class Key
+         ,class T
+         ,class Hash = boost::hash<Key>
+         ,class Pred = std::equal_to<Key>
+         ,class Allocator = new_allocator<std::pair<Key, T> >
+         ,class Mutex = void >
+class concurrent_hash_map;
+
+template <class Key
+         ,class Hash = boost::hash<Key>
+         ,class Pred = std::equal_to<Key>
+         ,class Allocator = new_allocator<Key> >
+class frozen_hash_set;
+
+template <class Key
+         ,class T
+         ,class Hash = boost::hash<Key>
+         ,class Pred = std::equal_to<Key>
+         ,class Allocator = new_allocator<std::pair<Key, T> > >
+class frozen_hash_map;
+
 template <class CharT
          ,class Traits = std::char_traits<CharT>
-         ,class Allocator  = new_allocator<CharT> >
+         ,class Allocator  = new_allocator<CharT>
+         ,class Options = vector_defaults >
 class basic_string;
 
 typedef basic_string
@@ -210,13 +368,37 @@ template
    , std::size_t Version = 2>
 class node_allocator;
 
+static const std::size_t MmapAlloc_reserve_factor = sizeof(void*) > 4u ? 16u : 1u;
+
+template
+   < class T
+   , unsigned int Flags = mmap_huge_pages
+   , std::size_t ReserveFactor = MmapAlloc_reserve_factor>
+class mmap_allocator;
+
 #else
 
 //! Default options for tree-based associative containers
 //!   - tree_type<red_black_tree>
 //!   - optimize_size<true>
+//!   - order_statistics<false>
+//!   - private_node_pool<0>
 typedef implementation_defined tree_assoc_defaults;
 
+//! Default options for list and slist
+//!   - private_node_pool<0>
+typedef implementation_defined list_defaults;
+
+//! Default options for vector, small_vector, stable_vector and basic_string
+//!   - growth_factor<growth_factor_100>
+typedef implementation_defined vector_defaults;
+
+//! Default options for flat associative containers
+//!   - search_index<false>
+//!   - sequence_storage<vector_sequence>
+//!   - sequence_capacity<0>
+typedef implementation_defined flat_assoc_defaults;
+
 #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
 
 //! Type used to tag that the input range is
@@ -23,6 +23,7 @@
 // container
 #include <boost/container/allocator_traits.hpp>
 #include <boost/container/container_fwd.hpp>
+#include <boost/container/is_trivially_relocatable.hpp>
 #include <boost/container/new_allocator.hpp> //new_allocator
 #include <boost/container/throw_exception.hpp>
 // container/detail
@@ -30,6 +31,7 @@
 #include <boost/container/detail/algorithm.hpp> //algo_equal(), algo_lexicographical_compare
 #include <boost/container/detail/alloc_helpers.hpp>
 #include <boost/container/detail/copy_move_algo.hpp>
+#include <boost/container/detail/hash.hpp>
 #include <boost/container/detail/iterator.hpp>
 #include <boost/container/detail/iterator_to_raw_pointer.hpp>
 #include <boost/container/detail/iterators.hpp>
@@ -1710,6 +1712,12 @@ class deque : protected deque_base<Allocator>
    friend bool operator!=(const deque& x, const deque& y)
    {  return !(x == y); }
 
+   //! <b>Effects</b>: Returns the hash value of x. Equal containers have equal hash values.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend std::size_t hash_value(const deque& x)
+   {  return container_detail::hash_range(x.begin(), x.end());  }
+
    //! <b>Effects</b>: Returns true if x is less than y
    //!
    //! <b>Complexity</b>: Linear to the number of elements in the container.
@@ -2147,6 +2155,17 @@ class deque : protected deque_base<Allocator>
    #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
 };
 
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//!is_trivially_relocatable<> specialization: the deque only holds its allocator
+//!and pointers to the map and blocks, none of them to the deque itself
+template <class T, class Allocator>
+struct is_trivially_relocatable<deque<T, Allocator> >
+   : container_detail::is_trivially_relocatable_container<Allocator>
+{};
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
 }}
 
 #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
@@ -2167,6 +2186,22 @@ struct has_trivial_destructor_after_move<boost::container::deque<T, Allocator> >
 
 #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
 
+#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+namespace std {
+
+//!std::hash specialization, equivalent to boost::hash
+template <class T, class Allocator>
+struct hash< ::boost::container::deque<T, Allocator> >
+{
+   std::size_t operator()(const ::boost::container::deque<T, Allocator> &x) const
+   {  return ::boost::hash< ::boost::container::deque<T, Allocator> >()(x);  }
+};
+
+}  //namespace std {
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
 #include <boost/container/detail/config_end.hpp>
 
 #endif //   #ifndef  BOOST_CONTAINER_DEQUE_HPP
@@ -25,6 +25,7 @@
 // container
 #include <boost/container/allocator_traits.hpp>
 // container/detail
+#include <boost/container/detail/addressof.hpp>
 #include <boost/container/detail/copy_move_algo.hpp>
 #include <boost/container/detail/destroyers.hpp>
 #include <boost/container/detail/mpl.hpp>
@@ -208,6 +209,35 @@ insert_copy_proxy<Allocator, It> get_insert_value_proxy(const typename boost::co
    return insert_copy_proxy<Allocator, It>(v);
 }
 
+//Tells if the value built by the proxy might be read from [first, last), so that
+//the elements of that range can't be relocated before building it. Only a single
+//copied or moved value can be checked, any other proxy conservatively returns true.
+template<class InsertionProxy, class T>
+inline bool insert_proxy_may_alias(const InsertionProxy &, const T *, const T *)
+{  return true;  }
+
+template<class Allocator, class Iterator, class T>
+inline bool insert_proxy_may_alias(const insert_copy_proxy<Allocator, Iterator> &proxy, const T *first, const T *last)
+{
+   const T *const pv = container_detail::addressof(proxy.v_);
+   return first <= pv && pv < last;
+}
+
+template<class Allocator, class Iterator, class T>
+inline bool insert_proxy_may_alias(const insert_move_proxy<Allocator, Iterator> &proxy, const T *first, const T *last)
+{
+   const T *const pv = container_detail::addressof(proxy.v_);
+   return first <= pv && pv < last;
+}
+
+template<class Allocator, class Iterator, class T>
+inline bool insert_proxy_may_alias(const insert_value_initialized_n_proxy<Allocator, Iterator> &, const T *, const T *)
+{  return false;  }
+
+template<class Allocator, class Iterator, class T>
+inline bool insert_proxy_may_alias(const insert_default_initialized_n_proxy<Allocator, Iterator> &, const T *, const T *)
+{  return false;  }
+
 }}}   //namespace boost { namespace container { namespace container_detail {
 
 #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
@@ -23,12 +23,23 @@
 
 #include <boost/intrusive/detail/algorithm.hpp>
 
+#include <cstddef>
+
 namespace boost {
 namespace container {
 
 using boost::intrusive::algo_equal;
 using boost::intrusive::algo_lexicographical_compare;
 
+namespace container_detail {
+
+//Number of lookups interleaved by find_batch: enough independent cache
+//misses in flight to hide memory latency while the state of every
+//search still fits in a few cache lines.
+static const std::size_t find_batch_size = 16u;
+
+}  //namespace container_detail {
+
 }  //namespace container {
 }  //namespace boost {
 
@@ -0,0 +1,209 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_DETAIL_ATOMIC_HPP
+#define BOOST_CONTAINER_DETAIL_ATOMIC_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+#include <cstddef>
+
+// Minimal sequentially consistent atomic operations on std::size_t and pointers,
+// selected like the locks of mutex.hpp
+
+#define BOOST_CONTAINER_ATOMIC_HELPER_NONE      0
+#define BOOST_CONTAINER_ATOMIC_HELPER_GCC       1
+#define BOOST_CONTAINER_ATOMIC_HELPER_GCC_SYNC  2
+#define BOOST_CONTAINER_ATOMIC_HELPER_MSVC      3
+
+#if !defined(BOOST_HAS_THREADS) && !defined(BOOST_NO_MT)
+# define BOOST_NO_MT
+#endif
+
+#if defined(BOOST_NO_MT) || defined(BOOST_CONTAINER_NO_MT)
+   // No multithreading -> plain loads and stores
+   #define BOOST_CONTAINER_ATOMIC_HELPER BOOST_CONTAINER_ATOMIC_HELPER_NONE
+#elif defined(__ATOMIC_SEQ_CST) && (defined(__GNUC__) || defined(__clang__))
+   #define BOOST_CONTAINER_ATOMIC_HELPER BOOST_CONTAINER_ATOMIC_HELPER_GCC
+#elif defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1))
+   #define BOOST_CONTAINER_ATOMIC_HELPER BOOST_CONTAINER_ATOMIC_HELPER_GCC_SYNC
+#elif defined(_MSC_VER) && _MSC_VER >= 1400
+   #define BOOST_CONTAINER_ATOMIC_HELPER BOOST_CONTAINER_ATOMIC_HELPER_MSVC
+#endif
+
+#ifndef BOOST_CONTAINER_ATOMIC_HELPER
+  #error Unable to determine platform atomic operations; #define BOOST_NO_MT to assume single-threaded
+#endif
+
+#if BOOST_CONTAINER_ATOMIC_HELPER == BOOST_CONTAINER_ATOMIC_HELPER_MSVC
+   #include <intrin.h>
+   #include <windows.h>
+#elif BOOST_CONTAINER_ATOMIC_HELPER != BOOST_CONTAINER_ATOMIC_HELPER_NONE
+   #if defined(BOOST_WINDOWS)
+      #include <windows.h>
+   #else
+      #include <sched.h>
+   #endif
+#endif
+
+namespace boost {
+namespace container {
+namespace container_detail {
+
+#if BOOST_CONTAINER_ATOMIC_HELPER == BOOST_CONTAINER_ATOMIC_HELPER_NONE
+
+inline std::size_t atomic_load(const volatile std::size_t *p)
+{  return *p;  }
+
+inline void atomic_store(volatile std::size_t *p, std::size_t v)
+{  *p = v;  }
+
+inline std::size_t atomic_fetch_add(volatile std::size_t *p, std::size_t v)
+{  const std::size_t old = *p; *p = old + v; return old;  }
+
+inline std::size_t atomic_fetch_sub(volatile std::size_t *p, std::size_t v)
+{  const std::size_t old = *p; *p = old - v; return old;  }
+
+inline void *atomic_load_ptr(void * const volatile *p)
+{  return *p;  }
+
+inline void *atomic_exchange_ptr(void * volatile *p, void *v)
+{  void *const old = *p; *p = v; return old;  }
+
+inline void thread_yield()
+{}
+
+#elif BOOST_CONTAINER_ATOMIC_HELPER == BOOST_CONTAINER_ATOMIC_HELPER_GCC
+
+inline std::size_t atomic_load(const volatile std::size_t *p)
+{  return __atomic_load_n(p, __ATOMIC_SEQ_CST);  }
+
+inline void atomic_store(volatile std::size_t *p, std::size_t v)
+{  __atomic_store_n(p, v, __ATOMIC_SEQ_CST);  }
+
+inline std::size_t atomic_fetch_add(volatile std::size_t *p, std::size_t v)
+{  return __atomic_fetch_add(p, v, __ATOMIC_SEQ_CST);  }
+
+inline std::size_t atomic_fetch_sub(volatile std::size_t *p, std::size_t v)
+{  return __atomic_fetch_sub(p, v, __ATOMIC_SEQ_CST);  }
+
+inline void *atomic_load_ptr(void * const volatile *p)
+{  return __atomic_load_n(p, __ATOMIC_SEQ_CST);  }
+
+inline void *atomic_exchange_ptr(void * volatile *p, void *v)
+{  return __atomic_exchange_n(p, v, __ATOMIC_SEQ_CST);  }
+
+#elif BOOST_CONTAINER_ATOMIC_HELPER == BOOST_CONTAINER_ATOMIC_HELPER_GCC_SYNC
+
+//__sync builtins are full barriers, except __sync_lock_test_and_set (acquire only)
+
+inline std::size_t atomic_load(const volatile std::size_t *p)
+{  return __sync_fetch_and_add(const_cast<volatile std::size_t*>(p), std::size_t(0));  }
+
+inline void atomic_store(volatile std::size_t *p, std::size_t v)
+{
+   __sync_synchronize();
+   *p = v;
+   __sync_synchronize();
+}
+
+inline std::size_t atomic_fetch_add(volatile std::size_t *p, std::size_t v)
+{  return __sync_fetch_and_add(p, v);  }
+
+inline std::size_t atomic_fetch_sub(volatile std::size_t *p, std::size_t v)
+{  return __sync_fetch_and_sub(p, v);  }
+
+inline void *atomic_load_ptr(void * const volatile *p)
+{
+   void *const v = *p;
+   __sync_synchronize();
+   return v;
+}
+
+inline void *atomic_exchange_ptr(void * volatile *p, void *v)
+{
+   __sync_synchronize();
+   return __sync_lock_test_and_set(p, v);
+}
+
+#elif BOOST_CONTAINER_ATOMIC_HELPER == BOOST_CONTAINER_ATOMIC_HELPER_MSVC
+
+#if defined(_WIN64)
+   #define BOOST_CONTAINER_INTERLOCKED_EXCHANGE_ADD(p, v) \
+      std::size_t(_InterlockedExchangeAdd64(reinterpret_cast<volatile __int64*>(p), __int64(v)))
+#else
+   #define BOOST_CONTAINER_INTERLOCKED_EXCHANGE_ADD(p, v) \
+      std::size_t(_InterlockedExchangeAdd(reinterpret_cast<volatile long*>(p), long(v)))
+#endif
+
+inline std::size_t atomic_fetch_add(volatile std::size_t *p, std::size_t v)
+{  return BOOST_CONTAINER_INTERLOCKED_EXCHANGE_ADD(p, v);  }
+
+inline std::size_t atomic_fetch_sub(volatile std::size_t *p, std::size_t v)
+{  return BOOST_CONTAINER_INTERLOCKED_EXCHANGE_ADD(p, std::size_t(0u) - v);  }
+
+inline std::size_t atomic_load(const volatile std::size_t *p)
+{  return BOOST_CONTAINER_INTERLOCKED_EXCHANGE_ADD(const_cast<volatile std::size_t*>(p), 0u);  }
+
+inline void atomic_store(volatile std::size_t *p, std::size_t v)
+{
+   #if defined(_WIN64)
+   _InterlockedExchange64(reinterpret_cast<volatile __int64*>(p), __int64(v));
+   #else
+   _InterlockedExchange(reinterpret_cast<volatile long*>(p), long(v));
+   #endif
+}
+
+#undef BOOST_CONTAINER_INTERLOCKED_EXCHANGE_ADD
+
+inline void *atomic_load_ptr(void * const volatile *p)
+{  return _InterlockedCompareExchangePointer(const_cast<void * volatile *>(p), 0, 0);  }
+
+inline void *atomic_exchange_ptr(void * volatile *p, void *v)
+{  return _InterlockedExchangePointer(p, v);  }
+
+#endif
+
+#if BOOST_CONTAINER_ATOMIC_HELPER != BOOST_CONTAINER_ATOMIC_HELPER_NONE
+
+//Gives the processor to other threads while spin waiting
+inline void thread_yield()
+{
+   #if defined(BOOST_WINDOWS)
+   SwitchToThread();
+   #else
+   sched_yield();
+   #endif
+}
+
+#endif
+
+} // namespace container_detail
+} // namespace container
+} // namespace boost
+
+#undef BOOST_CONTAINER_ATOMIC_HELPER_NONE
+#undef BOOST_CONTAINER_ATOMIC_HELPER_GCC
+#undef BOOST_CONTAINER_ATOMIC_HELPER_GCC_SYNC
+#undef BOOST_CONTAINER_ATOMIC_HELPER_MSVC
+#undef BOOST_CONTAINER_ATOMIC_HELPER
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_DETAIL_ATOMIC_HPP
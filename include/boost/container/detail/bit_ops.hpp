@@ -0,0 +1,180 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_DETAIL_BIT_OPS_HPP
+#define BOOST_CONTAINER_DETAIL_BIT_OPS_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <climits>
+#include <cstddef>
+
+//Bulk operations over arrays of blocks process 32 bytes at a time with AVX2
+//when the compiler targets it (e.g. -mavx2 or /arch:AVX2). Define
+//BOOST_CONTAINER_BIT_OPS_NO_SIMD to force the portable implementation.
+#if !defined(BOOST_CONTAINER_BIT_OPS_NO_SIMD) && defined(__AVX2__)
+#  define BOOST_CONTAINER_BIT_OPS_AVX2
+#  include <immintrin.h>
+#endif
+
+#if defined(BOOST_MSVC)
+#  include <intrin.h>
+#endif
+
+namespace boost {
+namespace container {
+namespace container_detail {
+
+//Number of bits set in x
+inline std::size_t bit_popcount(std::size_t x)
+{
+   #if defined(__GNUC__)
+   return std::size_t(__builtin_popcountll(static_cast<unsigned long long>(x)));
+   #elif defined(BOOST_MSVC) && defined(BOOST_CONTAINER_BIT_OPS_AVX2) && defined(_WIN64)
+   //CPUs with AVX2 support the popcnt instruction
+   return std::size_t(__popcnt64(x));
+   #else
+   //Sum the bits in pairs, nibbles and bytes, then add the bytes with a multiplication
+   const std::size_t m1  = std::size_t(-1)/3u;     //0x5555...
+   const std::size_t m2  = std::size_t(-1)/5u;     //0x3333...
+   const std::size_t m4  = std::size_t(-1)/17u;    //0x0f0f...
+   const std::size_t h01 = std::size_t(-1)/255u;   //0x0101...
+   x = x - ((x >> 1u) & m1);
+   x = (x & m2) + ((x >> 2u) & m2);
+   x = (x + (x >> 4u)) & m4;
+   return (x * h01) >> (sizeof(std::size_t) - 1u)*CHAR_BIT;
+   #endif
+}
+
+//Position of the lowest bit set in x
+inline std::size_t bit_ctz(std::size_t x)
+{
+   BOOST_ASSERT(x != 0);
+   #if defined(__GNUC__)
+   return std::size_t(__builtin_ctzll(static_cast<unsigned long long>(x)));
+   #elif defined(BOOST_MSVC) && defined(_WIN64)
+   unsigned long r;
+   _BitScanForward64(&r, x);
+   return std::size_t(r);
+   #elif defined(BOOST_MSVC)
+   unsigned long r;
+   _BitScanForward(&r, x);
+   return std::size_t(r);
+   #else
+   std::size_t n = 0;
+   while(!(x & 1u)){
+      x >>= 1u;
+      ++n;
+   }
+   return n;
+   #endif
+}
+
+//Number of bits set in the n blocks starting at p
+inline std::size_t bit_count_blocks(const std::size_t *p, std::size_t n)
+{
+   std::size_t count = 0u;
+   #if defined(BOOST_CONTAINER_BIT_OPS_AVX2)
+   //Each byte is split in two nibbles whose bit counts are looked up with a shuffle
+   //(Mula, Kurz and Lemire) and the bytes are added in 64 bit lanes with psadbw.
+   const std::size_t blocks_per_step = 32u/sizeof(std::size_t);
+   if(n >= blocks_per_step){
+      const __m256i lookup = _mm256_setr_epi8
+         ( 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4
+         , 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+      const __m256i low_mask = _mm256_set1_epi8(0x0f);
+      const __m256i zero = _mm256_setzero_si256();
+      __m256i acc = zero;
+      for(; n >= blocks_per_step; n -= blocks_per_step, p += blocks_per_step){
+         const __m256i v  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+         const __m256i lo = _mm256_and_si256(v, low_mask);
+         const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+         const __m256i c  = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo), _mm256_shuffle_epi8(lookup, hi));
+         acc = _mm256_add_epi64(acc, _mm256_sad_epu8(c, zero));
+      }
+      boost::uint64_t lanes[4];
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+      count = std::size_t(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+   }
+   #endif
+   for(const std::size_t *const e = p + n; p != e; ++p){
+      count += bit_popcount(*p);
+   }
+   return count;
+}
+
+struct bit_and_op
+{
+   static std::size_t apply(std::size_t a, std::size_t b)
+   {  return a & b;  }
+
+   #if defined(BOOST_CONTAINER_BIT_OPS_AVX2)
+   static __m256i apply(__m256i a, __m256i b)
+   {  return _mm256_and_si256(a, b);  }
+   #endif
+};
+
+struct bit_or_op
+{
+   static std::size_t apply(std::size_t a, std::size_t b)
+   {  return a | b;  }
+
+   #if defined(BOOST_CONTAINER_BIT_OPS_AVX2)
+   static __m256i apply(__m256i a, __m256i b)
+   {  return _mm256_or_si256(a, b);  }
+   #endif
+};
+
+struct bit_xor_op
+{
+   static std::size_t apply(std::size_t a, std::size_t b)
+   {  return a ^ b;  }
+
+   #if defined(BOOST_CONTAINER_BIT_OPS_AVX2)
+   static __m256i apply(__m256i a, __m256i b)
+   {  return _mm256_xor_si256(a, b);  }
+   #endif
+};
+
+//dst[i] = Op::apply(dst[i], src[i]) for the n blocks starting at dst and src
+template<class Op>
+void bit_transform_blocks(std::size_t *dst, const std::size_t *src, std::size_t n)
+{
+   #if defined(BOOST_CONTAINER_BIT_OPS_AVX2)
+   const std::size_t blocks_per_step = 32u/sizeof(std::size_t);
+   for(; n >= blocks_per_step; n -= blocks_per_step, dst += blocks_per_step, src += blocks_per_step){
+      __m256i *const d = reinterpret_cast<__m256i*>(dst);
+      _mm256_storeu_si256(d, Op::apply( _mm256_loadu_si256(d)
+                                      , _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src))));
+   }
+   #endif
+   for(const std::size_t *const e = src + n; src != e; ++dst, ++src){
+      *dst = Op::apply(*dst, *src);
+   }
+}
+
+}  //namespace container_detail {
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //#ifndef BOOST_CONTAINER_DETAIL_BIT_OPS_HPP
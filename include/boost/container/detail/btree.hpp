@@ -0,0 +1,1944 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_BTREE_HPP
+#define BOOST_CONTAINER_BTREE_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/options.hpp>
+// container/detail
+#include <boost/container/detail/algorithm.hpp> //algo_equal(), algo_lexicographical_compare, find_batch_size
+#include <boost/container/detail/addressof.hpp>
+#include <boost/container/detail/alloc_helpers.hpp>
+#include <boost/container/detail/allocator_version_traits.hpp>
+#include <boost/container/detail/destroyers.hpp>
+#include <boost/container/detail/hash.hpp>
+#include <boost/container/detail/iterator.hpp>
+#include <boost/container/detail/iterators.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/pair.hpp>
+#include <boost/container/detail/placement_new.hpp>
+#include <boost/container/detail/to_raw_pointer.hpp>
+#include <boost/container/detail/tree.hpp>
+#include <boost/container/detail/type_traits.hpp>
+// intrusive
+#include <boost/intrusive/pointer_traits.hpp>
+// intrusive/detail
+#include <boost/intrusive/detail/minimal_pair_header.hpp>   //pair
+// move
+#include <boost/move/utility_core.hpp>
+#include <boost/move/adl_move_swap.hpp>
+#if defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+#include <boost/move/detail/fwd_macros.hpp>
+#endif
+// other
+#include <boost/core/no_exceptions_support.hpp>
+#include <boost/assert.hpp>
+
+namespace boost {
+namespace container {
+namespace container_detail {
+
+//A B-tree stores up to btree_node_capacity values in each node. Leaves only
+//hold values while internal nodes also hold one child pointer more than values.
+//The capacity is chosen so that the values of a node fill about 256 bytes
+//(four cache lines), clamped to [16, 64] values.
+template<class T>
+struct btree_node_capacity
+{
+   static const std::size_t target = 256u/sizeof(T);
+   static const std::size_t value = target < 16u ? 16u : target > 64u ? 64u : target;
+};
+
+template<class InternalType, class VoidPointer, std::size_t N>
+struct btree_internal_node;
+
+template<class InternalType, class VoidPointer, std::size_t N>
+struct btree_node
+{
+   typedef typename boost::intrusive::pointer_traits<VoidPointer>::template
+      rebind_pointer<btree_node>::type                                   node_ptr;
+   typedef typename boost::intrusive::pointer_traits<VoidPointer>::template
+      rebind_pointer<btree_internal_node<InternalType, VoidPointer, N> >::type
+                                                                         internal_node_ptr;
+
+   node_ptr       m_parent;
+   //Index of this node in the children of m_parent
+   unsigned char  m_position;
+   unsigned char  m_count;
+   bool           m_leaf;
+   typename aligned_storage
+      <sizeof(InternalType)*N, alignment_of<InternalType>::value>::type m_values;
+
+   InternalType *values()
+   {  return static_cast<InternalType*>(static_cast<void*>(&m_values));  }
+
+   const InternalType *values() const
+   {  return static_cast<const InternalType*>(static_cast<const void*>(&m_values));  }
+
+   node_ptr &child(std::size_t i)
+   {
+      BOOST_ASSERT(!m_leaf);
+      return static_cast<btree_internal_node<InternalType, VoidPointer, N>&>(*this).m_children[i];
+   }
+
+   const node_ptr &child(std::size_t i) const
+   {
+      BOOST_ASSERT(!m_leaf);
+      return static_cast<const btree_internal_node<InternalType, VoidPointer, N>&>(*this).m_children[i];
+   }
+};
+
+template<class InternalType, class VoidPointer, std::size_t N>
+struct btree_internal_node
+   : public btree_node<InternalType, VoidPointer, N>
+{
+   typename btree_node<InternalType, VoidPointer, N>::node_ptr m_children[N + 1u];
+};
+
+//B-tree nodes store several values, so an extracted value is moved
+//to a standalone node owned by the node_handle
+template<class T>
+struct btree_value_node
+{
+   private:
+   btree_value_node();
+
+   public:
+   typedef T value_type;
+   typedef typename tree_internal_data_type<T>::type     internal_type;
+
+   T &get_data()
+   {
+      T* ptr = reinterpret_cast<T*>(&this->m_data);
+      return *ptr;
+   }
+
+   const T &get_data() const
+   {
+      const T* ptr = reinterpret_cast<const T*>(&this->m_data);
+      return *ptr;
+   }
+
+   internal_type m_data;
+};
+
+//An iterator designates a node and the index of a value in that node.
+//The end iterator designates the position past the last value of the
+//rightmost leaf so that it can be decremented.
+template<class NodePtr, class Value, bool IsConst>
+class btree_iterator
+{
+   typedef boost::intrusive::pointer_traits<NodePtr>                                node_ptr_traits;
+
+   public:
+   typedef std::bidirectional_iterator_tag                                          iterator_category;
+   typedef Value                                                                    value_type;
+   typedef typename node_ptr_traits::difference_type                                difference_type;
+   typedef typename if_c
+      < IsConst
+      , typename node_ptr_traits::template rebind_pointer<const Value>::type
+      , typename node_ptr_traits::template rebind_pointer<Value>::type
+      >::type                                                                       pointer;
+   typedef typename boost::intrusive::pointer_traits<pointer>::reference            reference;
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   NodePtr     m_node;
+   std::size_t m_pos;
+
+   public:
+   btree_iterator(const NodePtr &node, std::size_t pos) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_node(node), m_pos(pos)
+   {}
+
+   const NodePtr &get_node() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_node;  }
+
+   std::size_t get_pos() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_pos;  }
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   btree_iterator() BOOST_NOEXCEPT_OR_NOTHROW
+      : m_node(), m_pos(0u)   //Value initialization to achieve "null iterators" (N3644)
+   {}
+
+   btree_iterator(btree_iterator<NodePtr, Value, false> const& other) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_node(other.get_node()), m_pos(other.get_pos())
+   {}
+
+   reference operator*() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return *reinterpret_cast<typename if_c<IsConst, const Value, Value>::type *>(m_node->values() + m_pos);  }
+
+   pointer operator->() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return ::boost::intrusive::pointer_traits<pointer>::pointer_to(this->operator*());  }
+
+   btree_iterator& operator++() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(m_node->m_leaf){
+         if(++m_pos != m_node->m_count)
+            return *this;
+         //Climb until a value at the right of the subtree is found.
+         //If there is none this was the last value: stay past the end of the leaf
+         NodePtr n(m_node);
+         std::size_t pos(m_pos);
+         while(pos == n->m_count && n->m_parent){
+            pos = n->m_position;
+            n = n->m_parent;
+         }
+         if(pos != n->m_count){
+            m_node = n;
+            m_pos  = pos;
+         }
+      }
+      else{
+         //Leftmost value of the right subtree
+         m_node = m_node->child(m_pos + 1u);
+         while(!m_node->m_leaf){
+            m_node = m_node->child(0u);
+         }
+         m_pos = 0u;
+      }
+      return *this;
+   }
+
+   btree_iterator operator++(int) BOOST_NOEXCEPT_OR_NOTHROW
+   {  btree_iterator tmp(*this); ++*this; return tmp;  }
+
+   btree_iterator& operator--() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(m_node->m_leaf){
+         if(m_pos){
+            --m_pos;
+         }
+         else{
+            //Climb until this subtree is not the leftmost child
+            NodePtr n(m_node);
+            while(!n->m_position && n->m_parent){
+               n = n->m_parent;
+            }
+            BOOST_ASSERT(n->m_parent);
+            m_pos  = n->m_position - 1u;
+            m_node = n->m_parent;
+         }
+      }
+      else{
+         //Rightmost value of the left subtree
+         m_node = m_node->child(m_pos);
+         while(!m_node->m_leaf){
+            m_node = m_node->child(m_node->m_count);
+         }
+         m_pos = m_node->m_count - 1u;
+      }
+      return *this;
+   }
+
+   btree_iterator operator--(int) BOOST_NOEXCEPT_OR_NOTHROW
+   {  btree_iterator tmp(*this); --*this; return tmp;  }
+
+   friend bool operator== (const btree_iterator& l, const btree_iterator& r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_node == r.m_node && l.m_pos == r.m_pos;  }
+
+   friend bool operator!= (const btree_iterator& l, const btree_iterator& r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !(l == r);  }
+};
+
+//Ordered associative containers configured with tree_type<btree> store their
+//values in the nodes of a B-tree instead of a node per value. Nodes are
+//allocated with the container's allocator and values are relocated (moved and
+//destroyed) between nodes when they are split, merged or rebalanced, so any
+//insertion or erasure invalidates iterators and references. Every operation
+//keeps the public interface and complexity guarantees of the binary trees.
+template <class Key, class T, class KeyOfValue, class Compare, class Allocator, class Options>
+class tree<Key, T, KeyOfValue, Compare, Allocator, Options, btree>
+{
+   typedef tree_value_compare
+            <Key, T, Compare, KeyOfValue>                   ValComp;
+   typedef typename tree_internal_data_type<T>::type        internal_type;
+   typedef allocator_traits<Allocator>                      value_allocator_traits;
+   typedef typename value_allocator_traits::void_pointer    void_pointer;
+   static const std::size_t node_capacity = btree_node_capacity<internal_type>::value;
+   //A node with less values is merged with or refilled from a sibling after an erasure
+   static const std::size_t node_min_count = node_capacity/2u;
+   typedef btree_node
+      <internal_type, void_pointer, node_capacity>          leaf_node_t;
+   typedef btree_internal_node
+      <internal_type, void_pointer, node_capacity>          internal_node_t;
+   typedef typename leaf_node_t::node_ptr                   node_ptr;
+   typedef typename leaf_node_t::internal_node_ptr          internal_node_ptr;
+   typedef typename value_allocator_traits::template
+      portable_rebind_alloc<leaf_node_t>::type              leaf_allocator_type;
+   typedef allocator_traits<leaf_allocator_type>            leaf_allocator_traits;
+   typedef typename value_allocator_traits::template
+      portable_rebind_alloc<internal_node_t>::type          internal_allocator_type;
+   typedef allocator_traits<internal_allocator_type>        internal_allocator_traits;
+   typedef typename value_allocator_traits::template
+      portable_rebind_alloc<internal_type>::type            data_allocator_type;
+   typedef allocator_traits<data_allocator_type>            data_allocator_traits;
+   typedef tree < Key, T, KeyOfValue
+                , Compare, Allocator, Options, btree>       ThisType;
+   typedef typename value_allocator_traits::template
+      portable_rebind_alloc<btree_value_node<T> >::type     value_node_allocator_type;
+   typedef allocator_traits<value_node_allocator_type>      value_node_allocator_traits;
+   typedef typename value_node_allocator_traits::pointer    value_node_ptr;
+
+   BOOST_COPYABLE_AND_MOVABLE(tree)
+
+   //Subtree sizes are only maintained by red-black and AVL trees
+   BOOST_STATIC_ASSERT(( !Options::order_statistics ));
+
+   //Leaves and inner nodes have different sizes, so they can't share a node pool
+   BOOST_STATIC_ASSERT(( !Options::private_node_pool ));
+
+   public:
+
+   typedef Key                                        key_type;
+   typedef T                                          value_type;
+   typedef Allocator                                  allocator_type;
+   typedef Compare                                    key_compare;
+   typedef ValComp                                    value_compare;
+   typedef typename value_allocator_traits::pointer            pointer;
+   typedef typename value_allocator_traits::const_pointer      const_pointer;
+   typedef typename value_allocator_traits::reference          reference;
+   typedef typename value_allocator_traits::const_reference    const_reference;
+   typedef typename value_allocator_traits::size_type          size_type;
+   typedef typename value_allocator_traits::difference_type    difference_type;
+   typedef difference_type                            tree_difference_type;
+   typedef pointer                                    tree_pointer;
+   typedef const_pointer                              tree_const_pointer;
+   typedef reference                                  tree_reference;
+   typedef const_reference                            tree_const_reference;
+   typedef Allocator                                  stored_allocator_type;
+
+   typedef btree_iterator<node_ptr, value_type, false>                  iterator;
+   typedef btree_iterator<node_ptr, value_type, true >                  const_iterator;
+   typedef boost::container::reverse_iterator<iterator>                 reverse_iterator;
+   typedef boost::container::reverse_iterator<const_iterator>           const_reverse_iterator;
+   typedef node_handle
+      < value_node_allocator_type
+      , typename tree_node_handle_keymapped<Key, T>::type>              node_type;
+   typedef insert_return_type_base<iterator, node_type>                 insert_return_type;
+
+   //Leaf position where a value will be inserted
+   struct insert_commit_data
+   {
+      insert_commit_data()
+         : node(), position(0u)
+      {}
+
+      node_ptr  node;
+      size_type position;
+   };
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   struct members_holder
+      : public Allocator
+   {
+      members_holder()
+         : Allocator(), m_comp(), m_root(), m_leftmost(), m_rightmost(), m_size(0u)
+      {}
+
+      template<class AllocConvertible>
+      members_holder(BOOST_FWD_REF(AllocConvertible) a, const value_compare &c)
+         : Allocator(boost::forward<AllocConvertible>(a)), m_comp(c)
+         , m_root(), m_leftmost(), m_rightmost(), m_size(0u)
+      {}
+
+      value_compare  m_comp;
+      node_ptr       m_root;
+      node_ptr       m_leftmost;
+      node_ptr       m_rightmost;
+      size_type      m_size;
+   } m_members;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+
+   tree()
+      : m_members()
+   {}
+
+   explicit tree(const key_compare& comp, const allocator_type& a = allocator_type())
+      : m_members(a, value_compare(comp))
+   {}
+
+   explicit tree(const allocator_type& a)
+      : m_members(a, value_compare())
+   {}
+
+   template <class InputIterator>
+   tree(bool unique_insertion, InputIterator first, InputIterator last, const key_compare& comp,
+          const allocator_type& a)
+      : m_members(a, value_compare(comp))
+   {
+      //Use cend() as hint to achieve linear time for
+      //ordered ranges as required by the standard
+      //for the constructor
+      BOOST_TRY{
+         if(unique_insertion){
+            for ( ; first != last; ++first){
+               this->insert_unique(this->cend(), *first);
+            }
+         }
+         else{
+            for ( ; first != last; ++first){
+               this->insert_equal(this->cend(), *first);
+            }
+         }
+      }
+      BOOST_CATCH(...){
+         this->clear();
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+   }
+
+   template <class InputIterator>
+   tree( ordered_range_t, InputIterator first, InputIterator last
+         , const key_compare& comp = key_compare(), const allocator_type& a = allocator_type())
+      : m_members(a, value_compare(comp))
+   {
+      BOOST_TRY{
+         for ( ; first != last; ++first){
+            this->priv_push_back(*first);
+         }
+      }
+      BOOST_CATCH(...){
+         this->clear();
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+   }
+
+   tree(const tree& x)
+      : m_members(value_allocator_traits::select_on_container_copy_construction(x.priv_alloc()), x.value_comp())
+   {  this->priv_clone_from(x, false_type());  }
+
+   tree(BOOST_RV_REF(tree) x)
+      : m_members(boost::move(x.priv_alloc()), x.value_comp())
+   {  this->priv_steal(x);  }
+
+   tree(const tree& x, const allocator_type &a)
+      : m_members(a, x.value_comp())
+   {  this->priv_clone_from(x, false_type());  }
+
+   tree(BOOST_RV_REF(tree) x, const allocator_type &a)
+      : m_members(a, x.value_comp())
+   {
+      if(this->priv_alloc() == x.priv_alloc()){
+         this->priv_steal(x);
+      }
+      else{
+         this->priv_clone_from(x, true_type());
+      }
+   }
+
+   ~tree()
+   {  this->clear();  }
+
+   tree& operator=(BOOST_COPY_ASSIGN_REF(tree) x)
+   {
+      if (&x != this){
+         this->clear();
+         //Transfer allocator if needed
+         container_detail::bool_<value_allocator_traits::
+            propagate_on_container_copy_assignment::value> flag;
+         container_detail::assign_alloc(this->priv_alloc(), x.priv_alloc(), flag);
+         m_members.m_comp = x.m_members.m_comp;
+         this->priv_clone_from(x, false_type());
+      }
+      return *this;
+   }
+
+   tree& operator=(BOOST_RV_REF(tree) x)
+      BOOST_NOEXCEPT_IF(  value_allocator_traits::is_always_equal::value
+                                 && boost::container::container_detail::is_nothrow_move_assignable<Compare>::value )
+   {
+      BOOST_ASSERT(this != &x);
+      const bool propagate_alloc = value_allocator_traits::propagate_on_container_move_assignment::value;
+      const bool allocators_equal = this->priv_alloc() == x.priv_alloc(); (void)allocators_equal;
+      this->clear();
+      m_members.m_comp = boost::move(x.m_members.m_comp);
+      //Resources can be transferred if both allocators are
+      //going to be equal after this function (either propagated or already equal)
+      if(propagate_alloc || allocators_equal){
+         container_detail::bool_<value_allocator_traits::
+            propagate_on_container_move_assignment::value> flag;
+         container_detail::move_alloc(this->priv_alloc(), x.priv_alloc(), flag);
+         this->priv_steal(x);
+      }
+      //Else do a one by one move
+      else{
+         this->priv_clone_from(x, true_type());
+      }
+      return *this;
+   }
+
+   public:
+   // accessors:
+   value_compare value_comp() const
+   {  return m_members.m_comp; }
+
+   key_compare key_comp() const
+   {  return m_members.m_comp.key_comp(); }
+
+   allocator_type get_allocator() const
+   {  return this->priv_alloc(); }
+
+   const stored_allocator_type &get_stored_allocator() const
+   {  return this->priv_alloc(); }
+
+   stored_allocator_type &get_stored_allocator()
+   {  return this->priv_alloc(); }
+
+   iterator begin()
+   {  return iterator(m_members.m_leftmost, 0u);  }
+
+   const_iterator begin() const
+   {  return this->cbegin();  }
+
+   iterator end()
+   {  return iterator(m_members.m_rightmost, m_members.m_rightmost ? m_members.m_rightmost->m_count : 0u);  }
+
+   const_iterator end() const
+   {  return this->cend();  }
+
+   reverse_iterator rbegin()
+   {  return reverse_iterator(end());  }
+
+   const_reverse_iterator rbegin() const
+   {  return this->crbegin();  }
+
+   reverse_iterator rend()
+   {  return reverse_iterator(begin());   }
+
+   const_reverse_iterator rend() const
+   {  return this->crend();   }
+
+   const_iterator cbegin() const
+   {  return const_iterator(m_members.m_leftmost, 0u);  }
+
+   const_iterator cend() const
+   {  return const_iterator(m_members.m_rightmost, m_members.m_rightmost ? m_members.m_rightmost->m_count : 0u);  }
+
+   const_reverse_iterator crbegin() const
+   { return const_reverse_iterator(cend()); }
+
+   const_reverse_iterator crend() const
+   { return const_reverse_iterator(cbegin()); }
+
+   bool empty() const
+   {  return !m_members.m_size;  }
+
+   size_type size() const
+   {  return m_members.m_size;  }
+
+   size_type max_size() const
+   {  return value_allocator_traits::max_size(this->priv_alloc());  }
+
+   void swap(ThisType& x)
+      BOOST_NOEXCEPT_IF(  value_allocator_traits::is_always_equal::value
+                                 && boost::container::container_detail::is_nothrow_swappable<Compare>::value )
+   {
+      container_detail::bool_<value_allocator_traits::propagate_on_container_swap::value> flag;
+      container_detail::swap_alloc(this->priv_alloc(), x.priv_alloc(), flag);
+      boost::adl_move_swap(m_members.m_comp,      x.m_members.m_comp);
+      boost::adl_move_swap(m_members.m_root,      x.m_members.m_root);
+      boost::adl_move_swap(m_members.m_leftmost,  x.m_members.m_leftmost);
+      boost::adl_move_swap(m_members.m_rightmost, x.m_members.m_rightmost);
+      boost::adl_move_swap(m_members.m_size,      x.m_members.m_size);
+   }
+
+   public:
+
+   // insert/erase
+   std::pair<iterator,bool> insert_unique_check
+      (const key_type& key, insert_commit_data &data)
+   {
+      //Descend to the leaf position of the lower bound, remembering the
+      //last value not less than key, which is the only possible duplicate
+      const value_compare &comp = m_members.m_comp;
+      node_ptr n(m_members.m_root), cand = node_ptr();
+      size_type pos = 0u, cand_pos = 0u;
+      while(n){
+         pos = this->priv_node_lower_bound(n, key);
+         if(pos != n->m_count){
+            cand = n;
+            cand_pos = pos;
+         }
+         data.node = n;
+         if(n->m_leaf)
+            break;
+         n = n->child(pos);
+      }
+      data.position = pos;
+      if(cand && !comp(key, this->priv_value(cand, cand_pos))){
+         return std::pair<iterator,bool>(iterator(cand, cand_pos), false);
+      }
+      return std::pair<iterator,bool>(this->end(), true);
+   }
+
+   std::pair<iterator,bool> insert_unique_check
+      (const_iterator hint, const key_type& key, insert_commit_data &data)
+   {
+      const value_compare &comp = m_members.m_comp;
+      //Check if key goes just before hint
+      if(hint == this->cend() || comp(key, *hint)){
+         if(hint == this->cbegin()){
+            this->priv_position_before(hint, data);
+            return std::pair<iterator,bool>(this->end(), true);
+         }
+         const_iterator prev(hint);
+         --prev;
+         if(comp(*prev, key)){
+            this->priv_position_before(hint, data);
+            return std::pair<iterator,bool>(this->end(), true);
+         }
+         else if(!comp(key, *prev)){
+            return std::pair<iterator,bool>(this->priv_iterator(prev), false);
+         }
+      }
+      else if(!comp(*hint, key)){
+         return std::pair<iterator,bool>(this->priv_iterator(hint), false);
+      }
+      //The hint was useless
+      return this->insert_unique_check(key, data);
+   }
+
+   iterator insert_unique_commit(const value_type& v, insert_commit_data &data)
+   {  return this->priv_insert_commit(data, v);  }
+
+   template<class MovableConvertible>
+   iterator insert_unique_commit
+      (BOOST_FWD_REF(MovableConvertible) v, insert_commit_data &data)
+   {  return this->priv_insert_commit(data, boost::forward<MovableConvertible>(v));  }
+
+   std::pair<iterator,bool> insert_unique(const value_type& v)
+   {
+      insert_commit_data data;
+      std::pair<iterator,bool> ret =
+         this->insert_unique_check(KeyOfValue()(v), data);
+      if(ret.second){
+         ret.first = this->insert_unique_commit(v, data);
+      }
+      return ret;
+   }
+
+   template<class MovableConvertible>
+   std::pair<iterator,bool> insert_unique(BOOST_FWD_REF(MovableConvertible) v)
+   {
+      insert_commit_data data;
+      std::pair<iterator,bool> ret =
+         this->insert_unique_check(KeyOfValue()(v), data);
+      if(ret.second){
+         ret.first = this->insert_unique_commit(boost::forward<MovableConvertible>(v), data);
+      }
+      return ret;
+   }
+
+   #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   template <class... Args>
+   std::pair<iterator, bool> emplace_unique(BOOST_FWD_REF(Args)... args)
+   {
+      typename aligned_storage<sizeof(internal_type), alignment_of<internal_type>::value>::type v;
+      internal_type &val = *static_cast<internal_type *>(static_cast<void *>(&v));
+      data_allocator_type a(this->priv_alloc());
+      data_allocator_traits::construct(a, &val, ::boost::forward<Args>(args)... );
+      value_destructor<data_allocator_type> d(a, val);
+      return this->insert_unique(::boost::move(val));
+   }
+
+   template <class... Args>
+   iterator emplace_hint_unique(const_iterator hint, BOOST_FWD_REF(Args)... args)
+   {
+      typename aligned_storage<sizeof(internal_type), alignment_of<internal_type>::value>::type v;
+      internal_type &val = *static_cast<internal_type *>(static_cast<void *>(&v));
+      data_allocator_type a(this->priv_alloc());
+      data_allocator_traits::construct(a, &val, ::boost::forward<Args>(args)... );
+      value_destructor<data_allocator_type> d(a, val);
+      return this->insert_unique(hint, ::boost::move(val));
+   }
+
+   template <class... Args>
+   iterator emplace_equal(BOOST_FWD_REF(Args)... args)
+   {
+      typename aligned_storage<sizeof(internal_type), alignment_of<internal_type>::value>::type v;
+      internal_type &val = *static_cast<internal_type *>(static_cast<void *>(&v));
+      data_allocator_type a(this->priv_alloc());
+      data_allocator_traits::construct(a, &val, ::boost::forward<Args>(args)... );
+      value_destructor<data_allocator_type> d(a, val);
+      return this->insert_equal(::boost::move(val));
+   }
+
+   template <class... Args>
+   iterator emplace_hint_equal(const_iterator hint, BOOST_FWD_REF(Args)... args)
+   {
+      typename aligned_storage<sizeof(internal_type), alignment_of<internal_type>::value>::type v;
+      internal_type &val = *static_cast<internal_type *>(static_cast<void *>(&v));
+      data_allocator_type a(this->priv_alloc());
+      data_allocator_traits::construct(a, &val, ::boost::forward<Args>(args)... );
+      value_destructor<data_allocator_type> d(a, val);
+      return this->insert_equal(hint, ::boost::move(val));
+   }
+
+   #else // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   #define BOOST_CONTAINER_BTREE_EMPLACE_CODE(N) \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   std::pair<iterator, bool> emplace_unique(BOOST_MOVE_UREF##N)\
+   {\
+      typename aligned_storage<sizeof(internal_type), alignment_of<internal_type>::value>::type v;\
+      internal_type &val = *static_cast<internal_type *>(static_cast<void *>(&v));\
+      data_allocator_type a(this->priv_alloc());\
+      data_allocator_traits::construct(a, &val BOOST_MOVE_I##N BOOST_MOVE_FWD##N);\
+      value_destructor<data_allocator_type> d(a, val);\
+      return this->insert_unique(::boost::move(val));\
+   }\
+   \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   iterator emplace_hint_unique(const_iterator hint BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
+   {\
+      typename aligned_storage<sizeof(internal_type), alignment_of<internal_type>::value>::type v;\
+      internal_type &val = *static_cast<internal_type *>(static_cast<void *>(&v));\
+      data_allocator_type a(this->priv_alloc());\
+      data_allocator_traits::construct(a, &val BOOST_MOVE_I##N BOOST_MOVE_FWD##N);\
+      value_destructor<data_allocator_type> d(a, val);\
+      return this->insert_unique(hint, ::boost::move(val));\
+   }\
+   \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   iterator emplace_equal(BOOST_MOVE_UREF##N)\
+   {\
+      typename aligned_storage<sizeof(internal_type), alignment_of<internal_type>::value>::type v;\
+      internal_type &val = *static_cast<internal_type *>(static_cast<void *>(&v));\
+      data_allocator_type a(this->priv_alloc());\
+      data_allocator_traits::construct(a, &val BOOST_MOVE_I##N BOOST_MOVE_FWD##N);\
+      value_destructor<data_allocator_type> d(a, val);\
+      return this->insert_equal(::boost::move(val));\
+   }\
+   \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   iterator emplace_hint_equal(const_iterator hint BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
+   {\
+      typename aligned_storage<sizeof(internal_type), alignment_of<internal_type>::value>::type v;\
+      internal_type &val = *static_cast<internal_type *>(static_cast<void *>(&v));\
+      data_allocator_type a(this->priv_alloc());\
+      data_allocator_traits::construct(a, &val BOOST_MOVE_I##N BOOST_MOVE_FWD##N);\
+      value_destructor<data_allocator_type> d(a, val);\
+      return this->insert_equal(hint, ::boost::move(val));\
+   }\
+   //
+   BOOST_MOVE_ITERATE_0TO9(BOOST_CONTAINER_BTREE_EMPLACE_CODE)
+   #undef BOOST_CONTAINER_BTREE_EMPLACE_CODE
+
+   #endif   // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   iterator insert_unique(const_iterator hint, const value_type& v)
+   {
+      insert_commit_data data;
+      std::pair<iterator,bool> ret =
+         this->insert_unique_check(hint, KeyOfValue()(v), data);
+      if(!ret.second)
+         return ret.first;
+      return this->insert_unique_commit(v, data);
+   }
+
+   template<class MovableConvertible>
+   iterator insert_unique(const_iterator hint, BOOST_FWD_REF(MovableConvertible) v)
+   {
+      insert_commit_data data;
+      std::pair<iterator,bool> ret =
+         this->insert_unique_check(hint, KeyOfValue()(v), data);
+      if(!ret.second)
+         return ret.first;
+      return this->insert_unique_commit(boost::forward<MovableConvertible>(v), data);
+   }
+
+   template <class InputIterator>
+   void insert_unique(InputIterator first, InputIterator last)
+   {
+      for( ; first != last; ++first)
+         this->insert_unique(*first);
+   }
+
+   iterator insert_equal(const value_type& v)
+   {
+      insert_commit_data data;
+      this->priv_upper_bound_position(KeyOfValue()(v), data);
+      return this->priv_insert_commit(data, v);
+   }
+
+   template<class MovableConvertible>
+   iterator insert_equal(BOOST_FWD_REF(MovableConvertible) v)
+   {
+      insert_commit_data data;
+      this->priv_upper_bound_position(KeyOfValue()(v), data);
+      return this->priv_insert_commit(data, boost::forward<MovableConvertible>(v));
+   }
+
+   iterator insert_equal(const_iterator hint, const value_type& v)
+   {
+      insert_commit_data data;
+      this->priv_equal_position(hint, KeyOfValue()(v), data);
+      return this->priv_insert_commit(data, v);
+   }
+
+   template<class MovableConvertible>
+   iterator insert_equal(const_iterator hint, BOOST_FWD_REF(MovableConvertible) v)
+   {
+      insert_commit_data data;
+      this->priv_equal_position(hint, KeyOfValue()(v), data);
+      return this->priv_insert_commit(data, boost::forward<MovableConvertible>(v));
+   }
+
+   template <class InputIterator>
+   void insert_equal(InputIterator first, InputIterator last)
+   {
+      for( ; first != last; ++first)
+         this->insert_equal(*first);
+   }
+
+   iterator erase(const_iterator position)
+   {
+      BOOST_ASSERT(position != this->cend());
+      node_ptr n(position.get_node());
+      size_type pos(position.get_pos());
+      data_allocator_type a(this->priv_alloc());
+      internal_type *const vals = n->values();
+      data_allocator_traits::destroy(a, vals + pos);
+      //The position of the value that follows the erased one is tracked
+      //through the rebalancing steps. If an internal value is erased its slot
+      //is refilled with the predecessor, so the result is the next position.
+      bool advance = false;
+      node_ptr leaf(n);
+      if(n->m_leaf){
+         priv_relocate_left(a, vals + pos, vals + pos + 1u, n->m_count - pos - 1u);
+      }
+      else{
+         leaf = n->child(pos);
+         while(!leaf->m_leaf){
+            leaf = leaf->child(leaf->m_count);
+         }
+         priv_relocate(a, vals + pos, leaf->values() + leaf->m_count - 1u);
+         advance = true;
+      }
+      --leaf->m_count;
+      --m_members.m_size;
+      this->priv_rebalance_after_erase(leaf, n, pos);
+      if(!m_members.m_root){
+         return this->end();
+      }
+      iterator ret(this->priv_next_position(n, pos));
+      if(advance){
+         ++ret;
+      }
+      return ret;
+   }
+
+   size_type erase(const key_type& k)
+   {
+      std::pair<iterator, iterator> r(this->equal_range(k));
+      const size_type n = static_cast<size_type>(boost::container::iterator_distance(r.first, r.second));
+      iterator it(r.first);
+      for(size_type i = 0; i != n; ++i){
+         it = this->erase(it);
+      }
+      return n;
+   }
+
+   iterator erase(const_iterator first, const_iterator last)
+   {
+      if(first == this->cbegin() && last == this->cend()){
+         this->clear();
+         return this->end();
+      }
+      //Erasure invalidates last, so count the values to be erased
+      size_type n = static_cast<size_type>(boost::container::iterator_distance(first, last));
+      iterator it(this->priv_iterator(first));
+      for(; n; --n){
+         it = this->erase(it);
+      }
+      return it;
+   }
+
+   void clear()
+   {
+      if(m_members.m_root){
+         this->priv_destroy_subtree(m_members.m_root);
+         m_members.m_root = m_members.m_leftmost = m_members.m_rightmost = node_ptr();
+         m_members.m_size = 0u;
+      }
+   }
+
+   node_type extract(const key_type& k)
+   {
+      const iterator it = this->find(k);
+      if(this->end() != it){
+         return this->extract(it);
+      }
+      return node_type();
+   }
+
+   node_type extract(const_iterator position)
+   {
+      BOOST_ASSERT(position != this->cend());
+      value_node_allocator_type a(this->priv_alloc());
+      value_node_ptr p(allocator_version_traits<value_node_allocator_type>::allocate_one(a));
+      scoped_deallocator<value_node_allocator_type> node_deallocator(p, a);
+      value_node_allocator_traits::construct
+         (a, container_detail::addressof(p->m_data), ::boost::move(priv_internal_value(position)));
+      node_deallocator.release();
+      this->erase(position);
+      return node_type(p, a);
+   }
+
+   insert_return_type insert_unique_node(BOOST_RV_REF(node_type) nh)
+   {
+      insert_return_type irt; //inserted == false, node.empty()
+      if(!nh.empty()){
+         insert_commit_data data;
+         std::pair<iterator,bool> ret =
+            this->insert_unique_check(KeyOfValue()(nh.value()), data);
+         if(ret.second){
+            irt.inserted = true;
+            irt.position = this->priv_insert_commit(data, ::boost::move(nh.get()->m_data));
+            priv_dispose(nh);
+         }
+         else{
+            irt.position = ret.first;
+            irt.node = boost::move(nh);
+         }
+      }
+      else{
+         irt.position = this->end();
+      }
+      return boost::move(irt);
+   }
+
+   iterator insert_unique_node(const_iterator hint, BOOST_RV_REF(node_type) nh)
+   {
+      if(nh.empty()){
+         return this->end();
+      }
+      insert_commit_data data;
+      std::pair<iterator,bool> ret =
+         this->insert_unique_check(hint, KeyOfValue()(nh.value()), data);
+      if(ret.second){
+         ret.first = this->priv_insert_commit(data, ::boost::move(nh.get()->m_data));
+         priv_dispose(nh);
+      }
+      return ret.first;
+   }
+
+   iterator insert_equal_node(BOOST_RV_REF(node_type) nh)
+   {
+      if(nh.empty()){
+         return this->end();
+      }
+      const iterator ret(this->insert_equal(::boost::move(nh.get()->m_data)));
+      priv_dispose(nh);
+      return ret;
+   }
+
+   iterator insert_equal_node(const_iterator hint, BOOST_RV_REF(node_type) nh)
+   {
+      if(nh.empty()){
+         return this->end();
+      }
+      const iterator ret(this->insert_equal(hint, ::boost::move(nh.get()->m_data)));
+      priv_dispose(nh);
+      return ret;
+   }
+
+   //Values are moved from source to *this. Values whose key is
+   //already present in *this stay in source.
+   template<class C2>
+   void merge_unique(tree<Key, T, KeyOfValue, C2, Allocator, Options, btree> &source)
+   {
+      //Both trees share the node layout, so source iterators are of the same type
+      iterator it(source.begin());
+      while(it != source.end()){
+         insert_commit_data data;
+         if(this->insert_unique_check(KeyOfValue()(*it), data).second){
+            this->priv_insert_commit(data, ::boost::move(priv_internal_value(it)));
+            it = source.erase(it);
+         }
+         else{
+            ++it;
+         }
+      }
+   }
+
+   //All values are moved from source to *this
+   //after the already present equivalent elements.
+   template<class C2>
+   void merge_equal(tree<Key, T, KeyOfValue, C2, Allocator, Options, btree> &source)
+   {
+      if(static_cast<void*>(&source) == static_cast<void*>(this))
+         return;
+      iterator it(source.begin());
+      while(it != source.end()){
+         this->insert_equal(::boost::move(priv_internal_value(it)));
+         it = source.erase(it);
+      }
+   }
+
+   //Set algebra for unique trees. Elements of the smaller tree are searched in
+   //the larger one in order, restarting from the root only when the previous
+   //result is not already the answer. Insertions and erasures invalidate
+   //iterators, so the positions returned by insert and erase are followed.
+
+   //Inserts copies of the elements of x whose keys are not present in *this
+   void merge_union_unique(const tree &x)
+   {
+      if(&x == this){
+         return;
+      }
+      const key_compare key_cmp(this->key_comp());
+      const_iterator finger(this->cbegin());
+      for(const_iterator it(x.cbegin()), itend(x.cend()); it != itend; ++it){
+         const key_type &k = KeyOfValue()(*it);
+         finger = this->priv_lower_bound_from(finger, k);
+         if(finger == this->cend() || key_cmp(k, KeyOfValue()(*finger))){
+            finger = this->insert_unique(finger, *it);
+            ++finger;
+         }
+      }
+   }
+
+   //Erases the elements of *this whose keys are not present in x
+   void intersect_with_unique(const tree &x)
+   {
+      const key_compare key_cmp(this->key_comp());
+      if(&x == this){
+         return;
+      }
+      else if(this->size() <= x.size()){
+         const_iterator finger(x.cbegin());
+         for(const_iterator it(this->cbegin()); it != this->cend(); ){
+            const key_type &k = KeyOfValue()(*it);
+            finger = x.priv_lower_bound_from(finger, k);
+            if(finger == x.cend() || key_cmp(k, KeyOfValue()(*finger))){
+               it = this->erase(it);
+            }
+            else{
+               ++it;
+            }
+         }
+      }
+      else{
+         const_iterator it(this->cbegin());
+         for(const_iterator xit(x.cbegin()), xitend(x.cend()); xit != xitend && it != this->cend(); ++xit){
+            const key_type &k = KeyOfValue()(*xit);
+            it = this->erase(it, this->priv_lower_bound_from(it, k));
+            if(it != this->cend() && !key_cmp(k, KeyOfValue()(*it))){
+               ++it;
+            }
+         }
+         this->erase(it, this->cend());
+      }
+   }
+
+   //Erases the elements of *this whose keys are present in x
+   void subtract_unique(const tree &x)
+   {
+      const key_compare key_cmp(this->key_comp());
+      if(&x == this){
+         this->clear();
+      }
+      else if(this->size() <= x.size()){
+         const_iterator finger(x.cbegin());
+         for(const_iterator it(this->cbegin()); it != this->cend(); ){
+            const key_type &k = KeyOfValue()(*it);
+            finger = x.priv_lower_bound_from(finger, k);
+            if(finger != x.cend() && !key_cmp(k, KeyOfValue()(*finger))){
+               it = this->erase(it);
+            }
+            else{
+               ++it;
+            }
+         }
+      }
+      else{
+         const_iterator it(this->cbegin());
+         for(const_iterator xit(x.cbegin()), xitend(x.cend()); xit != xitend && it != this->cend(); ++xit){
+            const key_type &k = KeyOfValue()(*xit);
+            it = this->priv_lower_bound_from(it, k);
+            if(it != this->cend() && !key_cmp(k, KeyOfValue()(*it))){
+               it = this->erase(it);
+            }
+         }
+      }
+   }
+
+   // search operations. Const and non-const overloads even if no iterator is returned
+   // to offer the same interface as binary trees
+   iterator find(const key_type& k)
+   {  return this->priv_find(k);  }
+
+   const_iterator find(const key_type& k) const
+   {  return this->priv_find(k);  }
+
+   size_type count(const key_type& k) const
+   {
+      std::pair<const_iterator, const_iterator> r(this->equal_range(k));
+      return static_cast<size_type>(boost::container::iterator_distance(r.first, r.second));
+   }
+
+   iterator lower_bound(const key_type& k)
+   {  return this->priv_lower_bound(k);  }
+
+   const_iterator lower_bound(const key_type& k) const
+   {  return this->priv_lower_bound(k);  }
+
+   iterator upper_bound(const key_type& k)
+   {  return this->priv_upper_bound(k);  }
+
+   const_iterator upper_bound(const key_type& k) const
+   {  return this->priv_upper_bound(k);  }
+
+   std::pair<iterator,iterator> equal_range(const key_type& k)
+   {  return std::pair<iterator,iterator>(this->priv_lower_bound(k), this->priv_upper_bound(k));  }
+
+   std::pair<const_iterator, const_iterator> equal_range(const key_type& k) const
+   {  return std::pair<const_iterator,const_iterator>(this->priv_lower_bound(k), this->priv_upper_bound(k));  }
+
+   std::pair<iterator,iterator> lower_bound_range(const key_type& k)
+   {  return this->priv_lower_bound_range(k);  }
+
+   std::pair<const_iterator, const_iterator> lower_bound_range(const key_type& k) const
+   {
+      const std::pair<iterator,iterator> r(this->priv_lower_bound_range(k));
+      return std::pair<const_iterator,const_iterator>(r.first, r.second);
+   }
+
+   template<class KeyForwardIterator, class OutputIterator>
+   OutputIterator find_batch(KeyForwardIterator first, KeyForwardIterator last, OutputIterator out)
+   {  return this->template priv_find_batch<iterator>(first, last, out);  }
+
+   template<class KeyForwardIterator, class OutputIterator>
+   OutputIterator find_batch(KeyForwardIterator first, KeyForwardIterator last, OutputIterator out) const
+   {  return this->template priv_find_batch<const_iterator>(first, last, out);  }
+
+   //Heterogeneous lookup, only available for transparent comparators
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      find(const K& k)
+   {  return this->priv_find(k);  }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      find(const K& k) const
+   {  return this->priv_find(k);  }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, size_type>::type
+      count(const K& k) const
+   {
+      std::pair<const_iterator, const_iterator> r(this->equal_range(k));
+      return static_cast<size_type>(boost::container::iterator_distance(r.first, r.second));
+   }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      lower_bound(const K& k)
+   {  return this->priv_lower_bound(k);  }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      lower_bound(const K& k) const
+   {  return this->priv_lower_bound(k);  }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      upper_bound(const K& k)
+   {  return this->priv_upper_bound(k);  }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      upper_bound(const K& k) const
+   {  return this->priv_upper_bound(k);  }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<iterator,iterator> >::type
+      equal_range(const K& k)
+   {  return std::pair<iterator,iterator>(this->priv_lower_bound(k), this->priv_upper_bound(k));  }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<const_iterator, const_iterator> >::type
+      equal_range(const K& k) const
+   {  return std::pair<const_iterator,const_iterator>(this->priv_lower_bound(k), this->priv_upper_bound(k));  }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<iterator,iterator> >::type
+      lower_bound_range(const K& k)
+   {  return this->priv_lower_bound_range(k);  }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<const_iterator, const_iterator> >::type
+      lower_bound_range(const K& k) const
+   {
+      const std::pair<iterator,iterator> r(this->priv_lower_bound_range(k));
+      return std::pair<const_iterator,const_iterator>(r.first, r.second);
+   }
+
+   //B-trees are always balanced
+   void rebalance()
+   {}
+
+   //Nodes keep no subtree sizes, so these are linear
+   iterator nth(size_type n)
+   {
+      BOOST_ASSERT(n <= this->size());
+      iterator it(this->begin());
+      boost::container::iterator_advance(it, difference_type(n));
+      return it;
+   }
+
+   const_iterator nth(size_type n) const
+   {  return const_cast<tree&>(*this).nth(n);  }
+
+   size_type index_of(iterator p)
+   {  return this->index_of(const_iterator(p));  }
+
+   size_type index_of(const_iterator p) const
+   {  return static_cast<size_type>(boost::container::iterator_distance(this->cbegin(), p));  }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+
+   const Allocator &priv_alloc() const
+   {  return m_members;  }
+
+   Allocator &priv_alloc()
+   {  return m_members;  }
+
+   static value_type &priv_value(const node_ptr &n, size_type i)
+   {  return *reinterpret_cast<value_type*>(n->values() + i);  }
+
+   static internal_type &priv_internal_value(const const_iterator &it)
+   {  return it.get_node()->values()[it.get_pos()];  }
+
+   //Returns the first value not less than k, given that all the values before
+   //finger are less than k. B-trees are shallow, so a new search from the root
+   //is about as cheap as a finger search.
+   const_iterator priv_lower_bound_from(const const_iterator &finger, const key_type& k) const
+   {
+      return (finger == this->cend() || !this->key_comp()(KeyOfValue()(*finger), k))
+         ? finger : this->lower_bound(k);
+   }
+
+   //Destroys the moved-from value of nh and deallocates its standalone node
+   static void priv_dispose(node_type &nh)
+   {  node_type tmp(::boost::move(nh));  }
+
+   iterator priv_iterator(const const_iterator &it) const
+   {  return iterator(it.get_node(), it.get_pos());  }
+
+   //Past the last value of a leaf designates the next value in order
+   iterator priv_next_position(node_ptr n, size_type pos) const
+   {
+      while(pos == n->m_count && n->m_parent){
+         pos = n->m_position;
+         n = n->m_parent;
+      }
+      if(pos == n->m_count){
+         return const_cast<tree&>(*this).end();
+      }
+      return iterator(n, pos);
+   }
+
+   //Binary searches in the values of a node
+   template<class K>
+   size_type priv_node_lower_bound(const node_ptr &n, const K &k) const
+   {
+      const value_compare &comp = m_members.m_comp;
+      size_type first = 0u;
+      size_type len = n->m_count;
+      while(len){
+         const size_type half = len >> 1;
+         if(comp(priv_value(n, first + half), k)){
+            first += half + 1u;
+            len   -= half + 1u;
+         }
+         else{
+            len = half;
+         }
+      }
+      return first;
+   }
+
+   template<class K>
+   size_type priv_node_upper_bound(const node_ptr &n, const K &k) const
+   {
+      const value_compare &comp = m_members.m_comp;
+      size_type first = 0u;
+      size_type len = n->m_count;
+      while(len){
+         const size_type half = len >> 1;
+         if(!comp(k, priv_value(n, first + half))){
+            first += half + 1u;
+            len   -= half + 1u;
+         }
+         else{
+            len = half;
+         }
+      }
+      return first;
+   }
+
+   template<class K>
+   iterator priv_lower_bound(const K &k) const
+   {
+      node_ptr n(m_members.m_root), cand = node_ptr();
+      size_type cand_pos = 0u;
+      while(n){
+         const size_type pos = this->priv_node_lower_bound(n, k);
+         if(pos != n->m_count){
+            cand = n;
+            cand_pos = pos;
+         }
+         if(n->m_leaf)
+            break;
+         n = n->child(pos);
+      }
+      return cand ? iterator(cand, cand_pos) : const_cast<tree&>(*this).end();
+   }
+
+   template<class K>
+   iterator priv_upper_bound(const K &k) const
+   {
+      node_ptr n(m_members.m_root), cand = node_ptr();
+      size_type cand_pos = 0u;
+      while(n){
+         const size_type pos = this->priv_node_upper_bound(n, k);
+         if(pos != n->m_count){
+            cand = n;
+            cand_pos = pos;
+         }
+         if(n->m_leaf)
+            break;
+         n = n->child(pos);
+      }
+      return cand ? iterator(cand, cand_pos) : const_cast<tree&>(*this).end();
+   }
+
+   template<class K>
+   iterator priv_find(const K &k) const
+   {
+      iterator it(this->priv_lower_bound(k));
+      const iterator e(const_cast<tree&>(*this).end());
+      return (it != e && !m_members.m_comp(k, *it)) ? it : e;
+   }
+
+   template<class K>
+   std::pair<iterator,iterator> priv_lower_bound_range(const K &k) const
+   {
+      iterator lb(this->priv_lower_bound(k)), ub(lb);
+      if(lb != const_cast<tree&>(*this).end() && !m_members.m_comp(k, *lb)){
+         ++ub;
+      }
+      return std::pair<iterator,iterator>(lb, ub);
+   }
+
+   //Descends the tree for up to find_batch_size keys in round-robin order,
+   //prefetching the next node of each descent while the others are searched,
+   //so that several cache misses are in flight at the same time.
+   template<class It, class KeyForwardIterator, class OutputIterator>
+   OutputIterator priv_find_batch(KeyForwardIterator first, const KeyForwardIterator last, OutputIterator out) const
+   {
+      const value_compare &comp = m_members.m_comp;
+      const It e(const_cast<tree&>(*this).end());
+      KeyForwardIterator keys[container_detail::find_batch_size];
+      node_ptr  x[container_detail::find_batch_size];
+      node_ptr  cand[container_detail::find_batch_size];
+      size_type cand_pos[container_detail::find_batch_size];
+      while(first != last){
+         std::size_t m = 0;
+         for(; m != container_detail::find_batch_size && first != last; ++m, ++first){
+            keys[m] = first;
+            x[m] = m_members.m_root;
+            cand[m] = node_ptr();
+            cand_pos[m] = 0u;
+         }
+         for(bool pending = true; pending; ){
+            pending = false;
+            for(std::size_t i = 0; i != m; ++i){
+               const node_ptr n(x[i]);
+               if(n){
+                  const size_type pos = this->priv_node_lower_bound(n, *keys[i]);
+                  if(pos != n->m_count){
+                     cand[i] = n;
+                     cand_pos[i] = pos;
+                  }
+                  x[i] = n->m_leaf ? node_ptr() : n->child(pos);
+                  if(x[i]){
+                     //The header and the middle value, the first probe of the binary search
+                     BOOST_CONTAINER_PREFETCH(container_detail::to_raw_pointer(x[i]));
+                     BOOST_CONTAINER_PREFETCH(x[i]->values() + node_capacity/2u);
+                     pending = true;
+                  }
+               }
+            }
+         }
+         for(std::size_t i = 0; i != m; ++i, ++out){
+            *out = (cand[i] && !comp(*keys[i], priv_value(cand[i], cand_pos[i])))
+               ? It(iterator(cand[i], cand_pos[i])) : e;
+         }
+      }
+      return out;
+   }
+
+   //Leaf position that inserts a value after all equivalent values
+   template<class K>
+   void priv_upper_bound_position(const K &k, insert_commit_data &data) const
+   {
+      node_ptr n(m_members.m_root);
+      data.node = node_ptr();
+      data.position = 0u;
+      while(n){
+         data.node = n;
+         data.position = this->priv_node_upper_bound(n, k);
+         if(n->m_leaf)
+            break;
+         n = n->child(data.position);
+      }
+   }
+
+   //Leaf position that inserts a value just before the value pointed by hint
+   void priv_position_before(const const_iterator &hint, insert_commit_data &data) const
+   {
+      node_ptr n(hint.get_node());
+      if(!n || n->m_leaf){
+         data.node = n;
+         data.position = hint.get_pos();
+      }
+      else{
+         //After the predecessor, the last value of the left subtree
+         n = n->child(hint.get_pos());
+         while(!n->m_leaf){
+            n = n->child(n->m_count);
+         }
+         data.node = n;
+         data.position = n->m_count;
+      }
+   }
+
+   //Leaf position for insert_equal with a hint: just before hint
+   //if that keeps the order, after all equivalent values otherwise
+   template<class K>
+   void priv_equal_position(const const_iterator &hint, const K &k, insert_commit_data &data) const
+   {
+      const value_compare &comp = m_members.m_comp;
+      if(hint == this->cend() || !comp(*hint, k)){
+         const_iterator prev(hint);
+         if(hint == this->cbegin() || !comp(k, *--prev)){
+            this->priv_position_before(hint, data);
+            return;
+         }
+      }
+      this->priv_upper_bound_position(k, data);
+   }
+
+   template<class Convertible>
+   void priv_push_back(BOOST_FWD_REF(Convertible) v)
+   {
+      insert_commit_data data;
+      data.node = m_members.m_rightmost;
+      data.position = data.node ? data.node->m_count : 0u;
+      this->priv_insert_commit(data, boost::forward<Convertible>(v));
+   }
+
+   node_ptr priv_allocate_node(bool leaf)
+   {
+      node_ptr n;
+      if(leaf){
+         leaf_allocator_type a(this->priv_alloc());
+         n = leaf_allocator_traits::allocate(a, 1u);
+         ::new(static_cast<void*>(container_detail::to_raw_pointer(n)), boost_container_new_t()) leaf_node_t;
+      }
+      else{
+         internal_allocator_type a(this->priv_alloc());
+         const internal_node_ptr in(internal_allocator_traits::allocate(a, 1u));
+         ::new(static_cast<void*>(container_detail::to_raw_pointer(in)), boost_container_new_t()) internal_node_t;
+         n = in;
+      }
+      n->m_parent   = node_ptr();
+      n->m_position = 0u;
+      n->m_count    = 0u;
+      n->m_leaf     = leaf;
+      return n;
+   }
+
+   void priv_deallocate_node(const node_ptr &n)
+   {
+      if(n->m_leaf){
+         leaf_allocator_type a(this->priv_alloc());
+         leaf_allocator_traits::deallocate(a, n, 1u);
+      }
+      else{
+         internal_allocator_type a(this->priv_alloc());
+         internal_allocator_traits::deallocate
+            (a, boost::intrusive::pointer_traits<internal_node_ptr>::static_cast_from(n), 1u);
+      }
+   }
+
+   void priv_destroy_subtree(const node_ptr &n)
+   {
+      if(!n->m_leaf){
+         for(size_type i = 0; i <= n->m_count; ++i){
+            this->priv_destroy_subtree(n->child(i));
+         }
+      }
+      data_allocator_type a(this->priv_alloc());
+      internal_type *const vals = n->values();
+      for(size_type i = 0; i != n->m_count; ++i){
+         data_allocator_traits::destroy(a, vals + i);
+      }
+      this->priv_deallocate_node(n);
+   }
+
+   //Values are relocated between slots: moved to an uninitialized slot and destroyed.
+   //Move constructors shouldn't throw, otherwise the container could be left inconsistent.
+   static void priv_relocate(data_allocator_type &a, internal_type *dst, internal_type *src)
+   {
+      data_allocator_traits::construct(a, dst, ::boost::move(*src));
+      data_allocator_traits::destroy(a, src);
+   }
+
+   //Relocates n values to a lower (or non-overlapping) address
+   static void priv_relocate_left(data_allocator_type &a, internal_type *dst, internal_type *src, size_type n)
+   {
+      for(size_type i = 0; i != n; ++i){
+         priv_relocate(a, dst + i, src + i);
+      }
+   }
+
+   //Relocates n values to a higher address
+   static void priv_relocate_right(data_allocator_type &a, internal_type *dst, internal_type *src, size_type n)
+   {
+      while(n){
+         --n;
+         priv_relocate(a, dst + n, src + n);
+      }
+   }
+
+   //Stores child c in the slot pos of the internal node n
+   static void priv_set_child(const node_ptr &n, size_type pos, const node_ptr &c)
+   {
+      n->child(pos) = c;
+      c->m_parent = n;
+      c->m_position = static_cast<unsigned char>(pos);
+   }
+
+   template<class Convertible>
+   iterator priv_insert_commit(insert_commit_data &data, BOOST_FWD_REF(Convertible) v)
+   {
+      const bool was_empty = !m_members.m_root;
+      if(was_empty){
+         m_members.m_root = m_members.m_leftmost = m_members.m_rightmost = this->priv_allocate_node(true);
+         data.node = m_members.m_root;
+         data.position = 0u;
+      }
+      node_ptr n(data.node);
+      size_type pos(data.position);
+      BOOST_ASSERT(n->m_leaf);
+      if(n->m_count == node_capacity){
+         this->priv_split(n, pos);
+      }
+      data_allocator_type a(this->priv_alloc());
+      internal_type *const vals = n->values();
+      priv_relocate_right(a, vals + pos + 1u, vals + pos, n->m_count - pos);
+      BOOST_TRY{
+         data_allocator_traits::construct(a, vals + pos, boost::forward<Convertible>(v));
+      }
+      BOOST_CATCH(...){
+         priv_relocate_left(a, vals + pos, vals + pos + 1u, n->m_count - pos);
+         if(was_empty){
+            this->priv_deallocate_node(m_members.m_root);
+            m_members.m_root = m_members.m_leftmost = m_members.m_rightmost = node_ptr();
+         }
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      ++n->m_count;
+      ++m_members.m_size;
+      return iterator(n, pos);
+   }
+
+   //Splits the full node n to make room for a new value at position pos and,
+   //for internal nodes, a new child at position pos + 1. The parent is split
+   //first if it's also full. On return n and pos designate the node and the
+   //position that receive the new value. Both halves keep at least one value.
+   //When inserting at either end of the node most values stay in the node,
+   //so ordered insertions fill nodes almost completely.
+   void priv_split(node_ptr &n, size_type &pos)
+   {
+      BOOST_ASSERT(n->m_count == node_capacity);
+      //Allocate the new sibling before the parent is modified
+      const node_ptr right(this->priv_allocate_node(n->m_leaf));
+      node_ptr parent(n->m_parent);
+      BOOST_TRY{
+         if(!parent){
+            parent = this->priv_allocate_node(false);
+            priv_set_child(parent, 0u, n);
+            m_members.m_root = parent;
+         }
+         else if(parent->m_count == node_capacity){
+            size_type ppos = n->m_position;
+            this->priv_split(parent, ppos);
+         }
+      }
+      BOOST_CATCH(...){
+         this->priv_deallocate_node(right);
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+
+      const size_type split = pos == node_capacity ? node_capacity - 2u
+                            : pos == 0u            ? 1u
+                            : node_capacity/2u;
+      const size_type moved = node_capacity - split - 1u;
+      data_allocator_type a(this->priv_alloc());
+      internal_type *const vals = n->values();
+      //Values after the median go to the right sibling
+      priv_relocate_left(a, right->values(), vals + split + 1u, moved);
+      if(!n->m_leaf){
+         for(size_type i = 0; i <= moved; ++i){
+            priv_set_child(right, i, n->child(split + 1u + i));
+         }
+      }
+      right->m_count = static_cast<unsigned char>(moved);
+      //The median goes up to the parent, followed by the right sibling
+      const size_type ppos = n->m_position;
+      internal_type *const pvals = parent->values();
+      const size_type pcount = parent->m_count;
+      priv_relocate_right(a, pvals + ppos + 1u, pvals + ppos, pcount - ppos);
+      priv_relocate(a, pvals + ppos, vals + split);
+      for(size_type i = pcount + 1u; i > ppos + 1u; --i){
+         priv_set_child(parent, i, parent->child(i - 1u));
+      }
+      priv_set_child(parent, ppos + 1u, right);
+      parent->m_count = static_cast<unsigned char>(pcount + 1u);
+      n->m_count = static_cast<unsigned char>(split);
+      if(n == m_members.m_rightmost){
+         m_members.m_rightmost = right;
+      }
+      if(pos > split){
+         n = right;
+         pos -= split + 1u;
+      }
+   }
+
+   //Restores the minimum occupancy of the ancestors of leaf n after an erasure,
+   //merging nodes with a sibling or refilling them from one. (tn, tpos) is a
+   //position (a value or past the last value of a leaf) that is updated to
+   //designate the same place when values are moved.
+   void priv_rebalance_after_erase(node_ptr n, node_ptr &tn, size_type &tpos)
+   {
+      while(n != m_members.m_root && n->m_count < node_min_count){
+         const node_ptr parent(n->m_parent);
+         const size_type p = n->m_position;
+         const node_ptr left (p ? parent->child(p - 1u) : node_ptr());
+         const node_ptr right(p < parent->m_count ? parent->child(p + 1u) : node_ptr());
+         if(left && size_type(left->m_count + n->m_count) < node_capacity){
+            this->priv_merge(parent, p - 1u, tn, tpos);
+         }
+         else if(right && size_type(n->m_count + right->m_count) < node_capacity){
+            this->priv_merge(parent, p, tn, tpos);
+         }
+         //Merging is impossible, so the fuller sibling has values to spare
+         else if(left && (!right || left->m_count >= right->m_count)){
+            this->priv_rotate_right(parent, p - 1u, size_type(left->m_count - n->m_count)/2u, tn, tpos);
+            return;
+         }
+         else{
+            this->priv_rotate_left(parent, p, size_type(right->m_count - n->m_count)/2u, tn, tpos);
+            return;
+         }
+         n = parent;
+      }
+      //An empty root is removed: the tree is empty or one level shorter
+      const node_ptr root(m_members.m_root);
+      if(!root->m_count){
+         if(root->m_leaf){
+            m_members.m_root = m_members.m_leftmost = m_members.m_rightmost = node_ptr();
+         }
+         else{
+            m_members.m_root = root->child(0u);
+            m_members.m_root->m_parent = node_ptr();
+            m_members.m_root->m_position = 0u;
+         }
+         this->priv_deallocate_node(root);
+      }
+   }
+
+   //Merges child k + 1 of parent and the separator k into child k
+   void priv_merge(const node_ptr &parent, size_type k, node_ptr &tn, size_type &tpos)
+   {
+      const node_ptr left (parent->child(k));
+      const node_ptr right(parent->child(k + 1u));
+      const size_type lcount = left->m_count;
+      const size_type rcount = right->m_count;
+      const size_type pcount = parent->m_count;
+      data_allocator_type a(this->priv_alloc());
+      internal_type *const lvals = left->values();
+      internal_type *const pvals = parent->values();
+      priv_relocate(a, lvals + lcount, pvals + k);
+      priv_relocate_left(a, lvals + lcount + 1u, right->values(), rcount);
+      if(!left->m_leaf){
+         for(size_type i = 0; i <= rcount; ++i){
+            priv_set_child(left, lcount + 1u + i, right->child(i));
+         }
+      }
+      left->m_count = static_cast<unsigned char>(lcount + 1u + rcount);
+      //Remove the separator and the right child from the parent
+      priv_relocate_left(a, pvals + k, pvals + k + 1u, pcount - k - 1u);
+      for(size_type i = k + 1u; i != pcount; ++i){
+         priv_set_child(parent, i, parent->child(i + 1u));
+      }
+      parent->m_count = static_cast<unsigned char>(pcount - 1u);
+
+      if(tn == right){
+         tn = left;
+         tpos += lcount + 1u;
+      }
+      else if(tn == parent){
+         if(tpos == k){
+            tn = left;
+            tpos = lcount;
+         }
+         else if(tpos > k){
+            --tpos;
+         }
+      }
+      if(right == m_members.m_rightmost){
+         m_members.m_rightmost = left;
+      }
+      this->priv_deallocate_node(right);
+   }
+
+   //Moves cnt values from child k of parent, through the separator k, to child k + 1
+   void priv_rotate_right(const node_ptr &parent, size_type k, size_type cnt, node_ptr &tn, size_type &tpos)
+   {
+      BOOST_ASSERT(cnt);
+      const node_ptr left (parent->child(k));
+      const node_ptr right(parent->child(k + 1u));
+      const size_type lcount = left->m_count;
+      const size_type rcount = right->m_count;
+      const size_type new_lcount = lcount - cnt;
+      data_allocator_type a(this->priv_alloc());
+      internal_type *const lvals = left->values();
+      internal_type *const rvals = right->values();
+      internal_type *const pvals = parent->values();
+      priv_relocate_right(a, rvals + cnt, rvals, rcount);
+      priv_relocate(a, rvals + cnt - 1u, pvals + k);
+      priv_relocate_left(a, rvals, lvals + new_lcount + 1u, cnt - 1u);
+      priv_relocate(a, pvals + k, lvals + new_lcount);
+      if(!right->m_leaf){
+         for(size_type i = rcount + 1u; i; --i){
+            priv_set_child(right, i - 1u + cnt, right->child(i - 1u));
+         }
+         for(size_type i = 0; i != cnt; ++i){
+            priv_set_child(right, i, left->child(new_lcount + 1u + i));
+         }
+      }
+      left->m_count  = static_cast<unsigned char>(new_lcount);
+      right->m_count = static_cast<unsigned char>(rcount + cnt);
+
+      if(tn == right){
+         tpos += cnt;
+      }
+      else if(tn == parent && tpos == k){
+         tn = right;
+         tpos = cnt - 1u;
+      }
+      else if(tn == left && tpos >= new_lcount){
+         if(tpos == new_lcount){
+            tn = parent;
+            tpos = k;
+         }
+         else{
+            tn = right;
+            tpos -= new_lcount + 1u;
+         }
+      }
+   }
+
+   //Moves cnt values from child k + 1 of parent, through the separator k, to child k
+   void priv_rotate_left(const node_ptr &parent, size_type k, size_type cnt, node_ptr &tn, size_type &tpos)
+   {
+      BOOST_ASSERT(cnt);
+      const node_ptr left (parent->child(k));
+      const node_ptr right(parent->child(k + 1u));
+      const size_type lcount = left->m_count;
+      const size_type rcount = right->m_count;
+      data_allocator_type a(this->priv_alloc());
+      internal_type *const lvals = left->values();
+      internal_type *const rvals = right->values();
+      internal_type *const pvals = parent->values();
+      priv_relocate(a, lvals + lcount, pvals + k);
+      priv_relocate_left(a, lvals + lcount + 1u, rvals, cnt - 1u);
+      priv_relocate(a, pvals + k, rvals + cnt - 1u);
+      priv_relocate_left(a, rvals, rvals + cnt, rcount - cnt);
+      if(!left->m_leaf){
+         for(size_type i = 0; i != cnt; ++i){
+            priv_set_child(left, lcount + 1u + i, right->child(i));
+         }
+         for(size_type i = 0; i <= rcount - cnt; ++i){
+            priv_set_child(right, i, right->child(i + cnt));
+         }
+      }
+      left->m_count  = static_cast<unsigned char>(lcount + cnt);
+      right->m_count = static_cast<unsigned char>(rcount - cnt);
+
+      if(tn == parent && tpos == k){
+         tn = left;
+         tpos = lcount;
+      }
+      else if(tn == right){
+         if(tpos < cnt - 1u){
+            tn = left;
+            tpos += lcount + 1u;
+         }
+         else if(tpos == cnt - 1u){
+            tn = parent;
+            tpos = k;
+         }
+         else{
+            tpos -= cnt;
+         }
+      }
+   }
+
+   static void priv_construct_value(data_allocator_type &a, internal_type *dst, const internal_type &src, false_type)
+   {  data_allocator_traits::construct(a, dst, src);  }
+
+   static void priv_construct_value(data_allocator_type &a, internal_type *dst, const internal_type &src, true_type)
+   {  data_allocator_traits::construct(a, dst, ::boost::move(const_cast<internal_type&>(src)));  }
+
+   //Copies (or moves) the subtree rooted at src, keeping its shape
+   template<class DoMove>
+   node_ptr priv_clone_subtree(const node_ptr &src, DoMove do_move)
+   {
+      const node_ptr n(this->priv_allocate_node(src->m_leaf));
+      data_allocator_type a(this->priv_alloc());
+      internal_type *const vals = n->values();
+      const internal_type *const src_vals = src->values();
+      size_type values = 0u, children = 0u;
+      BOOST_TRY{
+         for(; values != src->m_count; ++values){
+            priv_construct_value(a, vals + values, src_vals[values], do_move);
+         }
+         if(!src->m_leaf){
+            for(; children <= src->m_count; ++children){
+               priv_set_child(n, children, this->priv_clone_subtree(src->child(children), do_move));
+            }
+         }
+      }
+      BOOST_CATCH(...){
+         for(size_type i = 0; i != children; ++i){
+            this->priv_destroy_subtree(n->child(i));
+         }
+         for(size_type i = 0; i != values; ++i){
+            data_allocator_traits::destroy(a, vals + i);
+         }
+         this->priv_deallocate_node(n);
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      n->m_count = src->m_count;
+      return n;
+   }
+
+   template<class DoMove>
+   void priv_clone_from(const tree &x, DoMove do_move)
+   {
+      BOOST_ASSERT(!m_members.m_root);
+      if(x.m_members.m_root){
+         const node_ptr root(this->priv_clone_subtree(x.m_members.m_root, do_move));
+         node_ptr n(root);
+         while(!n->m_leaf){
+            n = n->child(0u);
+         }
+         m_members.m_leftmost = n;
+         n = root;
+         while(!n->m_leaf){
+            n = n->child(n->m_count);
+         }
+         m_members.m_rightmost = n;
+         m_members.m_root = root;
+         m_members.m_size = x.m_members.m_size;
+      }
+   }
+
+   void priv_steal(tree &x)
+   {
+      m_members.m_root      = x.m_members.m_root;
+      m_members.m_leftmost  = x.m_members.m_leftmost;
+      m_members.m_rightmost = x.m_members.m_rightmost;
+      m_members.m_size      = x.m_members.m_size;
+      x.m_members.m_root = x.m_members.m_leftmost = x.m_members.m_rightmost = node_ptr();
+      x.m_members.m_size = 0u;
+   }
+
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+
+   friend bool operator==(const tree& x, const tree& y)
+   {  return x.size() == y.size() && ::boost::container::algo_equal(x.begin(), x.end(), y.begin());  }
+
+   friend bool operator<(const tree& x, const tree& y)
+   {  return ::boost::container::algo_lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());  }
+
+   friend bool operator!=(const tree& x, const tree& y)
+   {  return !(x == y);  }
+
+   friend std::size_t hash_value(const tree& x)
+   {  return container_detail::hash_range(x.begin(), x.end());  }
+
+   friend bool operator>(const tree& x, const tree& y)
+   {  return y < x;  }
+
+   friend bool operator<=(const tree& x, const tree& y)
+   {  return !(y < x);  }
+
+   friend bool operator>=(const tree& x, const tree& y)
+   {  return !(x < y);  }
+
+   friend void swap(tree& x, tree& y)
+   {  x.swap(y);  }
+};
+
+} //namespace container_detail {
+} //namespace container {
+} //namespace boost  {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif //BOOST_CONTAINER_BTREE_HPP
@@ -925,6 +925,27 @@ inline typename container_detail::enable_if_memtransfer_copy_assignable<I, F, I>
    move_n_source(I f, typename boost::container::iterator_traits<I>::difference_type n, F r) BOOST_NOEXCEPT_OR_NOTHROW
 {  return container_detail::memmove_n_source(f, n, r); }
 
+//////////////////////////////////////////////////////////////////////////////
+//
+//                         uninitialized_relocate_n
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//! <b>Requires</b>: T is trivially relocatable (see is_trivially_relocatable).
+//!
+//! <b>Effects</b>: Moves the objects of [f, f + n) to the uninitialized [r, r + n) copying their bytes.
+//!   Ranges can overlap. [f, f + n) is left uninitialized, no destructor is called.
+//!
+//! <b>Returns</b>: r + n
+template<typename T>
+inline T *uninitialized_relocate_n(T *f, std::size_t n, T *r) BOOST_NOEXCEPT_OR_NOTHROW
+{
+   if(n){
+      std::memmove(static_cast<void*>(r), static_cast<const void*>(f), sizeof(T)*n);
+   }
+   return r + n;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 //
 //                               destroy_alloc_n
@@ -322,6 +322,26 @@ class allocator_destroyer
    }
 };
 
+//Destroys the element but does not deallocate the node,
+//used when all nodes are deallocated at once afterwards
+template <class Allocator>
+class allocator_node_destroyer
+{
+   typedef boost::container::allocator_traits<Allocator> AllocTraits;
+   typedef typename AllocTraits::pointer    pointer;
+
+   private:
+   Allocator & a_;
+
+   public:
+   explicit allocator_node_destroyer(Allocator &a)
+      : a_(a)
+   {}
+
+   void operator()(const pointer &p)
+   {  AllocTraits::destroy(a_, container_detail::to_raw_pointer(p));  }
+};
+
 template <class Allocator>
 class allocator_destroyer_and_chain_builder
 {
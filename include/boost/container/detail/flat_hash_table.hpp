@@ -0,0 +1,1026 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_FLAT_HASH_TABLE_HPP
+#define BOOST_CONTAINER_FLAT_HASH_TABLE_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/container_fwd.hpp>
+// container/detail
+#include <boost/container/detail/alloc_helpers.hpp>
+#include <boost/container/detail/destroyers.hpp>
+#include <boost/container/detail/hash.hpp>
+#include <boost/container/detail/iterator.hpp>
+#include <boost/container/detail/iterators.hpp>
+#include <boost/container/detail/math_functions.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/pair.hpp>
+#include <boost/container/detail/to_raw_pointer.hpp>
+#include <boost/container/detail/type_traits.hpp>
+// intrusive
+#include <boost/intrusive/pointer_traits.hpp>
+// move
+#include <boost/move/utility_core.hpp>
+#include <boost/move/adl_move_swap.hpp>
+#if defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+#include <boost/move/detail/fwd_macros.hpp>
+#endif
+// other
+#include <boost/core/no_exceptions_support.hpp>
+#include <boost/assert.hpp>
+// std
+#include <climits>
+#include <cstring>   //std::memset, std::memcpy
+
+//Control bytes are probed 16 at a time with SSE2 when available. Define
+//BOOST_CONTAINER_FLAT_HASH_NO_SIMD to force the portable implementation.
+#if !defined(BOOST_CONTAINER_FLAT_HASH_NO_SIMD) && \
+    (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#  define BOOST_CONTAINER_FLAT_HASH_SSE2
+#  include <emmintrin.h>
+#endif
+
+#if defined(BOOST_MSVC)
+#  include <intrin.h>
+#endif
+
+namespace boost {
+namespace container {
+namespace container_detail {
+
+//The table is an open addressing hash table that stores elements in a flat
+//array of slots and keeps a parallel array of one-byte control words:
+//
+// - 0x80 (empty):    the slot never held an element since the last rehash.
+// - 0xFE (deleted):  the slot held an element that was erased (tombstone).
+// - 0xFF (sentinel): one past the last slot, stops iteration.
+// - 0x00-0x7F:       the slot is full, the byte holds 7 bits (H2) of the hash.
+//
+//Slots are grouped in aligned groups of 16. The remaining bits of the hash (H1)
+//select the first group to inspect and groups are probed with a triangular
+//sequence, which visits every group of a power of two table. A group is
+//compared against H2 in a single SSE2 instruction, so most lookups touch one
+//group of control bytes and a single slot. Probing stops at the first group
+//that contains an empty slot.
+enum flat_hash_ctrl_t
+{
+   flat_hash_ctrl_empty    = 0x80,
+   flat_hash_ctrl_deleted  = 0xFE,
+   flat_hash_ctrl_sentinel = 0xFF
+};
+
+static const std::size_t flat_hash_group_width = 16u;
+
+inline unsigned flat_hash_ctz(unsigned mask)
+{
+   BOOST_ASSERT(mask != 0);
+   #if defined(__GNUC__)
+   return unsigned(__builtin_ctz(mask));
+   #elif defined(BOOST_MSVC)
+   unsigned long r;
+   _BitScanForward(&r, mask);
+   return unsigned(r);
+   #else
+   unsigned n = 0;
+   while(!(mask & 1u)){
+      mask >>= 1u;
+      ++n;
+   }
+   return n;
+   #endif
+}
+
+//A group of flat_hash_group_width control bytes. Matching functions return a
+//bitmask where bit i is set if the control byte i of the group matches.
+class flat_hash_group
+{
+   public:
+   explicit flat_hash_group(const unsigned char *ctrl)
+   #if defined(BOOST_CONTAINER_FLAT_HASH_SSE2)
+      : m_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))
+   #else
+      : m_ctrl(ctrl)
+   #endif
+   {}
+
+   unsigned match(unsigned char h2) const
+   {
+      #if defined(BOOST_CONTAINER_FLAT_HASH_SSE2)
+      return unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(h2)), m_ctrl)));
+      #else
+      unsigned mask = 0u;
+      for(std::size_t i = 0; i != flat_hash_group_width; ++i){
+         mask |= unsigned(m_ctrl[i] == h2) << i;
+      }
+      return mask;
+      #endif
+   }
+
+   unsigned match_empty() const
+   {  return this->match(static_cast<unsigned char>(flat_hash_ctrl_empty));  }
+
+   //Empty and deleted slots are the only ones with the high bit set
+   //(the sentinel is never part of a group)
+   unsigned match_empty_or_deleted() const
+   {
+      #if defined(BOOST_CONTAINER_FLAT_HASH_SSE2)
+      return unsigned(_mm_movemask_epi8(m_ctrl));
+      #else
+      unsigned mask = 0u;
+      for(std::size_t i = 0; i != flat_hash_group_width; ++i){
+         mask |= unsigned(m_ctrl[i] >> 7u) << i;
+      }
+      return mask;
+      #endif
+   }
+
+   private:
+   #if defined(BOOST_CONTAINER_FLAT_HASH_SSE2)
+   __m128i m_ctrl;
+   #else
+   const unsigned char *m_ctrl;
+   #endif
+};
+
+//Maps are stored as container_detail::pair<Key, T> so that they can be
+//moved in C++03 and reinterpreted as std::pair<Key, T> by iterators
+template<class T>
+struct flat_hash_internal_data_type
+{
+   typedef T type;
+};
+
+template<class T1, class T2>
+struct flat_hash_internal_data_type< std::pair<T1, T2> >
+{
+   typedef pair<T1, T2> type;
+};
+
+template<class SlotPointer, class Value, bool IsConst>
+class flat_hash_iterator
+{
+   typedef boost::intrusive::pointer_traits<SlotPointer>                            slot_ptr_traits;
+
+   public:
+   typedef std::forward_iterator_tag                                                iterator_category;
+   typedef Value                                                                    value_type;
+   typedef typename slot_ptr_traits::difference_type                                difference_type;
+   typedef typename if_c
+      < IsConst
+      , typename slot_ptr_traits::template rebind_pointer<const Value>::type
+      , typename slot_ptr_traits::template rebind_pointer<Value>::type
+      >::type                                                                       pointer;
+   typedef typename boost::intrusive::pointer_traits<pointer>::reference            reference;
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   const unsigned char *m_ctrl;
+   SlotPointer m_slot;
+
+   public:
+   //Points to ctrl/slot and skips free slots
+   flat_hash_iterator(const unsigned char *ctrl, SlotPointer slot) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_ctrl(ctrl), m_slot(slot)
+   {  this->priv_skip_free();  }
+
+   const unsigned char *get_ctrl() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_ctrl;  }
+
+   const SlotPointer &get_slot() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_slot;  }
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   flat_hash_iterator() BOOST_NOEXCEPT_OR_NOTHROW
+      : m_ctrl(), m_slot()   //Value initialization to achieve "null iterators" (N3644)
+   {}
+
+   flat_hash_iterator(flat_hash_iterator<SlotPointer, Value, false> const& other) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_ctrl(other.get_ctrl()), m_slot(other.get_slot())
+   {}
+
+   reference operator*() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return *reinterpret_cast<typename if_c<IsConst, const Value, Value>::type *>(container_detail::to_raw_pointer(m_slot));  }
+
+   pointer operator->() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return ::boost::intrusive::pointer_traits<pointer>::pointer_to(this->operator*());  }
+
+   flat_hash_iterator& operator++() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      ++m_ctrl;
+      ++m_slot;
+      this->priv_skip_free();
+      return *this;
+   }
+
+   flat_hash_iterator operator++(int) BOOST_NOEXCEPT_OR_NOTHROW
+   {  flat_hash_iterator tmp(*this); ++*this; return tmp;  }
+
+   friend bool operator== (const flat_hash_iterator& l, const flat_hash_iterator& r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_ctrl == r.m_ctrl;  }
+
+   friend bool operator!= (const flat_hash_iterator& l, const flat_hash_iterator& r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_ctrl != r.m_ctrl;  }
+
+   private:
+   void priv_skip_free() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(m_ctrl){
+         while(*m_ctrl == flat_hash_ctrl_empty || *m_ctrl == flat_hash_ctrl_deleted){
+            ++m_ctrl;
+            ++m_slot;
+         }
+      }
+   }
+};
+
+template <class Key, class Value, class KeyOfValue,
+          class Hash, class Pred, class Allocator>
+class flat_hash_table
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   typedef typename flat_hash_internal_data_type<Value>::type                       internal_type;
+   typedef allocator_traits<Allocator>                                              value_allocator_traits;
+   typedef typename value_allocator_traits::template
+      portable_rebind_alloc<internal_type>::type                                    slot_allocator_type;
+   typedef allocator_traits<slot_allocator_type>                                    slot_allocator_traits;
+   typedef typename slot_allocator_traits::pointer                                  slot_pointer;
+   typedef typename value_allocator_traits::template
+      portable_rebind_alloc<unsigned char>::type                                    ctrl_allocator_type;
+   typedef allocator_traits<ctrl_allocator_type>                                    ctrl_allocator_traits;
+   typedef typename ctrl_allocator_traits::pointer                                  ctrl_pointer;
+   typedef flat_hash_table<Key, Value, KeyOfValue, Hash, Pred, Allocator>          ThisType;
+   BOOST_COPYABLE_AND_MOVABLE(flat_hash_table)
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   typedef Key                                                                      key_type;
+   typedef Value                                                                    value_type;
+   typedef Hash                                                                     hasher;
+   typedef Pred                                                                     key_equal;
+   typedef Allocator                                                                allocator_type;
+   typedef Allocator                                                                stored_allocator_type;
+   typedef typename value_allocator_traits::pointer                                 pointer;
+   typedef typename value_allocator_traits::const_pointer                           const_pointer;
+   typedef typename value_allocator_traits::reference                               reference;
+   typedef typename value_allocator_traits::const_reference                         const_reference;
+   typedef typename value_allocator_traits::size_type                               size_type;
+   typedef typename value_allocator_traits::difference_type                         difference_type;
+   typedef flat_hash_iterator<slot_pointer, value_type, false>                      iterator;
+   typedef flat_hash_iterator<slot_pointer, value_type, true >                      const_iterator;
+   typedef internal_type                                                            movable_value_type;
+
+   //Position of an element or of the slot where an element can be inserted
+   struct insert_commit_data
+   {
+      std::size_t hash;
+      size_type   position;
+   };
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   struct members_holder
+      : public Allocator
+   {
+      members_holder()
+         : Allocator(), m_ctrl(), m_slots(), m_capacity(0u), m_size(0u)
+         , m_growth_left(0u), m_hasher(), m_key_eq()
+      {}
+
+      template<class AllocConvertible>
+      members_holder(BOOST_FWD_REF(AllocConvertible) a, const hasher &hf, const key_equal &eql)
+         : Allocator(boost::forward<AllocConvertible>(a)), m_ctrl(), m_slots(), m_capacity(0u), m_size(0u)
+         , m_growth_left(0u), m_hasher(hf), m_key_eq(eql)
+      {}
+
+      ctrl_pointer   m_ctrl;
+      slot_pointer   m_slots;
+      size_type      m_capacity;
+      size_type      m_size;
+      size_type      m_growth_left;
+      hasher         m_hasher;
+      key_equal      m_key_eq;
+   } m_members;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+
+   flat_hash_table()
+      : m_members()
+   {}
+
+   explicit flat_hash_table(const allocator_type& a)
+      : m_members(a, hasher(), key_equal())
+   {}
+
+   flat_hash_table(size_type n, const hasher &hf, const key_equal &eql, const allocator_type& a)
+      : m_members(a, hf, eql)
+   {  this->reserve(n);  }
+
+   flat_hash_table(const flat_hash_table& x)
+      : m_members( value_allocator_traits::select_on_container_copy_construction(x.m_members)
+                 , x.m_members.m_hasher, x.m_members.m_key_eq)
+   {  this->priv_copy_from(x);  }
+
+   flat_hash_table(BOOST_RV_REF(flat_hash_table) x)
+      : m_members(boost::move(static_cast<Allocator&>(x.m_members)), x.m_members.m_hasher, x.m_members.m_key_eq)
+   {  this->priv_steal(x);  }
+
+   flat_hash_table(const flat_hash_table& x, const allocator_type &a)
+      : m_members(a, x.m_members.m_hasher, x.m_members.m_key_eq)
+   {  this->priv_copy_from(x);  }
+
+   flat_hash_table(BOOST_RV_REF(flat_hash_table) x, const allocator_type &a)
+      : m_members(a, x.m_members.m_hasher, x.m_members.m_key_eq)
+   {
+      if(this->priv_alloc() == x.priv_alloc()){
+         this->priv_steal(x);
+      }
+      else{
+         this->priv_move_elements_from(x);
+      }
+   }
+
+   ~flat_hash_table()
+   {  this->priv_destroy_and_deallocate();  }
+
+   flat_hash_table& operator=(BOOST_COPY_ASSIGN_REF(flat_hash_table) x)
+   {
+      if (&x != this){
+         this->priv_destroy_and_deallocate();
+         //Transfer allocator if needed
+         container_detail::bool_<value_allocator_traits::
+            propagate_on_container_copy_assignment::value> flag;
+         container_detail::assign_alloc(this->priv_alloc(), x.priv_alloc(), flag);
+         m_members.m_hasher = x.m_members.m_hasher;
+         m_members.m_key_eq = x.m_members.m_key_eq;
+         this->priv_copy_from(x);
+      }
+      return *this;
+   }
+
+   flat_hash_table& operator=(BOOST_RV_REF(flat_hash_table) x)
+      BOOST_NOEXCEPT_IF(  value_allocator_traits::is_always_equal::value
+                                 && boost::container::container_detail::is_nothrow_move_assignable<Hash>::value
+                                 && boost::container::container_detail::is_nothrow_move_assignable<Pred>::value )
+   {
+      BOOST_ASSERT(this != &x);
+      const bool propagate_alloc = value_allocator_traits::propagate_on_container_move_assignment::value;
+      const bool allocators_equal = this->priv_alloc() == x.priv_alloc(); (void)allocators_equal;
+      this->priv_destroy_and_deallocate();
+      m_members.m_hasher = boost::move(x.m_members.m_hasher);
+      m_members.m_key_eq = boost::move(x.m_members.m_key_eq);
+      //If allocators are equal we can just swap pointers
+      if(propagate_alloc || allocators_equal){
+         container_detail::bool_<value_allocator_traits::
+            propagate_on_container_move_assignment::value> flag;
+         container_detail::move_alloc(this->priv_alloc(), x.priv_alloc(), flag);
+         this->priv_steal(x);
+      }
+      else{
+         this->priv_move_elements_from(x);
+      }
+      return *this;
+   }
+
+   public:
+   // accessors:
+   hasher hash_function() const
+   {  return m_members.m_hasher;  }
+
+   key_equal key_eq() const
+   {  return m_members.m_key_eq;  }
+
+   allocator_type get_allocator() const
+   {  return this->priv_alloc();  }
+
+   const stored_allocator_type &get_stored_allocator() const
+   {  return this->priv_alloc();  }
+
+   stored_allocator_type &get_stored_allocator()
+   {  return this->priv_alloc();  }
+
+   iterator begin()
+   {  return iterator(this->priv_raw_ctrl(), m_members.m_slots);  }
+
+   const_iterator begin() const
+   {  return this->cbegin();  }
+
+   iterator end()
+   {  return iterator(this->priv_raw_ctrl_end(), this->priv_slot_end());  }
+
+   const_iterator end() const
+   {  return this->cend();  }
+
+   const_iterator cbegin() const
+   {  return const_iterator(this->priv_raw_ctrl(), m_members.m_slots);  }
+
+   const_iterator cend() const
+   {  return const_iterator(this->priv_raw_ctrl_end(), this->priv_slot_end());  }
+
+   bool empty() const
+   {  return !m_members.m_size;  }
+
+   size_type size() const
+   {  return m_members.m_size;  }
+
+   size_type max_size() const
+   {
+      const slot_allocator_type a(this->priv_alloc());
+      return slot_allocator_traits::max_size(a)/8u*7u;
+   }
+
+   size_type capacity() const
+   {  return m_members.m_capacity - m_members.m_capacity/8u;  }
+
+   size_type bucket_count() const
+   {  return m_members.m_capacity;  }
+
+   float load_factor() const
+   {  return m_members.m_capacity ? float(m_members.m_size)/float(m_members.m_capacity) : 0.0f;  }
+
+   float max_load_factor() const
+   {  return 0.875f;  }
+
+   void swap(ThisType& x)
+      BOOST_NOEXCEPT_IF(  value_allocator_traits::is_always_equal::value
+                                 && boost::container::container_detail::is_nothrow_swappable<Hash>::value
+                                 && boost::container::container_detail::is_nothrow_swappable<Pred>::value )
+   {
+      container_detail::bool_<value_allocator_traits::propagate_on_container_swap::value> flag;
+      container_detail::swap_alloc(this->priv_alloc(), x.priv_alloc(), flag);
+      boost::adl_move_swap(m_members.m_ctrl,        x.m_members.m_ctrl);
+      boost::adl_move_swap(m_members.m_slots,       x.m_members.m_slots);
+      boost::adl_move_swap(m_members.m_capacity,    x.m_members.m_capacity);
+      boost::adl_move_swap(m_members.m_size,        x.m_members.m_size);
+      boost::adl_move_swap(m_members.m_growth_left, x.m_members.m_growth_left);
+      boost::adl_move_swap(m_members.m_hasher,      x.m_members.m_hasher);
+      boost::adl_move_swap(m_members.m_key_eq,      x.m_members.m_key_eq);
+   }
+
+   public:
+
+   std::pair<iterator,bool> insert_unique_check(const key_type& key, insert_commit_data &data)
+   {
+      data.hash = this->priv_hash(key);
+      std::pair<size_type, bool> r(0u, false);
+      if(m_members.m_capacity){
+         r = this->priv_find_or_prepare(key, data.hash);
+      }
+      data.position = r.first;
+      return std::pair<iterator,bool>(r.second ? this->priv_iterator(r.first) : this->end(), !r.second);
+   }
+
+   template<class MovableConvertible>
+   iterator insert_unique_commit(BOOST_FWD_REF(MovableConvertible) v, insert_commit_data &data)
+   {
+      this->priv_prepare_commit(data);
+      slot_allocator_type a(this->priv_alloc());
+      slot_allocator_traits::construct(a, this->priv_slot(data.position), boost::forward<MovableConvertible>(v));
+      this->priv_mark_full(data);
+      return this->priv_iterator(data.position);
+   }
+
+   std::pair<iterator,bool> insert_unique(const value_type& v)
+   {
+      insert_commit_data data;
+      std::pair<iterator,bool> ret = this->insert_unique_check(KeyOfValue()(v), data);
+      if(ret.second){
+         ret.first = this->insert_unique_commit(v, data);
+      }
+      return ret;
+   }
+
+   template<class MovableConvertible>
+   std::pair<iterator,bool> insert_unique(BOOST_FWD_REF(MovableConvertible) v)
+   {
+      insert_commit_data data;
+      std::pair<iterator,bool> ret = this->insert_unique_check(KeyOfValue()(v), data);
+      if(ret.second){
+         ret.first = this->insert_unique_commit(boost::forward<MovableConvertible>(v), data);
+      }
+      return ret;
+   }
+
+   iterator insert_unique(const_iterator, const value_type& v)
+   {  return this->insert_unique(v).first;  }
+
+   template<class MovableConvertible>
+   iterator insert_unique(const_iterator, BOOST_FWD_REF(MovableConvertible) v)
+   {  return this->insert_unique(boost::forward<MovableConvertible>(v)).first;  }
+
+   template <class InputIterator>
+   void insert_unique(InputIterator first, InputIterator last
+      #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+      , typename container_detail::enable_if_c
+         < container_detail::is_input_iterator<InputIterator>::value
+         >::type * = 0
+      #endif
+      )
+   {
+      for( ; first != last; ++first)
+         this->insert_unique(*first);
+   }
+
+   template <class FwdIterator>
+   void insert_unique(FwdIterator first, FwdIterator last
+      #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+      , typename container_detail::disable_if_c
+         < container_detail::is_input_iterator<FwdIterator>::value
+         >::type * = 0
+      #endif
+      )
+   {
+      //Rehash at most once: duplicated keys might make the reservation too big
+      this->reserve(this->size() + size_type(boost::container::iterator_distance(first, last)));
+      for( ; first != last; ++first)
+         this->insert_unique(*first);
+   }
+
+   #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   template <class... Args>
+   std::pair<iterator, bool> emplace_unique(BOOST_FWD_REF(Args)... args)
+   {
+      typename aligned_storage<sizeof(internal_type), alignment_of<internal_type>::value>::type v;
+      internal_type &val = *static_cast<internal_type *>(static_cast<void *>(&v));
+      slot_allocator_type a(this->priv_alloc());
+      slot_allocator_traits::construct(a, &val, ::boost::forward<Args>(args)... );
+      value_destructor<slot_allocator_type> d(a, val);
+      return this->insert_unique(::boost::move(val));
+   }
+
+   template <class... Args>
+   iterator emplace_hint_unique(const_iterator, BOOST_FWD_REF(Args)... args)
+   {  return this->emplace_unique(boost::forward<Args>(args)...).first;  }
+
+   #else // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   #define BOOST_CONTAINER_FLAT_HASH_TABLE_EMPLACE_CODE(N) \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   std::pair<iterator, bool> emplace_unique(BOOST_MOVE_UREF##N)\
+   {\
+      typename aligned_storage<sizeof(internal_type), alignment_of<internal_type>::value>::type v;\
+      internal_type &val = *static_cast<internal_type *>(static_cast<void *>(&v));\
+      slot_allocator_type a(this->priv_alloc());\
+      slot_allocator_traits::construct(a, &val BOOST_MOVE_I##N BOOST_MOVE_FWD##N);\
+      value_destructor<slot_allocator_type> d(a, val);\
+      return this->insert_unique(::boost::move(val));\
+   }\
+   \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   iterator emplace_hint_unique(const_iterator BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
+   {  return this->emplace_unique(BOOST_MOVE_FWD##N).first;  }\
+   //
+   BOOST_MOVE_ITERATE_0TO9(BOOST_CONTAINER_FLAT_HASH_TABLE_EMPLACE_CODE)
+   #undef BOOST_CONTAINER_FLAT_HASH_TABLE_EMPLACE_CODE
+
+   #endif   // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   iterator erase(const_iterator position)
+   {
+      BOOST_ASSERT(position != this->cend());
+      this->priv_erase(this->priv_position(position));
+      //Erasure never relocates elements, the next one is found from the erased slot
+      return iterator(position.get_ctrl(), position.get_slot());
+   }
+
+   size_type erase(const key_type& k)
+   {
+      if(m_members.m_capacity){
+         const std::pair<size_type, bool> r = this->priv_find_or_prepare(k, this->priv_hash(k));
+         if(r.second){
+            this->priv_erase(r.first);
+            return 1u;
+         }
+      }
+      return 0u;
+   }
+
+   iterator erase(const_iterator first, const_iterator last)
+   {
+      while(first != last){
+         first = this->erase(first);
+      }
+      return iterator(last.get_ctrl(), last.get_slot());
+   }
+
+   void clear()
+   {
+      if(m_members.m_capacity){
+         this->priv_destroy_elements();
+         std::memset(this->priv_raw_ctrl(), flat_hash_ctrl_empty, m_members.m_capacity);
+         m_members.m_size = 0u;
+      }
+      m_members.m_growth_left = m_members.m_capacity - m_members.m_capacity/8u;
+   }
+
+   iterator find(const key_type& k)
+   {
+      if(m_members.m_capacity){
+         const std::pair<size_type, bool> r = this->priv_find_or_prepare(k, this->priv_hash(k));
+         if(r.second)
+            return this->priv_iterator(r.first);
+      }
+      return this->end();
+   }
+
+   const_iterator find(const key_type& k) const
+   {  return const_cast<flat_hash_table&>(*this).find(k);  }
+
+   size_type count(const key_type& k) const
+   {  return size_type(this->find(k) != this->cend());  }
+
+   std::pair<iterator,iterator> equal_range(const key_type& k)
+   {
+      iterator i = this->find(k), e = i;
+      return std::pair<iterator,iterator>(i, i == this->end() ? i : ++e);
+   }
+
+   std::pair<const_iterator, const_iterator> equal_range(const key_type& k) const
+   {
+      const_iterator i = this->find(k), e = i;
+      return std::pair<const_iterator,const_iterator>(i, i == this->cend() ? i : ++e);
+   }
+
+   void reserve(size_type n)
+   {
+      if(n > this->capacity()){
+         this->priv_rehash(this->priv_capacity_for(n));
+      }
+   }
+
+   void rehash(size_type n)
+   {
+      if(!n && !m_members.m_size){
+         this->priv_destroy_and_deallocate();
+         return;
+      }
+      size_type new_cap = this->priv_capacity_for(m_members.m_size);
+      if(n > new_cap){
+         new_cap = upper_power_of_2(n);
+      }
+      this->priv_rehash(new_cap);
+   }
+
+   friend bool operator==(const flat_hash_table& x, const flat_hash_table& y)
+   {
+      if(x.size() != y.size())
+         return false;
+      for(const_iterator it = x.cbegin(), itend = x.cend(); it != itend; ++it){
+         const_iterator yit = y.find(KeyOfValue()(*it));
+         if(yit == y.cend() || !(*yit == *it))
+            return false;
+      }
+      return true;
+   }
+
+   friend bool operator!=(const flat_hash_table& x, const flat_hash_table& y)
+   {  return !(x == y);  }
+
+   //The hash value must not depend on the iteration order
+   friend std::size_t hash_value(const flat_hash_table& x)
+   {  return container_detail::hash_unordered_range(x.begin(), x.end());  }
+
+   friend void swap(flat_hash_table& x, flat_hash_table& y)
+   {  x.swap(y);  }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+
+   const Allocator &priv_alloc() const
+   {  return m_members;  }
+
+   Allocator &priv_alloc()
+   {  return m_members;  }
+
+   unsigned char *priv_raw_ctrl() const
+   {  return container_detail::to_raw_pointer(m_members.m_ctrl);  }
+
+   unsigned char *priv_raw_ctrl_end() const
+   {  return m_members.m_capacity ? this->priv_raw_ctrl() + m_members.m_capacity : this->priv_raw_ctrl();  }
+
+   slot_pointer priv_slot_end() const
+   {  return m_members.m_capacity ? m_members.m_slots + difference_type(m_members.m_capacity) : m_members.m_slots;  }
+
+   internal_type *priv_slot(size_type pos) const
+   {  return container_detail::to_raw_pointer(m_members.m_slots) + pos;  }
+
+   iterator priv_iterator(size_type pos) const
+   {  return iterator(this->priv_raw_ctrl() + pos, m_members.m_slots + difference_type(pos));  }
+
+   size_type priv_position(const_iterator it) const
+   {  return size_type(it.get_ctrl() - this->priv_raw_ctrl());  }
+
+   std::size_t priv_hash(const key_type &k) const
+   {
+      //Mix the upper bits into the lower ones so that both H1 and H2
+      //depend on every bit of the user-provided hash value
+      const std::size_t h = fibonacci_hash<>::mix(m_members.m_hasher(k));
+      return h ^ (h >> (sizeof(std::size_t)*CHAR_BIT/2u));
+   }
+
+   static unsigned char priv_h2(std::size_t h)
+   {  return static_cast<unsigned char>(h & 0x7Fu);  }
+
+   static size_type priv_h1(std::size_t h)
+   {  return size_type(h >> 7u);  }
+
+   //Smallest power of two slot count able to hold n elements without exceeding the maximum load
+   static size_type priv_capacity_for(size_type n)
+   {
+      size_type cap = flat_hash_group_width;
+      while(cap - cap/8u < n){
+         cap *= 2u;
+      }
+      return cap;
+   }
+
+   //Returns the position of the element equivalent to k (second == true)
+   //or the first free slot of k's probe sequence (second == false)
+   std::pair<size_type, bool> priv_find_or_prepare(const key_type &k, std::size_t h) const
+   {
+      BOOST_ASSERT(m_members.m_capacity);
+      const unsigned char h2 = priv_h2(h);
+      const unsigned char *const ctrl = this->priv_raw_ctrl();
+      const internal_type *const slots = this->priv_slot(0u);
+      const size_type group_mask = m_members.m_capacity/flat_hash_group_width - 1u;
+      size_type g = priv_h1(h) & group_mask;
+      size_type insert_pos = size_type(-1);
+      for(size_type i = 1u; ; ++i){
+         const size_type base = g*flat_hash_group_width;
+         const flat_hash_group group(ctrl + base);
+         for(unsigned m = group.match(h2); m; m &= m - 1u){
+            const size_type pos = base + flat_hash_ctz(m);
+            if(m_members.m_key_eq(k, KeyOfValue()(reinterpret_cast<const value_type&>(slots[pos])))){
+               return std::pair<size_type, bool>(pos, true);
+            }
+         }
+         if(insert_pos == size_type(-1)){
+            const unsigned m = group.match_empty_or_deleted();
+            if(m){
+               insert_pos = base + flat_hash_ctz(m);
+            }
+         }
+         if(group.match_empty()){
+            return std::pair<size_type, bool>(insert_pos, false);
+         }
+         //Triangular probing visits all groups in a power of two table
+         g = (g + i) & group_mask;
+         BOOST_ASSERT(i <= group_mask + 1u);
+      }
+   }
+
+   //First free slot of the probe sequence of h (no key comparisons)
+   size_type priv_find_first_free(std::size_t h) const
+   {
+      const unsigned char *const ctrl = this->priv_raw_ctrl();
+      const size_type group_mask = m_members.m_capacity/flat_hash_group_width - 1u;
+      size_type g = priv_h1(h) & group_mask;
+      for(size_type i = 1u; ; ++i){
+         const size_type base = g*flat_hash_group_width;
+         const unsigned m = flat_hash_group(ctrl + base).match_empty_or_deleted();
+         if(m){
+            return base + flat_hash_ctz(m);
+         }
+         g = (g + i) & group_mask;
+         BOOST_ASSERT(i <= group_mask + 1u);
+      }
+   }
+
+   //Makes sure data.position is a free slot that can be consumed
+   void priv_prepare_commit(insert_commit_data &data)
+   {
+      if(!m_members.m_capacity ||
+         (!m_members.m_growth_left && this->priv_raw_ctrl()[data.position] == flat_hash_ctrl_empty)){
+         //If tombstones are taking most of the space purge them keeping the capacity, otherwise grow
+         const size_type cap = m_members.m_capacity;
+         this->priv_rehash(!cap ? this->priv_capacity_for(1u) : m_members.m_size < cap/2u ? cap : cap*2u);
+         data.position = this->priv_find_first_free(data.hash);
+      }
+   }
+
+   void priv_mark_full(const insert_commit_data &data)
+   {
+      unsigned char &c = this->priv_raw_ctrl()[data.position];
+      m_members.m_growth_left -= size_type(c == flat_hash_ctrl_empty);
+      c = priv_h2(data.hash);
+      ++m_members.m_size;
+   }
+
+   void priv_erase(size_type pos)
+   {
+      slot_allocator_type a(this->priv_alloc());
+      slot_allocator_traits::destroy(a, this->priv_slot(pos));
+      --m_members.m_size;
+      //If the group already has an empty slot no probe sequence
+      //continues past it, so the slot can be marked as empty
+      unsigned char *const ctrl = this->priv_raw_ctrl();
+      if(flat_hash_group(ctrl + (pos & ~(flat_hash_group_width - 1u))).match_empty()){
+         ctrl[pos] = static_cast<unsigned char>(flat_hash_ctrl_empty);
+         ++m_members.m_growth_left;
+      }
+      else{
+         ctrl[pos] = static_cast<unsigned char>(flat_hash_ctrl_deleted);
+      }
+   }
+
+   void priv_allocate(size_type cap, ctrl_pointer &ctrl, slot_pointer &slots)
+   {
+      ctrl_allocator_type ca(this->priv_alloc());
+      ctrl = ctrl_allocator_traits::allocate(ca, cap + 1u);
+      BOOST_TRY{
+         slot_allocator_type sa(this->priv_alloc());
+         slots = slot_allocator_traits::allocate(sa, cap);
+      }
+      BOOST_CATCH(...){
+         ctrl_allocator_traits::deallocate(ca, ctrl, cap + 1u);
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      unsigned char *const raw_ctrl = container_detail::to_raw_pointer(ctrl);
+      std::memset(raw_ctrl, flat_hash_ctrl_empty, cap);
+      raw_ctrl[cap] = static_cast<unsigned char>(flat_hash_ctrl_sentinel);
+   }
+
+   void priv_deallocate(size_type cap, const ctrl_pointer &ctrl, const slot_pointer &slots)
+   {
+      if(cap){
+         ctrl_allocator_type ca(this->priv_alloc());
+         ctrl_allocator_traits::deallocate(ca, ctrl, cap + 1u);
+         slot_allocator_type sa(this->priv_alloc());
+         slot_allocator_traits::deallocate(sa, slots, cap);
+      }
+   }
+
+   void priv_destroy_elements()
+   {
+      if(!container_detail::is_trivially_destructible<internal_type>::value){
+         slot_allocator_type a(this->priv_alloc());
+         const unsigned char *const ctrl = this->priv_raw_ctrl();
+         for(size_type i = 0, remaining = m_members.m_size; remaining; ++i){
+            if(ctrl[i] < flat_hash_ctrl_empty){
+               slot_allocator_traits::destroy(a, this->priv_slot(i));
+               --remaining;
+            }
+         }
+      }
+   }
+
+   void priv_destroy_and_deallocate()
+   {
+      this->priv_destroy_elements();
+      this->priv_deallocate(m_members.m_capacity, m_members.m_ctrl, m_members.m_slots);
+      m_members.m_ctrl  = ctrl_pointer();
+      m_members.m_slots = slot_pointer();
+      m_members.m_capacity = m_members.m_size = m_members.m_growth_left = 0u;
+   }
+
+   void priv_steal(flat_hash_table &x)
+   {
+      m_members.m_ctrl        = x.m_members.m_ctrl;
+      m_members.m_slots       = x.m_members.m_slots;
+      m_members.m_capacity    = x.m_members.m_capacity;
+      m_members.m_size        = x.m_members.m_size;
+      m_members.m_growth_left = x.m_members.m_growth_left;
+      x.m_members.m_ctrl  = ctrl_pointer();
+      x.m_members.m_slots = slot_pointer();
+      x.m_members.m_capacity = x.m_members.m_size = x.m_members.m_growth_left = 0u;
+   }
+
+   //Copies x's layout: control bytes are copied verbatim and elements
+   //are copy constructed in the same slots, so nothing is rehashed
+   void priv_copy_from(const flat_hash_table &x)
+   {
+      BOOST_ASSERT(!m_members.m_capacity);
+      if(!x.m_members.m_size)
+         return;
+      const size_type cap = x.m_members.m_capacity;
+      ctrl_pointer ctrl;
+      slot_pointer slots;
+      this->priv_allocate(cap, ctrl, slots);
+      const unsigned char *const xctrl = x.priv_raw_ctrl();
+      internal_type *const raw_slots = container_detail::to_raw_pointer(slots);
+      slot_allocator_type a(this->priv_alloc());
+      size_type i = 0;
+      BOOST_TRY{
+         for(; i != cap; ++i){
+            if(xctrl[i] < flat_hash_ctrl_empty){
+               slot_allocator_traits::construct(a, raw_slots + i, *x.priv_slot(i));
+            }
+         }
+      }
+      BOOST_CATCH(...){
+         while(i--){
+            if(xctrl[i] < flat_hash_ctrl_empty){
+               slot_allocator_traits::destroy(a, raw_slots + i);
+            }
+         }
+         this->priv_deallocate(cap, ctrl, slots);
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      std::memcpy(container_detail::to_raw_pointer(ctrl), xctrl, cap);
+      m_members.m_ctrl        = ctrl;
+      m_members.m_slots       = slots;
+      m_members.m_capacity    = cap;
+      m_members.m_size        = x.m_members.m_size;
+      m_members.m_growth_left = x.m_members.m_growth_left;
+   }
+
+   void priv_move_elements_from(flat_hash_table &x)
+   {
+      BOOST_ASSERT(!m_members.m_capacity);
+      this->reserve(x.size());
+      for(iterator it = x.begin(), itend = x.end(); it != itend; ++it){
+         this->insert_unique(boost::move(*x.priv_slot(x.priv_position(it))));
+      }
+      x.clear();
+   }
+
+   //Moves all elements to a new table with new_cap slots. If a hash function or
+   //move constructor throws, the table is left unchanged (although elements
+   //already moved might be in a moved-from state)
+   void priv_rehash(size_type new_cap)
+   {
+      BOOST_ASSERT(new_cap >= flat_hash_group_width && !(new_cap & (new_cap - 1u)));
+      BOOST_ASSERT(new_cap - new_cap/8u >= m_members.m_size);
+      ctrl_pointer new_ctrl;
+      slot_pointer new_slots;
+      this->priv_allocate(new_cap, new_ctrl, new_slots);
+
+      const size_type old_cap = m_members.m_capacity;
+      const unsigned char *const old_ctrl = this->priv_raw_ctrl();
+      unsigned char *const raw_new_ctrl = container_detail::to_raw_pointer(new_ctrl);
+      internal_type *const raw_new_slots = container_detail::to_raw_pointer(new_slots);
+      slot_allocator_type a(this->priv_alloc());
+
+      //Temporarily install the new arrays so that priv_find_first_free can be used
+      const ctrl_pointer old_ctrl_ptr = m_members.m_ctrl;
+      const slot_pointer old_slots_ptr = m_members.m_slots;
+      m_members.m_ctrl = new_ctrl;
+      m_members.m_slots = new_slots;
+      m_members.m_capacity = new_cap;
+      size_type i = 0;
+      BOOST_TRY{
+         for(; i != old_cap; ++i){
+            if(old_ctrl[i] < flat_hash_ctrl_empty){
+               internal_type &old = container_detail::to_raw_pointer(old_slots_ptr)[i];
+               const std::size_t h = this->priv_hash(KeyOfValue()(reinterpret_cast<const value_type&>(old)));
+               const size_type pos = this->priv_find_first_free(h);
+               slot_allocator_traits::construct(a, raw_new_slots + pos, boost::move(old));
+               raw_new_ctrl[pos] = priv_h2(h);
+            }
+         }
+      }
+      BOOST_CATCH(...){
+         for(size_type j = 0; j != new_cap; ++j){
+            if(raw_new_ctrl[j] < flat_hash_ctrl_empty){
+               slot_allocator_traits::destroy(a, raw_new_slots + j);
+            }
+         }
+         m_members.m_ctrl = old_ctrl_ptr;
+         m_members.m_slots = old_slots_ptr;
+         m_members.m_capacity = old_cap;
+         this->priv_deallocate(new_cap, new_ctrl, new_slots);
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      //Destroy moved-from elements and release the old arrays
+      for(size_type j = 0; j != old_cap; ++j){
+         if(old_ctrl[j] < flat_hash_ctrl_empty){
+            slot_allocator_traits::destroy(a, container_detail::to_raw_pointer(old_slots_ptr) + j);
+         }
+      }
+      this->priv_deallocate(old_cap, old_ctrl_ptr, old_slots_ptr);
+      m_members.m_growth_left = new_cap - new_cap/8u - m_members.m_size;
+   }
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+} //namespace container_detail {
+} //namespace container {
+} //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif //BOOST_CONTAINER_FLAT_HASH_TABLE_HPP
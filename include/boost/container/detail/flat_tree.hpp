@@ -23,6 +23,7 @@
 #include <boost/container/detail/workaround.hpp>
 
 #include <boost/container/container_fwd.hpp>
+#include <boost/container/options.hpp>
 
 #include <boost/move/utility_core.hpp>
 
@@ -31,20 +32,26 @@
 #include <boost/container/detail/value_init.hpp>
 #include <boost/container/detail/destroyers.hpp>
 #include <boost/container/detail/algorithm.hpp> //algo_equal(), algo_lexicographical_compare
+#include <boost/container/detail/hash.hpp>
+#include <boost/container/detail/flat_tree_index.hpp>
+#include <boost/container/detail/flat_tree_sequence.hpp>
 #include <boost/container/detail/iterator.hpp>
 #include <boost/container/allocator_traits.hpp>
-#ifdef BOOST_CONTAINER_VECTOR_ITERATOR_IS_POINTER
-#include <boost/intrusive/pointer_traits.hpp>
-#endif
 #include <boost/container/detail/type_traits.hpp>
 #include <boost/move/make_unique.hpp>
 #include <boost/move/adl_move_swap.hpp>
+#include <boost/move/iterator.hpp>
 #if defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
 #include <boost/move/detail/fwd_macros.hpp>
 #endif
 
 #include <boost/intrusive/detail/minimal_pair_header.hpp>      //pair
 
+#include <boost/core/no_exceptions_support.hpp>
+#include <boost/assert.hpp>
+
+#include <algorithm> //std::sort
+
 namespace boost {
 namespace container {
 namespace container_detail {
@@ -78,33 +85,42 @@ class flat_tree_value_compare
       {  return *this;  }
 };
 
-template<class Pointer>
-struct get_flat_tree_iterators
+//Orders positions of a value range by value and then by position so that
+//an unstable sort of the positions yields a stable order of the values
+template<class RanIt, class ValueCompare, class SizeType>
+class flat_tree_index_compare
 {
-   #ifdef BOOST_CONTAINER_VECTOR_ITERATOR_IS_POINTER
-   typedef Pointer                                             iterator;
-   typedef typename boost::intrusive::
-      pointer_traits<Pointer>::element_type                    iterator_element_type;
-   typedef typename boost::intrusive::
-      pointer_traits<Pointer>:: template
-         rebind_pointer<const iterator_element_type>::type     const_iterator;
-   #else //BOOST_CONTAINER_VECTOR_ITERATOR_IS_POINTER
-   typedef typename boost::container::container_detail::
-      vec_iterator<Pointer, false>                             iterator;
-   typedef typename boost::container::container_detail::
-      vec_iterator<Pointer, true >                             const_iterator;
-   #endif   //BOOST_CONTAINER_VECTOR_ITERATOR_IS_POINTER
-   typedef boost::container::reverse_iterator<iterator>        reverse_iterator;
-   typedef boost::container::reverse_iterator<const_iterator>  const_reverse_iterator;
+   public:
+   flat_tree_index_compare(RanIt base, const ValueCompare &comp)
+      : m_base(base), m_comp(comp)
+   {}
+
+   bool operator()(SizeType l, SizeType r) const
+   {
+      return m_comp(m_base[l], m_base[r]) || (!m_comp(m_base[r], m_base[l]) && l < r);
+   }
+
+   private:
+   RanIt m_base;
+   const ValueCompare &m_comp;
 };
 
 template <class Key, class Value, class KeyOfValue,
-          class Compare, class Allocator>
+          class Compare, class Allocator,
+          class Options = flat_assoc_defaults>
 class flat_tree
 {
-   typedef boost::container::vector<Value, Allocator>    vector_t;
+   typedef flat_tree_sequence
+      < Value, Allocator, Options::sequence_storage
+      , Options::sequence_capacity>                      sequence_selector_t;
+   typedef typename sequence_selector_t::type            sequence_t;
+   typedef typename sequence_selector_t::contiguous      contiguous_t;
+   typedef typename sequence_selector_t::mergeable       mergeable_t;
+   typedef typename sequence_selector_t::growable        growable_t;
    typedef Allocator                                     allocator_t;
    typedef allocator_traits<Allocator>                   allocator_traits_type;
+   typedef flat_tree_search_index
+      <Key, Allocator, Options::search_index>            index_t;
 
    public:
    typedef flat_tree_value_compare<Compare, Value, KeyOfValue> value_compare;
@@ -118,48 +134,61 @@ class flat_tree
 
       public:
       Data()
-         : value_compare(), m_vect()
+         : value_compare(), m_seq(), m_index()
       {}
 
       explicit Data(const Data &d)
-         : value_compare(static_cast<const value_compare&>(d)), m_vect(d.m_vect)
+         : value_compare(static_cast<const value_compare&>(d)), m_seq(d.m_seq), m_index(d.m_index)
       {}
 
+      //Sequences with inline storage move elements one by one and leave
+      //them moved-from in the source: it's cleared so that it stays ordered
       Data(BOOST_RV_REF(Data) d)
-         : value_compare(boost::move(static_cast<value_compare&>(d))), m_vect(boost::move(d.m_vect))
-      {}
+         : value_compare(boost::move(static_cast<value_compare&>(d))), m_seq(boost::move(d.m_seq))
+         , m_index(boost::move(d.m_index))
+      {  d.m_seq.clear();  }
 
       Data(const Data &d, const Allocator &a)
-         : value_compare(static_cast<const value_compare&>(d)), m_vect(d.m_vect, a)
+         : value_compare(static_cast<const value_compare&>(d)), m_seq(d.m_seq, a), m_index(a)
       {}
 
       Data(BOOST_RV_REF(Data) d, const Allocator &a)
-         : value_compare(boost::move(static_cast<value_compare&>(d))), m_vect(boost::move(d.m_vect), a)
-      {}
+         : value_compare(boost::move(static_cast<value_compare&>(d))), m_seq(boost::move(d.m_seq), a), m_index(a)
+      {
+         d.m_seq.clear();
+         d.m_index.invalidate();
+      }
 
       explicit Data(const Compare &comp)
-         : value_compare(comp), m_vect()
+         : value_compare(comp), m_seq(), m_index()
       {}
 
       Data(const Compare &comp, const allocator_t &alloc)
-         : value_compare(comp), m_vect(alloc)
+         : value_compare(comp), m_seq(alloc), m_index(alloc)
       {}
 
       explicit Data(const allocator_t &alloc)
-         : value_compare(), m_vect(alloc)
+         : value_compare(), m_seq(alloc), m_index(alloc)
       {}
 
       Data& operator=(BOOST_COPY_ASSIGN_REF(Data) d)
       {
+         this->m_index.invalidate();
          this->value_compare::operator=(d);
-         m_vect = d.m_vect;
+         m_seq = d.m_seq;
+         m_index = d.m_index;
          return *this;
       }
 
       Data& operator=(BOOST_RV_REF(Data) d)
       {
+         this->m_index.invalidate();
          this->value_compare::operator=(boost::move(static_cast<value_compare &>(d)));
-         m_vect = boost::move(d.m_vect);
+         m_seq = boost::move(d.m_seq);
+         if(&d != this){
+            d.m_seq.clear();
+         }
+         m_index = boost::move(d.m_index);
          return *this;
       }
 
@@ -167,10 +196,12 @@ class flat_tree
       {
          value_compare& mycomp    = *this, & othercomp = d;
          boost::adl_move_swap(mycomp, othercomp);
-         this->m_vect.swap(d.m_vect);
+         this->m_seq.swap(d.m_seq);
+         this->m_index.swap(d.m_index);
       }
 
-      vector_t m_vect;
+      sequence_t m_seq;
+      index_t  m_index;
    };
 
    Data m_data;
@@ -178,20 +209,21 @@ class flat_tree
 
    public:
 
-   typedef typename vector_t::value_type              value_type;
-   typedef typename vector_t::pointer                 pointer;
-   typedef typename vector_t::const_pointer           const_pointer;
-   typedef typename vector_t::reference               reference;
-   typedef typename vector_t::const_reference         const_reference;
+   typedef typename sequence_t::value_type            value_type;
+   typedef typename sequence_t::pointer               pointer;
+   typedef typename sequence_t::const_pointer         const_pointer;
+   typedef typename sequence_t::reference             reference;
+   typedef typename sequence_t::const_reference       const_reference;
    typedef Key                                        key_type;
    typedef Compare                                    key_compare;
-   typedef typename vector_t::allocator_type          allocator_type;
-   typedef typename vector_t::size_type               size_type;
-   typedef typename vector_t::difference_type         difference_type;
-   typedef typename vector_t::iterator                iterator;
-   typedef typename vector_t::const_iterator          const_iterator;
-   typedef typename vector_t::reverse_iterator        reverse_iterator;
-   typedef typename vector_t::const_reverse_iterator  const_reverse_iterator;
+   typedef Allocator                                  allocator_type;
+   typedef typename sequence_t::size_type             size_type;
+   typedef typename sequence_t::difference_type       difference_type;
+   typedef typename sequence_t::iterator              iterator;
+   typedef typename sequence_t::const_iterator        const_iterator;
+   typedef typename sequence_t::reverse_iterator      reverse_iterator;
+   typedef typename sequence_t::const_reverse_iterator const_reverse_iterator;
+   typedef sequence_t                                 sequence_type;
 
    //!Standard extension
    typedef allocator_type                             stored_allocator_type;
@@ -237,7 +269,10 @@ class flat_tree
             , const Compare& comp     = Compare()
             , const allocator_type& a = allocator_type())
       : m_data(comp, a)
-   { this->m_data.m_vect.insert(this->m_data.m_vect.end(), first, last); }
+   {
+      this->m_data.m_seq.insert(this->m_data.m_seq.end(), first, last);
+      this->rebuild_index();
+   }
 
    template <class InputIterator>
    flat_tree( bool unique_insertion
@@ -246,19 +281,14 @@ class flat_tree
             , const allocator_type& a = allocator_type())
       : m_data(comp, a)
    {
-      //Use cend() as hint to achieve linear time for
-      //ordered ranges as required by the standard
+      //Already ordered ranges are detected by priv_insert_range,
+      //achieving linear time as required by the standard
       //for the constructor
-      //Call end() every iteration as reallocation might have invalidated iterators
       if(unique_insertion){
-         for ( ; first != last; ++first){
-            this->insert_unique(this->cend(), *first);
-         }
+         this->priv_insert_range(container_detail::true_type(), first, last);
       }
       else{
-         for ( ; first != last; ++first){
-            this->insert_equal(this->cend(), *first);
-         }
+         this->priv_insert_range(container_detail::false_type(), first, last);
       }
    }
 
@@ -282,31 +312,31 @@ class flat_tree
    { return this->m_data; }
 
    allocator_type get_allocator() const
-   { return this->m_data.m_vect.get_allocator(); }
+   { return this->m_data.m_seq.get_allocator(); }
 
    const stored_allocator_type &get_stored_allocator() const
-   {  return this->m_data.m_vect.get_stored_allocator(); }
+   {  return this->m_data.m_seq.get_stored_allocator(); }
 
    stored_allocator_type &get_stored_allocator()
-   {  return this->m_data.m_vect.get_stored_allocator(); }
+   {  return this->m_data.m_seq.get_stored_allocator(); }
 
    iterator begin()
-   { return this->m_data.m_vect.begin(); }
+   { return this->m_data.m_seq.begin(); }
 
    const_iterator begin() const
    { return this->cbegin(); }
 
    const_iterator cbegin() const
-   { return this->m_data.m_vect.begin(); }
+   { return this->m_data.m_seq.begin(); }
 
    iterator end()
-   { return this->m_data.m_vect.end(); }
+   { return this->m_data.m_seq.end(); }
 
    const_iterator end() const
    { return this->cend(); }
 
    const_iterator cend() const
-   { return this->m_data.m_vect.end(); }
+   { return this->m_data.m_seq.end(); }
 
    reverse_iterator rbegin()
    { return reverse_iterator(this->end()); }
@@ -327,13 +357,13 @@ class flat_tree
    { return const_reverse_iterator(this->cbegin()); }
 
    bool empty() const
-   { return this->m_data.m_vect.empty(); }
+   { return this->m_data.m_seq.empty(); }
 
    size_type size() const
-   { return this->m_data.m_vect.size(); }
+   { return this->m_data.m_seq.size(); }
 
    size_type max_size() const
-   { return this->m_data.m_vect.max_size(); }
+   { return this->m_data.m_seq.max_size(); }
 
    void swap(flat_tree& other)
       BOOST_NOEXCEPT_IF(  allocator_traits_type::is_always_equal::value
@@ -348,7 +378,7 @@ class flat_tree
       insert_commit_data data;
       ret.second = this->priv_insert_unique_prepare(val, data);
       ret.first = ret.second ? this->priv_insert_commit(data, val)
-                             : iterator(vector_iterator_get_ptr(data.position));
+                             : this->priv_iterator(data.position);
       return ret;
    }
 
@@ -358,21 +388,23 @@ class flat_tree
       insert_commit_data data;
       ret.second = this->priv_insert_unique_prepare(val, data);
       ret.first = ret.second ? this->priv_insert_commit(data, boost::move(val))
-                             : iterator(vector_iterator_get_ptr(data.position));
+                             : this->priv_iterator(data.position);
       return ret;
    }
 
    iterator insert_equal(const value_type& val)
    {
-      iterator i = this->upper_bound(KeyOfValue()(val));
-      i = this->m_data.m_vect.insert(i, val);
+      iterator i = this->priv_upper_bound(this->begin(), this->end(), KeyOfValue()(val));
+      this->priv_invalidate_index();
+      i = this->m_data.m_seq.insert(i, val);
       return i;
    }
 
    iterator insert_equal(BOOST_RV_REF(value_type) mval)
    {
-      iterator i = this->upper_bound(KeyOfValue()(mval));
-      i = this->m_data.m_vect.insert(i, boost::move(mval));
+      iterator i = this->priv_upper_bound(this->begin(), this->end(), KeyOfValue()(mval));
+      this->priv_invalidate_index();
+      i = this->m_data.m_seq.insert(i, boost::move(mval));
       return i;
    }
 
@@ -382,7 +414,7 @@ class flat_tree
       insert_commit_data data;
       return this->priv_insert_unique_prepare(pos, val, data)
             ? this->priv_insert_commit(data, val)
-            : iterator(vector_iterator_get_ptr(data.position));
+            : this->priv_iterator(data.position);
    }
 
    iterator insert_unique(const_iterator pos, BOOST_RV_REF(value_type) val)
@@ -391,7 +423,7 @@ class flat_tree
       insert_commit_data data;
       return this->priv_insert_unique_prepare(pos, val, data)
          ? this->priv_insert_commit(data, boost::move(val))
-         : iterator(vector_iterator_get_ptr(data.position));
+         : this->priv_iterator(data.position);
    }
 
    iterator insert_equal(const_iterator pos, const value_type& val)
@@ -410,35 +442,11 @@ class flat_tree
 
    template <class InIt>
    void insert_unique(InIt first, InIt last)
-   {
-      for ( ; first != last; ++first){
-         this->insert_unique(*first);
-      }
-   }
-
-   template <class InIt>
-   void insert_equal(InIt first, InIt last
-      #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
-      , typename container_detail::enable_if_c
-         < container_detail::is_input_iterator<InIt>::value
-         >::type * = 0
-      #endif
-      )
-   {  this->priv_insert_equal_loop(first, last);  }
+   {  this->priv_insert_range(container_detail::true_type(), first, last);  }
 
    template <class InIt>
-   void insert_equal(InIt first, InIt last
-      #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
-      , typename container_detail::enable_if_c
-         < !container_detail::is_input_iterator<InIt>::value
-         >::type * = 0
-      #endif
-      )
-   {
-      const size_type len = static_cast<size_type>(boost::container::iterator_distance(first, last));
-      this->reserve(this->size()+len);
-      this->priv_insert_equal_loop(first, last);
-   }
+   void insert_equal(InIt first, InIt last)
+   {  this->priv_insert_range(container_detail::false_type(), first, last);  }
 
    //Ordered
 
@@ -477,7 +485,9 @@ class flat_tree
          >::type * = 0
       #endif
       )
-   {   this->m_data.m_vect.merge(first, last);   }
+   {
+      this->priv_merge_ordered(container_detail::false_type(), first, last, mergeable_t());
+   }
 
    template <class InIt>
    void insert_unique(ordered_unique_range_t, InIt first, InIt last
@@ -495,6 +505,7 @@ class flat_tree
          pos = this->insert_unique(pos, *first);
          ++pos;
       }
+      this->rebuild_index();
    }
 
    template <class BidirIt>
@@ -506,7 +517,9 @@ class flat_tree
          >::type * = 0
       #endif
       )
-   {   this->m_data.m_vect.merge_unique(first, last);   }
+   {
+      this->priv_merge_ordered(container_detail::true_type(), first, last, mergeable_t());
+   }
 
    #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
 
@@ -607,23 +620,33 @@ class flat_tree
    #endif   // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
 
    iterator erase(const_iterator position)
-   {  return this->m_data.m_vect.erase(position);  }
+   {
+      this->priv_invalidate_index();
+      return this->m_data.m_seq.erase(position);
+   }
 
    size_type erase(const key_type& k)
    {
-      std::pair<iterator,iterator > itp = this->equal_range(k);
+      std::pair<iterator,iterator > itp = this->priv_equal_range(this->begin(), this->end(), k);
       size_type ret = static_cast<size_type>(itp.second-itp.first);
       if (ret){
-         this->m_data.m_vect.erase(itp.first, itp.second);
+         this->priv_invalidate_index();
+         this->m_data.m_seq.erase(itp.first, itp.second);
       }
       return ret;
    }
 
    iterator erase(const_iterator first, const_iterator last)
-   {  return this->m_data.m_vect.erase(first, last);  }
+   {
+      this->priv_invalidate_index();
+      return this->m_data.m_seq.erase(first, last);
+   }
 
    void clear()
-   {  this->m_data.m_vect.clear();  }
+   {
+      this->m_data.m_index.clear();
+      this->m_data.m_seq.clear();
+   }
 
    //! <b>Effects</b>: Tries to deallocate the excess of memory created
    //    with previous allocations. The size of the vector is unchanged
@@ -632,79 +655,329 @@ class flat_tree
    //!
    //! <b>Complexity</b>: Linear to size().
    void shrink_to_fit()
-   {  this->m_data.m_vect.shrink_to_fit();  }
+   {  this->m_data.m_seq.shrink_to_fit();  }
 
    iterator nth(size_type n) BOOST_NOEXCEPT_OR_NOTHROW
-   {  return this->m_data.m_vect.nth(n);   }
+   {  return this->m_data.m_seq.nth(n);   }
 
    const_iterator nth(size_type n) const BOOST_NOEXCEPT_OR_NOTHROW
-   {  return this->m_data.m_vect.nth(n);   }
+   {  return this->m_data.m_seq.nth(n);   }
 
    size_type index_of(iterator p) BOOST_NOEXCEPT_OR_NOTHROW
-   {  return this->m_data.m_vect.index_of(p);   }
+   {  return this->m_data.m_seq.index_of(p);   }
 
    size_type index_of(const_iterator p) const BOOST_NOEXCEPT_OR_NOTHROW
-   {  return this->m_data.m_vect.index_of(p);   }
+   {  return this->m_data.m_seq.index_of(p);   }
 
    // set operations:
    iterator find(const key_type& k)
-   {
-      iterator i = this->lower_bound(k);
-      iterator end_it = this->end();
-      if (i != end_it && this->m_data.get_comp()(k, KeyOfValue()(*i))){
-         i = end_it;
-      }
-      return i;
-   }
+   {  return this->begin() + this->priv_find_pos(k);  }
 
    const_iterator find(const key_type& k) const
-   {
-      const_iterator i = this->lower_bound(k);
-
-      const_iterator end_it = this->cend();
-      if (i != end_it && this->m_data.get_comp()(k, KeyOfValue()(*i))){
-         i = end_it;
-      }
-      return i;
-   }
+   {  return this->cbegin() + this->priv_find_pos(k);  }
 
-   // set operations:
    size_type count(const key_type& k) const
    {
-      std::pair<const_iterator, const_iterator> p = this->equal_range(k);
-      size_type n = p.second - p.first;
-      return n;
+      std::pair<size_type, size_type> p = this->priv_equal_range_pos(k);
+      return p.second - p.first;
    }
 
    iterator lower_bound(const key_type& k)
-   {  return this->priv_lower_bound(this->begin(), this->end(), k);  }
+   {  return this->begin() + this->priv_lower_bound_pos(k);  }
 
    const_iterator lower_bound(const key_type& k) const
-   {  return this->priv_lower_bound(this->cbegin(), this->cend(), k);  }
+   {  return this->cbegin() + this->priv_lower_bound_pos(k);  }
 
    iterator upper_bound(const key_type& k)
-   {  return this->priv_upper_bound(this->begin(), this->end(), k);  }
+   {  return this->begin() + this->priv_upper_bound_pos(k);  }
 
    const_iterator upper_bound(const key_type& k) const
-   {  return this->priv_upper_bound(this->cbegin(), this->cend(), k);  }
+   {  return this->cbegin() + this->priv_upper_bound_pos(k);  }
 
    std::pair<iterator,iterator> equal_range(const key_type& k)
-   {  return this->priv_equal_range(this->begin(), this->end(), k);  }
+   {
+      std::pair<size_type, size_type> p = this->priv_equal_range_pos(k);
+      return std::pair<iterator,iterator>(this->begin() + p.first, this->begin() + p.second);
+   }
 
    std::pair<const_iterator, const_iterator> equal_range(const key_type& k) const
-   {  return this->priv_equal_range(this->cbegin(), this->cend(), k);  }
+   {
+      std::pair<size_type, size_type> p = this->priv_equal_range_pos(k);
+      return std::pair<const_iterator, const_iterator>(this->cbegin() + p.first, this->cbegin() + p.second);
+   }
 
    std::pair<iterator, iterator> lower_bound_range(const key_type& k)
-   {  return this->priv_lower_bound_range(this->begin(), this->end(), k);  }
+   {
+      std::pair<size_type, size_type> p = this->priv_lower_bound_range_pos(k);
+      return std::pair<iterator,iterator>(this->begin() + p.first, this->begin() + p.second);
+   }
 
    std::pair<const_iterator, const_iterator> lower_bound_range(const key_type& k) const
-   {  return this->priv_lower_bound_range(this->cbegin(), this->cend(), k);  }
+   {
+      std::pair<size_type, size_type> p = this->priv_lower_bound_range_pos(k);
+      return std::pair<const_iterator, const_iterator>(this->cbegin() + p.first, this->cbegin() + p.second);
+   }
+
+   template<class KeyForwardIterator, class OutputIterator>
+   OutputIterator find_batch(KeyForwardIterator first, KeyForwardIterator last, OutputIterator out)
+   {  return this->priv_find_batch(this->begin(), first, last, out);  }
+
+   template<class KeyForwardIterator, class OutputIterator>
+   OutputIterator find_batch(KeyForwardIterator first, KeyForwardIterator last, OutputIterator out) const
+   {  return this->priv_find_batch(this->cbegin(), first, last, out);  }
+
+   //Heterogeneous lookup, only available for transparent comparators
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      find(const K& k)
+   {  return this->begin() + this->priv_find_pos(k);  }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      find(const K& k) const
+   {  return this->cbegin() + this->priv_find_pos(k);  }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, size_type>::type
+      count(const K& k) const
+   {
+      std::pair<size_type, size_type> p = this->priv_equal_range_pos(k);
+      return p.second - p.first;
+   }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      lower_bound(const K& k)
+   {  return this->begin() + this->priv_lower_bound_pos(k);  }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      lower_bound(const K& k) const
+   {  return this->cbegin() + this->priv_lower_bound_pos(k);  }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      upper_bound(const K& k)
+   {  return this->begin() + this->priv_upper_bound_pos(k);  }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      upper_bound(const K& k) const
+   {  return this->cbegin() + this->priv_upper_bound_pos(k);  }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<iterator,iterator> >::type
+      equal_range(const K& k)
+   {
+      std::pair<size_type, size_type> p = this->priv_equal_range_pos(k);
+      return std::pair<iterator,iterator>(this->begin() + p.first, this->begin() + p.second);
+   }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<const_iterator, const_iterator> >::type
+      equal_range(const K& k) const
+   {
+      std::pair<size_type, size_type> p = this->priv_equal_range_pos(k);
+      return std::pair<const_iterator, const_iterator>(this->cbegin() + p.first, this->cbegin() + p.second);
+   }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<iterator, iterator> >::type
+      lower_bound_range(const K& k)
+   {
+      std::pair<size_type, size_type> p = this->priv_lower_bound_range_pos(k);
+      return std::pair<iterator,iterator>(this->begin() + p.first, this->begin() + p.second);
+   }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<const_iterator, const_iterator> >::type
+      lower_bound_range(const K& k) const
+   {
+      std::pair<size_type, size_type> p = this->priv_lower_bound_range_pos(k);
+      return std::pair<const_iterator, const_iterator>(this->cbegin() + p.first, this->cbegin() + p.second);
+   }
 
    size_type capacity() const
-   { return this->m_data.m_vect.capacity(); }
+   { return this->priv_capacity(contiguous_t()); }
 
    void reserve(size_type cnt)
-   { this->m_data.m_vect.reserve(cnt);   }
+   { this->priv_reserve(cnt, contiguous_t());   }
+
+   //Also called at the end of bulk insertions and adoptions. Lookups
+   //never rebuild the index, so they have no side effects.
+   void rebuild_index()
+   {
+      this->m_data.m_index.build(this->m_data.m_seq.cbegin(), this->size(), KeyOfValue());
+   }
+
+   //The search index is released as the caller takes the whole sequence
+   sequence_type extract_sequence()
+   {
+      this->m_data.m_index.clear();
+      sequence_type seq(boost::move(this->m_data.m_seq));
+      this->m_data.m_seq.clear();
+      return boost::move(seq);
+   }
+
+   //The sequence is sorted (stable) and equivalent elements but the first one
+   //are erased before being adopted, so *this is unchanged if that throws
+   void adopt_sequence_unique(BOOST_RV_REF(sequence_type) seq)
+   {
+      const iterator pbeg = seq.begin();
+      iterator pend = seq.end();
+      if(!this->priv_is_sorted(pbeg, pend)){
+         this->priv_stable_sort(pbeg, pend);
+      }
+      pend = this->priv_remove_equivalent(pbeg, pbeg, pend);
+      seq.erase(pend, seq.end());
+      this->priv_adopt_sequence(seq);
+   }
+
+   void adopt_sequence_unique(ordered_unique_range_t, BOOST_RV_REF(sequence_type) seq)
+   {
+      BOOST_ASSERT(this->priv_is_sorted_unique(seq.cbegin(), seq.cend()));
+      this->priv_adopt_sequence(seq);
+   }
+
+   void adopt_sequence_equal(BOOST_RV_REF(sequence_type) seq)
+   {
+      if(!this->priv_is_sorted(seq.cbegin(), seq.cend())){
+         this->priv_stable_sort(seq.begin(), seq.end());
+      }
+      this->priv_adopt_sequence(seq);
+   }
+
+   void adopt_sequence_equal(ordered_range_t, BOOST_RV_REF(sequence_type) seq)
+   {
+      BOOST_ASSERT(this->priv_is_sorted(seq.cbegin(), seq.cend()));
+      this->priv_adopt_sequence(seq);
+   }
+
+   //Set algebra for unique flat trees. Both sequences are walked in order and each
+   //one skips its elements less than the current element of the other with a
+   //galloping search, so walking m elements against n take O(m log(n/m + 1))
+   //comparisons. Elements of *this are moved at most once.
+
+   //Inserts copies of the elements of x whose keys are not present in *this.
+   //They are appended and merged with the old elements. *this is unchanged if
+   //a copy or the allocation of the merge buffer throws. If a comparison throws
+   //while merging, *this stays sorted and keeps all its old elements.
+   void merge_union_unique(const flat_tree &x)
+   {
+      if(&x == this){
+         return;
+      }
+      const Compare &key_cmp = this->m_data.get_comp();
+      KeyOfValue key_extract;
+      sequence_t &v = this->m_data.m_seq;
+      const size_type old_size = v.size();
+      this->priv_invalidate_index();
+      BOOST_TRY{
+         size_type pos = 0u;
+         for(const_iterator it(x.cbegin()), itend(x.cend()); it != itend; ++it){
+            //Appending can reallocate the sequence
+            const const_iterator b(v.cbegin());
+            const const_iterator old_end(b + difference_type(old_size));
+            const const_iterator lb(this->priv_gallop_lower_bound(b + difference_type(pos), old_end, key_extract(*it)));
+            pos = size_type(lb - b);
+            if(lb == old_end || key_cmp(key_extract(*it), key_extract(*lb))){
+               v.push_back(*it);
+            }
+         }
+      }
+      BOOST_CATCH(...){
+         v.erase(v.cbegin() + difference_type(old_size), v.cend());
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      this->priv_merge_tail(old_size, growable_t());
+      this->rebuild_index();
+   }
+
+   //Erases the elements of *this whose keys are not present in x. If a comparison
+   //throws, *this stays sorted: only the elements already discarded are erased.
+   void intersect_with_unique(const flat_tree &x)
+   {
+      if(&x == this){
+         return;
+      }
+      KeyOfValue key_extract;
+      this->priv_invalidate_index();
+      const iterator e(this->end());
+      iterator in(this->begin()), out(in);
+      BOOST_TRY{
+         for(const_iterator xit(x.cbegin()), xe(x.cend()); in != e; ){
+            xit = x.priv_gallop_lower_bound(xit, xe, key_extract(*in));
+            if(xit == xe){
+               break;
+            }
+            //Elements less than *xit are not present in x
+            const iterator next(this->priv_gallop_lower_bound(in, e, key_extract(*xit)));
+            if(next != in){
+               in = next;
+            }
+            else{
+               if(out != in){
+                  *out = boost::move(*in);
+               }
+               ++out;
+               ++in;
+               ++xit;
+            }
+         }
+      }
+      BOOST_CATCH(...){
+         this->priv_close_gap(out, in);
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      this->m_data.m_seq.erase(out, e);
+      this->rebuild_index();
+   }
+
+   //Erases the elements of *this whose keys are present in x. If a comparison
+   //throws, *this stays sorted: only the elements already discarded are erased.
+   void subtract_unique(const flat_tree &x)
+   {
+      if(&x == this){
+         this->clear();
+         return;
+      }
+      const Compare &key_cmp = this->m_data.get_comp();
+      KeyOfValue key_extract;
+      this->priv_invalidate_index();
+      const iterator e(this->end());
+      iterator in(this->begin()), out(in);
+      BOOST_TRY{
+         for(const_iterator xit(x.cbegin()), xe(x.cend()); in != e; ++xit){
+            xit = x.priv_gallop_lower_bound(xit, xe, key_extract(*in));
+            if(xit == xe){
+               break;
+            }
+            //Elements less than *xit are kept
+            const iterator next(this->priv_gallop_lower_bound(in, e, key_extract(*xit)));
+            if(out == in){
+               out = in = next;
+            }
+            else{
+               for(; in != next; ++in, ++out){
+                  *out = boost::move(*in);
+               }
+            }
+            if(in != e && !key_cmp(key_extract(*xit), key_extract(*in))){
+               ++in;
+            }
+         }
+      }
+      BOOST_CATCH(...){
+         this->priv_close_gap(out, in);
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      this->priv_close_gap(out, in);
+      this->rebuild_index();
+   }
 
    friend bool operator==(const flat_tree& x, const flat_tree& y)
    {
@@ -719,6 +992,9 @@ class flat_tree
    friend bool operator!=(const flat_tree& x, const flat_tree& y)
       {  return !(x == y); }
 
+   friend std::size_t hash_value(const flat_tree& x)
+      {  return x.priv_hash(contiguous_t()); }
+
    friend bool operator>(const flat_tree& x, const flat_tree& y)
       {  return y < x;  }
 
@@ -826,14 +1102,146 @@ class flat_tree
    iterator priv_insert_commit
       (insert_commit_data &commit_data, BOOST_FWD_REF(Convertible) convertible)
    {
-      return this->m_data.m_vect.insert
+      this->priv_invalidate_index();
+      return this->m_data.m_seq.insert
          ( commit_data.position
          , boost::forward<Convertible>(convertible));
    }
 
-   template <class RanIt>
+   void priv_invalidate_index()
+   {  this->m_data.m_index.invalidate();  }
+
+   //[out, in) holds moved-from or discarded elements: moves [in, end()) down to out
+   //and erases the rest of the sequence
+   void priv_close_gap(iterator out, iterator in)
+   {
+      if(out != in){
+         for(const iterator e(this->end()); in != e; ++in, ++out){
+            *out = boost::move(*in);
+         }
+         this->m_data.m_seq.erase(out, this->cend());
+      }
+   }
+
+   iterator priv_iterator(const_iterator pos)
+   {  return this->begin() + (pos - this->cbegin());  }
+
+   //Lookups returning positions, served by the search index if it's up to date
+
+   template <class K>
+   size_type priv_lower_bound_pos(const K &k) const
+   {
+      return this->m_data.m_index.valid()
+         ? this->m_data.m_index.lower_bound(k, this->m_data.get_comp())
+         : size_type(this->priv_lower_bound(this->cbegin(), this->cend(), k) - this->cbegin());
+   }
+
+   template <class K>
+   size_type priv_upper_bound_pos(const K &k) const
+   {
+      return this->m_data.m_index.valid()
+         ? this->m_data.m_index.upper_bound(k, this->m_data.get_comp())
+         : size_type(this->priv_upper_bound(this->cbegin(), this->cend(), k) - this->cbegin());
+   }
+
+   template <class K>
+   size_type priv_find_pos(const K &k) const
+   {
+      if(this->m_data.m_index.valid()){
+         return this->m_data.m_index.find(k, this->m_data.get_comp());
+      }
+      const size_type n = this->size();
+      const size_type i = this->priv_lower_bound_pos(k);
+      return (i != n && this->m_data.get_comp()(k, KeyOfValue()(this->cbegin()[i]))) ? n : i;
+   }
+
+   template <class K>
+   std::pair<size_type, size_type> priv_equal_range_pos(const K &k) const
+   {
+      if(this->m_data.m_index.valid()){
+         return std::pair<size_type, size_type>
+            ( this->m_data.m_index.lower_bound(k, this->m_data.get_comp())
+            , this->m_data.m_index.upper_bound(k, this->m_data.get_comp()));
+      }
+      const const_iterator b(this->cbegin());
+      std::pair<const_iterator, const_iterator> r = this->priv_equal_range(b, this->cend(), k);
+      return std::pair<size_type, size_type>(size_type(r.first - b), size_type(r.second - b));
+   }
+
+   //Interleaves the binary searches of up to find_batch_size keys. All searches
+   //over the same range take the same number of steps, so they advance in
+   //lockstep and the next probe of each one is prefetched while the others
+   //are compared, keeping several cache misses in flight.
+   template <class RanIt, class KeyForwardIterator, class OutputIterator>
+   OutputIterator priv_find_batch
+      (const RanIt b, KeyForwardIterator first, const KeyForwardIterator last, OutputIterator out) const
+   {
+      const size_type n = this->size();
+      const RanIt e(b + n);
+      if(!n || this->m_data.m_index.valid()){
+         for(; first != last; ++first, ++out){
+            *out = b + this->priv_find_pos(*first);
+         }
+         return out;
+      }
+
+      const Compare &key_cmp = this->m_data.get_comp();
+      KeyOfValue key_extract;
+      KeyForwardIterator keys[container_detail::find_batch_size];
+      size_type base[container_detail::find_batch_size];
+      while(first != last){
+         std::size_t m = 0;
+         for(; m != container_detail::find_batch_size && first != last; ++m, ++first){
+            keys[m] = first;
+            base[m] = 0u;
+         }
+         for(size_type len = n; len > 1u; ){
+            const size_type half = len >> 1;
+            len -= half;
+            for(std::size_t i = 0; i != m; ++i){
+               const size_type mid = base[i] + half;
+               base[i] = key_cmp(key_extract(b[mid]), *keys[i]) ? mid : base[i];
+               BOOST_CONTAINER_PREFETCH(&*(b + (base[i] + (len >> 1))));
+            }
+         }
+         for(std::size_t i = 0; i != m; ++i, ++out){
+            const size_type pos = base[i] + size_type(key_cmp(key_extract(b[base[i]]), *keys[i]));
+            *out = (pos != n && !key_cmp(*keys[i], key_extract(b[pos]))) ? b + pos : e;
+         }
+      }
+      return out;
+   }
+
+   template <class K>
+   std::pair<size_type, size_type> priv_lower_bound_range_pos(const K &k) const
+   {
+      const size_type lb = this->priv_lower_bound_pos(k);
+      const size_type ub = (lb != this->size() && !this->m_data.get_comp()(k, KeyOfValue()(this->cbegin()[lb])))
+         ? lb + 1u : lb;
+      return std::pair<size_type, size_type>(lb, ub);
+   }
+
+   //Lower bound of k in [first, last) probing first[0], first[1], first[3], first[7]...
+   //before the binary search, so it takes O(log d) comparisons, d being the
+   //distance between first and the result
+   template <class RanIt, class K>
+   RanIt priv_gallop_lower_bound(RanIt first, const RanIt last, const K &k) const
+   {
+      const Compare &key_cmp = this->m_data.get_comp();
+      KeyOfValue key_extract;
+      size_type len = static_cast<size_type>(last - first);
+      size_type step = 1u;
+      while(step < len && key_cmp(key_extract(first[difference_type(step - 1u)]), k)){
+         first += difference_type(step);
+         len -= step;
+         step *= 2u;
+      }
+      return this->priv_lower_bound(first, first + difference_type(step < len ? step : len), k);
+   }
+
+   template <class RanIt, class K>
    RanIt priv_lower_bound(RanIt first, const RanIt last,
-                          const key_type & key) const
+                          const K & key) const
    {
       const Compare &key_cmp = this->m_data.get_comp();
       KeyOfValue key_extract;
@@ -856,9 +1264,9 @@ class flat_tree
       return first;
    }
 
-   template <class RanIt>
+   template <class RanIt, class K>
    RanIt priv_upper_bound
-      (RanIt first, const RanIt last,const key_type & key) const
+      (RanIt first, const RanIt last,const K & key) const
    {
       const Compare &key_cmp = this->m_data.get_comp();
       KeyOfValue key_extract;
@@ -881,9 +1289,9 @@ class flat_tree
       return first;
    }
 
-   template <class RanIt>
+   template <class RanIt, class K>
    std::pair<RanIt, RanIt>
-      priv_equal_range(RanIt first, RanIt last, const key_type& key) const
+      priv_equal_range(RanIt first, RanIt last, const K& key) const
    {
       const Compare &key_cmp = this->m_data.get_comp();
       KeyOfValue key_extract;
@@ -914,8 +1322,8 @@ class flat_tree
       return std::pair<RanIt, RanIt>(first, first);
    }
 
-   template<class RanIt>
-   std::pair<RanIt, RanIt> priv_lower_bound_range(RanIt first, RanIt last, const key_type& k) const
+   template<class RanIt, class K>
+   std::pair<RanIt, RanIt> priv_lower_bound_range(RanIt first, RanIt last, const K& k) const
    {
       const Compare &key_cmp = this->m_data.get_comp();
       KeyOfValue key_extract;
@@ -926,11 +1334,283 @@ class flat_tree
       return std::pair<RanIt, RanIt>(lb, ub);
    }
 
-   template<class InIt>
-   void priv_insert_equal_loop(InIt first, InIt last)
+   //Appends [first, last) to the vector, sorts the new tail (stable), removes
+   //elements already present if UniqueBool is true and merges the tail with
+   //the old sequence. O(NlogN + size()) instead of N insertions in the middle.
+   //If an exception is thrown the sequence stays sorted: the new elements
+   //not merged yet are erased.
+   template<class UniqueBool, class InIt>
+   void priv_insert_range(UniqueBool, InIt first, InIt last)
    {
-      for ( ; first != last; ++first){
-         this->insert_equal(*first);
+      sequence_t &v = this->m_data.m_seq;
+      const size_type old_size = v.size();
+      this->priv_invalidate_index();
+      BOOST_TRY{
+         //Input iterators are appended one by one, so a
+         //failure can leave some of them in the tail
+         v.insert(v.cend(), first, last);
+         if(old_size == v.size()){
+            return;
+         }
+         const iterator pbeg = v.begin();
+         const iterator pmid = pbeg + difference_type(old_size);
+         iterator pend = v.end();
+         if(!this->priv_is_sorted(pmid, pend)){
+            this->priv_stable_sort(pmid, pend);
+         }
+         if(UniqueBool::value){
+            pend = this->priv_remove_equivalent(pbeg, pmid, pend);
+            v.erase(pend, v.end());
+         }
+      }
+      BOOST_CATCH(...){
+         v.erase(v.cbegin() + difference_type(old_size), v.cend());
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      this->priv_merge_tail(old_size, growable_t());
+      this->rebuild_index();
+   }
+
+   //Ordered ranges are merged by the vector extensions when available
+   template<class UniqueBool, class BidirIt>
+   void priv_merge_ordered(UniqueBool, BidirIt first, BidirIt last, container_detail::true_type)
+   {
+      this->priv_invalidate_index();
+      if(UniqueBool::value){
+         this->m_data.m_seq.merge_unique(first, last);
+      }
+      else{
+         this->m_data.m_seq.merge(first, last);
+      }
+      this->rebuild_index();
+   }
+
+   template<class UniqueBool, class BidirIt>
+   void priv_merge_ordered(UniqueBool, BidirIt first, BidirIt last, container_detail::false_type)
+   {  this->priv_insert_range(UniqueBool(), first, last);  }
+
+   size_type priv_capacity(container_detail::true_type) const
+   {  return this->m_data.m_seq.capacity();  }
+
+   //A deque has no capacity: it grows by blocks without reallocating elements
+   size_type priv_capacity(container_detail::false_type) const
+   {  return this->m_data.m_seq.size();  }
+
+   void priv_reserve(size_type cnt, container_detail::true_type)
+   {  this->m_data.m_seq.reserve(cnt);  }
+
+   void priv_reserve(size_type, container_detail::false_type)
+   {}
+
+   std::size_t priv_hash(container_detail::true_type) const
+   {  return container_detail::hash_contiguous_range(this->m_data.m_seq.data(), this->size());  }
+
+   std::size_t priv_hash(container_detail::false_type) const
+   {  return container_detail::hash_range(this->m_data.m_seq.cbegin(), this->m_data.m_seq.cend());  }
+
+   //The index is built before adopting seq so that *this is unchanged if that throws
+   void priv_adopt_sequence(sequence_type &seq)
+   {
+      index_t index(this->get_allocator());
+      index.build(seq.cbegin(), size_type(seq.size()), KeyOfValue());
+      this->priv_invalidate_index();
+      this->m_data.m_seq = boost::move(seq);
+      this->m_data.m_index.swap(index);
+   }
+
+   template<class RanIt>
+   bool priv_is_sorted_unique(RanIt first, RanIt last) const
+   {
+      const value_compare &val_cmp = this->m_data;
+      if(first != last){
+         for(RanIt prev = first; ++first != last; prev = first){
+            if(!val_cmp(*prev, *first)){
+               return false;
+            }
+         }
+      }
+      return true;
+   }
+
+   template<class RanIt>
+   bool priv_is_sorted(RanIt first, RanIt last) const
+   {
+      const value_compare &val_cmp = this->m_data;
+      if(first != last){
+         for(RanIt prev = first; ++first != last; prev = first){
+            if(val_cmp(*first, *prev)){
+               return false;
+            }
+         }
+      }
+      return true;
+   }
+
+   //Sorts positions instead of values so that no auxiliary values need to be
+   //constructed, then moves each value to its final place following the
+   //cycles of the permutation.
+   void priv_stable_sort(const iterator first, const iterator last)
+   {
+      typedef typename allocator_traits_type::template
+         portable_rebind_alloc<size_type>::type                   index_allocator_t;
+      typedef boost::container::vector<size_type, index_allocator_t>  index_vector_t;
+      typedef flat_tree_index_compare<iterator, value_compare, size_type> index_compare_t;
+
+      const size_type n = static_cast<size_type>(last - first);
+      if(n < 2u){
+         return;
+      }
+      //The index is sized once, so filling it never reallocates
+      index_vector_t idx(n, default_init, index_allocator_t(this->get_allocator()));
+      size_type *const pidx = container_detail::to_raw_pointer(idx.data());
+      for(size_type i = 0; i != n; ++i){
+         pidx[i] = i;
+      }
+      std::sort(pidx, pidx + n, index_compare_t(first, this->m_data));
+      //pidx[i] holds the position of the value that must be placed in i
+      for(size_type i = 0; i != n; ++i){
+         if(pidx[i] != i){
+            value_type tmp(boost::move(first[difference_type(i)]));
+            size_type j = i;
+            for(size_type src = pidx[j]; src != i; src = pidx[j]){
+               first[difference_type(j)] = boost::move(first[difference_type(src)]);
+               pidx[j] = j;
+               j = src;
+            }
+            first[difference_type(j)] = boost::move(tmp);
+            pidx[j] = j;
+         }
+      }
+   }
+
+   //Compacts the sorted range [pmid, pend) removing elements equivalent
+   //to a previous one or to an element of the sorted range [pbeg, pmid)
+   iterator priv_remove_equivalent(iterator pbeg, const iterator pmid, const iterator pend)
+   {
+      const value_compare &val_cmp = this->m_data;
+      iterator out = pmid;
+      for(iterator it = pmid; it != pend; ++it){
+         if(out != pmid && !val_cmp(out[-1], *it)){
+            continue;
+         }
+         while(pbeg != pmid && val_cmp(*pbeg, *it)){
+            ++pbeg;
+         }
+         if(pbeg != pmid && !val_cmp(*it, *pbeg)){
+            continue;
+         }
+         if(out != it){
+            *out = boost::move(*it);
+         }
+         ++out;
+      }
+      return out;
+   }
+
+   //Merges the sorted ranges [begin(), begin() + old_size) and [begin() + old_size, end())
+   //of the sequence, placing old elements before equivalent new ones.
+   //Only the suffix of the old elements greater than the first new element is displaced.
+   //If an exception is thrown the sequence stays sorted and keeps all the old elements:
+   //new elements not merged yet are erased.
+   //
+   //The new elements are moved to a vector sized to them and merged backwards.
+   void priv_merge_tail(const size_type old_size, container_detail::true_type)
+   {
+      typedef typename allocator_traits_type::template
+         portable_rebind_alloc<value_type>::type                  buffer_allocator_t;
+      typedef boost::container::vector<value_type, buffer_allocator_t> buffer_t;
+      typedef typename buffer_t::iterator                         buffer_iterator;
+
+      sequence_t &v = this->m_data.m_seq;
+      const value_compare &val_cmp = this->m_data;
+      buffer_t buf(buffer_allocator_t(this->get_allocator()));
+      iterator p = iterator(), d = iterator();
+      bool merging = false;
+      BOOST_TRY{
+         const iterator pbeg = v.begin();
+         const iterator pmid = pbeg + difference_type(old_size);
+         const iterator pend = v.end();
+         if(pbeg == pmid || pmid == pend || !val_cmp(*pmid, pmid[-1])){
+            return;
+         }
+         const iterator plow = this->priv_upper_bound(pbeg, pmid, KeyOfValue()(*pmid));
+         buf.insert(buf.cend(), boost::make_move_iterator(pmid), boost::make_move_iterator(pend));
+         const buffer_iterator bbeg = buf.begin();
+         buffer_iterator b = buf.end();
+         p = pmid;
+         d = pend;
+         //Nothing is displaced until all the new elements are in the buffer
+         merging = true;
+         while(b != bbeg){
+            if(p != plow && val_cmp(b[-1], p[-1])){
+               *--d = boost::move(*--p);
+            }
+            else{
+               *--d = boost::move(*--b);
+            }
+         }
+      }
+      BOOST_CATCH(...){
+         if(!merging){
+            //Thrown before merging: drop the new elements
+            v.erase(v.cbegin() + difference_type(old_size), v.cend());
+         }
+         else{
+            //[begin(), p) and [d, end()) are sorted and the elements of [d, end())
+            //are not less than the old ones in [begin(), p). Close the gap between them.
+            for(const iterator pend = v.end(); d != pend; ++d, ++p){
+               *p = boost::move(*d);
+            }
+            v.erase(p, v.end());
+         }
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+   }
+
+   //A fixed capacity sequence is merged in place: each block of new elements less
+   //than the first old element not merged yet is rotated into place, so [begin(), pmid)
+   //is sorted after each step and no buffer is needed. Moves are quadratic in the
+   //worst case but bounded by the capacity.
+   void priv_merge_tail(const size_type old_size, container_detail::false_type)
+   {
+      sequence_t &v = this->m_data.m_seq;
+      const value_compare &val_cmp = this->m_data;
+      KeyOfValue key_extract;
+      const iterator pend = v.end();
+      iterator pmid = v.begin() + difference_type(old_size);
+      BOOST_TRY{
+         iterator plow = v.begin();
+         //[plow, pmid) holds the old elements not merged yet
+         while(plow != pmid && pmid != pend && val_cmp(*pmid, pmid[-1])){
+            plow = this->priv_upper_bound(plow, pmid, key_extract(*pmid));
+            const iterator pnew = this->priv_lower_bound(pmid, pend, key_extract(*plow));
+            priv_rotate(plow, pmid, pnew);
+            plow += pnew - pmid;
+            pmid = pnew;
+         }
+      }
+      BOOST_CATCH(...){
+         v.erase(pmid, v.cend());
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+   }
+
+   //Swaps [first, middle) and [middle, last) reversing both ranges and then the whole one
+   static void priv_rotate(iterator first, const iterator middle, const iterator last)
+   {
+      priv_reverse(first, middle);
+      priv_reverse(middle, last);
+      priv_reverse(first, last);
+   }
+
+   static void priv_reverse(iterator first, iterator last)
+   {
+      while(first != last && first != --last){
+         boost::adl_move_swap(*first, *last);
+         ++first;
       }
    }
 
@@ -945,6 +1625,7 @@ class flat_tree
          pos = this->insert_equal(pos, *first);
          ++pos;
       }
+      this->rebuild_index();
    }
 };
 
@@ -955,8 +1636,8 @@ class flat_tree
 //!has_trivial_destructor_after_move<> == true_type
 //!specialization for optimizations
 template <class Key, class T, class KeyOfValue,
-class Compare, class Allocator>
-struct has_trivial_destructor_after_move<boost::container::container_detail::flat_tree<Key, T, KeyOfValue, Compare, Allocator> >
+class Compare, class Allocator, class Options>
+struct has_trivial_destructor_after_move<boost::container::container_detail::flat_tree<Key, T, KeyOfValue, Compare, Allocator, Options> >
 {
    typedef typename ::boost::container::allocator_traits<Allocator>::pointer pointer;
    static const bool value = ::boost::has_trivial_destructor_after_move<Allocator>::value &&
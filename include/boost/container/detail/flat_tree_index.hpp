@@ -0,0 +1,314 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_FLAT_TREE_INDEX_HPP
+#define BOOST_CONTAINER_FLAT_TREE_INDEX_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/vector.hpp>
+// container/detail
+#include <boost/container/detail/to_raw_pointer.hpp>
+// move
+#include <boost/move/utility_core.hpp>
+#include <boost/move/adl_move_swap.hpp>
+// std
+#include <cstddef>
+
+#if defined(BOOST_MSVC)
+#  include <intrin.h>
+#endif
+
+namespace boost {
+namespace container {
+namespace container_detail {
+
+//Number of trailing one bits of k plus one, that is, the number of levels
+//to climb from the end of an Eytzinger descent to the last left turn.
+inline unsigned flat_tree_index_climb(std::size_t k)
+{
+   k = ~k;
+   #if defined(__GNUC__)
+   return unsigned(__builtin_ctzll(static_cast<unsigned long long>(k))) + 1u;
+   #elif defined(BOOST_MSVC) && defined(_WIN64)
+   unsigned long r;
+   _BitScanForward64(&r, k);
+   return unsigned(r) + 1u;
+   #else
+   unsigned n = 1u;
+   while(!(k & 1u)){
+      k >>= 1u;
+      ++n;
+   }
+   return n;
+   #endif
+}
+
+//Secondary search index for flat_tree. A copy of the keys is stored in
+//Eytzinger (breadth-first) order: the children of slot k are slots 2k and 2k+1
+//and slot 0 is unused, so the 2^L descendants of a node L levels below it
+//are contiguous. A descent makes no unpredictable branches and prefetches the
+//cache line holding the node several levels ahead, so the cost of a search is
+//dominated by a few overlapping cache misses instead of log2(N) serial ones.
+//
+//The tree is perfect: it's padded with copies of the greatest key up to
+//2^height - 1 slots. Then the slot reached below the leaves, minus 2^height,
+//is the number of keys that compare less, so no rank table has to be
+//looked up to translate a result into a position of the sorted sequence.
+//
+//The index is not maintained on insertion or erasure of single elements: it's
+//invalidated and rebuilt in linear time by bulk operations or on request.
+//Lookups only read it, so concurrent lookups don't race.
+template<class Key, class Allocator, bool Enabled>
+class flat_tree_search_index
+{
+   typedef allocator_traits<Allocator>                               allocator_traits_type;
+   public:
+   typedef typename allocator_traits_type::size_type                 size_type;
+
+   private:
+   typedef typename allocator_traits_type::template
+      portable_rebind_alloc<Key>::type                               key_allocator_t;
+   typedef boost::container::vector<Key, key_allocator_t>            key_vector_t;
+
+   BOOST_COPYABLE_AND_MOVABLE(flat_tree_search_index)
+
+   //Keys per cache line: the node prefetched during the descent
+   //is the first one of the line containing all its descendants
+   //log2(prefetch_stride) levels below.
+   static const size_type prefetch_stride = sizeof(Key) < 64u ? size_type(64u/sizeof(Key)) : 1u;
+
+   public:
+   flat_tree_search_index()
+      : m_keys(), m_size(0u), m_height(0u), m_valid(false)
+   {}
+
+   explicit flat_tree_search_index(const Allocator &a)
+      : m_keys(key_allocator_t(a)), m_size(0u), m_height(0u), m_valid(false)
+   {}
+
+   flat_tree_search_index(const flat_tree_search_index &x)
+      : m_keys(x.m_keys), m_size(x.m_size), m_height(x.m_height), m_valid(x.m_valid)
+   {}
+
+   flat_tree_search_index(BOOST_RV_REF(flat_tree_search_index) x)
+      : m_keys(boost::move(x.m_keys)), m_size(x.m_size), m_height(x.m_height), m_valid(x.m_valid)
+   {  x.invalidate();  }
+
+   flat_tree_search_index& operator=(BOOST_COPY_ASSIGN_REF(flat_tree_search_index) x)
+   {
+      if(&x != this){
+         //Invalidate first so that an exception leaves a consistent object
+         this->invalidate();
+         m_keys   = x.m_keys;
+         m_size   = x.m_size;
+         m_height = x.m_height;
+         m_valid  = x.m_valid;
+      }
+      return *this;
+   }
+
+   flat_tree_search_index& operator=(BOOST_RV_REF(flat_tree_search_index) x)
+   {
+      if(&x != this){
+         this->invalidate();
+         m_keys   = boost::move(x.m_keys);
+         m_size   = x.m_size;
+         m_height = x.m_height;
+         m_valid  = x.m_valid;
+         x.invalidate();
+      }
+      return *this;
+   }
+
+   void swap(flat_tree_search_index &x)
+   {
+      m_keys.swap(x.m_keys);
+      boost::adl_move_swap(m_size, x.m_size);
+      boost::adl_move_swap(m_height, x.m_height);
+      boost::adl_move_swap(m_valid, x.m_valid);
+   }
+
+   bool valid() const
+   {  return m_valid;  }
+
+   //Memory is kept to be reused by the next rebuild
+   void invalidate()
+   {  m_valid = false;  }
+
+   void clear()
+   {
+      this->invalidate();
+      key_vector_t().swap(m_keys);
+      m_size = 0u;
+      m_height = 0u;
+   }
+
+   //Builds the index from the sorted range [first, first + n)
+   template<class RanIt, class KeyOfValue>
+   void build(RanIt first, size_type n, KeyOfValue key_of_value)
+   {
+      this->invalidate();
+      m_keys.clear();
+      m_size = 0u;
+      m_height = 0u;
+      if(n){
+         unsigned height = 0u;
+         while((size_type(1u) << height) <= n){
+            ++height;
+         }
+         const size_type slots = size_type(1u) << height;
+         m_keys.reserve(slots);
+         //Slot 0 is never searched, it only aligns the children of slot k at 2k
+         m_keys.push_back(key_of_value(first[0]));
+         for(unsigned depth = 0u; depth != height; ++depth){
+            //Nodes of a level are in order and 2^(height-depth) positions apart
+            const size_type level_size = size_type(1u) << depth;
+            const unsigned  shift = height - depth;
+            for(size_type i = 0u; i != level_size; ++i){
+               const size_type rank = (((i << 1u) + 1u) << (shift - 1u)) - 1u;
+               m_keys.push_back(key_of_value(first[rank < n ? rank : n - 1u]));
+            }
+         }
+         m_size = n;
+         m_height = height;
+      }
+      m_valid = true;
+   }
+
+   //Returns the position of the first key not less than key, or size()
+   template<class K, class KeyCompare>
+   size_type lower_bound(const K &key, const KeyCompare &comp) const
+   {
+      const Key *const keys = container_detail::to_raw_pointer(m_keys.data());
+      const size_type leaves = size_type(1u) << m_height;
+      size_type k = 1u;
+      while(k < leaves){
+         this->priv_prefetch(keys, k, leaves);
+         k = 2u*k + size_type(comp(keys[k], key));
+      }
+      return this->priv_position(k - leaves);
+   }
+
+   //Returns the position of the first key greater than key, or size()
+   template<class K, class KeyCompare>
+   size_type upper_bound(const K &key, const KeyCompare &comp) const
+   {
+      const Key *const keys = container_detail::to_raw_pointer(m_keys.data());
+      const size_type leaves = size_type(1u) << m_height;
+      size_type k = 1u;
+      while(k < leaves){
+         this->priv_prefetch(keys, k, leaves);
+         k = 2u*k + size_type(!comp(key, keys[k]));
+      }
+      return this->priv_position(k - leaves);
+   }
+
+   //Returns the position of a key equivalent to key, or size(). The key
+   //found by the descent is compared instead of the sorted sequence's one, as
+   //it's already in cache.
+   template<class K, class KeyCompare>
+   size_type find(const K &key, const KeyCompare &comp) const
+   {
+      const Key *const keys = container_detail::to_raw_pointer(m_keys.data());
+      const size_type leaves = size_type(1u) << m_height;
+      size_type k = 1u;
+      while(k < leaves){
+         this->priv_prefetch(keys, k, leaves);
+         k = 2u*k + size_type(comp(keys[k], key));
+      }
+      const size_type pos = this->priv_position(k - leaves);
+      k >>= flat_tree_index_climb(k);
+      return (pos != m_size && !comp(key, keys[k])) ? pos : m_size;
+   }
+
+   size_type size() const
+   {  return m_size;   }
+
+   private:
+   //Positions past the last key belong to the padding
+   size_type priv_position(size_type pos) const
+   {  return pos < m_size ? pos : m_size;  }
+
+   static void priv_prefetch(const Key *keys, size_type k, size_type leaves)
+   {
+      const size_type ahead = k*prefetch_stride;
+      if(ahead < leaves){
+         BOOST_CONTAINER_PREFETCH(keys + ahead);
+      }
+      (void)keys;
+   }
+
+   key_vector_t   m_keys;
+   size_type      m_size;
+   unsigned       m_height;
+   bool           m_valid;
+};
+
+//Default: no index. Lookups always use a binary search over the sorted sequence.
+template<class Key, class Allocator>
+class flat_tree_search_index<Key, Allocator, false>
+{
+   public:
+   typedef typename allocator_traits<Allocator>::size_type size_type;
+
+   flat_tree_search_index()
+   {}
+
+   explicit flat_tree_search_index(const Allocator &)
+   {}
+
+   void swap(flat_tree_search_index &)
+   {}
+
+   bool valid() const
+   {  return false;  }
+
+   void invalidate()
+   {}
+
+   void clear()
+   {}
+
+   template<class RanIt, class KeyOfValue>
+   void build(RanIt, size_type, KeyOfValue)
+   {}
+
+   template<class K, class KeyCompare>
+   size_type lower_bound(const K &, const KeyCompare &) const
+   {  return 0u;  }
+
+   template<class K, class KeyCompare>
+   size_type upper_bound(const K &, const KeyCompare &) const
+   {  return 0u;  }
+
+   template<class K, class KeyCompare>
+   size_type find(const K &, const KeyCompare &) const
+   {  return 0u;  }
+};
+
+}  //namespace container_detail {
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //#ifndef BOOST_CONTAINER_FLAT_TREE_INDEX_HPP
@@ -0,0 +1,231 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_FLAT_TREE_SEQUENCE_HPP
+#define BOOST_CONTAINER_FLAT_TREE_SEQUENCE_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/container/small_vector.hpp>
+#include <boost/container/static_vector.hpp>
+#include <boost/container/deque.hpp>
+// container/detail
+#include <boost/container/detail/mpl.hpp>
+// move
+#include <boost/move/utility_core.hpp>
+#include <boost/move/adl_move_swap.hpp>
+// other
+#include <boost/static_assert.hpp>
+// std
+#include <cstddef>
+
+namespace boost {
+namespace container {
+namespace container_detail {
+
+//flat_tree constructs its sequence from the allocator of the container
+//and exposes it as the stored allocator. small_vector stores a
+//small_vector_allocator<Allocator> that can't be implicitly built from
+//Allocator, so it's adapted here.
+template<class Value, std::size_t N, class Allocator>
+class flat_tree_small_sequence
+   : public small_vector<Value, N, Allocator>
+{
+   typedef small_vector<Value, N, Allocator>    base_t;
+   typedef typename base_t::allocator_type      base_allocator_t;
+
+   BOOST_COPYABLE_AND_MOVABLE(flat_tree_small_sequence)
+
+   public:
+   typedef Allocator                            allocator_type;
+   typedef Allocator                            stored_allocator_type;
+
+   flat_tree_small_sequence()
+      : base_t()
+   {}
+
+   explicit flat_tree_small_sequence(const allocator_type &a)
+      : base_t(base_allocator_t(a))
+   {}
+
+   flat_tree_small_sequence(const flat_tree_small_sequence &x)
+      : base_t(x)
+   {}
+
+   flat_tree_small_sequence(const flat_tree_small_sequence &x, const allocator_type &a)
+      : base_t(x, base_allocator_t(a))
+   {}
+
+   flat_tree_small_sequence(BOOST_RV_REF(flat_tree_small_sequence) x)
+      : base_t(BOOST_MOVE_BASE(base_t, x))
+   {}
+
+   flat_tree_small_sequence(BOOST_RV_REF(flat_tree_small_sequence) x, const allocator_type &a)
+      : base_t(BOOST_MOVE_BASE(base_t, x), base_allocator_t(a))
+   {}
+
+   flat_tree_small_sequence& operator=(BOOST_COPY_ASSIGN_REF(flat_tree_small_sequence) x)
+   {
+      this->base_t::operator=(static_cast<const base_t&>(x));
+      return *this;
+   }
+
+   flat_tree_small_sequence& operator=(BOOST_RV_REF(flat_tree_small_sequence) x)
+   {
+      this->base_t::operator=(BOOST_MOVE_BASE(base_t, x));
+      return *this;
+   }
+
+   void swap(flat_tree_small_sequence &x)
+   {  this->base_t::swap(x);  }
+
+   allocator_type get_allocator() const
+   {  return this->get_stored_allocator();  }
+
+   const stored_allocator_type &get_stored_allocator() const
+   {  return this->base_t::get_stored_allocator();  }
+
+   stored_allocator_type &get_stored_allocator()
+   {  return this->base_t::get_stored_allocator();  }
+};
+
+//static_vector takes no allocator: the allocator of the container is kept
+//aside so that get_allocator() and get_stored_allocator() still work and
+//auxiliary buffers (e.g. the search index) can be allocated.
+template<class Value, std::size_t Capacity, class Allocator>
+class flat_tree_static_sequence
+   : public static_vector<Value, Capacity>
+{
+   typedef static_vector<Value, Capacity>       base_t;
+
+   BOOST_COPYABLE_AND_MOVABLE(flat_tree_static_sequence)
+
+   public:
+   typedef Allocator                            allocator_type;
+   typedef Allocator                            stored_allocator_type;
+
+   flat_tree_static_sequence()
+      : base_t(), m_alloc()
+   {}
+
+   explicit flat_tree_static_sequence(const allocator_type &a)
+      : base_t(), m_alloc(a)
+   {}
+
+   flat_tree_static_sequence(const flat_tree_static_sequence &x)
+      : base_t(x), m_alloc(x.m_alloc)
+   {}
+
+   flat_tree_static_sequence(const flat_tree_static_sequence &x, const allocator_type &a)
+      : base_t(x), m_alloc(a)
+   {}
+
+   flat_tree_static_sequence(BOOST_RV_REF(flat_tree_static_sequence) x)
+      : base_t(BOOST_MOVE_BASE(base_t, x)), m_alloc(x.m_alloc)
+   {}
+
+   flat_tree_static_sequence(BOOST_RV_REF(flat_tree_static_sequence) x, const allocator_type &a)
+      : base_t(BOOST_MOVE_BASE(base_t, x)), m_alloc(a)
+   {}
+
+   flat_tree_static_sequence& operator=(BOOST_COPY_ASSIGN_REF(flat_tree_static_sequence) x)
+   {
+      this->base_t::operator=(static_cast<const base_t&>(x));
+      return *this;
+   }
+
+   flat_tree_static_sequence& operator=(BOOST_RV_REF(flat_tree_static_sequence) x)
+   {
+      this->base_t::operator=(BOOST_MOVE_BASE(base_t, x));
+      return *this;
+   }
+
+   void swap(flat_tree_static_sequence &x)
+   {
+      this->base_t::swap(x);
+      boost::adl_move_swap(m_alloc, x.m_alloc);
+   }
+
+   allocator_type get_allocator() const
+   {  return m_alloc;  }
+
+   const stored_allocator_type &get_stored_allocator() const
+   {  return m_alloc;  }
+
+   stored_allocator_type &get_stored_allocator()
+   {  return m_alloc;  }
+
+   private:
+   allocator_type m_alloc;
+};
+
+//Selects the sequence that stores the values of a flat_tree.
+//"contiguous" is true if the sequence stores values in a single array
+//(data(), capacity() and reserve() are available), "mergeable" if
+//it offers the ordered range merge extensions of vector and "growable"
+//if its size is not bounded by a fixed capacity, so that the merge
+//of new elements can use a heap-allocated buffer.
+template<class Value, class Allocator, sequence_storage_enum SequenceStorage, std::size_t Capacity>
+struct flat_tree_sequence
+{
+   typedef boost::container::vector<Value, Allocator>                 type;
+   typedef true_type                                                  contiguous;
+   typedef true_type                                                  mergeable;
+   typedef true_type                                                  growable;
+};
+
+template<class Value, class Allocator, std::size_t Capacity>
+struct flat_tree_sequence<Value, Allocator, small_vector_sequence, Capacity>
+{
+   BOOST_STATIC_ASSERT_MSG(Capacity != 0u, "sequence_capacity must be specified for small_vector_sequence");
+   typedef flat_tree_small_sequence<Value, Capacity, Allocator>       type;
+   typedef true_type                                                  contiguous;
+   typedef true_type                                                  mergeable;
+   typedef true_type                                                  growable;
+};
+
+template<class Value, class Allocator, std::size_t Capacity>
+struct flat_tree_sequence<Value, Allocator, static_vector_sequence, Capacity>
+{
+   BOOST_STATIC_ASSERT_MSG(Capacity != 0u, "sequence_capacity must be specified for static_vector_sequence");
+   typedef flat_tree_static_sequence<Value, Capacity, Allocator>      type;
+   typedef true_type                                                  contiguous;
+   typedef false_type                                                 mergeable;
+   typedef false_type                                                 growable;
+};
+
+template<class Value, class Allocator, std::size_t Capacity>
+struct flat_tree_sequence<Value, Allocator, deque_sequence, Capacity>
+{
+   typedef boost::container::deque<Value, Allocator>                  type;
+   typedef false_type                                                 contiguous;
+   typedef false_type                                                 mergeable;
+   typedef true_type                                                  growable;
+};
+
+}  //namespace container_detail {
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //#ifndef BOOST_CONTAINER_FLAT_TREE_SEQUENCE_HPP
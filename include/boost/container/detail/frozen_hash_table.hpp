@@ -0,0 +1,740 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_FROZEN_HASH_TABLE_HPP
+#define BOOST_CONTAINER_FROZEN_HASH_TABLE_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/throw_exception.hpp>
+#include <boost/container/vector.hpp>
+// container/detail
+#include <boost/container/detail/alloc_helpers.hpp>
+#include <boost/container/detail/flat_hash_table.hpp>   //flat_hash_internal_data_type
+#include <boost/container/detail/hash.hpp>
+#include <boost/container/detail/iterator.hpp>
+#include <boost/container/detail/iterators.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/to_raw_pointer.hpp>
+#include <boost/container/detail/type_traits.hpp>
+// intrusive
+#include <boost/intrusive/pointer_traits.hpp>
+#include <boost/intrusive/detail/minimal_pair_header.hpp>      //pair
+// move
+#include <boost/move/utility_core.hpp>
+#include <boost/move/adl_move_swap.hpp>
+#include <boost/move/iterator.hpp>
+// other
+#include <boost/core/no_exceptions_support.hpp>
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+// std
+#include <algorithm> //std::sort
+#include <cstring>   //std::memcpy
+
+namespace boost {
+namespace container {
+namespace container_detail {
+
+//Frozen tables are built once with the "hash and displace" (CHD) scheme: keys
+//are distributed in buckets of about keys_per_bucket keys and, starting from the
+//largest bucket, a seed is searched for each bucket so that the keys of the bucket
+//land in free slots of a table of exactly size() slots. Buckets holding a single key
+//store the index of their slot instead of a seed. A lookup hashes the key once,
+//reads the seed of its bucket and compares the key against the only candidate slot.
+//Different keys with equal hash values can't be separated by any seed: all but one of
+//them are stored in overflow slots that follow the table and are only compared when the
+//key of their candidate slot is not the one looked up.
+struct frozen_hash_impl
+{
+   static const boost::uint32_t direct_slot     = 0x80000000u;
+   static const boost::uint32_t dropped_slot    = 0xFFFFFFFFu;
+   static const std::size_t     keys_per_bucket = 2u;
+   static const std::size_t     max_elements    = 0x7FFFFFFFu;
+   static const boost::uint32_t max_seed_tries  = 1u << 22u;
+   static const unsigned        max_salts       = 16u;
+
+   enum build_result { build_ok, build_retry };
+
+   //Bijective mixer (the splitmix64 finalizer): values obtained from different
+   //hash values are always different.
+   static boost::uint64_t mix(boost::uint64_t z)
+   {
+      z = (z ^ (z >> 30u)) * 0xbf58476d1ce4e5b9ULL;
+      z = (z ^ (z >> 27u)) * 0x94d049bb133111ebULL;
+      return z ^ (z >> 31u);
+   }
+
+   //Maps v to [0, n) with a multiplication instead of a division
+   static std::size_t reduce(boost::uint32_t v, std::size_t n)
+   {  return std::size_t((boost::uint64_t(v) * boost::uint64_t(n)) >> 32u);  }
+
+   static std::size_t bucket(boost::uint64_t x, std::size_t bucket_count)
+   {  return reduce(boost::uint32_t(x), bucket_count);  }
+
+   static std::size_t slot(boost::uint64_t x, boost::uint32_t seed, std::size_t n)
+   {
+      return (seed & direct_slot) ? std::size_t(seed & ~direct_slot)
+         : reduce(boost::uint32_t(mix(x + seed*0x9e3779b97f4a7c15ULL) >> 32u), n);
+   }
+
+   //x holds the mixed hash values of n elements. Elements whose mixed values are equal
+   //are compared with eq(i, j): equal elements are duplicates and only the first one is kept
+   //(slots[i] is dropped_slot for the rest). Otherwise, as no seed can separate them, the
+   //later ones become overflow elements. If all keys are known to be unique (eq is null)
+   //elements with equal values are never compared. On success the seed of every bucket and
+   //the slot of every element are written and size holds the number of kept elements.
+   //Overflow elements take the last slots sorted by the slot of the element they collide
+   //with, which is stored in overflow.
+   template<class Equal>
+   static build_result build( const boost::uint64_t *x, std::size_t n, std::size_t bucket_count, const Equal *eq
+                            , boost::uint32_t *seeds, boost::uint32_t *slots, vector<boost::uint32_t> &overflow
+                            , std::size_t &size)
+   {
+      typedef vector<std::size_t> index_vector;
+      //Counting sort of the elements by bucket
+      index_vector start(bucket_count + 1u, 0u);
+      for(std::size_t i = 0; i != n; ++i){
+         ++start[bucket(x[i], bucket_count) + 1u];
+      }
+      for(std::size_t b = 0; b != bucket_count; ++b){
+         start[b + 1u] += start[b];
+      }
+      //Elements are inserted in each bucket sorted by mixed value so that duplicates are adjacent
+      index_vector elems(n), bsize(bucket_count, 0u), ov_elems, ov_reps;
+      size = n;
+      std::size_t max_bsize = 0u;
+      for(std::size_t i = 0; i != n; ++i){
+         const std::size_t b = bucket(x[i], bucket_count);
+         std::size_t *const first = &elems[start[b]];
+         std::size_t j = bsize[b];
+         while(j && x[first[j - 1u]] > x[i]){
+            first[j] = first[j - 1u];
+            --j;
+         }
+         if(j && x[first[j - 1u]] == x[i]){
+            const std::size_t r = first[j - 1u];
+            //Undo the shift
+            for(; j != bsize[b]; ++j){
+               first[j] = first[j + 1u];
+            }
+            //Duplicates of r or of an element that overflowed from r are dropped
+            bool dup = eq && (*eq)(r, i);
+            for(std::size_t k = 0; eq && !dup && k != ov_elems.size(); ++k){
+               dup = ov_reps[k] == r && (*eq)(ov_elems[k], i);
+            }
+            if(dup){
+               slots[i] = dropped_slot;
+               --size;
+            }
+            else{
+               ov_elems.push_back(i);
+               ov_reps.push_back(r);
+            }
+            continue;
+         }
+         first[j] = i;
+         if(++bsize[b] > max_bsize){
+            max_bsize = bsize[b];
+         }
+      }
+
+      //Order buckets by decreasing size (counting sort)
+      index_vector size_start(max_bsize + 2u, 0u), order(bucket_count);
+      for(std::size_t b = 0; b != bucket_count; ++b){
+         ++size_start[max_bsize - bsize[b] + 1u];
+      }
+      for(std::size_t s = 0; s != max_bsize + 1u; ++s){
+         size_start[s + 1u] += size_start[s];
+      }
+      for(std::size_t b = 0; b != bucket_count; ++b){
+         order[size_start[max_bsize - bsize[b]]++] = b;
+      }
+
+      //Only elements that didn't overflow are placed by the seeds
+      const std::size_t table_size = size - ov_elems.size();
+      vector<unsigned char> taken(table_size, 0u);
+      index_vector cand(max_bsize);
+      std::size_t o = 0u;
+      //Search a seed for buckets with several elements
+      for(; o != bucket_count && bsize[order[o]] > 1u; ++o){
+         const std::size_t b = order[o], bs = bsize[b];
+         const std::size_t *const first = &elems[start[b]];
+         boost::uint32_t seed = 0u;
+         for(;; ++seed){
+            if(seed == max_seed_tries){
+               return build_retry;
+            }
+            std::size_t j = 0u;
+            for(; j != bs; ++j){
+               const std::size_t s = slot(x[first[j]], seed, table_size);
+               if(taken[s])
+                  break;
+               taken[s] = 1u;
+               cand[j] = s;
+            }
+            if(j == bs)
+               break;
+            while(j){
+               taken[cand[--j]] = 0u;
+            }
+         }
+         seeds[b] = seed;
+         for(std::size_t j = 0; j != bs; ++j){
+            slots[first[j]] = boost::uint32_t(cand[j]);
+         }
+      }
+      //Single element buckets take the remaining free slots
+      std::size_t free_slot = 0u;
+      for(; o != bucket_count && bsize[order[o]] == 1u; ++o){
+         const std::size_t b = order[o];
+         while(taken[free_slot]){
+            ++free_slot;
+         }
+         taken[free_slot] = 1u;
+         seeds[b] = direct_slot | boost::uint32_t(free_slot);
+         slots[elems[start[b]]] = boost::uint32_t(free_slot);
+      }
+      //Missing keys that fall in empty buckets are compared against some valid slot
+      for(; o != bucket_count; ++o){
+         seeds[order[o]] = 0u;
+      }
+      overflow.clear();
+      if(!ov_elems.empty()){
+         typedef std::pair<boost::uint32_t, std::size_t> ov_pair;
+         vector<ov_pair> ov;
+         ov.reserve(ov_elems.size());
+         for(std::size_t k = 0; k != ov_elems.size(); ++k){
+            ov.push_back(ov_pair(slots[ov_reps[k]], ov_elems[k]));
+         }
+         std::sort(ov.begin(), ov.end());
+         overflow.reserve(ov.size());
+         for(std::size_t k = 0; k != ov.size(); ++k){
+            slots[ov[k].second] = boost::uint32_t(table_size + k);
+            overflow.push_back(ov[k].first);
+         }
+      }
+      return build_ok;
+   }
+};
+
+template <class Key, class Value, class KeyOfValue,
+          class Hash, class Pred, class Allocator>
+class frozen_hash_table
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   typedef typename flat_hash_internal_data_type<Value>::type                       internal_type;
+   typedef allocator_traits<Allocator>                                              value_allocator_traits;
+   typedef typename value_allocator_traits::template
+      portable_rebind_alloc<internal_type>::type                                    slot_allocator_type;
+   typedef allocator_traits<slot_allocator_type>                                    slot_allocator_traits;
+   typedef typename slot_allocator_traits::pointer                                  slot_pointer;
+   typedef frozen_hash_table<Key, Value, KeyOfValue, Hash, Pred, Allocator>        ThisType;
+   BOOST_COPYABLE_AND_MOVABLE(frozen_hash_table)
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   typedef Key                                                                      key_type;
+   typedef Value                                                                    value_type;
+   typedef Hash                                                                     hasher;
+   typedef Pred                                                                     key_equal;
+   typedef Allocator                                                                allocator_type;
+   typedef Allocator                                                                stored_allocator_type;
+   typedef typename value_allocator_traits::pointer                                 pointer;
+   typedef typename value_allocator_traits::const_pointer                           const_pointer;
+   typedef typename value_allocator_traits::reference                               reference;
+   typedef typename value_allocator_traits::const_reference                         const_reference;
+   typedef typename value_allocator_traits::size_type                               size_type;
+   typedef typename value_allocator_traits::difference_type                         difference_type;
+   //Elements can't be modified: both iterator types are constant
+   typedef vec_iterator<pointer, true>                                              iterator;
+   typedef vec_iterator<pointer, true>                                              const_iterator;
+   typedef internal_type                                                            movable_value_type;
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   //A single allocation holds size() slots, the last m_overflow ones being overflow slots,
+   //followed by the bucket seeds and by the candidate slot of each overflow slot
+   struct members_holder
+      : public Allocator
+   {
+      members_holder()
+         : Allocator(), m_slots(), m_size(0u), m_bucket_count(0u), m_overflow(0u), m_salt(0u), m_hasher(), m_key_eq()
+      {}
+
+      template<class AllocConvertible>
+      members_holder(BOOST_FWD_REF(AllocConvertible) a, const hasher &hf, const key_equal &eql)
+         : Allocator(boost::forward<AllocConvertible>(a)), m_slots(), m_size(0u), m_bucket_count(0u)
+         , m_overflow(0u), m_salt(0u), m_hasher(hf), m_key_eq(eql)
+      {}
+
+      slot_pointer      m_slots;
+      size_type         m_size;
+      size_type         m_bucket_count;
+      size_type         m_overflow;
+      boost::uint64_t   m_salt;
+      hasher            m_hasher;
+      key_equal         m_key_eq;
+   } m_members;
+
+   template<class FwdIt>
+   struct key_equal_at
+   {
+      key_equal_at(const FwdIt *its, const key_equal &eq)
+         : m_its(its), m_eq(eq)
+      {}
+
+      bool operator()(std::size_t i, std::size_t j) const
+      {  return m_eq(KeyOfValue()(*m_its[i]), KeyOfValue()(*m_its[j]));  }
+
+      const FwdIt *m_its;
+      const key_equal &m_eq;
+   };
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+
+   frozen_hash_table()
+      : m_members()
+   {}
+
+   explicit frozen_hash_table(const allocator_type& a)
+      : m_members(a, hasher(), key_equal())
+   {}
+
+   //If unique is true [first, last) can't contain equivalent keys
+   template<class InputIterator>
+   frozen_hash_table( bool unique, InputIterator first, InputIterator last
+                    , const hasher &hf, const key_equal &eql, const allocator_type& a)
+      : m_members(a, hf, eql)
+   {
+      this->priv_build(unique, first, last,
+         container_detail::bool_<container_detail::is_input_iterator<InputIterator>::value>());
+   }
+
+   frozen_hash_table(const frozen_hash_table& x)
+      : m_members( value_allocator_traits::select_on_container_copy_construction(x.m_members)
+                 , x.m_members.m_hasher, x.m_members.m_key_eq)
+   {  this->priv_clone_from(x, container_detail::false_());  }
+
+   frozen_hash_table(BOOST_RV_REF(frozen_hash_table) x)
+      : m_members(boost::move(static_cast<Allocator&>(x.m_members)), x.m_members.m_hasher, x.m_members.m_key_eq)
+   {  this->priv_steal(x);  }
+
+   frozen_hash_table(const frozen_hash_table& x, const allocator_type &a)
+      : m_members(a, x.m_members.m_hasher, x.m_members.m_key_eq)
+   {  this->priv_clone_from(x, container_detail::false_());  }
+
+   frozen_hash_table(BOOST_RV_REF(frozen_hash_table) x, const allocator_type &a)
+      : m_members(a, x.m_members.m_hasher, x.m_members.m_key_eq)
+   {
+      if(this->priv_alloc() == x.priv_alloc()){
+         this->priv_steal(x);
+      }
+      else{
+         this->priv_clone_from(x, container_detail::true_());
+      }
+   }
+
+   ~frozen_hash_table()
+   {  this->priv_destroy_and_deallocate();  }
+
+   frozen_hash_table& operator=(BOOST_COPY_ASSIGN_REF(frozen_hash_table) x)
+   {
+      if (&x != this){
+         this->priv_destroy_and_deallocate();
+         //Transfer allocator if needed
+         container_detail::bool_<value_allocator_traits::
+            propagate_on_container_copy_assignment::value> flag;
+         container_detail::assign_alloc(this->priv_alloc(), x.priv_alloc(), flag);
+         m_members.m_hasher = x.m_members.m_hasher;
+         m_members.m_key_eq = x.m_members.m_key_eq;
+         this->priv_clone_from(x, container_detail::false_());
+      }
+      return *this;
+   }
+
+   frozen_hash_table& operator=(BOOST_RV_REF(frozen_hash_table) x)
+      BOOST_NOEXCEPT_IF(  value_allocator_traits::is_always_equal::value
+                                 && boost::container::container_detail::is_nothrow_move_assignable<Hash>::value
+                                 && boost::container::container_detail::is_nothrow_move_assignable<Pred>::value )
+   {
+      BOOST_ASSERT(this != &x);
+      const bool propagate_alloc = value_allocator_traits::propagate_on_container_move_assignment::value;
+      const bool allocators_equal = this->priv_alloc() == x.priv_alloc(); (void)allocators_equal;
+      this->priv_destroy_and_deallocate();
+      m_members.m_hasher = boost::move(x.m_members.m_hasher);
+      m_members.m_key_eq = boost::move(x.m_members.m_key_eq);
+      //If allocators are equal we can just swap pointers
+      if(propagate_alloc || allocators_equal){
+         container_detail::bool_<value_allocator_traits::
+            propagate_on_container_move_assignment::value> flag;
+         container_detail::move_alloc(this->priv_alloc(), x.priv_alloc(), flag);
+         this->priv_steal(x);
+      }
+      else{
+         this->priv_clone_from(x, container_detail::true_());
+      }
+      return *this;
+   }
+
+   public:
+   // accessors:
+   hasher hash_function() const
+   {  return m_members.m_hasher;  }
+
+   key_equal key_eq() const
+   {  return m_members.m_key_eq;  }
+
+   allocator_type get_allocator() const
+   {  return this->priv_alloc();  }
+
+   const stored_allocator_type &get_stored_allocator() const
+   {  return this->priv_alloc();  }
+
+   const_iterator begin() const
+   {  return this->cbegin();  }
+
+   const_iterator end() const
+   {  return this->cend();  }
+
+   const_iterator cbegin() const
+   {  return this->priv_iterator(0u);  }
+
+   const_iterator cend() const
+   {  return this->priv_iterator(m_members.m_size);  }
+
+   bool empty() const
+   {  return !m_members.m_size;  }
+
+   size_type size() const
+   {  return m_members.m_size;  }
+
+   size_type max_size() const
+   {
+      const slot_allocator_type a(this->priv_alloc());
+      const size_type n = slot_allocator_traits::max_size(a);
+      return n < frozen_hash_impl::max_elements ? n : size_type(frozen_hash_impl::max_elements);
+   }
+
+   size_type bucket_count() const
+   {  return m_members.m_bucket_count;  }
+
+   void swap(ThisType& x)
+      BOOST_NOEXCEPT_IF(  value_allocator_traits::is_always_equal::value
+                                 && boost::container::container_detail::is_nothrow_swappable<Hash>::value
+                                 && boost::container::container_detail::is_nothrow_swappable<Pred>::value )
+   {
+      container_detail::bool_<value_allocator_traits::propagate_on_container_swap::value> flag;
+      container_detail::swap_alloc(this->priv_alloc(), x.priv_alloc(), flag);
+      boost::adl_move_swap(m_members.m_slots,        x.m_members.m_slots);
+      boost::adl_move_swap(m_members.m_size,         x.m_members.m_size);
+      boost::adl_move_swap(m_members.m_bucket_count, x.m_members.m_bucket_count);
+      boost::adl_move_swap(m_members.m_overflow,     x.m_members.m_overflow);
+      boost::adl_move_swap(m_members.m_salt,         x.m_members.m_salt);
+      boost::adl_move_swap(m_members.m_hasher,       x.m_members.m_hasher);
+      boost::adl_move_swap(m_members.m_key_eq,       x.m_members.m_key_eq);
+   }
+
+   // lookup:
+   const_iterator find(const key_type& k) const
+   {  return this->priv_iterator(this->priv_find(k));  }
+
+   size_type count(const key_type& k) const
+   {  return size_type(this->priv_find(k) != m_members.m_size);  }
+
+   std::pair<const_iterator, const_iterator> equal_range(const key_type& k) const
+   {
+      const size_type pos = this->priv_find(k);
+      return std::pair<const_iterator, const_iterator>
+         (this->priv_iterator(pos), this->priv_iterator(pos == m_members.m_size ? pos : pos + 1u));
+   }
+
+   friend bool operator==(const frozen_hash_table& x, const frozen_hash_table& y)
+   {
+      if(x.size() != y.size())
+         return false;
+      for(const_iterator it = x.cbegin(), itend = x.cend(); it != itend; ++it){
+         const_iterator yit = y.find(KeyOfValue()(*it));
+         if(yit == y.cend() || !(*yit == *it))
+            return false;
+      }
+      return true;
+   }
+
+   friend bool operator!=(const frozen_hash_table& x, const frozen_hash_table& y)
+   {  return !(x == y);  }
+
+   friend std::size_t hash_value(const frozen_hash_table& x)
+   {  return container_detail::hash_unordered_range(x.cbegin(), x.cend());  }
+
+   friend void swap(frozen_hash_table& x, frozen_hash_table& y)
+   {  x.swap(y);  }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   const Allocator &priv_alloc() const
+   {  return m_members;  }
+
+   Allocator &priv_alloc()
+   {  return m_members;  }
+
+   internal_type *priv_slots() const
+   {  return container_detail::to_raw_pointer(m_members.m_slots);  }
+
+   const_iterator priv_iterator(size_type pos) const
+   {
+      return const_iterator(m_members.m_slots
+         ? boost::intrusive::pointer_traits<pointer>::pointer_to
+               (reinterpret_cast<value_type&>(this->priv_slots()[pos]))
+         : pointer());
+   }
+
+   //Number of slots of the allocation that holds n elements, the seeds of bucket_count
+   //buckets and the candidate slots of overflow elements
+   static size_type priv_alloc_count(size_type n, size_type bucket_count, size_type overflow)
+   {
+      const size_type seed_bytes = (bucket_count + overflow)*sizeof(boost::uint32_t);
+      return n + (seed_bytes + sizeof(internal_type) - 1u)/sizeof(internal_type);
+   }
+
+   //Seeds are stored in the raw bytes that follow the array of slots, so they
+   //are read and written as bytes with memcpy instead of through a uint32_t lvalue
+   unsigned char *priv_seed_bytes() const
+   {  return reinterpret_cast<unsigned char*>(this->priv_slots() + m_members.m_size);  }
+
+   static boost::uint32_t priv_read_uint32(const unsigned char *p, size_type i)
+   {
+      boost::uint32_t v;
+      std::memcpy(&v, p + i*sizeof(boost::uint32_t), sizeof(v));
+      return v;
+   }
+
+   boost::uint32_t priv_seed(size_type bucket) const
+   {  return priv_read_uint32(this->priv_seed_bytes(), bucket);  }
+
+   //Candidate slot of the overflow element stored in slot size() - m_overflow + i
+   boost::uint32_t priv_overflow_candidate(size_type i) const
+   {  return priv_read_uint32(this->priv_seed_bytes(), m_members.m_bucket_count + i);  }
+
+   bool priv_slot_has_key(size_type pos, const key_type &k) const
+   {  return m_members.m_key_eq(KeyOfValue()(reinterpret_cast<const value_type&>(this->priv_slots()[pos])), k);  }
+
+   boost::uint64_t priv_mixed_hash(const key_type &k) const
+   {  return frozen_hash_impl::mix(boost::uint64_t(m_members.m_hasher(k)) ^ m_members.m_salt);  }
+
+   //Returns the position of the element with key k or size() if there is no such element
+   size_type priv_find(const key_type &k) const
+   {
+      const size_type n = m_members.m_size;
+      if(!n)
+         return 0u;
+      const boost::uint64_t x = this->priv_mixed_hash(k);
+      const size_type pos = frozen_hash_impl::slot
+         (x, this->priv_seed(frozen_hash_impl::bucket(x, m_members.m_bucket_count)), n - m_members.m_overflow);
+      if(this->priv_slot_has_key(pos, k))
+         return pos;
+      return m_members.m_overflow ? this->priv_find_overflow(k, pos) : n;
+   }
+
+   //Compares k with the overflow elements whose candidate slot is pos
+   size_type priv_find_overflow(const key_type &k, size_type pos) const
+   {
+      const size_type ov = m_members.m_overflow, table_size = m_members.m_size - ov;
+      //Lower bound of pos in the sorted candidate slots
+      size_type i = 0u, len = ov;
+      while(len){
+         const size_type half = len/2u;
+         if(this->priv_overflow_candidate(i + half) < pos){
+            i   += half + 1u;
+            len -= half + 1u;
+         }
+         else{
+            len = half;
+         }
+      }
+      for(; i != ov && this->priv_overflow_candidate(i) == pos; ++i){
+         if(this->priv_slot_has_key(table_size + i, k))
+            return table_size + i;
+      }
+      return m_members.m_size;
+   }
+
+   void priv_destroy_and_deallocate()
+   {
+      if(m_members.m_slots){
+         slot_allocator_type a(this->priv_alloc());
+         internal_type *const slots = this->priv_slots();
+         for(size_type i = 0; i != m_members.m_size; ++i){
+            slot_allocator_traits::destroy(a, slots + i);
+         }
+         a.deallocate(m_members.m_slots, priv_alloc_count(m_members.m_size, m_members.m_bucket_count, m_members.m_overflow));
+         m_members.m_slots = slot_pointer();
+         m_members.m_size = m_members.m_bucket_count = m_members.m_overflow = 0u;
+      }
+   }
+
+   void priv_steal(frozen_hash_table &x)
+   {
+      m_members.m_slots        = x.m_members.m_slots;
+      m_members.m_size         = x.m_members.m_size;
+      m_members.m_bucket_count = x.m_members.m_bucket_count;
+      m_members.m_overflow     = x.m_members.m_overflow;
+      m_members.m_salt         = x.m_members.m_salt;
+      x.m_members.m_slots = slot_pointer();
+      x.m_members.m_size = x.m_members.m_bucket_count = x.m_members.m_overflow = 0u;
+   }
+
+   static internal_type &priv_source(internal_type &v, container_detail::false_)
+   {  return v;  }
+
+   static BOOST_RV_REF(internal_type) priv_source(internal_type &v, container_detail::true_)
+   {  return boost::move(v);  }
+
+   //Reproduces the layout of x, copying or moving its elements: no hash value is computed
+   template<class Move>
+   void priv_clone_from(const frozen_hash_table &x, Move move)
+   {
+      BOOST_ASSERT(!m_members.m_slots);
+      const size_type n = x.m_members.m_size;
+      if(!n)
+         return;
+      slot_allocator_type a(this->priv_alloc());
+      const size_type alloc_count = priv_alloc_count(n, x.m_members.m_bucket_count, x.m_members.m_overflow);
+      const slot_pointer slots = a.allocate(alloc_count);
+      internal_type *const raw_slots = container_detail::to_raw_pointer(slots);
+      size_type i = 0;
+      BOOST_TRY{
+         for(; i != n; ++i){
+            slot_allocator_traits::construct(a, raw_slots + i, priv_source(x.priv_slots()[i], move));
+         }
+      }
+      BOOST_CATCH(...){
+         while(i){
+            slot_allocator_traits::destroy(a, raw_slots + --i);
+         }
+         a.deallocate(slots, alloc_count);
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      std::memcpy( reinterpret_cast<unsigned char*>(raw_slots + n), x.priv_seed_bytes()
+                 , (x.m_members.m_bucket_count + x.m_members.m_overflow)*sizeof(boost::uint32_t));
+      m_members.m_slots        = slots;
+      m_members.m_size         = n;
+      m_members.m_bucket_count = x.m_members.m_bucket_count;
+      m_members.m_overflow     = x.m_members.m_overflow;
+      m_members.m_salt         = x.m_members.m_salt;
+   }
+
+   //Single pass ranges are stored first so that they can be traversed several times
+   template<class InputIterator>
+   void priv_build(bool unique, InputIterator first, InputIterator last, container_detail::true_)
+   {
+      vector<internal_type> tmp;
+      for(; first != last; ++first){
+         tmp.push_back(*first);
+      }
+      this->priv_build(unique, boost::make_move_iterator(tmp.begin()), boost::make_move_iterator(tmp.end())
+                      , container_detail::false_());
+   }
+
+   //Elements are constructed (copied or moved) directly from the range in their final slots
+   template<class FwdIt>
+   void priv_build(bool unique, FwdIt first, FwdIt last, container_detail::false_)
+   {
+      const std::size_t n = boost::container::iterator_distance(first, last);
+      if(!n)
+         return;
+      if(n > this->max_size()){
+         throw_length_error("frozen_hash_table::priv_build, the range is too long");
+      }
+      vector<FwdIt> its;
+      its.reserve(n);
+      vector<std::size_t> h;
+      h.reserve(n);
+      for(; first != last; ++first){
+         its.push_back(first);
+         h.push_back(m_members.m_hasher(KeyOfValue()(*first)));
+      }
+      const std::size_t bucket_count = n/frozen_hash_impl::keys_per_bucket + 1u;
+      vector<boost::uint64_t> x(n);
+      vector<boost::uint32_t> seeds(bucket_count), slots(n), overflow;
+      const key_equal_at<FwdIt> eq(its.data(), m_members.m_key_eq);
+      std::size_t size = 0u;
+      boost::uint64_t salt = 0u;
+      for(unsigned attempt = 0; ; ++attempt){
+         if(attempt == frozen_hash_impl::max_salts){
+            throw_runtime_error("frozen_hash_table::priv_build, no perfect hash function was found");
+         }
+         salt = attempt*0x9e3779b97f4a7c15ULL;
+         for(std::size_t i = 0; i != n; ++i){
+            x[i] = frozen_hash_impl::mix(boost::uint64_t(h[i]) ^ salt);
+         }
+         if(frozen_hash_impl::build_ok == frozen_hash_impl::build
+               (x.data(), n, bucket_count, unique ? 0 : &eq, seeds.data(), slots.data(), overflow, size)){
+            break;
+         }
+      }
+
+      slot_allocator_type a(this->priv_alloc());
+      const size_type alloc_count = priv_alloc_count(size, bucket_count, overflow.size());
+      const slot_pointer new_slots = a.allocate(alloc_count);
+      internal_type *const raw_slots = container_detail::to_raw_pointer(new_slots);
+      std::size_t i = 0;
+      BOOST_TRY{
+         for(; i != n; ++i){
+            if(slots[i] != frozen_hash_impl::dropped_slot){
+               slot_allocator_traits::construct(a, raw_slots + slots[i], *its[i]);
+            }
+         }
+      }
+      BOOST_CATCH(...){
+         while(i){
+            if(slots[--i] != frozen_hash_impl::dropped_slot){
+               slot_allocator_traits::destroy(a, raw_slots + slots[i]);
+            }
+         }
+         a.deallocate(new_slots, alloc_count);
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      unsigned char *const seed_bytes = reinterpret_cast<unsigned char*>(raw_slots + size);
+      std::memcpy(seed_bytes, seeds.data(), bucket_count*sizeof(boost::uint32_t));
+      if(!overflow.empty()){
+         std::memcpy(seed_bytes + bucket_count*sizeof(boost::uint32_t), overflow.data(), overflow.size()*sizeof(boost::uint32_t));
+      }
+      m_members.m_slots        = new_slots;
+      m_members.m_size         = size;
+      m_members.m_bucket_count = bucket_count;
+      m_members.m_overflow     = overflow.size();
+      m_members.m_salt         = salt;
+   }
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+} //namespace container_detail {
+} //namespace container {
+} //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif //BOOST_CONTAINER_FROZEN_HASH_TABLE_HPP
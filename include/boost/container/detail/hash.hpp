@@ -0,0 +1,198 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_DETAIL_HASH_HPP
+#define BOOST_CONTAINER_DETAIL_HASH_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+#include <boost/container/detail/iterator.hpp>
+#include <boost/container/detail/math_functions.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/type_traits.hpp>
+
+#include <boost/cstdint.hpp>
+#include <boost/functional/hash.hpp>
+
+#include <cstring>   //std::memcpy
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#  include <intrin.h>  //_umul128
+#endif
+
+//Containers specialize std::hash when the standard library provides it
+#if !defined(BOOST_NO_CXX11_HDR_FUNCTIONAL) && !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+#  define BOOST_CONTAINER_HAS_STD_HASH
+#  include <functional>
+#endif
+
+namespace boost {
+namespace container {
+namespace container_detail {
+
+//Byte-wise hashing of contiguous memory. It follows the structure of wyhash:
+//input is consumed 48 bytes at a time in three independent lanes and each step
+//folds the full 128 bit product of two 64 bit words, so long ranges are hashed
+//at close to memory bandwidth and short ones with a couple of multiplications.
+//Values depend on the platform endianness so they must not be persisted.
+struct hash_bytes_impl
+{
+   static const boost::uint64_t p0 = 0xa0761d6478bd642fULL;
+   static const boost::uint64_t p1 = 0xe7037ed1a0b428dbULL;
+   static const boost::uint64_t p2 = 0x8ebc6af09c88c6e3ULL;
+   static const boost::uint64_t p3 = 0x589965cc75374cc3ULL;
+
+   //Xors the high and low halves of the 128 bit product of a and b
+   static boost::uint64_t mix(boost::uint64_t a, boost::uint64_t b)
+   {
+      #if defined(__SIZEOF_INT128__)
+      const unsigned __int128 r = (unsigned __int128)a * b;
+      return boost::uint64_t(r) ^ boost::uint64_t(r >> 64u);
+      #elif defined(_MSC_VER) && defined(_M_X64)
+      boost::uint64_t hi;
+      const boost::uint64_t lo = _umul128(a, b, &hi);
+      return lo ^ hi;
+      #else
+      const boost::uint64_t ha = a >> 32u, hb = b >> 32u, la = boost::uint32_t(a), lb = boost::uint32_t(b);
+      const boost::uint64_t rh = ha*hb, rm0 = ha*lb, rm1 = hb*la, rl = la*lb;
+      const boost::uint64_t t = rl + (rm0 << 32u);
+      boost::uint64_t c = boost::uint64_t(t < rl);
+      const boost::uint64_t lo = t + (rm1 << 32u);
+      c += boost::uint64_t(lo < t);
+      const boost::uint64_t hi = rh + (rm0 >> 32u) + (rm1 >> 32u) + c;
+      return lo ^ hi;
+      #endif
+   }
+
+   static boost::uint64_t read64(const unsigned char *p)
+   {  boost::uint64_t v; std::memcpy(&v, p, sizeof(v)); return v;  }
+
+   static boost::uint64_t read32(const unsigned char *p)
+   {  boost::uint32_t v; std::memcpy(&v, p, sizeof(v)); return v;  }
+
+   //Reads 1 to 3 bytes
+   static boost::uint64_t read_small(const unsigned char *p, std::size_t len)
+   {  return (boost::uint64_t(p[0]) << 16u) | (boost::uint64_t(p[len >> 1u]) << 8u) | p[len - 1u];  }
+
+   static boost::uint64_t hash(const unsigned char *p, std::size_t len, boost::uint64_t seed)
+   {
+      seed ^= mix(seed ^ p0, p1);
+      boost::uint64_t a, b;
+      if(len <= 16u){
+         if(len >= 4u){
+            const std::size_t off = (len >> 3u) << 2u;
+            a = (read32(p) << 32u) | read32(p + off);
+            b = (read32(p + len - 4u) << 32u) | read32(p + len - 4u - off);
+         }
+         else if(len){
+            a = read_small(p, len);
+            b = 0u;
+         }
+         else{
+            a = b = 0u;
+         }
+      }
+      else{
+         std::size_t i = len;
+         if(i > 48u){
+            boost::uint64_t see1 = seed, see2 = seed;
+            do{
+               seed = mix(read64(p)      ^ p1, read64(p + 8u)  ^ seed);
+               see1 = mix(read64(p + 16u) ^ p2, read64(p + 24u) ^ see1);
+               see2 = mix(read64(p + 32u) ^ p3, read64(p + 40u) ^ see2);
+               p += 48u;
+               i -= 48u;
+            } while(i > 48u);
+            seed ^= see1 ^ see2;
+         }
+         while(i > 16u){
+            seed = mix(read64(p) ^ p1, read64(p + 8u) ^ seed);
+            i -= 16u;
+            p += 16u;
+         }
+         a = read64(p + i - 16u);
+         b = read64(p + i - 8u);
+      }
+      return mix(p1 ^ boost::uint64_t(len), mix(a ^ p1, b ^ seed));
+   }
+};
+
+inline std::size_t hash_bytes(const void *p, std::size_t len, std::size_t seed = 0u)
+{  return std::size_t(hash_bytes_impl::hash(static_cast<const unsigned char*>(p), len, seed));  }
+
+//Types whose object representation is unique: equal values have equal bytes,
+//so a range of them can be hashed as raw memory
+template<class T>
+struct is_bytewise_hashable
+{
+   static const bool value = is_integral<T>::value || is_enum<T>::value || is_pointer<T>::value;
+};
+
+inline void hash_combine(std::size_t &seed, std::size_t h)
+{  seed ^= h + 0x9e3779b9u + (seed << 6u) + (seed >> 2u);  }
+
+//Order dependent hash of the elements of [first, last)
+template<class InpIt>
+std::size_t hash_range(InpIt first, InpIt last)
+{
+   typedef typename iterator_traits<InpIt>::value_type value_type;
+   ::boost::hash<value_type> hasher;
+   std::size_t seed = 0u;
+   for(; first != last; ++first){
+      hash_combine(seed, hasher(*first));
+   }
+   return seed;
+}
+
+template<class T>
+std::size_t hash_contiguous_range(const T *p, std::size_t n, true_)
+{  return hash_bytes(p, n*sizeof(T));  }
+
+template<class T>
+std::size_t hash_contiguous_range(const T *p, std::size_t n, false_)
+{  return (hash_range)(p, p + n);  }
+
+//Hash of n contiguous elements: trivial elements are hashed as raw memory,
+//the rest element by element
+template<class T>
+std::size_t hash_contiguous_range(const T *p, std::size_t n)
+{  return (hash_contiguous_range)(p, n, bool_<is_bytewise_hashable<T>::value>());  }
+
+//Order independent hash of the elements of [first, last) for unordered containers
+template<class InpIt>
+std::size_t hash_unordered_range(InpIt first, InpIt last)
+{
+   typedef typename iterator_traits<InpIt>::value_type value_type;
+   ::boost::hash<value_type> hasher;
+   std::size_t seed = 0u, n = 0u;
+   for(; first != last; ++first, ++n){
+      //Mix each hash before adding so that elements with nearby hash values don't cancel out
+      seed += fibonacci_hash<>::mix(hasher(*first));
+   }
+   hash_combine(seed, n);
+   return seed;
+}
+
+}  //namespace container_detail {
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_DETAIL_HASH_HPP
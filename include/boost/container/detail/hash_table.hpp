@@ -1,383 +1,1267 @@
-/*
-template <class Value, unsigned int Options = 0, class Hash = hash<Value>, class Pred = equal_to<Value>,
-          class Allocator = allocator<Value> >
-class hash_set
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2005-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_DETAIL_HASH_TABLE_HPP
+#define BOOST_CONTAINER_DETAIL_HASH_TABLE_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+// container
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/container_fwd.hpp>
+// container/detail
+#include <boost/container/detail/allocation_type.hpp>
+#include <boost/container/detail/allocator_version_traits.hpp>
+#include <boost/container/detail/destroyers.hpp>
+#include <boost/container/detail/hash.hpp>
+#include <boost/container/detail/iterator.hpp>
+#include <boost/container/detail/iterators.hpp>
+#include <boost/container/detail/math_functions.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/node_alloc_holder.hpp>
+#include <boost/container/detail/pair.hpp>
+#include <boost/container/detail/placement_new.hpp>
+#include <boost/container/detail/to_raw_pointer.hpp>
+#include <boost/container/detail/type_traits.hpp>
+// intrusive
+#include <boost/intrusive/pointer_traits.hpp>
+#include <boost/intrusive/slist.hpp>
+// intrusive/detail
+#include <boost/intrusive/detail/minimal_pair_header.hpp>   //pair
+// move
+#include <boost/move/adl_move_swap.hpp>
+#include <boost/move/iterator.hpp>
+#include <boost/move/utility_core.hpp>
+// move/detail
+#if defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+#include <boost/move/detail/fwd_macros.hpp>
+#endif
+// other
+#include <boost/assert.hpp>
+#include <boost/core/no_exceptions_support.hpp>
+// std
+#include <climits>   //CHAR_BIT
+
+namespace boost {
+namespace container {
+namespace container_detail {
+
+//The hash table is implemented as a single linear singly linked list of nodes
+//where all the nodes of a bucket are contiguous. The bucket array does not
+//store the first node of the bucket but an iterator to the node that precedes
+//it in the list (the header of the list for the first bucket), so that
+//insertions and erasures in the bucket are O(1) operations on the list.
+//Empty buckets store the end() iterator of the list.
+//
+//Each node caches the hash value of its element so rehashing never calls
+//the hash function and lookups only call the key predicate on hash matches.
+
+template<class VoidPointer>
+struct hash_table_hook
 {
-public:
-    // types
-    typedef Value                                                      key_type;
-    typedef key_type                                                   value_type;
-    typedef Hash                                                       hasher;
-    typedef Pred                                                       key_equal;
-    typedef Allocator                                                      allocator_type;
-    typedef value_type&                                                reference;
-    typedef const value_type&                                          const_reference;
-    typedef typename allocator_traits<allocator_type>::pointer         pointer;
-    typedef typename allocator_traits<allocator_type>::const_pointer   const_pointer;
-    typedef typename allocator_traits<allocator_type>::size_type       size_type;
-    typedef typename allocator_traits<allocator_type>::difference_type difference_type;
-
-    typedef /unspecified/ iterator;
-    typedef /unspecified/ const_iterator;
-    typedef /unspecified/ local_iterator;
-    typedef /unspecified/ const_local_iterator;
-
-    hash_set()
-        noexcept(
-            is_nothrow_default_constructible<hasher>::value &&
-            is_nothrow_default_constructible<key_equal>::value &&
-            is_nothrow_default_constructible<allocator_type>::value);
-    explicit hash_set(size_type n, const hasher& hf = hasher(),
-                           const key_equal& eql = key_equal(),
-                           const allocator_type& a = allocator_type());
-    template <class InputIterator>
-        hash_set(InputIterator f, InputIterator l,
-                      size_type n = 0, const hasher& hf = hasher(),
-                      const key_equal& eql = key_equal(),
-                      const allocator_type& a = allocator_type());
-    explicit hash_set(const allocator_type&);
-    hash_set(const hash_set&);
-    hash_set(const hash_set&, const Allocator&);
-    hash_set(hash_set&&)
-        noexcept(
-            is_nothrow_move_constructible<hasher>::value &&
-            is_nothrow_move_constructible<key_equal>::value &&
-            is_nothrow_move_constructible<allocator_type>::value);
-    hash_set(hash_set&&, const Allocator&);
-    hash_set(initializer_list<value_type>, size_type n = 0,
-                  const hasher& hf = hasher(), const key_equal& eql = key_equal(),
-                  const allocator_type& a = allocator_type());
-    ~hash_set();
-    hash_set& operator=(const hash_set&);
-    hash_set& operator=(hash_set&&)
-        noexcept(
-            allocator_type::propagate_on_container_move_assignment::value &&
-            is_nothrow_move_assignable<allocator_type>::value &&
-            is_nothrow_move_assignable<hasher>::value &&
-            is_nothrow_move_assignable<key_equal>::value);
-    hash_set& operator=(initializer_list<value_type>);
-
-    allocator_type get_allocator() const noexcept;
-
-    bool      empty() const noexcept;
-    size_type size() const noexcept;
-    size_type max_size() const noexcept;
-
-    iterator       begin() noexcept;
-    iterator       end() noexcept;
-    const_iterator begin()  const noexcept;
-    const_iterator end()    const noexcept;
-    const_iterator cbegin() const noexcept;
-    const_iterator cend()   const noexcept;
-
-    template <class... Args>
-        pair<iterator, bool> emplace(BOOST_FWD_REF(Args)... args);
-    template <class... Args>
-        iterator emplace_hint(const_iterator position, BOOST_FWD_REF(Args)... args);
-    pair<iterator, bool> insert(const value_type& obj);
-    pair<iterator, bool> insert(value_type&& obj);
-    iterator insert(const_iterator hint, const value_type& obj);
-    iterator insert(const_iterator hint, value_type&& obj);
-    template <class InputIterator>
-        void insert(InputIterator first, InputIterator last);
-    void insert(initializer_list<value_type>);
-
-    iterator erase(const_iterator position);
-    size_type erase(const key_type& k);
-    iterator erase(const_iterator first, const_iterator last);
-    void clear() noexcept;
-
-    void swap(hash_set&)
-        noexcept(
-            (!allocator_type::propagate_on_container_swap::value ||
-             __is_nothrow_swappable<allocator_type>::value) &&
-            __is_nothrow_swappable<hasher>::value &&
-            __is_nothrow_swappable<key_equal>::value);
-
-    hasher hash_function() const;
-    key_equal key_eq() const;
-
-    iterator       find(const key_type& k);
-    const_iterator find(const key_type& k) const;
-    size_type count(const key_type& k) const;
-    pair<iterator, iterator>             equal_range(const key_type& k);
-    pair<const_iterator, const_iterator> equal_range(const key_type& k) const;
-
-    size_type bucket_count() const noexcept;
-    size_type max_bucket_count() const noexcept;
-
-    size_type bucket_size(size_type n) const;
-    size_type bucket(const key_type& k) const;
-
-    local_iterator       begin(size_type n);
-    local_iterator       end(size_type n);
-    const_local_iterator begin(size_type n) const;
-    const_local_iterator end(size_type n) const;
-    const_local_iterator cbegin(size_type n) const;
-    const_local_iterator cend(size_type n) const;
-
-    float load_factor() const noexcept;
-    float max_load_factor() const noexcept;
-    void max_load_factor(float z);
-    void rehash(size_type n);
-    void reserve(size_type n);
+   typedef typename container_detail::bi::make_slist_base_hook
+      <container_detail::bi::void_pointer<VoidPointer>, container_detail::bi::link_mode<container_detail::bi::normal_link> >::type type;
+};
+
+//This trait is used to type-pun std::pair because in C++03
+//compilers std::pair is useless for C++11 features (see tree_node)
+template<class T>
+struct hash_table_internal_data_type
+{
+   typedef T type;
+};
+
+template<class T1, class T2>
+struct hash_table_internal_data_type< std::pair<T1, T2> >
+{
+   typedef pair<typename boost::move_detail::remove_const<T1>::type, T2> type;
+};
+
+template <class T, class VoidPointer>
+struct hash_table_node
+   :  public hash_table_hook<VoidPointer>::type
+{
+   private:
+   hash_table_node();
+
+   public:
+   typedef T value_type;
+   typedef typename hash_table_hook<VoidPointer>::type   hook_type;
+   typedef typename hash_table_internal_data_type<T>::type internal_type;
+
+   T &get_data()
+   {
+      T* ptr = reinterpret_cast<T*>(&this->m_data);
+      return *ptr;
+   }
+
+   const T &get_data() const
+   {
+      const T* ptr = reinterpret_cast<const T*>(&this->m_data);
+      return *ptr;
+   }
+
+   internal_type m_data;
+   std::size_t m_hash;
+};
+
+template <class T, class VoidPointer>
+struct iiterator_node_value_type< hash_table_node<T,VoidPointer> > {
+  typedef T type;
 };
 
-template <class Key, class T, unsigned int Options = 0, class Hash = hash<Key>, class Pred = equal_to<Key>,
-          class Allocator = allocator<pair<const Key, T> > >
-class hash_map
+template<class Allocator>
+struct intrusive_hash_table_type
 {
-public:
-    // types
-    typedef Key                                                        key_type;
-    typedef T                                                          mapped_type;
-    typedef Hash                                                       hasher;
-    typedef Pred                                                       key_equal;
-    typedef Allocator                                                      allocator_type;
-    typedef pair<const key_type, mapped_type>                          value_type;
-    typedef value_type&                                                reference;
-    typedef const value_type&                                          const_reference;
-    typedef typename allocator_traits<allocator_type>::pointer         pointer;
-    typedef typename allocator_traits<allocator_type>::const_pointer   const_pointer;
-    typedef typename allocator_traits<allocator_type>::size_type       size_type;
-    typedef typename allocator_traits<allocator_type>::difference_type difference_type;
-
-    typedef /unspecified/ iterator;
-    typedef /unspecified/ const_iterator;
-    typedef /unspecified/ local_iterator;
-    typedef /unspecified/ const_local_iterator;
-
-    hash_map()
-        noexcept(
-            is_nothrow_default_constructible<hasher>::value &&
-            is_nothrow_default_constructible<key_equal>::value &&
-            is_nothrow_default_constructible<allocator_type>::value);
-    explicit hash_map(size_type n, const hasher& hf = hasher(),
-                           const key_equal& eql = key_equal(),
-                           const allocator_type& a = allocator_type());
-    template <class InputIterator>
-        hash_map(InputIterator f, InputIterator l,
-                      size_type n = 0, const hasher& hf = hasher(),
-                      const key_equal& eql = key_equal(),
-                      const allocator_type& a = allocator_type());
-    explicit hash_map(const allocator_type&);
-    hash_map(const hash_map&);
-    hash_map(const hash_map&, const Allocator&);
-    hash_map(hash_map&&)
-        noexcept(
-            is_nothrow_move_constructible<hasher>::value &&
-            is_nothrow_move_constructible<key_equal>::value &&
-            is_nothrow_move_constructible<allocator_type>::value);
-    hash_map(hash_map&&, const Allocator&);
-    hash_map(initializer_list<value_type>, size_type n = 0,
-                  const hasher& hf = hasher(), const key_equal& eql = key_equal(),
-                  const allocator_type& a = allocator_type());
-    ~hash_map();
-    hash_map& operator=(const hash_map&);
-    hash_map& operator=(hash_map&&)
-        noexcept(
-            allocator_type::propagate_on_container_move_assignment::value &&
-            is_nothrow_move_assignable<allocator_type>::value &&
-            is_nothrow_move_assignable<hasher>::value &&
-            is_nothrow_move_assignable<key_equal>::value);
-    hash_map& operator=(initializer_list<value_type>);
-
-    allocator_type get_allocator() const noexcept;
-
-    bool      empty() const noexcept;
-    size_type size() const noexcept;
-    size_type max_size() const noexcept;
-
-    iterator       begin() noexcept;
-    iterator       end() noexcept;
-    const_iterator begin()  const noexcept;
-    const_iterator end()    const noexcept;
-    const_iterator cbegin() const noexcept;
-    const_iterator cend()   const noexcept;
-
-    template <class... Args>
-        pair<iterator, bool> emplace(BOOST_FWD_REF(Args)... args);
-    template <class... Args>
-        iterator emplace_hint(const_iterator position, BOOST_FWD_REF(Args)... args);
-    pair<iterator, bool> insert(const value_type& obj);
-    template <class P>
-        pair<iterator, bool> insert(P&& obj);
-    iterator insert(const_iterator hint, const value_type& obj);
-    template <class P>
-        iterator insert(const_iterator hint, P&& obj);
-    template <class InputIterator>
-        void insert(InputIterator first, InputIterator last);
-    void insert(initializer_list<value_type>);
-
-    iterator erase(const_iterator position);
-    size_type erase(const key_type& k);
-    iterator erase(const_iterator first, const_iterator last);
-    void clear() noexcept;
-
-    void swap(hash_map&)
-        noexcept(
-            (!allocator_type::propagate_on_container_swap::value ||
-             __is_nothrow_swappable<allocator_type>::value) &&
-            __is_nothrow_swappable<hasher>::value &&
-            __is_nothrow_swappable<key_equal>::value);
-
-    hasher hash_function() const;
-    key_equal key_eq() const;
-
-    iterator       find(const key_type& k);
-    const_iterator find(const key_type& k) const;
-    size_type count(const key_type& k) const;
-    pair<iterator, iterator>             equal_range(const key_type& k);
-    pair<const_iterator, const_iterator> equal_range(const key_type& k) const;
-
-    mapped_type& operator[](const key_type& k);
-    mapped_type& operator[](key_type&& k);
-
-    mapped_type&       at(const key_type& k);
-    const mapped_type& at(const key_type& k) const;
-
-    size_type bucket_count() const noexcept;
-    size_type max_bucket_count() const noexcept;
-
-    size_type bucket_size(size_type n) const;
-    size_type bucket(const key_type& k) const;
-
-    local_iterator       begin(size_type n);
-    local_iterator       end(size_type n);
-    const_local_iterator begin(size_type n) const;
-    const_local_iterator end(size_type n) const;
-    const_local_iterator cbegin(size_type n) const;
-    const_local_iterator cend(size_type n) const;
-
-    float load_factor() const noexcept;
-    float max_load_factor() const noexcept;
-    void max_load_factor(float z);
-    void rehash(size_type n);
-    void reserve(size_type n);
+   typedef boost::container::allocator_traits<Allocator>      allocator_traits_type;
+   typedef typename allocator_traits_type::value_type value_type;
+   typedef typename boost::intrusive::pointer_traits
+      <typename allocator_traits_type::pointer>::template
+         rebind_pointer<void>::type
+            void_pointer;
+   typedef typename container_detail::hash_table_node
+         <value_type, void_pointer>             node_type;
+
+   typedef typename container_detail::bi::make_slist
+      <node_type
+      ,container_detail::bi::base_hook<typename hash_table_hook<void_pointer>::type>
+      ,container_detail::bi::constant_time_size<true>
+      ,container_detail::bi::size_type
+         <typename allocator_traits_type::size_type>
+      ,container_detail::bi::linear<true>
+      >::type                                   container_type;
+   typedef container_type                       type ;
 };
 
-*/
+//Buckets are selected with Fibonacci hashing: the upper bits of the mixed
+//hash value are taken. This spreads poor hash functions (e.g. boost::hash
+//for integers is the identity) over a power of two table.
+inline std::size_t hash_table_bucket(std::size_t h, std::size_t shift)
+{  return fibonacci_hash<>::mix(h) >> shift;  }
+
+template<class IIterator, bool IsConst>
+class hash_table_local_iterator
+{
+   typedef typename iterator_types<IIterator, IsConst>::type types_t;
+
+   public:
+   typedef typename types_t::pointer             pointer;
+   typedef typename types_t::reference           reference;
+   typedef typename types_t::difference_type     difference_type;
+   typedef typename types_t::iterator_category   iterator_category;
+   typedef typename types_t::value_type          value_type;
+
+   hash_table_local_iterator()
+   {}
+
+   hash_table_local_iterator(IIterator iit, IIterator iend, std::size_t bucket, std::size_t shift) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_iit(iit), m_iend(iend), m_bucket(bucket), m_shift(shift)
+   {}
+
+   hash_table_local_iterator(hash_table_local_iterator<IIterator, false> const& other) BOOST_NOEXCEPT_OR_NOTHROW
+      :  m_iit(other.get()), m_iend(other.get_end()), m_bucket(other.get_bucket()), m_shift(other.get_shift())
+   {}
+
+   hash_table_local_iterator& operator++() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      ++this->m_iit;
+      if(this->m_iit != this->m_iend && hash_table_bucket(this->m_iit->m_hash, this->m_shift) != this->m_bucket){
+         this->m_iit = this->m_iend;
+      }
+      return *this;
+   }
+
+   hash_table_local_iterator operator++(int) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      hash_table_local_iterator result (*this);
+      ++*this;
+      return result;
+   }
+
+   friend bool operator== (const hash_table_local_iterator& l, const hash_table_local_iterator& r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_iit == r.m_iit;   }
 
-template <class Key, class Value, class KeyOfValue, unsigned int Options = 0, class Hash = hash<Key>, class Pred = equal_to<Key>,
-          class Allocator = allocator<Value> >
+   friend bool operator!= (const hash_table_local_iterator& l, const hash_table_local_iterator& r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !(l == r); }
+
+   reference operator*()  const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_iit->get_data();  }
+
+   pointer   operator->() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return ::boost::intrusive::pointer_traits<pointer>::pointer_to(this->operator*());  }
+
+   const IIterator &get() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_iit;   }
+
+   const IIterator &get_end() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_iend;   }
+
+   std::size_t get_bucket() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_bucket;   }
+
+   std::size_t get_shift() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_shift;   }
+
+   private:
+   IIterator   m_iit;
+   IIterator   m_iend;
+   std::size_t m_bucket;
+   std::size_t m_shift;
+};
+
+template <class Key, class T, class KeyOfValue,
+          class Hash, class Pred, class Allocator>
 class hash_table
+   : protected container_detail::node_alloc_holder
+      < Allocator, typename container_detail::intrusive_hash_table_type<Allocator>::type>
 {
-public:
-    // types
-    typedef Value                                                      key_type;
-    typedef key_type                                                   value_type;
-    typedef Hash                                                       hasher;
-    typedef Pred                                                       key_equal;
-    typedef Allocator                                                      allocator_type;
-    typedef value_type&                                                reference;
-    typedef const value_type&                                          const_reference;
-    typedef typename allocator_traits<allocator_type>::pointer         pointer;
-    typedef typename allocator_traits<allocator_type>::const_pointer   const_pointer;
-    typedef typename allocator_traits<allocator_type>::size_type       size_type;
-    typedef typename allocator_traits<allocator_type>::difference_type difference_type;
-
-    typedef /unspecified/ iterator;
-    typedef /unspecified/ const_iterator;
-    typedef /unspecified/ local_iterator;
-    typedef /unspecified/ const_local_iterator;
-
-    hash_set()
-        noexcept(
-            is_nothrow_default_constructible<hasher>::value &&
-            is_nothrow_default_constructible<key_equal>::value &&
-            is_nothrow_default_constructible<allocator_type>::value);
-    explicit hash_set(size_type n, const hasher& hf = hasher(),
-                           const key_equal& eql = key_equal(),
-                           const allocator_type& a = allocator_type());
-    template <class InputIterator>
-        hash_set(InputIterator f, InputIterator l,
-                      size_type n = 0, const hasher& hf = hasher(),
-                      const key_equal& eql = key_equal(),
-                      const allocator_type& a = allocator_type());
-    explicit hash_set(const allocator_type&);
-    hash_set(const hash_set&);
-    hash_set(const hash_set&, const Allocator&);
-    hash_set(hash_set&&)
-        noexcept(
-            is_nothrow_move_constructible<hasher>::value &&
-            is_nothrow_move_constructible<key_equal>::value &&
-            is_nothrow_move_constructible<allocator_type>::value);
-    hash_set(hash_set&&, const Allocator&);
-    hash_set(initializer_list<value_type>, size_type n = 0,
-                  const hasher& hf = hasher(), const key_equal& eql = key_equal(),
-                  const allocator_type& a = allocator_type());
-    ~hash_set();
-    hash_set& operator=(const hash_set&);
-    hash_set& operator=(hash_set&&)
-        noexcept(
-            allocator_type::propagate_on_container_move_assignment::value &&
-            is_nothrow_move_assignable<allocator_type>::value &&
-            is_nothrow_move_assignable<hasher>::value &&
-            is_nothrow_move_assignable<key_equal>::value);
-    hash_set& operator=(initializer_list<value_type>);
-
-    allocator_type get_allocator() const noexcept;
-
-    bool      empty() const noexcept;
-    size_type size() const noexcept;
-    size_type max_size() const noexcept;
-
-    iterator       begin() noexcept;
-    iterator       end() noexcept;
-    const_iterator begin()  const noexcept;
-    const_iterator end()    const noexcept;
-    const_iterator cbegin() const noexcept;
-    const_iterator cend()   const noexcept;
-
-    template <class... Args>
-        pair<iterator, bool> emplace(BOOST_FWD_REF(Args)... args);
-    template <class... Args>
-        iterator emplace_hint(const_iterator position, BOOST_FWD_REF(Args)... args);
-    pair<iterator, bool> insert(const value_type& obj);
-    pair<iterator, bool> insert(value_type&& obj);
-    iterator insert(const_iterator hint, const value_type& obj);
-    iterator insert(const_iterator hint, value_type&& obj);
-    template <class InputIterator>
-        void insert(InputIterator first, InputIterator last);
-    void insert(initializer_list<value_type>);
-
-    iterator erase(const_iterator position);
-    size_type erase(const key_type& k);
-    iterator erase(const_iterator first, const_iterator last);
-    void clear() noexcept;
-
-    void swap(hash_set&)
-        noexcept(
-            (!allocator_type::propagate_on_container_swap::value ||
-             __is_nothrow_swappable<allocator_type>::value) &&
-            __is_nothrow_swappable<hasher>::value &&
-            __is_nothrow_swappable<key_equal>::value);
-
-    hasher hash_function() const;
-    key_equal key_eq() const;
-
-    iterator       find(const key_type& k);
-    const_iterator find(const key_type& k) const;
-    size_type count(const key_type& k) const;
-    pair<iterator, iterator>             equal_range(const key_type& k);
-    pair<const_iterator, const_iterator> equal_range(const key_type& k) const;
-
-    size_type bucket_count() const noexcept;
-    size_type max_bucket_count() const noexcept;
-
-    size_type bucket_size(size_type n) const;
-    size_type bucket(const key_type& k) const;
-
-    local_iterator       begin(size_type n);
-    local_iterator       end(size_type n);
-    const_local_iterator begin(size_type n) const;
-    const_local_iterator end(size_type n) const;
-    const_local_iterator cbegin(size_type n) const;
-    const_local_iterator cend(size_type n) const;
-
-    float load_factor() const noexcept;
-    float max_load_factor() const noexcept;
-    void max_load_factor(float z);
-    void rehash(size_type n);
-    void reserve(size_type n);
+   typedef typename container_detail::
+      intrusive_hash_table_type<Allocator>::type            Icont;
+   typedef container_detail::node_alloc_holder
+      <Allocator, Icont>                                    AllocHolder;
+   typedef typename AllocHolder::NodePtr                    NodePtr;
+   typedef hash_table < Key, T, KeyOfValue
+                      , Hash, Pred, Allocator>              ThisType;
+   typedef typename AllocHolder::NodeAlloc                  NodeAlloc;
+   typedef boost::container::
+      allocator_traits<NodeAlloc>                           allocator_traits_type;
+   typedef typename AllocHolder::ValAlloc                   ValAlloc;
+   typedef typename AllocHolder::Node                       Node;
+   typedef typename Icont::iterator                         iiterator;
+   typedef typename Icont::const_iterator                   iconst_iterator;
+   typedef container_detail::allocator_destroyer<NodeAlloc> Destroyer;
+   typedef typename AllocHolder::alloc_version              alloc_version;
+   typedef typename allocator_traits_type::template
+      portable_rebind_alloc<iiterator>::type                BucketAlloc;
+   typedef typename boost::container::
+      allocator_traits<BucketAlloc>::pointer                bucket_ptr;
+   typedef container_detail::
+      allocator_version_traits<BucketAlloc>                 bucket_version_traits;
+
+   BOOST_COPYABLE_AND_MOVABLE(hash_table)
+
+   public:
+
+   typedef Key                                        key_type;
+   typedef T                                          value_type;
+   typedef Allocator                                  allocator_type;
+   typedef Hash                                       hasher;
+   typedef Pred                                       key_equal;
+   typedef typename boost::container::
+      allocator_traits<Allocator>::pointer            pointer;
+   typedef typename boost::container::
+      allocator_traits<Allocator>::const_pointer      const_pointer;
+   typedef typename boost::container::
+      allocator_traits<Allocator>::reference          reference;
+   typedef typename boost::container::
+      allocator_traits<Allocator>::const_reference    const_reference;
+   typedef typename boost::container::
+      allocator_traits<Allocator>::size_type          size_type;
+   typedef typename boost::container::
+      allocator_traits<Allocator>::difference_type    difference_type;
+   typedef NodeAlloc                                  stored_allocator_type;
+
+   typedef container_detail::iterator_from_iiterator<iiterator, false>     iterator;
+   typedef container_detail::iterator_from_iiterator<iiterator, true >     const_iterator;
+   typedef container_detail::hash_table_local_iterator<iiterator, false>   local_iterator;
+   typedef container_detail::hash_table_local_iterator<iiterator, true >   const_local_iterator;
+
+   hash_table()
+      : AllocHolder(), m_members()
+   {}
+
+   explicit hash_table(const allocator_type& a)
+      : AllocHolder(a), m_members()
+   {}
+
+   hash_table(size_type n, const hasher &hf, const key_equal &eql, const allocator_type& a)
+      : AllocHolder(a), m_members(hf, eql)
+   {
+      if(n){
+         this->rehash(n);
+      }
+   }
+
+   hash_table(const hash_table& x)
+      :  AllocHolder(x), m_members(x.m_members.m_hasher, x.m_members.m_key_eq)
+   {
+      this->m_members.m_max_load_factor = x.m_members.m_max_load_factor;
+      this->priv_clone_from(x, x.begin());
+   }
+
+   hash_table(BOOST_RV_REF(hash_table) x)
+      :  AllocHolder(BOOST_MOVE_BASE(AllocHolder, x)), m_members(x.m_members.m_hasher, x.m_members.m_key_eq)
+   {
+      this->priv_steal_buckets(x);
+   }
+
+   hash_table(const hash_table& x, const allocator_type &a)
+      :  AllocHolder(a), m_members(x.m_members.m_hasher, x.m_members.m_key_eq)
+   {
+      this->m_members.m_max_load_factor = x.m_members.m_max_load_factor;
+      this->priv_clone_from(x, x.begin());
+   }
+
+   hash_table(BOOST_RV_REF(hash_table) x, const allocator_type &a)
+      :  AllocHolder(a), m_members(x.m_members.m_hasher, x.m_members.m_key_eq)
+   {
+      if(this->node_alloc() == x.node_alloc()){
+         this->icont().swap(x.icont());
+         this->priv_steal_buckets(x);
+      }
+      else{
+         this->m_members.m_max_load_factor = x.m_members.m_max_load_factor;
+         this->priv_clone_from(x, boost::make_move_iterator(x.begin()));
+      }
+   }
+
+   ~hash_table()
+   {  this->priv_deallocate_buckets();  } //AllocHolder destroys the nodes
+
+   hash_table& operator=(BOOST_COPY_ASSIGN_REF(hash_table) x)
+   {
+      if (&x != this){
+         this->clear();
+         this->priv_deallocate_buckets();
+         this->AllocHolder::copy_assign_alloc(x);
+         this->m_members.m_hasher = x.m_members.m_hasher;
+         this->m_members.m_key_eq = x.m_members.m_key_eq;
+         this->m_members.m_max_load_factor = x.m_members.m_max_load_factor;
+         this->priv_clone_from(x, x.begin());
+      }
+      return *this;
+   }
+
+   hash_table& operator=(BOOST_RV_REF(hash_table) x)
+      BOOST_NOEXCEPT_IF(  allocator_traits_type::is_always_equal::value
+                                 && boost::container::container_detail::is_nothrow_move_assignable<Hash>::value
+                                 && boost::container::container_detail::is_nothrow_move_assignable<Pred>::value )
+   {
+      BOOST_ASSERT(this != &x);
+      NodeAlloc &this_alloc = this->node_alloc();
+      NodeAlloc &x_alloc    = x.node_alloc();
+      const bool propagate_alloc = allocator_traits<NodeAlloc>::
+            propagate_on_container_move_assignment::value;
+      const bool allocators_equal = this_alloc == x_alloc; (void)allocators_equal;
+      this->clear();
+      this->priv_deallocate_buckets();
+      this->m_members.m_hasher = ::boost::move(x.m_members.m_hasher);
+      this->m_members.m_key_eq = ::boost::move(x.m_members.m_key_eq);
+      //Resources can be transferred if both allocators are
+      //going to be equal after this function (either propagated or already equal)
+      if(propagate_alloc || allocators_equal){
+         //Move allocator if needed
+         this->AllocHolder::move_assign_alloc(x);
+         //Obtain resources
+         this->icont().swap(x.icont());
+         this->priv_steal_buckets(x);
+      }
+      //Else do a one by one move
+      else{
+         this->m_members.m_max_load_factor = x.m_members.m_max_load_factor;
+         this->priv_clone_from(x, boost::make_move_iterator(x.begin()));
+      }
+      return *this;
+   }
+
+   public:
+   // accessors:
+   hasher hash_function() const
+   {  return this->m_members.m_hasher; }
+
+   key_equal key_eq() const
+   {  return this->m_members.m_key_eq; }
+
+   allocator_type get_allocator() const
+   {  return allocator_type(this->node_alloc()); }
+
+   const stored_allocator_type &get_stored_allocator() const
+   {  return this->node_alloc(); }
+
+   stored_allocator_type &get_stored_allocator()
+   {  return this->node_alloc(); }
+
+   iterator begin()
+   { return iterator(this->icont().begin()); }
+
+   const_iterator begin() const
+   {  return this->cbegin();  }
+
+   iterator end()
+   {  return iterator(this->icont().end());  }
+
+   const_iterator end() const
+   {  return this->cend();  }
+
+   const_iterator cbegin() const
+   { return const_iterator(this->non_const_icont().begin()); }
+
+   const_iterator cend() const
+   { return const_iterator(this->non_const_icont().end()); }
+
+   bool empty() const
+   {  return !this->size();  }
+
+   size_type size() const
+   {  return this->icont().size();   }
+
+   size_type max_size() const
+   {  return AllocHolder::max_size();  }
+
+   void swap(ThisType& x)
+      BOOST_NOEXCEPT_IF(  allocator_traits_type::is_always_equal::value
+                                 && boost::container::container_detail::is_nothrow_swappable<Hash>::value
+                                 && boost::container::container_detail::is_nothrow_swappable<Pred>::value )
+   {
+      AllocHolder::swap(x);
+      ::boost::adl_move_swap(this->m_members.m_buckets,         x.m_members.m_buckets);
+      ::boost::adl_move_swap(this->m_members.m_bucket_count,    x.m_members.m_bucket_count);
+      ::boost::adl_move_swap(this->m_members.m_shift,           x.m_members.m_shift);
+      ::boost::adl_move_swap(this->m_members.m_max_load_factor, x.m_members.m_max_load_factor);
+      ::boost::adl_move_swap(this->m_members.m_hasher,          x.m_members.m_hasher);
+      ::boost::adl_move_swap(this->m_members.m_key_eq,          x.m_members.m_key_eq);
+      //The bucket of the first node points to the list header,
+      //which is stored in the container object
+      this->priv_fix_front_bucket();
+      x.priv_fix_front_bucket();
+   }
+
+   public:
+
+   struct insert_commit_data
+   {
+      std::size_t hash;
+   };
+
+   // insert/erase
+   std::pair<iterator,bool> insert_unique_check
+      (const key_type& key, insert_commit_data &data)
+   {
+      data.hash = this->m_members.m_hasher(key);
+      const iiterator it = this->priv_find(key, data.hash);
+      return std::pair<iterator, bool>(iterator(it), it == this->priv_end());
+   }
+
+   iterator insert_unique_commit(const value_type& v, insert_commit_data &data)
+   {
+      this->priv_reserve_one_more();
+      NodePtr tmp = AllocHolder::create_node(v);
+      tmp->m_hash = data.hash;
+      this->priv_link_bucket_begin(*tmp, this->priv_bucket(data.hash));
+      return iterator(this->icont().iterator_to(*tmp));
+   }
+
+   template<class MovableConvertible>
+   iterator insert_unique_commit
+      (BOOST_FWD_REF(MovableConvertible) v, insert_commit_data &data)
+   {
+      this->priv_reserve_one_more();
+      NodePtr tmp = AllocHolder::create_node(boost::forward<MovableConvertible>(v));
+      tmp->m_hash = data.hash;
+      this->priv_link_bucket_begin(*tmp, this->priv_bucket(data.hash));
+      return iterator(this->icont().iterator_to(*tmp));
+   }
+
+   std::pair<iterator,bool> insert_unique(const value_type& v)
+   {
+      insert_commit_data data;
+      std::pair<iterator,bool> ret =
+         this->insert_unique_check(KeyOfValue()(v), data);
+      if(ret.second){
+         ret.first = this->insert_unique_commit(v, data);
+      }
+      return ret;
+   }
+
+   template<class MovableConvertible>
+   std::pair<iterator,bool> insert_unique(BOOST_FWD_REF(MovableConvertible) v)
+   {
+      insert_commit_data data;
+      std::pair<iterator,bool> ret =
+         this->insert_unique_check(KeyOfValue()(v), data);
+      if(ret.second){
+         ret.first = this->insert_unique_commit(boost::forward<MovableConvertible>(v), data);
+      }
+      return ret;
+   }
+
+   iterator insert_unique(const_iterator, const value_type& v)
+   {  return this->insert_unique(v).first;  }
+
+   template<class MovableConvertible>
+   iterator insert_unique(const_iterator, BOOST_FWD_REF(MovableConvertible) v)
+   {  return this->insert_unique(boost::forward<MovableConvertible>(v)).first;  }
+
+   template <class InputIterator>
+   void insert_unique(InputIterator first, InputIterator last
+      #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+      , typename container_detail::enable_if_or
+         < void
+         , container_detail::is_same<alloc_version, version_1>
+         , container_detail::is_input_iterator<InputIterator>
+         >::type * = 0
+      #endif
+      )
+   {
+      for( ; first != last; ++first)
+         this->insert_unique(*first);
+   }
+
+   template <class FwdIterator>
+   void insert_unique(FwdIterator first, FwdIterator last
+      #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+      , typename container_detail::disable_if_or
+         < void
+         , container_detail::is_same<alloc_version, version_1>
+         , container_detail::is_input_iterator<FwdIterator>
+         >::type * = 0
+      #endif
+      )
+   {
+      const size_type n = boost::container::iterator_distance(first, last);
+      if(n){
+         //Buckets are reserved for the worst case (no duplicates) so that
+         //nodes can be linked without rehashing while they are constructed.
+         //Nodes are allocated in a single multiallocation_chain and the ones
+         //whose key is already present are parked in "dups" and freed afterwards.
+         this->reserve(this->size() + n);
+         Icont dups;
+         icont_disposer dups_disposer(dups, this->node_alloc());
+         this->allocate_many_and_construct(first, n, unique_inserter(*this, dups));
+      }
+   }
+
+   iterator insert_equal(const value_type& v)
+   {
+      this->priv_reserve_one_more();
+      NodePtr tmp(AllocHolder::create_node(v));
+      scoped_destroy_deallocator<NodeAlloc> destroy_deallocator(tmp, this->node_alloc());
+      tmp->m_hash = this->m_members.m_hasher(KeyOfValue()(tmp->get_data()));
+      this->priv_link_equal(*tmp);
+      destroy_deallocator.release();
+      return iterator(this->icont().iterator_to(*tmp));
+   }
+
+   template<class MovableConvertible>
+   iterator insert_equal(BOOST_FWD_REF(MovableConvertible) v)
+   {
+      this->priv_reserve_one_more();
+      NodePtr tmp(AllocHolder::create_node(boost::forward<MovableConvertible>(v)));
+      scoped_destroy_deallocator<NodeAlloc> destroy_deallocator(tmp, this->node_alloc());
+      tmp->m_hash = this->m_members.m_hasher(KeyOfValue()(tmp->get_data()));
+      this->priv_link_equal(*tmp);
+      destroy_deallocator.release();
+      return iterator(this->icont().iterator_to(*tmp));
+   }
+
+   iterator insert_equal(const_iterator, const value_type& v)
+   {  return this->insert_equal(v);  }
+
+   template<class MovableConvertible>
+   iterator insert_equal(const_iterator, BOOST_FWD_REF(MovableConvertible) v)
+   {  return this->insert_equal(boost::forward<MovableConvertible>(v));  }
+
+   template <class InputIterator>
+   void insert_equal(InputIterator first, InputIterator last
+      #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+      , typename container_detail::enable_if_or
+         < void
+         , container_detail::is_same<alloc_version, version_1>
+         , container_detail::is_input_iterator<InputIterator>
+         >::type * = 0
+      #endif
+      )
+   {
+      for( ; first != last; ++first)
+         this->insert_equal(*first);
+   }
+
+   template <class FwdIterator>
+   void insert_equal(FwdIterator first, FwdIterator last
+      #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+      , typename container_detail::disable_if_or
+         < void
+         , container_detail::is_same<alloc_version, version_1>
+         , container_detail::is_input_iterator<FwdIterator>
+         >::type * = 0
+      #endif
+      )
+   {
+      const size_type n = boost::container::iterator_distance(first, last);
+      if(n){
+         //Optimized allocation and construction
+         this->reserve(this->size() + n);
+         this->allocate_many_and_construct(first, n, equal_inserter(*this));
+      }
+   }
+
+   private:
+
+   std::pair<iterator, bool> emplace_unique_impl(NodePtr p)
+   {
+      value_type &v = p->get_data();
+      scoped_destroy_deallocator<NodeAlloc> destroy_deallocator(p, this->node_alloc());
+      insert_commit_data data;
+      std::pair<iterator,bool> ret =
+         this->insert_unique_check(KeyOfValue()(v), data);
+      if(!ret.second){
+         return ret;
+      }
+      this->priv_reserve_one_more();
+      //No throw insertion part, release rollback
+      destroy_deallocator.release();
+      p->m_hash = data.hash;
+      this->priv_link_bucket_begin(*p, this->priv_bucket(data.hash));
+      return std::pair<iterator,bool>(iterator(this->icont().iterator_to(*p)), true);
+   }
+
+   iterator emplace_equal_impl(NodePtr p)
+   {
+      scoped_destroy_deallocator<NodeAlloc> destroy_deallocator(p, this->node_alloc());
+      p->m_hash = this->m_members.m_hasher(KeyOfValue()(p->get_data()));
+      this->priv_reserve_one_more();
+      this->priv_link_equal(*p);
+      destroy_deallocator.release();
+      return iterator(this->icont().iterator_to(*p));
+   }
+
+   public:
+
+   #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   template <class... Args>
+   std::pair<iterator, bool> emplace_unique(BOOST_FWD_REF(Args)... args)
+   {  return this->emplace_unique_impl(AllocHolder::create_node(boost::forward<Args>(args)...));   }
+
+   template <class... Args>
+   iterator emplace_hint_unique(const_iterator, BOOST_FWD_REF(Args)... args)
+   {  return this->emplace_unique_impl(AllocHolder::create_node(boost::forward<Args>(args)...)).first;   }
+
+   template <class... Args>
+   iterator emplace_equal(BOOST_FWD_REF(Args)... args)
+   {  return this->emplace_equal_impl(AllocHolder::create_node(boost::forward<Args>(args)...));   }
+
+   template <class... Args>
+   iterator emplace_hint_equal(const_iterator, BOOST_FWD_REF(Args)... args)
+   {  return this->emplace_equal_impl(AllocHolder::create_node(boost::forward<Args>(args)...));   }
+
+   #else // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   #define BOOST_CONTAINER_HASH_TABLE_EMPLACE_CODE(N) \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   std::pair<iterator, bool> emplace_unique(BOOST_MOVE_UREF##N)\
+   {  return this->emplace_unique_impl(AllocHolder::create_node(BOOST_MOVE_FWD##N));  }\
+   \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   iterator emplace_hint_unique(const_iterator BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
+   {  return this->emplace_unique_impl(AllocHolder::create_node(BOOST_MOVE_FWD##N)).first; }\
+   \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   iterator emplace_equal(BOOST_MOVE_UREF##N)\
+   {  return this->emplace_equal_impl(AllocHolder::create_node(BOOST_MOVE_FWD##N));  }\
+   \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   iterator emplace_hint_equal(const_iterator BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
+   {  return this->emplace_equal_impl(AllocHolder::create_node(BOOST_MOVE_FWD##N));  }\
+   //
+   BOOST_MOVE_ITERATE_0TO9(BOOST_CONTAINER_HASH_TABLE_EMPLACE_CODE)
+   #undef BOOST_CONTAINER_HASH_TABLE_EMPLACE_CODE
+
+   #endif   // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   iterator erase(const_iterator position)
+   {
+      const iiterator cur(position.get());
+      const size_type b = this->priv_bucket(cur->m_hash);
+      return iterator(this->priv_erase_after(this->priv_previous(cur, b), b));
+   }
+
+   size_type erase(const key_type& k)
+   {
+      size_type n = 0;
+      if(this->m_members.m_bucket_count){
+         const std::size_t h = this->m_members.m_hasher(k);
+         const size_type b = this->priv_bucket(h);
+         const iiterator prev = this->priv_find_before(k, h, b);
+         if(prev != this->priv_end()){
+            //Find the end of the group before erasing anything
+            //as k might be a reference to an erased element
+            iiterator last(prev);
+            ++last;
+            const iiterator last_end(this->priv_group_end(last));
+            iiterator nxt(prev);
+            while(++nxt != last_end){
+               this->priv_erase_after(prev, b);
+               nxt = prev;
+               ++n;
+            }
+         }
+      }
+      return n;
+   }
+
+   iterator erase(const_iterator first, const_iterator last)
+   {
+      if(first != last){
+         const iiterator ilast(last.get());
+         iiterator prev(this->priv_previous(first.get(), this->priv_bucket(first.get()->m_hash)));
+         iiterator nxt(prev);
+         while(++nxt != ilast){
+            this->priv_erase_after(prev, this->priv_bucket(nxt->m_hash));
+            nxt = prev;
+         }
+      }
+      return iterator(last.get());
+   }
+
+   void clear()
+   {
+      AllocHolder::clear(alloc_version());
+      const iiterator ie(this->priv_end());
+      for(size_type i = 0, n = this->m_members.m_bucket_count; i != n; ++i){
+         this->m_members.m_buckets[i] = ie;
+      }
+   }
+
+   // lookup
+   iterator find(const key_type& k)
+   {  return iterator(this->priv_find(k, this->m_members.m_hasher(k)));  }
+
+   const_iterator find(const key_type& k) const
+   {  return const_iterator(this->priv_find(k, this->m_members.m_hasher(k)));  }
+
+   size_type count(const key_type& k) const
+   {
+      std::pair<iiterator, iiterator> ret(this->priv_equal_range(k));
+      size_type n = 0;
+      for(; ret.first != ret.second; ++ret.first){
+         ++n;
+      }
+      return n;
+   }
+
+   std::pair<iterator,iterator> equal_range(const key_type& k)
+   {
+      std::pair<iiterator, iiterator> ret(this->priv_equal_range(k));
+      return std::pair<iterator,iterator>(iterator(ret.first), iterator(ret.second));
+   }
+
+   std::pair<const_iterator, const_iterator> equal_range(const key_type& k) const
+   {
+      std::pair<iiterator, iiterator> ret(this->priv_equal_range(k));
+      return std::pair<const_iterator,const_iterator>
+         (const_iterator(ret.first), const_iterator(ret.second));
+   }
+
+   // bucket interface
+   size_type bucket_count() const
+   {  return this->m_members.m_bucket_count;  }
+
+   size_type max_bucket_count() const
+   {  return allocator_traits<BucketAlloc>::max_size(BucketAlloc(this->node_alloc()));  }
+
+   size_type bucket_size(size_type n) const
+   {
+      size_type sz = 0;
+      for(const_local_iterator b(this->cbegin(n)), e(this->cend(n)); b != e; ++b){
+         ++sz;
+      }
+      return sz;
+   }
+
+   size_type bucket(const key_type& k) const
+   {
+      BOOST_ASSERT(this->m_members.m_bucket_count != 0);
+      return this->priv_bucket(this->m_members.m_hasher(k));
+   }
+
+   local_iterator begin(size_type n)
+   {
+      const iiterator ie(this->priv_end());
+      BOOST_ASSERT(n < this->m_members.m_bucket_count);
+      iiterator it(this->m_members.m_buckets[n]);
+      if(it != ie){
+         ++it;
+      }
+      return local_iterator(it, ie, n, this->m_members.m_shift);
+   }
+
+   const_local_iterator begin(size_type n) const
+   {  return this->cbegin(n);  }
+
+   const_local_iterator cbegin(size_type n) const
+   {  return const_cast<hash_table&>(*this).begin(n);  }
+
+   local_iterator end(size_type n)
+   {
+      const iiterator ie(this->priv_end());
+      return local_iterator(ie, ie, n, this->m_members.m_shift);
+   }
+
+   const_local_iterator end(size_type n) const
+   {  return this->cend(n);  }
+
+   const_local_iterator cend(size_type n) const
+   {  return const_cast<hash_table&>(*this).end(n);  }
+
+   // hash policy
+   float load_factor() const
+   {  return this->m_members.m_bucket_count ? float(this->size())/float(this->m_members.m_bucket_count) : 0.0f;  }
+
+   float max_load_factor() const
+   {  return this->m_members.m_max_load_factor;  }
+
+   void max_load_factor(float z)
+   {
+      BOOST_ASSERT(z > 0.0f);
+      this->m_members.m_max_load_factor = z;
+      if(float(this->size()) > z*float(this->m_members.m_bucket_count)){
+         this->rehash(0u);
+      }
+   }
+
+   void rehash(size_type n)
+   {
+      const size_type sz = this->size();
+      if(!n && !sz){
+         if(this->m_members.m_bucket_count){
+            this->priv_deallocate_buckets();
+         }
+         return;
+      }
+      const size_type minimum = this->priv_bucket_count_for(sz);
+      n = n < minimum ? minimum : upper_power_of_2(n);
+      if(n != this->m_members.m_bucket_count){
+         this->priv_rehash(n);
+      }
+   }
+
+   void reserve(size_type n)
+   {
+      if(float(n) > this->m_members.m_max_load_factor*float(this->m_members.m_bucket_count)){
+         this->priv_rehash(this->priv_bucket_count_for(n));
+      }
+   }
+
+   //Unordered containers are equal if they have the same number of elements and each
+   //group of equivalent elements in x is a permutation of the equivalent group in y
+   friend bool operator==(const hash_table& x, const hash_table& y)
+   {
+      if(x.size() != y.size()){
+         return false;
+      }
+      const iiterator ie(x.priv_end());
+      for(iiterator it(x.non_const_icont().begin()); it != ie; ){
+         const iiterator group_end(x.priv_group_end(it));
+         const std::pair<iiterator, iiterator> yr(y.priv_equal_range(KeyOfValue()(it->get_data()), it->m_hash));
+         iiterator yit(yr.first);
+         for(iiterator xit(it); xit != group_end; ++xit, ++yit){
+            if(yit == yr.second){
+               return false;
+            }
+         }
+         if(yit != yr.second || !hash_table::priv_is_permutation(it, group_end, yr.first)){
+            return false;
+         }
+         it = group_end;
+      }
+      return true;
+   }
+
+   friend bool operator!=(const hash_table& x, const hash_table& y)
+   {  return !(x == y);  }
+
+   //The hash value must not depend on the iteration order
+   friend std::size_t hash_value(const hash_table& x)
+   {  return container_detail::hash_unordered_range(x.begin(), x.end());  }
+
+   friend void swap(hash_table& x, hash_table& y)
+   {  x.swap(y);  }
+
+   private:
+
+   struct members_holder
+   {
+      members_holder()
+         : m_buckets(), m_bucket_count(0u), m_shift(0u), m_max_load_factor(1.0f)
+         , m_hasher(), m_key_eq()
+      {}
+
+      members_holder(const hasher &hf, const key_equal &eql)
+         : m_buckets(), m_bucket_count(0u), m_shift(0u), m_max_load_factor(1.0f)
+         , m_hasher(hf), m_key_eq(eql)
+      {}
+
+      bucket_ptr  m_buckets;
+      size_type   m_bucket_count;
+      std::size_t m_shift;
+      float       m_max_load_factor;
+      hasher      m_hasher;
+      key_equal   m_key_eq;
+   } m_members;
+
+   struct icont_disposer
+   {
+      icont_disposer(Icont &c, NodeAlloc &a)
+         : m_c(c), m_a(a)
+      {}
+
+      ~icont_disposer()
+      {  m_c.clear_and_dispose(Destroyer(m_a));  }
+
+      Icont     &m_c;
+      NodeAlloc &m_a;
+   };
+
+   struct unique_inserter
+   {
+      unique_inserter(hash_table &t, Icont &dups)
+         : m_t(t), m_dups(dups)
+      {}
+
+      void operator()(Node &n)
+      {
+         const key_type &k = KeyOfValue()(n.get_data());
+         const std::size_t h = m_t.m_members.m_hasher(k);
+         if(m_t.priv_find(k, h) != m_t.priv_end()){
+            m_dups.push_front(n);
+         }
+         else{
+            n.m_hash = h;
+            m_t.priv_link_bucket_begin(n, m_t.priv_bucket(h));
+         }
+      }
+
+      hash_table &m_t;
+      Icont      &m_dups;
+   };
+
+   struct equal_inserter
+   {
+      explicit equal_inserter(hash_table &t)
+         : m_t(t)
+      {}
+
+      void operator()(Node &n)
+      {
+         n.m_hash = m_t.m_members.m_hasher(KeyOfValue()(n.get_data()));
+         m_t.priv_link_equal(n);
+      }
+
+      hash_table &m_t;
+   };
+
+   //Appends copies of the source nodes at the end of the list. As the bucket array has the
+   //same size as the source's, nodes keep their bucket and the bucket layout is replicated.
+   struct clone_inserter
+   {
+      clone_inserter(hash_table &t, iiterator src)
+         : m_t(t), m_src(src), m_last(t.icont().before_begin())
+      {}
+
+      void operator()(Node &n)
+      {
+         n.m_hash = m_src->m_hash;
+         ++m_src;
+         iiterator &bucket = m_t.m_members.m_buckets[m_t.priv_bucket(n.m_hash)];
+         if(bucket == m_t.priv_end()){
+            bucket = m_last;
+         }
+         m_t.icont().insert_after(m_last, n);
+         ++m_last;
+      }
+
+      hash_table &m_t;
+      iiterator  m_src;
+      iiterator  m_last;
+   };
+
+   iiterator priv_end() const
+   {  return this->non_const_icont().end();  }
+
+   size_type priv_bucket(std::size_t h) const
+   {  return size_type(hash_table_bucket(h, this->m_members.m_shift));  }
+
+   size_type priv_bucket_count_for(size_type n) const
+   {
+      size_type c = size_type(float(n)/this->m_members.m_max_load_factor);
+      if(float(c)*this->m_members.m_max_load_factor < float(n)){
+         ++c;
+      }
+      //At least 8 buckets are allocated when the first element is inserted
+      return c < 8u ? size_type(8u) : upper_power_of_2(c);
+   }
+
+   void priv_reserve_one_more()
+   {  this->reserve(this->size() + 1u);  }
+
+   iiterator priv_find(const key_type &k, std::size_t h) const
+   {
+      const iiterator ie(this->priv_end());
+      if(!this->m_members.m_bucket_count){
+         return ie;
+      }
+      const size_type b = this->priv_bucket(h);
+      iiterator it(this->m_members.m_buckets[b]);
+      if(it != ie){
+         for(++it; it != ie; ++it){
+            const std::size_t nh = it->m_hash;
+            if(nh == h){
+               if(this->m_members.m_key_eq(k, KeyOfValue()(it->get_data()))){
+                  return it;
+               }
+            }
+            else if(this->priv_bucket(nh) != b){
+               break;
+            }
+         }
+      }
+      return ie;
+   }
+
+   //Returns the node preceding the first element equivalent to k or end()
+   iiterator priv_find_before(const key_type &k, std::size_t h, size_type b) const
+   {
+      const iiterator ie(this->priv_end());
+      iiterator prev(this->m_members.m_buckets[b]);
+      if(prev != ie){
+         for(iiterator it(prev); ++it != ie; prev = it){
+            const std::size_t nh = it->m_hash;
+            if(nh == h){
+               if(this->m_members.m_key_eq(k, KeyOfValue()(it->get_data()))){
+                  return prev;
+               }
+            }
+            else if(this->priv_bucket(nh) != b){
+               break;
+            }
+         }
+      }
+      return ie;
+   }
+
+   //Returns the end of the group of elements equivalent to *first
+   iiterator priv_group_end(iiterator first) const
+   {
+      const iiterator ie(this->priv_end());
+      const key_type &k = KeyOfValue()(first->get_data());
+      const std::size_t h = first->m_hash;
+      iiterator it(first);
+      while(++it != ie && it->m_hash == h && this->m_members.m_key_eq(k, KeyOfValue()(it->get_data()))){}
+      return it;
+   }
+
+   std::pair<iiterator, iiterator> priv_equal_range(const key_type &k, std::size_t h) const
+   {
+      const iiterator first(this->priv_find(k, h));
+      if(first == this->priv_end()){
+         return std::pair<iiterator, iiterator>(first, first);
+      }
+      return std::pair<iiterator, iiterator>(first, this->priv_group_end(first));
+   }
+
+   std::pair<iiterator, iiterator> priv_equal_range(const key_type &k) const
+   {  return this->priv_equal_range(k, this->m_members.m_hasher(k));  }
+
+   static bool priv_is_permutation(iiterator first, iiterator last, iiterator first2)
+   {
+      //Skip the common prefix, usual for unique keys or identically built groups
+      for(; first != last; ++first, ++first2){
+         if(!(first->get_data() == first2->get_data())){
+            break;
+         }
+      }
+      iiterator last2(first2);
+      for(iiterator it(first); it != last; ++it){
+         ++last2;
+      }
+      for(iiterator it(first); it != last; ++it){
+         size_type n1 = 0, n2 = 0;
+         for(iiterator i(first); i != last; ++i){
+            n1 += it->get_data() == i->get_data();
+         }
+         for(iiterator i(first2); i != last2; ++i){
+            n2 += it->get_data() == i->get_data();
+         }
+         if(n1 != n2){
+            return false;
+         }
+      }
+      return true;
+   }
+
+   iiterator priv_previous(iiterator cur, size_type b) const
+   {
+      iiterator prev(this->m_members.m_buckets[b]);
+      for(iiterator nxt(prev); ++nxt != cur; prev = nxt){}
+      return prev;
+   }
+
+   //Links n as the first node of bucket b
+   void priv_link_bucket_begin(Node &n, size_type b)
+   {
+      Icont &ic = this->icont();
+      iiterator &bucket = this->m_members.m_buckets[b];
+      if(bucket != this->priv_end()){
+         ic.insert_after(bucket, n);
+      }
+      else{
+         //Empty bucket: the node is inserted at the beginning of the list,
+         //so the former first node's bucket is now preceded by n
+         if(!ic.empty()){
+            this->m_members.m_buckets[this->priv_bucket(ic.front().m_hash)] = ic.iterator_to(n);
+         }
+         ic.push_front(n);
+         bucket = ic.before_begin();
+      }
+   }
+
+   //Links n before the first equivalent element, or at the beginning
+   //of the bucket if there is none, so that groups remain contiguous
+   void priv_link_equal(Node &n)
+   {
+      const size_type b = this->priv_bucket(n.m_hash);
+      const iiterator prev(this->priv_find_before(KeyOfValue()(n.get_data()), n.m_hash, b));
+      if(prev != this->priv_end()){
+         this->icont().insert_after(prev, n);
+      }
+      else{
+         this->priv_link_bucket_begin(n, b);
+      }
+   }
+
+   //Erases the node following prev, which belongs to bucket b
+   iiterator priv_erase_after(iiterator prev, size_type b)
+   {
+      const iiterator ie(this->priv_end());
+      iiterator nxt(prev);
+      ++++nxt;
+      iiterator &bucket = this->m_members.m_buckets[b];
+      if(nxt == ie){
+         if(bucket == prev){
+            bucket = ie;
+         }
+      }
+      else{
+         const size_type nb = this->priv_bucket(nxt->m_hash);
+         if(nb != b){
+            this->m_members.m_buckets[nb] = prev;
+            if(bucket == prev){
+               bucket = ie;
+            }
+         }
+      }
+      return this->icont().erase_after_and_dispose(prev, Destroyer(this->node_alloc()));
+   }
+
+   void priv_fix_front_bucket()
+   {
+      Icont &ic = this->icont();
+      if(!ic.empty()){
+         this->m_members.m_buckets[this->priv_bucket(ic.front().m_hash)] = ic.before_begin();
+      }
+   }
+
+   void priv_steal_buckets(hash_table &x)
+   {
+      this->m_members.m_buckets         = x.m_members.m_buckets;
+      this->m_members.m_bucket_count    = x.m_members.m_bucket_count;
+      this->m_members.m_shift           = x.m_members.m_shift;
+      this->m_members.m_max_load_factor = x.m_members.m_max_load_factor;
+      x.m_members.m_buckets      = bucket_ptr();
+      x.m_members.m_bucket_count = 0u;
+      x.m_members.m_shift        = 0u;
+      this->priv_fix_front_bucket();
+   }
+
+   template<class It>
+   void priv_clone_from(const hash_table &x, It values)
+   {
+      BOOST_ASSERT(this->empty() && !this->m_members.m_bucket_count);
+      if(!x.empty()){
+         this->priv_reallocate_buckets(x.m_members.m_bucket_count);
+         BOOST_TRY{
+            this->allocate_many_and_construct
+               (values, x.size(), clone_inserter(*this, x.non_const_icont().begin()));
+         }
+         BOOST_CATCH(...){
+            this->clear();
+            this->priv_deallocate_buckets();
+            BOOST_RETHROW
+         }
+         BOOST_CATCH_END
+      }
+   }
+
+   //Replaces the bucket array with a new one of n empty buckets.
+   //The old array is expanded in place if the allocator supports it.
+   void priv_reallocate_buckets(size_type n)
+   {
+      BucketAlloc a(this->node_alloc());
+      const bool can_expand = this->m_members.m_bucket_count && n > this->m_members.m_bucket_count;
+      bucket_ptr reuse(can_expand ? this->m_members.m_buckets : bucket_ptr());
+      size_type real_n = n;
+      const bucket_ptr ret = bucket_version_traits::allocation_command
+         (a, can_expand ? allocate_new | expand_fwd : allocate_new, n, real_n, reuse);
+      if(this->m_members.m_bucket_count && !(reuse && ret == this->m_members.m_buckets)){
+         a.deallocate(this->m_members.m_buckets, this->m_members.m_bucket_count);
+      }
+      this->m_members.m_buckets      = ret;
+      this->m_members.m_bucket_count = n;
+      this->m_members.m_shift        = sizeof(std::size_t)*CHAR_BIT - floor_log2(std::size_t(n));
+      const iiterator ie(this->priv_end());
+      iiterator *const raw = container_detail::to_raw_pointer(ret);
+      for(size_type i = 0; i != n; ++i){
+         ::new(raw + i, boost_container_new_t()) iiterator(ie);
+      }
+   }
+
+   void priv_deallocate_buckets()
+   {
+      if(this->m_members.m_bucket_count){
+         BucketAlloc a(this->node_alloc());
+         a.deallocate(this->m_members.m_buckets, this->m_members.m_bucket_count);
+         this->m_members.m_buckets      = bucket_ptr();
+         this->m_members.m_bucket_count = 0u;
+         this->m_members.m_shift        = 0u;
+      }
+   }
+
+   void priv_rehash(size_type n)
+   {
+      //Only the bucket allocation can throw
+      this->priv_reallocate_buckets(n);
+      Icont old_nodes;
+      old_nodes.swap(this->icont());
+      //Hash values are cached so relinking does not call the hash function.
+      //Equivalent elements are consecutive so they remain consecutive.
+      while(!old_nodes.empty()){
+         Node &n = old_nodes.front();
+         old_nodes.pop_front();
+         this->priv_link_bucket_begin(n, this->priv_bucket(n.m_hash));
+      }
+   }
 };
+
+} //namespace container_detail {
+} //namespace container {
+} //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif //BOOST_CONTAINER_DETAIL_HASH_TABLE_HPP
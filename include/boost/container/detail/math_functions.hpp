@@ -114,6 +114,25 @@ inline std::size_t floor_log2 (std::size_t x)
    return log2;
 }
 
+//Fibonacci hashing: the hash value is multiplied by 2^N/phi so that the
+//upper bits of the result depend on all the bits of the input.
+template<std::size_t SizeOfSizeT = sizeof(std::size_t)>
+struct fibonacci_hash;
+
+template<>
+struct fibonacci_hash<4u>
+{
+   static std::size_t mix(std::size_t h)
+   {  return h*std::size_t(2654435769u);  }
+};
+
+template<>
+struct fibonacci_hash<8u>
+{
+   static std::size_t mix(std::size_t h)
+   {  return h*((std::size_t(0x9E3779B9u) << 16u << 16u) | std::size_t(0x7F4A7C15u));  }
+};
+
 } // namespace container_detail
 } // namespace container
 } // namespace boost
@@ -0,0 +1,254 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_DETAIL_MMAP_BLOCK_HPP
+#define BOOST_CONTAINER_DETAIL_MMAP_BLOCK_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/container/container_fwd.hpp>
+
+#if !defined(BOOST_HAS_UNISTD_H)
+   #error "mmap_allocator needs the POSIX mmap interface"
+#endif
+
+#include <unistd.h>
+#include <sys/mman.h>
+#include <cstddef>
+#include <cstdlib>
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+   #define MAP_ANONYMOUS MAP_ANON
+#endif
+
+#if defined(MAP_NORESERVE)
+   #define BOOST_CONTAINER_MMAP_NORESERVE MAP_NORESERVE
+#else
+   #define BOOST_CONTAINER_MMAP_NORESERVE 0
+#endif
+
+//mremap is a Linux extension, available if _GNU_SOURCE is defined
+#if defined(__linux__) && defined(MREMAP_MAYMOVE)
+   #define BOOST_CONTAINER_MMAP_HAS_MREMAP
+#endif
+
+namespace boost {
+namespace container {
+namespace container_detail {
+
+//A block starts with this header, padded to mmap_block_header_size bytes.
+//"reserved" is the size of the address space mapped for the block (zero if the
+//block was obtained from std::malloc) and "committed" the size (header included)
+//that the user can access.
+struct mmap_block_header
+{
+   std::size_t reserved;
+   std::size_t committed;
+};
+
+static const std::size_t mmap_block_header_size = 64u;
+
+//Smaller blocks are obtained from std::malloc, like glibc does by default
+static const std::size_t mmap_block_threshold = 128u*1024u;
+
+//Huge page size of x86-64 and most other 64 bit architectures
+static const std::size_t mmap_block_huge_page = 2u*1024u*1024u;
+
+inline mmap_block_header *mmap_block_get_header(void *block)
+{  return static_cast<mmap_block_header*>(block);  }
+
+inline std::size_t mmap_block_page_size()
+{
+   static const std::size_t page_size = std::size_t(::sysconf(_SC_PAGESIZE));
+   return page_size;
+}
+
+//Rounds up to the page size. bytes can't be near the maximum size_t value.
+inline std::size_t mmap_block_round(std::size_t bytes, std::size_t page_size)
+{  return (bytes + page_size - 1u) & ~(page_size - 1u);  }
+
+//Makes sure the kernel has mapped physical pages to [from, to) of the block
+inline void mmap_block_commit(char *base, std::size_t from, std::size_t to, unsigned int flags)
+{
+   if(!(flags & (mmap_populate | mmap_prefault)) || from >= to)
+      return;
+   const std::size_t page_size = mmap_block_page_size();
+   from &= ~(page_size - 1u);
+   #if defined(MADV_POPULATE_WRITE)
+   if((flags & mmap_populate) && 0 == ::madvise(base + from, to - from, MADV_POPULATE_WRITE))
+      return;
+   #endif
+   //Fallback for mmap_populate on older kernels: touch each page
+   for(; from < to; from += page_size){
+      volatile char *c = base + from;
+      *c = *c;
+   }
+}
+
+inline void mmap_block_advise(char *base, std::size_t from, std::size_t to, unsigned int flags)
+{
+   #if defined(MADV_HUGEPAGE)
+   if((flags & mmap_huge_pages) && from < to){
+      ::madvise(base + from, to - from, MADV_HUGEPAGE);
+   }
+   #else
+   (void)base; (void)from; (void)to; (void)flags;
+   #endif
+}
+
+//Maps "reserve" bytes of address space, aligned to the huge page size if requested.
+//Returns null on failure.
+inline char *mmap_block_map(std::size_t reserve, unsigned int flags)
+{
+   const int prot  = PROT_READ | PROT_WRITE;
+   const int mflag = MAP_PRIVATE | MAP_ANONYMOUS | BOOST_CONTAINER_MMAP_NORESERVE;
+   if((flags & mmap_huge_pages) && reserve >= mmap_block_huge_page &&
+      reserve <= std::size_t(-1) - mmap_block_huge_page){
+      //Map an extra huge page and trim both ends so that
+      //the block can be backed by huge pages from the start
+      void *const raw = ::mmap(0, reserve + mmap_block_huge_page, prot, mflag, -1, 0);
+      if(raw != MAP_FAILED){
+         char *const r = static_cast<char*>(raw);
+         const std::size_t head =
+            (mmap_block_huge_page - (std::size_t(r) & (mmap_block_huge_page - 1u))) & (mmap_block_huge_page - 1u);
+         if(head){
+            ::munmap(r, head);
+         }
+         if(mmap_block_huge_page - head){
+            ::munmap(r + head + reserve, mmap_block_huge_page - head);
+         }
+         return r + head;
+      }
+   }
+   void *const raw = ::mmap(0, reserve, prot, mflag, -1, 0);
+   return raw == MAP_FAILED ? 0 : static_cast<char*>(raw);
+}
+
+//Allocates a block of at least "bytes" bytes (header included) reserving
+//"reserve" bytes of address space to expand it in place. Returns null on failure.
+inline void *mmap_block_allocate(std::size_t bytes, std::size_t reserve, unsigned int flags)
+{
+   if(bytes < mmap_block_threshold){
+      void *const block = std::malloc(bytes);
+      if(block){
+         mmap_block_header &h = *mmap_block_get_header(block);
+         h.reserved  = 0u;
+         h.committed = bytes;
+      }
+      return block;
+   }
+   const std::size_t page_size = mmap_block_page_size();
+   bytes   = mmap_block_round(bytes, page_size);
+   reserve = reserve < bytes ? bytes : mmap_block_round(reserve, page_size);
+   char *base = mmap_block_map(reserve, flags);
+   //The system might not overcommit memory, try without the extra reservation
+   if(!base && reserve != bytes){
+      reserve = bytes;
+      base = mmap_block_map(reserve, flags);
+   }
+   if(base){
+      mmap_block_advise(base, 0u, reserve, flags);
+      mmap_block_header &h = *mmap_block_get_header(base);
+      h.reserved  = reserve;
+      h.committed = bytes;
+      mmap_block_commit(base, 0u, bytes, flags);
+   }
+   return base;
+}
+
+//Expands the block in place so that it can hold at least min_bytes, preferably
+//pref_bytes (header included). If the reservation is exhausted it's grown in place
+//to "reserve" bytes or to pref_bytes. Returns the new size or zero on failure.
+inline std::size_t mmap_block_expand
+   (void *block, std::size_t min_bytes, std::size_t pref_bytes, std::size_t reserve, unsigned int flags)
+{
+   mmap_block_header &h = *mmap_block_get_header(block);
+   if(!h.reserved){
+      return min_bytes <= h.committed ? h.committed : 0u;
+   }
+   char *const base = static_cast<char*>(block);
+   const std::size_t page_size = mmap_block_page_size();
+   pref_bytes = mmap_block_round(pref_bytes, page_size);
+   #if defined(BOOST_CONTAINER_MMAP_HAS_MREMAP)
+   if(pref_bytes > h.reserved){
+      //Try to grow the mapping without moving it, first with a new reservation
+      //and then with just the preferred size
+      const std::size_t candidates[2] = { mmap_block_round(reserve, page_size), pref_bytes };
+      for(std::size_t i = 0; i != 2u; ++i){
+         const std::size_t cand = candidates[i];
+         if(cand >= pref_bytes && MAP_FAILED != ::mremap(base, h.reserved, cand, 0)){
+            mmap_block_advise(base, h.reserved, cand, flags);
+            h.reserved = cand;
+            break;
+         }
+      }
+   }
+   #else
+   (void)reserve;
+   #endif
+   if(pref_bytes > h.reserved){
+      if(min_bytes > h.reserved){
+         return 0u;
+      }
+      pref_bytes = h.reserved;
+   }
+   if(pref_bytes > h.committed){
+      mmap_block_commit(base, h.committed, pref_bytes, flags);
+      h.committed = pref_bytes;
+   }
+   return h.committed;
+}
+
+//Returns to the system the pages of the block above "bytes" (header included),
+//keeping the address space reserved. If dry_run is true nothing is released.
+//Returns the new size of the block.
+inline std::size_t mmap_block_shrink(void *block, std::size_t bytes, bool dry_run)
+{
+   mmap_block_header &h = *mmap_block_get_header(block);
+   if(!h.reserved){
+      return h.committed;
+   }
+   bytes = mmap_block_round(bytes, mmap_block_page_size());
+   if(bytes < h.committed && !dry_run){
+      ::madvise(static_cast<char*>(block) + bytes, h.committed - bytes, MADV_DONTNEED);
+      h.committed = bytes;
+   }
+   return bytes < h.committed ? bytes : h.committed;
+}
+
+inline std::size_t mmap_block_size(void *block)
+{  return mmap_block_get_header(block)->committed;  }
+
+inline void mmap_block_deallocate(void *block)
+{
+   mmap_block_header &h = *mmap_block_get_header(block);
+   if(h.reserved){
+      ::munmap(block, h.reserved);
+   }
+   else{
+      std::free(block);
+   }
+}
+
+}  //namespace container_detail {
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //#ifndef BOOST_CONTAINER_DETAIL_MMAP_BLOCK_HPP
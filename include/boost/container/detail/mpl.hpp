@@ -77,6 +77,27 @@ struct select1st
    {  return x;   }
 };
 
+//Detects a nested Compare::is_transparent type, which enables
+//heterogeneous lookup in associative containers
+template <class Compare>
+struct is_transparent
+{
+   template <class U>
+   static yes_type test(typename U::is_transparent*);
+
+   template <class U>
+   static no_type test(...);
+
+   static const bool value = sizeof(test<Compare>(0)) == sizeof(yes_type);
+};
+
+//K must be a template parameter of the lookup function so that
+//the overload is removed (SFINAE) for non-transparent comparators
+template <class Compare, class K, class R>
+struct enable_if_transparent
+   : enable_if_c<is_transparent<Compare>::value, R>
+{};
+
 }  //namespace container_detail {
 }  //namespace container {
 }  //namespace boost {
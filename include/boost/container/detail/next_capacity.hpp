@@ -22,53 +22,88 @@
 #include <boost/container/throw_exception.hpp>
 // container/detail
 #include <boost/container/detail/min_max.hpp>
+#include <boost/container/detail/workaround.hpp>
+// other
+#include <boost/static_assert.hpp>
+#include <cstddef>
 
 namespace boost {
 namespace container {
 namespace container_detail {
 
-enum NextCapacityOption { NextCapacityDouble, NextCapacity60Percent };
-
-template<class SizeType, NextCapacityOption Option>
-struct next_capacity_calculator;
-
-template<class SizeType>
-struct next_capacity_calculator<SizeType, NextCapacityDouble>
+//Grows the capacity a Numerator/Denominator fraction (at most 100%) of the current capacity
+template<std::size_t Numerator, std::size_t Denominator>
+struct grow_factor_ratio
 {
-   static SizeType get(const SizeType max_size
-                      ,const SizeType capacity
-                      ,const SizeType n)
+   BOOST_STATIC_ASSERT(( Denominator != 0u && Numerator != 0u && Numerator <= Denominator ));
+
+   template<class SizeType>
+   SizeType operator()(const SizeType cur_cap, const SizeType add_min_cap, const SizeType max_cap) const
    {
-      const SizeType remaining = max_size - capacity;
-      if ( remaining < n )
-         boost::container::throw_length_error("get_next_capacity, allocator's max_size reached");
-      const SizeType additional = max_value(n, capacity);
-      return ( remaining < additional ) ? max_size : ( capacity + additional );
+      //cur_cap*Numerator/Denominator can't overflow as the result is not greater than cur_cap
+      const SizeType additional = SizeType
+         (cur_cap/Denominator*Numerator + cur_cap%Denominator*Numerator/Denominator);
+      const SizeType remaining = max_cap - cur_cap;
+      const SizeType grow = max_value(add_min_cap, additional);
+      return ( remaining < grow ) ? max_cap : SizeType( cur_cap + grow );
    }
 };
 
-template<class SizeType>
-struct next_capacity_calculator<SizeType, NextCapacity60Percent>
+//Grows the capacity a fixed number of elements
+template<std::size_t Increment>
+struct grow_increment
 {
-   static SizeType get(const SizeType max_size
-                     ,const SizeType capacity
-                     ,const SizeType n)
-   {
-      const SizeType remaining = max_size - capacity;
-      if ( remaining < n )
-         boost::container::throw_length_error("get_next_capacity, allocator's max_size reached");
-      const SizeType m3 = max_size/3;
+   BOOST_STATIC_ASSERT(( Increment != 0u ));
 
-      if (capacity < m3)
-         return capacity + max_value(3*(capacity+1)/5, n);
-
-      if (capacity < m3*2)
-         return capacity + max_value((capacity+1)/2, n);
-      return max_size;
+   template<class SizeType>
+   SizeType operator()(const SizeType cur_cap, const SizeType add_min_cap, const SizeType max_cap) const
+   {
+      const SizeType remaining = max_cap - cur_cap;
+      const SizeType grow = max_value(add_min_cap, SizeType(Increment));
+      return ( remaining < grow ) ? max_cap : SizeType( cur_cap + grow );
    }
 };
 
+//Returns the capacity selected by GrowthFactor for a buffer of capacity elements that must
+//hold n more, throwing length_error if max_size would be exceeded.
+template<class GrowthFactor, class SizeType>
+SizeType next_capacity(const SizeType max_size, const SizeType capacity, const SizeType n)
+{
+   const SizeType remaining = max_size - capacity;
+   if ( remaining < n )
+      boost::container::throw_length_error("get_next_capacity, allocator's max_size reached");
+   //Don't trust user-defined policies to stay within bounds
+   const SizeType new_cap = GrowthFactor()(capacity, n, max_size);
+   return min_value(max_size, max_value(SizeType(capacity + n), new_cap));
+}
+
 }  //namespace container_detail {
+
+//! Growth factor policy (see \c boost::container::growth_factor) that increases
+//! the capacity a 50% when the existing capacity is exhausted.
+struct growth_factor_50
+   BOOST_CONTAINER_DOCIGN(: container_detail::grow_factor_ratio<1 BOOST_CONTAINER_I 2>)
+{};
+
+//! Growth factor policy (see \c boost::container::growth_factor) that increases
+//! the capacity a 60% when the existing capacity is exhausted.
+struct growth_factor_60
+   BOOST_CONTAINER_DOCIGN(: container_detail::grow_factor_ratio<3 BOOST_CONTAINER_I 5>)
+{};
+
+//! Growth factor policy (see \c boost::container::growth_factor) that doubles
+//! the capacity when the existing capacity is exhausted. This is the default.
+struct growth_factor_100
+   BOOST_CONTAINER_DOCIGN(: container_detail::grow_factor_ratio<1 BOOST_CONTAINER_I 1>)
+{};
+
+//! Growth factor policy (see \c boost::container::growth_factor) that increases
+//! the capacity by Increment elements when the existing capacity is exhausted.
+template<std::size_t Increment>
+struct growth_increment
+   BOOST_CONTAINER_DOCIGN(: container_detail::grow_increment<Increment>)
+{};
+
 }  //namespace container {
 }  //namespace boost {
 
@@ -33,6 +33,7 @@
 #include <boost/container/detail/iterator_to_raw_pointer.hpp>
 #include <boost/container/detail/mpl.hpp>
 #include <boost/container/detail/placement_new.hpp>
+#include <boost/container/detail/private_node_pool_allocator.hpp>
 #include <boost/container/detail/to_raw_pointer.hpp>
 #include <boost/container/detail/type_traits.hpp>
 #include <boost/container/detail/version_type.hpp>
@@ -55,7 +56,9 @@ namespace container_detail {
 BOOST_INTRUSIVE_INSTANTIATE_DEFAULT_TYPE_TMPLT(value_compare)
 BOOST_INTRUSIVE_INSTANTIATE_DEFAULT_TYPE_TMPLT(predicate_type)
 
-template<class Allocator, class ICont>
+//If PrivateNodePool is not zero nodes are allocated from a pool owned by the
+//container, that allocates PrivateNodePool nodes at once.
+template<class Allocator, class ICont, std::size_t PrivateNodePool = 0>
 struct node_alloc_holder
 {
    //If the intrusive container is an associative container, obtain the predicate, which will
@@ -72,7 +75,11 @@ struct node_alloc_holder
    typedef ICont                                                  intrusive_container;
    typedef typename ICont::value_type                             Node;
    typedef typename allocator_traits_type::template
-      portable_rebind_alloc<Node>::type                           NodeAlloc;
+      portable_rebind_alloc<Node>::type                           BaseNodeAlloc;
+   typedef typename container_detail::if_c
+      < PrivateNodePool != 0
+      , private_node_pool_allocator<BaseNodeAlloc, PrivateNodePool>
+      , BaseNodeAlloc>::type                                      NodeAlloc;
    typedef allocator_traits<NodeAlloc>                            node_allocator_traits_type;
    typedef container_detail::allocator_version_traits<NodeAlloc>  node_allocator_version_traits_type;
    typedef Allocator                                                      ValAlloc;
@@ -131,14 +138,14 @@ struct node_alloc_holder
 
    void copy_assign_alloc(const node_alloc_holder &x)
    {
-      container_detail::bool_<allocator_traits_type::propagate_on_container_copy_assignment::value> flag;
+      container_detail::bool_<NodeAllocTraits::propagate_on_container_copy_assignment::value> flag;
       container_detail::assign_alloc( static_cast<NodeAlloc &>(this->members_)
                                     , static_cast<const NodeAlloc &>(x.members_), flag);
    }
 
    void move_assign_alloc( node_alloc_holder &x)
    {
-      container_detail::bool_<allocator_traits_type::propagate_on_container_move_assignment::value> flag;
+      container_detail::bool_<NodeAllocTraits::propagate_on_container_move_assignment::value> flag;
       container_detail::move_alloc( static_cast<NodeAlloc &>(this->members_)
                                   , static_cast<NodeAlloc &>(x.members_), flag);
    }
@@ -279,7 +286,7 @@ struct node_alloc_holder
    void swap(node_alloc_holder &x)
    {
       this->icont().swap(x.icont());
-      container_detail::bool_<allocator_traits_type::propagate_on_container_swap::value> flag;
+      container_detail::bool_<NodeAllocTraits::propagate_on_container_swap::value> flag;
       container_detail::swap_alloc(this->node_alloc(), x.node_alloc(), flag);
    }
 
@@ -321,8 +328,12 @@ struct node_alloc_holder
             node_deallocator.release();
          }
          BOOST_CATCH(...){
-            mem.incorporate_after(mem.last(), &*itbeg, &*itlast, n);
-            node_allocator_version_traits_type::deallocate_individual(this->node_alloc(), mem);
+            //The node being constructed is freed by node_deallocator,
+            //return the rest, if any, to the allocator
+            if(n){
+               mem.incorporate_after(mem.last(), &*itbeg, &*itlast, n);
+               node_allocator_version_traits_type::deallocate_individual(this->node_alloc(), mem);
+            }
             BOOST_RETHROW
          }
          BOOST_CATCH_END
@@ -330,7 +341,7 @@ struct node_alloc_holder
    }
 
    void clear(version_1)
-   {  this->icont().clear_and_dispose(Destroyer(this->node_alloc()));   }
+   {  this->priv_clear(container_detail::bool_<PrivateNodePool != 0>());   }
 
    void clear(version_2)
    {
@@ -367,6 +378,29 @@ struct node_alloc_holder
       return this->icont().erase_and_dispose(k, comp, chain_holder.get_chain_builder());
    }
 
+   private:
+   void priv_clear(container_detail::false_)
+   {  this->icont().clear_and_dispose(Destroyer(this->node_alloc()));   }
+
+   void priv_clear(container_detail::true_)
+   {
+      NodeAlloc &nalloc = this->node_alloc();
+      if(nalloc.is_pool_owner()){
+         //No node handle holds nodes of the pool: destroy the elements
+         //(if needed) and free the blocks of the pool at once.
+         if(container_detail::is_trivially_destructible<value_type>::value){
+            this->icont().clear();
+         }
+         else{
+            this->icont().clear_and_dispose(allocator_node_destroyer<NodeAlloc>(nalloc));
+         }
+         nalloc.release_nodes();
+      }
+      else{
+         this->icont().clear_and_dispose(Destroyer(nalloc));
+      }
+   }
+
    protected:
    struct cloner
    {
@@ -227,6 +227,14 @@ class private_node_pool_impl
       m_freelist.clear();
    }
 
+   //!Deallocates all used memory, including the nodes that were not deallocated.
+   //!Precondition: those nodes are not used anymore. Never throws
+   void release_blocks()
+   {
+      m_allocated = 0;
+      this->purge_blocks();
+   }
+
    void swap(private_node_pool_impl &other)
    {
       BOOST_ASSERT(m_nodes_per_block == other.m_nodes_per_block);
@@ -0,0 +1,229 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_DETAIL_PRIVATE_NODE_POOL_ALLOCATOR_HPP
+#define BOOST_CONTAINER_DETAIL_PRIVATE_NODE_POOL_ALLOCATOR_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container
+#include <boost/container/allocator_traits.hpp>
+// container/detail
+#include <boost/container/detail/alloc_helpers.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/node_pool.hpp>
+#include <boost/container/detail/to_raw_pointer.hpp>
+#include <boost/container/detail/version_type.hpp>
+// move
+#include <boost/move/utility_core.hpp>
+// other
+#include <boost/assert.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace container {
+namespace container_detail {
+
+//!Node allocator of node containers configured with the private_node_pool option.
+//!Single nodes are taken from a private_node_pool (NodesPerBlock nodes per block)
+//!that belongs to the container, so no lock is taken, nodes are packed densely
+//!and the container can free all the blocks at once. NodeAlloc is still used
+//!to construct and destroy the elements and to allocate arrays.
+//!
+//!The pool is reference counted and shared by copies of the allocator (e.g. the one
+//!stored in a node handle), which compare equal and can deallocate the nodes. The pool
+//!is created when the first node is allocated. Moved-from allocators and the ones
+//!returned by select_on_container_copy_construction() have no pool, so copies of a
+//!container don't share the pool with the original. The pool is not synchronized.
+template<class NodeAlloc, std::size_t NodesPerBlock>
+class private_node_pool_allocator
+   : public NodeAlloc
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   typedef allocator_traits<NodeAlloc>                      base_traits;
+   typedef private_node_pool_allocator
+      <NodeAlloc, NodesPerBlock>                            self_t;
+   BOOST_COPYABLE_AND_MOVABLE(private_node_pool_allocator)
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   typedef NodeAlloc                                        base_allocator_type;
+   typedef typename base_traits::value_type                 value_type;
+   typedef typename base_traits::pointer                    pointer;
+   typedef typename base_traits::const_pointer              const_pointer;
+   typedef typename base_traits::size_type                  size_type;
+   typedef typename base_traits::difference_type            difference_type;
+   typedef container_detail::version_type<self_t, 1>        version;
+
+   //Nodes are not owned by the base allocator, so the pool must travel with the nodes
+   typedef container_detail::false_type                     propagate_on_container_copy_assignment;
+   typedef container_detail::true_type                      propagate_on_container_move_assignment;
+   typedef container_detail::true_type                      propagate_on_container_swap;
+   typedef container_detail::false_type                     is_always_equal;
+
+   //!Rebound allocators don't use the pool
+   template<class T2>
+   struct rebind
+   {
+      typedef typename base_traits::template
+         portable_rebind_alloc<T2>::type other;
+   };
+
+   private_node_pool_allocator()
+      : NodeAlloc(), mp_pool()
+   {}
+
+   //!Also used to convert the allocator of the container, that
+   //!is implicitly convertible to NodeAlloc.
+   private_node_pool_allocator(const NodeAlloc &a)
+      : NodeAlloc(a), mp_pool()
+   {}
+
+   private_node_pool_allocator(const private_node_pool_allocator &x)
+      : NodeAlloc(static_cast<const NodeAlloc &>(x)), mp_pool(x.mp_pool)
+   {
+      if(mp_pool)
+         ++mp_pool->m_use_count;
+   }
+
+   private_node_pool_allocator(BOOST_RV_REF(private_node_pool_allocator) x)
+      : NodeAlloc(::boost::move(static_cast<NodeAlloc &>(x))), mp_pool(x.mp_pool)
+   {  x.mp_pool = 0;  }
+
+   ~private_node_pool_allocator()
+   {  this->priv_release_pool();  }
+
+   private_node_pool_allocator& operator=(BOOST_COPY_ASSIGN_REF(private_node_pool_allocator) x)
+   {
+      if(&x != this){
+         container_detail::assign_alloc
+            ( static_cast<NodeAlloc &>(*this), static_cast<const NodeAlloc &>(x)
+            , container_detail::bool_<base_traits::propagate_on_container_copy_assignment::value>());
+         if(x.mp_pool)
+            ++x.mp_pool->m_use_count;
+         this->priv_release_pool();
+         mp_pool = x.mp_pool;
+      }
+      return *this;
+   }
+
+   private_node_pool_allocator& operator=(BOOST_RV_REF(private_node_pool_allocator) x)
+   {
+      if(&x != this){
+         container_detail::move_alloc
+            ( static_cast<NodeAlloc &>(*this), static_cast<NodeAlloc &>(x)
+            , container_detail::bool_<base_traits::propagate_on_container_move_assignment::value>());
+         this->priv_release_pool();
+         mp_pool = x.mp_pool;
+         x.mp_pool = 0;
+      }
+      return *this;
+   }
+
+   //!Returns an allocator with the same base allocator and no pool.
+   private_node_pool_allocator select_on_container_copy_construction() const
+   {
+      return private_node_pool_allocator
+         (base_traits::select_on_container_copy_construction(static_cast<const NodeAlloc &>(*this)));
+   }
+
+   pointer allocate(size_type count, const void * = 0)
+   {
+      if(count != 1){
+         return base_traits::allocate(static_cast<NodeAlloc &>(*this), count);
+      }
+      if(!mp_pool){
+         mp_pool = new shared_pool_t;
+      }
+      return pointer(static_cast<value_type*>(mp_pool->allocate_node()));
+   }
+
+   void deallocate(const pointer &p, size_type count) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(count != 1){
+         base_traits::deallocate(static_cast<NodeAlloc &>(*this), p, count);
+      }
+      else{
+         BOOST_ASSERT(mp_pool);
+         mp_pool->deallocate_node(container_detail::to_raw_pointer(p));
+      }
+   }
+
+   //!Returns true if no other allocator shares the pool, so that the owner
+   //!can free all nodes at once calling release_nodes().
+   bool is_pool_owner() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !mp_pool || mp_pool->m_use_count == 1u;  }
+
+   //!Frees all the blocks of the pool without deallocating the nodes one by one.
+   //!Precondition: is_pool_owner() and the nodes are not used anymore.
+   void release_nodes() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(this->is_pool_owner());
+      if(mp_pool)
+         mp_pool->release_blocks();
+   }
+
+   friend void swap(self_t &l, self_t &r)
+   {
+      container_detail::swap_alloc
+         ( static_cast<NodeAlloc &>(l), static_cast<NodeAlloc &>(r)
+         , container_detail::bool_<base_traits::propagate_on_container_swap::value>());
+      shared_pool_t *const tmp = l.mp_pool;
+      l.mp_pool = r.mp_pool;
+      r.mp_pool = tmp;
+   }
+
+   //!Allocators are equal if they share the pool and their base allocators are equal
+   friend bool operator==(const private_node_pool_allocator &l, const private_node_pool_allocator &r)
+   {  return l.mp_pool == r.mp_pool && static_cast<const NodeAlloc &>(l) == static_cast<const NodeAlloc &>(r);  }
+
+   friend bool operator!=(const private_node_pool_allocator &l, const private_node_pool_allocator &r)
+   {  return !(l == r);  }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   struct shared_pool_t
+      : public private_node_pool<sizeof(value_type), NodesPerBlock>
+   {
+      shared_pool_t()
+         : m_use_count(1u)
+      {}
+
+      std::size_t m_use_count;
+   };
+
+   void priv_release_pool() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(mp_pool && !--mp_pool->m_use_count){
+         delete mp_pool;
+      }
+      mp_pool = 0;
+   }
+
+   shared_pool_t *mp_pool;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+}  //namespace container_detail {
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //#ifndef BOOST_CONTAINER_DETAIL_PRIVATE_NODE_POOL_ALLOCATOR_HPP
@@ -24,16 +24,19 @@
 // container
 #include <boost/container/allocator_traits.hpp>
 #include <boost/container/container_fwd.hpp>
+#include <boost/container/node_handle.hpp>
 #include <boost/container/options.hpp>
 
 // container/detail
 #include <boost/container/detail/algorithm.hpp> //algo_equal(), algo_lexicographical_compare
 #include <boost/container/detail/compare_functors.hpp>
 #include <boost/container/detail/destroyers.hpp>
+#include <boost/container/detail/hash.hpp>
 #include <boost/container/detail/iterator.hpp>
 #include <boost/container/detail/iterators.hpp>
 #include <boost/container/detail/node_alloc_holder.hpp>
 #include <boost/container/detail/pair.hpp>
+#include <boost/container/detail/to_raw_pointer.hpp>
 #include <boost/container/detail/type_traits.hpp>
 // intrusive
 #include <boost/intrusive/pointer_traits.hpp>
@@ -51,6 +54,7 @@
 #endif
 // other
 #include <boost/core/no_exceptions_support.hpp>
+#include <boost/static_assert.hpp>
 
 
 
@@ -60,6 +64,32 @@ namespace boost {
 namespace container {
 namespace container_detail {
 
+//This trait is used to type-pun std::pair because in C++03
+//compilers std::pair is useless for C++11 features
+template<class T>
+struct tree_internal_data_type
+{
+   typedef T type;
+};
+
+template<class T1, class T2>
+struct tree_internal_data_type< std::pair<T1, T2> >
+{
+   typedef pair<typename boost::move_detail::remove_const<T1>::type, T2> type;
+};
+
+//Node handles of sets (Key == T) only expose the value. Node handles
+//of maps also expose the key and mapped parts of the internal pair.
+template<class Key, class T>
+struct tree_node_handle_keymapped
+{
+   typedef typename if_c
+      < is_same<Key, T>::value
+      , void
+      , typename tree_internal_data_type<T>::type
+      >::type type;
+};
+
 template<class Key, class T, class Compare, class KeyOfValue>
 struct tree_value_compare
    :  public Compare
@@ -83,14 +113,19 @@ struct tree_value_compare
    key_compare &key_comp()
    {  return static_cast<key_compare &>(*this);  }
 
+   //key_type or, if Compare is transparent, any other type
+   //but the stored value, which is passed to Compare untouched
    template<class U>
    struct is_key
    {
-      static const bool value = is_same<const U, const key_type>::value;
+      static const bool value = is_same<const U, const key_type>::value ||
+         ( is_transparent<key_compare>::value &&
+           !is_same<const U, const value_type>::value &&
+           !is_same<const U, const typename tree_internal_data_type<value_type>::type>::value );
    };
 
    template<class U>
-   typename enable_if_c<is_key<U>::value, const key_type &>::type
+   typename enable_if_c<is_key<U>::value, const U &>::type
       key_forward(const U &key) const
    {  return key; }
 
@@ -149,24 +184,23 @@ struct intrusive_tree_hook<VoidPointer, boost::container::splay_tree, OptimizeSi
       >::type  type;
 };
 
-//This trait is used to type-pun std::pair because in C++03
-//compilers std::pair is useless for C++11 features
-template<class T>
-struct tree_internal_data_type
-{
-   typedef T type;
-};
+//Number of nodes of the subtree rooted at a node,
+//only stored by trees that keep order statistics
+template<bool OrderStatistics>
+struct tree_node_subtree_size
+{};
 
-template<class T1, class T2>
-struct tree_internal_data_type< std::pair<T1, T2> >
+template<>
+struct tree_node_subtree_size<true>
 {
-   typedef pair<typename boost::move_detail::remove_const<T1>::type, T2> type;
+   std::size_t m_subtree_size;
 };
 
 //The node to be store in the tree
-template <class T, class VoidPointer, boost::container::tree_type_enum tree_type_value, bool OptimizeSize>
+template <class T, class VoidPointer, boost::container::tree_type_enum tree_type_value, bool OptimizeSize, bool OrderStatistics = false>
 struct tree_node
    :  public intrusive_tree_hook<VoidPointer, tree_type_value, OptimizeSize>::type
+   ,  public tree_node_subtree_size<OrderStatistics>
 {
    private:
    //BOOST_COPYABLE_AND_MOVABLE(tree_node)
@@ -179,7 +213,8 @@ struct tree_node
    typedef typename tree_internal_data_type<T>::type     internal_type;
 
    typedef tree_node< T, VoidPointer
-                    , tree_type_value, OptimizeSize>     node_type;
+                    , tree_type_value, OptimizeSize
+                    , OrderStatistics>                   node_type;
 
    T &get_data()
    {
@@ -232,8 +267,8 @@ struct tree_node
    {  m_data = ::boost::move(v); }
 };
 
-template <class T, class VoidPointer, boost::container::tree_type_enum tree_type_value, bool OptimizeSize>
-struct iiterator_node_value_type< tree_node<T, VoidPointer, tree_type_value, OptimizeSize> > {
+template <class T, class VoidPointer, boost::container::tree_type_enum tree_type_value, bool OptimizeSize, bool OrderStatistics>
+struct iiterator_node_value_type< tree_node<T, VoidPointer, tree_type_value, OptimizeSize, OrderStatistics> > {
   typedef T type;
 };
 
@@ -251,6 +286,21 @@ class insert_equal_end_hint_functor
    {  this->icont_.insert_equal(this->icont_.cend(), n); }
 };
 
+template<class BulkBuilder>
+class bulk_build_functor
+{
+   BulkBuilder &builder_;
+
+   public:
+   bulk_build_functor(BulkBuilder &builder)
+      :  builder_(builder)
+   {}
+
+   template<class Node>
+   void operator()(Node &n)
+   {  this->builder_(n); }
+};
+
 template<class Node, class Icont>
 class push_back_functor
 {
@@ -326,7 +376,267 @@ struct intrusive_tree_dispatch
       >::type  type;
 };
 
-template<class Allocator, class ValueCompare, boost::container::tree_type_enum tree_type_value, bool OptimizeSize>
+//Intrusive tree that also stores in each node the number of nodes of its subtree,
+//so that the nth node and the index of a node are found in logarithmic time.
+//Red-black and AVL trees only restructure nodes of the path from the inserted or
+//erased position to the root and children of those nodes, so after each modification
+//the sizes of that path and of its children are recomputed from the bottom up.
+//Node sizes are not copied by cloners, so they are recomputed after cloning.
+template<class Icont>
+class order_statistic_tree
+   :  public Icont
+{
+   BOOST_MOVABLE_BUT_NOT_COPYABLE(order_statistic_tree)
+
+   public:
+   typedef typename Icont::node_traits          node_traits;
+   typedef typename Icont::value_traits         value_traits;
+   typedef typename node_traits::node_ptr       node_ptr;
+   typedef typename Icont::value_type           value_type;
+   typedef typename Icont::value_compare        value_compare;
+   typedef typename Icont::iterator             iterator;
+   typedef typename Icont::const_iterator       const_iterator;
+   typedef typename Icont::size_type            size_type;
+   typedef typename Icont::insert_commit_data   insert_commit_data;
+
+   order_statistic_tree()
+      :  Icont()
+   {}
+
+   explicit order_statistic_tree(const value_compare &comp)
+      :  Icont(comp)
+   {}
+
+   order_statistic_tree(BOOST_RV_REF(order_statistic_tree) x)
+      :  Icont(BOOST_MOVE_BASE(Icont, x))
+   {}
+
+   order_statistic_tree& operator=(BOOST_RV_REF(order_statistic_tree) x)
+   {
+      this->Icont::operator=(BOOST_MOVE_BASE(Icont, x));
+      return *this;
+   }
+
+   iterator insert_equal(value_type &value)
+   {  return this->priv_fix_inserted(this->Icont::insert_equal(value));  }
+
+   iterator insert_equal(const_iterator hint, value_type &value)
+   {  return this->priv_fix_inserted(this->Icont::insert_equal(hint, value));  }
+
+   iterator insert_unique_commit(value_type &value, const insert_commit_data &commit_data)
+   {  return this->priv_fix_inserted(this->Icont::insert_unique_commit(value, commit_data));  }
+
+   void push_back(value_type &value)
+   {
+      this->Icont::push_back(value);
+      this->priv_fix_path(this->Icont::iterator_to(value).pointed_node());
+   }
+
+   iterator erase(const_iterator i)
+   {
+      const node_ptr start(this->priv_erase_start(i.pointed_node()));
+      const iterator ret(this->Icont::erase(i));
+      this->priv_fix_path(start);
+      return ret;
+   }
+
+   template<class Disposer>
+   iterator erase_and_dispose(const_iterator i, Disposer disposer)
+   {
+      const node_ptr start(this->priv_erase_start(i.pointed_node()));
+      const iterator ret(this->Icont::erase_and_dispose(i, disposer));
+      this->priv_fix_path(start);
+      return ret;
+   }
+
+   //Each erasure can rotate nodes, so elements are erased one by one
+   template<class Disposer>
+   iterator erase_and_dispose(const_iterator b, const_iterator e, Disposer disposer)
+   {
+      if(b == e){
+         return this->Icont::erase_and_dispose(b, e, disposer);
+      }
+      iterator ret;
+      do{
+         ret = this->erase_and_dispose(b, disposer);
+         b = ret;
+      } while(b != e);
+      return ret;
+   }
+
+   template<class KeyType, class KeyTypeKeyCompare, class Disposer>
+   typename disable_if_convertible<KeyTypeKeyCompare, const_iterator, size_type>::type
+      erase_and_dispose(const KeyType& key, KeyTypeKeyCompare comp, Disposer disposer)
+   {
+      const std::pair<iterator, iterator> r(this->Icont::equal_range(key, comp));
+      const const_iterator e(r.second);
+      size_type n = 0u;
+      for(const_iterator it(r.first); it != e; ++n){
+         it = this->erase_and_dispose(it, disposer);
+      }
+      return n;
+   }
+
+   template<class Cloner, class Disposer>
+   void clone_from(const Icont &src, Cloner cloner, Disposer disposer)
+   {
+      this->Icont::clone_from(src, cloner, disposer);
+      this->rebuild_subtree_sizes();
+   }
+
+   //Recomputes the sizes of all nodes after linking them directly. Linear time.
+   void rebuild_subtree_sizes()
+   {  priv_rebuild(node_traits::get_parent(this->priv_header()));  }
+
+   iterator nth(size_type n)
+   {
+      const node_ptr x(this->priv_nth(n));
+      return x ? this->Icont::iterator_to(*value_traits::to_value_ptr(x)) : this->Icont::end();
+   }
+
+   const_iterator nth(size_type n) const
+   {
+      const node_ptr x(this->priv_nth(n));
+      return x ? this->Icont::iterator_to(*value_traits::to_value_ptr(x)) : this->Icont::cend();
+   }
+
+   size_type index_of(const_iterator p) const
+   {
+      node_ptr x(p.pointed_node());
+      const node_ptr header(this->priv_header());
+      if(x == header){
+         return this->size();
+      }
+      std::size_t index = priv_size(node_traits::get_left(x));
+      for(node_ptr parent(node_traits::get_parent(x)); parent != header; x = parent, parent = node_traits::get_parent(x)){
+         if(node_traits::get_right(parent) == x){
+            index += priv_size(node_traits::get_left(parent)) + 1u;
+         }
+      }
+      return static_cast<size_type>(index);
+   }
+
+   private:
+   node_ptr priv_header() const
+   {  return const_cast<order_statistic_tree&>(*this).Icont::end().pointed_node();  }
+
+   static std::size_t priv_size(const node_ptr &n)
+   {  return n ? value_traits::to_value_ptr(n)->m_subtree_size : 0u;  }
+
+   static void priv_recompute(const node_ptr &n)
+   {
+      value_traits::to_value_ptr(n)->m_subtree_size =
+         priv_size(node_traits::get_left(n)) + priv_size(node_traits::get_right(n)) + 1u;
+   }
+
+   static std::size_t priv_rebuild(const node_ptr &n)
+   {
+      if(!n){
+         return 0u;
+      }
+      const std::size_t sz = priv_rebuild(node_traits::get_left(n)) + priv_rebuild(node_traits::get_right(n)) + 1u;
+      value_traits::to_value_ptr(n)->m_subtree_size = sz;
+      return sz;
+   }
+
+   //Returns null if n is not less than size()
+   node_ptr priv_nth(size_type n) const
+   {
+      std::size_t k = n;
+      node_ptr x(node_traits::get_parent(this->priv_header()));
+      while(x){
+         const std::size_t left_size = priv_size(node_traits::get_left(x));
+         if(k < left_size){
+            x = node_traits::get_left(x);
+         }
+         else if(k == left_size){
+            break;
+         }
+         else{
+            k -= left_size + 1u;
+            x = node_traits::get_right(x);
+         }
+      }
+      return x;
+   }
+
+   //The lowest node whose subtree changes when z is erased. A node with
+   //two children is replaced by its successor, which leaves its parent.
+   static node_ptr priv_erase_start(const node_ptr &z)
+   {
+      const node_ptr right(node_traits::get_right(z));
+      if(!node_traits::get_left(z) || !right){
+         return node_traits::get_parent(z);
+      }
+      node_ptr y(right);
+      while(node_traits::get_left(y)){
+         y = node_traits::get_left(y);
+      }
+      return y == right ? y : node_traits::get_parent(y);
+   }
+
+   //Rotations only move nodes between the path and its children, whose
+   //own children are subtrees with up to date sizes.
+   void priv_fix_path(node_ptr n)
+   {
+      const node_ptr header(this->priv_header());
+      for(; n != header; n = node_traits::get_parent(n)){
+         if(const node_ptr l = node_traits::get_left(n)){
+            priv_recompute(l);
+         }
+         if(const node_ptr r = node_traits::get_right(n)){
+            priv_recompute(r);
+         }
+         priv_recompute(n);
+      }
+   }
+
+   iterator priv_fix_inserted(const iterator &it)
+   {
+      this->priv_fix_path(it.pointed_node());
+      return it;
+   }
+};
+
+template<class Icont>
+void rebuild_subtree_sizes(Icont &)
+{}
+
+template<class Icont>
+void rebuild_subtree_sizes(order_statistic_tree<Icont> &icont)
+{  icont.rebuild_subtree_sizes();  }
+
+//Proxy traits to find the nth element and the index of an element,
+//in logarithmic time if the tree keeps order statistics, linear otherwise
+template<bool OrderStatistics>
+struct intrusive_tree_order_proxy
+{
+   template<class Icont>
+   static typename Icont::iterator nth(Icont &c, typename Icont::size_type n)
+   {
+      typename Icont::iterator it(c.begin());
+      boost::container::iterator_advance(it, static_cast<typename Icont::difference_type>(n));
+      return it;
+   }
+
+   template<class Icont>
+   static typename Icont::size_type index_of(const Icont &c, typename Icont::const_iterator p)
+   {  return static_cast<typename Icont::size_type>(boost::container::iterator_distance(c.cbegin(), p));  }
+};
+
+template<>
+struct intrusive_tree_order_proxy<true>
+{
+   template<class Icont>
+   static typename Icont::iterator nth(Icont &c, typename Icont::size_type n)
+   {  return c.nth(n);  }
+
+   template<class Icont>
+   static typename Icont::size_type index_of(const Icont &c, typename Icont::const_iterator p)
+   {  return c.index_of(p);  }
+};
+
+template<class Allocator, class ValueCompare, boost::container::tree_type_enum tree_type_value, bool OptimizeSize, bool OrderStatistics = false>
 struct intrusive_tree_type
 {
    private:
@@ -338,7 +648,8 @@ struct intrusive_tree_type
       allocator_traits<Allocator>::size_type               size_type;
    typedef typename container_detail::tree_node
          < value_type, void_pointer
-         , tree_type_value, OptimizeSize>          node_type;
+         , tree_type_value, OptimizeSize
+         , OrderStatistics>                        node_type;
    typedef value_to_node_compare
       <node_type, ValueCompare>                    node_compare_type;
    //Deducing the hook type from node_type (e.g. node_type::hook_type) would
@@ -347,11 +658,16 @@ struct intrusive_tree_type
    typedef typename intrusive_tree_hook
       <void_pointer, tree_type_value
       , OptimizeSize>::type                        hook_type;
-   public:
    typedef typename intrusive_tree_dispatch
       < node_type, node_compare_type
       , size_type, hook_type
-      , tree_type_value>::type                     type;
+      , tree_type_value>::type                     icont_type;
+   public:
+   typedef typename if_c
+      < OrderStatistics
+      , order_statistic_tree<icont_type>
+      , icont_type
+      >::type                                      type;
 };
 
 //Trait to detect manually rebalanceable tree types
@@ -383,6 +699,177 @@ struct intrusive_tree_proxy<tree_type_value, true>
    {  c.rebalance(); }
 };
 
+//Sets the balancing metadata of a node of a perfectly balanced tree
+//built by balanced_tree_builder. red_depth is the depth of the
+//incomplete last level of the tree (zero if the last level is complete)
+//and left_height/right_height the heights of the children subtrees.
+template<boost::container::tree_type_enum tree_type_value>
+struct balanced_tree_metadata
+{
+   //Splay trees store no balancing information
+   template<class NodeTraits>
+   static void set(const typename NodeTraits::node_ptr &, std::size_t, std::size_t, std::size_t, std::size_t)
+   {}
+};
+
+template<>
+struct balanced_tree_metadata<red_black_tree>
+{
+   //Nodes of the incomplete last level are red, the rest black, so that
+   //every path from the root to a null link contains the same number of black nodes
+   template<class NodeTraits>
+   static void set(const typename NodeTraits::node_ptr &n, std::size_t depth, std::size_t red_depth, std::size_t, std::size_t)
+   {  NodeTraits::set_color(n, depth == red_depth ? NodeTraits::red() : NodeTraits::black());  }
+};
+
+template<>
+struct balanced_tree_metadata<avl_tree>
+{
+   template<class NodeTraits>
+   static void set(const typename NodeTraits::node_ptr &n, std::size_t, std::size_t, std::size_t left_height, std::size_t right_height)
+   {
+      NodeTraits::set_balance
+         ( n, left_height == right_height ? NodeTraits::zero()
+            : left_height < right_height  ? NodeTraits::positive() : NodeTraits::negative());
+   }
+};
+
+//Links n nodes, received in ascending order in a list threaded through their right
+//pointers, in a perfectly balanced tree hanging from header in linear time, without
+//comparisons nor rebalancing steps. Node sizes of sibling subtrees differ at most by one,
+//so all null links are in the two last levels.
+template<class NodeTraits, boost::container::tree_type_enum tree_type_value>
+class balanced_tree_builder
+{
+   typedef typename NodeTraits::node_ptr node_ptr;
+
+   public:
+   static void link(const node_ptr &header, const node_ptr &first, std::size_t n)
+   {
+      if(n){
+         balanced_tree_builder b(first, n);
+         std::size_t height;
+         const node_ptr root(b.build(n, 1u, height));
+         NodeTraits::set_parent(root, header);
+         NodeTraits::set_parent(header, root);
+         NodeTraits::set_left(header, first);
+         NodeTraits::set_right(header, b.m_last);
+      }
+   }
+
+   private:
+   balanced_tree_builder(const node_ptr &first, std::size_t n)
+      : m_next(first), m_last(), m_red_depth(0u)
+   {
+      //A tree of n nodes with a complete last level has 2^height - 1 nodes
+      std::size_t height = 0u;
+      for(std::size_t m = n; m; m >>= 1u){
+         ++height;
+      }
+      if((n & (n + 1u)) != 0u){
+         m_red_depth = height;
+      }
+   }
+
+   node_ptr build(std::size_t n, std::size_t depth, std::size_t &height)
+   {
+      if(!n){
+         height = 0u;
+         return node_ptr();
+      }
+      const std::size_t left_count = (n - 1u)/2u;
+      std::size_t left_height, right_height;
+      const node_ptr left(this->build(left_count, depth + 1u, left_height));
+      const node_ptr root(m_next);
+      m_next = NodeTraits::get_right(root);
+      m_last = root;
+      const node_ptr right(this->build(n - left_count - 1u, depth + 1u, right_height));
+      NodeTraits::set_left(root, left);
+      NodeTraits::set_right(root, right);
+      if(left){
+         NodeTraits::set_parent(left, root);
+      }
+      if(right){
+         NodeTraits::set_parent(right, root);
+      }
+      balanced_tree_metadata<tree_type_value>::template set<NodeTraits>
+         (root, depth, m_red_depth, left_height, right_height);
+      height = (left_height < right_height ? right_height : left_height) + 1u;
+      return root;
+   }
+
+   node_ptr    m_next;
+   node_ptr    m_last;
+   std::size_t m_red_depth;
+};
+
+//Builds the tree of an empty intrusive container from nodes received in ascending order.
+//Scapegoat trees keep additional sizing information in the container, so nodes are
+//appended through push_back. Other tree types link them in a perfectly balanced tree.
+template<class Icont, boost::container::tree_type_enum tree_type_value>
+class intrusive_tree_bulk_builder
+{
+   typedef typename Icont::node_traits    node_traits;
+   typedef typename Icont::value_type     value_type;
+   typedef typename node_traits::node_ptr node_ptr;
+
+   public:
+   explicit intrusive_tree_bulk_builder(Icont &icont)
+      : m_icont(icont), m_first(), m_last(), m_count(0u)
+   {  BOOST_ASSERT(icont.empty());  }
+
+   //Appends a node, which must not be less than the previous one
+   void operator()(value_type &v)
+   {
+      const node_ptr n(m_icont.iterator_to(v).pointed_node());
+      if(m_count){
+         node_traits::set_right(m_last, n);
+      }
+      else{
+         m_first = n;
+      }
+      m_last = n;
+      ++m_count;
+   }
+
+   //Links all the appended nodes in the container. This can't throw.
+   void link()
+   {
+      balanced_tree_builder<node_traits, tree_type_value>::link
+         (m_icont.end().pointed_node(), m_first, m_count);
+      //Boost.Intrusive offers no operation to adopt an already linked
+      //tree, so the size of the container is set directly
+      m_icont.sz_traits().set_size(m_count);
+      rebuild_subtree_sizes(m_icont);
+   }
+
+   private:
+   Icont       &m_icont;
+   node_ptr    m_first;
+   node_ptr    m_last;
+   std::size_t m_count;
+};
+
+template<class Icont>
+class intrusive_tree_bulk_builder<Icont, scapegoat_tree>
+{
+   typedef typename Icont::value_type     value_type;
+
+   public:
+   explicit intrusive_tree_bulk_builder(Icont &icont)
+      : m_icont(icont)
+   {  BOOST_ASSERT(icont.empty());  }
+
+   void operator()(value_type &v)
+   {  m_icont.push_back(v);  }
+
+   void link()
+   {}
+
+   private:
+   Icont &m_icont;
+};
+
 }  //namespace container_detail {
 
 namespace container_detail {
@@ -467,24 +954,29 @@ struct key_node_compare
    {  return KeyValueCompare::operator()(this->key_forward(key1), this->key_forward(key2));  }
 };
 
+//The last parameter selects a specialization for tree types
+//not based on Boost.Intrusive (see btree.hpp)
 template <class Key, class T, class KeyOfValue,
           class Compare, class Allocator,
-          class Options = tree_assoc_defaults>
+          class Options = tree_assoc_defaults,
+          boost::container::tree_type_enum TreeType = Options::tree_type>
 class tree
    : protected container_detail::node_alloc_holder
       < Allocator
       , typename container_detail::intrusive_tree_type
          < Allocator, tree_value_compare<Key, T, Compare, KeyOfValue> //ValComp
-         , Options::tree_type, Options::optimize_size>::type
+         , Options::tree_type, Options::optimize_size, Options::order_statistics>::type
+      , Options::private_node_pool
       >
 {
    typedef tree_value_compare
             <Key, T, Compare, KeyOfValue>                   ValComp;
    typedef typename container_detail::intrusive_tree_type
          < Allocator, ValComp, Options::tree_type
-         , Options::optimize_size>::type                    Icont;
+         , Options::optimize_size
+         , Options::order_statistics>::type                 Icont;
    typedef container_detail::node_alloc_holder
-      <Allocator, Icont>                                    AllocHolder;
+      <Allocator, Icont, Options::private_node_pool>        AllocHolder;
    typedef typename AllocHolder::NodePtr                    NodePtr;
    typedef tree < Key, T, KeyOfValue
                 , Compare, Allocator, Options>              ThisType;
@@ -498,9 +990,15 @@ class tree
    typedef container_detail::allocator_destroyer<NodeAlloc> Destroyer;
    typedef typename AllocHolder::alloc_version              alloc_version;
    typedef intrusive_tree_proxy<Options::tree_type>         intrusive_tree_proxy_t;
+   typedef intrusive_tree_order_proxy
+      <Options::order_statistics>                           intrusive_tree_order_proxy_t;
 
    BOOST_COPYABLE_AND_MOVABLE(tree)
 
+   //merge_unique/merge_equal relink nodes from trees with other comparison functions
+   template <class, class, class, class, class, class, boost::container::tree_type_enum>
+   friend class tree;
+
    public:
 
    typedef Key                                        key_type;
@@ -536,6 +1034,9 @@ class tree
    typedef container_detail::iterator_from_iiterator<iiterator, true >  const_iterator;
    typedef boost::container::reverse_iterator<iterator>                 reverse_iterator;
    typedef boost::container::reverse_iterator<const_iterator>           const_reverse_iterator;
+   typedef node_handle
+      <NodeAlloc, typename tree_node_handle_keymapped<Key, T>::type>    node_type;
+   typedef insert_return_type_base<iterator, node_type>                 insert_return_type;
 
    tree()
       : AllocHolder()
@@ -612,10 +1113,8 @@ class tree
    tree( ordered_range_t, InputIterator first, InputIterator last
          , const key_compare& comp = key_compare(), const allocator_type& a = allocator_type()
          #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
-      , typename container_detail::enable_if_or
-         < void
-         , container_detail::is_same<alloc_version, version_1>
-         , container_detail::is_input_iterator<InputIterator>
+      , typename container_detail::enable_if_c
+         < container_detail::is_input_iterator<InputIterator>::value
          >::type * = 0
          #endif
          )
@@ -630,19 +1129,30 @@ class tree
    tree( ordered_range_t, InputIterator first, InputIterator last
          , const key_compare& comp = key_compare(), const allocator_type& a = allocator_type()
          #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
-      , typename container_detail::disable_if_or
-         < void
-         , container_detail::is_same<alloc_version, version_1>
-         , container_detail::is_input_iterator<InputIterator>
+      , typename container_detail::disable_if_c
+         < container_detail::is_input_iterator<InputIterator>::value
          >::type * = 0
          #endif
          )
       : AllocHolder(value_compare(comp), a)
    {
-      //Optimized allocation and construction
-      this->allocate_many_and_construct
-         ( first, boost::container::iterator_distance(first, last)
-         , container_detail::push_back_functor<Node, Icont>(this->icont()));
+      //All nodes are allocated in a single call and linked in a
+      //balanced tree in linear time, without rebalancing steps
+      typedef container_detail::intrusive_tree_bulk_builder
+         <Icont, Options::tree_type> bulk_builder_t;
+      bulk_builder_t builder(this->icont());
+      BOOST_TRY{
+         this->allocate_many_and_construct
+            ( first, boost::container::iterator_distance(first, last)
+            , container_detail::bulk_build_functor<bulk_builder_t>(builder));
+      }
+      BOOST_CATCH(...){
+         //Link already constructed nodes so that they are destroyed with the container
+         builder.link();
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      builder.link();
    }
 
    tree(const tree& x)
@@ -1097,6 +1607,214 @@ class tree
    void clear()
    {  AllocHolder::clear(alloc_version());  }
 
+   node_type extract(const key_type& k)
+   {
+      const iterator it = this->find(k);
+      if(this->end() != it){
+         return this->extract(it);
+      }
+      return node_type();
+   }
+
+   //The node is unlinked from the tree, not deallocated
+   node_type extract(const_iterator position)
+   {
+      BOOST_ASSERT(position != this->cend());
+      const NodePtr p(boost::intrusive::pointer_traits<NodePtr>::pointer_to(*position.get()));
+      this->icont().erase(position.get());
+      return node_type(p, this->node_alloc());
+   }
+
+   insert_return_type insert_unique_node(BOOST_RV_REF(node_type) nh)
+   {
+      insert_return_type irt; //inserted == false, node.empty()
+      if(!nh.empty()){
+         BOOST_ASSERT(this->node_alloc() == nh.node_alloc());
+         insert_commit_data data;
+         std::pair<iterator,bool> ret =
+            this->insert_unique_check(KeyOfValue()(nh.value()), data);
+         if(ret.second){
+            irt.inserted = true;
+            irt.position = iterator(this->icont().insert_unique_commit(*nh.get(), data));
+            nh.release();
+         }
+         else{
+            irt.position = ret.first;
+            irt.node = boost::move(nh);
+         }
+      }
+      else{
+         irt.position = this->end();
+      }
+      return boost::move(irt);
+   }
+
+   iterator insert_unique_node(const_iterator hint, BOOST_RV_REF(node_type) nh)
+   {
+      if(nh.empty()){
+         return this->end();
+      }
+      BOOST_ASSERT(this->node_alloc() == nh.node_alloc());
+      insert_commit_data data;
+      std::pair<iterator,bool> ret =
+         this->insert_unique_check(hint, KeyOfValue()(nh.value()), data);
+      if(ret.second){
+         ret.first = iterator(this->icont().insert_unique_commit(*nh.get(), data));
+         nh.release();
+      }
+      return ret.first;
+   }
+
+   iterator insert_equal_node(BOOST_RV_REF(node_type) nh)
+   {
+      if(nh.empty()){
+         return this->end();
+      }
+      BOOST_ASSERT(this->node_alloc() == nh.node_alloc());
+      const iterator ret(this->icont().insert_equal(*nh.get()));
+      nh.release();
+      return ret;
+   }
+
+   iterator insert_equal_node(const_iterator hint, BOOST_RV_REF(node_type) nh)
+   {
+      if(nh.empty()){
+         return this->end();
+      }
+      BOOST_ASSERT(this->node_alloc() == nh.node_alloc());
+      const iterator ret(this->icont().insert_equal(hint.get(), *nh.get()));
+      nh.release();
+      return ret;
+   }
+
+   //Nodes are unlinked from source and linked in *this. Nodes whose key is
+   //already present in *this stay in source.
+   template<class C2>
+   void merge_unique(tree<Key, T, KeyOfValue, C2, Allocator, Options> &source)
+   {
+      typedef typename tree<Key, T, KeyOfValue, C2, Allocator, Options>::iiterator source_iiterator;
+      BOOST_ASSERT(this->node_alloc() == source.node_alloc());
+      source_iiterator it(source.icont().begin());
+      const source_iiterator itend(source.icont().end());
+      while(it != itend){
+         Node &n = *it;
+         insert_commit_data data;
+         if(this->insert_unique_check(KeyOfValue()(n.get_data()), data).second){
+            it = source.icont().erase(it);
+            this->icont().insert_unique_commit(n, data);
+         }
+         else{
+            ++it;
+         }
+      }
+   }
+
+   //All nodes are unlinked from source and linked in *this
+   //after the already present equivalent elements.
+   template<class C2>
+   void merge_equal(tree<Key, T, KeyOfValue, C2, Allocator, Options> &source)
+   {
+      typedef typename tree<Key, T, KeyOfValue, C2, Allocator, Options>::iiterator source_iiterator;
+      if(static_cast<void*>(&source) == static_cast<void*>(this))
+         return;
+      BOOST_ASSERT(this->node_alloc() == source.node_alloc());
+      source_iiterator it(source.icont().begin());
+      const source_iiterator itend(source.icont().end());
+      while(it != itend){
+         Node &n = *it;
+         it = source.icont().erase(it);
+         this->icont().insert_equal(n);
+      }
+   }
+
+   //Set algebra for unique trees. Elements of the smaller tree are searched in
+   //the larger one starting from the previous result (finger search), so that
+   //m ordered searches in a tree of n elements take O(m log(n/m + 1)) steps.
+
+   //Inserts copies of the elements of x whose keys are not present in *this
+   void merge_union_unique(const tree &x)
+   {
+      if(&x == this){
+         return;
+      }
+      const key_compare key_cmp(this->key_comp());
+      const_iterator finger(this->cbegin());
+      for(const_iterator it(x.cbegin()), itend(x.cend()); it != itend; ++it){
+         const key_type &k = KeyOfValue()(*it);
+         finger = this->priv_lower_bound_from(finger, k);
+         if(finger == this->cend() || key_cmp(k, KeyOfValue()(*finger))){
+            //Inserted just before finger, so the hint is always right
+            finger = this->insert_unique(finger, *it);
+            ++finger;
+         }
+      }
+   }
+
+   //Erases the elements of *this whose keys are not present in x
+   void intersect_with_unique(const tree &x)
+   {
+      const key_compare key_cmp(this->key_comp());
+      if(&x == this){
+         return;
+      }
+      else if(this->size() <= x.size()){
+         const_iterator finger(x.cbegin());
+         for(const_iterator it(this->cbegin()); it != this->cend(); ){
+            const key_type &k = KeyOfValue()(*it);
+            finger = x.priv_lower_bound_from(finger, k);
+            if(finger == x.cend() || key_cmp(k, KeyOfValue()(*finger))){
+               it = this->erase(it);
+            }
+            else{
+               ++it;
+            }
+         }
+      }
+      else{
+         const_iterator it(this->cbegin());
+         for(const_iterator xit(x.cbegin()), xitend(x.cend()); xit != xitend && it != this->cend(); ++xit){
+            const key_type &k = KeyOfValue()(*xit);
+            it = this->erase(it, this->priv_lower_bound_from(it, k));
+            if(it != this->cend() && !key_cmp(k, KeyOfValue()(*it))){
+               ++it;
+            }
+         }
+         this->erase(it, this->cend());
+      }
+   }
+
+   //Erases the elements of *this whose keys are present in x
+   void subtract_unique(const tree &x)
+   {
+      const key_compare key_cmp(this->key_comp());
+      if(&x == this){
+         this->clear();
+      }
+      else if(this->size() <= x.size()){
+         const_iterator finger(x.cbegin());
+         for(const_iterator it(this->cbegin()); it != this->cend(); ){
+            const key_type &k = KeyOfValue()(*it);
+            finger = x.priv_lower_bound_from(finger, k);
+            if(finger != x.cend() && !key_cmp(k, KeyOfValue()(*finger))){
+               it = this->erase(it);
+            }
+            else{
+               ++it;
+            }
+         }
+      }
+      else{
+         const_iterator it(this->cbegin());
+         for(const_iterator xit(x.cbegin()), xitend(x.cend()); xit != xitend && it != this->cend(); ++xit){
+            const key_type &k = KeyOfValue()(*xit);
+            it = this->priv_lower_bound_from(it, k);
+            if(it != this->cend() && !key_cmp(k, KeyOfValue()(*it))){
+               it = this->erase(it);
+            }
+         }
+      }
+   }
+
    // search operations. Const and non-const overloads even if no iterator is returned
    // so splay implementations can to their rebalancing when searching in non-const versions
    iterator find(const key_type& k)
@@ -1150,9 +1868,225 @@ class tree
          (const_iterator(ret.first), const_iterator(ret.second));
    }
 
+   template<class KeyForwardIterator, class OutputIterator>
+   OutputIterator find_batch(KeyForwardIterator first, KeyForwardIterator last, OutputIterator out)
+   {  return this->template priv_find_batch<iterator>(first, last, out, is_splay_t());  }
+
+   template<class KeyForwardIterator, class OutputIterator>
+   OutputIterator find_batch(KeyForwardIterator first, KeyForwardIterator last, OutputIterator out) const
+   {  return this->template priv_find_batch<const_iterator>(first, last, out, false_type());  }
+
+   //Heterogeneous lookup, only available for transparent comparators
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      find(const K& k)
+   {  return iterator(this->icont().find(k, KeyNodeCompare(value_comp())));  }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      find(const K& k) const
+   {  return const_iterator(this->non_const_icont().find(k, KeyNodeCompare(value_comp())));  }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, size_type>::type
+      count(const K& k) const
+   {  return size_type(this->icont().count(k, KeyNodeCompare(value_comp()))); }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      lower_bound(const K& k)
+   {  return iterator(this->icont().lower_bound(k, KeyNodeCompare(value_comp())));  }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      lower_bound(const K& k) const
+   {  return const_iterator(this->non_const_icont().lower_bound(k, KeyNodeCompare(value_comp())));  }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      upper_bound(const K& k)
+   {  return iterator(this->icont().upper_bound(k, KeyNodeCompare(value_comp())));   }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      upper_bound(const K& k) const
+   {  return const_iterator(this->non_const_icont().upper_bound(k, KeyNodeCompare(value_comp())));  }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<iterator,iterator> >::type
+      equal_range(const K& k)
+   {
+      std::pair<iiterator, iiterator> ret =
+         this->icont().equal_range(k, KeyNodeCompare(value_comp()));
+      return std::pair<iterator,iterator>(iterator(ret.first), iterator(ret.second));
+   }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<const_iterator, const_iterator> >::type
+      equal_range(const K& k) const
+   {
+      std::pair<iiterator, iiterator> ret =
+         this->non_const_icont().equal_range(k, KeyNodeCompare(value_comp()));
+      return std::pair<const_iterator,const_iterator>
+         (const_iterator(ret.first), const_iterator(ret.second));
+   }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<iterator,iterator> >::type
+      lower_bound_range(const K& k)
+   {
+      std::pair<iiterator, iiterator> ret =
+         this->icont().lower_bound_range(k, KeyNodeCompare(value_comp()));
+      return std::pair<iterator,iterator>(iterator(ret.first), iterator(ret.second));
+   }
+
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<const_iterator, const_iterator> >::type
+      lower_bound_range(const K& k) const
+   {
+      std::pair<iiterator, iiterator> ret =
+         this->non_const_icont().lower_bound_range(k, KeyNodeCompare(value_comp()));
+      return std::pair<const_iterator,const_iterator>
+         (const_iterator(ret.first), const_iterator(ret.second));
+   }
+
    void rebalance()
    {  intrusive_tree_proxy_t::rebalance(this->icont());   }
 
+   iterator nth(size_type n)
+   {
+      BOOST_ASSERT(n <= this->size());
+      return iterator(intrusive_tree_order_proxy_t::nth(this->icont(), n));
+   }
+
+   const_iterator nth(size_type n) const
+   {
+      BOOST_ASSERT(n <= this->size());
+      return const_iterator(intrusive_tree_order_proxy_t::nth(this->non_const_icont(), n));
+   }
+
+   size_type index_of(iterator p)
+   {  return intrusive_tree_order_proxy_t::index_of(this->icont(), p.get());  }
+
+   size_type index_of(const_iterator p) const
+   {  return intrusive_tree_order_proxy_t::index_of(this->icont(), p.get());  }
+
+   private:
+
+   typedef container_detail::bool_
+      <Options::tree_type == splay_tree>                    is_splay_t;
+
+   //Subtree sizes are only maintained through the rotations of red-black and AVL trees
+   BOOST_STATIC_ASSERT(( !Options::order_statistics ||
+                         Options::tree_type == red_black_tree || Options::tree_type == avl_tree ));
+
+   //Returns the first element not less than k, given that all the elements before
+   //finger are less than k. Climbs from finger until reaching the subtree holding
+   //the result and descends from there, so it takes O(log d) steps in a balanced
+   //tree, d being the distance between finger and the result. Splay trees are
+   //not restructured.
+   const_iterator priv_lower_bound_from(const const_iterator &finger, const key_type& k) const
+   {
+      typedef typename Icont::node_traits    node_traits;
+      typedef typename Icont::value_traits   value_traits;
+      typedef typename node_traits::node_ptr node_ptr;
+
+      Icont &icont = this->non_const_icont();
+      const KeyNodeCompare comp(value_comp());
+      const node_ptr header(icont.end().pointed_node());
+      node_ptr y(finger.get().pointed_node());
+      if(y == header || !comp(*value_traits::to_value_ptr(y), k)){
+         return finger;
+      }
+      //Left children whose parent is not less than k have the result in
+      //their subtree (or it's the parent). Right children are always climbed.
+      node_ptr result(header);
+      for(node_ptr p(node_traits::get_parent(y)); p != header; y = p, p = node_traits::get_parent(y)){
+         if(node_traits::get_left(p) == y && !comp(*value_traits::to_value_ptr(p), k)){
+            result = p;
+            break;
+         }
+      }
+      for(node_ptr x(y); x; ){
+         if(comp(*value_traits::to_value_ptr(x), k)){
+            x = node_traits::get_right(x);
+         }
+         else{
+            result = x;
+            x = node_traits::get_left(x);
+         }
+      }
+      return result == header
+         ? const_iterator(icont.end()) : const_iterator(icont.iterator_to(*value_traits::to_value_ptr(result)));
+   }
+
+   //Splay trees restructure themselves on each non-const search
+   template<class It, class KeyForwardIterator, class OutputIterator>
+   OutputIterator priv_find_batch
+      (KeyForwardIterator first, const KeyForwardIterator last, OutputIterator out, true_type)
+   {
+      for(; first != last; ++first, ++out){
+         *out = this->find(*first);
+      }
+      return out;
+   }
+
+   //Descends the tree for up to find_batch_size keys in round-robin order,
+   //prefetching the next node of each descent while the others are compared,
+   //so that several cache misses are in flight at the same time.
+   template<class It, class KeyForwardIterator, class OutputIterator>
+   OutputIterator priv_find_batch
+      (KeyForwardIterator first, const KeyForwardIterator last, OutputIterator out, false_type) const
+   {
+      typedef typename Icont::node_traits    node_traits;
+      typedef typename Icont::value_traits   value_traits;
+      typedef typename node_traits::node_ptr node_ptr;
+
+      Icont &icont = this->non_const_icont();
+      const KeyNodeCompare comp(value_comp());
+      const node_ptr header(icont.end().pointed_node());
+      const node_ptr root(node_traits::get_parent(header));
+      KeyForwardIterator keys[container_detail::find_batch_size];
+      node_ptr x[container_detail::find_batch_size];
+      node_ptr y[container_detail::find_batch_size];
+      while(first != last){
+         std::size_t m = 0;
+         for(; m != container_detail::find_batch_size && first != last; ++m, ++first){
+            keys[m] = first;
+            x[m] = root;
+            y[m] = header;
+         }
+         for(bool pending = true; pending; ){
+            pending = false;
+            for(std::size_t i = 0; i != m; ++i){
+               const node_ptr n(x[i]);
+               if(n){
+                  if(comp(*value_traits::to_value_ptr(n), *keys[i])){
+                     x[i] = node_traits::get_right(n);
+                  }
+                  else{
+                     y[i] = n;
+                     x[i] = node_traits::get_left(n);
+                  }
+                  if(x[i]){
+                     BOOST_CONTAINER_PREFETCH(container_detail::to_raw_pointer(x[i]));
+                     pending = true;
+                  }
+               }
+            }
+         }
+         for(std::size_t i = 0; i != m; ++i, ++out){
+            const node_ptr n(y[i]);
+            *out = (n == header || comp(*keys[i], *value_traits::to_value_ptr(n)))
+               ? It(icont.end()) : It(icont.iterator_to(*value_traits::to_value_ptr(n)));
+         }
+      }
+      return out;
+   }
+
+   public:
+
    friend bool operator==(const tree& x, const tree& y)
    {  return x.size() == y.size() && ::boost::container::algo_equal(x.begin(), x.end(), y.begin());  }
 
@@ -1162,6 +2096,9 @@ class tree
    friend bool operator!=(const tree& x, const tree& y)
    {  return !(x == y);  }
 
+   friend std::size_t hash_value(const tree& x)
+   {  return container_detail::hash_range(x.begin(), x.end());  }
+
    friend bool operator>(const tree& x, const tree& y)
    {  return y < x;  }
 
@@ -1183,11 +2120,12 @@ struct has_trivial_destructor_after_move;
 
 //!has_trivial_destructor_after_move<> == true_type
 //!specialization for optimizations
-template <class Key, class T, class KeyOfValue, class Compare, class Allocator, class Options>
+template <class Key, class T, class KeyOfValue, class Compare, class Allocator, class Options
+         , ::boost::container::tree_type_enum TreeType>
 struct has_trivial_destructor_after_move
    < 
       ::boost::container::container_detail::tree
-         <Key, T, KeyOfValue, Compare, Allocator, Options>
+         <Key, T, KeyOfValue, Compare, Allocator, Options, TreeType>
    >
 {
    typedef typename ::boost::container::allocator_traits<Allocator>::pointer pointer;
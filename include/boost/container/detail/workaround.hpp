@@ -54,6 +54,14 @@
 #define BOOST_CONTAINER_MEMZEROED_POINTER_IS_NULL
 #endif
 
+//Software prefetch hint for reading. Expands to nothing if the
+//compiler offers no portable way to issue it.
+#if defined(__GNUC__)
+   #define BOOST_CONTAINER_PREFETCH(ADDR) __builtin_prefetch((ADDR))
+#else
+   #define BOOST_CONTAINER_PREFETCH(ADDR)
+#endif
+
 #define BOOST_CONTAINER_DOC1ST(TYPE1, TYPE2) TYPE2
 #define BOOST_CONTAINER_I ,
 #define BOOST_CONTAINER_DOCIGN(T) T
@@ -0,0 +1,2122 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_DEVECTOR_HPP
+#define BOOST_CONTAINER_DEVECTOR_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/is_trivially_relocatable.hpp>
+#include <boost/container/new_allocator.hpp> //new_allocator
+#include <boost/container/options.hpp>
+#include <boost/container/throw_exception.hpp>
+#include <boost/container/vector.hpp>  //vec_iterator, vector_value_traits
+// container detail
+#include <boost/container/detail/addressof.hpp>
+#include <boost/container/detail/advanced_insert_int.hpp>
+#include <boost/container/detail/algorithm.hpp> //equal()
+#include <boost/container/detail/alloc_helpers.hpp>
+#include <boost/container/detail/allocation_type.hpp>
+#include <boost/container/detail/copy_move_algo.hpp>
+#include <boost/container/detail/destroyers.hpp>
+#include <boost/container/detail/hash.hpp>
+#include <boost/container/detail/iterator.hpp>
+#include <boost/container/detail/iterators.hpp>
+#include <boost/container/detail/iterator_to_raw_pointer.hpp>
+#include <boost/container/detail/min_max.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/next_capacity.hpp>
+#include <boost/container/detail/to_raw_pointer.hpp>
+#include <boost/container/detail/type_traits.hpp>
+#include <boost/container/detail/version_type.hpp>
+// intrusive
+#include <boost/intrusive/pointer_traits.hpp>
+// move
+#include <boost/move/adl_move_swap.hpp>
+#include <boost/move/iterator.hpp>
+#include <boost/move/traits.hpp>
+#include <boost/move/utility_core.hpp>
+// move/detail
+#if defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+#include <boost/move/detail/fwd_macros.hpp>
+#endif
+#include <boost/move/detail/move_helpers.hpp>
+// other
+#include <boost/core/no_exceptions_support.hpp>
+#include <boost/assert.hpp>
+
+//std
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+#include <initializer_list>   //for std::initializer_list
+#endif
+
+namespace boost {
+namespace container {
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace container_detail {
+
+//!This struct deallocates the buffer of a devector and stores
+//!the position of the elements in the buffer: [m_front, m_back)
+template <class Allocator>
+struct devector_alloc_holder
+   : public Allocator
+{
+   private:
+   BOOST_MOVABLE_BUT_NOT_COPYABLE(devector_alloc_holder)
+
+   public:
+   typedef Allocator allocator_type;
+   typedef boost::container::allocator_traits<Allocator> allocator_traits_type;
+   typedef typename allocator_traits_type::pointer       pointer;
+   typedef typename allocator_traits_type::size_type     size_type;
+
+   devector_alloc_holder()
+      BOOST_NOEXCEPT_IF(container_detail::is_nothrow_default_constructible<Allocator>::value)
+      : Allocator(), m_start(), m_capacity(), m_front(), m_back()
+   {}
+
+   template<class AllocConvertible>
+   explicit devector_alloc_holder(BOOST_FWD_REF(AllocConvertible) a) BOOST_NOEXCEPT_OR_NOTHROW
+      : Allocator(boost::forward<AllocConvertible>(a)), m_start(), m_capacity(), m_front(), m_back()
+   {}
+
+   //Allocates a buffer of exactly n elements, elements must be constructed by the caller
+   template<class AllocConvertible>
+   devector_alloc_holder(uninitialized_size_t, BOOST_FWD_REF(AllocConvertible) a, size_type n)
+      : Allocator(boost::forward<AllocConvertible>(a)), m_start(), m_capacity(), m_front(), m_back()
+   {
+      if(n){
+         m_start = this->allocate(n);
+         m_capacity = n;
+      }
+   }
+
+   devector_alloc_holder(uninitialized_size_t, size_type n)
+      : Allocator(), m_start(), m_capacity(), m_front(), m_back()
+   {
+      if(n){
+         m_start = this->allocate(n);
+         m_capacity = n;
+      }
+   }
+
+   devector_alloc_holder(BOOST_RV_REF(devector_alloc_holder) holder) BOOST_NOEXCEPT_OR_NOTHROW
+      : Allocator(BOOST_MOVE_BASE(Allocator, holder))
+      , m_start(holder.m_start), m_capacity(holder.m_capacity)
+      , m_front(holder.m_front), m_back(holder.m_back)
+   {
+      holder.m_start = pointer();
+      holder.m_capacity = holder.m_front = holder.m_back = 0;
+   }
+
+   ~devector_alloc_holder() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(m_capacity){
+         this->alloc().deallocate(m_start, m_capacity);
+      }
+   }
+
+   pointer allocate(size_type n)
+   {
+      if(n > allocator_traits_type::max_size(this->alloc())){
+         boost::container::throw_length_error("devector: max_size() exceeded");
+      }
+      return allocator_traits_type::allocate(this->alloc(), n);
+   }
+
+   pointer allocation_command(boost::container::allocation_type command,
+                              size_type limit_size, size_type &prefer_in_recvd_out_size, pointer &reuse)
+   {  return this->alloc().allocation_command(command, limit_size, prefer_in_recvd_out_size, reuse);  }
+
+   //Capacity selected by GrowthFactor for a buffer that must hold at least min_cap elements
+   template<class GrowthFactorType>
+   size_type next_capacity(size_type min_cap) const
+   {
+      return container_detail::next_capacity<GrowthFactorType>
+         ( allocator_traits_type::max_size(this->alloc())
+         , m_capacity, size_type(min_cap > m_capacity ? min_cap - m_capacity : 0u));
+   }
+
+   void swap_resources(devector_alloc_holder &x) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      boost::adl_move_swap(this->m_start, x.m_start);
+      boost::adl_move_swap(this->m_capacity, x.m_capacity);
+      boost::adl_move_swap(this->m_front, x.m_front);
+      boost::adl_move_swap(this->m_back, x.m_back);
+   }
+
+   void steal_resources(devector_alloc_holder &x) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      this->m_start     = x.m_start;
+      this->m_capacity  = x.m_capacity;
+      this->m_front     = x.m_front;
+      this->m_back      = x.m_back;
+      x.m_start = pointer();
+      x.m_capacity = x.m_front = x.m_back = 0;
+   }
+
+   Allocator &alloc() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return *this;  }
+
+   const Allocator &alloc() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return *this;  }
+
+   pointer     m_start;
+   size_type   m_capacity;
+   size_type   m_front;
+   size_type   m_back;
+};
+
+}  //namespace container_detail {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! A devector is a sequence that, like vector, stores its elements contiguously
+//! in a single buffer, but keeps free capacity at both ends of it. Insertion and
+//! removal of elements at the beginning and at the end take amortized constant time,
+//! insertion and removal in the middle move the elements of the shortest side.
+//!
+//! When the free capacity at one end is exhausted, the elements are moved to the center
+//! of the buffer if at least half of it is free. Otherwise a new buffer is obtained
+//! (expanding the current one in place with version 2 allocators, forward when growing
+//! at the end and backwards when growing at the beginning) whose capacity is selected by the
+//! growth factor option. Most of the new free capacity is left at the end that is growing.
+//!
+//! \tparam T The type of object that is stored in the devector
+//! \tparam Allocator The allocator used for all internal memory management
+//! \tparam Options is an packed option type generated using boost::container::vector_options.
+template <class T, class Allocator BOOST_CONTAINER_DOCONLY(= new_allocator<T>), class Options BOOST_CONTAINER_DOCONLY(= vector_defaults) >
+class devector
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   typedef typename container_detail::version<Allocator>::type alloc_version;
+   typedef container_detail::devector_alloc_holder<Allocator> alloc_holder_t;
+   alloc_holder_t m_holder;
+   typedef allocator_traits<Allocator>                         allocator_traits_type;
+   typedef typename Options::growth_factor_type                growth_factor_type;
+
+   typedef typename allocator_traits_type::pointer  pointer_impl;
+   typedef container_detail::vec_iterator<pointer_impl, false> iterator_impl;
+   typedef container_detail::vec_iterator<pointer_impl, true > const_iterator_impl;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //                    types
+   //
+   //////////////////////////////////////////////
+
+   typedef T                                                                           value_type;
+   typedef typename ::boost::container::allocator_traits<Allocator>::pointer           pointer;
+   typedef typename ::boost::container::allocator_traits<Allocator>::const_pointer     const_pointer;
+   typedef typename ::boost::container::allocator_traits<Allocator>::reference         reference;
+   typedef typename ::boost::container::allocator_traits<Allocator>::const_reference   const_reference;
+   typedef typename ::boost::container::allocator_traits<Allocator>::size_type         size_type;
+   typedef typename ::boost::container::allocator_traits<Allocator>::difference_type   difference_type;
+   typedef Allocator                                                                   allocator_type;
+   typedef Allocator                                                                   stored_allocator_type;
+   #if defined BOOST_CONTAINER_VECTOR_ITERATOR_IS_POINTER
+   typedef BOOST_CONTAINER_IMPDEF(pointer)                                             iterator;
+   typedef BOOST_CONTAINER_IMPDEF(const_pointer)                                       const_iterator;
+   #else
+   typedef BOOST_CONTAINER_IMPDEF(iterator_impl)                                       iterator;
+   typedef BOOST_CONTAINER_IMPDEF(const_iterator_impl)                                 const_iterator;
+   #endif
+   typedef BOOST_CONTAINER_IMPDEF(boost::container::reverse_iterator<iterator>)        reverse_iterator;
+   typedef BOOST_CONTAINER_IMPDEF(boost::container::reverse_iterator<const_iterator>)  const_reverse_iterator;
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   BOOST_COPYABLE_AND_MOVABLE(devector)
+   typedef container_detail::vector_value_traits<Allocator> value_traits;
+   typedef constant_iterator<T, difference_type>            cvalue_iterator;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //          construct/copy/destroy
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Constructs a devector taking the allocator as parameter.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   devector() BOOST_NOEXCEPT_OR_NOTHROW
+      : m_holder()
+   {}
+
+   //! <b>Effects</b>: Constructs a devector taking the allocator as parameter.
+   //!
+   //! <b>Throws</b>: Nothing
+   //!
+   //! <b>Complexity</b>: Constant.
+   explicit devector(const allocator_type& a) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_holder(a)
+   {}
+
+   //! <b>Effects</b>: Constructs a devector and inserts n value initialized values.
+   //!
+   //! <b>Throws</b>: If allocator_type's allocation
+   //!   throws or T's value initialization throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   explicit devector(size_type n)
+      :  m_holder(container_detail::uninitialized_size, n)
+   {
+      boost::container::uninitialized_value_init_alloc_n(this->m_holder.alloc(), n, this->priv_raw_start());
+      this->m_holder.m_back = n;
+   }
+
+   //! <b>Effects</b>: Constructs a devector that will use a copy of allocator a
+   //!   and inserts n value initialized values.
+   //!
+   //! <b>Throws</b>: If allocator_type's allocation
+   //!   throws or T's value initialization throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   devector(size_type n, const allocator_type &a)
+      :  m_holder(container_detail::uninitialized_size, a, n)
+   {
+      boost::container::uninitialized_value_init_alloc_n(this->m_holder.alloc(), n, this->priv_raw_start());
+      this->m_holder.m_back = n;
+   }
+
+   //! <b>Effects</b>: Constructs a devector and inserts n default initialized values.
+   //!
+   //! <b>Throws</b>: If allocator_type's allocation
+   //!   throws or T's default initialization throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   devector(size_type n, default_init_t)
+      :  m_holder(container_detail::uninitialized_size, n)
+   {
+      boost::container::uninitialized_default_init_alloc_n(this->m_holder.alloc(), n, this->priv_raw_start());
+      this->m_holder.m_back = n;
+   }
+
+   //! <b>Effects</b>: Constructs a devector that will use a copy of allocator a
+   //!   and inserts n default initialized values.
+   //!
+   //! <b>Throws</b>: If allocator_type's allocation
+   //!   throws or T's default initialization throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   devector(size_type n, default_init_t, const allocator_type &a)
+      :  m_holder(container_detail::uninitialized_size, a, n)
+   {
+      boost::container::uninitialized_default_init_alloc_n(this->m_holder.alloc(), n, this->priv_raw_start());
+      this->m_holder.m_back = n;
+   }
+
+   //! <b>Effects</b>: Constructs a devector
+   //!   and inserts n copies of value.
+   //!
+   //! <b>Throws</b>: If allocator_type's allocation
+   //!   throws or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   devector(size_type n, const T& value)
+      :  m_holder(container_detail::uninitialized_size, n)
+   {
+      boost::container::uninitialized_fill_alloc_n(this->m_holder.alloc(), value, n, this->priv_raw_start());
+      this->m_holder.m_back = n;
+   }
+
+   //! <b>Effects</b>: Constructs a devector that will use a copy of allocator a
+   //!   and inserts n copies of value.
+   //!
+   //! <b>Throws</b>: If allocation
+   //!   throws or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   devector(size_type n, const T& value, const allocator_type& a)
+      :  m_holder(container_detail::uninitialized_size, a, n)
+   {
+      boost::container::uninitialized_fill_alloc_n(this->m_holder.alloc(), value, n, this->priv_raw_start());
+      this->m_holder.m_back = n;
+   }
+
+   //! <b>Effects</b>: Constructs a devector
+   //!   and inserts a copy of the range [first, last) in the devector.
+   //!
+   //! <b>Throws</b>: If allocator_type's allocation
+   //!   throws or T's constructor taking a dereferenced InIt throws.
+   //!
+   //! <b>Complexity</b>: Linear to the range [first, last).
+   template <class InIt>
+   devector(InIt first, InIt last)
+      :  m_holder()
+   {  this->assign(first, last); }
+
+   //! <b>Effects</b>: Constructs a devector that will use a copy of allocator a
+   //!   and inserts a copy of the range [first, last) in the devector.
+   //!
+   //! <b>Throws</b>: If allocator_type's allocation
+   //!   throws or T's constructor taking a dereferenced InIt throws.
+   //!
+   //! <b>Complexity</b>: Linear to the range [first, last).
+   template <class InIt>
+   devector(InIt first, InIt last, const allocator_type& a)
+      :  m_holder(a)
+   {  this->assign(first, last); }
+
+   //! <b>Effects</b>: Copy constructs a devector. The new devector
+   //!   has no free capacity at the front.
+   //!
+   //! <b>Postcondition</b>: x == *this.
+   //!
+   //! <b>Throws</b>: If allocator_type's allocation
+   //!   throws or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to the elements x contains.
+   devector(const devector &x)
+      :  m_holder( container_detail::uninitialized_size
+                 , allocator_traits_type::select_on_container_copy_construction(x.m_holder.alloc())
+                 , x.size())
+   {
+      ::boost::container::uninitialized_copy_alloc_n
+         (this->m_holder.alloc(), x.priv_raw_begin(), x.size(), this->priv_raw_start());
+      this->m_holder.m_back = x.size();
+   }
+
+   //! <b>Effects</b>: Copy constructs a devector using the specified allocator.
+   //!
+   //! <b>Postcondition</b>: x == *this.
+   //!
+   //! <b>Throws</b>: If allocation
+   //!   throws or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to the elements x contains.
+   devector(const devector &x, const allocator_type &a)
+      :  m_holder(container_detail::uninitialized_size, a, x.size())
+   {
+      ::boost::container::uninitialized_copy_alloc_n
+         (this->m_holder.alloc(), x.priv_raw_begin(), x.size(), this->priv_raw_start());
+      this->m_holder.m_back = x.size();
+   }
+
+   //! <b>Effects</b>: Move constructor. Moves x's resources to *this.
+   //!
+   //! <b>Throws</b>: Nothing
+   //!
+   //! <b>Complexity</b>: Constant.
+   devector(BOOST_RV_REF(devector) x) BOOST_NOEXCEPT_OR_NOTHROW
+      :  m_holder(boost::move(x.m_holder))
+   {}
+
+   //! <b>Effects</b>: Move constructor using the specified allocator.
+   //!                 Moves x's resources to *this if a == allocator_type().
+   //!                 Otherwise copies values from x to *this.
+   //!
+   //! <b>Throws</b>: If allocation or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Constant if a == x.get_allocator(), linear otherwise.
+   devector(BOOST_RV_REF(devector) x, const allocator_type &a)
+      :  m_holder( container_detail::uninitialized_size, a
+                 , allocator_traits_type::equal(x.m_holder.alloc(), a) ? 0u : x.size())
+   {
+      if(allocator_traits_type::equal(x.m_holder.alloc(), a)){
+         this->m_holder.steal_resources(x.m_holder);
+      }
+      else{
+         ::boost::container::uninitialized_move_alloc_n
+            (this->m_holder.alloc(), x.priv_raw_begin(), x.size(), this->priv_raw_start());
+         this->m_holder.m_back = x.size();
+      }
+   }
+
+   #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Constructs a devector that will use a copy of allocator a
+   //!  and inserts a copy of the range [il.begin(), il.last()) in the devector
+   //!
+   //! <b>Throws</b>: If T's constructor taking a dereferenced initializer_list iterator throws.
+   //!
+   //! <b>Complexity</b>: Linear to the range [il.begin(), il.end()).
+   devector(std::initializer_list<value_type> il, const allocator_type& a = allocator_type())
+      : m_holder(a)
+   {
+      this->assign(il.begin(), il.end());
+   }
+   #endif
+
+   //! <b>Effects</b>: Destroys the devector. All stored values are destroyed
+   //!   and used memory is deallocated.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements.
+   ~devector() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      boost::container::destroy_alloc_n(this->m_holder.alloc(), this->priv_raw_begin(), this->size());
+      //devector_alloc_holder deallocates the data
+   }
+
+   //! <b>Effects</b>: Makes *this contain the same elements as x.
+   //!
+   //! <b>Postcondition</b>: this->size() == x.size(). *this contains a copy
+   //! of each of x's elements.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or T's copy/move constructor/assignment throws.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in x.
+   devector& operator=(BOOST_COPY_ASSIGN_REF(devector) x)
+   {
+      if (&x != this){
+         this->priv_copy_assign(x);
+      }
+      return *this;
+   }
+
+   #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Make *this container contains elements from il.
+   //!
+   //! <b>Complexity</b>: Linear to the range [il.begin(), il.end()).
+   devector& operator=(std::initializer_list<value_type> il)
+   {
+      this->assign(il.begin(), il.end());
+      return *this;
+   }
+   #endif
+
+   //! <b>Effects</b>: Move assignment. All x's values are transferred to *this.
+   //!
+   //! <b>Postcondition</b>: x.empty(). *this contains a the elements x had
+   //!   before the function.
+   //!
+   //! <b>Throws</b>: If allocator_traits_type::propagate_on_container_move_assignment
+   //!   is false and (allocation throws or value_type's move constructor throws)
+   //!
+   //! <b>Complexity</b>: Constant if allocator_traits_type::
+   //!   propagate_on_container_move_assignment is true or
+   //!   this->get>allocator() == x.get_allocator(). Linear otherwise.
+   devector& operator=(BOOST_RV_REF(devector) x)
+      BOOST_NOEXCEPT_IF(allocator_traits_type::propagate_on_container_move_assignment::value
+                                  || allocator_traits_type::is_always_equal::value)
+   {
+      if (&x != this){
+         this->priv_move_assign(x);
+      }
+      return *this;
+   }
+
+   //! <b>Effects</b>: Assigns the the range [first, last) to *this.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or T's copy/move constructor/assignment or
+   //!   T's constructor/assignment from dereferencing InpIt throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   template <class InIt>
+   void assign(InIt first, InIt last
+      BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename container_detail::disable_if_convertible
+         <InIt BOOST_MOVE_I size_type>::type * = 0)
+      )
+   {
+      //Overwrite all elements we can from [first, last)
+      T *cur = this->priv_raw_begin();
+      T *const end_ptr = this->priv_raw_end();
+      for ( ; first != last && cur != end_ptr; ++cur, ++first){
+         *cur = *first;
+      }
+
+      if (first == last){
+         //There are no more elements in the sequence, erase remaining
+         this->priv_destroy_last_n(static_cast<size_type>(end_ptr - cur));
+      }
+      else{
+         //There are more elements in the range, insert the remaining ones
+         this->insert(this->cend(), first, last);
+      }
+   }
+
+   #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Assigns the the range [il.begin(), il.end()) to *this.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or
+   //!   T's constructor from dereferencing iniializer_list iterator throws.
+   //!
+   void assign(std::initializer_list<T> il)
+   {
+      this->assign(il.begin(), il.end());
+   }
+   #endif
+
+   //! <b>Effects</b>: Assigns the n copies of val to *this.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or
+   //!   T's copy/move constructor/assignment throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   void assign(size_type n, const value_type& val)
+   {  this->assign(cvalue_iterator(val, n), cvalue_iterator());   }
+
+   //! <b>Effects</b>: Returns a copy of the internal allocator.
+   //!
+   //! <b>Throws</b>: If allocator's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Constant.
+   allocator_type get_allocator() const BOOST_NOEXCEPT_OR_NOTHROW
+   { return this->m_holder.alloc();  }
+
+   //! <b>Effects</b>: Returns a reference to the internal allocator.
+   //!
+   //! <b>Throws</b>: Nothing
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   stored_allocator_type &get_stored_allocator() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_holder.alloc(); }
+
+   //! <b>Effects</b>: Returns a reference to the internal allocator.
+   //!
+   //! <b>Throws</b>: Nothing
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   const stored_allocator_type &get_stored_allocator() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_holder.alloc(); }
+
+   //////////////////////////////////////////////
+   //
+   //                iterators
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns an iterator to the first element contained in the devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   iterator begin() BOOST_NOEXCEPT_OR_NOTHROW
+   { return iterator(this->priv_begin_ptr()); }
+
+   //! <b>Effects</b>: Returns a const_iterator to the first element contained in the devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator begin() const BOOST_NOEXCEPT_OR_NOTHROW
+   { return const_iterator(this->priv_begin_ptr()); }
+
+   //! <b>Effects</b>: Returns an iterator to the end of the devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   iterator end() BOOST_NOEXCEPT_OR_NOTHROW
+   { return iterator(this->priv_end_ptr()); }
+
+   //! <b>Effects</b>: Returns a const_iterator to the end of the devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator end() const BOOST_NOEXCEPT_OR_NOTHROW
+   { return this->cend(); }
+
+   //! <b>Effects</b>: Returns a reverse_iterator pointing to the beginning
+   //! of the reversed devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   reverse_iterator rbegin() BOOST_NOEXCEPT_OR_NOTHROW
+   { return reverse_iterator(this->end());      }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the beginning
+   //! of the reversed devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reverse_iterator rbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   { return this->crbegin(); }
+
+   //! <b>Effects</b>: Returns a reverse_iterator pointing to the end
+   //! of the reversed devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   reverse_iterator rend() BOOST_NOEXCEPT_OR_NOTHROW
+   { return reverse_iterator(this->begin());       }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end
+   //! of the reversed devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reverse_iterator rend() const BOOST_NOEXCEPT_OR_NOTHROW
+   { return this->crend(); }
+
+   //! <b>Effects</b>: Returns a const_iterator to the first element contained in the devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator cbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   { return const_iterator(this->priv_begin_ptr()); }
+
+   //! <b>Effects</b>: Returns a const_iterator to the end of the devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator cend() const BOOST_NOEXCEPT_OR_NOTHROW
+   { return const_iterator(this->priv_end_ptr()); }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the beginning
+   //! of the reversed devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reverse_iterator crbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   { return const_reverse_iterator(this->end());}
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end
+   //! of the reversed devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reverse_iterator crend() const BOOST_NOEXCEPT_OR_NOTHROW
+   { return const_reverse_iterator(this->begin()); }
+
+   //////////////////////////////////////////////
+   //
+   //                capacity
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns true if the devector contains no elements.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   bool empty() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_holder.m_front == this->m_holder.m_back;  }
+
+   //! <b>Effects</b>: Returns the number of the elements contained in the devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return size_type(this->m_holder.m_back - this->m_holder.m_front);  }
+
+   //! <b>Effects</b>: Returns the largest possible size of the devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type max_size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return allocator_traits_type::max_size(this->m_holder.alloc());  }
+
+   //! <b>Effects</b>: Inserts or erases elements at the end such that
+   //!   the size becomes n. New elements are value initialized.
+   //!
+   //! <b>Throws</b>: If memory allocation throws, or T's copy/move or value initialization throws.
+   //!
+   //! <b>Complexity</b>: Linear to the difference between size() and new_size.
+   void resize(size_type new_size)
+   {  this->priv_resize(new_size, value_init);  }
+
+   //! <b>Effects</b>: Inserts or erases elements at the end such that
+   //!   the size becomes n. New elements are default initialized.
+   //!
+   //! <b>Throws</b>: If memory allocation throws, or T's copy/move or default initialization throws.
+   //!
+   //! <b>Complexity</b>: Linear to the difference between size() and new_size.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   void resize(size_type new_size, default_init_t)
+   {  this->priv_resize(new_size, default_init);  }
+
+   //! <b>Effects</b>: Inserts or erases elements at the end such that
+   //!   the size becomes n. New elements are copy constructed from x.
+   //!
+   //! <b>Throws</b>: If memory allocation throws, or T's copy/move constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to the difference between size() and new_size.
+   void resize(size_type new_size, const T& x)
+   {  this->priv_resize(new_size, x);  }
+
+   //! <b>Effects</b>: Number of elements for which memory has been allocated,
+   //!   including the free capacity at both ends.
+   //!   capacity() is always greater than or equal to size().
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type capacity() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_holder.m_capacity;  }
+
+   //! <b>Effects</b>: Returns the number of elements that can be inserted
+   //!   at the beginning without moving the elements or allocating memory.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type front_free_capacity() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_holder.m_front;  }
+
+   //! <b>Effects</b>: Returns the number of elements that can be inserted
+   //!   at the end without moving the elements or allocating memory.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type back_free_capacity() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return size_type(this->m_holder.m_capacity - this->m_holder.m_back);  }
+
+   //! <b>Effects</b>: If new_cap is less than or equal to size() + back_free_capacity(),
+   //!   this call has no effect. Otherwise, it is a request for allocation of additional
+   //!   memory so that new_cap - size() elements can be inserted at the end without
+   //!   reallocating. The free capacity at the front is unchanged.
+   //!
+   //! <b>Throws</b>: If memory allocation allocation throws or T's copy/move constructor throws.
+   void reserve(size_type new_cap)
+   {
+      const size_type sz = this->size();
+      if(new_cap > sz){
+         this->reserve_back(new_cap - sz);
+      }
+   }
+
+   //! <b>Effects</b>: If n is less than or equal to front_free_capacity(), this call has no
+   //!   effect. Otherwise, reallocates the elements so that front_free_capacity() == n.
+   //!   back_free_capacity() is unchanged.
+   //!
+   //! <b>Throws</b>: If memory allocation allocation throws or T's copy/move constructor throws.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void reserve_front(size_type n)
+   {
+      if(this->front_free_capacity() < n){
+         const size_type back_free = this->back_free_capacity();
+         this->priv_reallocate(this->priv_checked_add(this->size() + back_free, n), n);
+      }
+   }
+
+   //! <b>Effects</b>: If n is less than or equal to back_free_capacity(), this call has no
+   //!   effect. Otherwise, reallocates the elements so that back_free_capacity() == n.
+   //!   front_free_capacity() is unchanged.
+   //!
+   //! <b>Throws</b>: If memory allocation allocation throws or T's copy/move constructor throws.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void reserve_back(size_type n)
+   {
+      if(this->back_free_capacity() < n){
+         const size_type front_free = this->front_free_capacity();
+         this->priv_reallocate(this->priv_checked_add(front_free + this->size(), n), front_free);
+      }
+   }
+
+   //! <b>Effects</b>: Tries to deallocate the excess of memory created
+   //!   with previous allocations, including the free capacity at both ends.
+   //!   The size of the devector is unchanged
+   //!
+   //! <b>Throws</b>: If memory allocation throws, or T's copy/move constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to size().
+   void shrink_to_fit()
+   {
+      const size_type sz = this->size();
+      if(!sz){
+         if(this->m_holder.m_capacity){
+            this->m_holder.alloc().deallocate(this->m_holder.m_start, this->m_holder.m_capacity);
+            this->m_holder.m_start = pointer();
+            this->m_holder.m_capacity = this->m_holder.m_front = this->m_holder.m_back = 0;
+         }
+      }
+      else if(sz < this->m_holder.m_capacity){
+         this->priv_reallocate(sz, 0u);
+      }
+   }
+
+   //////////////////////////////////////////////
+   //
+   //               element access
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Returns a reference to the first
+   //!   element of the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   reference front() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(!this->empty());
+      return *this->priv_begin_ptr();
+   }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Returns a const reference to the first
+   //!   element of the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reference front() const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(!this->empty());
+      return *this->priv_begin_ptr();
+   }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Returns a reference to the last
+   //!   element of the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   reference back() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(!this->empty());
+      return this->priv_end_ptr()[-1];
+   }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Returns a const reference to the last
+   //!   element of the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reference back()  const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(!this->empty());
+      return this->priv_end_ptr()[-1];
+   }
+
+   //! <b>Requires</b>: size() > n.
+   //!
+   //! <b>Effects</b>: Returns a reference to the nth element
+   //!   from the beginning of the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   reference operator[](size_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(this->size() > n);
+      return this->priv_begin_ptr()[n];
+   }
+
+   //! <b>Requires</b>: size() > n.
+   //!
+   //! <b>Effects</b>: Returns a const reference to the nth element
+   //!   from the beginning of the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reference operator[](size_type n) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(this->size() > n);
+      return this->priv_begin_ptr()[n];
+   }
+
+   //! <b>Requires</b>: size() >= n.
+   //!
+   //! <b>Effects</b>: Returns an iterator to the nth element
+   //!   from the beginning of the container. Returns end()
+   //!   if n == size().
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   iterator nth(size_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(this->size() >= n);
+      return iterator(this->priv_begin_ptr() + n);
+   }
+
+   //! <b>Requires</b>: size() >= n.
+   //!
+   //! <b>Effects</b>: Returns a const_iterator to the nth element
+   //!   from the beginning of the container. Returns end()
+   //!   if n == size().
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   const_iterator nth(size_type n) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(this->size() >= n);
+      return const_iterator(this->priv_begin_ptr() + n);
+   }
+
+   //! <b>Requires</b>: begin() <= p <= end().
+   //!
+   //! <b>Effects</b>: Returns the index of the element pointed by p
+   //!   and size() if p == end().
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   size_type index_of(iterator p) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->priv_index_of(vector_iterator_get_ptr(p));  }
+
+   //! <b>Requires</b>: begin() <= p <= end().
+   //!
+   //! <b>Effects</b>: Returns the index of the element pointed by p
+   //!   and size() if p == end().
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   size_type index_of(const_iterator p) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->priv_index_of(vector_iterator_get_ptr(p));  }
+
+   //! <b>Requires</b>: size() > n.
+   //!
+   //! <b>Effects</b>: Returns a reference to the nth element
+   //!   from the beginning of the container.
+   //!
+   //! <b>Throws</b>: std::range_error if n >= size()
+   //!
+   //! <b>Complexity</b>: Constant.
+   reference at(size_type n)
+   {
+      if(n >= this->size()){
+         throw_out_of_range("devector::at out of range");
+      }
+      return this->priv_begin_ptr()[n];
+   }
+
+   //! <b>Requires</b>: size() > n.
+   //!
+   //! <b>Effects</b>: Returns a const reference to the nth element
+   //!   from the beginning of the container.
+   //!
+   //! <b>Throws</b>: std::range_error if n >= size()
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reference at(size_type n) const
+   {
+      if(n >= this->size()){
+         throw_out_of_range("devector::at out of range");
+      }
+      return this->priv_begin_ptr()[n];
+   }
+
+   //////////////////////////////////////////////
+   //
+   //                 data access
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Returns</b>: A pointer such that [data(),data() + size()) is a valid range.
+   //!   For a non-empty devector, data() == &front().
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   T* data() BOOST_NOEXCEPT_OR_NOTHROW
+   { return this->priv_raw_begin(); }
+
+   //! <b>Returns</b>: A pointer such that [data(),data() + size()) is a valid range.
+   //!   For a non-empty devector, data() == &front().
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const T * data()  const BOOST_NOEXCEPT_OR_NOTHROW
+   { return this->priv_raw_begin(); }
+
+   //////////////////////////////////////////////
+   //
+   //                modifiers
+   //
+   //////////////////////////////////////////////
+
+   #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //! <b>Effects</b>: Inserts an object of type T constructed with
+   //!   std::forward<Args>(args)... in the beginning of the devector.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or the in-place constructor throws or
+   //!   T's copy/move constructor throws.
+   //!
+   //! <b>Complexity</b>: Amortized constant time.
+   template<class ...Args>
+   void emplace_front(BOOST_FWD_REF(Args)...args)
+   {
+      if (BOOST_LIKELY(this->m_holder.m_front != 0u)){
+         //There is free memory before the first element, just construct a new object there
+         allocator_traits_type::construct(this->m_holder.alloc(), this->priv_raw_begin() - 1, ::boost::forward<Args>(args)...);
+         --this->m_holder.m_front;
+      }
+      else{
+         typedef container_detail::insert_emplace_proxy<Allocator, T*, Args...> type;
+         this->priv_insert(0u, 1u, type(::boost::forward<Args>(args)...));
+      }
+   }
+
+   //! <b>Effects</b>: Inserts an object of type T constructed with
+   //!   std::forward<Args>(args)... in the end of the devector.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or the in-place constructor throws or
+   //!   T's copy/move constructor throws.
+   //!
+   //! <b>Complexity</b>: Amortized constant time.
+   template<class ...Args>
+   void emplace_back(BOOST_FWD_REF(Args)...args)
+   {
+      if (BOOST_LIKELY(this->m_holder.m_back != this->m_holder.m_capacity)){
+         //There is free memory after the last element, just construct a new object there
+         allocator_traits_type::construct(this->m_holder.alloc(), this->priv_raw_end(), ::boost::forward<Args>(args)...);
+         ++this->m_holder.m_back;
+      }
+      else{
+         typedef container_detail::insert_emplace_proxy<Allocator, T*, Args...> type;
+         this->priv_insert(this->size(), 1u, type(::boost::forward<Args>(args)...));
+      }
+   }
+
+   //! <b>Requires</b>: position must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Inserts an object of type T constructed with
+   //!   std::forward<Args>(args)... before position
+   //!
+   //! <b>Throws</b>: If memory allocation throws or the in-place constructor throws or
+   //!   T's copy/move constructor/assignment throws.
+   //!
+   //! <b>Complexity</b>: If position is begin() or end(), amortized constant time
+   //!   Linear to the distance to the nearest end otherwise.
+   template<class ...Args>
+   iterator emplace(const_iterator position, BOOST_FWD_REF(Args) ...args)
+   {
+      typedef container_detail::insert_emplace_proxy<Allocator, T*, Args...> type;
+      return this->priv_insert(this->priv_index_of(vector_iterator_get_ptr(position)), 1u
+                              , type(::boost::forward<Args>(args)...));
+   }
+
+   #else // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   #define BOOST_CONTAINER_DEVECTOR_EMPLACE_CODE(N) \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   void emplace_front(BOOST_MOVE_UREF##N)\
+   {\
+      if (BOOST_LIKELY(this->m_holder.m_front != 0u)){\
+         allocator_traits_type::construct (this->m_holder.alloc()\
+            , this->priv_raw_begin() - 1 BOOST_MOVE_I##N BOOST_MOVE_FWD##N);\
+         --this->m_holder.m_front;\
+      }\
+      else{\
+         typedef container_detail::insert_emplace_proxy_arg##N<Allocator, T* BOOST_MOVE_I##N BOOST_MOVE_TARG##N> type;\
+         this->priv_insert(0u, 1u, type(BOOST_MOVE_FWD##N));\
+      }\
+   }\
+   \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   void emplace_back(BOOST_MOVE_UREF##N)\
+   {\
+      if (BOOST_LIKELY(this->m_holder.m_back != this->m_holder.m_capacity)){\
+         allocator_traits_type::construct (this->m_holder.alloc()\
+            , this->priv_raw_end() BOOST_MOVE_I##N BOOST_MOVE_FWD##N);\
+         ++this->m_holder.m_back;\
+      }\
+      else{\
+         typedef container_detail::insert_emplace_proxy_arg##N<Allocator, T* BOOST_MOVE_I##N BOOST_MOVE_TARG##N> type;\
+         this->priv_insert(this->size(), 1u, type(BOOST_MOVE_FWD##N));\
+      }\
+   }\
+   \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   iterator emplace(const_iterator pos BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
+   {\
+      typedef container_detail::insert_emplace_proxy_arg##N<Allocator, T* BOOST_MOVE_I##N BOOST_MOVE_TARG##N> type;\
+      return this->priv_insert(this->priv_index_of(vector_iterator_get_ptr(pos)), 1u, type(BOOST_MOVE_FWD##N));\
+   }\
+   //
+   BOOST_MOVE_ITERATE_0TO9(BOOST_CONTAINER_DEVECTOR_EMPLACE_CODE)
+   #undef BOOST_CONTAINER_DEVECTOR_EMPLACE_CODE
+
+   #endif
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //! <b>Effects</b>: Inserts a copy of x at the beginning of the devector.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or
+   //!   T's copy/move constructor throws.
+   //!
+   //! <b>Complexity</b>: Amortized constant time.
+   void push_front(const T &x);
+
+   //! <b>Effects</b>: Constructs a new element at the beginning of the devector
+   //!   and moves the resources of x to this new element.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or
+   //!   T's copy/move constructor throws.
+   //!
+   //! <b>Complexity</b>: Amortized constant time.
+   void push_front(T &&x);
+   #else
+   BOOST_MOVE_CONVERSION_AWARE_CATCH(push_front, T, void, priv_push_front)
+   #endif
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //! <b>Effects</b>: Inserts a copy of x at the end of the devector.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or
+   //!   T's copy/move constructor throws.
+   //!
+   //! <b>Complexity</b>: Amortized constant time.
+   void push_back(const T &x);
+
+   //! <b>Effects</b>: Constructs a new element in the end of the devector
+   //!   and moves the resources of x to this new element.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or
+   //!   T's copy/move constructor throws.
+   //!
+   //! <b>Complexity</b>: Amortized constant time.
+   void push_back(T &&x);
+   #else
+   BOOST_MOVE_CONVERSION_AWARE_CATCH(push_back, T, void, priv_push_back)
+   #endif
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //! <b>Requires</b>: position must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Insert a copy of x before position.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or T's copy/move constructor/assignment throws.
+   //!
+   //! <b>Complexity</b>: If position is begin() or end(), amortized constant time
+   //!   Linear to the distance to the nearest end otherwise.
+   iterator insert(const_iterator position, const T &x);
+
+   //! <b>Requires</b>: position must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Insert a new element before position with x's resources.
+   //!
+   //! <b>Throws</b>: If memory allocation throws.
+   //!
+   //! <b>Complexity</b>: If position is begin() or end(), amortized constant time
+   //!   Linear to the distance to the nearest end otherwise.
+   iterator insert(const_iterator position, T &&x);
+   #else
+   BOOST_MOVE_CONVERSION_AWARE_CATCH_1ARG(insert, T, iterator, priv_insert, const_iterator, const_iterator)
+   #endif
+
+   //! <b>Requires</b>: p must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Insert n copies of x before pos.
+   //!
+   //! <b>Returns</b>: an iterator to the first inserted element or p if n is 0.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or T's copy/move constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to n plus the distance to the nearest end.
+   iterator insert(const_iterator p, size_type n, const T& x)
+   {
+      const size_type pos = this->priv_index_of(vector_iterator_get_ptr(p));
+      const T *const px = container_detail::addressof(x);
+      if(n > 1u && this->priv_raw_begin() <= px && px < this->priv_raw_end()){
+         //x is one of the elements that might be moved to open the gap, copy it aside first
+         typedef typename container_detail::aligned_storage
+            <sizeof(T), container_detail::alignment_of<T>::value>::type storage_t;
+         storage_t storage;
+         T * const tmp = static_cast<T*>(static_cast<void*>(&storage));
+         allocator_traits_type::construct(this->m_holder.alloc(), tmp, x);
+         container_detail::value_destructor<Allocator> tmp_destroyer(this->m_holder.alloc(), *tmp);
+         return this->priv_insert(pos, n, container_detail::insert_n_copies_proxy<Allocator, T*>(*tmp));
+      }
+      return this->priv_insert(pos, n, container_detail::insert_n_copies_proxy<Allocator, T*>(x));
+   }
+
+   //! <b>Requires</b>: p must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Insert a copy of the [first, last) range before pos.
+   //!
+   //! <b>Returns</b>: an iterator to the first inserted element or pos if first == last.
+   //!
+   //! <b>Throws</b>: If memory allocation throws, T's constructor from a
+   //!   dereferenced InpIt throws or T's copy/move constructor/assignment throws.
+   //!
+   //! <b>Complexity</b>: Linear to boost::container::iterator_distance [first, last)
+   //!   plus the distance to the nearest end.
+   template <class InIt>
+   iterator insert(const_iterator pos, InIt first, InIt last
+      #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+      , typename container_detail::disable_if_or
+         < void
+         , container_detail::is_convertible<InIt, size_type>
+         , container_detail::is_not_input_iterator<InIt>
+         >::type * = 0
+      #endif
+      )
+   {
+      const size_type n_pos = this->priv_index_of(vector_iterator_get_ptr(pos));
+      size_type i = n_pos;
+      for(;first != last; ++first){
+         this->emplace(this->nth(i), *first);
+         ++i;
+      }
+      return this->nth(n_pos);
+   }
+
+   #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   template <class FwdIt>
+   iterator insert(const_iterator pos, FwdIt first, FwdIt last
+      , typename container_detail::disable_if_or
+         < void
+         , container_detail::is_convertible<FwdIt, size_type>
+         , container_detail::is_input_iterator<FwdIt>
+         >::type * = 0
+      )
+   {
+      container_detail::insert_range_proxy<Allocator, FwdIt, T*> proxy(first);
+      return this->priv_insert( this->priv_index_of(vector_iterator_get_ptr(pos))
+                              , static_cast<size_type>(boost::container::iterator_distance(first, last)), proxy);
+   }
+   #endif
+
+   #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Requires</b>: position must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Insert a copy of the [il.begin(), il.end()) range before position.
+   //!
+   //! <b>Returns</b>: an iterator to the first inserted element or position if first == last.
+   //!
+   //! <b>Complexity</b>: Linear to the range [il.begin(), il.end()) plus the distance to the nearest end.
+   iterator insert(const_iterator position, std::initializer_list<value_type> il)
+   {
+      return this->insert(position, il.begin(), il.end());
+   }
+   #endif
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Removes the first element from the devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant time.
+   void pop_front() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(!this->empty());
+      allocator_traits_type::destroy(this->m_holder.alloc(), this->priv_raw_begin());
+      ++this->m_holder.m_front;
+   }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Removes the last element from the devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant time.
+   void pop_back() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(!this->empty());
+      --this->m_holder.m_back;
+      allocator_traits_type::destroy(this->m_holder.alloc(), this->priv_raw_end());
+   }
+
+   //! <b>Effects</b>: Erases the element at position pos.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to the distance to the nearest end.
+   iterator erase(const_iterator position)
+   {
+      T *const pos_ptr = container_detail::to_raw_pointer(vector_iterator_get_ptr(position));
+      BOOST_ASSERT(this->priv_raw_begin() <= pos_ptr && pos_ptr < this->priv_raw_end());
+      return this->priv_erase(pos_ptr, 1u);
+   }
+
+   //! <b>Effects</b>: Erases the elements pointed by [first, last).
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to the distance between first and last
+   //!   plus the distance to the nearest end.
+   iterator erase(const_iterator first, const_iterator last)
+   {
+      T *const first_ptr = container_detail::to_raw_pointer(vector_iterator_get_ptr(first));
+      T *const last_ptr  = container_detail::to_raw_pointer(vector_iterator_get_ptr(last));
+      BOOST_ASSERT(first_ptr <= last_ptr);
+      return this->priv_erase(first_ptr, static_cast<size_type>(last_ptr - first_ptr));
+   }
+
+   //! <b>Effects</b>: Swaps the contents of *this and x.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   void swap(devector& x)
+      BOOST_NOEXCEPT_IF(allocator_traits_type::propagate_on_container_swap::value
+                                || allocator_traits_type::is_always_equal::value)
+   {
+      const bool propagate_alloc = allocator_traits_type::propagate_on_container_swap::value;
+      BOOST_ASSERT(propagate_alloc || allocator_traits_type::equal(this->m_holder.alloc(), x.m_holder.alloc()));
+      this->m_holder.swap_resources(x.m_holder);
+      container_detail::swap_alloc(this->m_holder.alloc(), x.m_holder.alloc(), container_detail::bool_<propagate_alloc>());
+   }
+
+   //! <b>Effects</b>: Erases all the elements of the devector. The memory
+   //!   is kept and all the capacity becomes free capacity at the end.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   void clear() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      boost::container::destroy_alloc_n(this->m_holder.alloc(), this->priv_raw_begin(), this->size());
+      this->m_holder.m_front = this->m_holder.m_back = 0u;
+   }
+
+   //! <b>Effects</b>: Returns true if x and y are equal
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend bool operator==(const devector& x, const devector& y)
+   {  return x.size() == y.size() && ::boost::container::algo_equal(x.begin(), x.end(), y.begin());  }
+
+   //! <b>Effects</b>: Returns true if x and y are unequal
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend bool operator!=(const devector& x, const devector& y)
+   {  return !(x == y); }
+
+   //! <b>Effects</b>: Returns the hash value of x. Equal containers have equal hash values.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend std::size_t hash_value(const devector& x)
+   {  return container_detail::hash_contiguous_range(x.data(), x.size());  }
+
+   //! <b>Effects</b>: Returns true if x is less than y
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend bool operator<(const devector& x, const devector& y)
+   {
+      const_iterator first1(x.cbegin()), first2(y.cbegin());
+      const const_iterator last1(x.cend()), last2(y.cend());
+      for ( ; (first1 != last1) && (first2 != last2); ++first1, ++first2 ) {
+         if (*first1 < *first2) return true;
+         if (*first2 < *first1) return false;
+      }
+      return (first1 == last1) && (first2 != last2);
+   }
+
+   //! <b>Effects</b>: Returns true if x is greater than y
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend bool operator>(const devector& x, const devector& y)
+   {  return y < x;  }
+
+   //! <b>Effects</b>: Returns true if x is equal or less than y
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend bool operator<=(const devector& x, const devector& y)
+   {  return !(y < x);  }
+
+   //! <b>Effects</b>: Returns true if x is equal or greater than y
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend bool operator>=(const devector& x, const devector& y)
+   {  return !(x < y);  }
+
+   //! <b>Effects</b>: x.swap(y)
+   //!
+   //! <b>Complexity</b>: Constant.
+   friend void swap(devector& x, devector& y)
+   {  x.swap(y);  }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+
+   T* priv_raw_start() const
+   {  return container_detail::to_raw_pointer(this->m_holder.m_start);  }
+
+   T* priv_raw_begin() const
+   {  return this->priv_raw_start() + this->m_holder.m_front;  }
+
+   T* priv_raw_end() const
+   {  return this->priv_raw_start() + this->m_holder.m_back;  }
+
+   pointer priv_begin_ptr() const
+   {  return this->m_holder.m_start + this->m_holder.m_front;  }
+
+   pointer priv_end_ptr() const
+   {  return this->m_holder.m_start + this->m_holder.m_back;  }
+
+   size_type priv_index_of(pointer p) const
+   {
+      BOOST_ASSERT(this->priv_begin_ptr() <= p);
+      BOOST_ASSERT(p <= this->priv_end_ptr());
+      return static_cast<size_type>(p - this->priv_begin_ptr());
+   }
+
+   size_type priv_checked_add(size_type a, size_type b) const
+   {
+      if(this->max_size() - a < b){
+         boost::container::throw_length_error("devector: max_size() exceeded");
+      }
+      return size_type(a + b);
+   }
+
+   void priv_destroy_last_n(const size_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(n <= this->size());
+      this->m_holder.m_back -= n;
+      boost::container::destroy_alloc_n(this->m_holder.alloc(), this->priv_raw_end(), n);
+   }
+
+   void priv_copy_assign(const devector &x)
+   {
+      allocator_type &this_alloc     = this->m_holder.alloc();
+      const allocator_type &x_alloc  = x.m_holder.alloc();
+      container_detail::bool_<allocator_traits_type::
+         propagate_on_container_copy_assignment::value> flag;
+      if(flag && this_alloc != x_alloc){
+         this->clear();
+         this->shrink_to_fit();
+      }
+      container_detail::assign_alloc(this_alloc, x_alloc, flag);
+      this->assign(x.priv_raw_begin(), x.priv_raw_end());
+   }
+
+   void priv_move_assign(devector &x)
+   {
+      allocator_type &this_alloc = this->m_holder.alloc();
+      allocator_type &x_alloc    = x.m_holder.alloc();
+      const bool propagate_alloc = allocator_traits_type::propagate_on_container_move_assignment::value;
+      //Resources can be transferred if both allocators are
+      //going to be equal after this function (either propagated or already equal)
+      if(propagate_alloc || allocator_traits_type::equal(this_alloc, x_alloc)){
+         this->clear();
+         this->shrink_to_fit();
+         this->m_holder.steal_resources(x.m_holder);
+      }
+      //Else do a one by one move
+      else{
+         this->assign( boost::make_move_iterator(x.priv_raw_begin())
+                     , boost::make_move_iterator(x.priv_raw_end()));
+      }
+      //Move allocator if needed
+      container_detail::move_alloc(this_alloc, x_alloc, container_detail::bool_<propagate_alloc>());
+   }
+
+   template<class U>
+   iterator priv_insert(const const_iterator &p, BOOST_FWD_REF(U) x)
+   {
+      return this->priv_insert
+         ( this->priv_index_of(vector_iterator_get_ptr(p)), 1u
+         , container_detail::get_insert_value_proxy<T*, Allocator>(::boost::forward<U>(x)));
+   }
+
+   template <class U>
+   void priv_push_front(BOOST_FWD_REF(U) u)
+   {
+      if (BOOST_LIKELY(this->m_holder.m_front != 0u)){
+         allocator_traits_type::construct(this->m_holder.alloc(), this->priv_raw_begin() - 1, ::boost::forward<U>(u));
+         --this->m_holder.m_front;
+      }
+      else{
+         this->priv_insert(0u, 1u, container_detail::get_insert_value_proxy<T*, Allocator>(::boost::forward<U>(u)));
+      }
+   }
+
+   template <class U>
+   void priv_push_back(BOOST_FWD_REF(U) u)
+   {
+      if (BOOST_LIKELY(this->m_holder.m_back != this->m_holder.m_capacity)){
+         allocator_traits_type::construct(this->m_holder.alloc(), this->priv_raw_end(), ::boost::forward<U>(u));
+         ++this->m_holder.m_back;
+      }
+      else{
+         this->priv_insert(this->size(), 1u, container_detail::get_insert_value_proxy<T*, Allocator>(::boost::forward<U>(u)));
+      }
+   }
+
+   container_detail::insert_n_copies_proxy<Allocator, T*> priv_resize_proxy(const T &x)
+   {  return container_detail::insert_n_copies_proxy<Allocator, T*>(x);   }
+
+   container_detail::insert_default_initialized_n_proxy<Allocator, T*> priv_resize_proxy(default_init_t)
+   {  return container_detail::insert_default_initialized_n_proxy<Allocator, T*>();  }
+
+   container_detail::insert_value_initialized_n_proxy<Allocator, T*> priv_resize_proxy(value_init_t)
+   {  return container_detail::insert_value_initialized_n_proxy<Allocator, T*>(); }
+
+   template <class U>
+   void priv_resize(size_type new_size, const U& u)
+   {
+      const size_type sz = this->size();
+      if (new_size < sz){
+         //Destroy last elements
+         this->priv_destroy_last_n(sz - new_size);
+      }
+      else{
+         this->priv_insert(sz, new_size - sz, this->priv_resize_proxy(u));
+      }
+   }
+
+   container_detail::insert_range_proxy<Allocator, boost::move_iterator<T*>, T*> priv_dummy_empty_proxy()
+   {
+      return container_detail::insert_range_proxy<Allocator, boost::move_iterator<T*>, T*>
+         (::boost::make_move_iterator((T *)0));
+   }
+
+   //Moves the elements to a new buffer of new_cap elements, leaving new_front free elements before them
+   void priv_reallocate(size_type new_cap, size_type new_front)
+   {
+      BOOST_ASSERT(new_cap >= new_front + this->size());
+      pointer const p = this->m_holder.allocate(new_cap);
+      this->priv_insert_new_allocation(p, new_cap, new_front, this->size(), 0u, this->priv_dummy_empty_proxy());
+   }
+
+   iterator priv_erase(T *const first, const size_type n)
+   {
+      T *const old_begin = this->priv_raw_begin();
+      T *const old_end   = this->priv_raw_end();
+      T *const last      = first + n;
+      const size_type elems_before = static_cast<size_type>(first - old_begin);
+      if(n){
+         //Fill the hole with the elements of the shortest side
+         if(elems_before < static_cast<size_type>(old_end - last)){
+            if(value_traits::trivial_relocate){
+               boost::container::destroy_alloc_n(this->m_holder.alloc(), first, n);
+               if(elems_before){
+                  ::boost::container::uninitialized_relocate_n(old_begin, elems_before, old_begin + n);
+               }
+            }
+            else{
+               boost::container::move_backward(old_begin, first, last);
+               boost::container::destroy_alloc_n(this->m_holder.alloc(), old_begin, n);
+            }
+            this->m_holder.m_front += n;
+         }
+         else{
+            if(value_traits::trivial_relocate){
+               boost::container::destroy_alloc_n(this->m_holder.alloc(), first, n);
+               if(last != old_end){
+                  ::boost::container::uninitialized_relocate_n(last, static_cast<size_type>(old_end - last), first);
+               }
+            }
+            else{
+               boost::container::move(last, old_end, first);
+               boost::container::destroy_alloc_n(this->m_holder.alloc(), old_end - n, n);
+            }
+            this->m_holder.m_back -= n;
+         }
+      }
+      return iterator(this->priv_begin_ptr() + elems_before);
+   }
+
+   //Moves the elements inside the buffer so that there are new_front free elements before them
+   void priv_recenter(const size_type new_front)
+   {
+      BOOST_ASSERT(new_front + this->size() <= this->m_holder.m_capacity);
+      const size_type sz = this->size();
+      T *const old_begin = this->priv_raw_begin();
+      T *const new_begin = this->priv_raw_start() + new_front;
+      if(value_traits::trivial_relocate){
+         if(sz){
+            ::boost::container::uninitialized_relocate_n(old_begin, sz, new_begin);
+         }
+      }
+      else if(new_begin < old_begin){
+         //The first elements are moved to uninitialized memory, the rest overwrite old ones
+         const size_type n_uninit = container_detail::min_value(size_type(old_begin - new_begin), sz);
+         ::boost::container::uninitialized_move_alloc_n(this->m_holder.alloc(), old_begin, n_uninit, new_begin);
+         typename value_traits::ArrayDestructor new_values_destroyer(new_begin, this->m_holder.alloc(), n_uninit);
+         boost::container::move(old_begin + n_uninit, old_begin + sz, new_begin + n_uninit);
+         new_values_destroyer.release();
+         boost::container::destroy_alloc_n(this->m_holder.alloc(), old_begin + (sz - n_uninit), n_uninit);
+      }
+      else if(old_begin < new_begin){
+         //The last elements are moved to uninitialized memory, the rest overwrite old ones
+         const size_type n_uninit = container_detail::min_value(size_type(new_begin - old_begin), sz);
+         ::boost::container::uninitialized_move_alloc_n
+            (this->m_holder.alloc(), old_begin + (sz - n_uninit), n_uninit, new_begin + (sz - n_uninit));
+         typename value_traits::ArrayDestructor new_values_destroyer(new_begin + (sz - n_uninit), this->m_holder.alloc(), n_uninit);
+         boost::container::move_backward(old_begin, old_begin + (sz - n_uninit), new_begin + (sz - n_uninit));
+         new_values_destroyer.release();
+         boost::container::destroy_alloc_n(this->m_holder.alloc(), old_begin, n_uninit);
+      }
+      this->m_holder.m_front = new_front;
+      this->m_holder.m_back  = new_front + sz;
+   }
+
+   //Prepares the buffer to open a gap of n elements at position pos, moving the elements
+   //to the center of the buffer if the nearest end has not enough free capacity.
+   //Returns true if the elements after pos must be shifted to the end,
+   //false if the elements before pos must be shifted to the beginning.
+   bool priv_prepare_gap(const size_type pos, const size_type n)
+   {
+      const size_type sz = this->size();
+      BOOST_ASSERT(this->m_holder.m_capacity - sz >= n);
+      const size_type free_cap = size_type(this->m_holder.m_capacity - sz - n);
+      const size_type front_free = this->front_free_capacity();
+      const size_type back_free  = this->back_free_capacity();
+      if(pos == sz){
+         //Leave part of the remaining free capacity at the beginning
+         if(back_free < n){
+            this->priv_recenter(free_cap/2u);
+         }
+         return true;
+      }
+      else if(pos == 0u){
+         //Leave part of the remaining free capacity at the end
+         if(front_free < n){
+            this->priv_recenter(size_type(n + free_cap - free_cap/2u));
+         }
+         return false;
+      }
+      else if(back_free >= n && (front_free < n || (sz - pos) <= pos)){
+         return true;
+      }
+      else if(front_free >= n){
+         return false;
+      }
+      else{
+         this->priv_recenter(free_cap/2u);
+         return true;
+      }
+   }
+
+   //Opens a gap of n uninitialized elements at position pos and returns its position.
+   //The gap is included in [begin(), end()). Only for trivially relocatable types.
+   T *priv_relocate_gap(const size_type pos, const size_type n)
+   {
+      if(this->priv_prepare_gap(pos, n)){
+         T *const gap = this->priv_raw_begin() + pos;
+         if(pos != this->size()){
+            ::boost::container::uninitialized_relocate_n(gap, size_type(this->size() - pos), gap + n);
+         }
+         this->m_holder.m_back += n;
+         return gap;
+      }
+      else{
+         T *const old_begin = this->priv_raw_begin();
+         if(pos){
+            ::boost::container::uninitialized_relocate_n(old_begin, pos, old_begin - n);
+         }
+         this->m_holder.m_front -= n;
+         return old_begin - n + pos;
+      }
+   }
+
+   template <class InsertionProxy>
+   iterator priv_insert(const size_type pos, const size_type n, InsertionProxy insert_range_proxy)
+   {
+      BOOST_ASSERT(pos <= this->size());
+      const size_type sz = this->size();
+      const size_type cap = this->m_holder.m_capacity;
+      const size_type front_free = this->front_free_capacity();
+      const size_type back_free  = this->back_free_capacity();
+      //Elements are inserted in place if the nearest end has room. The elements are
+      //moved to the center if at least half of the buffer would remain free,
+      //so that the cost of the move is amortized.
+      const bool room_at_end = pos == sz ? back_free >= n
+                             : pos == 0u ? front_free >= n
+                             : (back_free >= n || front_free >= n);
+      if(room_at_end || (cap - sz >= n && (sz + n) <= cap/2u)){
+         this->priv_insert_with_room(pos, n, insert_range_proxy);
+      }
+      else{
+         this->priv_insert_no_capacity(pos, n, insert_range_proxy, alloc_version());
+      }
+      return iterator(this->priv_begin_ptr() + pos);
+   }
+
+   template <class InsertionProxy>
+   void priv_insert_with_room(const size_type pos, const size_type n, InsertionProxy insert_range_proxy)
+   {
+      BOOST_ASSERT(this->m_holder.m_capacity - this->size() >= n);
+      if(pos == this->size() && this->back_free_capacity() >= n){
+         insert_range_proxy.uninitialized_copy_n_and_update(this->m_holder.alloc(), this->priv_raw_end(), n);
+         this->m_holder.m_back += n;
+      }
+      else if(pos == 0u && this->front_free_capacity() >= n){
+         insert_range_proxy.uninitialized_copy_n_and_update(this->m_holder.alloc(), this->priv_raw_begin() - n, n);
+         this->m_holder.m_front -= n;
+      }
+      else if(n == 1u && (!value_traits::trivial_relocate ||
+              container_detail::insert_proxy_may_alias(insert_range_proxy, this->priv_raw_begin(), this->priv_raw_end()))){
+         //The new element is built aside before moving any element, as its source
+         //could be one of them
+         typedef typename container_detail::aligned_storage
+            <sizeof(T), container_detail::alignment_of<T>::value>::type storage_t;
+         storage_t storage;
+         T * const tmp = static_cast<T*>(static_cast<void*>(&storage));
+         insert_range_proxy.uninitialized_copy_n_and_update(this->m_holder.alloc(), tmp, 1u);
+         this->priv_insert_aside(pos, *tmp, container_detail::bool_<value_traits::trivial_relocate>());
+      }
+      else{
+         this->priv_insert_gap(pos, n, insert_range_proxy, container_detail::bool_<value_traits::trivial_relocate>());
+      }
+   }
+
+   void priv_insert_aside(const size_type pos, T &tmp, container_detail::true_type /*trivial_relocate*/)
+   {
+      //Nothrow: relocate tmp to the gap
+      ::boost::container::uninitialized_relocate_n(container_detail::addressof(tmp), 1u, this->priv_relocate_gap(pos, 1u));
+   }
+
+   void priv_insert_aside(const size_type pos, T &tmp, container_detail::false_type /*trivial_relocate*/)
+   {
+      container_detail::value_destructor<Allocator> tmp_destroyer(this->m_holder.alloc(), tmp);
+      this->priv_insert_gap(pos, 1u, container_detail::insert_move_proxy<Allocator, T*>(tmp), container_detail::false_type());
+   }
+
+   template <class InsertionProxy>
+   void priv_insert_gap(const size_type pos, const size_type n, InsertionProxy insert_range_proxy, container_detail::true_type /*trivial_relocate*/)
+   {
+      T *const gap = this->priv_relocate_gap(pos, n);
+      BOOST_TRY{
+         insert_range_proxy.uninitialized_copy_n_and_update(this->m_holder.alloc(), gap, n);
+      }
+      BOOST_CATCH(...){
+         //Close the gap
+         if(gap + n != this->priv_raw_end()){
+            ::boost::container::uninitialized_relocate_n(gap + n, static_cast<size_type>(this->priv_raw_end() - (gap + n)), gap);
+         }
+         this->m_holder.m_back -= n;
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+   }
+
+   template <class InsertionProxy>
+   void priv_insert_gap(const size_type pos, const size_type n, InsertionProxy insert_range_proxy, container_detail::false_type /*trivial_relocate*/)
+   {
+      if(this->priv_prepare_gap(pos, n)){
+         this->priv_insert_shift_back(pos, n, insert_range_proxy);
+      }
+      else{
+         this->priv_insert_shift_front(pos, n, insert_range_proxy);
+      }
+   }
+
+   //Opens the gap moving [pos, end()) n positions towards the end
+   template <class InsertionProxy>
+   void priv_insert_shift_back(const size_type pos, const size_type n, InsertionProxy insert_range_proxy)
+   {
+      BOOST_ASSERT(this->back_free_capacity() >= n);
+      T* const old_finish = this->priv_raw_end();
+      T* const pos_ptr = this->priv_raw_begin() + pos;
+      const size_type elems_after = static_cast<size_type>(old_finish - pos_ptr);
+
+      if (!elems_after){
+         insert_range_proxy.uninitialized_copy_n_and_update(this->m_holder.alloc(), old_finish, n);
+         this->m_holder.m_back += n;
+      }
+      else if (elems_after >= n){
+         //New elements can be just copied.
+         //Move to uninitialized memory last objects
+         ::boost::container::uninitialized_move_alloc
+            (this->m_holder.alloc(), old_finish - n, old_finish, old_finish);
+         this->m_holder.m_back += n;
+         //Copy previous to last objects to the initialized end
+         boost::container::move_backward(pos_ptr, old_finish - n, old_finish);
+         //Insert new objects in the pos
+         insert_range_proxy.copy_n_and_update(this->m_holder.alloc(), pos_ptr, n);
+      }
+      else {
+         //The new elements don't fit in the [pos, end()) range.
+
+         //Copy old [pos, end()) elements to the uninitialized memory (a gap is created)
+         ::boost::container::uninitialized_move_alloc(this->m_holder.alloc(), pos_ptr, old_finish, pos_ptr + n);
+         BOOST_TRY{
+            //Copy first new elements in pos (gap is still there)
+            insert_range_proxy.copy_n_and_update(this->m_holder.alloc(), pos_ptr, elems_after);
+            //Copy to the beginning of the unallocated zone the last new elements (the gap is closed).
+            insert_range_proxy.uninitialized_copy_n_and_update(this->m_holder.alloc(), old_finish, n - elems_after);
+            this->m_holder.m_back += n;
+         }
+         BOOST_CATCH(...){
+            boost::container::destroy_alloc_n(this->m_holder.alloc(), pos_ptr + n, elems_after);
+            BOOST_RETHROW
+         }
+         BOOST_CATCH_END
+      }
+   }
+
+   //Opens the gap moving [begin(), pos) n positions towards the beginning
+   template <class InsertionProxy>
+   void priv_insert_shift_front(const size_type pos, const size_type n, InsertionProxy insert_range_proxy)
+   {
+      BOOST_ASSERT(this->front_free_capacity() >= n);
+      T* const old_begin = this->priv_raw_begin();
+      T* const pos_ptr = old_begin + pos;
+      const size_type elems_before = pos;
+
+      if (!elems_before){
+         insert_range_proxy.uninitialized_copy_n_and_update(this->m_holder.alloc(), old_begin - n, n);
+         this->m_holder.m_front -= n;
+      }
+      else if (elems_before >= n){
+         //Move to uninitialized memory first objects
+         ::boost::container::uninitialized_move_alloc_n(this->m_holder.alloc(), old_begin, n, old_begin - n);
+         this->m_holder.m_front -= n;
+         //Move the rest of [begin(), pos) to the initialized beginning
+         boost::container::move(old_begin + n, pos_ptr, old_begin);
+         //Insert new objects before pos
+         insert_range_proxy.copy_n_and_update(this->m_holder.alloc(), pos_ptr - n, n);
+      }
+      else {
+         //The new elements don't fit in the [begin(), pos) range.
+
+         //Move old [begin(), pos) elements to the uninitialized memory (a gap is created)
+         ::boost::container::uninitialized_move_alloc_n(this->m_holder.alloc(), old_begin, elems_before, old_begin - n);
+         size_type constructed = 0u;
+         BOOST_TRY{
+            //Construct first new elements in the unallocated zone
+            insert_range_proxy.uninitialized_copy_n_and_update(this->m_holder.alloc(), pos_ptr - n, n - elems_before);
+            constructed = n - elems_before;
+            //Copy the last new elements to the moved elements (the gap is closed)
+            insert_range_proxy.copy_n_and_update(this->m_holder.alloc(), old_begin, elems_before);
+            this->m_holder.m_front -= n;
+         }
+         BOOST_CATCH(...){
+            boost::container::destroy_alloc_n(this->m_holder.alloc(), old_begin - n, elems_before);
+            boost::container::destroy_alloc_n(this->m_holder.alloc(), pos_ptr - n, constructed);
+            BOOST_RETHROW
+         }
+         BOOST_CATCH_END
+      }
+   }
+
+   //Free elements to leave before the elements in a new buffer of new_cap
+   //elements where n elements will be inserted at position pos
+   size_type priv_new_front(const size_type new_cap, const size_type pos, const size_type n) const
+   {
+      const size_type sz = this->size();
+      const size_type free_cap = size_type(new_cap - sz - n);
+      if(pos == sz){
+         //Growing at the end: keep at most half of the free capacity at the beginning
+         return container_detail::min_value(this->front_free_capacity(), size_type(free_cap/2u));
+      }
+      else if(pos == 0u){
+         //Growing at the beginning: keep at most half of the free capacity at the end
+         return size_type(free_cap - container_detail::min_value(this->back_free_capacity(), size_type(free_cap/2u)));
+      }
+      else{
+         return size_type(free_cap/2u);
+      }
+   }
+
+   template <class InsertionProxy>
+   void priv_insert_no_capacity(const size_type pos, const size_type n, InsertionProxy insert_range_proxy, version_1)
+   {
+      const size_type new_cap = this->m_holder.template next_capacity<growth_factor_type>(this->size() + n);
+      pointer const p = this->m_holder.allocate(new_cap);
+      this->priv_insert_new_allocation(p, new_cap, this->priv_new_front(new_cap, pos, n), pos, n, insert_range_proxy);
+   }
+
+   template <class InsertionProxy>
+   void priv_insert_no_capacity(const size_type pos, const size_type n, InsertionProxy insert_range_proxy, version_2)
+   {
+      const size_type sz = this->size();
+      //Growing at the beginning tries to expand the buffer backwards, else forward
+      const bool grow_front = pos == 0u && sz;
+      const size_type min_cap = grow_front
+         ? this->priv_checked_add(this->m_holder.m_capacity, size_type(n - this->m_holder.m_front))
+         : this->priv_checked_add(this->m_holder.m_back, n);
+      size_type real_cap = this->m_holder.template next_capacity<growth_factor_type>(min_cap);
+      pointer const old_start(this->m_holder.m_start);
+      pointer reuse(old_start);
+      pointer const ret (this->m_holder.allocation_command
+         (allocate_new | (grow_front ? expand_bwd : expand_fwd), min_cap, real_cap, reuse));
+
+      //Only an expansion keeps the elements in place: a forward one starts at old_start
+      //and a backward one before it, still covering the old buffer. Anything else is a new
+      //buffer, even if the allocator left reuse untouched.
+      const bool expanded = reuse &&
+         ( ret == old_start
+         || (grow_front && ret < old_start && old_start + difference_type(this->m_holder.m_capacity) <= ret + difference_type(real_cap)));
+      if(expanded){
+         //The buffer was expanded in place, the elements were not moved
+         const size_type bwd_offset = static_cast<size_type>(this->m_holder.m_start - ret);
+         this->m_holder.m_start = ret;
+         this->m_holder.m_capacity = real_cap;
+         this->m_holder.m_front += bwd_offset;
+         this->m_holder.m_back  += bwd_offset;
+         this->priv_insert_with_room(pos, n, insert_range_proxy);
+      }
+      else{
+         this->priv_insert_new_allocation(ret, real_cap, this->priv_new_front(real_cap, pos, n), pos, n, insert_range_proxy);
+      }
+   }
+
+   template <class InsertionProxy>
+   void priv_insert_new_allocation
+      ( pointer const new_start, const size_type new_cap, const size_type new_front
+      , const size_type pos, const size_type n, InsertionProxy insert_range_proxy)
+   {
+      this->priv_insert_new_allocation
+         ( new_start, new_cap, new_front, pos, n, insert_range_proxy
+         , container_detail::bool_<value_traits::trivial_relocate>());
+   }
+
+   template <class InsertionProxy>
+   void priv_insert_new_allocation
+      ( pointer const new_start, const size_type new_cap, const size_type new_front
+      , const size_type pos, const size_type n, InsertionProxy insert_range_proxy, container_detail::true_type /*trivial_relocate*/)
+   {
+      //n can be zero, if we want to reallocate!
+      typename value_traits::ArrayDeallocator new_buffer_deallocator(new_start, this->m_holder.alloc(), new_cap);
+      T *const new_begin = container_detail::to_raw_pointer(new_start) + new_front;
+      T *const old_begin = this->priv_raw_begin();
+      const size_type old_size = this->size();
+      //New elements are constructed first, as they might be built from old ones.
+      //If this throws, the old buffer is untouched.
+      insert_range_proxy.uninitialized_copy_n_and_update(this->m_holder.alloc(), new_begin + pos, n);
+      //Nothrow: relocate old elements around the new ones and deallocate the old buffer
+      if(this->m_holder.m_capacity){
+         if(pos){
+            ::boost::container::uninitialized_relocate_n(old_begin, pos, new_begin);
+         }
+         if(old_size != pos){
+            ::boost::container::uninitialized_relocate_n(old_begin + pos, old_size - pos, new_begin + pos + n);
+         }
+         this->m_holder.alloc().deallocate(this->m_holder.m_start, this->m_holder.m_capacity);
+      }
+      this->m_holder.m_start = new_start;
+      this->m_holder.m_capacity = new_cap;
+      this->m_holder.m_front = new_front;
+      this->m_holder.m_back  = new_front + old_size + n;
+      new_buffer_deallocator.release();
+   }
+
+   template <class InsertionProxy>
+   void priv_insert_new_allocation
+      ( pointer const new_start, const size_type new_cap, const size_type new_front
+      , const size_type pos, const size_type n, InsertionProxy insert_range_proxy, container_detail::false_type /*trivial_relocate*/)
+   {
+      //n can be zero, if we want to reallocate!
+      T *const new_begin = container_detail::to_raw_pointer(new_start) + new_front;
+      T *const old_begin = this->priv_raw_begin();
+      const size_type old_size = this->size();
+      //Anti-exception rollbacks
+      typename value_traits::ArrayDeallocator new_buffer_deallocator(new_start, this->m_holder.alloc(), new_cap);
+      typename value_traits::ArrayDestructor  new_values_destroyer(new_begin + pos, this->m_holder.alloc(), 0u);
+
+      //New elements are constructed first, as they might be built from old ones
+      insert_range_proxy.uninitialized_copy_n_and_update(this->m_holder.alloc(), new_begin + pos, n);
+      new_values_destroyer.increment_size(n);
+      if(this->m_holder.m_capacity){
+         //Move [begin(), pos) before the new elements
+         ::boost::container::uninitialized_move_alloc_n(this->m_holder.alloc(), old_begin, pos, new_begin);
+         new_values_destroyer.increment_size_backwards(pos);
+         //Move [pos, end()) after the new elements
+         ::boost::container::uninitialized_move_alloc_n
+            (this->m_holder.alloc(), old_begin + pos, old_size - pos, new_begin + pos + n);
+         //Destroy and deallocate old elements
+         if(!value_traits::trivial_dctr_after_move)
+            boost::container::destroy_alloc_n(this->m_holder.alloc(), old_begin, old_size);
+         this->m_holder.alloc().deallocate(this->m_holder.m_start, this->m_holder.m_capacity);
+      }
+      this->m_holder.m_start = new_start;
+      this->m_holder.m_capacity = new_cap;
+      this->m_holder.m_front = new_front;
+      this->m_holder.m_back  = new_front + old_size + n;
+      //All construction successful, disable rollbacks
+      new_values_destroyer.release();
+      new_buffer_deallocator.release();
+   }
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//!is_trivially_relocatable<> specialization: the devector only holds
+//!its allocator, a pointer to the elements and their position
+template <class T, class Allocator, class Options>
+struct is_trivially_relocatable<devector<T, Allocator, Options> >
+   : container_detail::is_trivially_relocatable_container<Allocator>
+{};
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+}} //namespace boost::container
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace boost {
+
+//!has_trivial_destructor_after_move<> == true_type
+//!specialization for optimizations
+template <class T, class Allocator, class Options>
+struct has_trivial_destructor_after_move<boost::container::devector<T, Allocator, Options> >
+{
+   typedef typename ::boost::container::allocator_traits<Allocator>::pointer pointer;
+   static const bool value = ::boost::has_trivial_destructor_after_move<Allocator>::value &&
+                             ::boost::has_trivial_destructor_after_move<pointer>::value;
+};
+
+}
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+namespace std {
+
+//!std::hash specialization, equivalent to boost::hash
+template <class T, class Allocator, class Options>
+struct hash< ::boost::container::devector<T, Allocator, Options> >
+{
+   std::size_t operator()(const ::boost::container::devector<T, Allocator, Options> &x) const
+   {  return ::boost::hash< ::boost::container::devector<T, Allocator, Options> >()(x);  }
+};
+
+}  //namespace std {
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif //   #ifndef  BOOST_CONTAINER_DEVECTOR_HPP
@@ -0,0 +1,639 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_FLAT_HASH_MAP_HPP
+#define BOOST_CONTAINER_FLAT_HASH_MAP_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/new_allocator.hpp> //new_allocator
+#include <boost/container/throw_exception.hpp>
+// container/detail
+#include <boost/container/detail/flat_hash_table.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/type_traits.hpp>
+#include <boost/container/detail/value_init.hpp>
+// move
+#include <boost/move/traits.hpp>
+#include <boost/move/utility_core.hpp>
+// move/detail
+#if defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+#include <boost/move/detail/fwd_macros.hpp>
+#endif
+#include <boost/move/detail/move_helpers.hpp>
+// intrusive/detail
+#include <boost/intrusive/detail/minimal_pair_header.hpp>      //pair
+#include <boost/intrusive/detail/minimal_less_equal_header.hpp>//less, equal
+// other
+#include <boost/functional/hash.hpp>
+#include <boost/static_assert.hpp>
+// std
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+#include <initializer_list>
+#endif
+
+namespace boost {
+namespace container {
+
+#ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! A flat_hash_map is a kind of unordered associative container that supports unique keys
+//! (contains at most one of each key value) and provides for fast retrieval of values
+//! of another type T based on the keys.
+//!
+//! flat_hash_map is an open addressing hash table: elements are stored in a single
+//! contiguous array of slots and a parallel array of one-byte control words holds
+//! 7 bits of the hash value of each element. Lookups compare 16 control bytes at a
+//! time (using SSE2 when available) and usually touch a single element, which avoids
+//! the pointer chasing of node-based containers like hash_map.
+//!
+//! Like flat_map, the <code>value_type</code> is std::pair<Key, T>, as elements are
+//! moved when the table is rehashed. Modifying the key of an element through an
+//! iterator is undefined behavior. Any insertion that rehashes the table invalidates
+//! all iterators, pointers and references.
+//!
+//! \tparam Key is the key_type of the map
+//! \tparam T is the <code>mapped_type</code>
+//! \tparam Hash is the hash function used to compute the hash value of keys
+//! \tparam Pred is the equality predicate used to compare keys
+//! \tparam Allocator is the allocator to allocate the <code>value_type</code>s
+//!   (e.g. <i>allocator< std::pair<Key, T> > </i>).
+template < class Key, class T, class Hash = boost::hash<Key>, class Pred = std::equal_to<Key>
+         , class Allocator = new_allocator< std::pair< Key, T> > >
+#else
+template <class Key, class T, class Hash, class Pred, class Allocator>
+#endif
+class flat_hash_map
+   ///@cond
+   : public container_detail::flat_hash_table
+      < Key, std::pair<Key, T>
+      , container_detail::select1st< std::pair<Key, T> >
+      , Hash, Pred, Allocator>
+   ///@endcond
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   BOOST_COPYABLE_AND_MOVABLE(flat_hash_map)
+
+   typedef std::pair<Key, T>  value_type_impl;
+   typedef container_detail::flat_hash_table
+      <Key, value_type_impl, container_detail::select1st<value_type_impl>, Hash, Pred, Allocator> base_t;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //                    types
+   //
+   //////////////////////////////////////////////
+
+   typedef Key                                                                      key_type;
+   typedef ::boost::container::allocator_traits<Allocator>                          allocator_traits_type;
+   typedef T                                                                        mapped_type;
+   typedef std::pair<Key, T>                                                        value_type;
+   typedef Hash                                                                     hasher;
+   typedef Pred                                                                     key_equal;
+   typedef typename boost::container::allocator_traits<Allocator>::pointer          pointer;
+   typedef typename boost::container::allocator_traits<Allocator>::const_pointer    const_pointer;
+   typedef typename boost::container::allocator_traits<Allocator>::reference        reference;
+   typedef typename boost::container::allocator_traits<Allocator>::const_reference  const_reference;
+   typedef typename boost::container::allocator_traits<Allocator>::size_type        size_type;
+   typedef typename boost::container::allocator_traits<Allocator>::difference_type  difference_type;
+   typedef Allocator                                                                allocator_type;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::stored_allocator_type)           stored_allocator_type;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::iterator)                        iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::const_iterator)                  const_iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::movable_value_type)              movable_value_type;
+
+   //////////////////////////////////////////////
+   //
+   //          construct/copy/destroy
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Default constructs an empty flat_hash_map. No memory is allocated.
+   //!
+   //! <b>Complexity</b>: Constant.
+   flat_hash_map()
+      : base_t()
+   {
+      //A type must be std::pair<Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! <b>Effects</b>: Constructs an empty flat_hash_map able to hold at least n elements
+   //!   without rehashing, using the specified hash function, equality predicate and allocator.
+   //!
+   //! <b>Complexity</b>: Linear in n.
+   explicit flat_hash_map(size_type n, const hasher& hf = hasher(), const key_equal& eql = key_equal(),
+                          const allocator_type& a = allocator_type())
+      : base_t(n, hf, eql, a)
+   {
+      //A type must be std::pair<Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! <b>Effects</b>: Constructs an empty flat_hash_map using the specified allocator.
+   //!
+   //! <b>Complexity</b>: Constant.
+   explicit flat_hash_map(const allocator_type& a)
+      : base_t(a)
+   {
+      //A type must be std::pair<Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! <b>Effects</b>: Constructs an empty flat_hash_map able to hold at least n elements
+   //!   using the specified hash function, equality predicate and allocator,
+   //!   and inserts elements from the range [first ,last ).
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is last - first.
+   template <class InputIterator>
+   flat_hash_map(InputIterator first, InputIterator last, size_type n = 0, const hasher& hf = hasher(),
+                 const key_equal& eql = key_equal(), const allocator_type& a = allocator_type())
+      : base_t(n, hf, eql, a)
+   {
+      //A type must be std::pair<Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<Key, T>, typename Allocator::value_type>::value));
+      this->base_t::insert_unique(first, last);
+   }
+
+   //! <b>Effects</b>: Constructs an empty flat_hash_map using the specified allocator,
+   //! and inserts elements from the range [first ,last ).
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is last - first.
+   template <class InputIterator>
+   flat_hash_map(InputIterator first, InputIterator last, const allocator_type& a)
+      : base_t(a)
+   {
+      //A type must be std::pair<Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<Key, T>, typename Allocator::value_type>::value));
+      this->base_t::insert_unique(first, last);
+   }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Constructs an empty flat_hash_map able to hold at least n elements
+   //!   using the specified hash function, equality predicate and allocator,
+   //!   and inserts elements from the range [il.begin(), il.end()).
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is il.size().
+   flat_hash_map(std::initializer_list<value_type> il, size_type n = 0, const hasher& hf = hasher(),
+                 const key_equal& eql = key_equal(), const allocator_type& a = allocator_type())
+      : base_t(n, hf, eql, a)
+   {
+      //A type must be std::pair<Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<Key, T>, typename Allocator::value_type>::value));
+      this->base_t::insert_unique(il.begin(), il.end());
+   }
+
+   //! <b>Effects</b>: Constructs an empty flat_hash_map using the specified allocator,
+   //! and inserts elements from the range [il.begin(), il.end()).
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is il.size().
+   flat_hash_map(std::initializer_list<value_type> il, const allocator_type& a)
+      : base_t(a)
+   {
+      //A type must be std::pair<Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<Key, T>, typename Allocator::value_type>::value));
+      this->base_t::insert_unique(il.begin(), il.end());
+   }
+#endif
+
+   //! <b>Effects</b>: Copy constructs a flat_hash_map. The layout of x is reproduced
+   //!   so no hash value is computed.
+   //!
+   //! <b>Complexity</b>: Linear in x.bucket_count().
+   flat_hash_map(const flat_hash_map& x)
+      : base_t(static_cast<const base_t&>(x))
+   {}
+
+   //! <b>Effects</b>: Move constructs a flat_hash_map. Constructs *this using x's resources.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Postcondition</b>: x is emptied.
+   flat_hash_map(BOOST_RV_REF(flat_hash_map) x)
+      : base_t(BOOST_MOVE_BASE(base_t, x))
+   {}
+
+   //! <b>Effects</b>: Copy constructs a flat_hash_map using the specified allocator.
+   //!
+   //! <b>Complexity</b>: Linear in x.bucket_count().
+   flat_hash_map(const flat_hash_map& x, const allocator_type &a)
+      : base_t(static_cast<const base_t&>(x), a)
+   {}
+
+   //! <b>Effects</b>: Move constructs a flat_hash_map using the specified allocator.
+   //!                 Constructs *this using x's resources.
+   //!
+   //! <b>Complexity</b>: Constant if a == x.get_allocator(), linear otherwise.
+   flat_hash_map(BOOST_RV_REF(flat_hash_map) x, const allocator_type &a)
+      : base_t(BOOST_MOVE_BASE(base_t, x), a)
+   {}
+
+   //! <b>Effects</b>: Makes *this a copy of x.
+   //!
+   //! <b>Complexity</b>: Linear in x.bucket_count().
+   flat_hash_map& operator=(BOOST_COPY_ASSIGN_REF(flat_hash_map) x)
+   {  return static_cast<flat_hash_map&>(this->base_t::operator=(static_cast<const base_t&>(x)));  }
+
+   //! <b>Effects</b>: Move constructs a flat_hash_map.
+   //!   Constructs *this using x's resources.
+   //!
+   //! <b>Throws</b>: If allocator_traits_type::propagate_on_container_move_assignment
+   //!   is false and (allocation throws or value_type's move constructor throws)
+   //!
+   //! <b>Complexity</b>: Constant if allocator_traits_type::
+   //!   propagate_on_container_move_assignment is true or
+   //!   this->get>allocator() == x.get_allocator(). Linear otherwise.
+   flat_hash_map& operator=(BOOST_RV_REF(flat_hash_map) x)
+      BOOST_NOEXCEPT_IF(  allocator_traits_type::is_always_equal::value
+                                 && boost::container::container_detail::is_nothrow_move_assignable<Hash>::value
+                                 && boost::container::container_detail::is_nothrow_move_assignable<Pred>::value )
+   {  return static_cast<flat_hash_map&>(this->base_t::operator=(BOOST_MOVE_BASE(base_t, x)));  }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Assign elements from il to *this
+   flat_hash_map& operator=(std::initializer_list<value_type> il)
+   {
+      this->clear();
+      this->insert(il.begin(), il.end());
+      return *this;
+   }
+#endif
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //! @copydoc ::boost::container::flat_hash_set::get_allocator()
+   allocator_type get_allocator() const;
+
+   //! @copydoc ::boost::container::flat_hash_set::get_stored_allocator()
+   stored_allocator_type &get_stored_allocator();
+
+   //! @copydoc ::boost::container::flat_hash_set::get_stored_allocator() const
+   const stored_allocator_type &get_stored_allocator() const;
+
+   //! @copydoc ::boost::container::flat_hash_set::begin()
+   iterator begin();
+
+   //! @copydoc ::boost::container::flat_hash_set::begin() const
+   const_iterator begin() const;
+
+   //! @copydoc ::boost::container::flat_hash_set::cbegin() const
+   const_iterator cbegin() const;
+
+   //! @copydoc ::boost::container::flat_hash_set::end()
+   iterator end();
+
+   //! @copydoc ::boost::container::flat_hash_set::end() const
+   const_iterator end() const;
+
+   //! @copydoc ::boost::container::flat_hash_set::cend() const
+   const_iterator cend() const;
+
+   //! @copydoc ::boost::container::flat_hash_set::empty() const
+   bool empty() const;
+
+   //! @copydoc ::boost::container::flat_hash_set::size() const
+   size_type size() const;
+
+   //! @copydoc ::boost::container::flat_hash_set::max_size() const
+   size_type max_size() const;
+
+   //! @copydoc ::boost::container::flat_hash_set::capacity() const
+   size_type capacity() const;
+
+   //! @copydoc ::boost::container::flat_hash_set::bucket_count() const
+   size_type bucket_count() const;
+
+   //! @copydoc ::boost::container::flat_hash_set::load_factor() const
+   float load_factor() const;
+
+   //! @copydoc ::boost::container::flat_hash_set::max_load_factor() const
+   float max_load_factor() const;
+
+   //! @copydoc ::boost::container::flat_hash_set::reserve(size_type)
+   void reserve(size_type n);
+
+   //! @copydoc ::boost::container::flat_hash_set::rehash(size_type)
+   void rehash(size_type n);
+
+   //! Effects: If there is no key equivalent to x in the flat_hash_map, inserts
+   //!   value_type(x, T()) into the flat_hash_map.
+   //!
+   //! Returns: A reference to the mapped_type corresponding to x in *this.
+   //!
+   //! Complexity: Average case constant.
+   mapped_type &operator[](const key_type& k);
+
+   //! Effects: If there is no key equivalent to x in the flat_hash_map, inserts
+   //! value_type(move(x), T()) into the flat_hash_map (the key is move-constructed)
+   //!
+   //! Returns: A reference to the mapped_type corresponding to x in *this.
+   //!
+   //! Complexity: Average case constant.
+   mapped_type &operator[](key_type &&k) ;
+   #else
+   BOOST_MOVE_CONVERSION_AWARE_CATCH( operator[] , key_type, mapped_type&, this->priv_subscript)
+   #endif
+
+   //! Returns: A reference to the element whose key is equivalent to x.
+   //!
+   //! Throws: An exception object of type out_of_range if no such element is present.
+   //!
+   //! Complexity: Average case constant.
+   T& at(const key_type& k)
+   {
+      iterator i = this->find(k);
+      if(i == this->end()){
+         throw_out_of_range("flat_hash_map::at key not found");
+      }
+      return i->second;
+   }
+
+   //! Returns: A reference to the element whose key is equivalent to x.
+   //!
+   //! Throws: An exception object of type out_of_range if no such element is present.
+   //!
+   //! Complexity: Average case constant.
+   const T& at(const key_type& k) const
+   {
+      const_iterator i = this->find(k);
+      if(i == this->end()){
+         throw_out_of_range("flat_hash_map::at key not found");
+      }
+      return i->second;
+   }
+
+   //////////////////////////////////////////////
+   //
+   //                modifiers
+   //
+   //////////////////////////////////////////////
+
+   #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   //! <b>Effects</b>: Inserts an object x of type T constructed with
+   //!   std::forward<Args>(args)... if and only if there is no element in the container
+   //!   with key equivalent to the key of x.
+   //!
+   //! <b>Returns</b>: The bool component of the returned pair is true if and only
+   //!   if the insertion takes place, and the iterator component of the pair
+   //!   points to the element with key equivalent to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   template <class... Args>
+   std::pair<iterator,bool> emplace(BOOST_FWD_REF(Args)... args)
+   {  return this->base_t::emplace_unique(boost::forward<Args>(args)...); }
+
+   //! <b>Effects</b>: Inserts an object of type T constructed with
+   //!   std::forward<Args>(args)... in the container if and only if there is
+   //!   no element in the container with key equivalent to the key of x.
+   //!   p is a hint that is ignored by this implementation.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent
+   //!   to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   template <class... Args>
+   iterator emplace_hint(const_iterator hint, BOOST_FWD_REF(Args)... args)
+   {  return this->base_t::emplace_hint_unique(hint, boost::forward<Args>(args)...); }
+
+   #else // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   #define BOOST_CONTAINER_FLAT_HASH_MAP_EMPLACE_CODE(N) \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   std::pair<iterator,bool> emplace(BOOST_MOVE_UREF##N)\
+   {  return this->base_t::emplace_unique(BOOST_MOVE_FWD##N);  }\
+   \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   iterator emplace_hint(const_iterator hint BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
+   {  return this->base_t::emplace_hint_unique(hint BOOST_MOVE_I##N BOOST_MOVE_FWD##N);  }\
+   //
+   BOOST_MOVE_ITERATE_0TO9(BOOST_CONTAINER_FLAT_HASH_MAP_EMPLACE_CODE)
+   #undef BOOST_CONTAINER_FLAT_HASH_MAP_EMPLACE_CODE
+
+   #endif   // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   //! <b>Effects</b>: Inserts x if and only if there is no element in the container
+   //!   with key equivalent to the key of x.
+   //!
+   //! <b>Returns</b>: The bool component of the returned pair is true if and only
+   //!   if the insertion takes place, and the iterator component of the pair
+   //!   points to the element with key equivalent to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   std::pair<iterator,bool> insert(const value_type& x)
+   {  return this->base_t::insert_unique(x);  }
+
+   //! <b>Effects</b>: Inserts a new value_type move constructed from the pair if and
+   //! only if there is no element in the container with key equivalent to the key of x.
+   //!
+   //! <b>Returns</b>: The bool component of the returned pair is true if and only
+   //!   if the insertion takes place, and the iterator component of the pair
+   //!   points to the element with key equivalent to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   std::pair<iterator,bool> insert(BOOST_RV_REF(value_type) x)
+   {  return this->base_t::insert_unique(boost::move(x));  }
+
+   //! <b>Effects</b>: Inserts a new value_type move constructed from the pair if and
+   //! only if there is no element in the container with key equivalent to the key of x.
+   //!
+   //! <b>Returns</b>: The bool component of the returned pair is true if and only
+   //!   if the insertion takes place, and the iterator component of the pair
+   //!   points to the element with key equivalent to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   std::pair<iterator,bool> insert(BOOST_RV_REF(movable_value_type) x)
+   {  return this->base_t::insert_unique(boost::move(x));  }
+
+   //! <b>Effects</b>: Inserts a copy of x in the container if and only if there is
+   //!   no element in the container with key equivalent to the key of x.
+   //!   p is a hint that is ignored by this implementation.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent
+   //!   to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(const_iterator p, const value_type& x)
+   {  return this->base_t::insert_unique(p, x);  }
+
+   //! <b>Effects</b>: Inserts an element move constructed from x in the container.
+   //!   p is a hint that is ignored by this implementation.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(const_iterator p, BOOST_RV_REF(value_type) x)
+   {  return this->base_t::insert_unique(p, boost::move(x));  }
+
+   //! <b>Effects</b>: Inserts an element move constructed from x in the container.
+   //!   p is a hint that is ignored by this implementation.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(const_iterator p, BOOST_RV_REF(movable_value_type) x)
+   {  return this->base_t::insert_unique(p, boost::move(x));  }
+
+   //! <b>Requires</b>: first, last are not iterators into *this.
+   //!
+   //! <b>Effects</b>: inserts each element from the range [first,last) if and only
+   //!   if there is no element with key equivalent to the key of that element.
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is the distance from first to last.
+   //!
+   //! <b>Note</b>: If [first,last) are forward iterators the table is rehashed at most once.
+   template <class InputIterator>
+   void insert(InputIterator first, InputIterator last)
+   {  this->base_t::insert_unique(first, last);  }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: inserts each element from the range [il.begin(), il.end()) if and only
+   //!   if there is no element with key equivalent to the key of that element.
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is il.size().
+   void insert(std::initializer_list<value_type> il)
+   {  this->base_t::insert_unique(il.begin(), il.end());  }
+#endif
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   //! @copydoc ::boost::container::flat_hash_set::erase(const_iterator)
+   iterator erase(const_iterator p);
+
+   //! @copydoc ::boost::container::flat_hash_set::erase(const key_type&)
+   size_type erase(const key_type& x);
+
+   //! @copydoc ::boost::container::flat_hash_set::erase(const_iterator,const_iterator)
+   iterator erase(const_iterator first, const_iterator last);
+
+   //! @copydoc ::boost::container::flat_hash_set::swap
+   void swap(flat_hash_map& x)
+      BOOST_NOEXCEPT_IF(  allocator_traits_type::is_always_equal::value
+                                 && boost::container::container_detail::is_nothrow_swappable<Hash>::value
+                                 && boost::container::container_detail::is_nothrow_swappable<Pred>::value );
+
+   //! @copydoc ::boost::container::flat_hash_set::clear
+   void clear();
+
+   //! @copydoc ::boost::container::flat_hash_set::hash_function
+   hasher hash_function() const;
+
+   //! @copydoc ::boost::container::flat_hash_set::key_eq
+   key_equal key_eq() const;
+
+   //! @copydoc ::boost::container::flat_hash_set::find(const key_type&)
+   iterator find(const key_type& x);
+
+   //! @copydoc ::boost::container::flat_hash_set::find(const key_type&) const
+   const_iterator find(const key_type& x) const;
+
+   #endif   //#if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   //! <b>Returns</b>: The number of elements with key equivalent to x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   size_type count(const key_type& x) const
+   {  return static_cast<size_type>(this->find(x) != this->cend());  }
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   //! @copydoc ::boost::container::flat_hash_set::equal_range(const key_type&)
+   std::pair<iterator,iterator> equal_range(const key_type& x);
+
+   //! @copydoc ::boost::container::flat_hash_set::equal_range(const key_type&) const
+   std::pair<const_iterator,const_iterator> equal_range(const key_type& x) const;
+
+   //! <b>Effects</b>: Returns true if x and y contain the same elements.
+   //!
+   //! <b>Complexity</b>: Average case linear in x.size().
+   friend bool operator==(const flat_hash_map& x, const flat_hash_map& y);
+
+   //! <b>Effects</b>: Returns true if x and y are unequal
+   //!
+   //! <b>Complexity</b>: Average case linear in x.size().
+   friend bool operator!=(const flat_hash_map& x, const flat_hash_map& y);
+
+   //! <b>Effects</b>: Returns the hash value of x. Equal containers have equal hash values.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend std::size_t hash_value(const flat_hash_map& x);
+
+   //! <b>Effects</b>: x.swap(y)
+   //!
+   //! <b>Complexity</b>: Constant.
+   friend void swap(flat_hash_map& x, flat_hash_map& y);
+
+   #endif   //#if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   mapped_type &priv_subscript(const key_type& k)
+   {
+      //The key is hashed only once
+      typename base_t::insert_commit_data data;
+      std::pair<iterator,bool> ret = this->base_t::insert_unique_check(k, data);
+      if (ret.second){
+         container_detail::value_init<mapped_type> m;
+         movable_value_type val(k, boost::move(m.m_t));
+         ret.first = this->base_t::insert_unique_commit(boost::move(val), data);
+      }
+      return (*ret.first).second;
+   }
+
+   mapped_type &priv_subscript(BOOST_RV_REF(key_type) mk)
+   {
+      key_type &k = mk;
+      //The key is hashed only once
+      typename base_t::insert_commit_data data;
+      std::pair<iterator,bool> ret = this->base_t::insert_unique_check(k, data);
+      if (ret.second){
+         container_detail::value_init<mapped_type> m;
+         movable_value_type val(boost::move(k), boost::move(m.m_t));
+         ret.first = this->base_t::insert_unique_commit(boost::move(val), data);
+      }
+      return (*ret.first).second;
+   }
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+}}
+
+#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+namespace std {
+
+//!std::hash specialization, equivalent to boost::hash
+template <class Key, class T, class Hash, class Pred, class Allocator>
+struct hash< ::boost::container::flat_hash_map<Key, T, Hash, Pred, Allocator> >
+{
+   std::size_t operator()(const ::boost::container::flat_hash_map<Key, T, Hash, Pred, Allocator> &x) const
+   {  return ::boost::hash< ::boost::container::flat_hash_map<Key, T, Hash, Pred, Allocator> >()(x);  }
+};
+
+}  //namespace std {
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   // BOOST_CONTAINER_FLAT_HASH_MAP_HPP
@@ -27,6 +27,7 @@
 #include <boost/container/throw_exception.hpp>
 // container/detail
 #include <boost/container/detail/flat_tree.hpp>
+#include <boost/container/detail/hash.hpp>
 #include <boost/container/detail/type_traits.hpp>
 #include <boost/container/detail/mpl.hpp>
 #include <boost/container/detail/algorithm.hpp> //equal()
@@ -66,6 +67,39 @@ static D force_copy(S s)
    return D(*vp);
 }
 
+//Converts the iterators of the implementation tree written
+//through it before storing them in the wrapped output iterator
+template<class D, class OutputIterator>
+class force_copy_output_iterator
+{
+   public:
+   explicit force_copy_output_iterator(OutputIterator out)
+      : m_out(out)
+   {}
+
+   force_copy_output_iterator &operator*()
+   {  return *this;  }
+
+   template<class S>
+   force_copy_output_iterator &operator=(const S &s)
+   {
+      *m_out = force_copy<D>(s);
+      return *this;
+   }
+
+   force_copy_output_iterator &operator++()
+   {
+      ++m_out;
+      return *this;
+   }
+
+   OutputIterator base() const
+   {  return m_out;  }
+
+   private:
+   OutputIterator m_out;
+};
+
 }  //namespace container_detail{
 
 #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
@@ -99,10 +133,11 @@ static D force_copy(S s)
 //! \tparam Compare is the ordering function for Keys (e.g. <i>std::less<Key></i>).
 //! \tparam Allocator is the allocator to allocate the <code>value_type</code>s
 //!   (e.g. <i>allocator< std::pair<Key, T> > </i>).
+//! \tparam Options is a packed option type generated using boost::container::flat_assoc_options.
 #ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
-template <class Key, class T, class Compare = std::less<Key>, class Allocator = new_allocator< std::pair< Key, T> > >
+template <class Key, class T, class Compare = std::less<Key>, class Allocator = new_allocator< std::pair< Key, T> >, class Options = flat_assoc_defaults >
 #else
-template <class Key, class T, class Compare, class Allocator>
+template <class Key, class T, class Compare, class Allocator, class Options>
 #endif
 class flat_map
 {
@@ -114,7 +149,8 @@ class flat_map
                            std::pair<Key, T>,
                            container_detail::select1st< std::pair<Key, T> >,
                            Compare,
-                           Allocator> tree_t;
+                           Allocator,
+                           Options> tree_t;
 
    //This is the real tree stored here. It's based on a movable pair
    typedef container_detail::flat_tree<Key,
@@ -122,7 +158,8 @@ class flat_map
                            container_detail::select1st<container_detail::pair<Key, T> >,
                            Compare,
                            typename allocator_traits<Allocator>::template portable_rebind_alloc
-                              <container_detail::pair<Key, T> >::type> impl_tree_t;
+                              <container_detail::pair<Key, T> >::type,
+                           Options> impl_tree_t;
    impl_tree_t m_flat_tree;  // flat tree representing flat_map
 
    typedef typename impl_tree_t::value_type              impl_value_type;
@@ -133,14 +170,14 @@ class flat_map
       < Compare
       , container_detail::select1st< std::pair<Key, T> >
       , std::pair<Key, T> >                                                         value_compare_impl;
-   typedef typename container_detail::get_flat_tree_iterators
-         <typename allocator_traits<Allocator>::pointer>::iterator                  iterator_impl;
-   typedef typename container_detail::get_flat_tree_iterators
-      <typename allocator_traits<Allocator>::pointer>::const_iterator               const_iterator_impl;
-   typedef typename container_detail::get_flat_tree_iterators
-         <typename allocator_traits<Allocator>::pointer>::reverse_iterator          reverse_iterator_impl;
-   typedef typename container_detail::get_flat_tree_iterators
-         <typename allocator_traits<Allocator>::pointer>::const_reverse_iterator    const_reverse_iterator_impl;
+   typedef typename impl_tree_t::sequence_type                                      impl_sequence_type;
+   typedef typename container_detail::flat_tree_sequence
+      < std::pair<Key, T>, Allocator
+      , Options::sequence_storage, Options::sequence_capacity>::type                sequence_type_impl;
+   typedef typename sequence_type_impl::iterator                                    iterator_impl;
+   typedef typename sequence_type_impl::const_iterator                              const_iterator_impl;
+   typedef typename sequence_type_impl::reverse_iterator                            reverse_iterator_impl;
+   typedef typename sequence_type_impl::const_reverse_iterator                      const_reverse_iterator_impl;
    public:
    typedef typename impl_tree_t::stored_allocator_type   impl_stored_allocator_type;
    private:
@@ -172,6 +209,7 @@ class flat_map
    typedef BOOST_CONTAINER_IMPDEF(reverse_iterator_impl)                            reverse_iterator;
    typedef BOOST_CONTAINER_IMPDEF(const_reverse_iterator_impl)                      const_reverse_iterator;
    typedef BOOST_CONTAINER_IMPDEF(impl_value_type)                                  movable_value_type;
+   typedef BOOST_CONTAINER_IMPDEF(sequence_type_impl)                               sequence_type;
 
    public:
    //////////////////////////////////////////////
@@ -543,6 +581,7 @@ class flat_map
 
    //! <b>Effects</b>: Number of elements for which memory has been allocated.
    //!   capacity() is always greater than or equal to size().
+   //!   It's equal to size() if the elements are stored in a deque.
    //!
    //! <b>Throws</b>: Nothing.
    //!
@@ -554,6 +593,7 @@ class flat_map
    //!   effect. Otherwise, it is a request for allocation of additional memory.
    //!   If the request is successful, then capacity() is greater than or equal to
    //!   n; otherwise, capacity() is unchanged. In either case, size() is unchanged.
+   //!   It has no effect if the elements are stored in a deque.
    //!
    //! <b>Throws</b>: If memory allocation allocation throws or T's copy constructor throws.
    //!
@@ -571,6 +611,10 @@ class flat_map
    void shrink_to_fit()
       { m_flat_tree.shrink_to_fit(); }
 
+   //! @copydoc ::boost::container::flat_set::rebuild_index()
+   void rebuild_index()
+      { m_flat_tree.rebuild_index(); }
+
    //////////////////////////////////////////////
    //
    //               element access
@@ -809,8 +853,8 @@ class flat_map
    //! <b>Effects</b>: inserts each element from the range [first,last) if and only
    //!   if there is no element with key equivalent to the key of that element.
    //!
-   //! <b>Complexity</b>: At most N log(size()+N) (N is the distance from first to last)
-   //!   search time plus N*size() insertion time.
+   //! <b>Complexity</b>: N log(N) comparisons to sort the new elements (N is the distance from first to last)
+   //!   plus a linear merge with the existing elements (linear if the range is already sorted).
    //!
    //! <b>Note</b>: If an element is inserted it might invalidate elements.
    template <class InputIterator>
@@ -840,8 +884,8 @@ class flat_map
    //! <b>Effects</b>: inserts each element from the range [il.begin(), il.end()) if and only
    //!   if there is no element with key equivalent to the key of that element.
    //!
-   //! <b>Complexity</b>: At most N log(size()+N) (N is the distance from il.first() to il.end())
-   //!   search time plus N*size() insertion time.
+   //! <b>Complexity</b>: N log(N) comparisons to sort the new elements (N is il.size())
+   //!   plus a linear merge with the existing elements (linear if the range is already sorted).
    //!
    //! <b>Note</b>: If an element is inserted it might invalidate elements.
    void insert(std::initializer_list<value_type> il)
@@ -864,6 +908,91 @@ class flat_map
    {  m_flat_tree.insert_unique(ordered_unique_range, il.begin(), il.end()); }
 #endif
 
+   //! <b>Effects</b>: Extracts the internal sequence container.
+   //!
+   //! <b>Complexity</b>: Same as the move constructor of sequence_type, usually constant.
+   //!
+   //! <b>Postcondition</b>: this->empty()
+   //!
+   //! <b>Throws</b>: If sequence_type's move constructor throws
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   sequence_type extract_sequence()
+   {
+      impl_sequence_type seq(m_flat_tree.extract_sequence());
+      return boost::move(container_detail::force<sequence_type>(seq));
+   }
+
+   //! <b>Effects</b>: Discards the internally hold sequence container and adopts the
+   //!   one passed externally using the move assignment. Erases non-unique elements:
+   //!   if several elements have equivalent keys, the first one is kept.
+   //!
+   //! <b>Complexity</b>: Assuming O(1) move assignment, O(NlogN) with N = seq.size(),
+   //!   linear if seq is already sorted.
+   //!
+   //! <b>Throws</b>: If the comparison or the move constructor throws. In that case *this
+   //!   is left unchanged.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void adopt_sequence(BOOST_RV_REF(sequence_type) seq)
+   {  m_flat_tree.adopt_sequence_unique(boost::move(container_detail::force<impl_sequence_type>(seq)));  }
+
+   //! <b>Requires</b>: seq shall be ordered according to this->compare()
+   //!   and shall contain unique elements. This precondition is checked
+   //!   with an assertion.
+   //!
+   //! <b>Effects</b>: Discards the internally hold sequence container and adopts the
+   //!   one passed externally using the move assignment.
+   //!
+   //! <b>Complexity</b>: Assuming O(1) move assignment, O(1)
+   //!
+   //! <b>Throws</b>: If the move assignment throws
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void adopt_sequence(ordered_unique_range_t, BOOST_RV_REF(sequence_type) seq)
+   {  m_flat_tree.adopt_sequence_unique(ordered_unique_range, boost::move(container_detail::force<impl_sequence_type>(seq)));  }
+
+   //! <b>Effects</b>: Inserts a copy of each element of x whose key is not
+   //!   present in *this, leaving *this as the union of both containers.
+   //!
+   //! <b>Complexity</b>: O(M log(N/M + 1)) comparisons plus a linear merge of the new
+   //!   elements, where M is x.size() and N is size(). Searches gallop from the
+   //!   previous result.
+   //!
+   //! <b>Throws</b>: If the comparison, the copy constructor, the move constructor or
+   //!   the move assignment throws. *this is unchanged if the comparison or the copy
+   //!   constructor throws.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void merge_union(const flat_map& x)
+   {  m_flat_tree.merge_union_unique(x.m_flat_tree);  }
+
+   //! <b>Effects</b>: Erases the elements of *this whose keys are not present in x,
+   //!   leaving *this as the intersection of both containers.
+   //!
+   //! <b>Complexity</b>: O(M log(N/M + 1)) comparisons, where M is the size of the smaller
+   //!   container and N the size of the larger one, plus at most size() move assignments.
+   //!   Both sequences are walked in order and searches gallop from the previous result.
+   //!
+   //! <b>Throws</b>: If the comparison or the move assignment throws.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void intersect_with(const flat_map& x)
+   {  m_flat_tree.intersect_with_unique(x.m_flat_tree);  }
+
+   //! <b>Effects</b>: Erases the elements of *this whose keys are present in x,
+   //!   leaving *this as the difference of both containers.
+   //!
+   //! <b>Complexity</b>: O(M log(N/M + 1)) comparisons, where M is the size of the smaller
+   //!   container and N the size of the larger one, plus at most size() move assignments.
+   //!   Both sequences are walked in order and searches gallop from the previous result.
+   //!
+   //! <b>Throws</b>: If the comparison or the move assignment throws.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void subtract(const flat_map& x)
+   {  m_flat_tree.subtract_unique(x.m_flat_tree);  }
+
    //! <b>Effects</b>: Erases the element pointed to by p.
    //!
    //! <b>Returns</b>: Returns an iterator pointing to the element immediately
@@ -955,6 +1084,18 @@ class flat_map
    iterator find(const key_type& x)
       { return container_detail::force_copy<iterator>(m_flat_tree.find(x)); }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: An iterator pointing to an element with the key
+   //!   equivalent to x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      find(const K& x)
+      { return container_detail::force_copy<iterator>(m_flat_tree.find(x)); }
+
    //! <b>Returns</b>: A const_iterator pointing to an element with the key
    //!   equivalent to x, or end() if such an element is not found.
    //!
@@ -962,12 +1103,70 @@ class flat_map
    const_iterator find(const key_type& x) const
       { return container_detail::force_copy<const_iterator>(m_flat_tree.find(x)); }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: A const_iterator pointing to an element with the key
+   //!   equivalent to x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic.s
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      find(const K& x) const
+      { return container_detail::force_copy<const_iterator>(m_flat_tree.find(x)); }
+
+   //! <b>Requires</b>: KeyForwardIterator is a forward iterator whose elements
+   //!   can be looked up with find().
+   //!
+   //! <b>Effects</b>: For each key k in [first, last), in order, writes find(k) to out.
+   //!   The searches of several keys are interleaved and the memory they will touch
+   //!   next is prefetched, so that their cache misses overlap instead of being
+   //!   serviced one at a time.
+   //!
+   //! <b>Returns</b>: The output iterator past the last written iterator.
+   //!
+   //! <b>Complexity</b>: N*log(size()), where N is the distance between first and last.
+   template<class KeyForwardIterator, class OutputIterator>
+   OutputIterator find_batch(KeyForwardIterator first, KeyForwardIterator last, OutputIterator out)
+   {
+      return m_flat_tree.find_batch
+         (first, last, container_detail::force_copy_output_iterator<iterator, OutputIterator>(out)).base();
+   }
+
+   //! <b>Requires</b>: KeyForwardIterator is a forward iterator whose elements
+   //!   can be looked up with find().
+   //!
+   //! <b>Effects</b>: For each key k in [first, last), in order, writes find(k) to out,
+   //!   a const_iterator. The searches of several keys are interleaved and the memory
+   //!   they will touch next is prefetched.
+   //!
+   //! <b>Returns</b>: The output iterator past the last written iterator.
+   //!
+   //! <b>Complexity</b>: N*log(size()), where N is the distance between first and last.
+   template<class KeyForwardIterator, class OutputIterator>
+   OutputIterator find_batch(KeyForwardIterator first, KeyForwardIterator last, OutputIterator out) const
+   {
+      return m_flat_tree.find_batch
+         (first, last, container_detail::force_copy_output_iterator<const_iterator, OutputIterator>(out)).base();
+   }
+
    //! <b>Returns</b>: The number of elements with key equivalent to x.
    //!
    //! <b>Complexity</b>: log(size())+count(k)
    size_type count(const key_type& x) const
       {  return static_cast<size_type>(m_flat_tree.find(x) != m_flat_tree.end());  }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: The number of elements with key equivalent to x.
+   //!
+   //! <b>Complexity</b>: log(size())+count(k)
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, size_type>::type
+      count(const K& x) const
+      {  return static_cast<size_type>(m_flat_tree.find(x) != m_flat_tree.end());  }
+
    //! <b>Returns</b>: An iterator pointing to the first element with key not less
    //!   than k, or a.end() if such an element is not found.
    //!
@@ -975,6 +1174,18 @@ class flat_map
    iterator lower_bound(const key_type& x)
       {  return container_detail::force_copy<iterator>(m_flat_tree.lower_bound(x)); }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the first element with key not less
+   //!   than k, or a.end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      lower_bound(const K& x)
+      {  return container_detail::force_copy<iterator>(m_flat_tree.lower_bound(x)); }
+
    //! <b>Returns</b>: A const iterator pointing to the first element with key not
    //!   less than k, or a.end() if such an element is not found.
    //!
@@ -982,6 +1193,18 @@ class flat_map
    const_iterator lower_bound(const key_type& x) const
       {  return container_detail::force_copy<const_iterator>(m_flat_tree.lower_bound(x)); }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: A const iterator pointing to the first element with key not
+   //!   less than k, or a.end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      lower_bound(const K& x) const
+      {  return container_detail::force_copy<const_iterator>(m_flat_tree.lower_bound(x)); }
+
    //! <b>Returns</b>: An iterator pointing to the first element with key not less
    //!   than x, or end() if such an element is not found.
    //!
@@ -989,6 +1212,18 @@ class flat_map
    iterator upper_bound(const key_type& x)
       {  return container_detail::force_copy<iterator>(m_flat_tree.upper_bound(x)); }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the first element with key not less
+   //!   than x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      upper_bound(const K& x)
+      {  return container_detail::force_copy<iterator>(m_flat_tree.upper_bound(x)); }
+
    //! <b>Returns</b>: A const iterator pointing to the first element with key not
    //!   less than x, or end() if such an element is not found.
    //!
@@ -996,18 +1231,52 @@ class flat_map
    const_iterator upper_bound(const key_type& x) const
       {  return container_detail::force_copy<const_iterator>(m_flat_tree.upper_bound(x)); }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: A const iterator pointing to the first element with key not
+   //!   less than x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      upper_bound(const K& x) const
+      {  return container_detail::force_copy<const_iterator>(m_flat_tree.upper_bound(x)); }
+
    //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
    //!
    //! <b>Complexity</b>: Logarithmic
    std::pair<iterator,iterator> equal_range(const key_type& x)
       {  return container_detail::force_copy<std::pair<iterator,iterator> >(m_flat_tree.lower_bound_range(x)); }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<iterator,iterator> >::type
+      equal_range(const K& x)
+      {  return container_detail::force_copy<std::pair<iterator,iterator> >(m_flat_tree.lower_bound_range(x)); }
+
    //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
    //!
    //! <b>Complexity</b>: Logarithmic
    std::pair<const_iterator,const_iterator> equal_range(const key_type& x) const
       {  return container_detail::force_copy<std::pair<const_iterator,const_iterator> >(m_flat_tree.lower_bound_range(x)); }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<const_iterator,const_iterator> >::type
+      equal_range(const K& x) const
+      {  return container_detail::force_copy<std::pair<const_iterator,const_iterator> >(m_flat_tree.lower_bound_range(x)); }
+
    //! <b>Effects</b>: Returns true if x and y are equal
    //!
    //! <b>Complexity</b>: Linear to the number of elements in the container.
@@ -1020,6 +1289,12 @@ class flat_map
    friend bool operator!=(const flat_map& x, const flat_map& y)
    {  return !(x == y); }
 
+   //! <b>Effects</b>: Returns the hash value of x. Equal containers have equal hash values.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend std::size_t hash_value(const flat_map& x)
+   {  return container_detail::hash_range(x.begin(), x.end());  }
+
    //! <b>Effects</b>: Returns true if x is less than y
    //!
    //! <b>Complexity</b>: Linear to the number of elements in the container.
@@ -1082,8 +1357,8 @@ class flat_map
 
 //!has_trivial_destructor_after_move<> == true_type
 //!specialization for optimizations
-template <class Key, class T, class Compare, class Allocator>
-struct has_trivial_destructor_after_move<boost::container::flat_map<Key, T, Compare, Allocator> >
+template <class Key, class T, class Compare, class Allocator, class Options>
+struct has_trivial_destructor_after_move<boost::container::flat_map<Key, T, Compare, Allocator, Options> >
 {
    typedef typename ::boost::container::allocator_traits<Allocator>::pointer pointer;
    static const bool value = ::boost::has_trivial_destructor_after_move<Allocator>::value &&
@@ -1124,10 +1399,11 @@ namespace container {
 //! \tparam Compare is the ordering function for Keys (e.g. <i>std::less<Key></i>).
 //! \tparam Allocator is the allocator to allocate the <code>value_type</code>s
 //!   (e.g. <i>allocator< std::pair<Key, T> > </i>).
+//! \tparam Options is a packed option type generated using boost::container::flat_assoc_options.
 #ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
-template <class Key, class T, class Compare = std::less<Key>, class Allocator = new_allocator< std::pair< Key, T> > >
+template <class Key, class T, class Compare = std::less<Key>, class Allocator = new_allocator< std::pair< Key, T> >, class Options = flat_assoc_defaults >
 #else
-template <class Key, class T, class Compare, class Allocator>
+template <class Key, class T, class Compare, class Allocator, class Options>
 #endif
 class flat_multimap
 {
@@ -1138,14 +1414,16 @@ class flat_multimap
                            std::pair<Key, T>,
                            container_detail::select1st< std::pair<Key, T> >,
                            Compare,
-                           Allocator> tree_t;
+                           Allocator,
+                           Options> tree_t;
    //This is the real tree stored here. It's based on a movable pair
    typedef container_detail::flat_tree<Key,
                            container_detail::pair<Key, T>,
                            container_detail::select1st<container_detail::pair<Key, T> >,
                            Compare,
                            typename allocator_traits<Allocator>::template portable_rebind_alloc
-                              <container_detail::pair<Key, T> >::type> impl_tree_t;
+                              <container_detail::pair<Key, T> >::type,
+                           Options> impl_tree_t;
    impl_tree_t m_flat_tree;  // flat tree representing flat_map
 
    typedef typename impl_tree_t::value_type              impl_value_type;
@@ -1156,14 +1434,14 @@ class flat_multimap
       < Compare
       , container_detail::select1st< std::pair<Key, T> >
       , std::pair<Key, T> >                                                         value_compare_impl;
-   typedef typename container_detail::get_flat_tree_iterators
-         <typename allocator_traits<Allocator>::pointer>::iterator                  iterator_impl;
-   typedef typename container_detail::get_flat_tree_iterators
-      <typename allocator_traits<Allocator>::pointer>::const_iterator               const_iterator_impl;
-   typedef typename container_detail::get_flat_tree_iterators
-         <typename allocator_traits<Allocator>::pointer>::reverse_iterator          reverse_iterator_impl;
-   typedef typename container_detail::get_flat_tree_iterators
-         <typename allocator_traits<Allocator>::pointer>::const_reverse_iterator    const_reverse_iterator_impl;
+   typedef typename impl_tree_t::sequence_type                                      impl_sequence_type;
+   typedef typename container_detail::flat_tree_sequence
+      < std::pair<Key, T>, Allocator
+      , Options::sequence_storage, Options::sequence_capacity>::type                sequence_type_impl;
+   typedef typename sequence_type_impl::iterator                                    iterator_impl;
+   typedef typename sequence_type_impl::const_iterator                              const_iterator_impl;
+   typedef typename sequence_type_impl::reverse_iterator                            reverse_iterator_impl;
+   typedef typename sequence_type_impl::const_reverse_iterator                      const_reverse_iterator_impl;
    public:
    typedef typename impl_tree_t::stored_allocator_type   impl_stored_allocator_type;
    private:
@@ -1195,6 +1473,7 @@ class flat_multimap
    typedef BOOST_CONTAINER_IMPDEF(reverse_iterator_impl)                            reverse_iterator;
    typedef BOOST_CONTAINER_IMPDEF(const_reverse_iterator_impl)                      const_reverse_iterator;
    typedef BOOST_CONTAINER_IMPDEF(impl_value_type)                                  movable_value_type;
+   typedef BOOST_CONTAINER_IMPDEF(sequence_type_impl)                               sequence_type;
 
    //////////////////////////////////////////////
    //
@@ -1560,6 +1839,7 @@ class flat_multimap
 
    //! <b>Effects</b>: Number of elements for which memory has been allocated.
    //!   capacity() is always greater than or equal to size().
+   //!   It's equal to size() if the elements are stored in a deque.
    //!
    //! <b>Throws</b>: Nothing.
    //!
@@ -1571,6 +1851,7 @@ class flat_multimap
    //!   effect. Otherwise, it is a request for allocation of additional memory.
    //!   If the request is successful, then capacity() is greater than or equal to
    //!   n; otherwise, capacity() is unchanged. In either case, size() is unchanged.
+   //!   It has no effect if the elements are stored in a deque.
    //!
    //! <b>Throws</b>: If memory allocation allocation throws or T's copy constructor throws.
    //!
@@ -1588,6 +1869,10 @@ class flat_multimap
    void shrink_to_fit()
       { m_flat_tree.shrink_to_fit(); }
 
+   //! @copydoc ::boost::container::flat_set::rebuild_index()
+   void rebuild_index()
+      { m_flat_tree.rebuild_index(); }
+
    //! @copydoc ::boost::container::flat_set::nth(size_type)
    iterator nth(size_type n) BOOST_NOEXCEPT_OR_NOTHROW
    {  return container_detail::force_copy<iterator>(m_flat_tree.nth(n));  }
@@ -1746,8 +2031,8 @@ class flat_multimap
    //!
    //! <b>Effects</b>: inserts each element from the range [first,last) .
    //!
-   //! <b>Complexity</b>: At most N log(size()+N) (N is the distance from first to last)
-   //!   search time plus N*size() insertion time.
+   //! <b>Complexity</b>: N log(N) comparisons to sort the new elements (N is the distance from first to last)
+   //!   plus a linear merge with the existing elements (linear if the range is already sorted).
    //!
    //! <b>Note</b>: If an element is inserted it might invalidate elements.
    template <class InputIterator>
@@ -1775,8 +2060,8 @@ class flat_multimap
 #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
    //! <b>Effects</b>: inserts each element from the range [il.begin(), il.end()) .
    //!
-   //! <b>Complexity</b>: At most N log(size()+N) (N is the distance from first to last)
-   //!   search time plus N*size() insertion time.
+   //! <b>Complexity</b>: N log(N) comparisons to sort the new elements (N is il.size())
+   //!   plus a linear merge with the existing elements (linear if the range is already sorted).
    //!
    //! <b>Note</b>: If an element is inserted it might invalidate elements.
    void insert(std::initializer_list<value_type> il)
@@ -1798,6 +2083,41 @@ class flat_multimap
    {  m_flat_tree.insert_equal(ordered_range, il.begin(), il.end());  }
 #endif
 
+   //! @copydoc ::boost::container::flat_map::extract_sequence
+   sequence_type extract_sequence()
+   {
+      impl_sequence_type seq(m_flat_tree.extract_sequence());
+      return boost::move(container_detail::force<sequence_type>(seq));
+   }
+
+   //! <b>Effects</b>: Discards the internally hold sequence container and adopts the
+   //!   one passed externally using the move assignment. The order of elements with
+   //!   equivalent keys is preserved.
+   //!
+   //! <b>Complexity</b>: Assuming O(1) move assignment, O(NlogN) with N = seq.size(),
+   //!   linear if seq is already sorted.
+   //!
+   //! <b>Throws</b>: If the comparison or the move constructor throws. In that case *this
+   //!   is left unchanged.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void adopt_sequence(BOOST_RV_REF(sequence_type) seq)
+   {  m_flat_tree.adopt_sequence_equal(boost::move(container_detail::force<impl_sequence_type>(seq)));  }
+
+   //! <b>Requires</b>: seq shall be ordered according to this->compare().
+   //!   This precondition is checked with an assertion.
+   //!
+   //! <b>Effects</b>: Discards the internally hold sequence container and adopts the
+   //!   one passed externally using the move assignment.
+   //!
+   //! <b>Complexity</b>: Assuming O(1) move assignment, O(1)
+   //!
+   //! <b>Throws</b>: If the move assignment throws
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void adopt_sequence(ordered_range_t, BOOST_RV_REF(sequence_type) seq)
+   {  m_flat_tree.adopt_sequence_equal(ordered_range, boost::move(container_detail::force<impl_sequence_type>(seq)));  }
+
    //! <b>Effects</b>: Erases the element pointed to by p.
    //!
    //! <b>Returns</b>: Returns an iterator pointing to the element immediately
@@ -1889,6 +2209,18 @@ class flat_multimap
    iterator find(const key_type& x)
       { return container_detail::force_copy<iterator>(m_flat_tree.find(x)); }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: An iterator pointing to an element with the key
+   //!   equivalent to x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      find(const K& x)
+      { return container_detail::force_copy<iterator>(m_flat_tree.find(x)); }
+
    //! <b>Returns</b>: An const_iterator pointing to an element with the key
    //!   equivalent to x, or end() if such an element is not found.
    //!
@@ -1896,12 +2228,51 @@ class flat_multimap
    const_iterator find(const key_type& x) const
       { return container_detail::force_copy<const_iterator>(m_flat_tree.find(x)); }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: An const_iterator pointing to an element with the key
+   //!   equivalent to x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      find(const K& x) const
+      { return container_detail::force_copy<const_iterator>(m_flat_tree.find(x)); }
+
+   //! @copydoc ::boost::container::flat_map::find_batch(KeyForwardIterator,KeyForwardIterator,OutputIterator)
+   template<class KeyForwardIterator, class OutputIterator>
+   OutputIterator find_batch(KeyForwardIterator first, KeyForwardIterator last, OutputIterator out)
+   {
+      return m_flat_tree.find_batch
+         (first, last, container_detail::force_copy_output_iterator<iterator, OutputIterator>(out)).base();
+   }
+
+   //! @copydoc ::boost::container::flat_map::find_batch(KeyForwardIterator,KeyForwardIterator,OutputIterator) const
+   template<class KeyForwardIterator, class OutputIterator>
+   OutputIterator find_batch(KeyForwardIterator first, KeyForwardIterator last, OutputIterator out) const
+   {
+      return m_flat_tree.find_batch
+         (first, last, container_detail::force_copy_output_iterator<const_iterator, OutputIterator>(out)).base();
+   }
+
    //! <b>Returns</b>: The number of elements with key equivalent to x.
    //!
    //! <b>Complexity</b>: log(size())+count(k)
    size_type count(const key_type& x) const
       { return m_flat_tree.count(x); }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: The number of elements with key equivalent to x.
+   //!
+   //! <b>Complexity</b>: log(size())+count(k)
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, size_type>::type
+      count(const K& x) const
+      { return m_flat_tree.count(x); }
+
    //! <b>Returns</b>: An iterator pointing to the first element with key not less
    //!   than k, or a.end() if such an element is not found.
    //!
@@ -1909,6 +2280,18 @@ class flat_multimap
    iterator lower_bound(const key_type& x)
       {  return container_detail::force_copy<iterator>(m_flat_tree.lower_bound(x)); }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the first element with key not less
+   //!   than k, or a.end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      lower_bound(const K& x)
+      {  return container_detail::force_copy<iterator>(m_flat_tree.lower_bound(x)); }
+
    //! <b>Returns</b>: A const iterator pointing to the first element with key
    //!   not less than k, or a.end() if such an element is not found.
    //!
@@ -1916,6 +2299,18 @@ class flat_multimap
    const_iterator lower_bound(const key_type& x) const
       {  return container_detail::force_copy<const_iterator>(m_flat_tree.lower_bound(x));  }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: A const iterator pointing to the first element with key
+   //!   not less than k, or a.end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      lower_bound(const K& x) const
+      {  return container_detail::force_copy<const_iterator>(m_flat_tree.lower_bound(x));  }
+
    //! <b>Returns</b>: An iterator pointing to the first element with key not less
    //!   than x, or end() if such an element is not found.
    //!
@@ -1923,6 +2318,18 @@ class flat_multimap
    iterator upper_bound(const key_type& x)
       {return container_detail::force_copy<iterator>(m_flat_tree.upper_bound(x)); }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the first element with key not less
+   //!   than x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      upper_bound(const K& x)
+      {return container_detail::force_copy<iterator>(m_flat_tree.upper_bound(x)); }
+
    //! <b>Returns</b>: A const iterator pointing to the first element with key
    //!   not less than x, or end() if such an element is not found.
    //!
@@ -1930,18 +2337,52 @@ class flat_multimap
    const_iterator upper_bound(const key_type& x) const
       {  return container_detail::force_copy<const_iterator>(m_flat_tree.upper_bound(x)); }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: A const iterator pointing to the first element with key
+   //!   not less than x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      upper_bound(const K& x) const
+      {  return container_detail::force_copy<const_iterator>(m_flat_tree.upper_bound(x)); }
+
    //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
    //!
    //! <b>Complexity</b>: Logarithmic
    std::pair<iterator,iterator> equal_range(const key_type& x)
       {  return container_detail::force_copy<std::pair<iterator,iterator> >(m_flat_tree.equal_range(x));   }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<iterator,iterator> >::type
+      equal_range(const K& x)
+      {  return container_detail::force_copy<std::pair<iterator,iterator> >(m_flat_tree.equal_range(x));   }
+
    //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
    //!
    //! <b>Complexity</b>: Logarithmic
    std::pair<const_iterator,const_iterator> equal_range(const key_type& x) const
       {  return container_detail::force_copy<std::pair<const_iterator,const_iterator> >(m_flat_tree.equal_range(x));   }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<const_iterator,const_iterator> >::type
+      equal_range(const K& x) const
+      {  return container_detail::force_copy<std::pair<const_iterator,const_iterator> >(m_flat_tree.equal_range(x));   }
+
    //! <b>Effects</b>: Returns true if x and y are equal
    //!
    //! <b>Complexity</b>: Linear to the number of elements in the container.
@@ -1954,6 +2395,12 @@ class flat_multimap
    friend bool operator!=(const flat_multimap& x, const flat_multimap& y)
    {  return !(x == y); }
 
+   //! <b>Effects</b>: Returns the hash value of x. Equal containers have equal hash values.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend std::size_t hash_value(const flat_multimap& x)
+   {  return container_detail::hash_range(x.begin(), x.end());  }
+
    //! <b>Effects</b>: Returns true if x is less than y
    //!
    //! <b>Complexity</b>: Linear to the number of elements in the container.
@@ -1993,8 +2440,8 @@ namespace boost {
 
 //!has_trivial_destructor_after_move<> == true_type
 //!specialization for optimizations
-template <class Key, class T, class Compare, class Allocator>
-struct has_trivial_destructor_after_move< boost::container::flat_multimap<Key, T, Compare, Allocator> >
+template <class Key, class T, class Compare, class Allocator, class Options>
+struct has_trivial_destructor_after_move< boost::container::flat_multimap<Key, T, Compare, Allocator, Options> >
 {
    typedef typename ::boost::container::allocator_traits<Allocator>::pointer pointer;
    static const bool value = ::boost::has_trivial_destructor_after_move<Allocator>::value &&
@@ -2006,6 +2453,30 @@ struct has_trivial_destructor_after_move< boost::container::flat_multimap<Key, T
 
 #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
 
+#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+namespace std {
+
+//!std::hash specialization, equivalent to boost::hash
+template <class Key, class T, class Compare, class Allocator, class Options>
+struct hash< ::boost::container::flat_map<Key, T, Compare, Allocator, Options> >
+{
+   std::size_t operator()(const ::boost::container::flat_map<Key, T, Compare, Allocator, Options> &x) const
+   {  return ::boost::hash< ::boost::container::flat_map<Key, T, Compare, Allocator, Options> >()(x);  }
+};
+
+//!std::hash specialization, equivalent to boost::hash
+template <class Key, class T, class Compare, class Allocator, class Options>
+struct hash< ::boost::container::flat_multimap<Key, T, Compare, Allocator, Options> >
+{
+   std::size_t operator()(const ::boost::container::flat_multimap<Key, T, Compare, Allocator, Options> &x) const
+   {  return ::boost::hash< ::boost::container::flat_multimap<Key, T, Compare, Allocator, Options> >()(x);  }
+};
+
+}  //namespace std {
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
 #include <boost/container/detail/config_end.hpp>
 
 #endif   // BOOST_CONTAINER_FLAT_MAP_HPP
@@ -62,20 +62,21 @@ namespace container {
 //! \tparam Key is the type to be inserted in the set, which is also the key_type
 //! \tparam Compare is the comparison functor used to order keys
 //! \tparam Allocator is the allocator to be used to allocate memory for this container
+//! \tparam Options is a packed option type generated using boost::container::flat_assoc_options.
 #ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
-template <class Key, class Compare = std::less<Key>, class Allocator = new_allocator<Key> >
+template <class Key, class Compare = std::less<Key>, class Allocator = new_allocator<Key>, class Options = flat_assoc_defaults >
 #else
-template <class Key, class Compare, class Allocator>
+template <class Key, class Compare, class Allocator, class Options>
 #endif
 class flat_set
    ///@cond
-   : public container_detail::flat_tree<Key, Key, container_detail::identity<Key>, Compare, Allocator>
+   : public container_detail::flat_tree<Key, Key, container_detail::identity<Key>, Compare, Allocator, Options>
    ///@endcond
 {
    #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
    private:
    BOOST_COPYABLE_AND_MOVABLE(flat_set)
-   typedef container_detail::flat_tree<Key, Key, container_detail::identity<Key>, Compare, Allocator> base_t;
+   typedef container_detail::flat_tree<Key, Key, container_detail::identity<Key>, Compare, Allocator, Options> base_t;
    #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
 
    public:
@@ -101,6 +102,7 @@ class flat_set
    typedef typename BOOST_CONTAINER_IMPDEF(base_t::const_iterator)                     const_iterator;
    typedef typename BOOST_CONTAINER_IMPDEF(base_t::reverse_iterator)                   reverse_iterator;
    typedef typename BOOST_CONTAINER_IMPDEF(base_t::const_reverse_iterator)             const_reverse_iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::sequence_type)                      sequence_type;
 
    public:
    //////////////////////////////////////////////
@@ -405,6 +407,7 @@ class flat_set
 
    //! <b>Effects</b>: Number of elements for which memory has been allocated.
    //!   capacity() is always greater than or equal to size().
+   //!   It's equal to size() if the elements are stored in a deque.
    //!
    //! <b>Throws</b>: Nothing.
    //!
@@ -415,6 +418,7 @@ class flat_set
    //!   effect. Otherwise, it is a request for allocation of additional memory.
    //!   If the request is successful, then capacity() is greater than or equal to
    //!   n; otherwise, capacity() is unchanged. In either case, size() is unchanged.
+   //!   It has no effect if the elements are stored in a deque.
    //!
    //! <b>Throws</b>: If memory allocation allocation throws or Key's copy constructor throws.
    //!
@@ -430,6 +434,19 @@ class flat_set
    //! <b>Complexity</b>: Linear to size().
    void shrink_to_fit();
 
+   //! <b>Effects</b>: If the container was configured with search_index<true>,
+   //!   (re)builds the search index so that subsequent lookups use it.
+   //!   Otherwise does nothing.
+   //!
+   //! <b>Throws</b>: If memory allocation throws, or Key's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to size().
+   //!
+   //! <b>Note</b>: The index is invalidated by the insertion or erasure of single
+   //!   elements. Range construction, range insertion and adopt_sequence() rebuild it.
+   //!   Lookups never rebuild it, so they can be called concurrently.
+   void rebuild_index();
+
    #endif   //   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
 
    //////////////////////////////////////////////
@@ -554,8 +571,8 @@ class flat_set
    //! <b>Effects</b>: inserts each element from the range [first,last) if and only
    //!   if there is no element with key equivalent to the key of that element.
    //!
-   //! <b>Complexity</b>: At most N log(size()+N) (N is the distance from first to last)
-   //!   search time plus N*size() insertion time.
+   //! <b>Complexity</b>: N log(N) comparisons to sort the new elements (N is the distance from first to last)
+   //!   plus a linear merge with the existing elements (linear if the range is already sorted).
    //!
    //! <b>Note</b>: If an element is inserted it might invalidate elements.
    template <class InputIterator>
@@ -581,8 +598,8 @@ class flat_set
    //! <b>Effects</b>: inserts each element from the range [il.begin(), il.end()) if and only
    //!   if there is no element with key equivalent to the key of that element.
    //!
-   //! <b>Complexity</b>: At most N log(size()+N) (N is the distance from il.begin() to il.end())
-   //!   search time plus N*size() insertion time.
+   //! <b>Complexity</b>: N log(N) comparisons to sort the new elements (N is il.size())
+   //!   plus a linear merge with the existing elements (linear if the range is already sorted).
    //!
    //! <b>Note</b>: If an element is inserted it might invalidate elements.
    void insert(std::initializer_list<value_type> il)
@@ -602,6 +619,88 @@ class flat_set
    {  this->base_t::insert_unique(ordered_unique_range, il.begin(), il.end()); }
 #endif
 
+   //! <b>Effects</b>: Extracts the internal sequence container.
+   //!
+   //! <b>Complexity</b>: Same as the move constructor of sequence_type, usually constant.
+   //!
+   //! <b>Postcondition</b>: this->empty()
+   //!
+   //! <b>Throws</b>: If sequence_type's move constructor throws
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   sequence_type extract_sequence()
+   {  return this->base_t::extract_sequence();  }
+
+   //! <b>Effects</b>: Discards the internally hold sequence container and adopts the
+   //!   one passed externally using the move assignment. Erases non-unique elements:
+   //!   if several elements are equivalent, the first one is kept.
+   //!
+   //! <b>Complexity</b>: Assuming O(1) move assignment, O(NlogN) with N = seq.size(),
+   //!   linear if seq is already sorted.
+   //!
+   //! <b>Throws</b>: If the comparison or the move constructor throws. In that case *this
+   //!   is left unchanged.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void adopt_sequence(BOOST_RV_REF(sequence_type) seq)
+   {  this->base_t::adopt_sequence_unique(boost::move(seq));  }
+
+   //! <b>Requires</b>: seq shall be ordered according to this->compare()
+   //!   and shall contain unique elements. This precondition is checked
+   //!   with an assertion.
+   //!
+   //! <b>Effects</b>: Discards the internally hold sequence container and adopts the
+   //!   one passed externally using the move assignment.
+   //!
+   //! <b>Complexity</b>: Assuming O(1) move assignment, O(1)
+   //!
+   //! <b>Throws</b>: If the move assignment throws
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void adopt_sequence(ordered_unique_range_t, BOOST_RV_REF(sequence_type) seq)
+   {  this->base_t::adopt_sequence_unique(ordered_unique_range, boost::move(seq));  }
+
+   //! <b>Effects</b>: Inserts a copy of each element of x whose key is not
+   //!   present in *this, leaving *this as the union of both containers.
+   //!
+   //! <b>Complexity</b>: O(M log(N/M + 1)) comparisons plus a linear merge of the new
+   //!   elements, where M is x.size() and N is size(). Searches gallop from the
+   //!   previous result.
+   //!
+   //! <b>Throws</b>: If the comparison, the copy constructor, the move constructor or
+   //!   the move assignment throws. *this is unchanged if the comparison or the copy
+   //!   constructor throws.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void merge_union(const flat_set& x)
+   {  this->base_t::merge_union_unique(x);  }
+
+   //! <b>Effects</b>: Erases the elements of *this whose keys are not present in x,
+   //!   leaving *this as the intersection of both containers.
+   //!
+   //! <b>Complexity</b>: O(M log(N/M + 1)) comparisons, where M is the size of the smaller
+   //!   container and N the size of the larger one, plus at most size() move assignments.
+   //!   Both sequences are walked in order and searches gallop from the previous result.
+   //!
+   //! <b>Throws</b>: If the comparison or the move assignment throws.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void intersect_with(const flat_set& x)
+   {  this->base_t::intersect_with_unique(x);  }
+
+   //! <b>Effects</b>: Erases the elements of *this whose keys are present in x,
+   //!   leaving *this as the difference of both containers.
+   //!
+   //! <b>Complexity</b>: O(M log(N/M + 1)) comparisons, where M is the size of the smaller
+   //!   container and N the size of the larger one, plus at most size() move assignments.
+   //!   Both sequences are walked in order and searches gallop from the previous result.
+   //!
+   //! <b>Throws</b>: If the comparison or the move assignment throws.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void subtract(const flat_set& x)
+   {  this->base_t::subtract_unique(x);  }
+
    #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
 
    //! <b>Effects</b>: Erases the element pointed to by p.
@@ -668,12 +767,61 @@ class flat_set
    //! <b>Complexity</b>: Logarithmic.
    iterator find(const key_type& x);
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: An iterator pointing to an element with the key
+   //!   equivalent to x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      find(const K& x);
+
    //! <b>Returns</b>: A const_iterator pointing to an element with the key
    //!   equivalent to x, or end() if such an element is not found.
    //!
    //! <b>Complexity</b>: Logarithmic.
    const_iterator find(const key_type& x) const;
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: A const_iterator pointing to an element with the key
+   //!   equivalent to x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      find(const K& x) const;
+
+   //! <b>Requires</b>: KeyForwardIterator is a forward iterator whose elements
+   //!   can be looked up with find().
+   //!
+   //! <b>Effects</b>: For each key k in [first, last), in order, writes find(k) to out.
+   //!   The searches of several keys are interleaved and the memory they will touch
+   //!   next is prefetched, so that their cache misses overlap instead of being
+   //!   serviced one at a time.
+   //!
+   //! <b>Returns</b>: The output iterator past the last written iterator.
+   //!
+   //! <b>Complexity</b>: N*log(size()), where N is the distance between first and last.
+   template<class KeyForwardIterator, class OutputIterator>
+   OutputIterator find_batch(KeyForwardIterator first, KeyForwardIterator last, OutputIterator out);
+
+   //! <b>Requires</b>: KeyForwardIterator is a forward iterator whose elements
+   //!   can be looked up with find().
+   //!
+   //! <b>Effects</b>: For each key k in [first, last), in order, writes find(k) to out,
+   //!   a const_iterator. The searches of several keys are interleaved and the memory
+   //!   they will touch next is prefetched.
+   //!
+   //! <b>Returns</b>: The output iterator past the last written iterator.
+   //!
+   //! <b>Complexity</b>: N*log(size()), where N is the distance between first and last.
+   template<class KeyForwardIterator, class OutputIterator>
+   OutputIterator find_batch(KeyForwardIterator first, KeyForwardIterator last, OutputIterator out) const;
+
    //! <b>Requires</b>: size() >= n.
    //!
    //! <b>Effects</b>: Returns an iterator to the nth element
@@ -733,6 +881,17 @@ class flat_set
    size_type count(const key_type& x) const
    {  return static_cast<size_type>(this->base_t::find(x) != this->base_t::cend());  }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: The number of elements with key equivalent to x.
+   //!
+   //! <b>Complexity</b>: log(size())+count(k)
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, size_type>::type
+      count(const K& x) const
+   {  return static_cast<size_type>(this->base_t::find(x) != this->base_t::cend());  }
+
    #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
    //! <b>Returns</b>: An iterator pointing to the first element with key not less
    //!   than k, or a.end() if such an element is not found.
@@ -740,24 +899,68 @@ class flat_set
    //! <b>Complexity</b>: Logarithmic
    iterator lower_bound(const key_type& x);
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the first element with key not less
+   //!   than k, or a.end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      lower_bound(const K& x);
+
    //! <b>Returns</b>: A const iterator pointing to the first element with key not
    //!   less than k, or a.end() if such an element is not found.
    //!
    //! <b>Complexity</b>: Logarithmic
    const_iterator lower_bound(const key_type& x) const;
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: A const iterator pointing to the first element with key not
+   //!   less than k, or a.end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      lower_bound(const K& x) const;
+
    //! <b>Returns</b>: An iterator pointing to the first element with key not less
    //!   than x, or end() if such an element is not found.
    //!
    //! <b>Complexity</b>: Logarithmic
    iterator upper_bound(const key_type& x);
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the first element with key not less
+   //!   than x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      upper_bound(const K& x);
+
    //! <b>Returns</b>: A const iterator pointing to the first element with key not
    //!   less than x, or end() if such an element is not found.
    //!
    //! <b>Complexity</b>: Logarithmic
    const_iterator upper_bound(const key_type& x) const;
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: A const iterator pointing to the first element with key not
+   //!   less than x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      upper_bound(const K& x) const;
+
    #endif   //   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
 
    //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
@@ -766,12 +969,34 @@ class flat_set
    std::pair<const_iterator, const_iterator> equal_range(const key_type& x) const
    {  return this->base_t::lower_bound_range(x);  }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<const_iterator, const_iterator> >::type
+      equal_range(const K& x) const
+   {  return this->base_t::lower_bound_range(x);  }
+
    //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
    //!
    //! <b>Complexity</b>: Logarithmic
    std::pair<iterator,iterator> equal_range(const key_type& x)
    {  return this->base_t::lower_bound_range(x);  }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<iterator,iterator> >::type
+      equal_range(const K& x)
+   {  return this->base_t::lower_bound_range(x);  }
+
    #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
 
    //! <b>Effects</b>: Returns true if x and y are equal
@@ -784,6 +1009,11 @@ class flat_set
    //! <b>Complexity</b>: Linear to the number of elements in the container.
    friend bool operator!=(const flat_set& x, const flat_set& y);
 
+   //! <b>Effects</b>: Returns the hash value of x. Equal containers have equal hash values.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend std::size_t hash_value(const flat_set& x);
+
    //! <b>Effects</b>: Returns true if x is less than y
    //!
    //! <b>Complexity</b>: Linear to the number of elements in the container.
@@ -829,8 +1059,8 @@ class flat_set
 
 //!has_trivial_destructor_after_move<> == true_type
 //!specialization for optimizations
-template <class Key, class Compare, class Allocator>
-struct has_trivial_destructor_after_move<boost::container::flat_set<Key, Compare, Allocator> >
+template <class Key, class Compare, class Allocator, class Options>
+struct has_trivial_destructor_after_move<boost::container::flat_set<Key, Compare, Allocator, Options> >
 {
    typedef typename ::boost::container::allocator_traits<Allocator>::pointer pointer;
    static const bool value = ::boost::has_trivial_destructor_after_move<Allocator>::value &&
@@ -858,20 +1088,21 @@ namespace container {
 //! \tparam Key is the type to be inserted in the multiset, which is also the key_type
 //! \tparam Compare is the comparison functor used to order keys
 //! \tparam Allocator is the allocator to be used to allocate memory for this container
+//! \tparam Options is a packed option type generated using boost::container::flat_assoc_options.
 #ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
-template <class Key, class Compare = std::less<Key>, class Allocator = new_allocator<Key> >
+template <class Key, class Compare = std::less<Key>, class Allocator = new_allocator<Key>, class Options = flat_assoc_defaults >
 #else
-template <class Key, class Compare, class Allocator>
+template <class Key, class Compare, class Allocator, class Options>
 #endif
 class flat_multiset
    ///@cond
-   : public container_detail::flat_tree<Key, Key, container_detail::identity<Key>, Compare, Allocator>
+   : public container_detail::flat_tree<Key, Key, container_detail::identity<Key>, Compare, Allocator, Options>
    ///@endcond
 {
    #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
    private:
    BOOST_COPYABLE_AND_MOVABLE(flat_multiset)
-   typedef container_detail::flat_tree<Key, Key, container_detail::identity<Key>, Compare, Allocator> base_t;
+   typedef container_detail::flat_tree<Key, Key, container_detail::identity<Key>, Compare, Allocator, Options> base_t;
    #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
 
    public:
@@ -897,6 +1128,7 @@ class flat_multiset
    typedef typename BOOST_CONTAINER_IMPDEF(base_t::const_iterator)                     const_iterator;
    typedef typename BOOST_CONTAINER_IMPDEF(base_t::reverse_iterator)                   reverse_iterator;
    typedef typename BOOST_CONTAINER_IMPDEF(base_t::const_reverse_iterator)             const_reverse_iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::sequence_type)                      sequence_type;
 
    //! @copydoc ::boost::container::flat_set::flat_set()
    explicit flat_multiset()
@@ -1068,6 +1300,9 @@ class flat_multiset
    //! @copydoc ::boost::container::flat_set::shrink_to_fit()
    void shrink_to_fit();
 
+   //! @copydoc ::boost::container::flat_set::rebuild_index()
+   void rebuild_index();
+
    #endif   //   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
 
    //////////////////////////////////////////////
@@ -1175,8 +1410,8 @@ class flat_multiset
    //!
    //! <b>Effects</b>: inserts each element from the range [first,last) .
    //!
-   //! <b>Complexity</b>: At most N log(size()+N) (N is the distance from first to last)
-   //!   search time plus N*size() insertion time.
+   //! <b>Complexity</b>: N log(N) comparisons to sort the new elements (N is the distance from first to last)
+   //!   plus a linear merge with the existing elements (linear if the range is already sorted).
    //!
    //! <b>Note</b>: If an element is inserted it might invalidate elements.
    template <class InputIterator>
@@ -1200,8 +1435,8 @@ class flat_multiset
 #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
    //! <b>Effects</b>: inserts each element from the range [il.begin(), il.end()).
    //!
-   //! <b>Complexity</b>: At most N log(size()+N) (N is the distance from first to last)
-   //!   search time plus N*size() insertion time.
+   //! <b>Complexity</b>: N log(N) comparisons to sort the new elements (N is il.size())
+   //!   plus a linear merge with the existing elements (linear if the range is already sorted).
    //!
    //! <b>Note</b>: If an element is inserted it might invalidate elements.
    void insert(std::initializer_list<value_type> il)
@@ -1220,6 +1455,38 @@ class flat_multiset
    {  this->base_t::insert_equal(ordered_range, il.begin(), il.end()); }
 #endif
 
+   //! @copydoc ::boost::container::flat_set::extract_sequence
+   sequence_type extract_sequence()
+   {  return this->base_t::extract_sequence();  }
+
+   //! <b>Effects</b>: Discards the internally hold sequence container and adopts the
+   //!   one passed externally using the move assignment. The order of equivalent
+   //!   elements is preserved.
+   //!
+   //! <b>Complexity</b>: Assuming O(1) move assignment, O(NlogN) with N = seq.size(),
+   //!   linear if seq is already sorted.
+   //!
+   //! <b>Throws</b>: If the comparison or the move constructor throws. In that case *this
+   //!   is left unchanged.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void adopt_sequence(BOOST_RV_REF(sequence_type) seq)
+   {  this->base_t::adopt_sequence_equal(boost::move(seq));  }
+
+   //! <b>Requires</b>: seq shall be ordered according to this->compare().
+   //!   This precondition is checked with an assertion.
+   //!
+   //! <b>Effects</b>: Discards the internally hold sequence container and adopts the
+   //!   one passed externally using the move assignment.
+   //!
+   //! <b>Complexity</b>: Assuming O(1) move assignment, O(1)
+   //!
+   //! <b>Throws</b>: If the move assignment throws
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void adopt_sequence(ordered_range_t, BOOST_RV_REF(sequence_type) seq)
+   {  this->base_t::adopt_sequence_equal(ordered_range, boost::move(seq));  }
+
    #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
 
    //! @copydoc ::boost::container::flat_set::erase(const_iterator)
@@ -1248,9 +1515,27 @@ class flat_multiset
    //! @copydoc ::boost::container::flat_set::find(const key_type& )
    iterator find(const key_type& x);
 
+   //! @copydoc ::boost::container::flat_set::find(const K& )
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      find(const K& x);
+
    //! @copydoc ::boost::container::flat_set::find(const key_type& ) const
    const_iterator find(const key_type& x) const;
 
+   //! @copydoc ::boost::container::flat_set::find(const K& ) const
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      find(const K& x) const;
+
+   //! @copydoc ::boost::container::flat_set::find_batch(KeyForwardIterator,KeyForwardIterator,OutputIterator)
+   template<class KeyForwardIterator, class OutputIterator>
+   OutputIterator find_batch(KeyForwardIterator first, KeyForwardIterator last, OutputIterator out);
+
+   //! @copydoc ::boost::container::flat_set::find_batch(KeyForwardIterator,KeyForwardIterator,OutputIterator) const
+   template<class KeyForwardIterator, class OutputIterator>
+   OutputIterator find_batch(KeyForwardIterator first, KeyForwardIterator last, OutputIterator out) const;
+
    //! @copydoc ::boost::container::flat_set::nth(size_type)
    iterator nth(size_type n) BOOST_NOEXCEPT_OR_NOTHROW;
 
@@ -1266,24 +1551,59 @@ class flat_multiset
    //! @copydoc ::boost::container::flat_set::count(const key_type& ) const
    size_type count(const key_type& x) const;
 
+   //! @copydoc ::boost::container::flat_set::count(const K& ) const
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, size_type>::type
+      count(const K& x) const;
+
    //! @copydoc ::boost::container::flat_set::lower_bound(const key_type& )
    iterator lower_bound(const key_type& x);
 
+   //! @copydoc ::boost::container::flat_set::lower_bound(const K& )
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      lower_bound(const K& x);
+
    //! @copydoc ::boost::container::flat_set::lower_bound(const key_type& ) const
    const_iterator lower_bound(const key_type& x) const;
 
+   //! @copydoc ::boost::container::flat_set::lower_bound(const K& ) const
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      lower_bound(const K& x) const;
+
    //! @copydoc ::boost::container::flat_set::upper_bound(const key_type& )
    iterator upper_bound(const key_type& x);
 
+   //! @copydoc ::boost::container::flat_set::upper_bound(const K& )
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      upper_bound(const K& x);
+
    //! @copydoc ::boost::container::flat_set::upper_bound(const key_type& ) const
    const_iterator upper_bound(const key_type& x) const;
 
+   //! @copydoc ::boost::container::flat_set::upper_bound(const K& ) const
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      upper_bound(const K& x) const;
+
    //! @copydoc ::boost::container::flat_set::equal_range(const key_type& ) const
    std::pair<const_iterator, const_iterator> equal_range(const key_type& x) const;
 
+   //! @copydoc ::boost::container::flat_set::equal_range(const K& ) const
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<const_iterator, const_iterator> >::type
+      equal_range(const K& x) const;
+
    //! @copydoc ::boost::container::flat_set::equal_range(const key_type& )
    std::pair<iterator,iterator> equal_range(const key_type& x);
 
+   //! @copydoc ::boost::container::flat_set::equal_range(const K& )
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<iterator,iterator> >::type
+      equal_range(const K& x);
+
    //! <b>Effects</b>: Returns true if x and y are equal
    //!
    //! <b>Complexity</b>: Linear to the number of elements in the container.
@@ -1294,6 +1614,11 @@ class flat_multiset
    //! <b>Complexity</b>: Linear to the number of elements in the container.
    friend bool operator!=(const flat_multiset& x, const flat_multiset& y);
 
+   //! <b>Effects</b>: Returns the hash value of x. Equal containers have equal hash values.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend std::size_t hash_value(const flat_multiset& x);
+
    //! <b>Effects</b>: Returns true if x is less than y
    //!
    //! <b>Complexity</b>: Linear to the number of elements in the container.
@@ -1339,8 +1664,8 @@ class flat_multiset
 
 //!has_trivial_destructor_after_move<> == true_type
 //!specialization for optimizations
-template <class Key, class Compare, class Allocator>
-struct has_trivial_destructor_after_move<boost::container::flat_multiset<Key, Compare, Allocator> >
+template <class Key, class Compare, class Allocator, class Options>
+struct has_trivial_destructor_after_move<boost::container::flat_multiset<Key, Compare, Allocator, Options> >
 {
    typedef typename ::boost::container::allocator_traits<Allocator>::pointer pointer;
    static const bool value = ::boost::has_trivial_destructor_after_move<Allocator>::value &&
@@ -1354,6 +1679,30 @@ namespace container {
 
 }}
 
+#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+namespace std {
+
+//!std::hash specialization, equivalent to boost::hash
+template <class Key, class Compare, class Allocator, class Options>
+struct hash< ::boost::container::flat_set<Key, Compare, Allocator, Options> >
+{
+   std::size_t operator()(const ::boost::container::flat_set<Key, Compare, Allocator, Options> &x) const
+   {  return ::boost::hash< ::boost::container::flat_set<Key, Compare, Allocator, Options> >()(x);  }
+};
+
+//!std::hash specialization, equivalent to boost::hash
+template <class Key, class Compare, class Allocator, class Options>
+struct hash< ::boost::container::flat_multiset<Key, Compare, Allocator, Options> >
+{
+   std::size_t operator()(const ::boost::container::flat_multiset<Key, Compare, Allocator, Options> &x) const
+   {  return ::boost::hash< ::boost::container::flat_multiset<Key, Compare, Allocator, Options> >()(x);  }
+};
+
+}  //namespace std {
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
 #include <boost/container/detail/config_end.hpp>
 
 #endif   // BOOST_CONTAINER_FLAT_SET_HPP
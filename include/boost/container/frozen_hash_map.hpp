@@ -0,0 +1,380 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_FROZEN_HASH_MAP_HPP
+#define BOOST_CONTAINER_FROZEN_HASH_MAP_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/new_allocator.hpp> //new_allocator
+#include <boost/container/throw_exception.hpp>
+// container/detail
+#include <boost/container/detail/frozen_hash_table.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/type_traits.hpp>
+// move
+#include <boost/move/traits.hpp>
+#include <boost/move/utility_core.hpp>
+// intrusive/detail
+#include <boost/intrusive/detail/minimal_pair_header.hpp>      //pair
+#include <boost/intrusive/detail/minimal_less_equal_header.hpp>//equal_to
+// other
+#include <boost/functional/hash.hpp>
+#include <boost/static_assert.hpp>
+// std
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+#include <initializer_list>
+#endif
+
+namespace boost {
+namespace container {
+
+#ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! frozen_hash_map is an immutable unordered associative container that supports unique keys
+//! and provides for fast retrieval of values of another type T based on the keys. It is built
+//! once, from a range or from a flat_map, and can't be modified afterwards.
+//!
+//! Like frozen_hash_set, a minimal perfect hash function is computed for the keys on
+//! construction, so a lookup hashes the key once and compares it against a single element.
+//! Elements and the seeds of the hash function (about two bytes per element) are stored in
+//! a single contiguous allocation. Construction is slower than building a flat_map, so
+//! frozen_hash_map is meant for read-mostly tables built once and queried many times.
+//!
+//! Like flat_map, the <code>value_type</code> is std::pair<Key, T>.
+//!
+//! \tparam Key is the key_type of the map
+//! \tparam T is the <code>mapped_type</code>
+//! \tparam Hash is the hash function used to compute the hash value of keys. Different
+//!   keys may have the same hash value, but looking them up needs additional key comparisons.
+//! \tparam Pred is the equality predicate used to compare keys
+//! \tparam Allocator is the allocator to allocate the <code>value_type</code>s
+//!   (e.g. <i>allocator< std::pair<Key, T> > </i>).
+template < class Key, class T, class Hash = boost::hash<Key>, class Pred = std::equal_to<Key>
+         , class Allocator = new_allocator< std::pair< Key, T> > >
+#else
+template <class Key, class T, class Hash, class Pred, class Allocator>
+#endif
+class frozen_hash_map
+   ///@cond
+   : public container_detail::frozen_hash_table
+      < Key, std::pair<Key, T>
+      , container_detail::select1st< std::pair<Key, T> >
+      , Hash, Pred, Allocator>
+   ///@endcond
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   BOOST_COPYABLE_AND_MOVABLE(frozen_hash_map)
+
+   typedef std::pair<Key, T>  value_type_impl;
+   typedef container_detail::frozen_hash_table
+      <Key, value_type_impl, container_detail::select1st<value_type_impl>, Hash, Pred, Allocator> base_t;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //                    types
+   //
+   //////////////////////////////////////////////
+
+   typedef Key                                                                      key_type;
+   typedef ::boost::container::allocator_traits<Allocator>                          allocator_traits_type;
+   typedef T                                                                        mapped_type;
+   typedef std::pair<Key, T>                                                        value_type;
+   typedef Hash                                                                     hasher;
+   typedef Pred                                                                     key_equal;
+   typedef typename boost::container::allocator_traits<Allocator>::pointer          pointer;
+   typedef typename boost::container::allocator_traits<Allocator>::const_pointer    const_pointer;
+   typedef typename boost::container::allocator_traits<Allocator>::reference        reference;
+   typedef typename boost::container::allocator_traits<Allocator>::const_reference  const_reference;
+   typedef typename boost::container::allocator_traits<Allocator>::size_type        size_type;
+   typedef typename boost::container::allocator_traits<Allocator>::difference_type  difference_type;
+   typedef Allocator                                                                allocator_type;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::stored_allocator_type)           stored_allocator_type;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::iterator)                        iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::const_iterator)                  const_iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::movable_value_type)              movable_value_type;
+
+   //////////////////////////////////////////////
+   //
+   //          construct/copy/destroy
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Default constructs an empty frozen_hash_map. No memory is allocated.
+   //!
+   //! <b>Complexity</b>: Constant.
+   frozen_hash_map()
+      : base_t()
+   {
+      //A type must be std::pair<Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! <b>Effects</b>: Constructs an empty frozen_hash_map using the specified allocator.
+   //!
+   //! <b>Complexity</b>: Constant.
+   explicit frozen_hash_map(const allocator_type& a)
+      : base_t(a)
+   {
+      //A type must be std::pair<Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! <b>Effects</b>: Constructs a frozen_hash_map using the specified hash function,
+   //!   equality predicate and allocator, holding the elements of the range [first ,last ).
+   //!   If several elements have equivalent keys only the first one is kept.
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is last - first.
+   template <class InputIterator>
+   frozen_hash_map(InputIterator first, InputIterator last, const hasher& hf = hasher(),
+                   const key_equal& eql = key_equal(), const allocator_type& a = allocator_type())
+      : base_t(false, first, last, hf, eql, a)
+   {
+      //A type must be std::pair<Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! <b>Effects</b>: Constructs a frozen_hash_map using the specified allocator,
+   //!   holding the elements of the range [first ,last ).
+   //!   If several elements have equivalent keys only the first one is kept.
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is last - first.
+   template <class InputIterator>
+   frozen_hash_map(InputIterator first, InputIterator last, const allocator_type& a)
+      : base_t(false, first, last, hasher(), key_equal(), a)
+   {
+      //A type must be std::pair<Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! <b>Effects</b>: Constructs a frozen_hash_map using the specified hash function,
+   //!   equality predicate and allocator, holding the elements of the range [first ,last ).
+   //!   This function is more efficient than the normal range constructor as keys are
+   //!   not compared during construction.
+   //!
+   //! <b>Requires</b>: [first ,last) must not contain equivalent keys (e.g. it is the range
+   //!   of a map or a flat_map).
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is last - first.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   template <class InputIterator>
+   frozen_hash_map(ordered_unique_range_t, InputIterator first, InputIterator last, const hasher& hf = hasher(),
+                   const key_equal& eql = key_equal(), const allocator_type& a = allocator_type())
+      : base_t(true, first, last, hf, eql, a)
+   {
+      //A type must be std::pair<Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! <b>Effects</b>: Constructs a frozen_hash_map holding a copy of the elements of m using
+   //!   the specified hash function, equality predicate and allocator.
+   //!
+   //! <b>Complexity</b>: Average case linear in m.size().
+   template <class Compare, class MapAllocator, class MapOptions>
+   explicit frozen_hash_map(const flat_map<Key, T, Compare, MapAllocator, MapOptions> &m, const hasher& hf = hasher(),
+                            const key_equal& eql = key_equal(), const allocator_type& a = allocator_type())
+      : base_t(true, m.cbegin(), m.cend(), hf, eql, a)
+   {
+      //A type must be std::pair<Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<Key, T>, typename Allocator::value_type>::value));
+   }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Constructs a frozen_hash_map using the specified hash function,
+   //!   equality predicate and allocator, holding the elements of the range [il.begin(), il.end()).
+   //!   If several elements have equivalent keys only the first one is kept.
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is il.size().
+   frozen_hash_map(std::initializer_list<value_type> il, const hasher& hf = hasher(),
+                   const key_equal& eql = key_equal(), const allocator_type& a = allocator_type())
+      : base_t(false, il.begin(), il.end(), hf, eql, a)
+   {
+      //A type must be std::pair<Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<Key, T>, typename Allocator::value_type>::value));
+   }
+#endif
+
+   //! <b>Effects</b>: Copy constructs a frozen_hash_map. The layout of x is reproduced
+   //!   so no hash value is computed.
+   //!
+   //! <b>Complexity</b>: Linear in x.size().
+   frozen_hash_map(const frozen_hash_map& x)
+      : base_t(static_cast<const base_t&>(x))
+   {}
+
+   //! <b>Effects</b>: Move constructs a frozen_hash_map. Constructs *this using x's resources.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Postcondition</b>: x is emptied.
+   frozen_hash_map(BOOST_RV_REF(frozen_hash_map) x)
+      : base_t(BOOST_MOVE_BASE(base_t, x))
+   {}
+
+   //! <b>Effects</b>: Copy constructs a frozen_hash_map using the specified allocator.
+   //!
+   //! <b>Complexity</b>: Linear in x.size().
+   frozen_hash_map(const frozen_hash_map& x, const allocator_type &a)
+      : base_t(static_cast<const base_t&>(x), a)
+   {}
+
+   //! <b>Effects</b>: Move constructs a frozen_hash_map using the specified allocator.
+   //!                 Constructs *this using x's resources.
+   //!
+   //! <b>Complexity</b>: Constant if a == x.get_allocator(), linear otherwise.
+   frozen_hash_map(BOOST_RV_REF(frozen_hash_map) x, const allocator_type &a)
+      : base_t(BOOST_MOVE_BASE(base_t, x), a)
+   {}
+
+   //! <b>Effects</b>: Makes *this a copy of x.
+   //!
+   //! <b>Complexity</b>: Linear in x.size().
+   frozen_hash_map& operator=(BOOST_COPY_ASSIGN_REF(frozen_hash_map) x)
+   {  return static_cast<frozen_hash_map&>(this->base_t::operator=(static_cast<const base_t&>(x)));  }
+
+   //! <b>Effects</b>: Move assignment. All x's values are transferred to *this.
+   //!
+   //! <b>Throws</b>: If allocator_traits_type::propagate_on_container_move_assignment
+   //!   is false and (allocation throws or value_type's move constructor throws)
+   //!
+   //! <b>Complexity</b>: Constant if allocator_traits_type::
+   //!   propagate_on_container_move_assignment is true or
+   //!   this->get>allocator() == x.get_allocator(). Linear otherwise.
+   frozen_hash_map& operator=(BOOST_RV_REF(frozen_hash_map) x)
+      BOOST_NOEXCEPT_IF(  allocator_traits_type::is_always_equal::value
+                                 && boost::container::container_detail::is_nothrow_move_assignable<Hash>::value
+                                 && boost::container::container_detail::is_nothrow_move_assignable<Pred>::value )
+   {  return static_cast<frozen_hash_map&>(this->base_t::operator=(BOOST_MOVE_BASE(base_t, x)));  }
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //! @copydoc ::boost::container::frozen_hash_set::get_allocator()
+   allocator_type get_allocator() const;
+
+   //! @copydoc ::boost::container::frozen_hash_set::get_stored_allocator() const
+   const stored_allocator_type &get_stored_allocator() const;
+
+   //! @copydoc ::boost::container::frozen_hash_set::begin() const
+   const_iterator begin() const;
+
+   //! @copydoc ::boost::container::frozen_hash_set::cbegin() const
+   const_iterator cbegin() const;
+
+   //! @copydoc ::boost::container::frozen_hash_set::end() const
+   const_iterator end() const;
+
+   //! @copydoc ::boost::container::frozen_hash_set::cend() const
+   const_iterator cend() const;
+
+   //! @copydoc ::boost::container::frozen_hash_set::empty() const
+   bool empty() const;
+
+   //! @copydoc ::boost::container::frozen_hash_set::size() const
+   size_type size() const;
+
+   //! @copydoc ::boost::container::frozen_hash_set::max_size() const
+   size_type max_size() const;
+
+   //! @copydoc ::boost::container::frozen_hash_set::bucket_count() const
+   size_type bucket_count() const;
+
+   //! @copydoc ::boost::container::frozen_hash_set::swap
+   void swap(frozen_hash_map& x)
+      BOOST_NOEXCEPT_IF(  allocator_traits_type::is_always_equal::value
+                                 && boost::container::container_detail::is_nothrow_swappable<Hash>::value
+                                 && boost::container::container_detail::is_nothrow_swappable<Pred>::value );
+
+   //! @copydoc ::boost::container::frozen_hash_set::hash_function
+   hasher hash_function() const;
+
+   //! @copydoc ::boost::container::frozen_hash_set::key_eq
+   key_equal key_eq() const;
+
+   //! @copydoc ::boost::container::frozen_hash_set::find(const key_type&) const
+   const_iterator find(const key_type& x) const;
+
+   //! @copydoc ::boost::container::frozen_hash_set::count(const key_type&) const
+   size_type count(const key_type& x) const;
+
+   //! @copydoc ::boost::container::frozen_hash_set::equal_range(const key_type&) const
+   std::pair<const_iterator, const_iterator> equal_range(const key_type& x) const;
+
+   //! <b>Effects</b>: Returns true if x and y contain the same elements.
+   //!
+   //! <b>Complexity</b>: Linear in x.size().
+   friend bool operator==(const frozen_hash_map& x, const frozen_hash_map& y);
+
+   //! <b>Effects</b>: Returns true if x and y are unequal
+   //!
+   //! <b>Complexity</b>: Linear in x.size().
+   friend bool operator!=(const frozen_hash_map& x, const frozen_hash_map& y);
+
+   //! <b>Effects</b>: Returns the hash value of x. Equal containers have equal hash values.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend std::size_t hash_value(const frozen_hash_map& x);
+
+   //! <b>Effects</b>: x.swap(y)
+   //!
+   //! <b>Complexity</b>: Constant.
+   friend void swap(frozen_hash_map& x, frozen_hash_map& y);
+
+   #endif   //#if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   //! Returns: A reference to the mapped value of the element whose key is equivalent to k.
+   //!
+   //! Throws: An exception object of type out_of_range if no such element is present.
+   //!
+   //! Complexity: Constant.
+   const T& at(const key_type& k) const
+   {
+      const_iterator i = this->find(k);
+      if(i == this->cend()){
+         throw_out_of_range("frozen_hash_map::at key not found");
+      }
+      return i->second;
+   }
+};
+
+}}
+
+#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+namespace std {
+
+//!std::hash specialization, equivalent to boost::hash
+template <class Key, class T, class Hash, class Pred, class Allocator>
+struct hash< ::boost::container::frozen_hash_map<Key, T, Hash, Pred, Allocator> >
+{
+   std::size_t operator()(const ::boost::container::frozen_hash_map<Key, T, Hash, Pred, Allocator> &x) const
+   {  return ::boost::hash< ::boost::container::frozen_hash_map<Key, T, Hash, Pred, Allocator> >()(x);  }
+};
+
+}  //namespace std {
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   // BOOST_CONTAINER_FROZEN_HASH_MAP_HPP
@@ -0,0 +1,394 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_FROZEN_HASH_SET_HPP
+#define BOOST_CONTAINER_FROZEN_HASH_SET_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/new_allocator.hpp> //new_allocator
+// container/detail
+#include <boost/container/detail/frozen_hash_table.hpp>
+#include <boost/container/detail/mpl.hpp>
+// move
+#include <boost/move/traits.hpp>
+#include <boost/move/utility_core.hpp>
+// intrusive/detail
+#include <boost/intrusive/detail/minimal_pair_header.hpp>      //pair
+#include <boost/intrusive/detail/minimal_less_equal_header.hpp>//equal_to
+// other
+#include <boost/functional/hash.hpp>
+// std
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+#include <initializer_list>
+#endif
+
+namespace boost {
+namespace container {
+
+#ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! frozen_hash_set is an immutable unordered associative container that supports unique keys.
+//! It is built once, from a range or from a flat_set, and can't be modified afterwards.
+//!
+//! On construction a minimal perfect hash function is computed for the keys (using the
+//! "hash and displace" scheme): keys are grouped in small buckets and a seed
+//! is searched for each bucket so that every key gets its own slot in an array of
+//! exactly size() elements. A lookup computes the hash value of the key once, reads the
+//! seed of its bucket and compares the key against a single element. Elements and seeds
+//! (about two bytes per element) are stored in a single contiguous allocation.
+//!
+//! Construction takes linear time on average but is slower than building a flat_set,
+//! so frozen_hash_set is meant for read-mostly tables built once and queried many times.
+//! Iteration order is unspecified.
+//!
+//! \tparam Key is the type to be inserted in the set, which is also the key_type
+//! \tparam Hash is the hash function used to compute the hash value of keys. Different
+//!   keys may have the same hash value, but looking them up needs additional key comparisons.
+//! \tparam Pred is the equality predicate used to compare keys
+//! \tparam Allocator is the allocator to allocate the <code>value_type</code>s
+template < class Key, class Hash = boost::hash<Key>, class Pred = std::equal_to<Key>
+         , class Allocator = new_allocator<Key> >
+#else
+template <class Key, class Hash, class Pred, class Allocator>
+#endif
+class frozen_hash_set
+   ///@cond
+   : public container_detail::frozen_hash_table
+      < Key, Key, container_detail::identity<Key>, Hash, Pred, Allocator>
+   ///@endcond
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   BOOST_COPYABLE_AND_MOVABLE(frozen_hash_set)
+   typedef container_detail::frozen_hash_table
+      < Key, Key, container_detail::identity<Key>, Hash, Pred, Allocator> base_t;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //                    types
+   //
+   //////////////////////////////////////////////
+   typedef Key                                                                         key_type;
+   typedef Key                                                                         value_type;
+   typedef Hash                                                                        hasher;
+   typedef Pred                                                                        key_equal;
+   typedef ::boost::container::allocator_traits<Allocator>                             allocator_traits_type;
+   typedef typename ::boost::container::allocator_traits<Allocator>::pointer           pointer;
+   typedef typename ::boost::container::allocator_traits<Allocator>::const_pointer     const_pointer;
+   typedef typename ::boost::container::allocator_traits<Allocator>::reference         reference;
+   typedef typename ::boost::container::allocator_traits<Allocator>::const_reference   const_reference;
+   typedef typename ::boost::container::allocator_traits<Allocator>::size_type         size_type;
+   typedef typename ::boost::container::allocator_traits<Allocator>::difference_type   difference_type;
+   typedef Allocator                                                                   allocator_type;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::stored_allocator_type)              stored_allocator_type;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::iterator)                           iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::const_iterator)                     const_iterator;
+
+   //////////////////////////////////////////////
+   //
+   //          construct/copy/destroy
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Default constructs an empty frozen_hash_set. No memory is allocated.
+   //!
+   //! <b>Complexity</b>: Constant.
+   frozen_hash_set()
+      : base_t()
+   {}
+
+   //! <b>Effects</b>: Constructs an empty frozen_hash_set using the specified allocator.
+   //!
+   //! <b>Complexity</b>: Constant.
+   explicit frozen_hash_set(const allocator_type& a)
+      : base_t(a)
+   {}
+
+   //! <b>Effects</b>: Constructs a frozen_hash_set using the specified hash function,
+   //!   equality predicate and allocator, holding the elements of the range [first ,last ).
+   //!   If several elements have equivalent keys only the first one is kept.
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is last - first.
+   template <class InputIterator>
+   frozen_hash_set(InputIterator first, InputIterator last, const hasher& hf = hasher(),
+                   const key_equal& eql = key_equal(), const allocator_type& a = allocator_type())
+      : base_t(false, first, last, hf, eql, a)
+   {}
+
+   //! <b>Effects</b>: Constructs a frozen_hash_set using the specified allocator,
+   //!   holding the elements of the range [first ,last ).
+   //!   If several elements have equivalent keys only the first one is kept.
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is last - first.
+   template <class InputIterator>
+   frozen_hash_set(InputIterator first, InputIterator last, const allocator_type& a)
+      : base_t(false, first, last, hasher(), key_equal(), a)
+   {}
+
+   //! <b>Effects</b>: Constructs a frozen_hash_set using the specified hash function,
+   //!   equality predicate and allocator, holding the elements of the range [first ,last ).
+   //!   This function is more efficient than the normal range constructor as keys are
+   //!   not compared during construction.
+   //!
+   //! <b>Requires</b>: [first ,last) must not contain equivalent keys (e.g. it is the range
+   //!   of a set or a flat_set).
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is last - first.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   template <class InputIterator>
+   frozen_hash_set(ordered_unique_range_t, InputIterator first, InputIterator last, const hasher& hf = hasher(),
+                   const key_equal& eql = key_equal(), const allocator_type& a = allocator_type())
+      : base_t(true, first, last, hf, eql, a)
+   {}
+
+   //! <b>Effects</b>: Constructs a frozen_hash_set holding a copy of the elements of s using
+   //!   the specified hash function, equality predicate and allocator.
+   //!
+   //! <b>Complexity</b>: Average case linear in s.size().
+   template <class Compare, class SetAllocator, class SetOptions>
+   explicit frozen_hash_set(const flat_set<Key, Compare, SetAllocator, SetOptions> &s, const hasher& hf = hasher(),
+                            const key_equal& eql = key_equal(), const allocator_type& a = allocator_type())
+      : base_t(true, s.cbegin(), s.cend(), hf, eql, a)
+   {}
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Constructs a frozen_hash_set using the specified hash function,
+   //!   equality predicate and allocator, holding the elements of the range [il.begin(), il.end()).
+   //!   If several elements have equivalent keys only the first one is kept.
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is il.size().
+   frozen_hash_set(std::initializer_list<value_type> il, const hasher& hf = hasher(),
+                   const key_equal& eql = key_equal(), const allocator_type& a = allocator_type())
+      : base_t(false, il.begin(), il.end(), hf, eql, a)
+   {}
+#endif
+
+   //! <b>Effects</b>: Copy constructs a frozen_hash_set. The layout of x is reproduced
+   //!   so no hash value is computed.
+   //!
+   //! <b>Complexity</b>: Linear in x.size().
+   frozen_hash_set(const frozen_hash_set& x)
+      : base_t(static_cast<const base_t&>(x))
+   {}
+
+   //! <b>Effects</b>: Move constructs a frozen_hash_set. Constructs *this using x's resources.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Postcondition</b>: x is emptied.
+   frozen_hash_set(BOOST_RV_REF(frozen_hash_set) x)
+      : base_t(BOOST_MOVE_BASE(base_t, x))
+   {}
+
+   //! <b>Effects</b>: Copy constructs a frozen_hash_set using the specified allocator.
+   //!
+   //! <b>Complexity</b>: Linear in x.size().
+   frozen_hash_set(const frozen_hash_set& x, const allocator_type &a)
+      : base_t(static_cast<const base_t&>(x), a)
+   {}
+
+   //! <b>Effects</b>: Move constructs a frozen_hash_set using the specified allocator.
+   //!                 Constructs *this using x's resources.
+   //!
+   //! <b>Complexity</b>: Constant if a == x.get_allocator(), linear otherwise.
+   frozen_hash_set(BOOST_RV_REF(frozen_hash_set) x, const allocator_type &a)
+      : base_t(BOOST_MOVE_BASE(base_t, x), a)
+   {}
+
+   //! <b>Effects</b>: Makes *this a copy of x.
+   //!
+   //! <b>Complexity</b>: Linear in x.size().
+   frozen_hash_set& operator=(BOOST_COPY_ASSIGN_REF(frozen_hash_set) x)
+   {  return static_cast<frozen_hash_set&>(this->base_t::operator=(static_cast<const base_t&>(x)));  }
+
+   //! <b>Effects</b>: Move assignment. All x's values are transferred to *this.
+   //!
+   //! <b>Throws</b>: If allocator_traits_type::propagate_on_container_move_assignment
+   //!   is false and (allocation throws or value_type's move constructor throws)
+   //!
+   //! <b>Complexity</b>: Constant if allocator_traits_type::
+   //!   propagate_on_container_move_assignment is true or
+   //!   this->get>allocator() == x.get_allocator(). Linear otherwise.
+   frozen_hash_set& operator=(BOOST_RV_REF(frozen_hash_set) x)
+      BOOST_NOEXCEPT_IF(  allocator_traits_type::is_always_equal::value
+                                 && boost::container::container_detail::is_nothrow_move_assignable<Hash>::value
+                                 && boost::container::container_detail::is_nothrow_move_assignable<Pred>::value )
+   {  return static_cast<frozen_hash_set&>(this->base_t::operator=(BOOST_MOVE_BASE(base_t, x)));  }
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   //! <b>Effects</b>: Returns a copy of the allocator that
+   //!   was passed to the object's constructor.
+   //!
+   //! <b>Complexity</b>: Constant.
+   allocator_type get_allocator() const;
+
+   //! <b>Effects</b>: Returns a reference to the internal allocator.
+   //!
+   //! <b>Throws</b>: Nothing
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   const stored_allocator_type &get_stored_allocator() const;
+
+   //! <b>Effects</b>: Returns a const_iterator to the first element contained in the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator begin() const;
+
+   //! <b>Effects</b>: Returns a const_iterator to the first element contained in the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator cbegin() const;
+
+   //! <b>Effects</b>: Returns a const_iterator to the end of the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator end() const;
+
+   //! <b>Effects</b>: Returns a const_iterator to the end of the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator cend() const;
+
+   //! <b>Effects</b>: Returns true if the container contains no elements.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   bool empty() const;
+
+   //! <b>Effects</b>: Returns the number of the elements contained in the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type size() const;
+
+   //! <b>Effects</b>: Returns the largest possible size of the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type max_size() const;
+
+   //! <b>Effects</b>: Returns the number of buckets of the perfect hash function,
+   //!   each one holds a seed of four bytes.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type bucket_count() const;
+
+   //! <b>Effects</b>: Swaps the contents of *this and x.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   void swap(frozen_hash_set& x)
+      BOOST_NOEXCEPT_IF(  allocator_traits_type::is_always_equal::value
+                                 && boost::container::container_detail::is_nothrow_swappable<Hash>::value
+                                 && boost::container::container_detail::is_nothrow_swappable<Pred>::value );
+
+   //! <b>Effects</b>: Returns the hash function object.
+   //!
+   //! <b>Complexity</b>: Constant.
+   hasher hash_function() const;
+
+   //! <b>Effects</b>: Returns the key equality predicate object.
+   //!
+   //! <b>Complexity</b>: Constant.
+   key_equal key_eq() const;
+
+   //! <b>Returns</b>: A const_iterator pointing to an element with the key
+   //!   equivalent to x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Constant: the key is hashed once and compared against a single element.
+   const_iterator find(const key_type& x) const;
+
+   //! <b>Returns</b>: The number of elements with key equivalent to x.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type count(const key_type& x) const;
+
+   //! <b>Effects</b>: Equivalent to std::make_pair(this->find(x), ++this->find(x)) if
+   //!   the element is found, std::make_pair(this->end(), this->end()) otherwise.
+   //!
+   //! <b>Complexity</b>: Constant.
+   std::pair<const_iterator, const_iterator> equal_range(const key_type& x) const;
+
+   //! <b>Effects</b>: Returns true if x and y contain the same elements.
+   //!
+   //! <b>Complexity</b>: Linear in x.size().
+   friend bool operator==(const frozen_hash_set& x, const frozen_hash_set& y);
+
+   //! <b>Effects</b>: Returns true if x and y are unequal
+   //!
+   //! <b>Complexity</b>: Linear in x.size().
+   friend bool operator!=(const frozen_hash_set& x, const frozen_hash_set& y);
+
+   //! <b>Effects</b>: Returns the hash value of x. Equal containers have equal hash values.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend std::size_t hash_value(const frozen_hash_set& x);
+
+   //! <b>Effects</b>: x.swap(y)
+   //!
+   //! <b>Complexity</b>: Constant.
+   friend void swap(frozen_hash_set& x, frozen_hash_set& y);
+
+   #endif   //#if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+};
+
+}}
+
+#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+namespace std {
+
+//!std::hash specialization, equivalent to boost::hash
+template <class Key, class Hash, class Pred, class Allocator>
+struct hash< ::boost::container::frozen_hash_set<Key, Hash, Pred, Allocator> >
+{
+   std::size_t operator()(const ::boost::container::frozen_hash_set<Key, Hash, Pred, Allocator> &x) const
+   {  return ::boost::hash< ::boost::container::frozen_hash_set<Key, Hash, Pred, Allocator> >()(x);  }
+};
+
+}  //namespace std {
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   // BOOST_CONTAINER_FROZEN_HASH_SET_HPP
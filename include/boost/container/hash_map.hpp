@@ -0,0 +1,1050 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2005-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_HASH_MAP_HPP
+#define BOOST_CONTAINER_HASH_MAP_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/new_allocator.hpp> //new_allocator
+#include <boost/container/throw_exception.hpp>
+// container/detail
+#include <boost/container/detail/hash_table.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/type_traits.hpp>
+#include <boost/container/detail/value_init.hpp>
+#include <boost/container/detail/pair.hpp>
+// move
+#include <boost/move/traits.hpp>
+#include <boost/move/utility_core.hpp>
+// move/detail
+#if defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+#include <boost/move/detail/fwd_macros.hpp>
+#endif
+#include <boost/move/detail/move_helpers.hpp>
+// intrusive/detail
+#include <boost/intrusive/detail/minimal_pair_header.hpp>      //pair
+#include <boost/intrusive/detail/minimal_less_equal_header.hpp>//less, equal
+// other
+#include <boost/functional/hash.hpp>
+#include <boost/static_assert.hpp>
+// std
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+#include <initializer_list>
+#endif
+
+namespace boost {
+namespace container {
+
+#ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! A hash_map is a kind of unordered associative container that supports unique keys
+//! (contains at most one of each key value) and provides for fast retrieval of values
+//! of another type T based on the keys. Elements are organized in buckets selected
+//! by the hash value of the key. The hash_map class supports forward iterators.
+//!
+//! A hash_map satisfies all of the requirements of a container and of an unordered
+//! associative container. The <code>value_type</code> stored by this container is
+//! std::pair<const Key, T>. Nodes are obtained from the allocator so version 2 allocators
+//! like node_allocator or adaptive_pool allocate and deallocate them in bulk in range
+//! insertions, copies and clear(), and the bucket array is grown in place when possible.
+//!
+//! \tparam Key is the key_type of the map
+//! \tparam T is the <code>mapped_type</code>
+//! \tparam Hash is the hash function used to compute the hash value of keys
+//! \tparam Pred is the equality predicate used to compare keys
+//! \tparam Allocator is the allocator to allocate the <code>value_type</code>s
+//!   (e.g. <i>allocator< std::pair<const Key, T> > </i>).
+template < class Key, class T, class Hash = boost::hash<Key>, class Pred = std::equal_to<Key>
+         , class Allocator = new_allocator< std::pair< const Key, T> > >
+#else
+template <class Key, class T, class Hash, class Pred, class Allocator>
+#endif
+class hash_map
+   ///@cond
+   : public container_detail::hash_table
+      < Key, std::pair<const Key, T>
+      , container_detail::select1st< std::pair<const Key, T> >
+      , Hash, Pred, Allocator>
+   ///@endcond
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   BOOST_COPYABLE_AND_MOVABLE(hash_map)
+
+   typedef std::pair<const Key, T>  value_type_impl;
+   typedef container_detail::hash_table
+      <Key, value_type_impl, container_detail::select1st<value_type_impl>, Hash, Pred, Allocator> base_t;
+   typedef container_detail::pair <Key, T> movable_value_type_impl;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //                    types
+   //
+   //////////////////////////////////////////////
+
+   typedef Key                                                                      key_type;
+   typedef ::boost::container::allocator_traits<Allocator>                          allocator_traits_type;
+   typedef T                                                                        mapped_type;
+   typedef std::pair<const Key, T>                                                  value_type;
+   typedef Hash                                                                     hasher;
+   typedef Pred                                                                     key_equal;
+   typedef typename boost::container::allocator_traits<Allocator>::pointer          pointer;
+   typedef typename boost::container::allocator_traits<Allocator>::const_pointer    const_pointer;
+   typedef typename boost::container::allocator_traits<Allocator>::reference        reference;
+   typedef typename boost::container::allocator_traits<Allocator>::const_reference  const_reference;
+   typedef typename boost::container::allocator_traits<Allocator>::size_type        size_type;
+   typedef typename boost::container::allocator_traits<Allocator>::difference_type  difference_type;
+   typedef Allocator                                                                allocator_type;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::stored_allocator_type)           stored_allocator_type;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::iterator)                        iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::const_iterator)                  const_iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::local_iterator)                  local_iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::const_local_iterator)            const_local_iterator;
+   typedef std::pair<key_type, mapped_type>                                         nonconst_value_type;
+   typedef BOOST_CONTAINER_IMPDEF(movable_value_type_impl)                          movable_value_type;
+
+   //////////////////////////////////////////////
+   //
+   //          construct/copy/destroy
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Default constructs an empty hash_map. No memory is allocated.
+   //!
+   //! <b>Complexity</b>: Constant.
+   hash_map()
+      : base_t()
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! <b>Effects</b>: Constructs an empty hash_map with at least n buckets using the specified
+   //! hash function, equality predicate and allocator.
+   //!
+   //! <b>Complexity</b>: Linear in n.
+   explicit hash_map(size_type n, const hasher& hf = hasher(), const key_equal& eql = key_equal(),
+                     const allocator_type& a = allocator_type())
+      : base_t(n, hf, eql, a)
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! <b>Effects</b>: Constructs an empty hash_map using the specified allocator.
+   //!
+   //! <b>Complexity</b>: Constant.
+   explicit hash_map(const allocator_type& a)
+      : base_t(a)
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! <b>Effects</b>: Constructs an empty hash_map with at least n buckets using the specified
+   //! hash function, equality predicate and allocator, and inserts elements from the range [first ,last ).
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is last - first.
+   template <class InputIterator>
+   hash_map(InputIterator first, InputIterator last, size_type n = 0, const hasher& hf = hasher(),
+            const key_equal& eql = key_equal(), const allocator_type& a = allocator_type())
+      : base_t(n, hf, eql, a)
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+      this->base_t::insert_unique(first, last);
+   }
+
+   //! <b>Effects</b>: Constructs an empty hash_map using the specified allocator,
+   //! and inserts elements from the range [first ,last ).
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is last - first.
+   template <class InputIterator>
+   hash_map(InputIterator first, InputIterator last, const allocator_type& a)
+      : base_t(a)
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+      this->base_t::insert_unique(first, last);
+   }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Constructs an empty hash_map with at least n buckets using the specified
+   //! hash function, equality predicate and allocator, and inserts elements from the range [il.begin(), il.end()).
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is il.size().
+   hash_map(std::initializer_list<value_type> il, size_type n = 0, const hasher& hf = hasher(),
+            const key_equal& eql = key_equal(), const allocator_type& a = allocator_type())
+      : base_t(n, hf, eql, a)
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+      this->base_t::insert_unique(il.begin(), il.end());
+   }
+
+   //! <b>Effects</b>: Constructs an empty hash_map using the specified allocator,
+   //! and inserts elements from the range [il.begin(), il.end()).
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is il.size().
+   hash_map(std::initializer_list<value_type> il, const allocator_type& a)
+      : base_t(a)
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+      this->base_t::insert_unique(il.begin(), il.end());
+   }
+#endif
+
+   //! <b>Effects</b>: Copy constructs a hash_map.
+   //!
+   //! <b>Complexity</b>: Linear in x.size().
+   hash_map(const hash_map& x)
+      : base_t(static_cast<const base_t&>(x))
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! <b>Effects</b>: Move constructs a hash_map. Constructs *this using x's resources.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Postcondition</b>: x is emptied.
+   hash_map(BOOST_RV_REF(hash_map) x)
+      : base_t(BOOST_MOVE_BASE(base_t, x))
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! <b>Effects</b>: Copy constructs a hash_map using the specified allocator.
+   //!
+   //! <b>Complexity</b>: Linear in x.size().
+   hash_map(const hash_map& x, const allocator_type &a)
+      : base_t(static_cast<const base_t&>(x), a)
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! <b>Effects</b>: Move constructs a hash_map using the specified allocator.
+   //!                 Constructs *this using x's resources.
+   //!
+   //! <b>Complexity</b>: Constant if x == x.get_allocator(), linear otherwise.
+   //!
+   //! <b>Postcondition</b>: x is emptied.
+   hash_map(BOOST_RV_REF(hash_map) x, const allocator_type &a)
+      : base_t(BOOST_MOVE_BASE(base_t, x), a)
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! <b>Effects</b>: Makes *this a copy of x.
+   //!
+   //! <b>Complexity</b>: Linear in x.size().
+   hash_map& operator=(BOOST_COPY_ASSIGN_REF(hash_map) x)
+   {  return static_cast<hash_map&>(this->base_t::operator=(static_cast<const base_t&>(x)));  }
+
+   //! <b>Effects</b>: this->swap(x.get()).
+   //!
+   //! <b>Throws</b>: If allocator_traits_type::propagate_on_container_move_assignment
+   //!   is false and (allocation throws or value_type's move constructor throws)
+   //!
+   //! <b>Complexity</b>: Constant if allocator_traits_type::
+   //!   propagate_on_container_move_assignment is true or
+   //!   this->get>allocator() == x.get_allocator(). Linear otherwise.
+   hash_map& operator=(BOOST_RV_REF(hash_map) x)
+      BOOST_NOEXCEPT_IF(  allocator_traits_type::is_always_equal::value
+                                 && boost::container::container_detail::is_nothrow_move_assignable<Hash>::value
+                                 && boost::container::container_detail::is_nothrow_move_assignable<Pred>::value )
+   {  return static_cast<hash_map&>(this->base_t::operator=(BOOST_MOVE_BASE(base_t, x)));  }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Assign content of il to *this.
+   //!
+   hash_map& operator=(std::initializer_list<value_type> il)
+   {
+       this->clear();
+       insert(il.begin(), il.end());
+       return *this;
+   }
+#endif
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //! @copydoc ::boost::container::hash_set::get_allocator()
+   allocator_type get_allocator() const;
+
+   //! @copydoc ::boost::container::hash_set::get_stored_allocator()
+   stored_allocator_type &get_stored_allocator();
+
+   //! @copydoc ::boost::container::hash_set::get_stored_allocator() const
+   const stored_allocator_type &get_stored_allocator() const;
+
+   //! @copydoc ::boost::container::hash_set::begin()
+   iterator begin();
+
+   //! @copydoc ::boost::container::hash_set::begin() const
+   const_iterator begin() const;
+
+   //! @copydoc ::boost::container::hash_set::cbegin() const
+   const_iterator cbegin() const;
+
+   //! @copydoc ::boost::container::hash_set::end()
+   iterator end();
+
+   //! @copydoc ::boost::container::hash_set::end() const
+   const_iterator end() const;
+
+   //! @copydoc ::boost::container::hash_set::cend() const
+   const_iterator cend() const;
+
+   //! @copydoc ::boost::container::hash_set::empty() const
+   bool empty() const;
+
+   //! @copydoc ::boost::container::hash_set::size() const
+   size_type size() const;
+
+   //! @copydoc ::boost::container::hash_set::max_size() const
+   size_type max_size() const;
+
+   //! Effects: If there is no key equivalent to x in the hash_map, inserts
+   //! value_type(x, T()) into the hash_map.
+   //!
+   //! Returns: A reference to the mapped_type corresponding to x in *this.
+   //!
+   //! Complexity: Average case constant.
+   mapped_type& operator[](const key_type &k);
+
+   //! Effects: If there is no key equivalent to x in the hash_map, inserts
+   //! value_type(boost::move(x), T()) into the hash_map (the key is move-constructed)
+   //!
+   //! Returns: A reference to the mapped_type corresponding to x in *this.
+   //!
+   //! Complexity: Average case constant.
+   mapped_type& operator[](key_type &&k);
+   #else
+   BOOST_MOVE_CONVERSION_AWARE_CATCH( operator[] , key_type, mapped_type&, this->priv_subscript)
+   #endif
+
+   //! Returns: A reference to the element whose key is equivalent to x.
+   //! Throws: An exception object of type out_of_range if no such element is present.
+   //! Complexity: Average case constant.
+   T& at(const key_type& k)
+   {
+      iterator i = this->find(k);
+      if(i == this->end()){
+         throw_out_of_range("hash_map::at key not found");
+      }
+      return i->second;
+   }
+
+   //! Returns: A reference to the element whose key is equivalent to x.
+   //! Throws: An exception object of type out_of_range if no such element is present.
+   //! Complexity: Average case constant.
+   const T& at(const key_type& k) const
+   {
+      const_iterator i = this->find(k);
+      if(i == this->end()){
+         throw_out_of_range("hash_map::at key not found");
+      }
+      return i->second;
+   }
+
+   //////////////////////////////////////////////
+   //
+   //                modifiers
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Inserts x if and only if there is no element in the container
+   //!   with key equivalent to the key of x.
+   //!
+   //! <b>Returns</b>: The bool component of the returned pair is true if and only
+   //!   if the insertion takes place, and the iterator component of the pair
+   //!   points to the element with key equivalent to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   std::pair<iterator,bool> insert(const value_type& x)
+   { return this->base_t::insert_unique(x); }
+
+   //! <b>Effects</b>: Inserts a new value_type created from the pair if and only if
+   //! there is no element in the container  with key equivalent to the key of x.
+   //!
+   //! <b>Returns</b>: The bool component of the returned pair is true if and only
+   //!   if the insertion takes place, and the iterator component of the pair
+   //!   points to the element with key equivalent to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   std::pair<iterator,bool> insert(const nonconst_value_type& x)
+   { return this->base_t::insert_unique(x); }
+
+   //! <b>Effects</b>: Inserts a new value_type move constructed from the pair if and
+   //! only if there is no element in the container with key equivalent to the key of x.
+   //!
+   //! <b>Returns</b>: The bool component of the returned pair is true if and only
+   //!   if the insertion takes place, and the iterator component of the pair
+   //!   points to the element with key equivalent to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   std::pair<iterator,bool> insert(BOOST_RV_REF(nonconst_value_type) x)
+   { return this->base_t::insert_unique(boost::move(x)); }
+
+   //! <b>Effects</b>: Inserts a new value_type move constructed from the pair if and
+   //! only if there is no element in the container with key equivalent to the key of x.
+   //!
+   //! <b>Returns</b>: The bool component of the returned pair is true if and only
+   //!   if the insertion takes place, and the iterator component of the pair
+   //!   points to the element with key equivalent to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   std::pair<iterator,bool> insert(BOOST_RV_REF(movable_value_type) x)
+   { return this->base_t::insert_unique(boost::move(x)); }
+
+   //! <b>Effects</b>: Move constructs a new value from x if and only if there is
+   //!   no element in the container with key equivalent to the key of x.
+   //!
+   //! <b>Returns</b>: The bool component of the returned pair is true if and only
+   //!   if the insertion takes place, and the iterator component of the pair
+   //!   points to the element with key equivalent to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   std::pair<iterator,bool> insert(BOOST_RV_REF(value_type) x)
+   { return this->base_t::insert_unique(boost::move(x)); }
+
+   //! <b>Effects</b>: Inserts a copy of x in the container if and only if there is
+   //!   no element in the container with key equivalent to the key of x.
+   //!   p is a hint that is ignored by this implementation.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent
+   //!   to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(const_iterator p, const value_type& x)
+   { return this->base_t::insert_unique(p, x); }
+
+   //! <b>Effects</b>: Move constructs a new value from x if and only if there is
+   //!   no element in the container with key equivalent to the key of x.
+   //!   p is a hint that is ignored by this implementation.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent
+   //!   to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(const_iterator p, BOOST_RV_REF(nonconst_value_type) x)
+   { return this->base_t::insert_unique(p, boost::move(x)); }
+
+   //! <b>Effects</b>: Move constructs a new value from x if and only if there is
+   //!   no element in the container with key equivalent to the key of x.
+   //!   p is a hint that is ignored by this implementation.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent
+   //!   to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(const_iterator p, BOOST_RV_REF(movable_value_type) x)
+   { return this->base_t::insert_unique(p, boost::move(x)); }
+
+   //! <b>Effects</b>: Inserts a copy of x in the container.
+   //!   p is a hint that is ignored by this implementation.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(const_iterator p, const nonconst_value_type& x)
+   { return this->base_t::insert_unique(p, x); }
+
+   //! <b>Effects</b>: Inserts an element move constructed from x in the container.
+   //!   p is a hint that is ignored by this implementation.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(const_iterator p, BOOST_RV_REF(value_type) x)
+   { return this->base_t::insert_unique(p, boost::move(x)); }
+
+   //! <b>Requires</b>: first, last are not iterators into *this.
+   //!
+   //! <b>Effects</b>: inserts each element from the range [first,last) if and only
+   //!   if there is no element with key equivalent to the key of that element.
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is the distance from first to last.
+   //!
+   //! <b>Note</b>: If the allocator is a version 2 allocator and [first,last) are forward
+   //!   iterators, all nodes are allocated in a single call to the allocator.
+   template <class InputIterator>
+   void insert(InputIterator first, InputIterator last)
+   {  this->base_t::insert_unique(first, last);  }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: inserts each element from the range [il.begin(), il.end()) if and only
+   //!   if there is no element with key equivalent to the key of that element.
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is il.size().
+   void insert(std::initializer_list<value_type> il)
+   {  this->base_t::insert_unique(il.begin(), il.end()); }
+#endif
+
+   #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   //! <b>Effects</b>: Inserts an object x of type T constructed with
+   //!   std::forward<Args>(args)... in the container if and only if there is
+   //!   no element in the container with an equivalent key.
+   //!   p is a hint pointing to where the insert should start to search.
+   //!
+   //! <b>Returns</b>: The bool component of the returned pair is true if and only
+   //!   if the insertion takes place, and the iterator component of the pair
+   //!   points to the element with key equivalent to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   template <class... Args>
+   std::pair<iterator,bool> emplace(BOOST_FWD_REF(Args)... args)
+   {  return this->base_t::emplace_unique(boost::forward<Args>(args)...); }
+
+   //! <b>Effects</b>: Inserts an object of type T constructed with
+   //!   std::forward<Args>(args)... in the container if and only if there is
+   //!   no element in the container with an equivalent key.
+   //!   p is a hint that is ignored by this implementation.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent
+   //!   to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   template <class... Args>
+   iterator emplace_hint(const_iterator p, BOOST_FWD_REF(Args)... args)
+   {  return this->base_t::emplace_hint_unique(p, boost::forward<Args>(args)...); }
+
+   #else // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   #define BOOST_CONTAINER_HASH_MAP_EMPLACE_CODE(N) \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   std::pair<iterator,bool> emplace(BOOST_MOVE_UREF##N)\
+   {  return this->base_t::emplace_unique(BOOST_MOVE_FWD##N);   }\
+   \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   iterator emplace_hint(const_iterator hint BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
+   {  return this->base_t::emplace_hint_unique(hint BOOST_MOVE_I##N BOOST_MOVE_FWD##N);   }\
+   //
+   BOOST_MOVE_ITERATE_0TO9(BOOST_CONTAINER_HASH_MAP_EMPLACE_CODE)
+   #undef BOOST_CONTAINER_HASH_MAP_EMPLACE_CODE
+
+   #endif   // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   //! @copydoc ::boost::container::hash_set::erase(const_iterator)
+   iterator erase(const_iterator p);
+
+   //! @copydoc ::boost::container::hash_set::erase(const key_type&)
+   size_type erase(const key_type& x);
+
+   //! @copydoc ::boost::container::hash_set::erase(const_iterator,const_iterator)
+   iterator erase(const_iterator first, const_iterator last);
+
+   //! @copydoc ::boost::container::hash_set::swap
+   void swap(hash_map& x)
+      BOOST_NOEXCEPT_IF(  allocator_traits_type::is_always_equal::value
+                                 && boost::container::container_detail::is_nothrow_swappable<Hash>::value
+                                 && boost::container::container_detail::is_nothrow_swappable<Pred>::value );
+
+   //! @copydoc ::boost::container::hash_set::clear
+   void clear();
+
+   //! @copydoc ::boost::container::hash_set::hash_function
+   hasher hash_function() const;
+
+   //! @copydoc ::boost::container::hash_set::key_eq
+   key_equal key_eq() const;
+
+   //! @copydoc ::boost::container::hash_set::find(const key_type&)
+   iterator find(const key_type& x);
+
+   //! @copydoc ::boost::container::hash_set::find(const key_type&) const
+   const_iterator find(const key_type& x) const;
+
+   #endif   //#if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   //! <b>Returns</b>: The number of elements with key equivalent to x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   size_type count(const key_type& x) const
+   {  return static_cast<size_type>(this->find(x) != this->cend());  }
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   //! @copydoc ::boost::container::hash_set::equal_range(const key_type&)
+   std::pair<iterator,iterator> equal_range(const key_type& x);
+
+   //! @copydoc ::boost::container::hash_set::equal_range(const key_type&) const
+   std::pair<const_iterator,const_iterator> equal_range(const key_type& x) const;
+
+   //! @copydoc ::boost::container::hash_set::bucket_count
+   size_type bucket_count() const;
+
+   //! @copydoc ::boost::container::hash_set::max_bucket_count
+   size_type max_bucket_count() const;
+
+   //! @copydoc ::boost::container::hash_set::bucket_size
+   size_type bucket_size(size_type n) const;
+
+   //! @copydoc ::boost::container::hash_set::bucket
+   size_type bucket(const key_type& k) const;
+
+   //! @copydoc ::boost::container::hash_set::begin(size_type)
+   local_iterator begin(size_type n);
+
+   //! @copydoc ::boost::container::hash_set::begin(size_type) const
+   const_local_iterator begin(size_type n) const;
+
+   //! @copydoc ::boost::container::hash_set::cbegin(size_type) const
+   const_local_iterator cbegin(size_type n) const;
+
+   //! @copydoc ::boost::container::hash_set::end(size_type)
+   local_iterator end(size_type n);
+
+   //! @copydoc ::boost::container::hash_set::end(size_type) const
+   const_local_iterator end(size_type n) const;
+
+   //! @copydoc ::boost::container::hash_set::cend(size_type) const
+   const_local_iterator cend(size_type n) const;
+
+   //! @copydoc ::boost::container::hash_set::load_factor
+   float load_factor() const;
+
+   //! @copydoc ::boost::container::hash_set::max_load_factor() const
+   float max_load_factor() const;
+
+   //! @copydoc ::boost::container::hash_set::max_load_factor(float)
+   void max_load_factor(float z);
+
+   //! @copydoc ::boost::container::hash_set::rehash
+   void rehash(size_type n);
+
+   //! @copydoc ::boost::container::hash_set::reserve
+   void reserve(size_type n);
+
+   //! <b>Effects</b>: Returns true if x and y have the same elements.
+   //!
+   //! <b>Complexity</b>: Average case linear in x.size().
+   friend bool operator==(const hash_map& x, const hash_map& y);
+
+   //! <b>Effects</b>: Returns true if x and y are unequal
+   //!
+   //! <b>Complexity</b>: Average case linear in x.size().
+   friend bool operator!=(const hash_map& x, const hash_map& y);
+
+   //! <b>Effects</b>: Returns the hash value of x. Equal containers have equal hash values.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend std::size_t hash_value(const hash_map& x);
+
+   //! <b>Effects</b>: x.swap(y)
+   //!
+   //! <b>Complexity</b>: Constant.
+   friend void swap(hash_map& x, hash_map& y);
+
+   #endif   //#if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   mapped_type& priv_subscript(const key_type &k)
+   {
+      //The key is hashed only once
+      typename base_t::insert_commit_data data;
+      std::pair<iterator,bool> ret = this->base_t::insert_unique_check(k, data);
+      if (ret.second){
+         container_detail::value_init<mapped_type> m;
+         movable_value_type val(k, boost::move(m.m_t));
+         ret.first = this->base_t::insert_unique_commit(boost::move(val), data);
+      }
+      return (*ret.first).second;
+   }
+
+   mapped_type& priv_subscript(BOOST_RV_REF(key_type) mk)
+   {
+      key_type &k = mk;
+      //The key is hashed only once
+      typename base_t::insert_commit_data data;
+      std::pair<iterator,bool> ret = this->base_t::insert_unique_check(k, data);
+      if (ret.second){
+         container_detail::value_init<mapped_type> m;
+         movable_value_type val(boost::move(k), boost::move(m.m_t));
+         ret.first = this->base_t::insert_unique_commit(boost::move(val), data);
+      }
+      return (*ret.first).second;
+   }
+
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+#ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! A hash_multimap is a kind of unordered associative container that supports equivalent keys
+//! (possibly containing multiple copies of the same key value) and provides for
+//! fast retrieval of values of another type T based on the keys. Equivalent keys are adjacent
+//! in the iteration order. The hash_multimap class supports forward iterators.
+//!
+//! A hash_multimap satisfies all of the requirements of a container and of an unordered
+//! associative container. The <code>value_type</code> stored by this container is
+//! std::pair<const Key, T>.
+//!
+//! \tparam Key is the key_type of the map
+//! \tparam T is the <code>mapped_type</code>
+//! \tparam Hash is the hash function used to compute the hash value of keys
+//! \tparam Pred is the equality predicate used to compare keys
+//! \tparam Allocator is the allocator to allocate the <code>value_type</code>s
+//!   (e.g. <i>allocator< std::pair<const Key, T> > </i>).
+template < class Key, class T, class Hash = boost::hash<Key>, class Pred = std::equal_to<Key>
+         , class Allocator = new_allocator< std::pair< const Key, T> > >
+#else
+template <class Key, class T, class Hash, class Pred, class Allocator>
+#endif
+class hash_multimap
+   ///@cond
+   : public container_detail::hash_table
+      < Key, std::pair<const Key, T>
+      , container_detail::select1st< std::pair<const Key, T> >
+      , Hash, Pred, Allocator>
+   ///@endcond
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   BOOST_COPYABLE_AND_MOVABLE(hash_multimap)
+
+   typedef std::pair<const Key, T>  value_type_impl;
+   typedef container_detail::hash_table
+      <Key, value_type_impl, container_detail::select1st<value_type_impl>, Hash, Pred, Allocator> base_t;
+   typedef container_detail::pair <Key, T> movable_value_type_impl;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //                    types
+   //
+   //////////////////////////////////////////////
+
+   typedef Key                                                                      key_type;
+   typedef T                                                                        mapped_type;
+   typedef ::boost::container::allocator_traits<Allocator>                          allocator_traits_type;
+   typedef std::pair<const Key, T>                                                  value_type;
+   typedef Hash                                                                     hasher;
+   typedef Pred                                                                     key_equal;
+   typedef typename boost::container::allocator_traits<Allocator>::pointer          pointer;
+   typedef typename boost::container::allocator_traits<Allocator>::const_pointer    const_pointer;
+   typedef typename boost::container::allocator_traits<Allocator>::reference        reference;
+   typedef typename boost::container::allocator_traits<Allocator>::const_reference  const_reference;
+   typedef typename boost::container::allocator_traits<Allocator>::size_type        size_type;
+   typedef typename boost::container::allocator_traits<Allocator>::difference_type  difference_type;
+   typedef Allocator                                                                allocator_type;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::stored_allocator_type)           stored_allocator_type;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::iterator)                        iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::const_iterator)                  const_iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::local_iterator)                  local_iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::const_local_iterator)            const_local_iterator;
+   typedef std::pair<key_type, mapped_type>                                         nonconst_value_type;
+   typedef BOOST_CONTAINER_IMPDEF(movable_value_type_impl)                          movable_value_type;
+
+   //////////////////////////////////////////////
+   //
+   //          construct/copy/destroy
+   //
+   //////////////////////////////////////////////
+
+   //! @copydoc ::boost::container::hash_map::hash_map()
+   hash_multimap()
+      : base_t()
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! @copydoc ::boost::container::hash_map::hash_map(size_type, const hasher&, const key_equal&, const allocator_type&)
+   explicit hash_multimap(size_type n, const hasher& hf = hasher(), const key_equal& eql = key_equal(),
+                          const allocator_type& a = allocator_type())
+      : base_t(n, hf, eql, a)
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! @copydoc ::boost::container::hash_map::hash_map(const allocator_type&)
+   explicit hash_multimap(const allocator_type& a)
+      : base_t(a)
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! @copydoc ::boost::container::hash_map::hash_map(InputIterator, InputIterator, size_type, const hasher&, const key_equal&, const allocator_type&)
+   template <class InputIterator>
+   hash_multimap(InputIterator first, InputIterator last, size_type n = 0, const hasher& hf = hasher(),
+                 const key_equal& eql = key_equal(), const allocator_type& a = allocator_type())
+      : base_t(n, hf, eql, a)
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+      this->base_t::insert_equal(first, last);
+   }
+
+   //! @copydoc ::boost::container::hash_map::hash_map(InputIterator, InputIterator, const allocator_type&)
+   template <class InputIterator>
+   hash_multimap(InputIterator first, InputIterator last, const allocator_type& a)
+      : base_t(a)
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+      this->base_t::insert_equal(first, last);
+   }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! @copydoc ::boost::container::hash_map::hash_map(std::initializer_list<value_type>, size_type, const hasher&, const key_equal&, const allocator_type&)
+   hash_multimap(std::initializer_list<value_type> il, size_type n = 0, const hasher& hf = hasher(),
+                 const key_equal& eql = key_equal(), const allocator_type& a = allocator_type())
+      : base_t(n, hf, eql, a)
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+      this->base_t::insert_equal(il.begin(), il.end());
+   }
+
+   //! @copydoc ::boost::container::hash_map::hash_map(std::initializer_list<value_type>, const allocator_type&)
+   hash_multimap(std::initializer_list<value_type> il, const allocator_type& a)
+      : base_t(a)
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+      this->base_t::insert_equal(il.begin(), il.end());
+   }
+#endif
+
+   //! @copydoc ::boost::container::hash_map::hash_map(const hash_map&)
+   hash_multimap(const hash_multimap& x)
+      : base_t(static_cast<const base_t&>(x))
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! @copydoc ::boost::container::hash_map::hash_map(hash_map&&)
+   hash_multimap(BOOST_RV_REF(hash_multimap) x)
+      : base_t(BOOST_MOVE_BASE(base_t, x))
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! @copydoc ::boost::container::hash_map::hash_map(const hash_map&, const allocator_type&)
+   hash_multimap(const hash_multimap& x, const allocator_type &a)
+      : base_t(static_cast<const base_t&>(x), a)
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! @copydoc ::boost::container::hash_map::hash_map(hash_map&&, const allocator_type&)
+   hash_multimap(BOOST_RV_REF(hash_multimap) x, const allocator_type &a)
+      : base_t(BOOST_MOVE_BASE(base_t, x), a)
+   {
+      //A type must be std::pair<CONST Key, T>
+      BOOST_STATIC_ASSERT((container_detail::is_same<std::pair<const Key, T>, typename Allocator::value_type>::value));
+   }
+
+   //! @copydoc ::boost::container::hash_map::operator=(const hash_map&)
+   hash_multimap& operator=(BOOST_COPY_ASSIGN_REF(hash_multimap) x)
+   {  return static_cast<hash_multimap&>(this->base_t::operator=(static_cast<const base_t&>(x)));  }
+
+   //! @copydoc ::boost::container::hash_map::operator=(hash_map&&)
+   hash_multimap& operator=(BOOST_RV_REF(hash_multimap) x)
+      BOOST_NOEXCEPT_IF(  allocator_traits_type::is_always_equal::value
+                                 && boost::container::container_detail::is_nothrow_move_assignable<Hash>::value
+                                 && boost::container::container_detail::is_nothrow_move_assignable<Pred>::value )
+   {  return static_cast<hash_multimap&>(this->base_t::operator=(BOOST_MOVE_BASE(base_t, x)));  }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! @copydoc ::boost::container::hash_map::operator=(std::initializer_list<value_type>)
+   hash_multimap& operator=(std::initializer_list<value_type> il)
+   {
+       this->clear();
+       insert(il.begin(), il.end());
+       return *this;
+   }
+#endif
+
+   #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   //! <b>Effects</b>: Inserts an object of type T constructed with
+   //!   std::forward<Args>(args)... in the container.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   template <class... Args>
+   iterator emplace(BOOST_FWD_REF(Args)... args)
+   {  return this->base_t::emplace_equal(boost::forward<Args>(args)...); }
+
+   //! <b>Effects</b>: Inserts an object of type T constructed with
+   //!   std::forward<Args>(args)... in the container.
+   //!   p is a hint that is ignored by this implementation.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent
+   //!   to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   template <class... Args>
+   iterator emplace_hint(const_iterator p, BOOST_FWD_REF(Args)... args)
+   {  return this->base_t::emplace_hint_equal(p, boost::forward<Args>(args)...); }
+
+   #else // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   #define BOOST_CONTAINER_HASH_MULTIMAP_EMPLACE_CODE(N) \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   iterator emplace(BOOST_MOVE_UREF##N)\
+   {  return this->base_t::emplace_equal(BOOST_MOVE_FWD##N);   }\
+   \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   iterator emplace_hint(const_iterator hint BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
+   {  return this->base_t::emplace_hint_equal(hint BOOST_MOVE_I##N BOOST_MOVE_FWD##N);   }\
+   //
+   BOOST_MOVE_ITERATE_0TO9(BOOST_CONTAINER_HASH_MULTIMAP_EMPLACE_CODE)
+   #undef BOOST_CONTAINER_HASH_MULTIMAP_EMPLACE_CODE
+
+   #endif   // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   //! <b>Effects</b>: Inserts x and returns the iterator pointing to the
+   //!   newly inserted element.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(const value_type& x)
+   { return this->base_t::insert_equal(x); }
+
+   //! <b>Effects</b>: Inserts a new value constructed from x and returns
+   //!   the iterator pointing to the newly inserted element.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(const nonconst_value_type& x)
+   { return this->base_t::insert_equal(x); }
+
+   //! <b>Effects</b>: Inserts a new value move-constructed from x and returns
+   //!   the iterator pointing to the newly inserted element.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(BOOST_RV_REF(nonconst_value_type) x)
+   { return this->base_t::insert_equal(boost::move(x)); }
+
+   //! <b>Effects</b>: Inserts a new value move-constructed from x and returns
+   //!   the iterator pointing to the newly inserted element.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(BOOST_RV_REF(movable_value_type) x)
+   { return this->base_t::insert_equal(boost::move(x)); }
+
+   //! <b>Effects</b>: Inserts a copy of x in the container.
+   //!   p is a hint that is ignored by this implementation.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent
+   //!   to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(const_iterator p, const value_type& x)
+   { return this->base_t::insert_equal(p, x); }
+
+   //! <b>Effects</b>: Inserts a new value constructed from x in the container.
+   //!   p is a hint that is ignored by this implementation.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent
+   //!   to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(const_iterator p, const nonconst_value_type& x)
+   { return this->base_t::insert_equal(p, x); }
+
+   //! <b>Effects</b>: Inserts a new value move constructed from x in the container.
+   //!   p is a hint that is ignored by this implementation.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent
+   //!   to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(const_iterator p, BOOST_RV_REF(nonconst_value_type) x)
+   { return this->base_t::insert_equal(p, boost::move(x)); }
+
+   //! <b>Effects</b>: Inserts a new value move constructed from x in the container.
+   //!   p is a hint that is ignored by this implementation.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent
+   //!   to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(const_iterator p, BOOST_RV_REF(movable_value_type) x)
+   { return this->base_t::insert_equal(p, boost::move(x)); }
+
+   //! <b>Requires</b>: first, last are not iterators into *this.
+   //!
+   //! <b>Effects</b>: inserts each element from the range [first,last) .
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is the distance from first to last.
+   //!
+   //! <b>Note</b>: If the allocator is a version 2 allocator and [first,last) are forward
+   //!   iterators, all nodes are allocated in a single call to the allocator.
+   template <class InputIterator>
+   void insert(InputIterator first, InputIterator last)
+   {  this->base_t::insert_equal(first, last); }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: inserts each element from the range [il.begin(), il.end().
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is il.size().
+   void insert(std::initializer_list<value_type> il)
+   {  this->base_t::insert_equal(il.begin(), il.end()); }
+#endif
+};
+
+}}
+
+#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+namespace std {
+
+//!std::hash specialization, equivalent to boost::hash
+template <class Key, class T, class Hash, class Pred, class Allocator>
+struct hash< ::boost::container::hash_map<Key, T, Hash, Pred, Allocator> >
+{
+   std::size_t operator()(const ::boost::container::hash_map<Key, T, Hash, Pred, Allocator> &x) const
+   {  return ::boost::hash< ::boost::container::hash_map<Key, T, Hash, Pred, Allocator> >()(x);  }
+};
+
+//!std::hash specialization, equivalent to boost::hash
+template <class Key, class T, class Hash, class Pred, class Allocator>
+struct hash< ::boost::container::hash_multimap<Key, T, Hash, Pred, Allocator> >
+{
+   std::size_t operator()(const ::boost::container::hash_multimap<Key, T, Hash, Pred, Allocator> &x) const
+   {  return ::boost::hash< ::boost::container::hash_multimap<Key, T, Hash, Pred, Allocator> >()(x);  }
+};
+
+}  //namespace std {
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   // BOOST_CONTAINER_HASH_MAP_HPP
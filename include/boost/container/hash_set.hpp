@@ -0,0 +1,937 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2005-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_HASH_SET_HPP
+#define BOOST_CONTAINER_HASH_SET_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+// container
+#include <boost/container/container_fwd.hpp>
+// container/detail
+#include <boost/container/detail/hash_table.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/new_allocator.hpp> //new_allocator
+// intrusive/detail
+#include <boost/intrusive/detail/minimal_pair_header.hpp>      //pair
+#include <boost/intrusive/detail/minimal_less_equal_header.hpp>//less, equal
+// move
+#include <boost/move/traits.hpp>
+#include <boost/move/utility_core.hpp>
+// move/detail
+#include <boost/move/detail/move_helpers.hpp>
+#if defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+#include <boost/move/detail/fwd_macros.hpp>
+#endif
+// other
+#include <boost/functional/hash.hpp>
+// std
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+#include <initializer_list>
+#endif
+
+namespace boost {
+namespace container {
+
+#ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! A hash_set is a kind of unordered associative container that supports unique keys
+//! (contains at most one of each key value) and provides for fast retrieval of the keys
+//! themselves. Elements are organized in buckets selected by the hash value of the key.
+//! Class hash_set supports forward iterators.
+//!
+//! A hash_set satisfies all of the requirements of a container and of an unordered
+//! associative container. Nodes are obtained from the allocator so version 2 allocators
+//! like node_allocator or adaptive_pool allocate and deallocate them in bulk in range
+//! insertions, copies and clear(), and the bucket array is grown in place when possible.
+//!
+//! \tparam Key is the type to be inserted in the set, which is also the key_type
+//! \tparam Hash is the hash function used to compute the hash value of keys
+//! \tparam Pred is the equality predicate used to compare keys
+//! \tparam Allocator is the allocator to be used to allocate memory for this container
+template <class Key, class Hash = boost::hash<Key>, class Pred = std::equal_to<Key>, class Allocator = new_allocator<Key> >
+#else
+template <class Key, class Hash, class Pred, class Allocator>
+#endif
+class hash_set
+   ///@cond
+   : public container_detail::hash_table
+      < Key, Key, container_detail::identity<Key>, Hash, Pred, Allocator>
+   ///@endcond
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   BOOST_COPYABLE_AND_MOVABLE(hash_set)
+   typedef container_detail::hash_table
+      < Key, Key, container_detail::identity<Key>, Hash, Pred, Allocator> base_t;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //                    types
+   //
+   //////////////////////////////////////////////
+   typedef Key                                                                         key_type;
+   typedef Key                                                                         value_type;
+   typedef Hash                                                                        hasher;
+   typedef Pred                                                                        key_equal;
+   typedef ::boost::container::allocator_traits<Allocator>                             allocator_traits_type;
+   typedef typename ::boost::container::allocator_traits<Allocator>::pointer           pointer;
+   typedef typename ::boost::container::allocator_traits<Allocator>::const_pointer     const_pointer;
+   typedef typename ::boost::container::allocator_traits<Allocator>::reference         reference;
+   typedef typename ::boost::container::allocator_traits<Allocator>::const_reference   const_reference;
+   typedef typename ::boost::container::allocator_traits<Allocator>::size_type         size_type;
+   typedef typename ::boost::container::allocator_traits<Allocator>::difference_type   difference_type;
+   typedef Allocator                                                                   allocator_type;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::stored_allocator_type)              stored_allocator_type;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::iterator)                           iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::const_iterator)                     const_iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::local_iterator)                     local_iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::const_local_iterator)               const_local_iterator;
+
+   //////////////////////////////////////////////
+   //
+   //          construct/copy/destroy
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Default constructs an empty hash_set. No memory is allocated.
+   //!
+   //! <b>Complexity</b>: Constant.
+   hash_set()
+      : base_t()
+   {}
+
+   //! <b>Effects</b>: Constructs an empty hash_set with at least n buckets using the specified
+   //! hash function, equality predicate and allocator.
+   //!
+   //! <b>Complexity</b>: Linear in n.
+   explicit hash_set(size_type n, const hasher& hf = hasher(), const key_equal& eql = key_equal(),
+                     const allocator_type& a = allocator_type())
+      : base_t(n, hf, eql, a)
+   {}
+
+   //! <b>Effects</b>: Constructs an empty hash_set using the specified allocator object.
+   //!
+   //! <b>Complexity</b>: Constant.
+   explicit hash_set(const allocator_type& a)
+      : base_t(a)
+   {}
+
+   //! <b>Effects</b>: Constructs an empty hash_set with at least n buckets using the specified
+   //! hash function, equality predicate and allocator, and inserts elements from the range [first ,last ).
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is last - first.
+   template <class InputIterator>
+   hash_set(InputIterator first, InputIterator last, size_type n = 0, const hasher& hf = hasher(),
+            const key_equal& eql = key_equal(), const allocator_type& a = allocator_type())
+      : base_t(n, hf, eql, a)
+   {  this->base_t::insert_unique(first, last);  }
+
+   //! <b>Effects</b>: Constructs an empty hash_set using the specified allocator,
+   //! and inserts elements from the range [first ,last ).
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is last - first.
+   template <class InputIterator>
+   hash_set(InputIterator first, InputIterator last, const allocator_type& a)
+      : base_t(a)
+   {  this->base_t::insert_unique(first, last);  }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Constructs an empty hash_set with at least n buckets using the specified
+   //! hash function, equality predicate and allocator, and inserts elements from the range [il.begin(), il.end()).
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is il.size().
+   hash_set(std::initializer_list<value_type> il, size_type n = 0, const hasher& hf = hasher(),
+            const key_equal& eql = key_equal(), const allocator_type& a = allocator_type())
+      : base_t(n, hf, eql, a)
+   {  this->base_t::insert_unique(il.begin(), il.end());  }
+
+   //! <b>Effects</b>: Constructs an empty hash_set using the specified allocator,
+   //! and inserts elements from the range [il.begin(), il.end()).
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is il.size().
+   hash_set(std::initializer_list<value_type> il, const allocator_type& a)
+      : base_t(a)
+   {  this->base_t::insert_unique(il.begin(), il.end());  }
+#endif
+
+   //! <b>Effects</b>: Copy constructs a hash_set.
+   //!
+   //! <b>Complexity</b>: Linear in x.size().
+   hash_set(const hash_set& x)
+      : base_t(static_cast<const base_t&>(x))
+   {}
+
+   //! <b>Effects</b>: Move constructs a hash_set. Constructs *this using x's resources.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Postcondition</b>: x is emptied.
+   hash_set(BOOST_RV_REF(hash_set) x)
+      : base_t(BOOST_MOVE_BASE(base_t, x))
+   {}
+
+   //! <b>Effects</b>: Copy constructs a hash_set using the specified allocator.
+   //!
+   //! <b>Complexity</b>: Linear in x.size().
+   hash_set(const hash_set& x, const allocator_type &a)
+      : base_t(static_cast<const base_t&>(x), a)
+   {}
+
+   //! <b>Effects</b>: Move constructs a hash_set using the specified allocator.
+   //!                 Constructs *this using x's resources.
+   //!
+   //! <b>Complexity</b>: Constant if a == x.get_allocator(), linear otherwise.
+   hash_set(BOOST_RV_REF(hash_set) x, const allocator_type &a)
+      : base_t(BOOST_MOVE_BASE(base_t, x), a)
+   {}
+
+   //! <b>Effects</b>: Makes *this a copy of x.
+   //!
+   //! <b>Complexity</b>: Linear in x.size().
+   hash_set& operator=(BOOST_COPY_ASSIGN_REF(hash_set) x)
+   {  return static_cast<hash_set&>(this->base_t::operator=(static_cast<const base_t&>(x)));  }
+
+   //! <b>Effects</b>: this->swap(x.get()).
+   //!
+   //! <b>Throws</b>: If allocator_traits_type::propagate_on_container_move_assignment
+   //!   is false and (allocation throws or value_type's move constructor throws)
+   //!
+   //! <b>Complexity</b>: Constant if allocator_traits_type::
+   //!   propagate_on_container_move_assignment is true or
+   //!   this->get>allocator() == x.get_allocator(). Linear otherwise.
+   hash_set& operator=(BOOST_RV_REF(hash_set) x)
+      BOOST_NOEXCEPT_IF(  allocator_traits_type::is_always_equal::value
+                                 && boost::container::container_detail::is_nothrow_move_assignable<Hash>::value
+                                 && boost::container::container_detail::is_nothrow_move_assignable<Pred>::value )
+   {  return static_cast<hash_set&>(this->base_t::operator=(BOOST_MOVE_BASE(base_t, x)));  }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   hash_set& operator=(std::initializer_list<value_type> il)
+   {
+      this->clear();
+      insert(il.begin(), il.end());
+      return *this;
+   }
+#endif
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   //! <b>Effects</b>: Returns a copy of the allocator that
+   //!   was passed to the object's constructor.
+   //!
+   //! <b>Complexity</b>: Constant.
+   allocator_type get_allocator() const;
+
+   //! <b>Effects</b>: Returns a reference to the internal allocator.
+   //!
+   //! <b>Throws</b>: Nothing
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   stored_allocator_type &get_stored_allocator();
+
+   //! <b>Effects</b>: Returns a reference to the internal allocator.
+   //!
+   //! <b>Throws</b>: Nothing
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   const stored_allocator_type &get_stored_allocator() const;
+
+   //! <b>Effects</b>: Returns an iterator to the first element contained in the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant
+   iterator begin();
+
+   //! <b>Effects</b>: Returns a const_iterator to the first element contained in the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator begin() const;
+
+   //! <b>Effects</b>: Returns a const_iterator to the first element contained in the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator cbegin() const;
+
+   //! <b>Effects</b>: Returns an iterator to the end of the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   iterator end();
+
+   //! <b>Effects</b>: Returns a const_iterator to the end of the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator end() const;
+
+   //! <b>Effects</b>: Returns a const_iterator to the end of the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator cend() const;
+
+   //! <b>Effects</b>: Returns true if the container contains no elements.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   bool empty() const;
+
+   //! <b>Effects</b>: Returns the number of the elements contained in the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type size() const;
+
+   //! <b>Effects</b>: Returns the largest possible size of the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type max_size() const;
+   #endif   //   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   //! <b>Effects</b>:  Inserts an object x of type Key constructed with
+   //!   std::forward<Args>(args)... if and only if there is
+   //!   no element in the container with equivalent value.
+   //!   and returns the iterator pointing to the
+   //!   newly inserted element.
+   //!
+   //! <b>Returns</b>: The bool component of the returned pair is true if and only
+   //!   if the insertion takes place, and the iterator component of the pair
+   //!   points to the element with key equivalent to the key of x.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or
+   //!   Key's in-place constructor throws.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   template <class... Args>
+   std::pair<iterator,bool> emplace(BOOST_FWD_REF(Args)... args)
+   {  return this->base_t::emplace_unique(boost::forward<Args>(args)...); }
+
+   //! <b>Effects</b>:  Inserts an object of type Key constructed with
+   //!   std::forward<Args>(args)... if and only if there is
+   //!   no element in the container with equivalent value.
+   //!   p is a hint that is ignored by this implementation.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   template <class... Args>
+   iterator emplace_hint(const_iterator p, BOOST_FWD_REF(Args)... args)
+   {  return this->base_t::emplace_hint_unique(p, boost::forward<Args>(args)...); }
+
+   #else // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   #define BOOST_CONTAINER_HASH_SET_EMPLACE_CODE(N) \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   std::pair<iterator,bool> emplace(BOOST_MOVE_UREF##N)\
+   {  return this->base_t::emplace_unique(BOOST_MOVE_FWD##N);  }\
+   \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   iterator emplace_hint(const_iterator hint BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
+   {  return this->base_t::emplace_hint_unique(hint BOOST_MOVE_I##N BOOST_MOVE_FWD##N); }\
+   //
+   BOOST_MOVE_ITERATE_0TO9(BOOST_CONTAINER_HASH_SET_EMPLACE_CODE)
+   #undef BOOST_CONTAINER_HASH_SET_EMPLACE_CODE
+
+   #endif   // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //! <b>Effects</b>: Inserts x if and only if there is no element in the container
+   //!   with key equivalent to the key of x.
+   //!
+   //! <b>Returns</b>: The bool component of the returned pair is true if and only
+   //!   if the insertion takes place, and the iterator component of the pair
+   //!   points to the element with key equivalent to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   std::pair<iterator, bool> insert(const value_type &x);
+
+   //! <b>Effects</b>: Move constructs a new value from x if and only if there is
+   //!   no element in the container with key equivalent to the key of x.
+   //!
+   //! <b>Returns</b>: The bool component of the returned pair is true if and only
+   //!   if the insertion takes place, and the iterator component of the pair
+   //!   points to the element with key equivalent to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   std::pair<iterator, bool> insert(value_type &&x);
+   #else
+   private:
+   typedef std::pair<iterator, bool> insert_return_pair;
+   public:
+   BOOST_MOVE_CONVERSION_AWARE_CATCH(insert, value_type, insert_return_pair, this->priv_insert)
+   #endif
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //! <b>Effects</b>: Inserts a copy of x in the container if and only if there is
+   //!   no element in the container with key equivalent to the key of x.
+   //!   p is a hint that is ignored by this implementation.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent
+   //!   to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(const_iterator p, const value_type &x);
+
+   //! <b>Effects</b>: Inserts an element move constructed from x in the container.
+   //!   p is a hint that is ignored by this implementation.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(const_iterator p, value_type &&x);
+   #else
+   BOOST_MOVE_CONVERSION_AWARE_CATCH_1ARG(insert, value_type, iterator, this->priv_insert, const_iterator, const_iterator)
+   #endif
+
+   //! <b>Requires</b>: first, last are not iterators into *this.
+   //!
+   //! <b>Effects</b>: inserts each element from the range [first,last) if and only
+   //!   if there is no element with key equivalent to the key of that element.
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is the distance from first to last.
+   //!
+   //! <b>Note</b>: If the allocator is a version 2 allocator and [first,last) are forward
+   //!   iterators, all nodes are allocated in a single call to the allocator.
+   template <class InputIterator>
+   void insert(InputIterator first, InputIterator last)
+   {  this->base_t::insert_unique(first, last);  }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: inserts each element from the range [il.begin(),il.end()) if and only
+   //!   if there is no element with key equivalent to the key of that element.
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is il.size().
+   void insert(std::initializer_list<value_type> il)
+   {  this->base_t::insert_unique(il.begin(), il.end()); }
+#endif
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   //! <b>Effects</b>: Erases the element pointed to by p.
+   //!
+   //! <b>Returns</b>: Returns an iterator pointing to the element immediately
+   //!   following q prior to the element being erased. If no such element exists,
+   //!   returns end().
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator erase(const_iterator p);
+
+   //! <b>Effects</b>: Erases all elements in the container with key equivalent to x.
+   //!
+   //! <b>Returns</b>: Returns the number of erased elements.
+   //!
+   //! <b>Complexity</b>: Average case count(k)
+   size_type erase(const key_type& x);
+
+   //! <b>Effects</b>: Erases all the elements in the range [first, last).
+   //!
+   //! <b>Returns</b>: Returns last.
+   //!
+   //! <b>Complexity</b>: Average case linear in N where N is the distance from first to last.
+   iterator erase(const_iterator first, const_iterator last);
+
+   //! <b>Effects</b>: Swaps the contents of *this and x.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   void swap(hash_set& x)
+      BOOST_NOEXCEPT_IF(  allocator_traits_type::is_always_equal::value
+                                 && boost::container::container_detail::is_nothrow_swappable<Hash>::value
+                                 && boost::container::container_detail::is_nothrow_swappable<Pred>::value );
+
+   //! <b>Effects</b>: erase(a.begin(),a.end()).
+   //!
+   //! <b>Postcondition</b>: size() == 0.
+   //!
+   //! <b>Complexity</b>: linear in size().
+   void clear();
+
+   //! <b>Effects</b>: Returns the hash function out of which a was constructed.
+   //!
+   //! <b>Complexity</b>: Constant.
+   hasher hash_function() const;
+
+   //! <b>Effects</b>: Returns the key equality predicate out of which a was constructed.
+   //!
+   //! <b>Complexity</b>: Constant.
+   key_equal key_eq() const;
+
+   //! <b>Returns</b>: An iterator pointing to an element with the key
+   //!   equivalent to x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator find(const key_type& x);
+
+   //! <b>Returns</b>: A const_iterator pointing to an element with the key
+   //!   equivalent to x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   const_iterator find(const key_type& x) const;
+
+   #endif   //#if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   //! <b>Returns</b>: The number of elements with key equivalent to x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   size_type count(const key_type& x) const
+   {  return static_cast<size_type>(this->base_t::find(x) != this->base_t::cend());  }
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   //! <b>Effects</b>: Equivalent to std::make_pair(this->find(x), ++this->find(x)) if x is found.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   std::pair<iterator,iterator> equal_range(const key_type& x);
+
+   //! <b>Effects</b>: Equivalent to std::make_pair(this->find(x), ++this->find(x)) if x is found.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   std::pair<const_iterator, const_iterator> equal_range(const key_type& x) const;
+
+   //! <b>Returns</b>: The number of buckets.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type bucket_count() const;
+
+   //! <b>Returns</b>: An upper bound on the number of buckets.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type max_bucket_count() const;
+
+   //! <b>Requires</b>: n < bucket_count().
+   //!
+   //! <b>Returns</b>: The number of elements in the nth bucket.
+   //!
+   //! <b>Complexity</b>: Linear in bucket_size(n).
+   size_type bucket_size(size_type n) const;
+
+   //! <b>Requires</b>: bucket_count() > 0.
+   //!
+   //! <b>Returns</b>: The index of the bucket in which elements with keys equivalent to k would be found.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type bucket(const key_type& k) const;
+
+   //! <b>Requires</b>: n < bucket_count().
+   //!
+   //! <b>Returns</b>: An iterator referring to the first element in the bucket.
+   //!
+   //! <b>Complexity</b>: Constant.
+   local_iterator begin(size_type n);
+
+   //! <b>Requires</b>: n < bucket_count().
+   //!
+   //! <b>Returns</b>: An iterator referring to the first element in the bucket.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_local_iterator begin(size_type n) const;
+
+   //! <b>Requires</b>: n < bucket_count().
+   //!
+   //! <b>Returns</b>: An iterator referring to the first element in the bucket.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_local_iterator cbegin(size_type n) const;
+
+   //! <b>Requires</b>: n < bucket_count().
+   //!
+   //! <b>Returns</b>: An iterator which is the past-the-end value for the bucket.
+   //!
+   //! <b>Complexity</b>: Constant.
+   local_iterator end(size_type n);
+
+   //! <b>Requires</b>: n < bucket_count().
+   //!
+   //! <b>Returns</b>: An iterator which is the past-the-end value for the bucket.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_local_iterator end(size_type n) const;
+
+   //! <b>Requires</b>: n < bucket_count().
+   //!
+   //! <b>Returns</b>: An iterator which is the past-the-end value for the bucket.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_local_iterator cend(size_type n) const;
+
+   //! <b>Returns</b>: The average number of elements per bucket.
+   //!
+   //! <b>Complexity</b>: Constant.
+   float load_factor() const;
+
+   //! <b>Returns</b>: The current maximum load factor.
+   //!
+   //! <b>Complexity</b>: Constant.
+   float max_load_factor() const;
+
+   //! <b>Effects</b>: Changes the container's maximum load factor, rehashing if needed.
+   //!
+   //! <b>Complexity</b>: Average case linear in size() if a rehash is performed, constant otherwise.
+   void max_load_factor(float z);
+
+   //! <b>Effects</b>: Changes the number of buckets so that there are at least n buckets
+   //!   and size() <= bucket_count()*max_load_factor(). The number of buckets is a power of two.
+   //!
+   //! <b>Complexity</b>: Linear in size() + bucket_count(). Hash values are cached
+   //!   in the nodes so the hash function is not called.
+   void rehash(size_type n);
+
+   //! <b>Effects</b>: Makes sure that n elements can be inserted without a rehash.
+   //!
+   //! <b>Complexity</b>: Linear in size() + bucket_count() if a rehash is performed, constant otherwise.
+   void reserve(size_type n);
+
+   //! <b>Effects</b>: Returns true if x and y have the same elements.
+   //!
+   //! <b>Complexity</b>: Average case linear in x.size().
+   friend bool operator==(const hash_set& x, const hash_set& y);
+
+   //! <b>Effects</b>: Returns true if x and y are unequal
+   //!
+   //! <b>Complexity</b>: Average case linear in x.size().
+   friend bool operator!=(const hash_set& x, const hash_set& y);
+
+   //! <b>Effects</b>: Returns the hash value of x. Equal containers have equal hash values.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend std::size_t hash_value(const hash_set& x);
+
+   //! <b>Effects</b>: x.swap(y)
+   //!
+   //! <b>Complexity</b>: Constant.
+   friend void swap(hash_set& x, hash_set& y);
+
+   #endif   //#if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   template <class KeyType>
+   std::pair<iterator, bool> priv_insert(BOOST_FWD_REF(KeyType) x)
+   {  return this->base_t::insert_unique(::boost::forward<KeyType>(x));  }
+
+   template <class KeyType>
+   iterator priv_insert(const_iterator p, BOOST_FWD_REF(KeyType) x)
+   {  return this->base_t::insert_unique(p, ::boost::forward<KeyType>(x)); }
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+#ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! A hash_multiset is a kind of unordered associative container that supports equivalent keys
+//! (possibly contains multiple copies of the same key value) and provides for
+//! fast retrieval of the keys themselves. Equivalent keys are adjacent in the iteration order.
+//! Class hash_multiset supports forward iterators.
+//!
+//! A hash_multiset satisfies all of the requirements of a container and of an unordered
+//! associative container.
+//!
+//! \tparam Key is the type to be inserted in the multiset, which is also the key_type
+//! \tparam Hash is the hash function used to compute the hash value of keys
+//! \tparam Pred is the equality predicate used to compare keys
+//! \tparam Allocator is the allocator to be used to allocate memory for this container
+template <class Key, class Hash = boost::hash<Key>, class Pred = std::equal_to<Key>, class Allocator = new_allocator<Key> >
+#else
+template <class Key, class Hash, class Pred, class Allocator>
+#endif
+class hash_multiset
+   ///@cond
+   : public container_detail::hash_table
+      < Key, Key, container_detail::identity<Key>, Hash, Pred, Allocator>
+   ///@endcond
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   BOOST_COPYABLE_AND_MOVABLE(hash_multiset)
+   typedef container_detail::hash_table
+      < Key, Key, container_detail::identity<Key>, Hash, Pred, Allocator> base_t;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+
+   //////////////////////////////////////////////
+   //
+   //                    types
+   //
+   //////////////////////////////////////////////
+   typedef Key                                                                         key_type;
+   typedef Key                                                                         value_type;
+   typedef Hash                                                                        hasher;
+   typedef Pred                                                                        key_equal;
+   typedef ::boost::container::allocator_traits<Allocator>                             allocator_traits_type;
+   typedef typename ::boost::container::allocator_traits<Allocator>::pointer           pointer;
+   typedef typename ::boost::container::allocator_traits<Allocator>::const_pointer     const_pointer;
+   typedef typename ::boost::container::allocator_traits<Allocator>::reference         reference;
+   typedef typename ::boost::container::allocator_traits<Allocator>::const_reference   const_reference;
+   typedef typename ::boost::container::allocator_traits<Allocator>::size_type         size_type;
+   typedef typename ::boost::container::allocator_traits<Allocator>::difference_type   difference_type;
+   typedef Allocator                                                                   allocator_type;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::stored_allocator_type)              stored_allocator_type;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::iterator)                           iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::const_iterator)                     const_iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::local_iterator)                     local_iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::const_local_iterator)               const_local_iterator;
+
+   //////////////////////////////////////////////
+   //
+   //          construct/copy/destroy
+   //
+   //////////////////////////////////////////////
+
+   //! @copydoc ::boost::container::hash_set::hash_set()
+   hash_multiset()
+      : base_t()
+   {}
+
+   //! @copydoc ::boost::container::hash_set::hash_set(size_type, const hasher&, const key_equal&, const allocator_type&)
+   explicit hash_multiset(size_type n, const hasher& hf = hasher(), const key_equal& eql = key_equal(),
+                          const allocator_type& a = allocator_type())
+      : base_t(n, hf, eql, a)
+   {}
+
+   //! @copydoc ::boost::container::hash_set::hash_set(const allocator_type&)
+   explicit hash_multiset(const allocator_type& a)
+      : base_t(a)
+   {}
+
+   //! @copydoc ::boost::container::hash_set::hash_set(InputIterator, InputIterator, size_type, const hasher&, const key_equal&, const allocator_type&)
+   template <class InputIterator>
+   hash_multiset(InputIterator first, InputIterator last, size_type n = 0, const hasher& hf = hasher(),
+                 const key_equal& eql = key_equal(), const allocator_type& a = allocator_type())
+      : base_t(n, hf, eql, a)
+   {  this->base_t::insert_equal(first, last);  }
+
+   //! @copydoc ::boost::container::hash_set::hash_set(InputIterator, InputIterator, const allocator_type&)
+   template <class InputIterator>
+   hash_multiset(InputIterator first, InputIterator last, const allocator_type& a)
+      : base_t(a)
+   {  this->base_t::insert_equal(first, last);  }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! @copydoc ::boost::container::hash_set::hash_set(std::initializer_list<value_type>, size_type, const hasher&, const key_equal&, const allocator_type&)
+   hash_multiset(std::initializer_list<value_type> il, size_type n = 0, const hasher& hf = hasher(),
+                 const key_equal& eql = key_equal(), const allocator_type& a = allocator_type())
+      : base_t(n, hf, eql, a)
+   {  this->base_t::insert_equal(il.begin(), il.end());  }
+
+   //! @copydoc ::boost::container::hash_set::hash_set(std::initializer_list<value_type>, const allocator_type&)
+   hash_multiset(std::initializer_list<value_type> il, const allocator_type& a)
+      : base_t(a)
+   {  this->base_t::insert_equal(il.begin(), il.end());  }
+#endif
+
+   //! @copydoc ::boost::container::hash_set::hash_set(const hash_set &)
+   hash_multiset(const hash_multiset& x)
+      : base_t(static_cast<const base_t&>(x))
+   {}
+
+   //! @copydoc ::boost::container::hash_set(hash_set &&)
+   hash_multiset(BOOST_RV_REF(hash_multiset) x)
+      : base_t(BOOST_MOVE_BASE(base_t, x))
+   {}
+
+   //! @copydoc ::boost::container::hash_set(const hash_set &, const allocator_type &)
+   hash_multiset(const hash_multiset& x, const allocator_type &a)
+      : base_t(static_cast<const base_t&>(x), a)
+   {}
+
+   //! @copydoc ::boost::container::hash_set(hash_set &&, const allocator_type &)
+   hash_multiset(BOOST_RV_REF(hash_multiset) x, const allocator_type &a)
+      : base_t(BOOST_MOVE_BASE(base_t, x), a)
+   {}
+
+   //! @copydoc ::boost::container::hash_set::operator=(const hash_set &)
+   hash_multiset& operator=(BOOST_COPY_ASSIGN_REF(hash_multiset) x)
+   {  return static_cast<hash_multiset&>(this->base_t::operator=(static_cast<const base_t&>(x)));  }
+
+   //! @copydoc ::boost::container::hash_set::operator=(hash_set &&)
+   hash_multiset& operator=(BOOST_RV_REF(hash_multiset) x)
+      BOOST_NOEXCEPT_IF(  allocator_traits_type::is_always_equal::value
+                                 && boost::container::container_detail::is_nothrow_move_assignable<Hash>::value
+                                 && boost::container::container_detail::is_nothrow_move_assignable<Pred>::value )
+   {  return static_cast<hash_multiset&>(this->base_t::operator=(BOOST_MOVE_BASE(base_t, x)));  }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! @copydoc ::boost::container::hash_set::operator=(std::initializer_list<value_type>)
+   hash_multiset& operator=(std::initializer_list<value_type> il)
+   {
+      this->clear();
+      insert(il.begin(), il.end());
+      return *this;
+   }
+#endif
+
+   #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   //! <b>Effects</b>: Inserts an object of type Key constructed with
+   //!   std::forward<Args>(args)... and returns the iterator pointing to the
+   //!   newly inserted element.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   template <class... Args>
+   iterator emplace(BOOST_FWD_REF(Args)... args)
+   {  return this->base_t::emplace_equal(boost::forward<Args>(args)...); }
+
+   //! <b>Effects</b>: Inserts an object of type Key constructed with
+   //!   std::forward<Args>(args)... p is a hint that is ignored by this implementation.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent
+   //!   to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   template <class... Args>
+   iterator emplace_hint(const_iterator p, BOOST_FWD_REF(Args)... args)
+   {  return this->base_t::emplace_hint_equal(p, boost::forward<Args>(args)...); }
+
+   #else // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   #define BOOST_CONTAINER_HASH_MULTISET_EMPLACE_CODE(N) \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   iterator emplace(BOOST_MOVE_UREF##N)\
+   {  return this->base_t::emplace_equal(BOOST_MOVE_FWD##N);  }\
+   \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   iterator emplace_hint(const_iterator hint BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
+   {  return this->base_t::emplace_hint_equal(hint BOOST_MOVE_I##N BOOST_MOVE_FWD##N);  }\
+   //
+   BOOST_MOVE_ITERATE_0TO9(BOOST_CONTAINER_HASH_MULTISET_EMPLACE_CODE)
+   #undef BOOST_CONTAINER_HASH_MULTISET_EMPLACE_CODE
+
+   #endif   // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //! <b>Effects</b>: Inserts x and returns the iterator pointing to the
+   //!   newly inserted element.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(const value_type &x);
+
+   //! <b>Effects</b>: Inserts a copy of x in the container.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent
+   //!   to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(value_type &&x);
+   #else
+   BOOST_MOVE_CONVERSION_AWARE_CATCH(insert, value_type, iterator, this->priv_insert)
+   #endif
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //! <b>Effects</b>: Inserts a copy of x in the container.
+   //!   p is a hint that is ignored by this implementation.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent
+   //!   to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(const_iterator p, const value_type &x);
+
+   //! <b>Effects</b>: Inserts a value move constructed from x in the container.
+   //!   p is a hint that is ignored by this implementation.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent
+   //!   to the key of x.
+   //!
+   //! <b>Complexity</b>: Average case constant.
+   iterator insert(const_iterator p, value_type &&x);
+   #else
+   BOOST_MOVE_CONVERSION_AWARE_CATCH_1ARG(insert, value_type, iterator, this->priv_insert, const_iterator, const_iterator)
+   #endif
+
+   //! <b>Requires</b>: first, last are not iterators into *this.
+   //!
+   //! <b>Effects</b>: inserts each element from the range [first,last) .
+   //!
+   //! <b>Complexity</b>: Average case linear in N, where N is the distance from first to last.
+   //!
+   //! <b>Note</b>: If the allocator is a version 2 allocator and [first,last) are forward
+   //!   iterators, all nodes are allocated in a single call to the allocator.
+   template <class InputIterator>
+   void insert(InputIterator first, InputIterator last)
+   {  this->base_t::insert_equal(first, last);  }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! @copydoc ::boost::container::hash_set::insert(std::initializer_list<value_type>)
+   void insert(std::initializer_list<value_type> il)
+   {  this->base_t::insert_equal(il.begin(), il.end());  }
+#endif
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   template <class KeyType>
+   iterator priv_insert(BOOST_FWD_REF(KeyType) x)
+   {  return this->base_t::insert_equal(::boost::forward<KeyType>(x));  }
+
+   template <class KeyType>
+   iterator priv_insert(const_iterator p, BOOST_FWD_REF(KeyType) x)
+   {  return this->base_t::insert_equal(p, ::boost::forward<KeyType>(x)); }
+
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+}}
+
+#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+namespace std {
+
+//!std::hash specialization, equivalent to boost::hash
+template <class Key, class Hash, class Pred, class Allocator>
+struct hash< ::boost::container::hash_set<Key, Hash, Pred, Allocator> >
+{
+   std::size_t operator()(const ::boost::container::hash_set<Key, Hash, Pred, Allocator> &x) const
+   {  return ::boost::hash< ::boost::container::hash_set<Key, Hash, Pred, Allocator> >()(x);  }
+};
+
+//!std::hash specialization, equivalent to boost::hash
+template <class Key, class Hash, class Pred, class Allocator>
+struct hash< ::boost::container::hash_multiset<Key, Hash, Pred, Allocator> >
+{
+   std::size_t operator()(const ::boost::container::hash_multiset<Key, Hash, Pred, Allocator> &x) const
+   {  return ::boost::hash< ::boost::container::hash_multiset<Key, Hash, Pred, Allocator> >()(x);  }
+};
+
+}  //namespace std {
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   // BOOST_CONTAINER_HASH_SET_HPP
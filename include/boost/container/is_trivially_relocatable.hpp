@@ -0,0 +1,153 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_IS_TRIVIALLY_RELOCATABLE_HPP
+#define BOOST_CONTAINER_IS_TRIVIALLY_RELOCATABLE_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/detail/type_traits.hpp>
+
+//!\file
+
+namespace boost {
+namespace container {
+
+//! <b>Remark</b>: if is_trivially_relocatable<T>::value is true, moving an object of type T
+//! to uninitialized memory and destroying the source can be done copying its bytes
+//! with std::memcpy or std::memmove, without calling T's move constructor and destructor.
+//! This holds for most types that don't store pointers to themselves or to their subobjects.
+//! vector (and so small_vector and flat associative containers) and devector use this property
+//! to reallocate their elements and to insert elements in the middle of the sequence.
+//!
+//! By default it is true for trivially copyable types. Specialize it as true for a
+//! user-defined type (or class template) that can be relocated with std::memcpy:
+//!
+//! \code
+//! namespace boost { namespace container {
+//!
+//! template<>
+//! struct is_trivially_relocatable<my_handle>
+//! {
+//!    static const bool value = true;
+//! };
+//!
+//! }} //namespace boost { namespace container {
+//! \endcode
+//!
+//! vector, devector, deque, static_vector and basic_string are trivially relocatable if their
+//! elements (for static_vector), allocator and pointer types are.
+//! list, slist, stable_vector, small_vector and tree-based containers are not, as they
+//! store a header node or their elements inside the container object.
+template<class T>
+struct is_trivially_relocatable
+{
+   static const bool value = container_detail::is_trivially_copy_constructible<T>::value &&
+                             container_detail::is_trivially_destructible<T>::value;
+};
+
+#if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+template<class T>
+struct is_trivially_relocatable<const T>
+   : is_trivially_relocatable<T>
+{};
+
+template<class T1, class T2>
+struct is_trivially_relocatable< std::pair<T1, T2> >
+{
+   static const bool value = is_trivially_relocatable<T1>::value &&
+                             is_trivially_relocatable<T2>::value;
+};
+
+namespace container_detail {
+
+template <class T1, class T2>
+struct pair;
+
+}  //namespace container_detail {
+
+template<class T1, class T2>
+struct is_trivially_relocatable< container_detail::pair<T1, T2> >
+{
+   static const bool value = is_trivially_relocatable<T1>::value &&
+                             is_trivially_relocatable<T2>::value;
+};
+
+//Stateless allocators
+
+template<class T>
+struct is_trivially_relocatable< std::allocator<T> >
+{
+   static const bool value = true;
+};
+
+template<class T>
+struct is_trivially_relocatable< new_allocator<T> >
+{
+   static const bool value = true;
+};
+
+template<class T, unsigned Version, unsigned int AllocationDisableMask>
+struct is_trivially_relocatable< allocator<T, Version, AllocationDisableMask> >
+{
+   static const bool value = true;
+};
+
+template<class T, std::size_t NodesPerBlock, std::size_t Version>
+struct is_trivially_relocatable< node_allocator<T, NodesPerBlock, Version> >
+{
+   static const bool value = true;
+};
+
+template < class T, std::size_t NodesPerBlock, std::size_t MaxFreeBlocks
+         , std::size_t OverheadPercent, unsigned Version>
+struct is_trivially_relocatable< adaptive_pool<T, NodesPerBlock, MaxFreeBlocks, OverheadPercent, Version> >
+{
+   static const bool value = true;
+};
+
+template<class T, unsigned int Flags, std::size_t ReserveFactor>
+struct is_trivially_relocatable< mmap_allocator<T, Flags, ReserveFactor> >
+{
+   static const bool value = true;
+};
+
+namespace container_detail {
+
+//A container whose object only holds its allocator and pointers to the elements
+template<class Allocator>
+struct is_trivially_relocatable_container
+{
+   typedef typename allocator_traits<Allocator>::pointer pointer;
+   static const bool value = is_trivially_relocatable<Allocator>::value &&
+                             is_trivially_relocatable<pointer>::value;
+};
+
+}  //namespace container_detail {
+
+#endif   //#if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //#ifndef BOOST_CONTAINER_IS_TRIVIALLY_RELOCATABLE_HPP
@@ -0,0 +1,290 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_MMAP_ALLOCATOR_HPP
+#define BOOST_CONTAINER_MMAP_ALLOCATOR_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/throw_exception.hpp>
+#include <boost/container/detail/allocation_type.hpp>
+#include <boost/container/detail/mmap_block.hpp>
+#include <boost/container/detail/version_type.hpp>
+#include <boost/static_assert.hpp>
+#include <cstddef>
+
+//!\file
+
+namespace boost {
+namespace container {
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+template<unsigned int Flags, std::size_t ReserveFactor>
+class mmap_allocator<void, Flags, ReserveFactor>
+{
+   typedef mmap_allocator<void, Flags, ReserveFactor>   self_t;
+   public:
+   typedef void                                 value_type;
+   typedef void *                               pointer;
+   typedef const void*                          const_pointer;
+   typedef std::size_t                          size_type;
+   typedef std::ptrdiff_t                       difference_type;
+   typedef boost::container::container_detail::
+      version_type<self_t, 2>                   version;
+
+   //!Obtains an allocator that allocates
+   //!objects of type T2
+   template<class T2>
+   struct rebind
+   {
+      typedef mmap_allocator<T2, Flags, ReserveFactor> other;
+   };
+
+   //!Default constructor
+   //!Never throws
+   mmap_allocator() BOOST_NOEXCEPT_OR_NOTHROW
+   {}
+
+   //!Constructor from other mmap_allocator.
+   //!Never throws
+   mmap_allocator(const mmap_allocator &) BOOST_NOEXCEPT_OR_NOTHROW
+   {}
+
+   //!Constructor from related mmap_allocator.
+   //!Never throws
+   template<class T2>
+   mmap_allocator(const mmap_allocator<T2, Flags, ReserveFactor> &) BOOST_NOEXCEPT_OR_NOTHROW
+   {}
+};
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! An extended allocator (Version 2) for vector-like containers that hold huge
+//! amounts of data. Blocks bigger than 128KB are mapped directly with mmap, smaller ones
+//! are obtained from std::malloc.
+//!
+//! Each mapped block reserves ReserveFactor times the requested size of address space
+//! (without committing memory, MAP_NORESERVE) so that the container can later expand
+//! it forward in place through allocation_command: no element is copied, peak memory
+//! does not double while reallocating and only the newly used pages are faulted in.
+//! When the reservation is exhausted the mapping is grown in place with mremap (Linux)
+//! if the following address space is free.
+//!
+//! Flags is an inclusive OR of mmap_allocator_flags values:
+//!   - mmap_huge_pages: blocks are aligned to 2MB and advised with MADV_HUGEPAGE,
+//!     so that transparent huge pages back them and TLB misses are reduced.
+//!   - mmap_populate: committed memory is populated by the kernel in a single call
+//!     (MADV_POPULATE_WRITE, Linux 5.14) when the block is allocated or expanded.
+//!   - mmap_prefault: committed memory is written page by page when the block is allocated
+//!     or expanded, so that later accesses don't page fault.
+//!
+//! shrink_to_fit() returns the unused pages to the system but keeps the address space.
+//! This allocator does not offer node allocation functions (allocate_one, allocate_many...).
+//! It's only available in POSIX systems.
+template<class T, unsigned int Flags, std::size_t ReserveFactor>
+class mmap_allocator
+{
+   typedef unsigned int allocation_type;
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+
+   //Self type
+   typedef mmap_allocator<T, Flags, ReserveFactor>   self_t;
+
+   //Not assignable from related allocator
+   template<class T2, unsigned int Flags2, std::size_t ReserveFactor2>
+   mmap_allocator& operator=(const mmap_allocator<T2, Flags2, ReserveFactor2>&);
+
+   //Not assignable from other allocator
+   mmap_allocator& operator=(const mmap_allocator&);
+
+   BOOST_STATIC_ASSERT(( ReserveFactor > 0u ));
+   BOOST_STATIC_ASSERT(( (Flags & ~unsigned(mmap_huge_pages | mmap_populate | mmap_prefault)) == 0u ));
+
+   static const std::size_t HeaderSize = container_detail::mmap_block_header_size;
+
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   typedef T                                    value_type;
+   typedef T *                                  pointer;
+   typedef const T *                            const_pointer;
+   typedef T &                                  reference;
+   typedef const T &                            const_reference;
+   typedef std::size_t                          size_type;
+   typedef std::ptrdiff_t                       difference_type;
+
+   typedef boost::container::container_detail::
+      version_type<self_t, 2>                      version;
+
+   //!Obtains an allocator that allocates
+   //!objects of type T2
+   template<class T2>
+   struct rebind
+   {
+      typedef mmap_allocator<T2, Flags, ReserveFactor> other;
+   };
+
+   //!Default constructor
+   //!Never throws
+   mmap_allocator() BOOST_NOEXCEPT_OR_NOTHROW
+   {}
+
+   //!Constructor from other mmap_allocator.
+   //!Never throws
+   mmap_allocator(const mmap_allocator &) BOOST_NOEXCEPT_OR_NOTHROW
+   {}
+
+   //!Constructor from related mmap_allocator.
+   //!Never throws
+   template<class T2>
+   mmap_allocator(const mmap_allocator<T2, Flags, ReserveFactor> &) BOOST_NOEXCEPT_OR_NOTHROW
+   {}
+
+   //!Allocates memory for an array of count elements.
+   //!Throws std::bad_alloc if there is no enough memory
+   pointer allocate(size_type count, const void * hint= 0)
+   {
+      (void)hint;
+      if(count > this->max_size())
+         boost::container::throw_bad_alloc();
+      pointer const ret = this->priv_allocate(count);
+      if(!ret)
+         boost::container::throw_bad_alloc();
+      return ret;
+   }
+
+   //!Deallocates previously allocated memory.
+   //!Never throws
+   void deallocate(pointer ptr, size_type) BOOST_NOEXCEPT_OR_NOTHROW
+   {  container_detail::mmap_block_deallocate(priv_block(ptr));  }
+
+   //!Returns the maximum number of elements that could be allocated.
+   //!Never throws
+   size_type max_size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return (size_type(-1)/2u - HeaderSize)/sizeof(T);   }
+
+   //!Swaps two allocators, does nothing
+   //!because this allocator is stateless
+   friend void swap(self_t &, self_t &) BOOST_NOEXCEPT_OR_NOTHROW
+   {}
+
+   //!An allocator always compares to true, as memory allocated with one
+   //!instance can be deallocated by another instance
+   friend bool operator==(const mmap_allocator &, const mmap_allocator &) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return true;   }
+
+   //!An allocator always compares to false, as memory allocated with one
+   //!instance can be deallocated by another instance
+   friend bool operator!=(const mmap_allocator &, const mmap_allocator &) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return false;   }
+
+   //!An advanced function that offers in-place forward expansion, shrink to fit and new allocation
+   //!capabilities. Backwards expansion is never performed. Memory allocated with this function
+   //!can only be deallocated with deallocate().
+   pointer allocation_command(allocation_type command,
+                         size_type limit_size,
+                         size_type &prefer_in_recvd_out_size,
+                         pointer &reuse)
+   {
+      pointer ret = this->priv_allocation_command(command, limit_size, prefer_in_recvd_out_size, reuse);
+      if(!ret && !(command & nothrow_allocation))
+         boost::container::throw_bad_alloc();
+      return ret;
+   }
+
+   //!Returns maximum the number of objects the previously allocated memory
+   //!pointed by p can hold.
+   size_type size(pointer p) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return (container_detail::mmap_block_size(priv_block(p)) - HeaderSize)/sizeof(T);  }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+
+   static void *priv_block(pointer p)
+   {  return reinterpret_cast<char*>(p) - HeaderSize;  }
+
+   static pointer priv_user_ptr(void *block)
+   {  return block ? reinterpret_cast<pointer>(static_cast<char*>(block) + HeaderSize) : pointer();  }
+
+   static std::size_t priv_bytes(size_type count)
+   {  return HeaderSize + count*sizeof(T);  }
+
+   //Address space to reserve for a block of "bytes" bytes
+   static std::size_t priv_reserve_bytes(std::size_t bytes)
+   {  return bytes > std::size_t(-1)/2u/ReserveFactor ? bytes : bytes*ReserveFactor;  }
+
+   static pointer priv_allocate(size_type count)
+   {
+      const std::size_t bytes = priv_bytes(count);
+      return priv_user_ptr(container_detail::mmap_block_allocate(bytes, priv_reserve_bytes(bytes), Flags));
+   }
+
+   pointer priv_allocation_command
+      (allocation_type command,    std::size_t limit_size
+      ,size_type &prefer_in_recvd_out_size
+      ,pointer &reuse_ptr)
+   {
+      const size_type preferred_size = prefer_in_recvd_out_size;
+      if(command & (shrink_in_place | try_shrink_in_place)){
+         if(!reuse_ptr)
+            return pointer();
+         const std::size_t received = container_detail::mmap_block_shrink
+            (priv_block(reuse_ptr), priv_bytes(preferred_size), !(command & shrink_in_place));
+         prefer_in_recvd_out_size = (received - HeaderSize)/sizeof(T);
+         return reuse_ptr;
+      }
+
+      const pointer old_ptr = reuse_ptr;
+      reuse_ptr = pointer();
+      if((limit_size > this->max_size()) | (preferred_size > this->max_size())){
+         return pointer();
+      }
+      if((command & expand_fwd) && old_ptr){
+         const std::size_t pref_bytes = priv_bytes(preferred_size);
+         const std::size_t received = container_detail::mmap_block_expand
+            (priv_block(old_ptr), priv_bytes(limit_size), pref_bytes, priv_reserve_bytes(pref_bytes), Flags);
+         if(received){
+            prefer_in_recvd_out_size = (received - HeaderSize)/sizeof(T);
+            reuse_ptr = old_ptr;
+            return old_ptr;
+         }
+      }
+      if(command & allocate_new){
+         pointer ret = priv_allocate(preferred_size);
+         if(!ret && limit_size < preferred_size){
+            ret = priv_allocate(limit_size);
+         }
+         if(ret){
+            prefer_in_recvd_out_size = this->size(ret);
+         }
+         return ret;
+      }
+      return pointer();
+   }
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_MMAP_ALLOCATOR_HPP
@@ -329,7 +329,7 @@ class node_allocator
       {
          void* reuse_ptr_void = reuse;
          ret = boost_cont_allocation_command(command, sizeof(T), l_size, p_size, &r_size, reuse_ptr_void);
-         reuse = static_cast<T*>(reuse_ptr_void);
+         reuse = ret.second ? static_cast<T*>(reuse_ptr_void) : 0;
       }
       prefer_in_recvd_out_size = r_size/sizeof(T);
       return (pointer)ret.first;
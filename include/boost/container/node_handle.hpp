@@ -0,0 +1,342 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_NODE_HANDLE_HPP
+#define BOOST_CONTAINER_NODE_HANDLE_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container
+#include <boost/container/allocator_traits.hpp>
+// container/detail
+#include <boost/container/detail/allocator_version_traits.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/placement_new.hpp>
+#include <boost/container/detail/to_raw_pointer.hpp>
+#include <boost/container/detail/type_traits.hpp>
+// move
+#include <boost/move/utility_core.hpp>
+#include <boost/move/adl_move_swap.hpp>
+// other
+#include <boost/assert.hpp>
+
+//!\file
+
+namespace boost {
+namespace container {
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//KeyMapped is void for sets. For maps it's a pair whose first_type
+//and second_type are the key and the mapped type.
+template<class Value, class KeyMapped, bool IsSet = container_detail::is_same<KeyMapped, void>::value>
+struct node_handle_keymapped_traits
+{
+   typedef Value  key_type;
+   typedef Value  mapped_type;
+};
+
+template<class Value, class KeyMapped>
+struct node_handle_keymapped_traits<Value, KeyMapped, false>
+{
+   typedef typename KeyMapped::first_type    key_type;
+   typedef typename KeyMapped::second_type   mapped_type;
+};
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! A node_handle owns a single element extracted from an associative container
+//! ("Splicing Maps and Sets", N3586). The element's node is the one that was allocated
+//! by the container, so the element can be inserted in a compatible container (same
+//! node type and equal allocator) without any allocation, copy or move.
+//!
+//! An empty node_handle owns no element. A non-empty node_handle also stores a copy
+//! of the allocator of the container the element was extracted from.
+//!
+//! NodeAllocator is the node allocator of the container. KeyMapped is void for sets
+//! and a pair holding the key and mapped types for maps.
+template <class NodeAllocator, class KeyMapped = void>
+class node_handle
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   typedef NodeAllocator                                                      nallocator_type;
+   typedef allocator_traits<NodeAllocator>                                    nator_traits;
+   typedef container_detail::allocator_version_traits<NodeAllocator>          nator_version_traits;
+   typedef typename nator_traits::value_type                                  priv_node_t;
+   typedef typename priv_node_t::value_type                                   priv_value_t;
+   typedef node_handle_keymapped_traits<priv_value_t, KeyMapped>              keymapped_t;
+
+   BOOST_MOVABLE_BUT_NOT_COPYABLE(node_handle)
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   typedef priv_value_t                                                       value_type;
+   typedef typename keymapped_t::key_type                                     key_type;
+   typedef typename keymapped_t::mapped_type                                  mapped_type;
+   typedef typename nator_traits::template portable_rebind_alloc
+      <value_type>::type                                                      allocator_type;
+   typedef typename nator_traits::pointer                                     node_pointer;
+
+   //! <b>Effects</b>: Constructs an empty node_handle.
+   //!
+   //! <b>Throws</b>: Nothing.
+   node_handle() BOOST_NOEXCEPT_OR_NOTHROW
+      : m_ptr()
+   {}
+
+   //! <b>Effects</b>: Constructs a node_handle that owns the node pointed by p, which was allocated
+   //!   by al or an equal allocator.
+   //!
+   //! <b>Note</b>: Used by containers, not intended to be called by users.
+   node_handle(const node_pointer &p, const nallocator_type &al) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_ptr(p)
+   {
+      if(m_ptr){
+         ::new(static_cast<void*>(this->priv_alloc_ptr()), boost_container_new_t()) nallocator_type(al);
+      }
+   }
+
+   //! <b>Effects</b>: Constructs a node_handle that takes the element and the allocator of nh.
+   //!   nh is left empty.
+   //!
+   //! <b>Throws</b>: Nothing.
+   node_handle(BOOST_RV_REF(node_handle) nh) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_ptr(nh.m_ptr)
+   {
+      if(m_ptr){
+         ::new(static_cast<void*>(this->priv_alloc_ptr()), boost_container_new_t())
+            nallocator_type(::boost::move(nh.node_alloc()));
+         nh.priv_destroy_alloc();
+         nh.m_ptr = node_pointer();
+      }
+   }
+
+   //! <b>Effects</b>: If !empty(), destroys the element and deallocates its node.
+   ~node_handle() BOOST_NOEXCEPT_OR_NOTHROW
+   {  this->priv_reset();  }
+
+   //! <b>Effects</b>: If !empty(), destroys the element and deallocates its node.
+   //!   Then takes the element and the allocator of nh and leaves nh empty.
+   //!
+   //! <b>Throws</b>: Nothing.
+   node_handle & operator=(BOOST_RV_REF(node_handle) nh) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(this != &nh){
+         this->priv_reset();
+         if(nh.m_ptr){
+            ::new(static_cast<void*>(this->priv_alloc_ptr()), boost_container_new_t())
+               nallocator_type(::boost::move(nh.node_alloc()));
+            nh.priv_destroy_alloc();
+            m_ptr = nh.m_ptr;
+            nh.m_ptr = node_pointer();
+         }
+      }
+      return *this;
+   }
+
+   //! <b>Requires</b>: !empty().
+   //!
+   //! <b>Returns</b>: A reference to the element owned by the node_handle.
+   value_type& value() const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(!this->empty());
+      return m_ptr->get_data();
+   }
+
+   //! <b>Requires</b>: !empty() and the node_handle was extracted from a map or multimap.
+   //!
+   //! <b>Returns</b>: A non-const reference to the key of the element, so that the key can be
+   //!   modified before inserting the element in another container.
+   key_type& key() const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(!this->empty());
+      return m_ptr->m_data.first;
+   }
+
+   //! <b>Requires</b>: !empty() and the node_handle was extracted from a map or multimap.
+   //!
+   //! <b>Returns</b>: A reference to the mapped value of the element.
+   mapped_type& mapped() const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(!this->empty());
+      return m_ptr->m_data.second;
+   }
+
+   //! <b>Requires</b>: !empty().
+   //!
+   //! <b>Returns</b>: A copy of the allocator of the container the element was extracted from.
+   allocator_type get_allocator() const
+   {
+      BOOST_ASSERT(!this->empty());
+      return allocator_type(this->node_alloc());
+   }
+
+   #ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
+   //! <b>Returns</b>: !empty().
+   explicit operator bool
+   #else
+   private: struct bool_conversion {int for_bool; int for_arg(); }; typedef int bool_conversion::* explicit_bool_arg;
+   public: operator explicit_bool_arg
+   #endif
+      ()const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_ptr ? &bool_conversion::for_bool  : explicit_bool_arg(0);  }
+
+   //! <b>Returns</b>: true if the node_handle owns no element.
+   bool empty() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !this->m_ptr;  }
+
+   //! <b>Effects</b>: Exchanges the elements and allocators of *this and nh.
+   //!
+   //! <b>Throws</b>: Nothing.
+   void swap(node_handle &nh) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(m_ptr && nh.m_ptr){
+         ::boost::adl_move_swap(this->node_alloc(), nh.node_alloc());
+         ::boost::adl_move_swap(m_ptr, nh.m_ptr);
+      }
+      else if(m_ptr || nh.m_ptr){
+         node_handle &full  = m_ptr ? *this : nh;
+         node_handle &empty = m_ptr ? nh : *this;
+         ::new(static_cast<void*>(empty.priv_alloc_ptr()), boost_container_new_t())
+            nallocator_type(::boost::move(full.node_alloc()));
+         full.priv_destroy_alloc();
+         empty.m_ptr = full.m_ptr;
+         full.m_ptr = node_pointer();
+      }
+   }
+
+   //! <b>Effects</b>: Exchanges the elements and allocators of x and y.
+   friend void swap(node_handle & x, node_handle & y) BOOST_NOEXCEPT_OR_NOTHROW
+   {  x.swap(y);  }
+
+   //! <b>Effects</b>: Leaves the node_handle empty without destroying the element,
+   //!   transferring the ownership of the node to the caller.
+   //!
+   //! <b>Returns</b>: The owned node.
+   //!
+   //! <b>Note</b>: Used by containers, not intended to be called by users.
+   node_pointer release() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const node_pointer p(m_ptr);
+      if(m_ptr){
+         this->priv_destroy_alloc();
+         m_ptr = node_pointer();
+      }
+      return p;
+   }
+
+   //! <b>Returns</b>: The owned node.
+   //!
+   //! <b>Note</b>: Used by containers, not intended to be called by users.
+   const node_pointer &get() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_ptr;  }
+
+   //! <b>Requires</b>: !empty().
+   //!
+   //! <b>Returns</b>: The node allocator.
+   //!
+   //! <b>Note</b>: Used by containers, not intended to be called by users.
+   nallocator_type &node_alloc() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(!this->empty());
+      return *this->priv_alloc_ptr();
+   }
+
+   //! <b>Requires</b>: !empty().
+   //!
+   //! <b>Returns</b>: The node allocator.
+   //!
+   //! <b>Note</b>: Used by containers, not intended to be called by users.
+   const nallocator_type &node_alloc() const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(!this->empty());
+      return *this->priv_alloc_ptr();
+   }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   nallocator_type *priv_alloc_ptr() const
+   {  return static_cast<nallocator_type*>(static_cast<void*>(const_cast<storage_t*>(&m_nalloc_storage)));  }
+
+   void priv_destroy_alloc()
+   {  this->priv_alloc_ptr()->~nallocator_type();  }
+
+   void priv_reset()
+   {
+      if(m_ptr){
+         nallocator_type &al = this->node_alloc();
+         nator_traits::destroy(al, container_detail::to_raw_pointer(m_ptr));
+         nator_version_traits::deallocate_one(al, m_ptr);
+         this->priv_destroy_alloc();
+         m_ptr = node_pointer();
+      }
+   }
+
+   typedef typename container_detail::aligned_storage
+      <sizeof(nallocator_type), container_detail::alignment_of<nallocator_type>::value>::type storage_t;
+
+   node_pointer   m_ptr;
+   //The allocator is only constructed while the node_handle owns a node
+   storage_t      m_nalloc_storage;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+//! The result of inserting a node_handle in a set or a map.
+//!
+//! If the insertion took place, inserted is true, position points to the inserted
+//! element and node is empty. If an equivalent element was already present,
+//! inserted is false, position points to the existing element and node still owns
+//! the element. If the node_handle was empty, inserted is false, position is end()
+//! and node is empty.
+template <class Iterator, class NodeType>
+struct insert_return_type_base
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   BOOST_MOVABLE_BUT_NOT_COPYABLE(insert_return_type_base)
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   insert_return_type_base()
+      : position(), inserted(false), node()
+   {}
+
+   insert_return_type_base(BOOST_RV_REF(insert_return_type_base) other)
+      : position(other.position), inserted(other.inserted), node(::boost::move(other.node))
+   {}
+
+   insert_return_type_base & operator=(BOOST_RV_REF(insert_return_type_base) other)
+   {
+      position = other.position;
+      inserted = other.inserted;
+      node = ::boost::move(other.node);
+      return *this;
+   }
+
+   Iterator  position;
+   bool      inserted;
+   NodeType  node;
+};
+
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_NODE_HANDLE_HPP
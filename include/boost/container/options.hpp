@@ -23,6 +23,7 @@
 
 #include <boost/container/detail/config_begin.hpp>
 #include <boost/container/container_fwd.hpp>
+#include <boost/container/detail/next_capacity.hpp>
 #include <boost/intrusive/pack_options.hpp>
 
 namespace boost {
@@ -30,27 +31,65 @@ namespace container {
 
 #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
 
-template<tree_type_enum TreeType, bool OptimizeSize>
+template<tree_type_enum TreeType, bool OptimizeSize, bool OrderStatistics, std::size_t PrivateNodePool>
 struct tree_opt
 {
    static const boost::container::tree_type_enum tree_type = TreeType;
    static const bool optimize_size = OptimizeSize;
+   static const bool order_statistics = OrderStatistics;
+   static const std::size_t private_node_pool = PrivateNodePool;
+};
+
+template<bool SearchIndex, sequence_storage_enum SequenceStorage, std::size_t SequenceCapacity>
+struct flat_tree_opt
+{
+   static const bool search_index = SearchIndex;
+   static const boost::container::sequence_storage_enum sequence_storage = SequenceStorage;
+   static const std::size_t sequence_capacity = SequenceCapacity;
+};
+
+template<std::size_t PrivateNodePool>
+struct list_opt
+{
+   static const std::size_t private_node_pool = PrivateNodePool;
+};
+
+template<class GrowthFactor>
+struct vector_opt
+{
+   typedef GrowthFactor growth_factor_type;
 };
 
 #endif   //!defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
 
 //!This option setter specifies the underlying tree type
-//!(red-black, AVL, Scapegoat or Splay) for ordered associative containers
+//!(red-black, AVL, Scapegoat, Splay or B-tree) for ordered associative containers
 BOOST_INTRUSIVE_OPTION_CONSTANT(tree_type, tree_type_enum, TreeType, tree_type)
 
 //!This option setter specifies if node size is optimized
 //!storing rebalancing data masked into pointers for ordered associative containers
 BOOST_INTRUSIVE_OPTION_CONSTANT(optimize_size, bool, Enabled, optimize_size)
 
+//!This option setter specifies if each node of ordered associative containers
+//!stores the number of elements of its subtree, so that nth() and index_of()
+//!take logarithmic time instead of linear. Only red-black and AVL trees support it.
+BOOST_INTRUSIVE_OPTION_CONSTANT(order_statistics, bool, Enabled, order_statistics)
+
+//!This option setter specifies that each node container (list, slist and ordered
+//!associative containers) allocates its nodes from a pool of its own, that takes
+//!NodesPerBlock nodes at once from the general purpose allocator. Nodes are allocated
+//!without locking, packed in blocks, and clear() and the destructor free whole blocks.
+//!The allocator of the container is still used to construct and destroy the elements.
+//!Allocators of different containers compare unequal, so nodes can't be spliced, merged
+//!or inserted through node handles from other containers. Zero (the default) disables
+//!the pool. Not supported by the B-tree.
+BOOST_INTRUSIVE_OPTION_CONSTANT(private_node_pool, std::size_t, NodesPerBlock, private_node_pool)
+
 //! Helper metafunction to combine options into a single type to be used
 //! by \c boost::container::set, \c boost::container::multiset
 //! \c boost::container::map and \c boost::container::multimap.
-//! Supported options are: \c boost::container::optimize_size and \c boost::container::tree_type
+//! Supported options are: \c boost::container::optimize_size, \c boost::container::tree_type,
+//! \c boost::container::order_statistics and \c boost::container::private_node_pool
 #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED) || defined(BOOST_CONTAINER_VARIADIC_TEMPLATES)
 template<class ...Options>
 #else
@@ -67,7 +106,111 @@ struct tree_assoc_options
       Options...
       #endif
       >::type packed_options;
-   typedef tree_opt<packed_options::tree_type, packed_options::optimize_size> implementation_defined;
+   typedef tree_opt< packed_options::tree_type, packed_options::optimize_size
+                   , packed_options::order_statistics
+                   , packed_options::private_node_pool> implementation_defined;
+   /// @endcond
+   typedef implementation_defined type;
+};
+
+//! Helper metafunction to combine options into a single type to be used
+//! by \c boost::container::list and \c boost::container::slist.
+//! Supported options are: \c boost::container::private_node_pool
+#if defined(BOOST_CONTAINER_DOXYGEN_INVOKED) || defined(BOOST_CONTAINER_VARIADIC_TEMPLATES)
+template<class ...Options>
+#else
+template<class O1 = void, class O2 = void, class O3 = void, class O4 = void>
+#endif
+struct list_options
+{
+   /// @cond
+   typedef typename ::boost::intrusive::pack_options
+      < list_defaults,
+      #if !defined(BOOST_CONTAINER_VARIADIC_TEMPLATES)
+      O1, O2, O3, O4
+      #else
+      Options...
+      #endif
+      >::type packed_options;
+   typedef list_opt<packed_options::private_node_pool> implementation_defined;
+   /// @endcond
+   typedef implementation_defined type;
+};
+
+//!This option setter specifies if flat associative containers keep a secondary
+//!copy of the keys in a cache-friendly (Eytzinger) order to speed up lookups
+//!in big, read-mostly containers. The index is invalidated by the insertion or erasure
+//!of single elements and rebuilt in linear time by \c rebuild_index() and at the end of
+//!range construction, range insertion and \c adopt_sequence(). Lookups never modify it.
+BOOST_INTRUSIVE_OPTION_CONSTANT(search_index, bool, Enabled, search_index)
+
+//!This option setter specifies the sequence (vector, small_vector, static_vector
+//!or deque) that stores the elements of flat associative containers.
+BOOST_INTRUSIVE_OPTION_CONSTANT(sequence_storage, sequence_storage_enum, SequenceStorage, sequence_storage)
+
+//!This option setter specifies the number of elements stored inside the container
+//!when small_vector_sequence or static_vector_sequence storage is selected. It is the
+//!maximum size of the container for static_vector_sequence storage.
+BOOST_INTRUSIVE_OPTION_CONSTANT(sequence_capacity, std::size_t, Capacity, sequence_capacity)
+
+//! Helper metafunction to combine options into a single type to be used
+//! by \c boost::container::flat_set, \c boost::container::flat_multiset
+//! \c boost::container::flat_map and \c boost::container::flat_multimap.
+//! Supported options are: \c boost::container::search_index,
+//! \c boost::container::sequence_storage and \c boost::container::sequence_capacity
+#if defined(BOOST_CONTAINER_DOXYGEN_INVOKED) || defined(BOOST_CONTAINER_VARIADIC_TEMPLATES)
+template<class ...Options>
+#else
+template<class O1 = void, class O2 = void, class O3 = void, class O4 = void>
+#endif
+struct flat_assoc_options
+{
+   /// @cond
+   typedef typename ::boost::intrusive::pack_options
+      < flat_assoc_defaults,
+      #if !defined(BOOST_CONTAINER_VARIADIC_TEMPLATES)
+      O1, O2, O3, O4
+      #else
+      Options...
+      #endif
+      >::type packed_options;
+   typedef flat_tree_opt< packed_options::search_index
+                        , packed_options::sequence_storage
+                        , packed_options::sequence_capacity> implementation_defined;
+   /// @endcond
+   typedef implementation_defined type;
+};
+
+//!This option setter specifies the policy that computes the new capacity of vector-like
+//!containers when their capacity is exhausted: \c boost::container::growth_factor_50,
+//!\c boost::container::growth_factor_60, \c boost::container::growth_factor_100 (the default)
+//!or \c boost::container::growth_increment<N>. A user-defined policy is a default constructible
+//!class with a member function:
+//!<code>template<class SizeType> SizeType operator()(SizeType cur_cap, SizeType add_min_cap, SizeType max_cap) const</code>
+//!returning a capacity between cur_cap + add_min_cap and max_cap.
+BOOST_INTRUSIVE_OPTION_TYPE(growth_factor, GrowthFactor, GrowthFactor, growth_factor_type)
+
+//! Helper metafunction to combine options into a single type to be used
+//! by \c boost::container::vector, \c boost::container::small_vector,
+//! \c boost::container::stable_vector (for its index) and \c boost::container::basic_string.
+//! Supported options are: \c boost::container::growth_factor
+#if defined(BOOST_CONTAINER_DOXYGEN_INVOKED) || defined(BOOST_CONTAINER_VARIADIC_TEMPLATES)
+template<class ...Options>
+#else
+template<class O1 = void, class O2 = void, class O3 = void, class O4 = void>
+#endif
+struct vector_options
+{
+   /// @cond
+   typedef typename ::boost::intrusive::pack_options
+      < vector_defaults,
+      #if !defined(BOOST_CONTAINER_VARIADIC_TEMPLATES)
+      O1, O2, O3, O4
+      #else
+      Options...
+      #endif
+      >::type packed_options;
+   typedef vector_opt<typename packed_options::growth_factor_type> implementation_defined;
    /// @endcond
    typedef implementation_defined type;
 };
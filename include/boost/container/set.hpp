@@ -26,6 +26,7 @@
 // container/detail
 #include <boost/container/detail/mpl.hpp>
 #include <boost/container/detail/tree.hpp>
+#include <boost/container/detail/btree.hpp>
 #include <boost/container/new_allocator.hpp> //new_allocator
 // intrusive/detail
 #include <boost/intrusive/detail/minimal_pair_header.hpp>      //pair
@@ -100,6 +101,8 @@ class set
    typedef typename BOOST_CONTAINER_IMPDEF(base_t::const_iterator)                     const_iterator;
    typedef typename BOOST_CONTAINER_IMPDEF(base_t::reverse_iterator)                   reverse_iterator;
    typedef typename BOOST_CONTAINER_IMPDEF(base_t::const_reverse_iterator)             const_reverse_iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::node_type)                          node_type;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::insert_return_type)                 insert_return_type;
 
    //////////////////////////////////////////////
    //
@@ -517,6 +520,133 @@ class set
    {  this->base_t::insert_unique(il.begin(), il.end()); }
 #endif
 
+   //! <b>Effects</b>: If nh is empty, has no effect. Otherwise, inserts the element owned
+   //!   by nh if and only if there is no element in the container with key equivalent
+   //!   to the key of that element.
+   //!
+   //! <b>Returns</b>: If nh is empty, inserted is false, position is end() and node is empty.
+   //!   Otherwise, if the insertion took place, inserted is true, position points to the
+   //!   inserted element and node is empty. If the insertion failed, inserted is false,
+   //!   node owns the element and position points to the element with equivalent key.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Note</b>: The node allocated by the originating container is linked in *this,
+   //!   no element is copied or moved (B-trees move the element into one of their nodes).
+   //!   The allocator of nh must compare equal to get_allocator().
+   insert_return_type insert(BOOST_RV_REF(node_type) nh)
+   {  return this->base_t::insert_unique_node(boost::move(nh));  }
+
+   //! <b>Effects</b>: Same as `insert(node_type && nh)` but the element is inserted as close
+   //!   as possible to the position just prior to p.
+   //!
+   //! <b>Returns</b>: end() if nh is empty. Otherwise an iterator pointing to the element
+   //!   with key equivalent to the key of the element owned by nh.
+   //!
+   //! <b>Complexity</b>: Logarithmic in general, but amortized constant if the element
+   //!   is inserted right before p.
+   iterator insert(const_iterator p, BOOST_RV_REF(node_type) nh)
+   {  return this->base_t::insert_unique_node(p, boost::move(nh));  }
+
+   //! <b>Effects</b>: Unlinks the element with key equivalent to k, if any, from the container.
+   //!
+   //! <b>Returns</b>: A node_type owning the element if found, an empty node_type otherwise.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   node_type extract(const key_type& k)
+   {  return this->base_t::extract(k);  }
+
+   //! <b>Effects</b>: Unlinks the element pointed to by p from the container.
+   //!
+   //! <b>Returns</b>: A node_type owning the element.
+   //!
+   //! <b>Complexity</b>: Amortized constant.
+   node_type extract(const_iterator p)
+   {  return this->base_t::extract(p);  }
+
+   //! <b>Requires</b>: source.get_allocator() == this->get_allocator().
+   //!
+   //! <b>Effects</b>: Attempts to extract each element in source and insert it into *this
+   //!   using the comparison object of *this. If there is an element in *this with key
+   //!   equivalent to the key of an element from source, that element is not extracted
+   //!   from source.
+   //!
+   //! <b>Postcondition</b>: Pointers and references to the transferred elements of source
+   //!   refer to those same elements but as members of *this. Iterators referring to the
+   //!   transferred elements will continue to refer to their elements, but they now behave
+   //!   as iterators into *this, not into source.
+   //!   B-trees (see tree_type) move the transferred elements instead, so they are invalidated.
+   //!
+   //! <b>Throws</b>: Nothing unless the comparison object throws.
+   //!
+   //! <b>Complexity</b>: N log(size() + N) (N has the value source.size())
+   template<class C2>
+   void merge(set<Key, C2, Allocator, SetOptions>& source)
+   {
+      typedef container_detail::tree
+         <Key, Key, container_detail::identity<Key>, C2, Allocator, SetOptions> base2_t;
+      this->base_t::merge_unique(static_cast<base2_t&>(source));
+   }
+
+   //! @copydoc ::boost::container::set::merge(set<Key, C2, Allocator, SetOptions>&)
+   template<class C2>
+   void merge(BOOST_RV_REF_BEG set<Key, C2, Allocator, SetOptions> BOOST_RV_REF_END source)
+   {  this->merge(static_cast<set<Key, C2, Allocator, SetOptions>&>(source)); }
+
+   //! @copydoc ::boost::container::set::merge(set<Key, C2, Allocator, SetOptions>&)
+   template<class C2>
+   void merge(multiset<Key, C2, Allocator, SetOptions>& source)
+   {
+      typedef container_detail::tree
+         <Key, Key, container_detail::identity<Key>, C2, Allocator, SetOptions> base2_t;
+      this->base_t::merge_unique(static_cast<base2_t&>(source));
+   }
+
+   //! @copydoc ::boost::container::set::merge(set<Key, C2, Allocator, SetOptions>&)
+   template<class C2>
+   void merge(BOOST_RV_REF_BEG multiset<Key, C2, Allocator, SetOptions> BOOST_RV_REF_END source)
+   {  this->merge(static_cast<multiset<Key, C2, Allocator, SetOptions>&>(source)); }
+
+   //! <b>Effects</b>: Inserts a copy of each element of x whose key is not
+   //!   present in *this, leaving *this as the union of both containers.
+   //!
+   //! <b>Complexity</b>: O(M log(N/M + 1)) comparisons plus M amortized constant-time
+   //!   insertions at most, where M is x.size() and N is size(). Consecutive searches
+   //!   start from the previous result instead of from the root.
+   //!
+   //! <b>Throws</b>: If the comparison or the copy constructor throws. Elements
+   //!   inserted before the exception remain in *this.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void merge_union(const set& x)
+   {  this->base_t::merge_union_unique(x);  }
+
+   //! <b>Effects</b>: Erases the elements of *this whose keys are not present in x,
+   //!   leaving *this as the intersection of both containers.
+   //!
+   //! <b>Complexity</b>: O(M log(N/M + 1)) comparisons plus the erasures, where M is the
+   //!   size of the smaller container and N the size of the larger one. The elements of
+   //!   the smaller one are searched in order, starting from the previous result.
+   //!
+   //! <b>Throws</b>: If the comparison throws.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void intersect_with(const set& x)
+   {  this->base_t::intersect_with_unique(x);  }
+
+   //! <b>Effects</b>: Erases the elements of *this whose keys are present in x,
+   //!   leaving *this as the difference of both containers.
+   //!
+   //! <b>Complexity</b>: O(M log(N/M + 1)) comparisons plus the erasures, where M is the
+   //!   size of the smaller container and N the size of the larger one. The elements of
+   //!   the smaller one are searched in order, starting from the previous result.
+   //!
+   //! <b>Throws</b>: If the comparison throws.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void subtract(const set& x)
+   {  this->base_t::subtract_unique(x);  }
+
    #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
 
    //! <b>Effects</b>: Erases the element pointed to by p.
@@ -576,12 +706,117 @@ class set
    //! <b>Complexity</b>: Logarithmic.
    iterator find(const key_type& x);
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: An iterator pointing to an element with the key
+   //!   equivalent to x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      find(const K& x);
+
    //! <b>Returns</b>: A const_iterator pointing to an element with the key
    //!   equivalent to x, or end() if such an element is not found.
    //!
    //! <b>Complexity</b>: Logarithmic.
    const_iterator find(const key_type& x) const;
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: A const_iterator pointing to an element with the key
+   //!   equivalent to x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      find(const K& x) const;
+
+   //! <b>Requires</b>: KeyForwardIterator is a forward iterator whose elements
+   //!   can be looked up with find().
+   //!
+   //! <b>Effects</b>: For each key k in [first, last), in order, writes find(k) to out.
+   //!   The searches of several keys are interleaved and the memory they will touch
+   //!   next is prefetched, so that their cache misses overlap instead of being
+   //!   serviced one at a time.
+   //!
+   //! <b>Returns</b>: The output iterator past the last written iterator.
+   //!
+   //! <b>Complexity</b>: N*log(size()), where N is the distance between first and last.
+   template<class KeyForwardIterator, class OutputIterator>
+   OutputIterator find_batch(KeyForwardIterator first, KeyForwardIterator last, OutputIterator out);
+
+   //! <b>Requires</b>: KeyForwardIterator is a forward iterator whose elements
+   //!   can be looked up with find().
+   //!
+   //! <b>Effects</b>: For each key k in [first, last), in order, writes find(k) to out,
+   //!   a const_iterator. The searches of several keys are interleaved and the memory
+   //!   they will touch next is prefetched.
+   //!
+   //! <b>Returns</b>: The output iterator past the last written iterator.
+   //!
+   //! <b>Complexity</b>: N*log(size()), where N is the distance between first and last.
+   template<class KeyForwardIterator, class OutputIterator>
+   OutputIterator find_batch(KeyForwardIterator first, KeyForwardIterator last, OutputIterator out) const;
+
+   //! <b>Requires</b>: size() >= n.
+   //!
+   //! <b>Effects</b>: Returns an iterator to the nth element
+   //!   from the beginning of the container. Returns end()
+   //!   if n == size().
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Logarithmic if the container is configured with
+   //!   order_statistics<true>, linear otherwise.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   iterator nth(size_type n);
+
+   //! <b>Requires</b>: size() >= n.
+   //!
+   //! <b>Effects</b>: Returns a const_iterator to the nth element
+   //!   from the beginning of the container. Returns end()
+   //!   if n == size().
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Logarithmic if the container is configured with
+   //!   order_statistics<true>, linear otherwise.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   const_iterator nth(size_type n) const;
+
+   //! <b>Requires</b>: p is a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Returns the index of the element pointed by p
+   //!   and size() if p == end(). index_of(lower_bound(k)) is the
+   //!   number of elements less than k.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Logarithmic if the container is configured with
+   //!   order_statistics<true>, linear otherwise.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   size_type index_of(iterator p);
+
+   //! <b>Requires</b>: p is a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Returns the index of the element pointed by p
+   //!   and size() if p == end(). index_of(lower_bound(k)) is the
+   //!   number of elements less than k.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Logarithmic if the container is configured with
+   //!   order_statistics<true>, linear otherwise.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   size_type index_of(const_iterator p) const;
+
    #endif   //#if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
 
    //! <b>Returns</b>: The number of elements with key equivalent to x.
@@ -590,12 +825,34 @@ class set
    size_type count(const key_type& x) const
    {  return static_cast<size_type>(this->base_t::find(x) != this->base_t::cend());  }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: The number of elements with key equivalent to x.
+   //!
+   //! <b>Complexity</b>: log(size())+count(k)
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, size_type>::type
+      count(const K& x) const
+   {  return static_cast<size_type>(this->base_t::find(x) != this->base_t::cend());  }
+
    //! <b>Returns</b>: The number of elements with key equivalent to x.
    //!
    //! <b>Complexity</b>: log(size())+count(k)
    size_type count(const key_type& x)
    {  return static_cast<size_type>(this->base_t::find(x) != this->base_t::end());  }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: The number of elements with key equivalent to x.
+   //!
+   //! <b>Complexity</b>: log(size())+count(k)
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, size_type>::type
+      count(const K& x)
+   {  return static_cast<size_type>(this->base_t::find(x) != this->base_t::end());  }
+
    #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
 
    //! <b>Returns</b>: An iterator pointing to the first element with key not less
@@ -604,24 +861,68 @@ class set
    //! <b>Complexity</b>: Logarithmic
    iterator lower_bound(const key_type& x);
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the first element with key not less
+   //!   than k, or a.end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      lower_bound(const K& x);
+
    //! <b>Returns</b>: A const iterator pointing to the first element with key not
    //!   less than k, or a.end() if such an element is not found.
    //!
    //! <b>Complexity</b>: Logarithmic
    const_iterator lower_bound(const key_type& x) const;
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: A const iterator pointing to the first element with key not
+   //!   less than k, or a.end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      lower_bound(const K& x) const;
+
    //! <b>Returns</b>: An iterator pointing to the first element with key not less
    //!   than x, or end() if such an element is not found.
    //!
    //! <b>Complexity</b>: Logarithmic
    iterator upper_bound(const key_type& x);
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the first element with key not less
+   //!   than x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      upper_bound(const K& x);
+
    //! <b>Returns</b>: A const iterator pointing to the first element with key not
    //!   less than x, or end() if such an element is not found.
    //!
    //! <b>Complexity</b>: Logarithmic
    const_iterator upper_bound(const key_type& x) const;
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: A const iterator pointing to the first element with key not
+   //!   less than x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      upper_bound(const K& x) const;
+
    #endif   //#if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
 
    //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
@@ -630,12 +931,34 @@ class set
    std::pair<iterator,iterator> equal_range(const key_type& x)
    {  return this->base_t::lower_bound_range(x);  }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<iterator,iterator> >::type
+      equal_range(const K& x)
+   {  return this->base_t::lower_bound_range(x);  }
+
    //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
    //!
    //! <b>Complexity</b>: Logarithmic
    std::pair<const_iterator, const_iterator> equal_range(const key_type& x) const
    {  return this->base_t::lower_bound_range(x);  }
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<const_iterator, const_iterator> >::type
+      equal_range(const K& x) const
+   {  return this->base_t::lower_bound_range(x);  }
+
    #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
 
    //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
@@ -643,11 +966,31 @@ class set
    //! <b>Complexity</b>: Logarithmic
    std::pair<iterator,iterator> equal_range(const key_type& x);
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<iterator,iterator> >::type
+      equal_range(const K& x);
+
    //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
    //!
    //! <b>Complexity</b>: Logarithmic
    std::pair<const_iterator, const_iterator> equal_range(const key_type& x) const;
 
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
+   //!
+   //! <b>Complexity</b>: Logarithmic
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<const_iterator, const_iterator> >::type
+      equal_range(const K& x) const;
+
    //! <b>Effects</b>: Rebalances the tree. It's a no-op for Red-Black and AVL trees.
    //!
    //! <b>Complexity</b>: Linear
@@ -663,6 +1006,11 @@ class set
    //! <b>Complexity</b>: Linear to the number of elements in the container.
    friend bool operator!=(const set& x, const set& y);
 
+   //! <b>Effects</b>: Returns the hash value of x. Equal containers have equal hash values.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend std::size_t hash_value(const set& x);
+
    //! <b>Effects</b>: Returns true if x is less than y
    //!
    //! <b>Complexity</b>: Linear to the number of elements in the container.
@@ -776,6 +1124,7 @@ class multiset
    typedef typename BOOST_CONTAINER_IMPDEF(base_t::const_iterator)                     const_iterator;
    typedef typename BOOST_CONTAINER_IMPDEF(base_t::reverse_iterator)                   reverse_iterator;
    typedef typename BOOST_CONTAINER_IMPDEF(base_t::const_reverse_iterator)             const_reverse_iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(base_t::node_type)                          node_type;
 
    //////////////////////////////////////////////
    //
@@ -1040,6 +1389,81 @@ class multiset
    {  this->base_t::insert_equal(il.begin(), il.end());  }
 #endif
 
+   //! <b>Effects</b>: If nh is empty, has no effect. Otherwise, inserts the element owned
+   //!   by nh and returns an iterator pointing to it. If a range containing elements
+   //!   equivalent to it exists, the element is inserted at the end of that range.
+   //!
+   //! <b>Returns</b>: end() if nh is empty, an iterator to the inserted element otherwise.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   //!
+   //! <b>Note</b>: The node allocated by the originating container is linked in *this,
+   //!   no element is copied or moved (B-trees move the element into one of their nodes).
+   //!   The allocator of nh must compare equal to get_allocator().
+   iterator insert(BOOST_RV_REF(node_type) nh)
+   {  return this->base_t::insert_equal_node(boost::move(nh));  }
+
+   //! <b>Effects</b>: Same as `insert(node_type && nh)` but the element is inserted as close
+   //!   as possible to the position just prior to p.
+   //!
+   //! <b>Complexity</b>: Logarithmic in general, but amortized constant if the element
+   //!   is inserted right before p.
+   iterator insert(const_iterator p, BOOST_RV_REF(node_type) nh)
+   {  return this->base_t::insert_equal_node(p, boost::move(nh));  }
+
+   //! <b>Effects</b>: Unlinks the first element with key equivalent to k, if any, from the container.
+   //!
+   //! <b>Returns</b>: A node_type owning the element if found, an empty node_type otherwise.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   node_type extract(const key_type& k)
+   {  return this->base_t::extract(k);  }
+
+   //! @copydoc ::boost::container::set::extract(const_iterator)
+   node_type extract(const_iterator p)
+   {  return this->base_t::extract(p);  }
+
+   //! <b>Requires</b>: source.get_allocator() == this->get_allocator().
+   //!
+   //! <b>Effects</b>: Extracts each element in source and inserts it into *this
+   //!   using the comparison object of *this.
+   //!
+   //! <b>Postcondition</b>: Pointers and references to the transferred elements of source
+   //!   refer to those same elements but as members of *this. Iterators referring to the
+   //!   transferred elements will continue to refer to their elements, but they now behave
+   //!   as iterators into *this, not into source.
+   //!   B-trees (see tree_type) move the transferred elements instead, so they are invalidated.
+   //!
+   //! <b>Throws</b>: Nothing unless the comparison object throws.
+   //!
+   //! <b>Complexity</b>: N log(size() + N) (N has the value source.size())
+   template<class C2>
+   void merge(multiset<Key, C2, Allocator, MultiSetOptions>& source)
+   {
+      typedef container_detail::tree
+         <Key, Key, container_detail::identity<Key>, C2, Allocator, MultiSetOptions> base2_t;
+      this->base_t::merge_equal(static_cast<base2_t&>(source));
+   }
+
+   //! @copydoc ::boost::container::multiset::merge(multiset<Key, C2, Allocator, MultiSetOptions>&)
+   template<class C2>
+   void merge(BOOST_RV_REF_BEG multiset<Key, C2, Allocator, MultiSetOptions> BOOST_RV_REF_END source)
+   {  this->merge(static_cast<multiset<Key, C2, Allocator, MultiSetOptions>&>(source)); }
+
+   //! @copydoc ::boost::container::multiset::merge(multiset<Key, C2, Allocator, MultiSetOptions>&)
+   template<class C2>
+   void merge(set<Key, C2, Allocator, MultiSetOptions>& source)
+   {
+      typedef container_detail::tree
+         <Key, Key, container_detail::identity<Key>, C2, Allocator, MultiSetOptions> base2_t;
+      this->base_t::merge_equal(static_cast<base2_t&>(source));
+   }
+
+   //! @copydoc ::boost::container::multiset::merge(multiset<Key, C2, Allocator, MultiSetOptions>&)
+   template<class C2>
+   void merge(BOOST_RV_REF_BEG set<Key, C2, Allocator, MultiSetOptions> BOOST_RV_REF_END source)
+   {  this->merge(static_cast<set<Key, C2, Allocator, MultiSetOptions>&>(source)); }
+
    #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
 
    //! @copydoc ::boost::container::set::erase(const_iterator)
@@ -1068,30 +1492,95 @@ class multiset
    //! @copydoc ::boost::container::set::find(const key_type& )
    iterator find(const key_type& x);
 
+   //! @copydoc ::boost::container::set::find(const K& )
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      find(const K& x);
+
    //! @copydoc ::boost::container::set::find(const key_type& ) const
    const_iterator find(const key_type& x) const;
 
+   //! @copydoc ::boost::container::set::find(const K& ) const
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      find(const K& x) const;
+
+   //! @copydoc ::boost::container::set::find_batch(KeyForwardIterator,KeyForwardIterator,OutputIterator)
+   template<class KeyForwardIterator, class OutputIterator>
+   OutputIterator find_batch(KeyForwardIterator first, KeyForwardIterator last, OutputIterator out);
+
+   //! @copydoc ::boost::container::set::find_batch(KeyForwardIterator,KeyForwardIterator,OutputIterator) const
+   template<class KeyForwardIterator, class OutputIterator>
+   OutputIterator find_batch(KeyForwardIterator first, KeyForwardIterator last, OutputIterator out) const;
+
+   //! @copydoc ::boost::container::set::nth(size_type)
+   iterator nth(size_type n);
+
+   //! @copydoc ::boost::container::set::nth(size_type) const
+   const_iterator nth(size_type n) const;
+
+   //! @copydoc ::boost::container::set::index_of(iterator)
+   size_type index_of(iterator p);
+
+   //! @copydoc ::boost::container::set::index_of(const_iterator) const
+   size_type index_of(const_iterator p) const;
+
    //! @copydoc ::boost::container::set::count(const key_type& ) const
    size_type count(const key_type& x) const;
 
+   //! @copydoc ::boost::container::set::count(const K& ) const
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, size_type>::type
+      count(const K& x) const;
+
    //! @copydoc ::boost::container::set::lower_bound(const key_type& )
    iterator lower_bound(const key_type& x);
 
+   //! @copydoc ::boost::container::set::lower_bound(const K& )
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      lower_bound(const K& x);
+
    //! @copydoc ::boost::container::set::lower_bound(const key_type& ) const
    const_iterator lower_bound(const key_type& x) const;
 
+   //! @copydoc ::boost::container::set::lower_bound(const K& ) const
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      lower_bound(const K& x) const;
+
    //! @copydoc ::boost::container::set::upper_bound(const key_type& )
    iterator upper_bound(const key_type& x);
 
+   //! @copydoc ::boost::container::set::upper_bound(const K& )
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      upper_bound(const K& x);
+
    //! @copydoc ::boost::container::set::upper_bound(const key_type& ) const
    const_iterator upper_bound(const key_type& x) const;
 
+   //! @copydoc ::boost::container::set::upper_bound(const K& ) const
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      upper_bound(const K& x) const;
+
    //! @copydoc ::boost::container::set::equal_range(const key_type& ) const
    std::pair<const_iterator, const_iterator> equal_range(const key_type& x) const;
 
+   //! @copydoc ::boost::container::set::equal_range(const K& ) const
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<const_iterator, const_iterator> >::type
+      equal_range(const K& x) const;
+
    //! @copydoc ::boost::container::set::equal_range(const key_type& )
    std::pair<iterator,iterator> equal_range(const key_type& x);
 
+   //! @copydoc ::boost::container::set::equal_range(const K& )
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<iterator,iterator> >::type
+      equal_range(const K& x);
+
    //! @copydoc ::boost::container::set::rebalance()
    void rebalance();
 
@@ -1105,6 +1594,11 @@ class multiset
    //! <b>Complexity</b>: Linear to the number of elements in the container.
    friend bool operator!=(const multiset& x, const multiset& y);
 
+   //! <b>Effects</b>: Returns the hash value of x. Equal containers have equal hash values.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend std::size_t hash_value(const multiset& x);
+
    //! <b>Effects</b>: Returns true if x is less than y
    //!
    //! <b>Complexity</b>: Linear to the number of elements in the container.
@@ -1166,6 +1660,30 @@ namespace container {
 
 }}
 
+#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+namespace std {
+
+//!std::hash specialization, equivalent to boost::hash
+template <class Key, class Compare, class Allocator, class Options>
+struct hash< ::boost::container::set<Key, Compare, Allocator, Options> >
+{
+   std::size_t operator()(const ::boost::container::set<Key, Compare, Allocator, Options> &x) const
+   {  return ::boost::hash< ::boost::container::set<Key, Compare, Allocator, Options> >()(x);  }
+};
+
+//!std::hash specialization, equivalent to boost::hash
+template <class Key, class Compare, class Allocator, class Options>
+struct hash< ::boost::container::multiset<Key, Compare, Allocator, Options> >
+{
+   std::size_t operator()(const ::boost::container::multiset<Key, Compare, Allocator, Options> &x) const
+   {  return ::boost::hash< ::boost::container::multiset<Key, Compare, Allocator, Options> >()(x);  }
+};
+
+}  //namespace std {
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
 #include <boost/container/detail/config_end.hpp>
 
 #endif   // BOOST_CONTAINER_SET_HPP
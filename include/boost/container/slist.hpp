@@ -25,10 +25,12 @@
 // container
 #include <boost/container/container_fwd.hpp>
 #include <boost/container/new_allocator.hpp> //new_allocator
+#include <boost/container/options.hpp>
 #include <boost/container/throw_exception.hpp>
 // container/detail
 #include <boost/container/detail/algorithm.hpp> //algo_equal(), algo_lexicographical_compare
 #include <boost/container/detail/compare_functors.hpp>
+#include <boost/container/detail/hash.hpp>
 #include <boost/container/detail/iterator.hpp>
 #include <boost/container/detail/iterators.hpp>
 #include <boost/container/detail/mpl.hpp>
@@ -58,7 +60,7 @@ namespace container {
 
 #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
 
-template <class T, class Allocator>
+template <class T, class Allocator, class Options>
 class slist;
 
 namespace container_detail {
@@ -156,19 +158,22 @@ struct intrusive_slist_type
 //!
 //! \tparam T The type of object that is stored in the list
 //! \tparam Allocator The allocator used for all internal memory management
+//! \tparam Options is an packed option type generated using boost::container::list_options.
 #ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
-template <class T, class Allocator = new_allocator<T> >
+template <class T, class Allocator = new_allocator<T>, class Options = list_defaults >
 #else
-template <class T, class Allocator>
+template <class T, class Allocator, class Options>
 #endif
 class slist
    : protected container_detail::node_alloc_holder
-      <Allocator, typename container_detail::intrusive_slist_type<Allocator>::type>
+      < Allocator, typename container_detail::intrusive_slist_type<Allocator>::type
+      , Options::private_node_pool>
 {
    #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
    typedef typename
       container_detail::intrusive_slist_type<Allocator>::type           Icont;
-   typedef container_detail::node_alloc_holder<Allocator, Icont>        AllocHolder;
+   typedef container_detail::node_alloc_holder
+      <Allocator, Icont, Options::private_node_pool>        AllocHolder;
    typedef typename AllocHolder::NodePtr                    NodePtr;
    typedef typename AllocHolder::NodeAlloc                  NodeAlloc;
    typedef typename AllocHolder::ValAlloc                   ValAlloc;
@@ -386,7 +391,7 @@ class slist
       BOOST_ASSERT(this != &x);
       NodeAlloc &this_alloc = this->node_alloc();
       NodeAlloc &x_alloc    = x.node_alloc();
-      const bool propagate_alloc = allocator_traits_type::
+      const bool propagate_alloc = allocator_traits<NodeAlloc>::
             propagate_on_container_move_assignment::value;
       const bool allocators_equal = this_alloc == x_alloc; (void)allocators_equal;
       //Resources can be transferred if both allocators are
@@ -947,7 +952,7 @@ class slist
    //!
    //! <b>Complexity</b>: Linear to the number of elements in the list.
    void clear()
-   {  this->icont().clear_and_dispose(Destroyer(this->node_alloc()));  }
+   {  AllocHolder::clear(alloc_version());  }
 
    //////////////////////////////////////////////
    //
@@ -1519,6 +1524,12 @@ class slist
    friend bool operator!=(const slist& x, const slist& y)
    {  return !(x == y); }
 
+   //! <b>Effects</b>: Returns the hash value of x. Equal containers have equal hash values.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend std::size_t hash_value(const slist& x)
+   {  return container_detail::hash_range(x.begin(), x.end());  }
+
    //! <b>Effects</b>: Returns true if x is less than y
    //!
    //! <b>Complexity</b>: Linear to the number of elements in the container.
@@ -1642,8 +1653,8 @@ namespace boost {
 
 //!has_trivial_destructor_after_move<> == true_type
 //!specialization for optimizations
-template <class T, class Allocator>
-struct has_trivial_destructor_after_move<boost::container::slist<T, Allocator> >
+template <class T, class Allocator, class Options>
+struct has_trivial_destructor_after_move<boost::container::slist<T, Allocator, Options> >
 {
    typedef typename ::boost::container::allocator_traits<Allocator>::pointer pointer;
    static const bool value = ::boost::has_trivial_destructor_after_move<Allocator>::value &&
@@ -1669,11 +1680,11 @@ namespace container {
 
 BOOST_CONTAINER_STD_NS_BEG
 
-template <class T, class Allocator>
-class insert_iterator<boost::container::slist<T, Allocator> >
+template <class T, class Allocator, class Options>
+class insert_iterator<boost::container::slist<T, Allocator, Options> >
 {
  protected:
-   typedef boost::container::slist<T, Allocator> Container;
+   typedef boost::container::slist<T, Allocator, Options> Container;
    Container* container;
    typename Container::iterator iter;
    public:
@@ -1709,6 +1720,22 @@ BOOST_CONTAINER_STD_NS_END
 
 #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
 
+#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+namespace std {
+
+//!std::hash specialization, equivalent to boost::hash
+template <class T, class Allocator, class Options>
+struct hash< ::boost::container::slist<T, Allocator, Options> >
+{
+   std::size_t operator()(const ::boost::container::slist<T, Allocator, Options> &x) const
+   {  return ::boost::hash< ::boost::container::slist<T, Allocator, Options> >()(x);  }
+};
+
+}  //namespace std {
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
 #include <boost/container/detail/config_end.hpp>
 
 #endif // BOOST_CONTAINER_SLIST_HPP
@@ -0,0 +1,822 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_SLOT_MAP_HPP
+#define BOOST_CONTAINER_SLOT_MAP_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/is_trivially_relocatable.hpp>
+#include <boost/container/new_allocator.hpp> //new_allocator
+#include <boost/container/throw_exception.hpp>
+#include <boost/container/vector.hpp>
+// container/detail
+#include <boost/container/detail/hash.hpp>
+#include <boost/container/detail/iterators.hpp>
+#include <boost/container/detail/to_raw_pointer.hpp>
+// move
+#include <boost/move/adl_move_swap.hpp>
+#include <boost/move/traits.hpp>
+#include <boost/move/utility_core.hpp>
+// move/detail
+#if defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+#include <boost/move/detail/fwd_macros.hpp>
+#endif
+// other
+#include <boost/core/no_exceptions_support.hpp>
+#include <boost/assert.hpp>
+
+namespace boost {
+namespace container {
+
+//! The handle returned by slot_map when an element is inserted. It holds the position
+//! of the slot that refers to the element and the generation of the slot when
+//! the element was inserted. Erasing the element increments the generation of the slot,
+//! so the key is detected as invalid even if the slot is reused.
+//!
+//! A default constructed key never refers to an element.
+template<class SizeType>
+struct slot_map_key
+{
+   typedef SizeType size_type;
+
+   //! <b>Effects</b>: Constructs a key that refers to no element.
+   slot_map_key()
+      : index(size_type(-1)), generation(0u)
+   {}
+
+   //! <b>Effects</b>: Constructs a key from its slot position and generation.
+   slot_map_key(size_type idx, size_type gen)
+      : index(idx), generation(gen)
+   {}
+
+   size_type index;
+   size_type generation;
+
+   friend bool operator==(const slot_map_key &x, const slot_map_key &y)
+   {  return x.index == y.index && x.generation == y.generation;  }
+
+   friend bool operator!=(const slot_map_key &x, const slot_map_key &y)
+   {  return !(x == y);  }
+
+   friend bool operator<(const slot_map_key &x, const slot_map_key &y)
+   {  return x.index < y.index || (x.index == y.index && x.generation < y.generation);  }
+
+   friend std::size_t hash_value(const slot_map_key &x)
+   {
+      std::size_t seed = std::size_t(x.index);
+      container_detail::hash_combine(seed, std::size_t(x.generation));
+      return seed;
+   }
+};
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace container_detail {
+
+//A used slot stores the position of its element, a free slot
+//stores the position of the next free slot
+template<class SizeType>
+struct slot_map_slot
+{
+   slot_map_slot(SizeType idx, SizeType gen)
+      : index(idx), generation(gen)
+   {}
+
+   SizeType index;
+   SizeType generation;
+};
+
+}  //namespace container_detail {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! A slot_map is an unordered container that stores its values contiguously in a vector, so
+//! that iterating over them is as fast as iterating a vector, and returns a stable key for each
+//! inserted value. Keys remain valid until their value is erased, no matter how many
+//! other values are inserted or erased, and insertion, erasure and lookup by key take
+//! constant time.
+//!
+//! Erasure moves the last value to the position of the erased one (swap and pop),
+//! so iterators, pointers and references to values are invalidated by erasures and
+//! by insertions that reallocate, and the order of the values is not preserved.
+//! Use keys to refer to values across modifications.
+//!
+//! Keys refer to an indirection table of slots. When a value is erased the generation of
+//! its slot is incremented and the slot is reused by later insertions. find(), at() and
+//! count() compare the generation of the key and the slot so stale keys are detected.
+//!
+//! \tparam T The type of object that is stored in the slot_map
+//! \tparam Allocator The allocator used for all internal memory management
+template <class T, class Allocator BOOST_CONTAINER_DOCONLY(= new_allocator<T>) >
+class slot_map
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   typedef allocator_traits<Allocator>                                        allocator_traits_type;
+   typedef vector<T, Allocator>                                               values_t;
+   typedef typename allocator_traits_type::size_type                          size_type_t;
+   typedef container_detail::slot_map_slot<size_type_t>                       slot_t;
+   typedef typename allocator_traits_type::template
+      portable_rebind_alloc<slot_t>::type                                     slot_allocator_type;
+   typedef typename allocator_traits_type::template
+      portable_rebind_alloc<size_type_t>::type                                reverse_allocator_type;
+   typedef vector<slot_t, slot_allocator_type>                                slots_t;
+   typedef vector<size_type_t, reverse_allocator_type>                        reverse_t;
+   BOOST_COPYABLE_AND_MOVABLE(slot_map)
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //                    types
+   //
+   //////////////////////////////////////////////
+
+   typedef T                                                                           value_type;
+   typedef typename ::boost::container::allocator_traits<Allocator>::pointer           pointer;
+   typedef typename ::boost::container::allocator_traits<Allocator>::const_pointer     const_pointer;
+   typedef typename ::boost::container::allocator_traits<Allocator>::reference         reference;
+   typedef typename ::boost::container::allocator_traits<Allocator>::const_reference   const_reference;
+   typedef typename ::boost::container::allocator_traits<Allocator>::size_type         size_type;
+   typedef typename ::boost::container::allocator_traits<Allocator>::difference_type   difference_type;
+   typedef Allocator                                                                   allocator_type;
+   typedef slot_map_key<size_type>                                                     key_type;
+   typedef BOOST_CONTAINER_IMPDEF(typename values_t::iterator)                         iterator;
+   typedef BOOST_CONTAINER_IMPDEF(typename values_t::const_iterator)                   const_iterator;
+   typedef BOOST_CONTAINER_IMPDEF(typename values_t::reverse_iterator)                 reverse_iterator;
+   typedef BOOST_CONTAINER_IMPDEF(typename values_t::const_reverse_iterator)           const_reverse_iterator;
+
+   //////////////////////////////////////////////
+   //
+   //          construct/copy/destroy
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Default constructs a slot_map.
+   //!
+   //! <b>Throws</b>: If allocator_type's default constructor throws.
+   //!
+   //! <b>Complexity</b>: Constant.
+   slot_map()
+      : m_values(), m_slots(), m_reverse(), m_free_head(npos)
+   {}
+
+   //! <b>Effects</b>: Constructs a slot_map taking the allocator as parameter.
+   //!
+   //! <b>Throws</b>: Nothing
+   //!
+   //! <b>Complexity</b>: Constant.
+   explicit slot_map(const allocator_type &a) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_values(a), m_slots(slot_allocator_type(a)), m_reverse(reverse_allocator_type(a)), m_free_head(npos)
+   {}
+
+   //! <b>Effects</b>: Copy constructs a slot_map. Keys of x are valid keys of *this.
+   //!
+   //! <b>Throws</b>: If allocation throws or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to the elements and slots of x.
+   slot_map(const slot_map &x)
+      : m_values(x.m_values), m_slots(x.m_slots), m_reverse(x.m_reverse), m_free_head(x.m_free_head)
+   {}
+
+   //! <b>Effects</b>: Move constructor. Moves x's resources to *this.
+   //!   Keys of x are valid keys of *this.
+   //!
+   //! <b>Throws</b>: Nothing
+   //!
+   //! <b>Complexity</b>: Constant.
+   slot_map(BOOST_RV_REF(slot_map) x) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_values(boost::move(x.m_values)), m_slots(boost::move(x.m_slots))
+      , m_reverse(boost::move(x.m_reverse)), m_free_head(x.m_free_head)
+   {  x.m_free_head = npos;  }
+
+   //! <b>Effects</b>: Makes *this a copy of x. Keys of x are valid keys of *this.
+   //!
+   //! <b>Throws</b>: If allocation throws or T's copy constructor/assignment throws.
+   //!
+   //! <b>Complexity</b>: Linear to the elements and slots of x.
+   slot_map& operator=(BOOST_COPY_ASSIGN_REF(slot_map) x)
+   {
+      if(&x != this){
+         this->m_values  = x.m_values;
+         this->m_slots   = x.m_slots;
+         this->m_reverse = x.m_reverse;
+         this->m_free_head = x.m_free_head;
+      }
+      return *this;
+   }
+
+   //! <b>Effects</b>: Move assignment. All x's values and slots are transferred to *this.
+   //!   Keys of x are valid keys of *this.
+   //!
+   //! <b>Throws</b>: If allocator_traits_type::propagate_on_container_move_assignment
+   //!   is false and (allocation throws or value_type's move constructor throws)
+   //!
+   //! <b>Complexity</b>: Constant if the allocator is propagated or
+   //!   this->get_allocator() == x.get_allocator(). Linear otherwise.
+   slot_map& operator=(BOOST_RV_REF(slot_map) x)
+      BOOST_NOEXCEPT_IF(allocator_traits_type::propagate_on_container_move_assignment::value
+                                  || allocator_traits_type::is_always_equal::value)
+   {
+      if(&x != this){
+         this->m_values  = boost::move(x.m_values);
+         this->m_slots   = boost::move(x.m_slots);
+         this->m_reverse = boost::move(x.m_reverse);
+         this->m_free_head = x.m_free_head;
+         x.m_values.clear();
+         x.m_slots.clear();
+         x.m_reverse.clear();
+         x.m_free_head = npos;
+      }
+      return *this;
+   }
+
+   //! <b>Effects</b>: Returns a copy of the internal allocator.
+   //!
+   //! <b>Throws</b>: If allocator's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Constant.
+   allocator_type get_allocator() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_values.get_allocator();  }
+
+   //////////////////////////////////////////////
+   //
+   //                iterators
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns an iterator to the first value contained in the slot_map.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   iterator begin() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_values.begin();  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the first value contained in the slot_map.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator begin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_values.begin();  }
+
+   //! <b>Effects</b>: Returns an iterator to the end of the slot_map.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   iterator end() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_values.end();  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the end of the slot_map.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator end() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_values.end();  }
+
+   //! <b>Effects</b>: Returns a reverse_iterator pointing to the beginning
+   //! of the reversed slot_map.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   reverse_iterator rbegin() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_values.rbegin();  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the beginning
+   //! of the reversed slot_map.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reverse_iterator rbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_values.rbegin();  }
+
+   //! <b>Effects</b>: Returns a reverse_iterator pointing to the end
+   //! of the reversed slot_map.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   reverse_iterator rend() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_values.rend();  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end
+   //! of the reversed slot_map.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reverse_iterator rend() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_values.rend();  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the first value contained in the slot_map.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator cbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_values.cbegin();  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the end of the slot_map.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator cend() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_values.cend();  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the beginning
+   //! of the reversed slot_map.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reverse_iterator crbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_values.crbegin();  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end
+   //! of the reversed slot_map.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reverse_iterator crend() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_values.crend();  }
+
+   //////////////////////////////////////////////
+   //
+   //                capacity
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns true if the slot_map contains no elements.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   bool empty() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_values.empty();  }
+
+   //! <b>Effects</b>: Returns the number of the elements contained in the slot_map.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_values.size();  }
+
+   //! <b>Effects</b>: Returns the largest possible size of the slot_map.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type max_size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const size_type m = this->m_slots.max_size() < this->m_reverse.max_size()
+         ? this->m_slots.max_size() : this->m_reverse.max_size();
+      return m < this->m_values.max_size() ? m : this->m_values.max_size();
+   }
+
+   //! <b>Effects</b>: Number of elements for which memory has been allocated.
+   //!   capacity() is always greater than or equal to size().
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type capacity() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_values.capacity();  }
+
+   //! <b>Effects</b>: If n is less than or equal to capacity(), this call has no
+   //!   effect. Otherwise, it is a request for allocation of additional memory
+   //!   for values and slots. If the request is successful, then capacity() is greater
+   //!   than or equal to n; otherwise, capacity() is unchanged. In either case, size() is unchanged.
+   //!
+   //! <b>Throws</b>: If memory allocation allocation throws or T's copy/move constructor throws.
+   void reserve(size_type n)
+   {
+      this->m_values.reserve(n);
+      this->m_reverse.reserve(n);
+      this->m_slots.reserve(n);
+   }
+
+   //! <b>Effects</b>: Tries to deallocate the excess of memory used by values.
+   //!   Slots are never released as keys refer to them.
+   //!
+   //! <b>Throws</b>: If memory allocation throws, or T's copy/move constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to size().
+   void shrink_to_fit()
+   {
+      this->m_values.shrink_to_fit();
+      this->m_reverse.shrink_to_fit();
+   }
+
+   //////////////////////////////////////////////
+   //
+   //               element access
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Requires</b>: k is a valid key of *this.
+   //!
+   //! <b>Effects</b>: Returns a reference to the element referred by k.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   reference operator[](const key_type &k) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(this->priv_is_valid(k));
+      return this->m_values[this->m_slots[k.index].index];
+   }
+
+   //! <b>Requires</b>: k is a valid key of *this.
+   //!
+   //! <b>Effects</b>: Returns a const reference to the element referred by k.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reference operator[](const key_type &k) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(this->priv_is_valid(k));
+      return this->m_values[this->m_slots[k.index].index];
+   }
+
+   //! <b>Effects</b>: Returns a reference to the element referred by k.
+   //!
+   //! <b>Throws</b>: std::out_of_range if k is not a valid key of *this (e.g. its element was erased).
+   //!
+   //! <b>Complexity</b>: Constant.
+   reference at(const key_type &k)
+   {
+      this->priv_check_key(k);
+      return (*this)[k];
+   }
+
+   //! <b>Effects</b>: Returns a const reference to the element referred by k.
+   //!
+   //! <b>Throws</b>: std::out_of_range if k is not a valid key of *this (e.g. its element was erased).
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reference at(const key_type &k) const
+   {
+      this->priv_check_key(k);
+      return (*this)[k];
+   }
+
+   //! <b>Returns</b>: An iterator to the element referred by k or end()
+   //!   if k is not a valid key of *this.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   iterator find(const key_type &k) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      return this->priv_is_valid(k)
+         ? this->m_values.nth(this->m_slots[k.index].index) : this->m_values.end();
+   }
+
+   //! <b>Returns</b>: A const_iterator to the element referred by k or end()
+   //!   if k is not a valid key of *this.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator find(const key_type &k) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      return this->priv_is_valid(k)
+         ? this->m_values.nth(this->m_slots[k.index].index) : this->m_values.end();
+   }
+
+   //! <b>Returns</b>: 1 if k is a valid key of *this, 0 otherwise.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type count(const key_type &k) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return size_type(this->priv_is_valid(k));  }
+
+   //! <b>Requires</b>: p must be a valid iterator of *this.
+   //!
+   //! <b>Returns</b>: The key of the element pointed by p.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   key_type key_of(const_iterator p) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const size_type slot = this->m_reverse[this->priv_index_of(p)];
+      return key_type(slot, this->m_slots[slot].generation);
+   }
+
+   //! <b>Returns</b>: A pointer such that [data(),data() + size()) is a valid range
+   //!   that contains all the elements.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   T* data() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_values.data();  }
+
+   //! <b>Returns</b>: A pointer such that [data(),data() + size()) is a valid range
+   //!   that contains all the elements.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const T * data()  const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->m_values.data();  }
+
+   //////////////////////////////////////////////
+   //
+   //                modifiers
+   //
+   //////////////////////////////////////////////
+
+   #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //! <b>Effects</b>: Inserts an object of type T constructed with
+   //!   std::forward<Args>(args)... at the end of the values.
+   //!
+   //! <b>Returns</b>: The key of the new element.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or the in-place constructor throws or
+   //!   T's copy/move constructor throws.
+   //!
+   //! <b>Complexity</b>: Amortized constant time.
+   template<class ...Args>
+   key_type emplace(BOOST_FWD_REF(Args)...args)
+   {
+      const size_type slot = this->priv_reserve_slot();
+      BOOST_TRY{
+         this->m_values.emplace_back(::boost::forward<Args>(args)...);
+      }
+      BOOST_CATCH(...){
+         this->m_reverse.pop_back();
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      return this->priv_commit_slot(slot);
+   }
+
+   #else // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   #define BOOST_CONTAINER_SLOT_MAP_EMPLACE_CODE(N) \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   key_type emplace(BOOST_MOVE_UREF##N)\
+   {\
+      const size_type slot = this->priv_reserve_slot();\
+      BOOST_TRY{\
+         this->m_values.emplace_back(BOOST_MOVE_FWD##N);\
+      }\
+      BOOST_CATCH(...){\
+         this->m_reverse.pop_back();\
+         BOOST_RETHROW\
+      }\
+      BOOST_CATCH_END\
+      return this->priv_commit_slot(slot);\
+   }\
+   //
+   BOOST_MOVE_ITERATE_0TO9(BOOST_CONTAINER_SLOT_MAP_EMPLACE_CODE)
+   #undef BOOST_CONTAINER_SLOT_MAP_EMPLACE_CODE
+
+   #endif
+
+   //! <b>Effects</b>: Inserts a copy of x at the end of the values.
+   //!
+   //! <b>Returns</b>: The key of the new element.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Amortized constant time.
+   key_type insert(const T &x)
+   {  return this->emplace(x);  }
+
+   //! <b>Effects</b>: Inserts x at the end of the values using T's move constructor.
+   //!
+   //! <b>Returns</b>: The key of the new element.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or T's move constructor throws.
+   //!
+   //! <b>Complexity</b>: Amortized constant time.
+   key_type insert(BOOST_RV_REF(T) x)
+   {  return this->emplace(boost::move(x));  }
+
+   //! <b>Requires</b>: p must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Erases the element pointed by p moving the last element to its position.
+   //!   The key of the erased element becomes invalid.
+   //!
+   //! <b>Returns</b>: An iterator to the element that took the place of the erased one,
+   //!   end() if the erased element was the last one.
+   //!
+   //! <b>Throws</b>: If T's move assignment throws.
+   //!
+   //! <b>Complexity</b>: Constant.
+   iterator erase(const_iterator p)
+   {
+      const size_type pos  = this->priv_index_of(p);
+      const size_type slot = this->m_reverse[pos];
+      const size_type last = this->m_values.size() - 1u;
+      if(pos != last){
+         this->m_values[pos] = boost::move(this->m_values[last]);
+         this->m_reverse[pos] = this->m_reverse[last];
+         this->m_slots[this->m_reverse[pos]].index = pos;
+      }
+      this->m_values.pop_back();
+      this->m_reverse.pop_back();
+      this->priv_free_slot(slot);
+      return this->m_values.nth(pos);
+   }
+
+   //! <b>Effects</b>: Erases the element referred by k, if k is a valid key of *this,
+   //!   moving the last element to its position. k becomes invalid.
+   //!
+   //! <b>Returns</b>: The number of erased elements (1 or 0).
+   //!
+   //! <b>Throws</b>: If T's move assignment throws.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type erase(const key_type &k)
+   {
+      if(!this->priv_is_valid(k)){
+         return 0u;
+      }
+      this->erase(this->m_values.nth(this->m_slots[k.index].index));
+      return 1u;
+   }
+
+   //! <b>Effects</b>: Swaps the contents of *this and x. Keys of each container
+   //!   become keys of the other one.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   void swap(slot_map& x)
+      BOOST_NOEXCEPT_IF( allocator_traits_type::propagate_on_container_swap::value
+                                || allocator_traits_type::is_always_equal::value)
+   {
+      this->m_values.swap(x.m_values);
+      this->m_slots.swap(x.m_slots);
+      this->m_reverse.swap(x.m_reverse);
+      ::boost::adl_move_swap(this->m_free_head, x.m_free_head);
+   }
+
+   //! <b>Effects</b>: Erases all the elements of the slot_map. All keys become invalid.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to size().
+   void clear() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      this->m_values.clear();
+      for(size_type i = 0, n = this->m_reverse.size(); i != n; ++i){
+         this->priv_free_slot(this->m_reverse[i]);
+      }
+      this->m_reverse.clear();
+   }
+
+   //! <b>Effects</b>: x.swap(y)
+   //!
+   //! <b>Complexity</b>: Constant.
+   friend void swap(slot_map& x, slot_map& y)
+   {  x.swap(y);  }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+
+   static const size_type npos = size_type(-1);
+
+   bool priv_is_valid(const key_type &k) const
+   {
+      return k.index < this->m_slots.size() && this->m_slots[k.index].generation == k.generation;
+   }
+
+   void priv_check_key(const key_type &k) const
+   {
+      if(!this->priv_is_valid(k)){
+         throw_out_of_range("slot_map::at invalid key");
+      }
+   }
+
+   size_type priv_index_of(const_iterator p) const
+   {
+      BOOST_ASSERT(this->m_values.cbegin() <= p);
+      BOOST_ASSERT(p <= this->m_values.cend());
+      return size_type(p - this->m_values.cbegin());
+   }
+
+   //Makes sure a free slot is available and reserves the position of the new value
+   //in the reverse table. If it throws the container is unchanged except for a new free slot.
+   size_type priv_reserve_slot()
+   {
+      if(this->m_free_head == npos){
+         this->m_slots.push_back(slot_t(npos, 0u));
+         this->m_free_head = this->m_slots.size() - 1u;
+      }
+      this->m_reverse.push_back(this->m_free_head);
+      return this->m_free_head;
+   }
+
+   //Links the free slot reserved by priv_reserve_slot to the last value
+   key_type priv_commit_slot(size_type slot)
+   {
+      BOOST_ASSERT(slot == this->m_free_head);
+      slot_t &s = this->m_slots[slot];
+      this->m_free_head = s.index;
+      s.index = this->m_values.size() - 1u;
+      return key_type(slot, s.generation);
+   }
+
+   //Invalidates keys to the slot and pushes it in the free list
+   void priv_free_slot(size_type slot)
+   {
+      slot_t &s = this->m_slots[slot];
+      ++s.generation;
+      s.index = this->m_free_head;
+      this->m_free_head = slot;
+   }
+
+   values_t    m_values;
+   slots_t     m_slots;
+   reverse_t   m_reverse;
+   size_type   m_free_head;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+template <class T, class Allocator>
+const typename slot_map<T, Allocator>::size_type slot_map<T, Allocator>::npos;
+
+//!is_trivially_relocatable<> specialization: the slot_map only holds
+//!vectors that use rebound copies of the allocator and the free list head
+template <class T, class Allocator>
+struct is_trivially_relocatable<slot_map<T, Allocator> >
+   : container_detail::is_trivially_relocatable_container<Allocator>
+{};
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+}} //namespace boost::container
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace boost {
+
+//!has_trivial_destructor_after_move<> == true_type
+//!specialization for optimizations
+template <class T, class Allocator>
+struct has_trivial_destructor_after_move<boost::container::slot_map<T, Allocator> >
+{
+   typedef typename ::boost::container::allocator_traits<Allocator>::pointer pointer;
+   static const bool value = ::boost::has_trivial_destructor_after_move<Allocator>::value &&
+                             ::boost::has_trivial_destructor_after_move<pointer>::value;
+};
+
+}
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+namespace std {
+
+//!std::hash specialization, equivalent to boost::hash
+template <class SizeType>
+struct hash< ::boost::container::slot_map_key<SizeType> >
+{
+   std::size_t operator()(const ::boost::container::slot_map_key<SizeType> &x) const
+   {  return ::boost::hash< ::boost::container::slot_map_key<SizeType> >()(x);  }
+};
+
+}  //namespace std {
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif //   #ifndef  BOOST_CONTAINER_SLOT_MAP_HPP
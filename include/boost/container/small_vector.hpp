@@ -50,7 +50,7 @@ namespace container {
 
 #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
 
-template <class T, class Allocator = new_allocator<T> >
+template <class T, class Allocator = new_allocator<T>, class Options = vector_defaults >
 class small_vector_base;
 
 #endif
@@ -273,6 +273,8 @@ class small_vector_allocator
 
    pointer internal_storage() const
    {
+      //Options only select static policies, so the layout of small_vector_base does
+      //not depend on them and the default ones can be used to find the internal storage
       typedef typename Allocator::value_type                                              value_type;
       typedef container_detail::vector_alloc_holder< small_vector_allocator<Allocator> >  vector_alloc_holder_t;
       typedef vector<value_type, small_vector_allocator<Allocator> >                      vector_base;
@@ -306,9 +308,9 @@ class small_vector_allocator
 //!
 //! All `boost::container:vector` member functions are inherited. See `vector` documentation for details.
 //!
-template <class T, class SecondaryAllocator>
+template <class T, class SecondaryAllocator, class Options>
 class small_vector_base
-   : public vector<T, small_vector_allocator<SecondaryAllocator> >
+   : public vector<T, small_vector_allocator<SecondaryAllocator>, Options>
 {
    #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
    public:
@@ -327,7 +329,7 @@ class small_vector_base
          (*const_cast<T*>(static_cast<const T*>(static_cast<const void*>(&m_storage_start))));
    }
 
-   typedef vector<T, small_vector_allocator<SecondaryAllocator> > base_type;
+   typedef vector<T, small_vector_allocator<SecondaryAllocator>, Options> base_type;
          base_type &as_base()       { return static_cast<base_type&>(*this); }
    const base_type &as_base() const { return static_cast<const base_type&>(*this); }
 
@@ -436,7 +438,7 @@ struct small_vector_storage_definer
 //! It contains some preallocated elements in-place, which allows it to avoid the use of dynamic storage allocation
 //! when the actual number of elements is below that preallocated threshold.
 //!
-//! `small_vector<T, N, Allocator>` is convertible to `small_vector_base<T, Allocator>` that is independent
+//! `small_vector<T, N, Allocator, Options>` is convertible to `small_vector_base<T, Allocator, Options>` that is independent
 //! from the preallocated element capacity, so client code does not need to be templated on that N argument.
 //!
 //! All `boost::container::vector` member functions are inherited. See `vector` documentation for details.
@@ -444,14 +446,15 @@ struct small_vector_storage_definer
 //! \tparam T The type of object that is stored in the small_vector
 //! \tparam N The number of preallocated elements stored inside small_vector. It shall be less than Allocator::max_size();
 //! \tparam Allocator The allocator used for memory management when the number of elements exceeds N.
-template <class T, std::size_t N, class Allocator BOOST_CONTAINER_DOCONLY(= new_allocator<T>) >
-class small_vector : public small_vector_base<T, Allocator>
+//! \tparam Options is an packed option type generated using boost::container::vector_options.
+template <class T, std::size_t N, class Allocator BOOST_CONTAINER_DOCONLY(= new_allocator<T>), class Options BOOST_CONTAINER_DOCONLY(= vector_defaults) >
+class small_vector : public small_vector_base<T, Allocator, Options>
    #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
    , private small_vector_storage_definer<Allocator, N>::type
    #endif
 {
    #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
-   typedef small_vector_base<T, Allocator> base_type;
+   typedef small_vector_base<T, Allocator, Options> base_type;
    typedef typename small_vector_storage_definer<Allocator, N>::type remaining_storage_holder;
 
    BOOST_COPYABLE_AND_MOVABLE(small_vector)
@@ -564,6 +567,22 @@ struct has_trivial_destructor_after_move<boost::container::vector<T, Allocator>
 */
 #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
 
+#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+namespace std {
+
+//!std::hash specialization, equivalent to boost::hash
+template <class T, std::size_t N, class Allocator, class Options>
+struct hash< ::boost::container::small_vector<T, N, Allocator, Options> >
+{
+   std::size_t operator()(const ::boost::container::small_vector<T, N, Allocator, Options> &x) const
+   {  return ::boost::hash< ::boost::container::small_vector<T, N, Allocator, Options> >()(x);  }
+};
+
+}  //namespace std {
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
 #include <boost/container/detail/config_end.hpp>
 
 #endif //   #ifndef  BOOST_CONTAINER_CONTAINER_SMALL_VECTOR_HPP
@@ -0,0 +1,1418 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_SOA_FLAT_MAP_HPP
+#define BOOST_CONTAINER_SOA_FLAT_MAP_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/new_allocator.hpp> //new_allocator
+#include <boost/container/throw_exception.hpp>
+#include <boost/container/vector.hpp>
+// container/detail
+#include <boost/container/detail/hash.hpp>
+#include <boost/container/detail/iterator.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/transform_iterator.hpp> //operator_arrow_proxy
+#include <boost/container/detail/type_traits.hpp>
+#include <boost/container/detail/value_init.hpp>
+// move
+#include <boost/move/utility_core.hpp>
+#include <boost/move/traits.hpp>
+#include <boost/move/detail/move_helpers.hpp>
+// intrusive
+#include <boost/intrusive/detail/minimal_pair_header.hpp>      //pair
+#include <boost/intrusive/detail/minimal_less_equal_header.hpp>//less
+// other
+#include <boost/assert.hpp>
+#include <boost/core/no_exceptions_support.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/static_assert.hpp>
+// std
+#include <algorithm> //std::sort
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+#include <initializer_list>
+#endif
+
+namespace boost {
+namespace container {
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace container_detail {
+
+//Reference returned when dereferencing a soa_flat_map iterator: the key and the
+//mapped value live in different sequences, so there is no pair to refer to.
+template<class Key, class MappedRef>
+struct soa_flat_map_reference
+{
+   typedef Key                                              first_type;
+   typedef typename remove_const<MappedRef>::type           second_type;
+
+   soa_flat_map_reference(const Key &k, MappedRef &m)
+      : first(k), second(m)
+   {}
+
+   operator std::pair<first_type, second_type>() const
+   {  return std::pair<first_type, second_type>(first, second);  }
+
+   const Key &first;
+   MappedRef &second;
+};
+
+template<class KeyIt, class MappedIt>
+class soa_flat_map_iterator
+{
+   typedef typename iterator_traits<KeyIt>::value_type                           key_type;
+   typedef typename remove_reference
+      <typename iterator_traits<MappedIt>::reference>::type                      mapped_ref_t;
+
+   public:
+   typedef std::random_access_iterator_tag                                       iterator_category;
+   typedef std::pair<key_type, typename remove_const<mapped_ref_t>::type>        value_type;
+   typedef typename iterator_traits<KeyIt>::difference_type                      difference_type;
+   typedef soa_flat_map_reference<key_type, mapped_ref_t>                        reference;
+   typedef operator_arrow_proxy<reference>                                       pointer;
+
+   soa_flat_map_iterator()
+      : m_key(), m_mapped()
+   {}
+
+   soa_flat_map_iterator(KeyIt k, MappedIt m)
+      : m_key(k), m_mapped(m)
+   {}
+
+   //iterator to const_iterator conversion
+   template<class OtherMappedIt>
+   soa_flat_map_iterator(const soa_flat_map_iterator<KeyIt, OtherMappedIt> &other
+      , typename enable_if_c<is_convertible<OtherMappedIt, MappedIt>::value>::type* = 0)
+      : m_key(other.key_iterator()), m_mapped(other.mapped_iterator())
+   {}
+
+   const KeyIt &key_iterator() const
+   {  return m_key;  }
+
+   const MappedIt &mapped_iterator() const
+   {  return m_mapped;  }
+
+   reference operator*() const
+   {  return reference(*m_key, *m_mapped);  }
+
+   pointer operator->() const
+   {  return pointer(this->operator*());  }
+
+   reference operator[](difference_type off) const
+   {  return reference(m_key[off], m_mapped[off]);  }
+
+   soa_flat_map_iterator& operator++()
+   {  ++m_key; ++m_mapped; return *this;  }
+
+   soa_flat_map_iterator operator++(int)
+   {  soa_flat_map_iterator tmp(*this); ++*this; return tmp;  }
+
+   soa_flat_map_iterator& operator--()
+   {  --m_key; --m_mapped; return *this;  }
+
+   soa_flat_map_iterator operator--(int)
+   {  soa_flat_map_iterator tmp(*this); --*this; return tmp;  }
+
+   soa_flat_map_iterator& operator+=(difference_type off)
+   {  m_key += off; m_mapped += off; return *this;  }
+
+   soa_flat_map_iterator& operator-=(difference_type off)
+   {  m_key -= off; m_mapped -= off; return *this;  }
+
+   friend soa_flat_map_iterator operator+(soa_flat_map_iterator x, difference_type off)
+   {  return x += off;  }
+
+   friend soa_flat_map_iterator operator+(difference_type off, soa_flat_map_iterator x)
+   {  return x += off;  }
+
+   friend soa_flat_map_iterator operator-(soa_flat_map_iterator x, difference_type off)
+   {  return x -= off;  }
+
+   friend difference_type operator-(const soa_flat_map_iterator &l, const soa_flat_map_iterator &r)
+   {  return l.m_key - r.m_key;  }
+
+   //Both iterators advance together, so comparing keys is enough
+   friend bool operator==(const soa_flat_map_iterator &l, const soa_flat_map_iterator &r)
+   {  return l.m_key == r.m_key;  }
+
+   friend bool operator!=(const soa_flat_map_iterator &l, const soa_flat_map_iterator &r)
+   {  return l.m_key != r.m_key;  }
+
+   friend bool operator<(const soa_flat_map_iterator &l, const soa_flat_map_iterator &r)
+   {  return l.m_key < r.m_key;  }
+
+   friend bool operator<=(const soa_flat_map_iterator &l, const soa_flat_map_iterator &r)
+   {  return l.m_key <= r.m_key;  }
+
+   friend bool operator>(const soa_flat_map_iterator &l, const soa_flat_map_iterator &r)
+   {  return l.m_key > r.m_key;  }
+
+   friend bool operator>=(const soa_flat_map_iterator &l, const soa_flat_map_iterator &r)
+   {  return l.m_key >= r.m_key;  }
+
+   private:
+   KeyIt    m_key;
+   MappedIt m_mapped;
+};
+
+//Orders positions of a key sequence by key, equivalent keys by position
+template<class KeyIt, class Compare>
+struct soa_flat_map_index_compare
+{
+   soa_flat_map_index_compare(KeyIt keys, const Compare &comp)
+      : m_keys(keys), m_comp(comp)
+   {}
+
+   template<class SizeType>
+   bool operator()(SizeType l, SizeType r) const
+   {
+      if(m_comp(m_keys[l], m_keys[r]))
+         return true;
+      return !m_comp(m_keys[r], m_keys[l]) && l < r;
+   }
+
+   KeyIt m_keys;
+   const Compare &m_comp;
+};
+
+}  //namespace container_detail {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! A soa_flat_map is an associative container that supports unique keys and provides
+//! fast retrieval of values of another type T based on the keys. Like flat_map it's
+//! implemented as an ordered sequence, but keys and mapped values are stored in two
+//! separate vectors ("structure of arrays"): a lookup is a binary search over densely packed
+//! keys and only touches the mapped value that is found. This is much more cache-friendly
+//! than flat_map when mapped values are big.
+//!
+//! As there is no std::pair<Key, T> object stored in the container, iterators return a
+//! proxy reference with <code>first</code> (a reference to the const key) and
+//! <code>second</code> (a reference to the mapped value) members, convertible to
+//! <code>value_type</code>.
+//!
+//! Both sequences can be adopted or extracted without copying elements, so a map can be
+//! built by filling the vectors in bulk.
+//!
+//! Inserting a new element invalidates previous iterators and references. Erasing an element
+//! invalidates iterators and references pointing to elements that come after the erased element.
+//!
+//! \tparam Key is the key_type of the map
+//! \tparam T is the <code>mapped_type</code>
+//! \tparam Compare is the ordering function for Keys (e.g. <i>std::less<Key></i>).
+//! \tparam Allocator is an allocator of <code>std::pair<Key, T></code>, rebound to allocate keys
+//!   and mapped values.
+#ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
+template <class Key, class T, class Compare = std::less<Key>, class Allocator = new_allocator< std::pair< Key, T> > >
+#else
+template <class Key, class T, class Compare, class Allocator>
+#endif
+class soa_flat_map
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   BOOST_COPYABLE_AND_MOVABLE(soa_flat_map)
+   typedef allocator_traits<Allocator>                                              alloc_traits_t;
+   typedef typename alloc_traits_t::template portable_rebind_alloc<Key>::type       key_allocator_t;
+   typedef typename alloc_traits_t::template portable_rebind_alloc<T>::type         mapped_allocator_t;
+   typedef vector<Key, key_allocator_t>                                             key_container_impl;
+   typedef vector<T, mapped_allocator_t>                                            mapped_container_impl;
+   typedef typename key_container_impl::const_iterator                              key_const_iterator;
+   typedef container_detail::soa_flat_map_iterator
+      <key_const_iterator, typename mapped_container_impl::iterator>                iterator_impl;
+   typedef container_detail::soa_flat_map_iterator
+      <key_const_iterator, typename mapped_container_impl::const_iterator>          const_iterator_impl;
+
+   struct data_t
+      : public Compare
+   {
+      data_t()
+         : Compare(), m_keys(), m_values()
+      {}
+
+      data_t(const Compare &comp, const Allocator &a)
+         : Compare(comp), m_keys(key_allocator_t(a)), m_values(mapped_allocator_t(a))
+      {}
+
+      const Compare &get_comp() const
+      {  return *this;  }
+
+      key_container_impl      m_keys;
+      mapped_container_impl   m_values;
+   };
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //                    types
+   //
+   //////////////////////////////////////////////
+   typedef Key                                                                      key_type;
+   typedef T                                                                        mapped_type;
+   typedef std::pair<Key, T>                                                        value_type;
+   typedef typename alloc_traits_t::size_type                                       size_type;
+   typedef typename alloc_traits_t::difference_type                                 difference_type;
+   typedef Allocator                                                                allocator_type;
+   typedef Compare                                                                  key_compare;
+   typedef BOOST_CONTAINER_IMPDEF(key_container_impl)                               key_container_type;
+   typedef BOOST_CONTAINER_IMPDEF(mapped_container_impl)                            mapped_container_type;
+   typedef BOOST_CONTAINER_IMPDEF(iterator_impl)                                    iterator;
+   typedef BOOST_CONTAINER_IMPDEF(const_iterator_impl)                              const_iterator;
+   typedef BOOST_CONTAINER_IMPDEF(typename iterator_impl::reference)                reference;
+   typedef BOOST_CONTAINER_IMPDEF(typename const_iterator_impl::reference)          const_reference;
+   typedef BOOST_CONTAINER_IMPDEF(typename iterator_impl::pointer)                  pointer;
+   typedef BOOST_CONTAINER_IMPDEF(typename const_iterator_impl::pointer)            const_pointer;
+   typedef BOOST_CONTAINER_IMPDEF(boost::container::reverse_iterator<iterator>)        reverse_iterator;
+   typedef BOOST_CONTAINER_IMPDEF(boost::container::reverse_iterator<const_iterator>)  const_reverse_iterator;
+
+   //////////////////////////////////////////////
+   //
+   //          construct/copy/destroy
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Default constructs an empty soa_flat_map.
+   //!
+   //! <b>Complexity</b>: Constant.
+   soa_flat_map()
+      : m_data()
+   {}
+
+   //! <b>Effects</b>: Constructs an empty soa_flat_map using the specified
+   //! comparison object and allocator.
+   //!
+   //! <b>Complexity</b>: Constant.
+   explicit soa_flat_map(const Compare& comp, const allocator_type& a = allocator_type())
+      : m_data(comp, a)
+   {}
+
+   //! <b>Effects</b>: Constructs an empty soa_flat_map using the specified allocator.
+   //!
+   //! <b>Complexity</b>: Constant.
+   explicit soa_flat_map(const allocator_type& a)
+      : m_data(Compare(), a)
+   {}
+
+   //! <b>Effects</b>: Constructs an empty soa_flat_map using the specified comparison object and
+   //! allocator, and inserts elements from the range [first ,last ). If several elements have
+   //! equivalent keys, the first one is inserted.
+   //!
+   //! <b>Complexity</b>: Linear in N if the range [first ,last ) is already sorted using
+   //! comp and otherwise N logN, where N is last - first.
+   template <class InputIterator>
+   soa_flat_map(InputIterator first, InputIterator last, const Compare& comp = Compare(),
+         const allocator_type& a = allocator_type())
+      : m_data(comp, a)
+   {  this->insert(first, last);  }
+
+   //! <b>Effects</b>: Constructs an empty soa_flat_map using the specified
+   //! allocator, and inserts elements from the range [first ,last ).
+   //!
+   //! <b>Complexity</b>: Linear in N if the range [first ,last ) is already sorted using
+   //! comp and otherwise N logN, where N is last - first.
+   template <class InputIterator>
+   soa_flat_map(InputIterator first, InputIterator last, const allocator_type& a)
+      : m_data(Compare(), a)
+   {  this->insert(first, last);  }
+
+   //! <b>Effects</b>: Constructs an empty soa_flat_map using the specified comparison object and
+   //! allocator, and inserts elements from the ordered unique range [first ,last).
+   //!
+   //! <b>Requires</b>: [first ,last) must be ordered according to the predicate and must be
+   //! unique values.
+   //!
+   //! <b>Complexity</b>: Linear in N.
+   template <class InputIterator>
+   soa_flat_map( ordered_unique_range_t, InputIterator first, InputIterator last
+               , const Compare& comp = Compare(), const allocator_type& a = allocator_type())
+      : m_data(comp, a)
+   {
+      for(; first != last; ++first){
+         m_data.m_keys.emplace_back((*first).first);
+         m_data.m_values.emplace_back((*first).second);
+      }
+      BOOST_ASSERT(this->priv_is_ordered_unique());
+   }
+
+   //! <b>Effects</b>: Constructs a soa_flat_map taking ownership of the sequences of keys
+   //!   and mapped values: the i-th key is associated with the i-th mapped value.
+   //!   Sequences are sorted by key and, if several keys are equivalent, only the first
+   //!   one and its mapped value are kept.
+   //!
+   //! <b>Throws</b>: std::length_error if keys.size() != values.size().
+   //!
+   //! <b>Complexity</b>: Linear if the keys are already sorted and unique, N log N otherwise.
+   //!   No element is copied.
+   soa_flat_map( BOOST_RV_REF(key_container_type) keys, BOOST_RV_REF(mapped_container_type) values
+               , const Compare& comp = Compare())
+      : m_data(comp, keys.get_stored_allocator())
+   {  this->adopt_sequences(boost::move(keys), boost::move(values));  }
+
+   //! <b>Effects</b>: Constructs a soa_flat_map taking ownership of the sequences of keys
+   //!   and mapped values: the i-th key is associated with the i-th mapped value.
+   //!
+   //! <b>Requires</b>: keys must be ordered according to the predicate and unique.
+   //!
+   //! <b>Throws</b>: std::length_error if keys.size() != values.size().
+   //!
+   //! <b>Complexity</b>: Constant.
+   soa_flat_map( ordered_unique_range_t, BOOST_RV_REF(key_container_type) keys
+               , BOOST_RV_REF(mapped_container_type) values, const Compare& comp = Compare())
+      : m_data(comp, keys.get_stored_allocator())
+   {  this->adopt_sequences(ordered_unique_range, boost::move(keys), boost::move(values));  }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Constructs an empty soa_flat_map using the specified comparison object and
+   //! allocator, and inserts elements from the range [il.begin() ,il.end()).
+   //!
+   //! <b>Complexity</b>: Linear in N if the range [il.begin(), il.end()) is already sorted using
+   //! comp and otherwise N logN, where N is last - first.
+   soa_flat_map(std::initializer_list<value_type> il, const Compare& comp = Compare(),
+          const allocator_type& a = allocator_type())
+      : m_data(comp, a)
+   {  this->insert(il.begin(), il.end());  }
+#endif
+
+   //! <b>Effects</b>: Copy constructs a soa_flat_map.
+   //!
+   //! <b>Complexity</b>: Linear in x.size().
+   soa_flat_map(const soa_flat_map& x)
+      : m_data(x.m_data)
+   {}
+
+   //! <b>Effects</b>: Move constructs a soa_flat_map.
+   //!   Constructs *this using x's resources.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Postcondition</b>: x is emptied.
+   soa_flat_map(BOOST_RV_REF(soa_flat_map) x)
+      : m_data(x.m_data.get_comp(), x.m_data.m_keys.get_stored_allocator())
+   {  this->swap(x);  }
+
+   //! <b>Effects</b>: Makes *this a copy of x.
+   //!
+   //! <b>Complexity</b>: Linear in x.size().
+   soa_flat_map& operator=(BOOST_COPY_ASSIGN_REF(soa_flat_map) x)
+   {
+      if(&x != this){
+         static_cast<Compare&>(m_data) = x.m_data.get_comp();
+         m_data.m_keys   = x.m_data.m_keys;
+         m_data.m_values = x.m_data.m_values;
+      }
+      return *this;
+   }
+
+   //! <b>Effects</b>: Move assigns x to *this. x is emptied.
+   //!
+   //! <b>Complexity</b>: Constant if the allocators of both sequences propagate or are equal,
+   //!   linear otherwise.
+   soa_flat_map& operator=(BOOST_RV_REF(soa_flat_map) x)
+   {
+      if(&x != this){
+         static_cast<Compare&>(m_data) = boost::move(static_cast<Compare&>(x.m_data));
+         m_data.m_keys   = boost::move(x.m_data.m_keys);
+         m_data.m_values = boost::move(x.m_data.m_values);
+         x.clear();
+      }
+      return *this;
+   }
+
+   //! <b>Effects</b>: Returns a copy of the allocator that
+   //!   was passed to the object's constructor.
+   //!
+   //! <b>Complexity</b>: Constant.
+   allocator_type get_allocator() const
+   {  return allocator_type(m_data.m_keys.get_stored_allocator());  }
+
+   //////////////////////////////////////////////
+   //
+   //                iterators
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns an iterator to the first element contained in the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   iterator begin()
+   {  return iterator(m_data.m_keys.cbegin(), m_data.m_values.begin());  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the first element contained in the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator begin() const
+   {  return this->cbegin();  }
+
+   //! <b>Effects</b>: Returns an iterator to the end of the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   iterator end()
+   {  return iterator(m_data.m_keys.cend(), m_data.m_values.end());  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the end of the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator end() const
+   {  return this->cend();  }
+
+   //! <b>Effects</b>: Returns a reverse_iterator pointing to the beginning
+   //! of the reversed container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   reverse_iterator rbegin()
+   {  return reverse_iterator(this->end());  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the beginning
+   //! of the reversed container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reverse_iterator rbegin() const
+   {  return this->crbegin();  }
+
+   //! <b>Effects</b>: Returns a reverse_iterator pointing to the end
+   //! of the reversed container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   reverse_iterator rend()
+   {  return reverse_iterator(this->begin());  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end
+   //! of the reversed container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reverse_iterator rend() const
+   {  return this->crend();  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the first element contained in the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator cbegin() const
+   {  return const_iterator(m_data.m_keys.cbegin(), m_data.m_values.cbegin());  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the end of the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator cend() const
+   {  return const_iterator(m_data.m_keys.cend(), m_data.m_values.cend());  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the beginning
+   //! of the reversed container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reverse_iterator crbegin() const
+   {  return const_reverse_iterator(this->cend());  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end
+   //! of the reversed container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_reverse_iterator crend() const
+   {  return const_reverse_iterator(this->cbegin());  }
+
+   //////////////////////////////////////////////
+   //
+   //                capacity
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns true if the container contains no elements.
+   //!
+   //! <b>Complexity</b>: Constant.
+   bool empty() const
+   {  return m_data.m_keys.empty();  }
+
+   //! <b>Effects</b>: Returns the number of the elements contained in the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type size() const
+   {  return m_data.m_keys.size();  }
+
+   //! <b>Effects</b>: Returns the largest possible size of the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type max_size() const
+   {
+      const size_type k = m_data.m_keys.max_size(), m = m_data.m_values.max_size();
+      return k < m ? k : m;
+   }
+
+   //! <b>Effects</b>: Number of elements for which memory has been allocated in both sequences.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type capacity() const
+   {
+      const size_type k = m_data.m_keys.capacity(), m = m_data.m_values.capacity();
+      return k < m ? k : m;
+   }
+
+   //! <b>Effects</b>: If n is less than or equal to capacity(), this call has no
+   //!   effect. Otherwise, it is a request for allocation of additional memory
+   //!   in both sequences.
+   //!
+   //! <b>Throws</b>: If memory allocation throws, or the move constructors of Key or T throw.
+   //!
+   //! <b>Complexity</b>: Linear to size().
+   void reserve(size_type cnt)
+   {
+      m_data.m_keys.reserve(cnt);
+      m_data.m_values.reserve(cnt);
+   }
+
+   //! <b>Effects</b>: Tries to deallocate the excess of memory created
+   //!   with previous allocations in both sequences.
+   //!
+   //! <b>Complexity</b>: Linear to size().
+   void shrink_to_fit()
+   {
+      m_data.m_keys.shrink_to_fit();
+      m_data.m_values.shrink_to_fit();
+   }
+
+   //////////////////////////////////////////////
+   //
+   //               element access
+   //
+   //////////////////////////////////////////////
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //! <b>Effects</b>: If there is no key equivalent to x in the soa_flat_map, inserts
+   //!   x and a value-initialized mapped_type into the soa_flat_map.
+   //!
+   //! <b>Returns</b>: A reference to the mapped_type corresponding to x in *this.
+   //!
+   //! <b>Complexity</b>: Logarithmic search time plus linear insertion time in case no equivalent key is present.
+   mapped_type &operator[](const key_type& k);
+
+   //! <b>Effects</b>: If there is no key equivalent to x in the soa_flat_map, inserts
+   //! value_type(move(x), T()) into the soa_flat_map (the key is move-constructed)
+   //!
+   //! <b>Returns</b>: A reference to the mapped_type corresponding to x in *this.
+   //!
+   //! <b>Complexity</b>: Logarithmic search time plus linear insertion time in case no equivalent key is present.
+   mapped_type &operator[](key_type &&k) ;
+
+   #else
+   BOOST_MOVE_CONVERSION_AWARE_CATCH( operator[] , key_type, mapped_type&, this->priv_subscript)
+   #endif
+
+   //! Returns: A reference to the element whose key is equivalent to x.
+   //!
+   //! Throws: An exception object of type out_of_range if no such element is present.
+   //!
+   //! Complexity: logarithmic.
+   T& at(const key_type& k)
+   {
+      const size_type i = this->priv_find(k);
+      if(i == this->size()){
+         throw_out_of_range("soa_flat_map::at key not found");
+      }
+      return m_data.m_values[i];
+   }
+
+   //! Returns: A reference to the element whose key is equivalent to x.
+   //!
+   //! Throws: An exception object of type out_of_range if no such element is present.
+   //!
+   //! Complexity: logarithmic.
+   const T& at(const key_type& k) const
+   {
+      const size_type i = this->priv_find(k);
+      if(i == this->size()){
+         throw_out_of_range("soa_flat_map::at key not found");
+      }
+      return m_data.m_values[i];
+   }
+
+   //! <b>Returns</b>: An iterator to the n-th element of the container.
+   //!
+   //! <b>Requires</b>: size() >= n.
+   //!
+   //! <b>Complexity</b>: Constant.
+   iterator nth(size_type n)
+   {
+      BOOST_ASSERT(n <= this->size());
+      return this->begin() + difference_type(n);
+   }
+
+   //! <b>Returns</b>: A const_iterator to the n-th element of the container.
+   //!
+   //! <b>Requires</b>: size() >= n.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const_iterator nth(size_type n) const
+   {
+      BOOST_ASSERT(n <= this->size());
+      return this->cbegin() + difference_type(n);
+   }
+
+   //! <b>Returns</b>: The index of the element pointed by p.
+   //!
+   //! <b>Requires</b>: begin() <= p <= end().
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type index_of(const_iterator p) const
+   {  return size_type(p - this->cbegin());  }
+
+   //! <b>Returns</b>: The ordered sequence of keys.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const key_container_type &keys() const
+   {  return m_data.m_keys;  }
+
+   //! <b>Returns</b>: The sequence of mapped values, in the order of their keys.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const mapped_container_type &values() const
+   {  return m_data.m_values;  }
+
+   //////////////////////////////////////////////
+   //
+   //                modifiers
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Inserts x if and only if there is no element in the container
+   //!   with key equivalent to the key of x.
+   //!
+   //! <b>Returns</b>: The bool component of the returned pair is true if and only
+   //!   if the insertion takes place, and the iterator component of the pair
+   //!   points to the element with key equivalent to the key of x.
+   //!
+   //! <b>Complexity</b>: Logarithmic search time plus linear insertion
+   //!   to the elements with bigger keys than x.
+   std::pair<iterator,bool> insert(const value_type& x)
+   {  return this->emplace(x.first, x.second);  }
+
+   //! <b>Effects</b>: Inserts a copy of x if and only if there is no element in the container
+   //!   with key equivalent to the key of x. p is a hint pointing to where the insert
+   //!   should start to search.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent
+   //!   to the key of x.
+   //!
+   //! <b>Complexity</b>: Logarithmic search time (constant if x is inserted
+   //!   right before p) plus insertion linear to the elements with bigger keys than x.
+   iterator insert(const_iterator p, const value_type& x)
+   {  return this->emplace_hint(p, x.first, x.second);  }
+
+   //! <b>Effects</b>: Inserts an element with key constructed from k and mapped value constructed
+   //!   from m if and only if there is no element in the container with key equivalent to k.
+   //!
+   //! <b>Returns</b>: The bool component of the returned pair is true if and only
+   //!   if the insertion takes place, and the iterator component of the pair
+   //!   points to the element with key equivalent to k.
+   //!
+   //! <b>Complexity</b>: Logarithmic search time plus linear insertion
+   //!   to the elements with bigger keys than k.
+   template<class K, class M>
+   std::pair<iterator,bool> emplace(BOOST_FWD_REF(K) k, BOOST_FWD_REF(M) m)
+   {
+      key_type key(boost::forward<K>(k));
+      const size_type i = this->priv_lower_bound(key);
+      if(i != this->size() && !m_data.get_comp()(key, m_data.m_keys[i])){
+         return std::pair<iterator,bool>(this->nth(i), false);
+      }
+      return std::pair<iterator,bool>(this->priv_insert_at(i, boost::move(key), boost::forward<M>(m)), true);
+   }
+
+   //! <b>Effects</b>: Inserts an element with key constructed from k and mapped value constructed
+   //!   from m if and only if there is no element in the container with key equivalent to k.
+   //!   p is a hint pointing to where the insert should start to search.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the element with key equivalent to k.
+   //!
+   //! <b>Complexity</b>: Logarithmic search time (constant if the element is inserted
+   //!   right before p) plus insertion linear to the elements with bigger keys than k.
+   template<class K, class M>
+   iterator emplace_hint(const_iterator p, BOOST_FWD_REF(K) k, BOOST_FWD_REF(M) m)
+   {
+      key_type key(boost::forward<K>(k));
+      const Compare &comp = m_data.get_comp();
+      const size_type n = this->size();
+      size_type i = this->index_of(p);
+      //The hint is good if prev < key < *p
+      if( (i != n && !comp(key, m_data.m_keys[i])) || (i != 0 && !comp(m_data.m_keys[i-1], key)) ){
+         i = this->priv_lower_bound(key);
+         if(i != n && !comp(key, m_data.m_keys[i])){
+            return this->nth(i);
+         }
+      }
+      return this->priv_insert_at(i, boost::move(key), boost::forward<M>(m));
+   }
+
+   //! <b>Requires</b>: first, last are not iterators into *this.
+   //!
+   //! <b>Effects</b>: inserts each element from the range [first,last) if and only
+   //!   if there is no element with key equivalent to the key of that element. If several
+   //!   elements of the range have equivalent keys, the first one is inserted.
+   //!
+   //! <b>Complexity</b>: N log(N) comparisons to sort the new elements plus N log(size())
+   //!   to find their positions, and a linear merge with the existing elements (linear if
+   //!   the range is sorted and its keys are bigger than the keys of the container).
+   //!
+   //! <b>Throws</b>: If a copy, a comparison or an allocation throws, *this is unchanged.
+   template <class InputIterator>
+   void insert(InputIterator first, InputIterator last)
+   {
+      const size_type old_size = this->size();
+      BOOST_TRY{
+         for(; first != last; ++first){
+            m_data.m_keys.emplace_back((*first).first);
+            m_data.m_values.emplace_back((*first).second);
+         }
+         this->priv_sort_unique(old_size);
+      }
+      BOOST_CATCH(...){
+         this->priv_truncate(old_size);
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+   }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: inserts each element from the range [il.begin(), il.end()) if and only
+   //!   if there is no element with key equivalent to the key of that element.
+   //!
+   //! <b>Complexity</b>: N log(N) + N log(size()) comparisons plus a linear merge (N is il.size()).
+   void insert(std::initializer_list<value_type> il)
+   {  this->insert(il.begin(), il.end());  }
+#endif
+
+   //! <b>Effects</b>: Erases the element pointed to by p.
+   //!
+   //! <b>Returns</b>: Returns an iterator pointing to the element immediately
+   //!   following p prior to the element being erased. If no such element exists, returns end().
+   //!
+   //! <b>Complexity</b>: Linear to the elements with keys bigger than p
+   iterator erase(const_iterator p)
+   {
+      const size_type i = this->index_of(p);
+      m_data.m_keys.erase(m_data.m_keys.cbegin() + difference_type(i));
+      m_data.m_values.erase(m_data.m_values.cbegin() + difference_type(i));
+      return this->nth(i);
+   }
+
+   //! <b>Effects</b>: Erases all elements in the container with key equivalent to x.
+   //!
+   //! <b>Returns</b>: Returns the number of erased elements.
+   //!
+   //! <b>Complexity</b>: Logarithmic search time plus erasure time
+   //!   linear to the elements with bigger keys.
+   size_type erase(const key_type& x)
+   {
+      const size_type i = this->priv_find(x);
+      if(i == this->size()){
+         return 0u;
+      }
+      this->erase(this->cbegin() + difference_type(i));
+      return 1u;
+   }
+
+   //! <b>Effects</b>: Erases all the elements in the range [first, last).
+   //!
+   //! <b>Returns</b>: Returns last.
+   //!
+   //! <b>Complexity</b>: size()*N where N is the distance from first to last.
+   iterator erase(const_iterator first, const_iterator last)
+   {
+      const difference_type f = first - this->cbegin(), l = last - this->cbegin();
+      m_data.m_keys.erase(m_data.m_keys.cbegin() + f, m_data.m_keys.cbegin() + l);
+      m_data.m_values.erase(m_data.m_values.cbegin() + f, m_data.m_values.cbegin() + l);
+      return this->begin() + f;
+   }
+
+   //! <b>Effects</b>: Swaps the contents of *this and x.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   void swap(soa_flat_map& x)
+   {
+      ::boost::adl_move_swap(static_cast<Compare&>(m_data), static_cast<Compare&>(x.m_data));
+      m_data.m_keys.swap(x.m_data.m_keys);
+      m_data.m_values.swap(x.m_data.m_values);
+   }
+
+   //! <b>Effects</b>: erase(a.begin(),a.end()).
+   //!
+   //! <b>Postcondition</b>: size() == 0.
+   //!
+   //! <b>Complexity</b>: linear in size().
+   void clear()
+   {
+      m_data.m_keys.clear();
+      m_data.m_values.clear();
+   }
+
+   //! <b>Effects</b>: Replaces the contents of *this with the sequences of keys and mapped
+   //!   values: the i-th key is associated with the i-th mapped value. Sequences are sorted
+   //!   by key and, if several keys are equivalent, only the first one and its mapped value
+   //!   are kept. The previous elements of *this are destroyed.
+   //!
+   //! <b>Throws</b>: std::length_error if keys.size() != values.size(). If sorting throws,
+   //!   *this is left empty.
+   //!
+   //! <b>Complexity</b>: Linear if the keys are already sorted and unique, N log N otherwise.
+   //!   No element is copied.
+   void adopt_sequences(BOOST_RV_REF(key_container_type) keys, BOOST_RV_REF(mapped_container_type) values)
+   {
+      this->priv_adopt(keys, values);
+      BOOST_TRY{
+         this->priv_sort_unique(0u);
+      }
+      BOOST_CATCH(...){
+         this->clear();
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+   }
+
+   //! <b>Effects</b>: Replaces the contents of *this with the sequences of keys and mapped
+   //!   values: the i-th key is associated with the i-th mapped value.
+   //!   The previous elements of *this are destroyed.
+   //!
+   //! <b>Requires</b>: keys must be ordered according to the predicate and unique.
+   //!   This precondition is checked with an assertion.
+   //!
+   //! <b>Throws</b>: std::length_error if keys.size() != values.size().
+   //!
+   //! <b>Complexity</b>: Constant (linear in debug mode).
+   void adopt_sequences( ordered_unique_range_t, BOOST_RV_REF(key_container_type) keys
+                       , BOOST_RV_REF(mapped_container_type) values)
+   {
+      this->priv_adopt(keys, values);
+      BOOST_ASSERT(this->priv_is_ordered_unique());
+   }
+
+   //! <b>Effects</b>: Moves the sequences of keys and mapped values out of the container
+   //!   into keys and values, whose previous contents are destroyed. *this is left empty.
+   //!
+   //! <b>Complexity</b>: Constant if the allocators of the sequences compare equal.
+   //!   No element is copied.
+   void extract_sequences(key_container_type &keys, mapped_container_type &values)
+   {
+      keys   = boost::move(m_data.m_keys);
+      values = boost::move(m_data.m_values);
+      this->clear();
+   }
+
+   //////////////////////////////////////////////
+   //
+   //                observers
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns the comparison object out
+   //!   of which a was constructed.
+   //!
+   //! <b>Complexity</b>: Constant.
+   key_compare key_comp() const
+   {  return m_data.get_comp();  }
+
+   //////////////////////////////////////////////
+   //
+   //              map operations
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Returns</b>: An iterator pointing to an element with the key
+   //!   equivalent to x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic. Only keys are accessed during the search.
+   iterator find(const key_type& x)
+   {  return this->nth(this->priv_find(x));  }
+
+   //! <b>Returns</b>: A const_iterator pointing to an element with the key
+   //!   equivalent to x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic. Only keys are accessed during the search.
+   const_iterator find(const key_type& x) const
+   {  return this->nth(this->priv_find(x));  }
+
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: An iterator pointing to an element with the key
+   //!   equivalent to x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      find(const K& x)
+   {  return this->nth(this->priv_find(x));  }
+
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: A const_iterator pointing to an element with the key
+   //!   equivalent to x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      find(const K& x) const
+   {  return this->nth(this->priv_find(x));  }
+
+   //! <b>Returns</b>: The number of elements with key equivalent to x.
+   //!
+   //! <b>Complexity</b>: log(size()).
+   size_type count(const key_type& x) const
+   {  return size_type(this->priv_find(x) != this->size());  }
+
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: The number of elements with key equivalent to x.
+   //!
+   //! <b>Complexity</b>: log(size()).
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, size_type>::type
+      count(const K& x) const
+   {  return size_type(this->priv_find(x) != this->size());  }
+
+   //! <b>Returns</b>: An iterator pointing to the first element with key not less
+   //!   than k, or a.end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   iterator lower_bound(const key_type& x)
+   {  return this->nth(this->priv_lower_bound(x));  }
+
+   //! <b>Returns</b>: A const iterator pointing to the first element with key not
+   //!   less than k, or a.end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   const_iterator lower_bound(const key_type& x) const
+   {  return this->nth(this->priv_lower_bound(x));  }
+
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the first element with key not less
+   //!   than k, or a.end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      lower_bound(const K& x)
+   {  return this->nth(this->priv_lower_bound(x));  }
+
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: A const iterator pointing to the first element with key not
+   //!   less than k, or a.end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      lower_bound(const K& x) const
+   {  return this->nth(this->priv_lower_bound(x));  }
+
+   //! <b>Returns</b>: An iterator pointing to the first element with key greater
+   //!   than x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   iterator upper_bound(const key_type& x)
+   {  return this->nth(this->priv_upper_bound(x));  }
+
+   //! <b>Returns</b>: A const iterator pointing to the first element with key
+   //!   greater than x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   const_iterator upper_bound(const key_type& x) const
+   {  return this->nth(this->priv_upper_bound(x));  }
+
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the first element with key greater
+   //!   than x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, iterator>::type
+      upper_bound(const K& x)
+   {  return this->nth(this->priv_upper_bound(x));  }
+
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Returns</b>: A const iterator pointing to the first element with key
+   //!   greater than x, or end() if such an element is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, const_iterator>::type
+      upper_bound(const K& x) const
+   {  return this->nth(this->priv_upper_bound(x));  }
+
+   //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   std::pair<iterator,iterator> equal_range(const key_type& x)
+   {
+      const std::pair<size_type, size_type> r = this->priv_equal_range(x);
+      return std::pair<iterator,iterator>(this->nth(r.first), this->nth(r.second));
+   }
+
+   //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   std::pair<const_iterator, const_iterator> equal_range(const key_type& x) const
+   {
+      const std::pair<size_type, size_type> r = this->priv_equal_range(x);
+      return std::pair<const_iterator, const_iterator>(this->nth(r.first), this->nth(r.second));
+   }
+
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<iterator,iterator> >::type
+      equal_range(const K& x)
+   {
+      const std::pair<size_type, size_type> r = this->priv_equal_range(x);
+      return std::pair<iterator,iterator>(this->nth(r.first), this->nth(r.second));
+   }
+
+   //! <b>Requires</b>: This overload is available only if
+   //! key_compare::is_transparent exists.
+   //!
+   //! <b>Effects</b>: Equivalent to std::make_pair(this->lower_bound(k), this->upper_bound(k)).
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   template<class K>
+   typename container_detail::enable_if_transparent<key_compare, K, std::pair<const_iterator,const_iterator> >::type
+      equal_range(const K& x) const
+   {
+      const std::pair<size_type, size_type> r = this->priv_equal_range(x);
+      return std::pair<const_iterator, const_iterator>(this->nth(r.first), this->nth(r.second));
+   }
+
+   //! <b>Effects</b>: Returns true if x and y are equal
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend bool operator==(const soa_flat_map& x, const soa_flat_map& y)
+   {  return x.m_data.m_keys == y.m_data.m_keys && x.m_data.m_values == y.m_data.m_values;  }
+
+   //! <b>Effects</b>: Returns true if x and y are unequal
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend bool operator!=(const soa_flat_map& x, const soa_flat_map& y)
+   {  return !(x == y); }
+
+   //! <b>Effects</b>: Returns the hash value of x. Equal containers have equal hash values.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend std::size_t hash_value(const soa_flat_map& x)
+   {
+      ::boost::hash<Key> key_hasher;
+      ::boost::hash<T>   mapped_hasher;
+      std::size_t seed = 0u;
+      for(size_type i = 0, n = x.size(); i != n; ++i){
+         std::size_t h = 0u;
+         container_detail::hash_combine(h, key_hasher(x.m_data.m_keys[i]));
+         container_detail::hash_combine(h, mapped_hasher(x.m_data.m_values[i]));
+         container_detail::hash_combine(seed, h);
+      }
+      return seed;
+   }
+
+   //! <b>Effects</b>: Returns true if x is less than y
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend bool operator<(const soa_flat_map& x, const soa_flat_map& y)
+   {
+      const size_type n = x.size() < y.size() ? x.size() : y.size();
+      for(size_type i = 0; i != n; ++i){
+         const Key &xk = x.m_data.m_keys[i], &yk = y.m_data.m_keys[i];
+         if(xk < yk) return true;
+         if(yk < xk) return false;
+         const T &xm = x.m_data.m_values[i], &ym = y.m_data.m_values[i];
+         if(xm < ym) return true;
+         if(ym < xm) return false;
+      }
+      return x.size() < y.size();
+   }
+
+   //! <b>Effects</b>: Returns true if x is greater than y
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend bool operator>(const soa_flat_map& x, const soa_flat_map& y)
+   {  return y < x;  }
+
+   //! <b>Effects</b>: Returns true if x is equal or less than y
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend bool operator<=(const soa_flat_map& x, const soa_flat_map& y)
+   {  return !(y < x);  }
+
+   //! <b>Effects</b>: Returns true if x is equal or greater than y
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend bool operator>=(const soa_flat_map& x, const soa_flat_map& y)
+   {  return !(x < y);  }
+
+   //! <b>Effects</b>: x.swap(y)
+   //!
+   //! <b>Complexity</b>: Constant.
+   friend void swap(soa_flat_map& x, soa_flat_map& y)
+   {  x.swap(y);  }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   template<class K>
+   size_type priv_lower_bound(const K &k) const
+   {
+      const Compare &comp = m_data.get_comp();
+      const key_const_iterator b = m_data.m_keys.cbegin();
+      size_type first = 0u, len = this->size();
+      while(len){
+         const size_type step = len >> 1u;
+         if(comp(b[difference_type(first + step)], k)){
+            first += step + 1u;
+            len -= step + 1u;
+         }
+         else{
+            len = step;
+         }
+      }
+      return first;
+   }
+
+   template<class K>
+   size_type priv_upper_bound(const K &k) const
+   {
+      const Compare &comp = m_data.get_comp();
+      const key_const_iterator b = m_data.m_keys.cbegin();
+      size_type first = 0u, len = this->size();
+      while(len){
+         const size_type step = len >> 1u;
+         if(!comp(k, b[difference_type(first + step)])){
+            first += step + 1u;
+            len -= step + 1u;
+         }
+         else{
+            len = step;
+         }
+      }
+      return first;
+   }
+
+   template<class K>
+   size_type priv_find(const K &k) const
+   {
+      const size_type i = this->priv_lower_bound(k);
+      return (i != this->size() && !m_data.get_comp()(k, m_data.m_keys[i])) ? i : this->size();
+   }
+
+   //Keys are unique, so the range has at most one element
+   template<class K>
+   std::pair<size_type, size_type> priv_equal_range(const K &k) const
+   {
+      const size_type i = this->priv_lower_bound(k);
+      const size_type j = (i != this->size() && !m_data.get_comp()(k, m_data.m_keys[i])) ? i + 1u : i;
+      return std::pair<size_type, size_type>(i, j);
+   }
+
+   template<class K, class M>
+   iterator priv_insert_at(size_type i, BOOST_FWD_REF(K) k, BOOST_FWD_REF(M) m)
+   {
+      const difference_type off = difference_type(i);
+      m_data.m_keys.emplace(m_data.m_keys.cbegin() + off, boost::forward<K>(k));
+      BOOST_TRY{
+         m_data.m_values.emplace(m_data.m_values.cbegin() + off, boost::forward<M>(m));
+      }
+      BOOST_CATCH(...){
+         m_data.m_keys.erase(m_data.m_keys.cbegin() + off);
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      return this->nth(i);
+   }
+
+   mapped_type &priv_subscript(const key_type& k)
+   {
+      const size_type i = this->priv_lower_bound(k);
+      if(i == this->size() || m_data.get_comp()(k, m_data.m_keys[i])){
+         container_detail::value_init<mapped_type> m;
+         key_type key(k);
+         this->priv_insert_at(i, boost::move(key), boost::move(m.m_t));
+      }
+      return m_data.m_values[i];
+   }
+
+   mapped_type &priv_subscript(BOOST_RV_REF(key_type) mk)
+   {
+      key_type &k = mk;
+      const size_type i = this->priv_lower_bound(k);
+      if(i == this->size() || m_data.get_comp()(k, m_data.m_keys[i])){
+         container_detail::value_init<mapped_type> m;
+         this->priv_insert_at(i, boost::move(k), boost::move(m.m_t));
+      }
+      return m_data.m_values[i];
+   }
+
+   void priv_truncate(size_type n)
+   {
+      m_data.m_keys.erase(m_data.m_keys.cbegin() + difference_type(n), m_data.m_keys.cend());
+      m_data.m_values.erase(m_data.m_values.cbegin() + difference_type(n), m_data.m_values.cend());
+   }
+
+   void priv_adopt(key_container_type &keys, mapped_container_type &values)
+   {
+      if(keys.size() != values.size()){
+         throw_length_error("soa_flat_map::adopt_sequences sequences of different size");
+      }
+      m_data.m_keys   = boost::move(keys);
+      m_data.m_values = boost::move(values);
+   }
+
+   bool priv_is_ordered_unique() const
+   {
+      const Compare &comp = m_data.get_comp();
+      for(size_type i = 1u, n = this->size(); i < n; ++i){
+         if(!comp(m_data.m_keys[i-1u], m_data.m_keys[i]))
+            return false;
+      }
+      return true;
+   }
+
+   //Sorts the elements from position "sorted" (the ones before it are already sorted and unique),
+   //removes the ones with keys equivalent to previous ones and merges them with the old elements.
+   //Only the new elements are sorted, through a permutation of their positions, and moved
+   //to buffers sized to them. The position of each one among the old elements is found
+   //before any old element is moved, so the merge makes no comparisons and if a comparison
+   //or an allocation throws the old elements are unchanged.
+   void priv_sort_unique(size_type sorted)
+   {
+      const Compare &comp = m_data.get_comp();
+      const size_type n = this->size();
+      //Fast path: the new elements are already in order after the old ones
+      {
+         size_type i = sorted ? sorted : 1u;
+         while(i < n && comp(m_data.m_keys[i-1u], m_data.m_keys[i])){
+            ++i;
+         }
+         if(i >= n){
+            return;
+         }
+      }
+      const size_type m = n - sorted;
+      typedef typename alloc_traits_t::template portable_rebind_alloc<size_type>::type  index_allocator_t;
+      vector<size_type, index_allocator_t> order(m, default_init, index_allocator_t(m_data.m_keys.get_stored_allocator()));
+      for(size_type i = 0; i != m; ++i){
+         order[i] = sorted + i;
+      }
+      //Stable: among equivalent keys the first position is kept
+      std::sort( order.begin(), order.end()
+               , container_detail::soa_flat_map_index_compare<key_const_iterator, Compare>(m_data.m_keys.cbegin(), comp));
+      key_container_impl keys(m_data.m_keys.get_stored_allocator());
+      keys.reserve(m);
+      mapped_container_impl values(m_data.m_values.get_stored_allocator());
+      values.reserve(m);
+      //Moves the unique new elements to the buffers, storing in order[u]
+      //the number of old elements that must precede the u-th one
+      const key_const_iterator kbeg = m_data.m_keys.cbegin();
+      size_type u = 0u, pos = 0u;
+      for(size_type i = 0; i != m; ++i){
+         const size_type src = order[i];
+         const key_type &k = m_data.m_keys[src];
+         if(u && !comp(keys.back(), k)){
+            continue;
+         }
+         pos = size_type(std::lower_bound(kbeg + difference_type(pos), kbeg + difference_type(sorted), k, comp) - kbeg);
+         if(pos != sorted && !comp(k, m_data.m_keys[pos])){
+            continue;
+         }
+         keys.push_back(boost::move(m_data.m_keys[src]));
+         values.push_back(boost::move(m_data.m_values[src]));
+         order[u++] = pos;
+      }
+      //Merges backwards: the new elements only overwrite moved ones
+      size_type d = sorted + u, p = sorted;
+      while(u){
+         --u;
+         for(const size_type stop = order[u]; p != stop; ){
+            --p;
+            --d;
+            m_data.m_keys[d]   = boost::move(m_data.m_keys[p]);
+            m_data.m_values[d] = boost::move(m_data.m_values[p]);
+         }
+         --d;
+         m_data.m_keys[d]   = boost::move(keys[u]);
+         m_data.m_values[d] = boost::move(values[u]);
+      }
+      this->priv_truncate(sorted + keys.size());
+   }
+
+   data_t m_data;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+}  //namespace container {
+
+//!has_trivial_destructor_after_move<> == true_type
+//!specialization for optimizations
+template <class Key, class T, class Compare, class Allocator>
+struct has_trivial_destructor_after_move<boost::container::soa_flat_map<Key, T, Compare, Allocator> >
+{
+   typedef typename ::boost::container::allocator_traits<Allocator>::pointer pointer;
+   static const bool value = ::boost::has_trivial_destructor_after_move<Allocator>::value &&
+                             ::boost::has_trivial_destructor_after_move<pointer>::value &&
+                             ::boost::has_trivial_destructor_after_move<Compare>::value;
+};
+
+namespace container {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+}}
+
+#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+namespace std {
+
+//!std::hash specialization, equivalent to boost::hash
+template <class Key, class T, class Compare, class Allocator>
+struct hash< ::boost::container::soa_flat_map<Key, T, Compare, Allocator> >
+{
+   std::size_t operator()(const ::boost::container::soa_flat_map<Key, T, Compare, Allocator> &x) const
+   {  return ::boost::hash< ::boost::container::soa_flat_map<Key, T, Compare, Allocator> >()(x);  }
+};
+
+}  //namespace std {
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_SOA_FLAT_MAP_HPP
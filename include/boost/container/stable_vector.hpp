@@ -34,6 +34,7 @@
 #include <boost/container/allocator_traits.hpp>
 #include <boost/container/container_fwd.hpp>
 #include <boost/container/new_allocator.hpp> //new_allocator
+#include <boost/container/options.hpp>
 #include <boost/container/throw_exception.hpp>
 // container/detail
 #include <boost/container/detail/addressof.hpp>
@@ -41,6 +42,7 @@
 #include <boost/container/detail/alloc_helpers.hpp>
 #include <boost/container/detail/allocator_version_traits.hpp>
 #include <boost/container/detail/construct_in_place.hpp>
+#include <boost/container/detail/hash.hpp>
 #include <boost/container/detail/iterator.hpp>
 #include <boost/container/detail/iterators.hpp>
 #include <boost/container/detail/placement_new.hpp>
@@ -144,7 +146,7 @@ struct node
    typename ::boost::intrusive::pointer_traits<Pointer>::element_type value;
 };
 
-template<class VoidPtr, class VoidAllocator>
+template<class VoidPtr, class VoidAllocator, class Options>
 struct index_traits
 {
    typedef boost::intrusive::
@@ -164,7 +166,7 @@ struct index_traits
          template portable_rebind_alloc
             <node_base_ptr>::type                     node_base_ptr_allocator;
    typedef ::boost::container::vector
-      <node_base_ptr, node_base_ptr_allocator>        index_type;
+      <node_base_ptr, node_base_ptr_allocator, Options> index_type;
    typedef typename index_type::iterator              index_iterator;
    typedef typename index_type::const_iterator        const_index_iterator;
    typedef typename index_type::size_type             size_type;
@@ -420,10 +422,12 @@ class stable_vector_iterator
 //!
 //! \tparam T The type of object that is stored in the stable_vector
 //! \tparam Allocator The allocator used for all internal memory management
+//! \tparam Options is an packed option type generated using boost::container::vector_options.
+//!   Its growth factor applies to the index of node pointers.
 #ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
-template <class T, class Allocator = new_allocator<T> >
+template <class T, class Allocator = new_allocator<T>, class Options = vector_defaults >
 #else
-template <class T, class Allocator>
+template <class T, class Allocator, class Options>
 #endif
 class stable_vector
 {
@@ -438,7 +442,7 @@ class stable_vector
       template portable_rebind_alloc
          <void>::type                                 void_allocator_type;
    typedef stable_vector_detail::index_traits
-      <void_ptr, void_allocator_type>                 index_traits_type;
+      <void_ptr, void_allocator_type, Options>        index_traits_type;
    typedef typename index_traits_type::node_base_type node_base_type;
    typedef typename index_traits_type::node_base_ptr  node_base_ptr;
    typedef typename index_traits_type::
@@ -1670,6 +1674,12 @@ class stable_vector
    friend bool operator!=(const stable_vector& x, const stable_vector& y)
    {  return !(x == y); }
 
+   //! <b>Effects</b>: Returns the hash value of x. Equal containers have equal hash values.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend std::size_t hash_value(const stable_vector& x)
+   {  return container_detail::hash_range(x.begin(), x.end());  }
+
    //! <b>Effects</b>: Returns true if x is less than y
    //!
    //! <b>Complexity</b>: Linear to the number of elements in the container.
@@ -2041,8 +2051,8 @@ class stable_vector
 
 //!has_trivial_destructor_after_move<> == true_type
 //!specialization for optimizations
-template <class T, class Allocator>
-struct has_trivial_destructor_after_move<boost::container::stable_vector<T, Allocator> >
+template <class T, class Allocator, class Options>
+struct has_trivial_destructor_after_move<boost::container::stable_vector<T, Allocator, Options> >
 {
    typedef typename ::boost::container::allocator_traits<Allocator>::pointer pointer;
    static const bool value = ::boost::has_trivial_destructor_after_move<Allocator>::value &&
@@ -2055,6 +2065,22 @@ namespace container {
 
 }} //namespace boost{  namespace container {
 
+#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+namespace std {
+
+//!std::hash specialization, equivalent to boost::hash
+template <class T, class Allocator, class Options>
+struct hash< ::boost::container::stable_vector<T, Allocator, Options> >
+{
+   std::size_t operator()(const ::boost::container::stable_vector<T, Allocator, Options> &x) const
+   {  return ::boost::hash< ::boost::container::stable_vector<T, Allocator, Options> >()(x);  }
+};
+
+}  //namespace std {
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
 #include <boost/container/detail/config_end.hpp>
 
 #endif   //BOOST_CONTAINER_STABLE_VECTOR_HPP
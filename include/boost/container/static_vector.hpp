@@ -1215,8 +1215,35 @@ inline void swap(static_vector<V, C1> & x, static_vector<V, C2> & y
 
 #endif // BOOST_CONTAINER_DOXYGEN_INVOKED
 
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//!is_trivially_relocatable<> specialization: elements are stored inside
+//!the static_vector, which holds no pointers to them
+template <class T, std::size_t Capacity>
+struct is_trivially_relocatable<static_vector<T, Capacity> >
+   : is_trivially_relocatable<T>
+{};
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
 }} // namespace boost::container
 
+#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+namespace std {
+
+//!std::hash specialization, equivalent to boost::hash
+template <class T, std::size_t Capacity>
+struct hash< ::boost::container::static_vector<T, Capacity> >
+{
+   std::size_t operator()(const ::boost::container::static_vector<T, Capacity> &x) const
+   {  return ::boost::hash< ::boost::container::static_vector<T, Capacity> >()(x);  }
+};
+
+}  //namespace std {
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
 #include <boost/container/detail/config_end.hpp>
 
 #endif // BOOST_CONTAINER_STATIC_VECTOR_HPP
@@ -24,12 +24,15 @@
 #include <boost/container/container_fwd.hpp>
 // container
 #include <boost/container/allocator_traits.hpp>
+#include <boost/container/is_trivially_relocatable.hpp>
 #include <boost/container/new_allocator.hpp> //new_allocator
+#include <boost/container/options.hpp>
 #include <boost/container/throw_exception.hpp>
 // container/detail
 #include <boost/container/detail/alloc_helpers.hpp>
 #include <boost/container/detail/allocator_version_traits.hpp>
 #include <boost/container/detail/allocation_type.hpp>
+#include <boost/container/detail/hash.hpp>
 #include <boost/container/detail/iterator.hpp>
 #include <boost/container/detail/iterators.hpp>
 #include <boost/container/detail/min_max.hpp>
@@ -74,7 +77,7 @@ namespace container_detail {
 // memory. The destructor assumes that the memory either is the internal buffer,
 // or else points to a block of memory that was allocated using string_base's
 // allocator and whose size is this->m_storage.
-template <class Allocator>
+template <class Allocator, class Options>
 class basic_string_base
 {
    basic_string_base & operator=(const basic_string_base &);
@@ -273,10 +276,9 @@ class basic_string_base
 
    size_type next_capacity(size_type additional_objects) const
    {
-      return next_capacity_calculator
-         <size_type, NextCapacityDouble /*NextCapacity60Percent*/>::
-            get( allocator_traits_type::max_size(this->alloc())
-               , this->priv_storage(), additional_objects );
+      return container_detail::next_capacity<typename Options::growth_factor_type, size_type>
+         ( allocator_traits_type::max_size(this->alloc())
+         , this->priv_storage(), additional_objects );
    }
 
    void deallocate(pointer p, size_type n)
@@ -479,19 +481,20 @@ class basic_string_base
 //! \tparam CharT The type of character it contains.
 //! \tparam Traits The Character Traits type, which encapsulates basic character operations
 //! \tparam Allocator The allocator, used for internal memory management.
+//! \tparam Options is an packed option type generated using boost::container::vector_options.
 #ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
-template <class CharT, class Traits = std::char_traits<CharT>, class Allocator = new_allocator<CharT> >
+template <class CharT, class Traits = std::char_traits<CharT>, class Allocator = new_allocator<CharT>, class Options = vector_defaults >
 #else
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 #endif
 class basic_string
-   :  private container_detail::basic_string_base<Allocator>
+   :  private container_detail::basic_string_base<Allocator, Options>
 {
    #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
    private:
    typedef allocator_traits<Allocator> allocator_traits_type;
    BOOST_COPYABLE_AND_MOVABLE(basic_string)
-   typedef container_detail::basic_string_base<Allocator> base_t;
+   typedef container_detail::basic_string_base<Allocator, Options> base_t;
    static const typename base_t::size_type InternalBufferChars = base_t::InternalBufferChars;
 
    protected:
@@ -2545,12 +2548,12 @@ wstring;
 
 // Operator+
 
-template <class CharT, class Traits, class Allocator> inline
-   basic_string<CharT,Traits,Allocator>
-   operator+(const basic_string<CharT,Traits,Allocator>& x
-            ,const basic_string<CharT,Traits,Allocator>& y)
+template <class CharT, class Traits, class Allocator, class Options> inline
+   basic_string<CharT,Traits,Allocator,Options>
+   operator+(const basic_string<CharT,Traits,Allocator,Options>& x
+            ,const basic_string<CharT,Traits,Allocator,Options>& y)
 {
-   typedef basic_string<CharT,Traits,Allocator> str_t;
+   typedef basic_string<CharT,Traits,Allocator,Options> str_t;
    typedef typename str_t::reserve_t reserve_t;
    reserve_t reserve;
    str_t result(reserve, x.size() + y.size(), x.get_stored_allocator());
@@ -2559,60 +2562,60 @@ template <class CharT, class Traits, class Allocator> inline
    return result;
 }
 
-template <class CharT, class Traits, class Allocator> inline
-   basic_string<CharT, Traits, Allocator> operator+
-      ( BOOST_RV_REF_BEG basic_string<CharT, Traits, Allocator> BOOST_RV_REF_END x
-      , BOOST_RV_REF_BEG basic_string<CharT, Traits, Allocator> BOOST_RV_REF_END y)
+template <class CharT, class Traits, class Allocator, class Options> inline
+   basic_string<CharT, Traits, Allocator, Options> operator+
+      ( BOOST_RV_REF_BEG basic_string<CharT, Traits, Allocator, Options> BOOST_RV_REF_END x
+      , BOOST_RV_REF_BEG basic_string<CharT, Traits, Allocator, Options> BOOST_RV_REF_END y)
 {
    x += y;
    return boost::move(x);
 }
 
-template <class CharT, class Traits, class Allocator> inline
-   basic_string<CharT, Traits, Allocator> operator+
-      ( BOOST_RV_REF_BEG basic_string<CharT, Traits, Allocator> BOOST_RV_REF_END x
-      , const basic_string<CharT,Traits,Allocator>& y)
+template <class CharT, class Traits, class Allocator, class Options> inline
+   basic_string<CharT, Traits, Allocator, Options> operator+
+      ( BOOST_RV_REF_BEG basic_string<CharT, Traits, Allocator, Options> BOOST_RV_REF_END x
+      , const basic_string<CharT,Traits,Allocator,Options>& y)
 {
    x += y;
    return boost::move(x);
 }
 
-template <class CharT, class Traits, class Allocator> inline
-   basic_string<CharT, Traits, Allocator> operator+
-      (const basic_string<CharT,Traits,Allocator>& x
-      ,BOOST_RV_REF_BEG basic_string<CharT, Traits, Allocator> BOOST_RV_REF_END y)
+template <class CharT, class Traits, class Allocator, class Options> inline
+   basic_string<CharT, Traits, Allocator, Options> operator+
+      (const basic_string<CharT,Traits,Allocator,Options>& x
+      ,BOOST_RV_REF_BEG basic_string<CharT, Traits, Allocator, Options> BOOST_RV_REF_END y)
 {
    y.insert(y.begin(), x.begin(), x.end());
    return boost::move(y);
 }
 
-template <class CharT, class Traits, class Allocator> inline
-   basic_string<CharT, Traits, Allocator> operator+
-      (const CharT* s, basic_string<CharT, Traits, Allocator> y)
+template <class CharT, class Traits, class Allocator, class Options> inline
+   basic_string<CharT, Traits, Allocator, Options> operator+
+      (const CharT* s, basic_string<CharT, Traits, Allocator, Options> y)
 {
    y.insert(y.begin(), s, s + Traits::length(s));
    return y;
 }
 
-template <class CharT, class Traits, class Allocator> inline
-   basic_string<CharT,Traits,Allocator> operator+
-      (basic_string<CharT,Traits,Allocator> x, const CharT* s)
+template <class CharT, class Traits, class Allocator, class Options> inline
+   basic_string<CharT,Traits,Allocator,Options> operator+
+      (basic_string<CharT,Traits,Allocator,Options> x, const CharT* s)
 {
    x += s;
    return x;
 }
 
-template <class CharT, class Traits, class Allocator> inline
-   basic_string<CharT,Traits,Allocator> operator+
-      (CharT c, basic_string<CharT,Traits,Allocator> y)
+template <class CharT, class Traits, class Allocator, class Options> inline
+   basic_string<CharT,Traits,Allocator,Options> operator+
+      (CharT c, basic_string<CharT,Traits,Allocator,Options> y)
 {
    y.insert(y.begin(), c);
    return y;
 }
 
-template <class CharT, class Traits, class Allocator> inline
-   basic_string<CharT,Traits,Allocator> operator+
-      (basic_string<CharT,Traits,Allocator> x, const CharT c)
+template <class CharT, class Traits, class Allocator, class Options> inline
+   basic_string<CharT,Traits,Allocator,Options> operator+
+      (basic_string<CharT,Traits,Allocator,Options> x, const CharT c)
 {
    x += c;
    return x;
@@ -2620,62 +2623,62 @@ template <class CharT, class Traits, class Allocator> inline
 
 // Operator== and operator!=
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 inline bool
-operator==(const basic_string<CharT,Traits,Allocator>& x,
-           const basic_string<CharT,Traits,Allocator>& y)
+operator==(const basic_string<CharT,Traits,Allocator,Options>& x,
+           const basic_string<CharT,Traits,Allocator,Options>& y)
 {
    return x.size() == y.size() &&
           Traits::compare(x.data(), y.data(), x.size()) == 0;
 }
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 inline bool
-operator==(const CharT* s, const basic_string<CharT,Traits,Allocator>& y)
+operator==(const CharT* s, const basic_string<CharT,Traits,Allocator,Options>& y)
 {
-   typename basic_string<CharT,Traits,Allocator>::size_type n = Traits::length(s);
+   typename basic_string<CharT,Traits,Allocator,Options>::size_type n = Traits::length(s);
    return n == y.size() && Traits::compare(s, y.data(), n) == 0;
 }
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 inline bool
-operator==(const basic_string<CharT,Traits,Allocator>& x, const CharT* s)
+operator==(const basic_string<CharT,Traits,Allocator,Options>& x, const CharT* s)
 {
-   typename basic_string<CharT,Traits,Allocator>::size_type n = Traits::length(s);
+   typename basic_string<CharT,Traits,Allocator,Options>::size_type n = Traits::length(s);
    return x.size() == n && Traits::compare(x.data(), s, n) == 0;
 }
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 inline bool
-operator!=(const basic_string<CharT,Traits,Allocator>& x,
-           const basic_string<CharT,Traits,Allocator>& y)
+operator!=(const basic_string<CharT,Traits,Allocator,Options>& x,
+           const basic_string<CharT,Traits,Allocator,Options>& y)
    {  return !(x == y);  }
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 inline bool
-operator!=(const CharT* s, const basic_string<CharT,Traits,Allocator>& y)
+operator!=(const CharT* s, const basic_string<CharT,Traits,Allocator,Options>& y)
    {  return !(s == y); }
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 inline bool
-operator!=(const basic_string<CharT,Traits,Allocator>& x, const CharT* s)
+operator!=(const basic_string<CharT,Traits,Allocator,Options>& x, const CharT* s)
    {  return !(x == s);   }
 
 
 // Operator< (and also >, <=, and >=).
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 inline bool
-operator<(const basic_string<CharT,Traits,Allocator>& x, const basic_string<CharT,Traits,Allocator>& y)
+operator<(const basic_string<CharT,Traits,Allocator,Options>& x, const basic_string<CharT,Traits,Allocator,Options>& y)
 {
    return x.compare(y) < 0;
 //   return basic_string<CharT,Traits,Allocator>
 //      ::s_compare(x.begin(), x.end(), y.begin(), y.end()) < 0;
 }
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 inline bool
-operator<(const CharT* s, const basic_string<CharT,Traits,Allocator>& y)
+operator<(const CharT* s, const basic_string<CharT,Traits,Allocator,Options>& y)
 {
    return y.compare(s) > 0;
 //   basic_string<CharT,Traits,Allocator>::size_type n = Traits::length(s);
@@ -2683,9 +2686,9 @@ operator<(const CharT* s, const basic_string<CharT,Traits,Allocator>& y)
 //          ::s_compare(s, s + n, y.begin(), y.end()) < 0;
 }
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 inline bool
-operator<(const basic_string<CharT,Traits,Allocator>& x,
+operator<(const basic_string<CharT,Traits,Allocator,Options>& x,
           const CharT* s)
 {
    return x.compare(s) < 0;
@@ -2694,63 +2697,63 @@ operator<(const basic_string<CharT,Traits,Allocator>& x,
 //      ::s_compare(x.begin(), x.end(), s, s + n) < 0;
 }
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 inline bool
-operator>(const basic_string<CharT,Traits,Allocator>& x,
-          const basic_string<CharT,Traits,Allocator>& y) {
+operator>(const basic_string<CharT,Traits,Allocator,Options>& x,
+          const basic_string<CharT,Traits,Allocator,Options>& y) {
    return y < x;
 }
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 inline bool
-operator>(const CharT* s, const basic_string<CharT,Traits,Allocator>& y) {
+operator>(const CharT* s, const basic_string<CharT,Traits,Allocator,Options>& y) {
    return y < s;
 }
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 inline bool
-operator>(const basic_string<CharT,Traits,Allocator>& x, const CharT* s)
+operator>(const basic_string<CharT,Traits,Allocator,Options>& x, const CharT* s)
 {
    return s < x;
 }
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 inline bool
-operator<=(const basic_string<CharT,Traits,Allocator>& x,
-           const basic_string<CharT,Traits,Allocator>& y)
+operator<=(const basic_string<CharT,Traits,Allocator,Options>& x,
+           const basic_string<CharT,Traits,Allocator,Options>& y)
 {
   return !(y < x);
 }
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 inline bool
-operator<=(const CharT* s, const basic_string<CharT,Traits,Allocator>& y)
+operator<=(const CharT* s, const basic_string<CharT,Traits,Allocator,Options>& y)
    {  return !(y < s);  }
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 inline bool
-operator<=(const basic_string<CharT,Traits,Allocator>& x, const CharT* s)
+operator<=(const basic_string<CharT,Traits,Allocator,Options>& x, const CharT* s)
    {  return !(s < x);  }
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 inline bool
-operator>=(const basic_string<CharT,Traits,Allocator>& x,
-           const basic_string<CharT,Traits,Allocator>& y)
+operator>=(const basic_string<CharT,Traits,Allocator,Options>& x,
+           const basic_string<CharT,Traits,Allocator,Options>& y)
    {  return !(x < y);  }
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 inline bool
-operator>=(const CharT* s, const basic_string<CharT,Traits,Allocator>& y)
+operator>=(const CharT* s, const basic_string<CharT,Traits,Allocator,Options>& y)
    {  return !(s < y);  }
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 inline bool
-operator>=(const basic_string<CharT,Traits,Allocator>& x, const CharT* s)
+operator>=(const basic_string<CharT,Traits,Allocator,Options>& x, const CharT* s)
    {  return !(x < s);  }
 
 // Swap.
-template <class CharT, class Traits, class Allocator>
-inline void swap(basic_string<CharT,Traits,Allocator>& x, basic_string<CharT,Traits,Allocator>& y)
+template <class CharT, class Traits, class Allocator, class Options>
+inline void swap(basic_string<CharT,Traits,Allocator,Options>& x, basic_string<CharT,Traits,Allocator,Options>& y)
 {  x.swap(y);  }
 
 #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
@@ -2775,17 +2778,17 @@ string_fill(std::basic_ostream<CharT, Traits>& os,
 }  //namespace container_detail {
 #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 std::basic_ostream<CharT, Traits>&
-operator<<(std::basic_ostream<CharT, Traits>& os, const basic_string<CharT,Traits,Allocator>& s)
+operator<<(std::basic_ostream<CharT, Traits>& os, const basic_string<CharT,Traits,Allocator,Options>& s)
 {
    typename std::basic_ostream<CharT, Traits>::sentry sentry(os);
    bool ok = false;
 
    if (sentry) {
       ok = true;
-      typename basic_string<CharT,Traits,Allocator>::size_type n = s.size();
-      typename basic_string<CharT,Traits,Allocator>::size_type pad_len = 0;
+      typename basic_string<CharT,Traits,Allocator,Options>::size_type n = s.size();
+      typename basic_string<CharT,Traits,Allocator,Options>::size_type pad_len = 0;
       const bool left = (os.flags() & std::ios::left) != 0;
       const std::size_t w = os.width(0);
       std::basic_streambuf<CharT, Traits>* buf = os.rdbuf();
@@ -2810,9 +2813,9 @@ operator<<(std::basic_ostream<CharT, Traits>& os, const basic_string<CharT,Trait
 }
 
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 std::basic_istream<CharT, Traits>&
-operator>>(std::basic_istream<CharT, Traits>& is, basic_string<CharT,Traits,Allocator>& s)
+operator>>(std::basic_istream<CharT, Traits>& is, basic_string<CharT,Traits,Allocator,Options>& s)
 {
    typename std::basic_istream<CharT, Traits>::sentry sentry(is);
 
@@ -2857,11 +2860,11 @@ operator>>(std::basic_istream<CharT, Traits>& is, basic_string<CharT,Traits,Allo
    return is;
 }
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 std::basic_istream<CharT, Traits>&
-getline(std::istream& is, basic_string<CharT,Traits,Allocator>& s,CharT delim)
+getline(std::istream& is, basic_string<CharT,Traits,Allocator,Options>& s,CharT delim)
 {
-   typename basic_string<CharT,Traits,Allocator>::size_type nread = 0;
+   typename basic_string<CharT,Traits,Allocator,Options>::size_type nread = 0;
    typename std::basic_istream<CharT, Traits>::sentry sentry(is, true);
    if (sentry) {
       std::basic_streambuf<CharT, Traits>* buf = is.rdbuf();
@@ -2889,19 +2892,30 @@ getline(std::istream& is, basic_string<CharT,Traits,Allocator>& s,CharT delim)
    return is;
 }
 
-template <class CharT, class Traits, class Allocator>
+template <class CharT, class Traits, class Allocator, class Options>
 inline std::basic_istream<CharT, Traits>&
-getline(std::basic_istream<CharT, Traits>& is, basic_string<CharT,Traits,Allocator>& s)
+getline(std::basic_istream<CharT, Traits>& is, basic_string<CharT,Traits,Allocator,Options>& s)
 {
    return getline(is, s, '\n');
 }
 
-template <class Ch, class Allocator>
-inline std::size_t hash_value(basic_string<Ch, std::char_traits<Ch>, Allocator> const& v)
+template <class Ch, class Allocator, class Options>
+inline std::size_t hash_value(basic_string<Ch, std::char_traits<Ch>, Allocator, Options> const& v)
 {
-   return hash_range(v.begin(), v.end());
+   return container_detail::hash_contiguous_range(v.data(), v.size());
 }
 
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//!is_trivially_relocatable<> specialization: short strings are stored
+//!inside the object but there are no pointers to the object itself
+template <class CharT, class Traits, class Allocator, class Options>
+struct is_trivially_relocatable<basic_string<CharT, Traits, Allocator, Options> >
+   : container_detail::is_trivially_relocatable_container<Allocator>
+{};
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
 }}
 
 #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
@@ -2910,8 +2924,8 @@ namespace boost {
 
 //!has_trivial_destructor_after_move<> == true_type
 //!specialization for optimizations
-template <class C, class T, class Allocator>
-struct has_trivial_destructor_after_move<boost::container::basic_string<C, T, Allocator> >
+template <class C, class T, class Allocator, class Options>
+struct has_trivial_destructor_after_move<boost::container::basic_string<C, T, Allocator, Options> >
 {
    typedef typename ::boost::container::allocator_traits<Allocator>::pointer pointer;
    static const bool value = ::boost::has_trivial_destructor_after_move<Allocator>::value &&
@@ -2922,6 +2936,22 @@ struct has_trivial_destructor_after_move<boost::container::basic_string<C, T, Al
 
 #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
 
+#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+namespace std {
+
+//!std::hash specialization, equivalent to boost::hash
+template <class CharT, class Allocator, class Options>
+struct hash< ::boost::container::basic_string<CharT, std::char_traits<CharT>, Allocator, Options> >
+{
+   std::size_t operator()(const ::boost::container::basic_string<CharT, std::char_traits<CharT>, Allocator, Options> &x) const
+   {  return ::boost::hash< ::boost::container::basic_string<CharT, std::char_traits<CharT>, Allocator, Options> >()(x);  }
+};
+
+}  //namespace std {
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
 #include <boost/container/detail/config_end.hpp>
 
 #endif // BOOST_CONTAINER_STRING_HPP
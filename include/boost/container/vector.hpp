@@ -25,7 +25,9 @@
 // container
 #include <boost/container/container_fwd.hpp>
 #include <boost/container/allocator_traits.hpp>
+#include <boost/container/is_trivially_relocatable.hpp>
 #include <boost/container/new_allocator.hpp> //new_allocator
+#include <boost/container/options.hpp>
 #include <boost/container/throw_exception.hpp>
 // container detail
 #include <boost/container/detail/advanced_insert_int.hpp>
@@ -34,6 +36,7 @@
 #include <boost/container/detail/allocation_type.hpp>
 #include <boost/container/detail/copy_move_algo.hpp>
 #include <boost/container/detail/destroyers.hpp>
+#include <boost/container/detail/hash.hpp>
 #include <boost/container/detail/iterator.hpp>
 #include <boost/container/detail/iterators.hpp>
 #include <boost/container/detail/iterator_to_raw_pointer.hpp>
@@ -307,6 +310,7 @@ struct vector_value_traits_base
    static const bool nothrow_copy = is_nothrow_copy_constructible<T>::value || trivial_copy;
    static const bool trivial_assign = is_trivially_copy_assignable<T>::value;
    static const bool nothrow_assign = is_nothrow_copy_assignable<T>::value || trivial_assign;
+   static const bool trivial_relocate = ::boost::container::is_trivially_relocatable<T>::value;
 };
 
 
@@ -483,12 +487,12 @@ struct vector_alloc_holder
       return success;
    }
 
+   template<class GrowthFactorType>
    size_type next_capacity(size_type additional_objects) const
    {
-      return next_capacity_calculator
-         <size_type, NextCapacityDouble //NextCapacity60Percent
-         >::get( allocator_traits_type::max_size(this->alloc())
-               , this->m_capacity, additional_objects );
+      return container_detail::next_capacity<GrowthFactorType>
+         ( allocator_traits_type::max_size(this->alloc())
+         , this->m_capacity, additional_objects );
    }
 
    pointer     m_start;
@@ -700,7 +704,8 @@ struct vector_alloc_holder<Allocator, version_0>
 //!
 //! \tparam T The type of object that is stored in the vector
 //! \tparam Allocator The allocator used for all internal memory management
-template <class T, class Allocator BOOST_CONTAINER_DOCONLY(= new_allocator<T>) >
+//! \tparam Options is an packed option type generated using boost::container::vector_options.
+template <class T, class Allocator BOOST_CONTAINER_DOCONLY(= new_allocator<T>), class Options BOOST_CONTAINER_DOCONLY(= vector_defaults) >
 class vector
 {
    #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
@@ -716,7 +721,8 @@ class vector
    typedef boost::container::container_detail::vector_alloc_holder<Allocator> alloc_holder_t;
    alloc_holder_t m_holder;
    typedef allocator_traits<Allocator>                      allocator_traits_type;
-   template <class U, class UAllocator>
+   typedef typename Options::growth_factor_type             growth_factor_type;
+   template <class U, class UAllocator, class UOptions>
    friend class vector;
 
    typedef typename allocator_traits_type::pointer  pointer_impl;
@@ -988,8 +994,8 @@ class vector
    //! <b>Complexity</b>: Linear.
    //!
    //! <b>Note</b>: Non-standard extension to support static_vector
-   template<class OtherAllocator>
-   vector(BOOST_RV_REF_BEG vector<T, OtherAllocator> BOOST_RV_REF_END x
+   template<class OtherAllocator, class OtherOptions>
+   vector(BOOST_RV_REF_BEG vector<T, OtherAllocator, OtherOptions> BOOST_RV_REF_END x
          , typename container_detail::enable_if_c
             < container_detail::is_version<OtherAllocator, 0>::value>::type * = 0
          )
@@ -1114,13 +1120,13 @@ class vector
    //! <b>Complexity</b>: Linear.
    //!
    //! <b>Note</b>: Non-standard extension to support static_vector
-   template<class OtherAllocator>
+   template<class OtherAllocator, class OtherOptions>
    typename container_detail::enable_if_and
                            < vector&
                            , container_detail::is_version<OtherAllocator, 0>
                            , container_detail::is_different<OtherAllocator, allocator_type>
                            >::type
-      operator=(BOOST_RV_REF_BEG vector<value_type, OtherAllocator> BOOST_RV_REF_END x)
+      operator=(BOOST_RV_REF_BEG vector<value_type, OtherAllocator, OtherOptions> BOOST_RV_REF_END x)
    {
       this->priv_move_assign(boost::move(x));
       return *this;
@@ -1136,13 +1142,13 @@ class vector
    //! <b>Complexity</b>: Linear.
    //!
    //! <b>Note</b>: Non-standard extension to support static_vector
-   template<class OtherAllocator>
+   template<class OtherAllocator, class OtherOptions>
    typename container_detail::enable_if_and
                            < vector&
                            , container_detail::is_version<OtherAllocator, 0>
                            , container_detail::is_different<OtherAllocator, allocator_type>
                            >::type
-      operator=(const vector<value_type, OtherAllocator> &x)
+      operator=(const vector<value_type, OtherAllocator, OtherOptions> &x)
    {
       this->priv_copy_assign(x);
       return *this;
@@ -1966,6 +1972,16 @@ class vector
       const pointer p = vector_iterator_get_ptr(position);
       T *const pos_ptr = container_detail::to_raw_pointer(p);
       T *const beg_ptr = container_detail::to_raw_pointer(this->m_holder.start());
+      if(value_traits::trivial_relocate){
+         //Destroy the element and relocate the following ones over it
+         allocator_traits_type::destroy(this->get_stored_allocator(), pos_ptr);
+         --this->m_holder.m_size;
+         const size_type elems_after = size_type(beg_ptr + this->m_holder.m_size - pos_ptr);
+         if(elems_after){
+            ::boost::container::uninitialized_relocate_n(pos_ptr + 1, elems_after, pos_ptr);
+         }
+         return iterator(p);
+      }
       T *const new_end_ptr = ::boost::container::move(pos_ptr + 1, beg_ptr + this->m_holder.m_size, pos_ptr);
       //Move elements forward and destroy last
       this->priv_destroy_last(pos_ptr == new_end_ptr);
@@ -1984,8 +2000,19 @@ class vector
          T* const old_end_ptr = this->back_raw();
          T* const first_ptr = container_detail::to_raw_pointer(vector_iterator_get_ptr(first));
          T* const last_ptr  = container_detail::to_raw_pointer(vector_iterator_get_ptr(last));
-         T* const ptr = container_detail::to_raw_pointer(boost::container::move(last_ptr, old_end_ptr, first_ptr));
-         this->priv_destroy_last_n(old_end_ptr - ptr, last_ptr == old_end_ptr);
+         if(value_traits::trivial_relocate){
+            //Destroy the range and relocate the following elements over it
+            const size_type n = static_cast<size_type>(last_ptr - first_ptr);
+            boost::container::destroy_alloc_n(this->get_stored_allocator(), first_ptr, n);
+            this->m_holder.m_size -= n;
+            if(last_ptr != old_end_ptr){
+               ::boost::container::uninitialized_relocate_n(last_ptr, size_type(old_end_ptr - last_ptr), first_ptr);
+            }
+         }
+         else{
+            T* const ptr = container_detail::to_raw_pointer(boost::container::move(last_ptr, old_end_ptr, first_ptr));
+            this->priv_destroy_last_n(old_end_ptr - ptr, last_ptr == old_end_ptr);
+         }
       }
       return iterator(vector_iterator_get_ptr(first));
    }
@@ -2012,8 +2039,8 @@ class vector
    //! <b>Complexity</b>: Linear
    //!
    //! <b>Note</b>: Non-standard extension to support static_vector
-   template<class OtherAllocator>
-   void swap(vector<T, OtherAllocator> & x
+   template<class OtherAllocator, class OtherOptions>
+   void swap(vector<T, OtherAllocator, OtherOptions> & x
             , typename container_detail::enable_if_and
                      < void
                      , container_detail::is_version<OtherAllocator, 0>
@@ -2044,6 +2071,12 @@ class vector
    friend bool operator!=(const vector& x, const vector& y)
    {  return !(x == y); }
 
+   //! <b>Effects</b>: Returns the hash value of x. Equal containers have equal hash values.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   friend std::size_t hash_value(const vector& x)
+   {  return container_detail::hash_contiguous_range(x.data(), x.size());  }
+
    //! <b>Effects</b>: Returns true if x is less than y
    //!
    //! <b>Complexity</b>: Linear to the number of elements in the container.
@@ -2346,8 +2379,8 @@ class vector
       return static_cast<size_type>(p - this->m_holder.start());
    }
 
-   template<class OtherAllocator>
-   void priv_move_assign(BOOST_RV_REF_BEG vector<T, OtherAllocator> BOOST_RV_REF_END x
+   template<class OtherAllocator, class OtherOptions>
+   void priv_move_assign(BOOST_RV_REF_BEG vector<T, OtherAllocator, OtherOptions> BOOST_RV_REF_END x
       , typename container_detail::enable_if_c
          < container_detail::is_version<OtherAllocator, 0>::value >::type * = 0)
    {
@@ -2363,8 +2396,8 @@ class vector
       this->m_holder.m_size = other_sz;
    }
 
-   template<class OtherAllocator>
-   void priv_move_assign(BOOST_RV_REF_BEG vector<T, OtherAllocator> BOOST_RV_REF_END x
+   template<class OtherAllocator, class OtherOptions>
+   void priv_move_assign(BOOST_RV_REF_BEG vector<T, OtherAllocator, OtherOptions> BOOST_RV_REF_END x
       , typename container_detail::disable_if_or
          < void
          , container_detail::is_version<OtherAllocator, 0>
@@ -2403,8 +2436,8 @@ class vector
       container_detail::move_alloc(this_alloc, x_alloc, container_detail::bool_<propagate_alloc>());
    }
 
-   template<class OtherAllocator>
-   void priv_copy_assign(const vector<T, OtherAllocator> &x
+   template<class OtherAllocator, class OtherOptions>
+   void priv_copy_assign(const vector<T, OtherAllocator, OtherOptions> &x
       , typename container_detail::enable_if_c
          < container_detail::is_version<OtherAllocator, 0>::value >::type * = 0)
    {
@@ -2420,13 +2453,13 @@ class vector
       this->m_holder.m_size = other_sz;
    }
 
-   template<class OtherAllocator>
+   template<class OtherAllocator, class OtherOptions>
    typename container_detail::disable_if_or
       < void
       , container_detail::is_version<OtherAllocator, 0>
       , container_detail::is_different<OtherAllocator, allocator_type>
       >::type
-      priv_copy_assign(const vector<T, OtherAllocator> &x)
+      priv_copy_assign(const vector<T, OtherAllocator, OtherOptions> &x)
    {
       allocator_type &this_alloc     = this->m_holder.alloc();
       const allocator_type &x_alloc  = x.m_holder.alloc();
@@ -2450,7 +2483,7 @@ class vector
    {
       const bool propagate_alloc = allocator_traits_type::propagate_on_container_swap::value;
       if(are_swap_propagable( this->get_stored_allocator(), this->m_holder.start()
-                            , x.get_stored_allocator(), this->m_holder.start(), propagate_alloc)){
+                            , x.get_stored_allocator(), x.m_holder.start(), propagate_alloc)){
          //Just swap internals
          this->m_holder.swap_resources(x.m_holder);
       }
@@ -2469,6 +2502,8 @@ class vector
                    , boost::make_move_iterator(container_detail::iterator_to_raw_pointer(big.nth(common_elements)))
                    , boost::make_move_iterator(container_detail::iterator_to_raw_pointer(big.end()))
                    );
+         //Destroy remaining elements
+         big.erase(big.nth(common_elements), big.cend());
       }
       //And now swap the allocator
       container_detail::swap_alloc(this->m_holder.alloc(), x.m_holder.alloc(), container_detail::bool_<propagate_alloc>());
@@ -2709,7 +2744,7 @@ class vector
       const size_type n_pos = pos - this->m_holder.start();
       T *const raw_pos = container_detail::to_raw_pointer(pos);
 
-      const size_type new_cap = this->m_holder.next_capacity(n);
+      const size_type new_cap = this->m_holder.template next_capacity<growth_factor_type>(n);
       //Pass the hint so that allocators can take advantage of this.
       T * const new_buf = container_detail::to_raw_pointer(allocator_traits_type::allocate(this->m_holder.alloc(), new_cap, this->m_holder.m_start));
       #ifdef BOOST_CONTAINER_VECTOR_ALLOC_STATS
@@ -2730,7 +2765,7 @@ class vector
 
       //There is not enough memory, allocate a new
       //buffer or expand the old one.
-      size_type real_cap = this->m_holder.next_capacity(n);
+      size_type real_cap = this->m_holder.template next_capacity<growth_factor_type>(n);
       pointer reuse(this->m_holder.start());
       pointer const ret (this->m_holder.allocation_command
          (allocate_new | expand_fwd | expand_bwd, this->m_holder.m_size + n, real_cap, reuse));
@@ -2918,6 +2953,24 @@ class vector
          insert_range_proxy.uninitialized_copy_n_and_update(this->m_holder.alloc(), old_finish, n);
          this->m_holder.m_size += n;
       }
+      else if (value_traits::trivial_relocate && n == 1u){
+         if(container_detail::insert_proxy_may_alias(insert_range_proxy, pos, old_finish)){
+            //The new element is built aside before opening the gap, as its source
+            //could be one of the elements to be relocated
+            typedef typename container_detail::aligned_storage
+               <sizeof(T), container_detail::alignment_of<T>::value>::type storage_t;
+            storage_t storage;
+            T * const tmp = static_cast<T*>(static_cast<void*>(&storage));
+            insert_range_proxy.uninitialized_copy_n_and_update(this->m_holder.alloc(), tmp, 1u);
+            //Nothrow: open the gap and relocate tmp to it
+            ::boost::container::uninitialized_relocate_n(pos, elems_after, pos + 1);
+            ::boost::container::uninitialized_relocate_n(tmp, 1u, pos);
+            ++this->m_holder.m_size;
+         }
+         else{
+            this->priv_relocate_and_insert_one(pos, elems_after, insert_range_proxy);
+         }
+      }
       else if (elems_after >= n){
          //New elements can be just copied.
          //Move to uninitialized memory last objects
@@ -2949,9 +3002,64 @@ class vector
       }
    }
 
+   //Opens a gap before pos relocating the elems_after elements that follow it and builds
+   //the new element there. The gap is closed again if the construction throws.
+   template <class InsertionProxy>
+   void priv_relocate_and_insert_one(T* const pos, const size_type elems_after, InsertionProxy insert_range_proxy)
+   {
+      ::boost::container::uninitialized_relocate_n(pos, elems_after, pos + 1);
+      BOOST_TRY{
+         insert_range_proxy.uninitialized_copy_n_and_update(this->m_holder.alloc(), pos, 1u);
+      }
+      BOOST_CATCH(...){
+         ::boost::container::uninitialized_relocate_n(pos + 1, elems_after, pos);
+         BOOST_RETHROW
+      }
+      BOOST_CATCH_END
+      ++this->m_holder.m_size;
+   }
+
    template <class InsertionProxy>
    void priv_forward_range_insert_new_allocation
       (T* const new_start, size_type new_cap, T* const pos, const size_type n, InsertionProxy insert_range_proxy)
+   {
+      this->priv_forward_range_insert_new_allocation
+         (new_start, new_cap, pos, n, insert_range_proxy, container_detail::bool_<value_traits::trivial_relocate>());
+   }
+
+   template <class InsertionProxy>
+   void priv_forward_range_insert_new_allocation
+      ( T* const new_start, size_type new_cap, T* const pos, const size_type n
+      , InsertionProxy insert_range_proxy, container_detail::true_type /*trivial_relocate*/)
+   {
+      //n can be zero, if we want to reallocate!
+      typename value_traits::ArrayDeallocator new_buffer_deallocator(new_start, this->m_holder.alloc(), new_cap);
+      T * const old_buffer = container_detail::to_raw_pointer(this->m_holder.start());
+      const size_type old_size = this->m_holder.m_size;
+      const size_type elems_before = old_buffer ? size_type(pos - old_buffer) : 0u;
+      //New elements are constructed first, as they might be built from old ones.
+      //If this throws, the old buffer is untouched.
+      insert_range_proxy.uninitialized_copy_n_and_update(this->m_holder.alloc(), new_start + elems_before, n);
+      //Nothrow: relocate old elements around the new ones and deallocate the old buffer
+      if(old_buffer){
+         if(elems_before){
+            ::boost::container::uninitialized_relocate_n(old_buffer, elems_before, new_start);
+         }
+         if(old_size != elems_before){
+            ::boost::container::uninitialized_relocate_n(pos, old_size - elems_before, new_start + elems_before + n);
+         }
+         this->m_holder.alloc().deallocate(this->m_holder.start(), this->m_holder.capacity());
+      }
+      this->m_holder.start(new_start);
+      this->m_holder.m_size = old_size + n;
+      this->m_holder.capacity(new_cap);
+      new_buffer_deallocator.release();
+   }
+
+   template <class InsertionProxy>
+   void priv_forward_range_insert_new_allocation
+      ( T* const new_start, size_type new_cap, T* const pos, const size_type n
+      , InsertionProxy insert_range_proxy, container_detail::false_type /*trivial_relocate*/)
    {
       //n can be zero, if we want to reallocate!
       T *new_finish = new_start;
@@ -3329,6 +3437,17 @@ class vector
    #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
 };
 
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//!is_trivially_relocatable<> specialization: the vector only holds
+//!its allocator, a pointer to the elements, its size and capacity
+template <class T, class Allocator, class Options>
+struct is_trivially_relocatable<vector<T, Allocator, Options> >
+   : container_detail::is_trivially_relocatable_container<Allocator>
+{};
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
 }} //namespace boost::container
 
 #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
@@ -3337,8 +3456,8 @@ namespace boost {
 
 //!has_trivial_destructor_after_move<> == true_type
 //!specialization for optimizations
-template <class T, class Allocator>
-struct has_trivial_destructor_after_move<boost::container::vector<T, Allocator> >
+template <class T, class Allocator, class Options>
+struct has_trivial_destructor_after_move<boost::container::vector<T, Allocator, Options> >
 {
    typedef typename ::boost::container::allocator_traits<Allocator>::pointer pointer;
    static const bool value = ::boost::has_trivial_destructor_after_move<Allocator>::value &&
@@ -3349,6 +3468,22 @@ struct has_trivial_destructor_after_move<boost::container::vector<T, Allocator>
 
 #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
 
+#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
+namespace std {
+
+//!std::hash specialization, equivalent to boost::hash
+template <class T, class Allocator, class Options>
+struct hash< ::boost::container::vector<T, Allocator, Options> >
+{
+   std::size_t operator()(const ::boost::container::vector<T, Allocator, Options> &x) const
+   {  return ::boost::hash< ::boost::container::vector<T, Allocator, Options> >()(x);  }
+};
+
+}  //namespace std {
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_STD_HASH)
+
 #include <boost/container/detail/config_end.hpp>
 
 #endif //   #ifndef  BOOST_CONTAINER_CONTAINER_VECTOR_HPP
@@ -0,0 +1,326 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/container/detail/config_begin.hpp>
+#include <memory>
+#include <deque>
+#include <algorithm>
+#include <iostream>
+
+#include <boost/container/bit_vector.hpp>
+#include <boost/container/allocator.hpp>
+#include <boost/container/is_trivially_relocatable.hpp>
+
+#include <boost/move/utility_core.hpp>
+#include <boost/static_assert.hpp>
+#include "dummy_test_allocator.hpp"
+
+using namespace boost::container;
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+template class boost::container::bit_vector< test::simple_allocator<bool> >;
+
+template class boost::container::bit_vector< std::allocator<bool> >;
+
+template class boost::container::bit_vector< allocator<bool> >;
+
+namespace container_detail {
+
+template class bit_vector_iterator<true>;
+template class bit_vector_iterator<false>;
+
+}
+
+}}
+
+BOOST_STATIC_ASSERT(( is_trivially_relocatable< bit_vector<> >::value ));
+
+typedef bit_vector<> bit_vector_t;
+
+//Compares all the observers of a bit_vector with the bits of a std::deque<bool>
+bool check_equal(const bit_vector_t &b, const std::deque<bool> &d)
+{
+   if(b.size() != d.size() || b.empty() != d.empty())
+      return false;
+   if(!std::equal(d.begin(), d.end(), b.begin()) || !std::equal(d.rbegin(), d.rend(), b.rbegin()))
+      return false;
+   std::size_t count = 0u;
+   bit_vector_t::size_type found = b.find_first();
+   for(std::size_t i = 0; i != d.size(); ++i){
+      if(b[i] != d[i])
+         return false;
+      if(d[i]){
+         ++count;
+         if(found != i)
+            return false;
+         found = b.find_next(found);
+      }
+   }
+   return found == bit_vector_t::npos && b.count() == count &&
+          b.any() == (count != 0u) && b.none() == (count == 0u) && b.all() == (count == d.size());
+}
+
+//Pseudo-random sequence so that results are reproducible
+unsigned next_random(unsigned &seed)
+{
+   seed = seed*1103515245u + 12345u;
+   return (seed >> 16u) & 0x7fffu;
+}
+
+//Mixes insertions and erasures in every position and compares the result with std::deque<bool>
+bool test_modifiers()
+{
+   bit_vector_t b;
+   std::deque<bool> d;
+   unsigned seed = 1u;
+   for(std::size_t i = 0; i != 1000u; ++i){
+      const bool x = next_random(seed) % 3u == 0u;
+      b.push_back(x);
+      d.push_back(x);
+   }
+   if(!check_equal(b, d))
+      return false;
+
+   for(std::size_t i = 0; i != 2000u; ++i){
+      const std::size_t pos = next_random(seed) % (d.size() + 1u);
+      const bool x = (next_random(seed) & 1u) != 0u;
+      switch(i % 8u){
+         case 0:
+            b.insert(b.begin() + pos, x);
+            d.insert(d.begin() + pos, x);
+         break;
+         case 1:
+         {
+            const std::size_t n = next_random(seed) % 200u;
+            b.insert(b.begin() + pos, n, x);
+            d.insert(d.begin() + pos, n, x);
+         }
+         break;
+         case 2:
+         {
+            std::deque<bool> r(next_random(seed) % 150u);
+            for(std::size_t j = 0; j != r.size(); ++j){
+               r[j] = (next_random(seed) & 1u) != 0u;
+            }
+            b.insert(b.begin() + pos, r.begin(), r.end());
+            d.insert(d.begin() + pos, r.begin(), r.end());
+         }
+         break;
+         case 3:
+            if(pos != d.size()){
+               b.erase(b.begin() + pos);
+               d.erase(d.begin() + pos);
+            }
+         break;
+         case 4:
+         {
+            const std::size_t last = (std::min)(d.size(), pos + next_random(seed) % 300u);
+            b.erase(b.begin() + pos, b.begin() + last);
+            d.erase(d.begin() + pos, d.begin() + last);
+         }
+         break;
+         case 5:
+         {
+            const std::size_t n = next_random(seed) % 3000u;
+            b.resize(n, x);
+            d.resize(n, x);
+         }
+         break;
+         case 6:
+            if(!d.empty()){
+               b.pop_back();
+               d.pop_back();
+            }
+         break;
+         default:
+            if(pos != d.size()){
+               b.flip(pos);
+               d[pos] = !d[pos];
+            }
+         break;
+      }
+      if(!check_equal(b, d))
+         return false;
+   }
+
+   //Copy, move and swap
+   bit_vector_t c(b);
+   if(c != b || hash_value(c) != hash_value(b))
+      return false;
+   bit_vector_t m(boost::move(c));
+   if(!c.empty() || m != b)
+      return false;
+   c = boost::move(m);
+   if(!m.empty() || c != b)
+      return false;
+   c.swap(m);
+   if(!c.empty() || !check_equal(m, d))
+      return false;
+   m.clear();
+   return m.empty() && m.count() == 0u && m.find_first() == bit_vector_t::npos;
+}
+
+//Checks whole vector operations with sizes that need and don't need the SIMD path
+bool test_bitset_operations()
+{
+   unsigned seed = 7u;
+   for(std::size_t n = 0u; n < 1300u; n += 37u){
+      bit_vector_t x(n), y(n);
+      std::deque<bool> dx(n), dy(n), r(n);
+      for(std::size_t i = 0; i != n; ++i){
+         dx[i] = x[i] = (next_random(seed) & 1u) != 0u;
+         dy[i] = y[i] = (next_random(seed) & 1u) != 0u;
+      }
+      for(std::size_t i = 0; i != n; ++i){
+         r[i] = dx[i] && dy[i];
+      }
+      if(!check_equal(x & y, r))
+         return false;
+      for(std::size_t i = 0; i != n; ++i){
+         r[i] = dx[i] || dy[i];
+      }
+      if(!check_equal(x | y, r))
+         return false;
+      for(std::size_t i = 0; i != n; ++i){
+         r[i] = dx[i] != dy[i];
+      }
+      if(!check_equal(x ^ y, r))
+         return false;
+      for(std::size_t i = 0; i != n; ++i){
+         r[i] = !dx[i];
+      }
+      if(!check_equal(~x, r))
+         return false;
+
+      //Unused bits of the last block are never set
+      x.set();
+      if(!x.all() || x.count() != n || x != bit_vector_t(n, true))
+         return false;
+      x.flip();
+      if(x.any() || x.count() != 0u || x != bit_vector_t(n))
+         return false;
+      x.resize(n + 3u, true);
+      if(x.count() != 3u || x.find_first() != n)
+         return false;
+      x.reset();
+      if(!x.none())
+         return false;
+   }
+
+   //Single bit operations
+   bit_vector_t b(200u);
+   b.set(3u).set(64u).set(199u);
+   if(!b.test(3u) || !b.test(64u) || b.test(65u) || b.count() != 3u)
+      return false;
+   if(b.find_first() != 3u || b.find_next(3u) != 64u || b.find_next(64u) != 199u ||
+      b.find_next(199u) != bit_vector_t::npos || b.find_next(1000u) != bit_vector_t::npos)
+      return false;
+   b.reset(64u);
+   if(b.find_next(3u) != 199u)
+      return false;
+   bool thrown = false;
+   try{
+      b.set(200u);
+   }
+   catch(...){
+      thrown = true;
+   }
+   return thrown;
+}
+
+bool test_ordering_and_iterators()
+{
+   bit_vector_t a(5u, true), b(6u, true), c;
+   c.push_back(false);
+   if(!(a < b) || b < a || !(c < a) || !(a > c) || !(a <= a) || !(a >= a) || a == b)
+      return false;
+
+   bit_vector_t v(100u);
+   for(bit_vector_t::iterator it = v.begin(), itend = v.end(); it != itend; ++it){
+      const bit_vector_t::size_type i = bit_vector_t::size_type(it - v.begin());
+      *it = (i % 3u) == 0u;
+   }
+   bit_vector_t::const_iterator cit = v.begin();
+   if(!*cit || cit[1] || !cit[3] || (v.cend() - cit) != 100 || !(cit < v.cend()))
+      return false;
+   cit += 99;
+   if(!*cit || *--cit)
+      return false;
+   //Proxy references can be swapped and copied
+   bit_vector_t::reference r0 = v.front(), r1 = v[1u];
+   swap(r0, r1);
+   if(v[0u] || !v[1u])
+      return false;
+   r0 = r1;
+   if(!v[0u] || ~r0)
+      return false;
+   r0.flip();
+   if(v[0u] || !v[1u])
+      return false;
+   const bit_vector_t rv(v.rbegin(), v.rend());
+   if(rv.size() != v.size() || !std::equal(v.rbegin(), v.rend(), rv.begin()))
+      return false;
+   return boost::hash<bit_vector_t>()(v) != boost::hash<bit_vector_t>()(rv);
+}
+
+int main()
+{
+   {
+      //Now test move semantics
+      bit_vector_t original;
+      bit_vector_t move_ctor(boost::move(original));
+      bit_vector_t move_assign;
+      move_assign = boost::move(move_ctor);
+      move_assign.swap(original);
+   }
+
+   ////////////////////////////////////
+   //    Sequence operations testing
+   ////////////////////////////////////
+   if(!test_modifiers()){
+      std::cerr << "test_modifiers failed" << std::endl;
+      return 1;
+   }
+
+   ////////////////////////////////////
+   //    Bitset operations testing
+   ////////////////////////////////////
+   if(!test_bitset_operations()){
+      std::cerr << "test_bitset_operations failed" << std::endl;
+      return 1;
+   }
+
+   ////////////////////////////////////
+   //    Ordering and iterator testing
+   ////////////////////////////////////
+   if(!test_ordering_and_iterators()){
+      std::cerr << "test_ordering_and_iterators failed" << std::endl;
+      return 1;
+   }
+
+   ////////////////////////////////////
+   //    Initializer lists testing
+   ////////////////////////////////////
+   #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   {
+      bit_vector_t il = { true, false, true };
+      il.insert(il.begin() + 1, { false, true });
+      const bool expected[] = { true, false, true, false, true };
+      if(il.size() != 5u || !std::equal(il.begin(), il.end(), expected))
+         return 1;
+   }
+   #endif
+
+   return 0;
+}
+
+#include <boost/container/detail/config_end.hpp>
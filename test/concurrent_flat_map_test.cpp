@@ -0,0 +1,330 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/concurrent_flat_map.hpp>
+#include <boost/container/allocator.hpp>
+
+#include "dummy_test_allocator.hpp"
+#include "movable_int.hpp"
+
+#include <map>
+#include <cstdlib>
+#include <iostream>
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD)
+#include <thread>
+#include <vector>
+#endif
+
+using namespace boost::container;
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+template class concurrent_flat_map
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , test::simple_allocator< std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   >;
+
+template class concurrent_flat_map
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , std::allocator< std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   >;
+
+}} //boost::container
+
+//Adds the visited mapped value to a sum
+struct summer
+{
+   explicit summer(int &sum) : m_sum(sum) {}
+
+   template<class Pair>
+   void operator()(const Pair &p) const
+   {  m_sum += p.second.get_int();  }
+
+   int &m_sum;
+};
+
+//Inserts [first, last) mapping each key to twice its value
+struct range_inserter
+{
+   range_inserter(int first, int last) : m_first(first), m_last(last) {}
+
+   template<class Map>
+   void operator()(Map &m) const
+   {
+      typedef typename Map::key_type     key_type;
+      typedef typename Map::mapped_type  mapped_type;
+      for(int i = m_first; i != m_last; ++i){
+         m.insert(typename Map::value_type(key_type(i), mapped_type(i*2)));
+      }
+   }
+
+   int m_first, m_last;
+};
+
+//Erases the elements with odd keys
+struct odd_eraser
+{
+   template<class Map>
+   void operator()(Map &m) const
+   {
+      for(typename Map::iterator it = m.begin(); it != m.end(); ){
+         if(it->first.get_int() % 2)
+            it = m.erase(it);
+         else
+            ++it;
+      }
+   }
+};
+
+//Throws after modifying the map
+struct thrower
+{
+   template<class Map>
+   void operator()(Map &m) const
+   {
+      m.clear();
+      throw int(0);
+   }
+};
+
+template<class MyMap>
+bool check_equal(const MyMap &cmap, const std::map<int, int> &smap)
+{
+   if(cmap.size() != smap.size() || cmap.empty() != smap.empty())
+      return false;
+   int sum = 0, ssum = 0;
+   if(cmap.visit_all(summer(sum)) != smap.size())
+      return false;
+   for(std::map<int, int>::const_iterator it = smap.begin(); it != smap.end(); ++it){
+      typedef typename MyMap::key_type key_type;
+      int value = 0;
+      if(cmap.cvisit(key_type(it->first), summer(value)) != 1u || value != it->second)
+         return false;
+      ssum += it->second;
+   }
+   return sum == ssum;
+}
+
+template<class MyMap>
+int concurrent_flat_map_test()
+{
+   typedef typename MyMap::key_type             IntType;
+   typedef typename MyMap::mapped_type          MappedType;
+   typedef typename MyMap::value_type           value_type;
+   typedef typename MyMap::map_type             map_type;
+   typedef typename MyMap::snapshot_type        snapshot_type;
+   const int MaxElem = 200;
+
+   MyMap cmap(8u);
+   std::map<int, int> smap;
+   if(cmap.reader_slot_count() != 8u || !cmap.empty())
+      return 1;
+   const snapshot_type empty_snap(cmap.snapshot());
+   if(empty_snap.empty() || !empty_snap->empty())
+      return 1;
+
+   //Batched insertion
+   cmap.update(range_inserter(0, MaxElem));
+   for(int i = 0; i != MaxElem; ++i){
+      smap[i] = i*2;
+   }
+   if(!check_equal(cmap, smap) || !empty_snap->empty())
+      return 1;
+
+   //Single element insertion and erasure
+   if(cmap.insert(value_type(IntType(0), MappedType(0))) || !cmap.insert(value_type(IntType(MaxElem), MappedType(0))))
+      return 1;
+   smap[MaxElem] = 0;
+   if(cmap.erase(IntType(-1)) != 0u || cmap.erase(IntType(1)) != 1u)
+      return 1;
+   smap.erase(1);
+   if(!check_equal(cmap, smap) || cmap.count(IntType(MaxElem)) != 1u || cmap.count(IntType(1)) != 0u)
+      return 1;
+
+   //Snapshots are not affected by later publications
+   snapshot_type snap(cmap.snapshot());
+   const std::size_t snap_size = snap->size();
+   cmap.update(odd_eraser());
+   for(std::map<int, int>::iterator it = smap.begin(); it != smap.end(); ){
+      if(it->first % 2)
+         smap.erase(it++);
+      else
+         ++it;
+   }
+   if(!check_equal(cmap, smap) || snap->size() != snap_size || snap->count(IntType(3)) != 1u)
+      return 1;
+
+   //A failed update publishes nothing
+   BOOST_TRY{
+      cmap.update(thrower());
+      return 1;
+   }
+   BOOST_CATCH(int){
+   }
+   BOOST_CATCH_END
+   if(!check_equal(cmap, smap))
+      return 1;
+
+   //Snapshot copies share the version, that outlives its publication
+   snapshot_type snap2(snap);
+   snap = snapshot_type();
+   if(!snap.empty() || snap2->size() != snap_size)
+      return 1;
+
+   //replace and clear
+   map_type m;
+   m.insert(value_type(IntType(-1), MappedType(1)));
+   cmap.replace(boost::move(m));
+   smap.clear();
+   smap[-1] = 1;
+   if(!check_equal(cmap, smap))
+      return 1;
+   cmap.clear();
+   if(!cmap.empty() || cmap.size() != 0u)
+      return 1;
+
+   //Initial contents
+   map_type m2;
+   range_inserter(0, 10)(m2);
+   const MyMap cmap2(boost::move(m2), 0u);
+   return cmap2.reader_slot_count() == 1u && cmap2.size() == 10u ? 0 : 1;
+}
+
+template<class VoidAllocator>
+int test_map_variants()
+{
+   typedef typename allocator_traits<VoidAllocator>::template portable_rebind_alloc
+      < std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >::type MoveCopyAlloc;
+   typedef typename allocator_traits<VoidAllocator>::template portable_rebind_alloc
+      < std::pair<test::copyable_int, test::copyable_int> >::type CopyAlloc;
+
+   typedef concurrent_flat_map< test::movable_and_copyable_int, test::movable_and_copyable_int
+                              , std::less<test::movable_and_copyable_int>, MoveCopyAlloc> MyMoveCopyMap;
+   typedef concurrent_flat_map< test::copyable_int, test::copyable_int
+                              , std::less<test::copyable_int>, CopyAlloc> MyCopyMap;
+
+   if (0 != concurrent_flat_map_test<MyMoveCopyMap>()){
+      std::cout << "Error in concurrent_flat_map_test<MyMoveCopyMap>" << std::endl;
+      return 1;
+   }
+
+   if (0 != concurrent_flat_map_test<MyCopyMap>()){
+      std::cout << "Error in concurrent_flat_map_test<MyCopyMap>" << std::endl;
+      return 1;
+   }
+   return 0;
+}
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD)
+
+//A writer publishes versions where every mapped value equals the version number
+//while readers check that each snapshot and each traversal sees a single version
+int concurrent_publish_test()
+{
+   typedef concurrent_flat_map<int, int> map_t;
+   const int NumReaders = 6;
+   const int NumKeys = 64;
+   const int NumVersions = 500;
+   map_t m(16u);
+   m.update([](map_t::map_type &mm){ for(int i = 0; i != NumKeys; ++i) mm[i] = 0; });
+
+   struct reader
+   {
+      static void run(const map_t &m, const volatile bool &done)
+      {
+         int last = 0;
+         while(!done){
+            const map_t::snapshot_type s(m.snapshot());
+            const int v = s->begin()->second;
+            if(v < last || s->size() != std::size_t(NumKeys))
+               std::abort();
+            for(map_t::map_type::const_iterator it = s->begin(); it != s->end(); ++it){
+               if(it->second != v)
+                  std::abort();
+            }
+            int first = -1;
+            m.cvisit_all([&first](const std::pair<int, int> &p){
+               if(first < 0)
+                  first = p.second;
+               else if(p.second != first)
+                  std::abort();
+            });
+            last = v;
+         }
+      }
+   };
+
+   volatile bool done = false;
+   std::vector<std::thread> threads;
+   for(int t = 0; t != NumReaders; ++t){
+      threads.push_back(std::thread(&reader::run, std::cref(m), std::cref(done)));
+   }
+   for(int v = 1; v <= NumVersions; ++v){
+      m.update([v](map_t::map_type &mm){
+         for(map_t::map_type::iterator it = mm.begin(); it != mm.end(); ++it) it->second = v;
+      });
+   }
+   done = true;
+   for(int t = 0; t != NumReaders; ++t){
+      threads[t].join();
+   }
+
+   int total = 0;
+   m.cvisit_all([&total](const std::pair<int, int> &p){ total += p.second; });
+   return total == NumKeys*NumVersions ? 0 : 1;
+}
+
+#endif   //#if !defined(BOOST_NO_CXX11_HDR_THREAD)
+
+int main()
+{
+   //Allocator argument container
+   {
+      concurrent_flat_map<int, int> map_((concurrent_flat_map<int, int>::allocator_type()));
+      if(map_.reader_slot_count() != concurrent_flat_map<int, int>::default_reader_slot_count)
+         return 1;
+      concurrent_flat_map<int, int> rounded(5u);
+      if(rounded.reader_slot_count() != 8u)
+         return 1;
+   }
+
+   ////////////////////////////////////
+   //    Testing allocator implementations
+   ////////////////////////////////////
+   //       std::allocator
+   if(test_map_variants< std::allocator<void> >()){
+      std::cerr << "test_map_variants< std::allocator<void> > failed" << std::endl;
+      return 1;
+   }
+   //       boost::container::allocator
+   if(test_map_variants< allocator<void> >()){
+      std::cerr << "test_map_variants< allocator<void> > failed" << std::endl;
+      return 1;
+   }
+
+   #if !defined(BOOST_NO_CXX11_HDR_THREAD)
+   if(concurrent_publish_test()){
+      std::cerr << "concurrent_publish_test failed" << std::endl;
+      return 1;
+   }
+   #endif
+
+   return 0;
+}
+
+#include <boost/container/detail/config_end.hpp>
@@ -0,0 +1,359 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/concurrent_hash_map.hpp>
+#include <boost/container/allocator.hpp>
+#include <boost/container/node_allocator.hpp>
+#include <boost/container/adaptive_pool.hpp>
+
+#include "dummy_test_allocator.hpp"
+#include "movable_int.hpp"
+
+#include <map>
+#include <cstdlib>
+#include <iostream>
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD)
+#include <thread>
+#include <mutex>
+#include <vector>
+#endif
+
+using namespace boost::container;
+
+//Minimal user-provided shard lock
+class test_mutex
+{
+   test_mutex(const test_mutex &);
+   test_mutex &operator=(const test_mutex &);
+
+   public:
+   test_mutex() : m_locked(false) {}
+
+   void lock()
+   {
+      if(m_locked)
+         std::abort();
+      m_locked = true;
+   }
+
+   void unlock()
+   {
+      if(!m_locked)
+         std::abort();
+      m_locked = false;
+   }
+
+   private:
+   bool m_locked;
+};
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+template class concurrent_hash_map
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , test::simple_allocator< std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   >;
+
+template class concurrent_hash_map
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , std::allocator< std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   >;
+
+template class concurrent_hash_map
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , std::allocator< std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   , test_mutex
+   >;
+
+}} //boost::container
+
+//Adds the visited mapped value to a sum
+struct summer
+{
+   explicit summer(int &sum) : m_sum(sum) {}
+
+   template<class Pair>
+   void operator()(const Pair &p) const
+   {  m_sum += p.second.get_int();  }
+
+   int &m_sum;
+};
+
+//Increments the visited mapped value
+struct incrementer
+{
+   template<class Pair>
+   void operator()(Pair &p) const
+   {  p.second = typename Pair::second_type(p.second.get_int() + 1);  }
+};
+
+//Returns true if the mapped value is odd
+struct odd_mapped
+{
+   template<class Pair>
+   bool operator()(const Pair &p) const
+   {  return (p.second.get_int() % 2) != 0;  }
+};
+
+template<class MyMap>
+bool check_equal(const MyMap &cmap, const std::map<int, int> &smap)
+{
+   if(cmap.size() != smap.size() || cmap.empty() != smap.empty())
+      return false;
+   int sum = 0, ssum = 0;
+   if(cmap.visit_all(summer(sum)) != smap.size())
+      return false;
+   for(std::map<int, int>::const_iterator it = smap.begin(); it != smap.end(); ++it){
+      typedef typename MyMap::key_type key_type;
+      int value = 0;
+      if(cmap.cvisit(key_type(it->first), summer(value)) != 1u || value != it->second)
+         return false;
+      ssum += it->second;
+   }
+   return sum == ssum;
+}
+
+template<class MyMap>
+int concurrent_hash_map_test()
+{
+   typedef typename MyMap::key_type             IntType;
+   typedef typename MyMap::mapped_type          MappedType;
+   typedef typename MyMap::movable_value_type   movable_value_type;
+   const int MaxElem = 500;
+
+   MyMap cmap(8u);
+   std::map<int, int> smap;
+   if(cmap.shard_count() != 8u || !cmap.empty())
+      return 1;
+
+   //Insertion
+   for(int i = 0; i < MaxElem; ++i){
+      IntType k(i);
+      MappedType v(i*2);
+      if(!cmap.insert(movable_value_type(boost::move(k), boost::move(v))))
+         return 1;
+      smap[i] = i*2;
+   }
+   if(!check_equal(cmap, smap))
+      return 1;
+   if(cmap.emplace(0, 0) || !cmap.emplace(MaxElem, MaxElem))
+      return 1;
+   smap[MaxElem] = MaxElem;
+   if(!check_equal(cmap, smap) || cmap.count(IntType(MaxElem)) != 1u || cmap.count(IntType(-1)) != 0u)
+      return 1;
+
+   //insert_or_visit increments existing elements and inserts the rest
+   for(int i = MaxElem/2; i < MaxElem*2; ++i){
+      IntType k(i);
+      MappedType v(0);
+      const bool inserted = cmap.insert_or_visit(movable_value_type(boost::move(k), boost::move(v)), incrementer());
+      if(inserted != !smap.count(i))
+         return 1;
+      if(inserted)
+         smap[i] = 0;
+      else
+         ++smap[i];
+   }
+   if(!check_equal(cmap, smap))
+      return 1;
+
+   //Visitation of a missing key
+   int dummy = 0;
+   if(cmap.visit(IntType(-1), incrementer()) != 0u || cmap.cvisit(IntType(-1), summer(dummy)) != 0u)
+      return 1;
+   if(cmap.visit(IntType(1), incrementer()) != 1u)
+      return 1;
+   ++smap[1];
+
+   //erase and erase_if
+   if(cmap.erase(IntType(-1)) != 0u || cmap.erase(IntType(0)) != 1u)
+      return 1;
+   smap.erase(0);
+   for(int i = 1; i < 20; ++i){
+      const bool odd = (smap[i] % 2) != 0;
+      if(cmap.erase_if(IntType(i), odd_mapped()) != std::size_t(odd))
+         return 1;
+      if(odd)
+         smap.erase(i);
+   }
+   if(!check_equal(cmap, smap))
+      return 1;
+   std::size_t odd_count = 0;
+   for(std::map<int, int>::iterator it = smap.begin(); it != smap.end(); ){
+      if(it->second % 2){
+         smap.erase(it++);
+         ++odd_count;
+      }
+      else{
+         ++it;
+      }
+   }
+   if(cmap.erase_if(odd_mapped()) != odd_count || !check_equal(cmap, smap))
+      return 1;
+
+   //reserve and clear
+   cmap.reserve(MaxElem*4);
+   if(!check_equal(cmap, smap))
+      return 1;
+   cmap.clear();
+   if(!cmap.empty() || cmap.size() != 0u)
+      return 1;
+   return 0;
+}
+
+template<class VoidAllocator>
+int test_map_variants()
+{
+   typedef typename allocator_traits<VoidAllocator>::template portable_rebind_alloc
+      < std::pair<test::movable_int, test::movable_int> >::type MoveAlloc;
+   typedef typename allocator_traits<VoidAllocator>::template portable_rebind_alloc
+      < std::pair<test::copyable_int, test::copyable_int> >::type CopyAlloc;
+
+   typedef concurrent_hash_map< test::movable_int, test::movable_int
+                              , boost::hash<test::movable_int>, std::equal_to<test::movable_int>, MoveAlloc> MyMoveMap;
+   typedef concurrent_hash_map< test::copyable_int, test::copyable_int
+                              , boost::hash<test::copyable_int>, std::equal_to<test::copyable_int>, CopyAlloc> MyCopyMap;
+
+   if (0 != concurrent_hash_map_test<MyMoveMap>()){
+      std::cout << "Error in concurrent_hash_map_test<MyMoveMap>" << std::endl;
+      return 1;
+   }
+
+   if (0 != concurrent_hash_map_test<MyCopyMap>()){
+      std::cout << "Error in concurrent_hash_map_test<MyCopyMap>" << std::endl;
+      return 1;
+   }
+
+   typedef concurrent_hash_map< test::movable_int, test::movable_int
+                              , boost::hash<test::movable_int>, std::equal_to<test::movable_int>
+                              , MoveAlloc, test_mutex> MyLockMap;
+   if (0 != concurrent_hash_map_test<MyLockMap>()){
+      std::cout << "Error in concurrent_hash_map_test<MyLockMap>" << std::endl;
+      return 1;
+   }
+   return 0;
+}
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD)
+
+//Several threads increment shared counters through insert_or_visit while
+//erasing their own private keys: the final counts must match exactly
+template<class Mutex>
+int concurrent_update_test()
+{
+   typedef concurrent_hash_map<int, int, boost::hash<int>, std::equal_to<int>
+                              , new_allocator<std::pair<int, int> >, Mutex> map_t;
+   const int NumThreads = 8;
+   const int NumKeys = 64;
+   const int NumIter = 20000;
+   map_t m(16u);
+
+   struct worker
+   {
+      static void run(map_t &m, int id)
+      {
+         for(int i = 0; i != NumIter; ++i){
+            m.insert_or_visit(std::pair<int, int>(i % NumKeys, 1), [](std::pair<int, int> &p){ ++p.second; });
+            const int private_key = NumKeys + id*NumIter + i;
+            m.insert(std::pair<int, int>(private_key, i));
+            if(m.erase_if(private_key, [](const std::pair<int, int> &){ return true; }) != 1u)
+               std::abort();
+         }
+      }
+   };
+
+   std::vector<std::thread> threads;
+   for(int t = 0; t != NumThreads; ++t){
+      threads.push_back(std::thread(&worker::run, std::ref(m), t));
+   }
+   for(int t = 0; t != NumThreads; ++t){
+      threads[t].join();
+   }
+
+   if(m.size() != std::size_t(NumKeys))
+      return 1;
+   int total = 0;
+   m.cvisit_all([&total](const std::pair<int, int> &p){ total += p.second; });
+   return total == NumThreads*NumIter ? 0 : 1;
+}
+
+#endif   //#if !defined(BOOST_NO_CXX11_HDR_THREAD)
+
+int main()
+{
+   //Allocator argument container
+   {
+      concurrent_hash_map<int, int> map_((concurrent_hash_map<int, int>::allocator_type()));
+      if(map_.shard_count() != concurrent_hash_map<int, int>::default_shard_count)
+         return 1;
+      concurrent_hash_map<int, int> single(0u);
+      concurrent_hash_map<int, int> rounded(5u);
+      if(single.shard_count() != 1u || rounded.shard_count() != 8u)
+         return 1;
+      for(int i = 0; i != 100; ++i){
+         single.insert(std::pair<int, int>(i, i));
+         rounded.insert(std::pair<int, int>(i, i));
+      }
+      if(single.size() != 100u || rounded.size() != 100u)
+         return 1;
+   }
+
+   ////////////////////////////////////
+   //    Testing allocator implementations
+   ////////////////////////////////////
+   //       std::allocator
+   if(test_map_variants< std::allocator<void> >()){
+      std::cerr << "test_map_variants< std::allocator<void> > failed" << std::endl;
+      return 1;
+   }
+   //       boost::container::allocator
+   if(test_map_variants< allocator<void> >()){
+      std::cerr << "test_map_variants< allocator<void> > failed" << std::endl;
+      return 1;
+   }
+   //       boost::container::node_allocator
+   if(test_map_variants< node_allocator<void> >()){
+      std::cerr << "test_map_variants< node_allocator<void> > failed" << std::endl;
+      return 1;
+   }
+   //       boost::container::adaptive_pool
+   if(test_map_variants< adaptive_pool<void> >()){
+      std::cerr << "test_map_variants< adaptive_pool<void> > failed" << std::endl;
+      return 1;
+   }
+
+   #if !defined(BOOST_NO_CXX11_HDR_THREAD)
+   if(concurrent_update_test<void>()){
+      std::cerr << "concurrent_update_test<void> failed" << std::endl;
+      return 1;
+   }
+   if(concurrent_update_test<std::mutex>()){
+      std::cerr << "concurrent_update_test<std::mutex> failed" << std::endl;
+      return 1;
+   }
+   #endif
+
+   return 0;
+}
+
+#include <boost/container/detail/config_end.hpp>
@@ -13,6 +13,12 @@
 
 #include <boost/container/detail/config_begin.hpp>
 
+#include <boost/container/vector.hpp>
+#include <boost/intrusive/detail/minimal_pair_header.hpp>      //pair
+
+#include <algorithm>
+#include <iterator>
+
 namespace boost{
 namespace container {
 namespace test{
@@ -77,6 +83,280 @@ bool test_nth_index_of(Container &c)
    return true;
 }
 
+//Key type that can only be explicitly constructed from int, so lookups
+//with an int only compile through heterogeneous lookup functions
+class transparent_key
+{
+   public:
+   explicit transparent_key(int v)
+      : m_value(v)
+   {}
+
+   int value() const
+   {  return m_value;   }
+
+   private:
+   int m_value;
+};
+
+struct transparent_less
+{
+   typedef void is_transparent;
+
+   static int value_of(int v)
+   {  return v;   }
+
+   static int value_of(const transparent_key &k)
+   {  return k.value();   }
+
+   template<class T, class U>
+   bool operator()(const T &t, const U &u) const
+   {  return value_of(t) < value_of(u);   }
+};
+
+inline int key_of_value(const transparent_key &k)
+{  return k.value();   }
+
+template<class Pair>
+int key_of_value(const Pair &p)
+{  return p.first.value();   }
+
+//find, count, lower_bound, upper_bound, equal_range with int keys.
+//c must hold transparent_keys 0, 2, ... 2*(n-1) (possibly repeated)
+template<class Container>
+bool test_heterogeneous_lookup(Container &c)
+{
+   typedef typename Container::iterator         iterator;
+   typedef typename Container::const_iterator   const_iterator;
+   const int n = c.empty() ? 0 : key_of_value(*(--c.end()))/2 + 1;
+
+   for(int i = 0; i != 2*n; ++i){
+      const bool present = (i % 2) == 0;
+      //find
+      iterator it = c.find(i);
+      const_iterator cit = as_const(c).find(i);
+      if(present != (it != c.end()) || present != (cit != c.cend()))
+         return false;
+      if(present && (key_of_value(*it) != i || key_of_value(*cit) != i))
+         return false;
+      //lower_bound/upper_bound
+      const int lb_key = present ? i : i + 1;
+      it  = c.lower_bound(i);
+      cit = as_const(c).lower_bound(i);
+      if(lb_key < 2*n && (key_of_value(*it) != lb_key || key_of_value(*cit) != lb_key))
+         return false;
+      const int ub_key = present ? i + 2 : i + 1;
+      it  = c.upper_bound(i);
+      cit = as_const(c).upper_bound(i);
+      if(ub_key < 2*n && (key_of_value(*it) != ub_key || key_of_value(*cit) != ub_key))
+         return false;
+      if(ub_key >= 2*n && (it != c.end() || cit != c.cend()))
+         return false;
+      //equal_range/count
+      std::pair<iterator, iterator> r = c.equal_range(i);
+      std::pair<const_iterator, const_iterator> cr = as_const(c).equal_range(i);
+      if(r.first != c.lower_bound(i) || r.second != c.upper_bound(i))
+         return false;
+      if(cr.first != as_const(c).lower_bound(i) || cr.second != as_const(c).upper_bound(i))
+         return false;
+      typename Container::size_type cnt = 0;
+      for(; r.first != r.second; ++r.first){
+         ++cnt;
+      }
+      if(cnt != c.count(i) || present != (cnt != 0))
+         return false;
+   }
+   return true;
+}
+
+//find_batch, keys in [-1, max] looked up in descending order
+template<class Container>
+bool test_find_batch(Container &c, int max)
+{
+   typedef typename Container::key_type   key_type;
+   boost::container::vector<key_type> keys;
+   for(int i = max; i >= -1; --i){
+      keys.emplace_back(i);
+   }
+
+   boost::container::vector<typename Container::iterator> its(keys.size());
+   if(c.find_batch(keys.begin(), keys.end(), its.begin()) != its.end())
+      return false;
+   for(std::size_t i = 0; i != keys.size(); ++i){
+      if(its[i] != c.find(keys[i]))
+         return false;
+   }
+
+   boost::container::vector<typename Container::const_iterator> cits(keys.size());
+   if(as_const(c).find_batch(keys.begin(), keys.end(), cits.begin()) != cits.end())
+      return false;
+   for(std::size_t i = 0; i != keys.size(); ++i){
+      if(cits[i] != as_const(c).find(keys[i]))
+         return false;
+   }
+
+   //No keys
+   if(c.find_batch(keys.begin(), keys.begin(), its.begin()) != its.begin())
+      return false;
+   return true;
+}
+
+//merge_union, intersect_with and subtract on unique containers of int keys.
+//Sizes are unbalanced in both directions and keys partially overlap.
+template<class Container>
+bool test_set_algebra()
+{
+   typedef boost::container::vector<int> vector_t;
+   const int sizes[] = { 0, 1, 7, 100 };
+   const int sizes_count = int(sizeof(sizes)/sizeof(sizes[0]));
+   for(int i = 0; i != sizes_count; ++i)
+   for(int j = 0; j != sizes_count; ++j){
+      //a holds multiples of 2, b multiples of 3
+      Container a, b;
+      vector_t va, vb;
+      for(int k = 0; k != sizes[i]; ++k){
+         a.insert(2*k);
+         va.push_back(2*k);
+      }
+      for(int k = 0; k != sizes[j]; ++k){
+         b.insert(3*k);
+         vb.push_back(3*k);
+      }
+
+      vector_t expected;
+      Container c(a);
+      c.merge_union(b);
+      std::set_union(va.begin(), va.end(), vb.begin(), vb.end(), std::back_inserter(expected));
+      if(c.size() != expected.size() || !std::equal(c.begin(), c.end(), expected.begin()))
+         return false;
+
+      expected.clear();
+      c = a;
+      c.intersect_with(b);
+      std::set_intersection(va.begin(), va.end(), vb.begin(), vb.end(), std::back_inserter(expected));
+      if(c.size() != expected.size() || !std::equal(c.begin(), c.end(), expected.begin()))
+         return false;
+
+      expected.clear();
+      c = a;
+      c.subtract(b);
+      std::set_difference(va.begin(), va.end(), vb.begin(), vb.end(), std::back_inserter(expected));
+      if(c.size() != expected.size() || !std::equal(c.begin(), c.end(), expected.begin()))
+         return false;
+   }
+
+   //Self operations
+   Container c;
+   for(int k = 0; k != 10; ++k){
+      c.insert(k);
+   }
+   c.merge_union(c);
+   c.intersect_with(c);
+   if(c.size() != 10u)
+      return false;
+   c.subtract(c);
+   return c.empty();
+}
+
+//Containers configured with the private_node_pool option own their pool:
+//copies get a new one, moves and swaps take it along with the nodes
+//and node handles keep it alive. clear() releases its blocks.
+template<class List>
+bool test_private_node_pool_list()
+{
+   typedef typename List::stored_allocator_type stored_allocator_type;
+   typedef typename List::value_type value_type;
+   typedef boost::container::vector<value_type> vector_t;
+   List a;
+   vector_t v;
+   for(int round = 0; round != 3; ++round){
+      for(int i = 0; i != 100; ++i){
+         a.push_front(value_type(i));
+         v.insert(v.begin(), value_type(i));
+      }
+      if(a.size() != v.size() || !std::equal(a.begin(), a.end(), v.begin()))
+         return false;
+
+      List b(a);
+      if(b != a || b.get_stored_allocator() == a.get_stored_allocator())
+         return false;
+      //Copies of the allocator share the pool, so clear() must deallocate node by node
+      const stored_allocator_type alloc_copy(a.get_stored_allocator());
+      if(!(alloc_copy == a.get_stored_allocator()))
+         return false;
+
+      List c(boost::move(b));
+      if(c != a || !b.empty())
+         return false;
+      b.push_front(value_type(-1));
+      c.swap(b);
+      if(b != a || c.size() != 1u || c.front() != value_type(-1))
+         return false;
+      b = boost::move(c);
+      if(b.size() != 1u || b.front() != value_type(-1))
+         return false;
+      b = a;
+      if(b != a)
+         return false;
+
+      a.pop_front();
+      v.erase(v.begin());
+      if(round == 1){
+         a.clear();
+         v.clear();
+      }
+   }
+   a.clear();
+   a.push_front(value_type(1));
+   return a.size() == 1u && a.front() == value_type(1);
+}
+
+template<class Set>
+bool test_private_node_pool_set()
+{
+   typedef typename Set::node_type node_type;
+   typedef typename Set::value_type value_type;
+   Set a;
+   for(int i = 0; i != 200; ++i){
+      a.insert(value_type(i));
+   }
+
+   node_type nh;
+   {
+      Set b(a);
+      if(b != a || b.get_stored_allocator() == a.get_stored_allocator())
+         return false;
+      //The node is reinserted in the container it was extracted from
+      nh = b.extract(b.begin());
+      b.insert(boost::move(nh));
+      if(b != a)
+         return false;
+      //The handle outlives the container
+      nh = b.extract(b.begin());
+   }
+   if(nh.empty() || nh.value() != value_type(0))
+      return false;
+   nh = node_type();
+
+   Set c(boost::move(a));
+   if(!a.empty() || c.size() != 200u)
+      return false;
+   a.insert(value_type(-1));
+   c.swap(a);
+   if(a.size() != 200u || c.size() != 1u || *c.begin() != value_type(-1))
+      return false;
+   c = boost::move(a);
+   if(c.size() != 200u || !a.empty())
+      return false;
+   c.erase(c.begin(), c.find(value_type(100)));
+   c.clear();
+   for(int i = 0; i != 10; ++i){
+      c.insert(value_type(i));
+   }
+   a = c;
+   return a == c && a.size() == 10u;
+}
+
 }  //namespace test{
 }  //namespace container {
 }  //namespace boost{
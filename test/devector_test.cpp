@@ -0,0 +1,468 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <memory>
+#include <deque>
+#include <iostream>
+
+#include <boost/container/devector.hpp>
+#include <boost/container/allocator.hpp>
+#include <boost/container/node_allocator.hpp>
+#include <boost/container/adaptive_pool.hpp>
+
+#include <boost/move/utility_core.hpp>
+#include <boost/static_assert.hpp>
+#include "check_equal_containers.hpp"
+#include "movable_int.hpp"
+#include "dummy_test_allocator.hpp"
+#include "propagate_allocator_test.hpp"
+#include "vector_test.hpp"
+#include "default_init_test.hpp"
+#include "../../intrusive/test/iterator_test.hpp"
+
+using namespace boost::container;
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+template class boost::container::devector
+   < test::movable_and_copyable_int
+   , test::simple_allocator<test::movable_and_copyable_int> >;
+
+template class boost::container::devector
+   < test::movable_and_copyable_int
+   , test::dummy_test_allocator<test::movable_and_copyable_int> >;
+
+template class boost::container::devector
+   < test::movable_and_copyable_int
+   , std::allocator<test::movable_and_copyable_int> >;
+
+template class boost::container::devector
+   < test::movable_and_copyable_int
+   , allocator<test::movable_and_copyable_int> >;
+
+template class boost::container::devector
+   < test::movable_and_copyable_int
+   , adaptive_pool<test::movable_and_copyable_int> >;
+
+template class boost::container::devector
+   < test::movable_and_copyable_int
+   , node_allocator<test::movable_and_copyable_int> >;
+
+template class boost::container::devector
+   < test::movable_and_copyable_int
+   , std::allocator<test::movable_and_copyable_int>
+   , vector_options< growth_factor<growth_factor_50> >::type >;
+
+}}
+
+class recursive_devector
+{
+   public:
+   int id_;
+   devector<recursive_devector> devector_;
+   devector<recursive_devector>::iterator it_;
+   devector<recursive_devector>::const_iterator cit_;
+   devector<recursive_devector>::reverse_iterator rit_;
+   devector<recursive_devector>::const_reverse_iterator crit_;
+};
+
+void recursive_devector_test()//Test for recursive types
+{
+   devector<recursive_devector> recursive_devector_devector;
+}
+
+template<class VoidAllocator>
+struct GetAllocatorCont
+{
+   template<class ValueType>
+   struct apply
+   {
+      typedef devector< ValueType
+                      , typename allocator_traits<VoidAllocator>
+                           ::template portable_rebind_alloc<ValueType>::type
+                      > type;
+   };
+};
+
+//Mixes insertions and erasures at both ends and in the middle
+//and compares the result with std::deque
+template<class MyCont>
+bool test_both_ends()
+{
+   typedef typename MyCont::value_type IntType;
+   MyCont c;
+   std::deque<int> d;
+   for(int i = 0; i != 500; ++i){
+      switch(i % 7){
+         case 0: case 1: case 2:
+            c.push_front(IntType(i));
+            d.push_front(i);
+         break;
+         case 3: case 4:
+            c.push_back(IntType(i));
+            d.push_back(i);
+         break;
+         case 5:
+         {
+            IntType v(i);
+            c.insert(c.nth(c.size()/3u), boost::move(v));
+            d.insert(d.begin() + d.size()/3u, i);
+         }
+         break;
+         default:
+            c.erase(c.nth(c.size()*2u/3u));
+            d.erase(d.begin() + d.size()*2u/3u);
+         break;
+      }
+      if(!test::CheckEqualContainers(c, d))
+         return false;
+   }
+   //Consume from both ends
+   while(c.size() > 2u){
+      c.pop_front();
+      d.pop_front();
+      c.pop_back();
+      d.pop_back();
+      if(!(c.front() == d.front()) || !(c.back() == d.back()))
+         return false;
+   }
+   //Used as a queue, the buffer is reused instead of growing
+   c.clear();
+   d.clear();
+   for(int i = 0; i != 100; ++i){
+      c.push_back(IntType(i));
+   }
+   for(int i = 100; i != 1000; ++i){
+      c.pop_front();
+      c.push_back(IntType(i));
+   }
+   const typename MyCont::size_type cap = c.capacity();
+   for(int i = 1000; i != 10000; ++i){
+      c.pop_front();
+      c.push_back(IntType(i));
+   }
+   if(c.capacity() != cap || c.size() != 100u || !(c.front() == 9900))
+      return false;
+   return true;
+}
+
+//Checks that push_front leaves the new free capacity at the front
+//and reallocates a logarithmic number of times
+template<class MyCont>
+bool test_push_front_growth()
+{
+   typedef typename MyCont::value_type IntType;
+   MyCont c;
+   std::size_t reallocations = 0u;
+   for(int i = 0; i != 10000; ++i){
+      const typename MyCont::size_type old_cap = c.capacity();
+      c.push_front(IntType(i));
+      if(old_cap != c.capacity()){
+         ++reallocations;
+         if(c.back_free_capacity() > c.front_free_capacity())
+            return false;
+      }
+   }
+   if(reallocations > 20u)
+      return false;
+   for(int i = 0; i != 10000; ++i){
+      if(!(c[i] == 9999 - i))
+         return false;
+   }
+   //reserve_front and reserve_back don't change the other side
+   c.shrink_to_fit();
+   if(c.capacity() != c.size() || c.front_free_capacity() != 0u)
+      return false;
+   c.reserve_front(100u);
+   c.reserve_back(50u);
+   return c.front_free_capacity() == 100u && c.back_free_capacity() == 50u &&
+          c.capacity() == c.size() + 150u;
+}
+
+//Version 2 allocator that never expands buffers in place. Like some pooled
+//allocators, it leaves the reuse argument untouched when it returns a new buffer.
+template<class T>
+class no_expand_allocator
+{
+   public:
+   typedef T                  value_type;
+   typedef T *                pointer;
+   typedef const T *          const_pointer;
+   typedef T &                reference;
+   typedef const T &          const_reference;
+   typedef std::size_t        size_type;
+   typedef std::ptrdiff_t     difference_type;
+
+   typedef boost::container::container_detail::version_type<no_expand_allocator, 2>   version;
+
+   //Dummy multiallocation chain
+   struct multiallocation_chain{};
+
+   template<class T2>
+   struct rebind
+   {  typedef no_expand_allocator<T2>   other;   };
+
+   no_expand_allocator()
+   {}
+
+   template<class T2>
+   no_expand_allocator(const no_expand_allocator<T2> &)
+   {}
+
+   pointer allocate(size_type n)
+   {  return static_cast<pointer>(::operator new(n*sizeof(T)));  }
+
+   void deallocate(pointer p, size_type)
+   {  ::operator delete(p);  }
+
+   size_type max_size() const
+   {  return size_type(-1)/sizeof(T);  }
+
+   pointer allocation_command(allocation_type command, size_type limit_size,
+                              size_type &prefer_in_recvd_out_size, pointer &reuse)
+   {
+      (void)reuse;
+      if(!(command & allocate_new)){
+         if(command & nothrow_allocation)
+            return pointer();
+         throw_bad_alloc();
+      }
+      if(prefer_in_recvd_out_size < limit_size)
+         prefer_in_recvd_out_size = limit_size;
+      return this->allocate(prefer_in_recvd_out_size);
+   }
+
+   size_type size(pointer) const
+   {  return 0u;  }
+
+   friend bool operator==(const no_expand_allocator &, const no_expand_allocator &)
+   {  return true;  }
+
+   friend bool operator!=(const no_expand_allocator &, const no_expand_allocator &)
+   {  return false;  }
+};
+
+template<class VoidAllocator>
+int test_cont_variants()
+{
+   typedef typename GetAllocatorCont<VoidAllocator>::template apply<int>::type MyCont;
+   typedef typename GetAllocatorCont<VoidAllocator>::template apply<test::movable_int>::type MyMoveCont;
+   typedef typename GetAllocatorCont<VoidAllocator>::template apply<test::movable_and_copyable_int>::type MyCopyMoveCont;
+   typedef typename GetAllocatorCont<VoidAllocator>::template apply<test::copyable_int>::type MyCopyCont;
+
+   if(test::vector_test<MyCont>())
+      return 1;
+   if(test::vector_test<MyMoveCont>())
+      return 1;
+   if(test::vector_test<MyCopyMoveCont>())
+      return 1;
+   if(test::vector_test<MyCopyCont>())
+      return 1;
+
+   if(!test_both_ends<MyCont>() || !test_both_ends<MyMoveCont>() || !test_both_ends<MyCopyCont>())
+      return 1;
+
+   return 0;
+}
+
+//Owns a heap allocated int and counts copies, it can be relocated with memcpy
+class heap_int
+{
+   public:
+   static std::size_t copies;
+
+   explicit heap_int(int i = 0)
+      : m_ptr(new int(i))
+   {}
+
+   heap_int(const heap_int &x)
+      : m_ptr(new int(*x.m_ptr))
+   {  ++copies;  }
+
+   heap_int &operator=(const heap_int &x)
+   {  *m_ptr = *x.m_ptr;   return *this;  }
+
+   ~heap_int()
+   {  delete m_ptr;  }
+
+   int get() const
+   {  return *m_ptr;  }
+
+   private:
+   int *m_ptr;
+};
+
+std::size_t heap_int::copies = 0u;
+
+namespace boost {
+namespace container {
+
+template<>
+struct is_trivially_relocatable<heap_int>
+{
+   static const bool value = true;
+};
+
+}}
+
+BOOST_STATIC_ASSERT(( is_trivially_relocatable< devector<int> >::value ));
+BOOST_STATIC_ASSERT(( is_trivially_relocatable< devector<heap_int> >::value ));
+
+bool test_trivially_relocatable()
+{
+   typedef devector<heap_int> devector_t;
+   devector_t v;
+   for(int i = 0; i != 100; ++i){
+      v.emplace_front(99 - i);
+   }
+   v.shrink_to_fit();
+   //Reallocations, recentering and insertions in the middle don't copy old elements
+   v.emplace(v.begin() + 50, -1);
+   v.emplace(v.begin(), -2);
+   v.emplace_back(-3);
+   if(heap_int::copies != 0u || v.size() != 103u)
+      return false;
+   //The inserted value is taken from an element that is relocated
+   v.insert(v.begin() + 2, v[10]);
+   if(heap_int::copies != 1u || v[2].get() != 9 || v[11].get() != 9)
+      return false;
+   v.erase(v.begin() + 2);
+   v.erase(v.begin());
+   v.erase(v.begin() + 50);
+   v.pop_back();
+   v.erase(v.begin() + 90, v.end());
+   v.erase(v.begin(), v.begin() + 10);
+   if(heap_int::copies != 1u || v.size() != 80u)
+      return false;
+   for(int i = 0; i != 80; ++i){
+      if(v[i].get() != i + 10)
+         return false;
+   }
+   return true;
+}
+
+struct boost_container_devector;
+
+namespace boost { namespace container {   namespace test {
+
+template<>
+struct alloc_propagate_base<boost_container_devector>
+{
+   template <class T, class Allocator>
+   struct apply
+   {
+      typedef boost::container::devector<T, Allocator> type;
+   };
+};
+
+}}}   //namespace boost::container::test
+
+int main()
+{
+   recursive_devector_test();
+   {
+      //Now test move semantics
+      devector<recursive_devector> original;
+      devector<recursive_devector> move_ctor(boost::move(original));
+      devector<recursive_devector> move_assign;
+      move_assign = boost::move(move_ctor);
+      move_assign.swap(original);
+   }
+
+   ////////////////////////////////////
+   //    Testing allocator implementations
+   ////////////////////////////////////
+   //       std:allocator
+   if(test_cont_variants< std::allocator<void> >()){
+      std::cerr << "test_cont_variants< std::allocator<void> > failed" << std::endl;
+      return 1;
+   }
+   //       boost::container::allocator (expands in place forward and backwards)
+   if(test_cont_variants< allocator<void> >()){
+      std::cerr << "test_cont_variants< allocator<void> > failed" << std::endl;
+      return 1;
+   }
+   //       boost::container::node_allocator
+   if(test_cont_variants< node_allocator<void> >()){
+      std::cerr << "test_cont_variants< node_allocator<void> > failed" << std::endl;
+      return 1;
+   }
+   //       boost::container::adaptive_pool
+   if(test_cont_variants< adaptive_pool<void> >()){
+      std::cerr << "test_cont_variants< adaptive_pool<void> > failed" << std::endl;
+      return 1;
+   }
+
+   ////////////////////////////////////
+   //    Growth at the front test
+   ////////////////////////////////////
+   if(!test_push_front_growth< devector<int> >() ||
+      !test_push_front_growth< devector<test::movable_and_copyable_int> >() ||
+      //Backward expansion fails: new buffers must not be taken as expanded ones
+      !test_push_front_growth< devector<int, no_expand_allocator<int> > >()){
+      std::cerr << "Growth at the front test failed" << std::endl;
+      return 1;
+   }
+
+   ////////////////////////////////////
+   //    Trivially relocatable test
+   ////////////////////////////////////
+   if(!test_trivially_relocatable()){
+      std::cerr << "Trivially relocatable test failed" << std::endl;
+      return 1;
+   }
+
+   ////////////////////////////////////
+   //    Default init test
+   ////////////////////////////////////
+   if(!test::default_init_test< devector<int, test::default_init_allocator<int> > >()){
+      std::cerr << "Default init test failed" << std::endl;
+      return 1;
+   }
+
+   ////////////////////////////////////
+   //    Emplace testing
+   ////////////////////////////////////
+   const test::EmplaceOptions Options = (test::EmplaceOptions)
+      (test::EMPLACE_BACK | test::EMPLACE_FRONT | test::EMPLACE_BEFORE);
+   if(!boost::container::test::test_emplace< devector<test::EmplaceInt>, Options>()){
+      return 1;
+   }
+
+   ////////////////////////////////////
+   //    Allocator propagation testing
+   ////////////////////////////////////
+   if(!boost::container::test::test_propagate_allocator<boost_container_devector>()){
+      return 1;
+   }
+
+   ////////////////////////////////////
+   //    Initializer lists testing
+   ////////////////////////////////////
+   if(!boost::container::test::test_vector_methods_with_initializer_list_as_argument_for<
+       boost::container::devector<int>
+   >()) {
+      return 1;
+   }
+
+   ////////////////////////////////////
+   //    Iterator testing
+   ////////////////////////////////////
+   {
+      typedef boost::container::devector<int> cont_int;
+      cont_int a; a.push_back(1); a.push_front(0); a.push_back(2);
+      boost::intrusive::test::test_iterator_random< cont_int >(a);
+      if(boost::report_errors() != 0) {
+         return 1;
+      }
+   }
+   return 0;
+}
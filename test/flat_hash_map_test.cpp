@@ -0,0 +1,610 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2004-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/flat_hash_map.hpp>
+#include <boost/container/flat_hash_set.hpp>
+#include <boost/container/allocator.hpp>
+#include <boost/container/node_allocator.hpp>
+#include <boost/container/adaptive_pool.hpp>
+#include <boost/container/vector.hpp>
+
+#include "dummy_test_allocator.hpp"
+#include "movable_int.hpp"
+#include "propagate_allocator_test.hpp"
+#include "../../intrusive/test/iterator_test.hpp"
+
+#include <map>
+#include <set>
+
+using namespace boost::container;
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+
+//flat_hash_map
+template class flat_hash_map
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , test::simple_allocator< std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   >;
+
+template class flat_hash_map
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , std::allocator< std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   >;
+
+template class flat_hash_map
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , allocator< std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   >;
+
+//flat_hash_set
+template class flat_hash_set
+   < test::movable_and_copyable_int
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , test::simple_allocator<test::movable_and_copyable_int>
+   >;
+
+template class flat_hash_set
+   < test::movable_and_copyable_int
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , std::allocator<test::movable_and_copyable_int>
+   >;
+
+namespace container_detail {
+
+//Instantiate base class as previous instantiations don't instantiate inherited members
+template class flat_hash_table
+   < test::movable_and_copyable_int
+   , std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int>
+   , select1st< std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , std::allocator< std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   >;
+
+template class flat_hash_table
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , identity<test::movable_and_copyable_int>
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , allocator<test::movable_and_copyable_int>
+   >;
+
+}  //container_detail {
+
+}} //boost::container
+
+class recursive_flat_hash_map
+{
+   public:
+   recursive_flat_hash_map(const recursive_flat_hash_map &c)
+      : id_(c.id_), map_(c.map_)
+   {}
+
+   recursive_flat_hash_map & operator =(const recursive_flat_hash_map &c)
+   {
+      id_ = c.id_;
+      map_= c.map_;
+      return *this;
+   }
+
+   int id_;
+   flat_hash_map<recursive_flat_hash_map, recursive_flat_hash_map> map_;
+   flat_hash_map<recursive_flat_hash_map, recursive_flat_hash_map>::iterator it_;
+   flat_hash_map<recursive_flat_hash_map, recursive_flat_hash_map>::const_iterator cit_;
+
+   friend bool operator== (const recursive_flat_hash_map &a, const recursive_flat_hash_map &b)
+   {  return a.id_ == b.id_;   }
+
+   friend std::size_t hash_value(const recursive_flat_hash_map &a)
+   {  return std::size_t(a.id_);   }
+};
+
+//Hash that sends every key to few groups to stress probing
+struct bad_hash
+{
+   template<class T>
+   std::size_t operator()(const T &t) const
+   {  return boost::hash<T>()(t) % 3u;  }
+};
+
+template<class C>
+void test_move()
+{
+   //Now test move semantics
+   C original;
+   C move_ctor(boost::move(original));
+   C move_assign;
+   move_assign = boost::move(move_ctor);
+   move_assign.swap(original);
+}
+
+namespace boost{
+namespace container {
+namespace test{
+
+template<class MyFlatHashMap>
+bool check_equal_map(const MyFlatHashMap &h, const std::map<int, int> &s)
+{
+   if(h.size() != s.size() || h.empty() != s.empty())
+      return false;
+   std::size_t n = 0;
+   for(typename MyFlatHashMap::const_iterator it = h.begin(), itend = h.end(); it != itend; ++it, ++n){
+      std::map<int, int>::const_iterator sit = s.find(it->first.get_int());
+      if(sit == s.end() || sit->second != it->second.get_int())
+         return false;
+   }
+   if(n != s.size())
+      return false;
+   for(std::map<int, int>::const_iterator sit = s.begin(); sit != s.end(); ++sit){
+      typedef typename MyFlatHashMap::key_type key_type;
+      typename MyFlatHashMap::const_iterator it = h.find(key_type(sit->first));
+      if(it == h.end() || it->second.get_int() != sit->second || h.count(key_type(sit->first)) != 1u)
+         return false;
+   }
+   if(h.size() > h.capacity() || h.load_factor() > h.max_load_factor())
+      return false;
+   return true;
+}
+
+template<class MyFlatHashSet>
+bool check_equal_set(const MyFlatHashSet &h, const std::set<int> &s)
+{
+   if(h.size() != s.size())
+      return false;
+   std::set<int> tmp;
+   for(typename MyFlatHashSet::const_iterator it = h.begin(), itend = h.end(); it != itend; ++it){
+      if(!tmp.insert(it->get_int()).second)
+         return false;
+   }
+   return tmp == s;
+}
+
+template<class MyFlatHashMap>
+int flat_hash_map_test_copyable(container_detail::false_)
+{  return 0;  }
+
+template<class MyFlatHashMap>
+int flat_hash_map_test_copyable(container_detail::true_)
+{
+   typedef typename MyFlatHashMap::key_type     IntType;
+   typedef typename MyFlatHashMap::mapped_type  MappedType;
+   typedef typename MyFlatHashMap::value_type   value_type;
+   const int MaxElem = 100;
+
+   MyFlatHashMap hmap;
+   std::map<int, int> smap;
+   for(int i = 0; i < MaxElem; ++i){
+      hmap.insert(value_type(IntType(i), MappedType(-i)));
+      smap.insert(std::pair<const int, int>(i, -i));
+   }
+   //Copy keeps the layout, equality is order independent
+   MyFlatHashMap hmap2(hmap);
+   if(!check_equal_map(hmap2, smap) || hmap2 != hmap || !(hmap2 == hmap))
+      return 1;
+   hmap2.erase(IntType(0));
+   if(hmap2 == hmap)
+      return 1;
+   hmap2.rehash(1024u);
+   hmap2.insert(value_type(IntType(0), MappedType(0)));
+   if(hmap2 != hmap)
+      return 1;
+   hmap2 = hmap;
+   if(!check_equal_map(hmap2, smap))
+      return 1;
+   //Lookups in a const container
+   const MyFlatHashMap &chmap = hmap;
+   if(chmap.at(IntType(1)).get_int() != -1 || chmap.find(IntType(MaxElem)) != chmap.end())
+      return 1;
+   return 0;
+}
+
+template<class MyFlatHashMap, bool Copyable>
+int flat_hash_map_test()
+{
+   typedef typename MyFlatHashMap::key_type              IntType;
+   typedef typename MyFlatHashMap::mapped_type           MappedType;
+   typedef typename MyFlatHashMap::movable_value_type    movable_value_type;
+   const int MaxElem = 500;
+
+   //Insertion, subscript and lookup
+   {
+      MyFlatHashMap hmap;
+      std::map<int, int> smap;
+      if(hmap.bucket_count() != 0u || hmap.begin() != hmap.end())
+         return 1;
+      for(int i = 0; i < MaxElem; ++i){
+         IntType k(i);
+         MappedType v(i*2);
+         if(!hmap.insert(movable_value_type(boost::move(k), boost::move(v))).second)
+            return 1;
+         smap[i] = i*2;
+      }
+      if(!check_equal_map(hmap, smap))
+         return 1;
+      //Duplicates are not inserted
+      for(int i = 0; i < MaxElem; i += 7){
+         IntType k(i);
+         MappedType v(-1);
+         std::pair<typename MyFlatHashMap::iterator, bool> r = hmap.insert(movable_value_type(boost::move(k), boost::move(v)));
+         if(r.second || r.first->second.get_int() != i*2)
+            return 1;
+      }
+      //operator[] and at
+      for(int i = 0; i < MaxElem*2; ++i){
+         IntType k(i);
+         hmap[boost::move(k)] = MappedType(i*3);
+         smap[i] = i*3;
+      }
+      if(!check_equal_map(hmap, smap))
+         return 1;
+      if(hmap.at(IntType(3)).get_int() != 9)
+         return 1;
+      BOOST_TRY{
+         hmap.at(IntType(-1));
+         return 1;
+      }
+      BOOST_CATCH(std::out_of_range&){
+      }
+      BOOST_CATCH_END
+
+      //Emplacement
+      hmap.emplace(MaxElem*2, MaxElem*2);
+      hmap.emplace_hint(hmap.begin(), MaxElem*2 + 1, MaxElem*2 + 1);
+      smap[MaxElem*2] = MaxElem*2;
+      smap[MaxElem*2 + 1] = MaxElem*2 + 1;
+      if(hmap.emplace(MaxElem*2, 0).second || !check_equal_map(hmap, smap))
+         return 1;
+
+      //Erasure by key and iterator, leaving tombstones
+      for(int i = 0; i < MaxElem*2; i += 2){
+         if(hmap.erase(IntType(i)) != 1u)
+            return 1;
+         smap.erase(i);
+      }
+      if(hmap.erase(IntType(-1)) != 0u || !check_equal_map(hmap, smap))
+         return 1;
+      typename MyFlatHashMap::iterator it = hmap.begin();
+      for(int i = 0; i < 10; ++i){
+         smap.erase(it->first.get_int());
+         it = hmap.erase(it);
+      }
+      if(!check_equal_map(hmap, smap))
+         return 1;
+      //Erase a range and check the returned iterator
+      typename MyFlatHashMap::iterator last = hmap.begin();
+      for(int i = 0; i < 10; ++i){
+         smap.erase(last->first.get_int());
+         ++last;
+      }
+      const int last_key = last->first.get_int();
+      it = hmap.erase(hmap.begin(), last);
+      if(it != hmap.begin() || it->first.get_int() != last_key || !check_equal_map(hmap, smap))
+         return 1;
+
+      //Insert/erase churn reuses tombstones without growing forever
+      const std::size_t buckets = hmap.bucket_count();
+      for(int i = 0; i < MaxElem*20; ++i){
+         IntType k(MaxElem*4 + i);
+         MappedType v(i);
+         hmap.insert(movable_value_type(boost::move(k), boost::move(v)));
+         hmap.erase(IntType(MaxElem*4 + i));
+      }
+      if(hmap.bucket_count() > buckets*2u || !check_equal_map(hmap, smap))
+         return 1;
+
+      //Rehash and reserve
+      hmap.rehash(0u);
+      if(!check_equal_map(hmap, smap))
+         return 1;
+      hmap.reserve(MaxElem*8);
+      if(hmap.capacity() < std::size_t(MaxElem*8) || !check_equal_map(hmap, smap))
+         return 1;
+      const std::size_t cap = hmap.capacity();
+      for(int i = 0; i < MaxElem*8; ++i){
+         hmap[IntType(i)];
+         if(!smap.count(i))
+            smap[i] = 0;
+      }
+      if(hmap.capacity() != cap || !check_equal_map(hmap, smap))
+         return 1;
+
+      //Move and swap
+      MyFlatHashMap hmap2(boost::move(hmap));
+      if(!hmap.empty() || !check_equal_map(hmap2, smap))
+         return 1;
+      hmap.swap(hmap2);
+      if(!hmap2.empty() || !check_equal_map(hmap, smap))
+         return 1;
+      hmap2 = boost::move(hmap);
+      if(!hmap.empty() || !check_equal_map(hmap2, smap))
+         return 1;
+
+      //Clear keeps the memory
+      const std::size_t buckets2 = hmap2.bucket_count();
+      hmap2.clear();
+      if(!hmap2.empty() || hmap2.begin() != hmap2.end() || hmap2.bucket_count() != buckets2)
+         return 1;
+      hmap2.rehash(0u);
+      if(hmap2.bucket_count() != 0u)
+         return 1;
+   }
+
+   //Heavy collisions
+   {
+      typedef flat_hash_map< IntType, MappedType, bad_hash, std::equal_to<IntType>
+                           , typename MyFlatHashMap::allocator_type> bad_hash_map;
+      bad_hash_map hmap;
+      std::map<int, int> smap;
+      for(int i = 0; i < MaxElem; ++i){
+         IntType k(i);
+         MappedType v(i);
+         hmap.insert(movable_value_type(boost::move(k), boost::move(v)));
+         smap[i] = i;
+      }
+      for(int i = 0; i < MaxElem; i += 3){
+         hmap.erase(IntType(i));
+         smap.erase(i);
+      }
+      if(!check_equal_map(hmap, smap))
+         return 1;
+   }
+
+   //Range insertion
+   {
+      boost::container::vector<movable_value_type> v;
+      std::map<int, int> smap;
+      for(int i = 0; i < MaxElem; ++i){
+         IntType k(i % (MaxElem/2));
+         MappedType m(i);
+         v.push_back(movable_value_type(boost::move(k), boost::move(m)));
+         smap.insert(std::pair<const int, int>(i % (MaxElem/2), i));
+      }
+      MyFlatHashMap hmap;
+      hmap.insert(boost::make_move_iterator(v.begin()), boost::make_move_iterator(v.end()));
+      if(!check_equal_map(hmap, smap))
+         return 1;
+   }
+
+   return flat_hash_map_test_copyable<MyFlatHashMap>(container_detail::bool_<Copyable>());
+}
+
+template<class MyFlatHashSet>
+int flat_hash_set_test()
+{
+   typedef typename MyFlatHashSet::value_type IntType;
+   const int MaxElem = 500;
+
+   MyFlatHashSet hset;
+   std::set<int> sset;
+   for(int i = 0; i < MaxElem; ++i){
+      IntType move_me(i/2);
+      if(hset.insert(boost::move(move_me)).second != (i%2 == 0))
+         return 1;
+      sset.insert(i/2);
+   }
+   if(!check_equal_set(hset, sset))
+      return 1;
+   for(int i = 0; i < MaxElem; i += 5){
+      hset.erase(IntType(i));
+      sset.erase(i);
+   }
+   if(!check_equal_set(hset, sset))
+      return 1;
+   for(int i = 0; i < MaxElem; ++i){
+      if(hset.count(IntType(i)) != sset.count(i))
+         return 1;
+      std::pair<typename MyFlatHashSet::iterator, typename MyFlatHashSet::iterator> r = hset.equal_range(IntType(i));
+      if(std::size_t(boost::container::iterator_distance(r.first, r.second)) != sset.count(i))
+         return 1;
+   }
+   hset.emplace(MaxElem);
+   hset.emplace_hint(hset.cend(), MaxElem + 1);
+   sset.insert(MaxElem);
+   sset.insert(MaxElem + 1);
+   if(!check_equal_set(hset, sset))
+      return 1;
+   MyFlatHashSet hset2(boost::move(hset));
+   if(!check_equal_set(hset2, sset) || !hset.empty())
+      return 1;
+   return 0;
+}
+
+}}}   //namespace boost::container::test
+
+template<class VoidAllocator>
+struct GetAllocatorMap
+{
+   template<class ValueType>
+   struct apply
+   {
+      typedef flat_hash_map< ValueType
+                 , ValueType
+                 , boost::hash<ValueType>
+                 , std::equal_to<ValueType>
+                 , typename allocator_traits<VoidAllocator>
+                    ::template portable_rebind_alloc< std::pair<ValueType, ValueType> >::type
+                 > map_type;
+
+      typedef flat_hash_set< ValueType
+                 , boost::hash<ValueType>
+                 , std::equal_to<ValueType>
+                 , typename allocator_traits<VoidAllocator>
+                    ::template portable_rebind_alloc< ValueType >::type
+                 > set_type;
+   };
+};
+
+struct boost_container_flat_hash_map;
+struct boost_container_flat_hash_set;
+
+namespace boost { namespace container {   namespace test {
+
+template<>
+struct alloc_propagate_base<boost_container_flat_hash_map>
+{
+   template <class T, class Allocator>
+   struct apply
+   {
+      typedef typename boost::container::allocator_traits<Allocator>::
+         template portable_rebind_alloc<std::pair<T, T> >::type TypeAllocator;
+      typedef boost::container::flat_hash_map<T, T, boost::hash<T>, std::equal_to<T>, TypeAllocator> type;
+   };
+};
+
+template<>
+struct alloc_propagate_base<boost_container_flat_hash_set>
+{
+   template <class T, class Allocator>
+   struct apply
+   {
+      typedef boost::container::flat_hash_set<T, boost::hash<T>, std::equal_to<T>, Allocator> type;
+   };
+};
+
+}}}   //namespace boost::container::test
+
+template<class VoidAllocator>
+int test_map_variants()
+{
+   typedef typename GetAllocatorMap<VoidAllocator>::template apply<test::movable_int>::map_type MyMoveMap;
+   typedef typename GetAllocatorMap<VoidAllocator>::template apply<test::movable_and_copyable_int>::map_type MyCopyMoveMap;
+   typedef typename GetAllocatorMap<VoidAllocator>::template apply<test::copyable_int>::map_type MyCopyMap;
+
+   typedef typename GetAllocatorMap<VoidAllocator>::template apply<test::movable_int>::set_type MyMoveSet;
+   typedef typename GetAllocatorMap<VoidAllocator>::template apply<test::movable_and_copyable_int>::set_type MyCopyMoveSet;
+   typedef typename GetAllocatorMap<VoidAllocator>::template apply<test::copyable_int>::set_type MyCopySet;
+
+   if (0 != test::flat_hash_map_test<MyMoveMap, false>()){
+      std::cout << "Error in flat_hash_map_test<MyMoveMap>" << std::endl;
+      return 1;
+   }
+
+   if (0 != test::flat_hash_map_test<MyCopyMoveMap, true>()){
+      std::cout << "Error in flat_hash_map_test<MyCopyMoveMap>" << std::endl;
+      return 1;
+   }
+
+   if (0 != test::flat_hash_map_test<MyCopyMap, true>()){
+      std::cout << "Error in flat_hash_map_test<MyCopyMap>" << std::endl;
+      return 1;
+   }
+
+   if (0 != test::flat_hash_set_test<MyMoveSet>()){
+      std::cout << "Error in flat_hash_set_test<MyMoveSet>" << std::endl;
+      return 1;
+   }
+
+   if (0 != test::flat_hash_set_test<MyCopyMoveSet>()){
+      std::cout << "Error in flat_hash_set_test<MyCopyMoveSet>" << std::endl;
+      return 1;
+   }
+
+   if (0 != test::flat_hash_set_test<MyCopySet>()){
+      std::cout << "Error in flat_hash_set_test<MyCopySet>" << std::endl;
+      return 1;
+   }
+
+   return 0;
+}
+
+int main()
+{
+   using namespace boost::container::test;
+
+   //Allocator argument container
+   {
+      flat_hash_map<int, int> map_((flat_hash_map<int, int>::allocator_type()));
+      flat_hash_set<int> set_((flat_hash_set<int>::allocator_type()));
+   }
+   //Now test move semantics
+   {
+      test_move<flat_hash_map<recursive_flat_hash_map, recursive_flat_hash_map> >();
+      test_move<flat_hash_set<int> >();
+   }
+
+   ////////////////////////////////////
+   //    Testing allocator implementations
+   ////////////////////////////////////
+   //       std::allocator
+   if(test_map_variants< std::allocator<void> >()){
+      std::cerr << "test_map_variants< std::allocator<void> > failed" << std::endl;
+      return 1;
+   }
+   //       boost::container::allocator
+   if(test_map_variants< allocator<void> >()){
+      std::cerr << "test_map_variants< allocator<void> > failed" << std::endl;
+      return 1;
+   }
+   //       boost::container::node_allocator
+   if(test_map_variants< node_allocator<void> >()){
+      std::cerr << "test_map_variants< node_allocator<void> > failed" << std::endl;
+      return 1;
+   }
+   //       boost::container::adaptive_pool
+   if(test_map_variants< adaptive_pool<void> >()){
+      std::cerr << "test_map_variants< adaptive_pool<void> > failed" << std::endl;
+      return 1;
+   }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   {
+      flat_hash_map<int, int> m = { {1, 1}, {2, 2}, {1, 3} };
+      if(m.size() != 2u || m[1] != 1)
+         return 1;
+      m = { {3, 3} };
+      if(m.size() != 1u || m.count(1))
+         return 1;
+      flat_hash_set<int> s = { 1, 2, 3, 2 };
+      if(s.size() != 3u)
+         return 1;
+   }
+#endif
+
+   ////////////////////////////////////
+   //    Allocator propagation testing
+   ////////////////////////////////////
+   if(!boost::container::test::test_propagate_allocator<boost_container_flat_hash_map>())
+      return 1;
+
+   if(!boost::container::test::test_propagate_allocator<boost_container_flat_hash_set>())
+      return 1;
+
+   ////////////////////////////////////
+   //    Iterator testing
+   ////////////////////////////////////
+   {
+      typedef boost::container::flat_hash_map<int, int> cont_int;
+      cont_int a; a.insert(cont_int::value_type(0, 9)); a.insert(cont_int::value_type(1, 9)); a.insert(cont_int::value_type(2, 9));
+      boost::intrusive::test::test_iterator_forward< cont_int >(a);
+      if(boost::report_errors() != 0) {
+         return 1;
+      }
+   }
+
+   return 0;
+}
+
+#include <boost/container/detail/config_end.hpp>
@@ -133,7 +133,52 @@ template class flat_multimap
       < std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
    >;
 
-//As flat container iterators are typedefs for vector::[const_]iterator,
+template class flat_map
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , std::allocator
+      < std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   , flat_assoc_options< search_index<true> >::type
+   >;
+
+template class flat_multimap
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , std::allocator
+      < std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   , flat_assoc_options< search_index<true> >::type
+   >;
+
+template class flat_map
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , test::simple_allocator
+      < std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   , flat_assoc_options< sequence_storage<small_vector_sequence>, sequence_capacity<8> >::type
+   >;
+
+template class flat_multimap
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , std::allocator
+      < std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   , flat_assoc_options< sequence_storage<static_vector_sequence>, sequence_capacity<8> >::type
+   >;
+
+template class flat_map
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , allocator
+      < std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   , flat_assoc_options< sequence_storage<deque_sequence>, search_index<true> >::type
+   >;
+
+//As flat container iterators are typedefs for the sequence [const_]iterator,
 //no need to explicit instantiate them
 
 }} //boost::container
@@ -289,10 +334,76 @@ bool flat_tree_ordered_insertion_test()
    return true;
 }
 
+bool flat_tree_unordered_insertion_test()
+{
+   using namespace boost::container;
+   const std::size_t NumElements = 1000;
+   const std::size_t NumBatches  = 4;
+
+   //Unordered batches with duplicate keys. The mapped value records the insertion order
+   //so that the element kept by flat_map and the order of equivalent elements in
+   //flat_multimap can be checked against the standard containers
+   std::vector<std::pair<int, int> > values;
+   unsigned int seed = 1u;
+   for(std::size_t i = 0; i != NumElements*NumBatches; ++i){
+      seed = seed*1103515245u + 12345u;
+      values.push_back(std::pair<int, int>(static_cast<int>((seed >> 16u) % NumElements), static_cast<int>(i)));
+   }
+
+   //Construction insertion
+   {
+      std::map<int, int> int_map(values.begin(), values.begin() + NumElements);
+      flat_map<int, int> fmap(values.begin(), values.begin() + NumElements);
+      if(!CheckEqualContainers(int_map, fmap))
+         return false;
+      std::multimap<int, int> int_mmap;
+      for(std::size_t i = 0; i != NumElements; ++i){
+         int_mmap.insert(values[i]);
+      }
+      flat_multimap<int, int> fmmap(values.begin(), values.begin() + NumElements);
+      if(!CheckEqualContainers(int_mmap, fmmap))
+         return false;
+   }
+
+   //Insertion in non-empty containers
+   {
+      std::map<int, int> int_map;
+      flat_map<int, int> fmap;
+      std::multimap<int, int> int_mmap;
+      flat_multimap<int, int> fmmap;
+      for(std::size_t i = 0; i != NumBatches; ++i){
+         std::vector<std::pair<int, int> >::const_iterator const beg = values.begin() + i*NumElements;
+         std::vector<std::pair<int, int> >::const_iterator const end = beg + NumElements;
+         int_map.insert(beg, end);
+         fmap.insert(beg, end);
+         if(!CheckEqualContainers(int_map, fmap))
+            return false;
+         for(std::vector<std::pair<int, int> >::const_iterator it = beg; it != end; ++it){
+            int_mmap.insert(*it);
+         }
+         fmmap.insert(beg, end);
+         if(!CheckEqualContainers(int_mmap, fmmap))
+            return false;
+      }
+      //Already ordered range, equivalent keys go after the existing ones
+      fmmap.insert(int_map.begin(), int_map.end());
+      for(std::map<int, int>::const_iterator it = int_map.begin(); it != int_map.end(); ++it){
+         int_mmap.insert(*it);
+      }
+      if(!CheckEqualContainers(int_mmap, fmmap))
+         return false;
+      //Reversed range with keys already present
+      fmap.insert(int_map.rbegin(), int_map.rend());
+      if(!CheckEqualContainers(int_map, fmap))
+         return false;
+   }
+   return true;
+}
+
 }}}
 
 
-template<class VoidAllocator>
+template<class VoidAllocator, class Options = flat_assoc_defaults>
 struct GetAllocatorMap
 {
    template<class ValueType>
@@ -303,6 +414,7 @@ struct GetAllocatorMap
                  , std::less<ValueType>
                  , typename allocator_traits<VoidAllocator>
                     ::template portable_rebind_alloc< std::pair<ValueType, ValueType> >::type
+                 , Options
                  > map_type;
 
       typedef flat_multimap< ValueType
@@ -310,6 +422,7 @@ struct GetAllocatorMap
                  , std::less<ValueType>
                  , typename allocator_traits<VoidAllocator>
                     ::template portable_rebind_alloc< std::pair<ValueType, ValueType> >::type
+                 , Options
                  > multimap_type;
    };
 };
@@ -357,18 +470,18 @@ struct get_real_stored_allocator<flat_multimap<Key, T, Compare, Allocator> >
 
 }}}   //namespace boost::container::test
 
-template<class VoidAllocator>
+template<class VoidAllocator, class Options>
 int test_map_variants()
 {
-   typedef typename GetAllocatorMap<VoidAllocator>::template apply<int>::map_type MyMap;
-   typedef typename GetAllocatorMap<VoidAllocator>::template apply<test::movable_int>::map_type MyMoveMap;
-   typedef typename GetAllocatorMap<VoidAllocator>::template apply<test::movable_and_copyable_int>::map_type MyCopyMoveMap;
-   typedef typename GetAllocatorMap<VoidAllocator>::template apply<test::copyable_int>::map_type MyCopyMap;
+   typedef typename GetAllocatorMap<VoidAllocator, Options>::template apply<int>::map_type MyMap;
+   typedef typename GetAllocatorMap<VoidAllocator, Options>::template apply<test::movable_int>::map_type MyMoveMap;
+   typedef typename GetAllocatorMap<VoidAllocator, Options>::template apply<test::movable_and_copyable_int>::map_type MyCopyMoveMap;
+   typedef typename GetAllocatorMap<VoidAllocator, Options>::template apply<test::copyable_int>::map_type MyCopyMap;
 
-   typedef typename GetAllocatorMap<VoidAllocator>::template apply<int>::multimap_type MyMultiMap;
-   typedef typename GetAllocatorMap<VoidAllocator>::template apply<test::movable_int>::multimap_type MyMoveMultiMap;
-   typedef typename GetAllocatorMap<VoidAllocator>::template apply<test::movable_and_copyable_int>::multimap_type MyCopyMoveMultiMap;
-   typedef typename GetAllocatorMap<VoidAllocator>::template apply<test::copyable_int>::multimap_type MyCopyMultiMap;
+   typedef typename GetAllocatorMap<VoidAllocator, Options>::template apply<int>::multimap_type MyMultiMap;
+   typedef typename GetAllocatorMap<VoidAllocator, Options>::template apply<test::movable_int>::multimap_type MyMoveMultiMap;
+   typedef typename GetAllocatorMap<VoidAllocator, Options>::template apply<test::movable_and_copyable_int>::multimap_type MyCopyMoveMultiMap;
+   typedef typename GetAllocatorMap<VoidAllocator, Options>::template apply<test::copyable_int>::multimap_type MyCopyMultiMap;
 
    typedef std::map<int, int>                                     MyStdMap;
    typedef std::multimap<int, int>                                MyStdMultiMap;
@@ -412,6 +525,10 @@ int test_map_variants()
    return 0;
 }
 
+template<class VoidAllocator>
+int test_map_variants()
+{  return test_map_variants<VoidAllocator, flat_assoc_defaults>();  }
+
 int main()
 {
    using namespace boost::container::test;
@@ -450,6 +567,163 @@ int main()
       return 1;
    }
 
+   ////////////////////////////////////
+   //    Unordered range insertion test
+   ////////////////////////////////////
+   if(!flat_tree_unordered_insertion_test()){
+      return 1;
+   }
+
+   ////////////////////////////////////
+   //    Extract/adopt sequence test
+   ////////////////////////////////////
+   {
+      typedef flat_map<int, int>             map_t;
+      typedef flat_multimap<int, int>        multimap_t;
+      typedef map_t::sequence_type           sequence_t;
+      typedef std::pair<int, int>            pair_t;
+
+      //Unordered adoption keeps the first element of equivalent ones
+      sequence_t seq;
+      for(int i = 0; i != 100; ++i){
+         seq.push_back(pair_t((i*17) % 50, i));
+      }
+      map_t m;
+      m.adopt_sequence(boost::move(seq));
+      if(m.size() != 50u)
+         return 1;
+      for(int i = 0; i != 100; ++i){
+         const int k = (i*17) % 50;
+         if(i < 50 && m.at(k) != i)
+            return 1;
+      }
+      const pair_t *const data = &*m.begin();
+      seq = m.extract_sequence();
+      if(!m.empty() || seq.size() != 50u || &seq[0] != data)
+         return 1;
+      m.adopt_sequence(ordered_unique_range, boost::move(seq));
+      if(m.size() != 50u || &*m.begin() != data || m.at(17) != 1)
+         return 1;
+
+      //The multimap adoption is stable
+      multimap_t::sequence_type mseq;
+      for(int i = 0; i != 100; ++i){
+         mseq.push_back(pair_t((i*17) % 50, i));
+      }
+      multimap_t mm;
+      mm.adopt_sequence(boost::move(mseq));
+      if(mm.size() != 100u)
+         return 1;
+      for(multimap_t::const_iterator it = mm.begin(), prev = it; it != mm.end(); prev = it++){
+         if(it->first < prev->first || (it != prev && it->first == prev->first && it->second < prev->second))
+            return 1;
+      }
+      mseq = mm.extract_sequence();
+      mm.adopt_sequence(ordered_range, boost::move(mseq));
+      if(mm.size() != 100u || mm.count(17) != 2u)
+         return 1;
+   }
+
+   ////////////////////////////////////
+   //    Search index test
+   ////////////////////////////////////
+   {
+      typedef flat_map<int, int, std::less<int>, std::allocator<std::pair<int, int> >
+                      , flat_assoc_options< search_index<true> >::type> indexed_map_t;
+      indexed_map_t m;
+      flat_map<int, int> ref;
+      for(int i = 0; i != 50; ++i){
+         m[i*3] = i;
+         ref[i*3] = i;
+      }
+      m.rebuild_index();
+      const indexed_map_t &cm = m;
+      for(int i = -1; i != 160; ++i){
+         if((cm.find(i) - cm.begin()) != (ref.find(i) - ref.begin()) ||
+            (cm.lower_bound(i) - cm.begin()) != (ref.lower_bound(i) - ref.begin()) ||
+            (cm.upper_bound(i) - cm.begin()) != (ref.upper_bound(i) - ref.begin()) ||
+            cm.count(i) != ref.count(i))
+            return 1;
+      }
+      //Mapped values can be modified through the index
+      m[30] = -1;
+      if(m.at(30) != -1 || m.size() != ref.size())
+         return 1;
+   }
+
+   ////////////////////////////////////
+   //    Sequence storage test
+   ////////////////////////////////////
+   {
+      //Small maps are stored inline
+      typedef flat_map<int, int, std::less<int>, new_allocator<std::pair<int, int> >
+                      , flat_assoc_options< sequence_storage<small_vector_sequence>
+                                          , sequence_capacity<8> >::type> small_map_t;
+      small_map_t m;
+      for(int i = 6; i != 0; --i){
+         m[i] = -i;
+      }
+      const char *const p = static_cast<const char *>(static_cast<const void*>(&*m.begin()));
+      const char *const o = static_cast<const char *>(static_cast<const void*>(&m));
+      if(p < o || p >= o + sizeof(m) || m.nth(0)->first != 1 || m.at(6) != -6)
+         return 1;
+      //Moved-from maps are left empty even if elements are moved one by one
+      small_map_t m2(boost::move(m));
+      if(!m.empty() || m2.size() != 6u || m2.find(3)->second != -3)
+         return 1;
+      small_map_t::sequence_type seq(m2.extract_sequence());
+      if(!m2.empty() || seq.size() != 6u || seq[0].first != 1)
+         return 1;
+
+      //Fixed capacity maps
+      typedef flat_multimap<int, int, std::less<int>, new_allocator<std::pair<int, int> >
+                           , flat_assoc_options< sequence_storage<static_vector_sequence>
+                                               , sequence_capacity<16> >::type> static_map_t;
+      static_map_t sm;
+      for(int i = 0; i != 16; ++i){
+         sm.insert(std::pair<int, int>(i % 4, i));
+      }
+      if(sm.capacity() != 16u || sm.count(2) != 4u || sm.lower_bound(2)->second != 2)
+         return 1;
+
+      //Deque based maps adopt deques
+      typedef flat_map<int, int, std::less<int>, new_allocator<std::pair<int, int> >
+                      , flat_assoc_options< sequence_storage<deque_sequence> >::type> deque_map_t;
+      deque_map_t dm;
+      deque_map_t::sequence_type dseq;
+      for(int i = 0; i != 100; ++i){
+         dseq.push_back(std::pair<int, int>((i*7) % 50, i));
+      }
+      dm.adopt_sequence(boost::move(dseq));
+      if(dm.size() != 50u || dm.at(7) != 1 || (dm.end() - dm.begin()) != 50)
+         return 1;
+      for(int i = 0; i != 50; ++i){
+         if(dm.nth(std::size_t(i))->first != i)
+            return 1;
+      }
+   }
+
+   ////////////////////////////////////
+   //    Heterogeneous lookup testing
+   ////////////////////////////////////
+   {
+      typedef boost::container::test::transparent_key   key_t;
+      typedef boost::container::test::transparent_less  less_t;
+      typedef flat_map<key_t, int, less_t>        map_t;
+      typedef flat_multimap<key_t, int, less_t>   multimap_t;
+      map_t map_;
+      multimap_t multimap_;
+      for(int i = 0; i != 10; i += 2){
+         map_.insert(map_t::value_type(key_t(i), i));
+         multimap_.insert(multimap_t::value_type(key_t(i), i));
+         multimap_.insert(multimap_t::value_type(key_t(i), i));
+      }
+      if(!boost::container::test::test_heterogeneous_lookup(map_))
+         return 1;
+      if(!boost::container::test::test_heterogeneous_lookup(multimap_))
+         return 1;
+   }
+
    ////////////////////////////////////
    //    Testing allocator implementations
    ////////////////////////////////////
@@ -474,6 +748,28 @@ int main()
       return 1;
    }
 
+   ////////////////////////////////////
+   //    Testing sequence storages
+   ////////////////////////////////////
+   //       small_vector
+   if(test_map_variants< new_allocator<void>, flat_assoc_options
+         < sequence_storage<small_vector_sequence>, sequence_capacity<8> >::type >()){
+      std::cerr << "test_map_variants< small_vector_sequence > failed" << std::endl;
+      return 1;
+   }
+   //       static_vector
+   if(test_map_variants< new_allocator<void>, flat_assoc_options
+         < sequence_storage<static_vector_sequence>, sequence_capacity<512> >::type >()){
+      std::cerr << "test_map_variants< static_vector_sequence > failed" << std::endl;
+      return 1;
+   }
+   //       deque
+   if(test_map_variants< new_allocator<void>, flat_assoc_options
+         < sequence_storage<deque_sequence> >::type >()){
+      std::cerr << "test_map_variants< deque_sequence > failed" << std::endl;
+      return 1;
+   }
+
    if(!boost::container::test::test_map_support_for_initialization_list_for<flat_map<int, int> >())
       return 1;
 
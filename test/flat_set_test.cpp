@@ -23,6 +23,8 @@
 #include "emplace_test.hpp"
 #include "container_common_tests.hpp"
 #include <vector>
+#include <list>
+#include <algorithm>
 #include <boost/container/detail/flat_tree.hpp>
 #include "../../intrusive/test/iterator_test.hpp"
 
@@ -107,6 +109,41 @@ template class flat_multiset
    , node_allocator<test::movable_and_copyable_int>
    >;
 
+template class flat_set
+   < test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , std::allocator<test::movable_and_copyable_int>
+   , flat_assoc_options< search_index<true> >::type
+   >;
+
+template class flat_multiset
+   < test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , std::allocator<test::movable_and_copyable_int>
+   , flat_assoc_options< search_index<true> >::type
+   >;
+
+template class flat_set
+   < test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , test::simple_allocator<test::movable_and_copyable_int>
+   , flat_assoc_options< sequence_storage<small_vector_sequence>, sequence_capacity<8> >::type
+   >;
+
+template class flat_multiset
+   < test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , std::allocator<test::movable_and_copyable_int>
+   , flat_assoc_options< sequence_storage<static_vector_sequence>, sequence_capacity<8> >::type
+   >;
+
+template class flat_set
+   < test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , allocator<test::movable_and_copyable_int>
+   , flat_assoc_options< sequence_storage<deque_sequence>, search_index<true> >::type
+   >;
+
 namespace container_detail {
 
 //Instantiate base class as previous instantiations don't instantiate inherited members
@@ -232,6 +269,269 @@ namespace boost{
 namespace container {
 namespace test{
 
+//Compares every lookup of an indexed flat_(multi)set against std::multiset
+template<class FlatSet>
+bool check_indexed_lookups(FlatSet &c, const std::multiset<int> &ref)
+{
+   typedef typename FlatSet::const_iterator const_iterator;
+   const FlatSet &cc = c;
+   for(int i = -1; i != 2*int(ref.size()) + 2; ++i){
+      const std::size_t lb = std::size_t(std::distance(ref.begin(), ref.lower_bound(i)));
+      const std::size_t ub = std::size_t(std::distance(ref.begin(), ref.upper_bound(i)));
+      const bool present = lb != ub;
+      if(std::size_t(c.lower_bound(i) - c.begin()) != lb || std::size_t(cc.lower_bound(i) - cc.begin()) != lb)
+         return false;
+      if(std::size_t(c.upper_bound(i) - c.begin()) != ub || std::size_t(cc.upper_bound(i) - cc.begin()) != ub)
+         return false;
+      if(present != (c.find(i) != c.end()) || present != (cc.find(i) != cc.end()))
+         return false;
+      if(present && (*c.find(i) != i || *cc.find(i) != i))
+         return false;
+      if(c.count(i) != ub - lb)
+         return false;
+      std::pair<const_iterator, const_iterator> r = cc.equal_range(i);
+      if(std::size_t(r.first - cc.begin()) != lb || std::size_t(r.second - cc.begin()) != ub)
+         return false;
+   }
+   return true;
+}
+
+template<class FlatSet>
+bool flat_tree_search_index_test_for(bool unique)
+{
+   FlatSet c;
+   std::multiset<int> ref;
+   //Empty container and sizes that fill and partially fill the last level
+   for(int n = 0; n != 70; ++n){
+      if(!check_indexed_lookups(c, ref))
+         return false;
+      c.rebuild_index();
+      if(!check_indexed_lookups(c, ref))
+         return false;
+      const int v = (n*37) % 71;
+      c.insert(v);
+      ref.insert(v);
+      if(!unique){
+         c.insert(v);
+         ref.insert(v);
+      }
+   }
+   //Range insertion rebuilds the index
+   {
+      const int vals[] = { 140, -3, 71, 140, 5 };
+      c.insert(&vals[0], &vals[0] + sizeof(vals)/sizeof(vals[0]));
+      for(std::size_t i = 0; i != sizeof(vals)/sizeof(vals[0]); ++i){
+         if(!unique || !ref.count(vals[i]))
+            ref.insert(vals[i]);
+      }
+      if(!check_indexed_lookups(c, ref))
+         return false;
+   }
+   //Erasure invalidates the index
+   c.erase(c.begin());
+   ref.erase(ref.begin());
+   c.erase(*ref.begin());
+   ref.erase(*ref.begin());
+   if(!check_indexed_lookups(c, ref))
+      return false;
+   //Copies, moves and swaps carry the index along with the values
+   c.rebuild_index();
+   FlatSet copy(c);
+   if(!check_indexed_lookups(copy, ref))
+      return false;
+   FlatSet moved(boost::move(copy));
+   if(!check_indexed_lookups(moved, ref) || !copy.empty())
+      return false;
+   FlatSet other;
+   other.swap(moved);
+   if(!check_indexed_lookups(other, ref) || !moved.empty())
+      return false;
+   c.clear();
+   ref.clear();
+   return check_indexed_lookups(c, ref);
+}
+
+bool flat_tree_search_index_test()
+{
+   typedef flat_assoc_options< search_index<true> >::type indexed_t;
+   if(!flat_tree_search_index_test_for
+         <flat_set<int, std::less<int>, std::allocator<int>, indexed_t> >(true))
+      return false;
+   if(!flat_tree_search_index_test_for
+         <flat_multiset<int, std::less<int>, std::allocator<int>, indexed_t> >(false))
+      return false;
+   //Without the option rebuild_index() is a no-op
+   if(!flat_tree_search_index_test_for<flat_set<int> >(true))
+      return false;
+   return true;
+}
+
+bool flat_tree_extract_adopt_test()
+{
+   typedef flat_set<int>         set_t;
+   typedef flat_multiset<int>    multiset_t;
+   typedef set_t::sequence_type  sequence_t;
+
+   //Extraction moves the buffer out
+   set_t s;
+   for(int i = 0; i != 50; ++i){
+      s.insert(i);
+   }
+   const int *const data = &*s.begin();
+   sequence_t seq(s.extract_sequence());
+   if(!s.empty() || seq.size() != 50u || &seq[0] != data)
+      return false;
+
+   //Ordered adoption keeps the buffer
+   s.adopt_sequence(ordered_unique_range, boost::move(seq));
+   if(s.size() != 50u || &*s.begin() != data || s.find(25) == s.end())
+      return false;
+
+   //Unordered adoption sorts and removes duplicates
+   seq.clear();
+   for(int i = 0; i != 100; ++i){
+      seq.push_back((i*17) % 50);
+   }
+   s.adopt_sequence(boost::move(seq));
+   if(s.size() != 50u)
+      return false;
+   for(int i = 0; i != 50; ++i){
+      if(*s.nth(set_t::size_type(i)) != i)
+         return false;
+   }
+
+   //Multiset keeps every element
+   multiset_t ms;
+   multiset_t::sequence_type mseq;
+   for(int i = 0; i != 100; ++i){
+      mseq.push_back((i*17) % 50);
+   }
+   ms.adopt_sequence(boost::move(mseq));
+   if(ms.size() != 100u || ms.count(7) != 2u)
+      return false;
+   for(multiset_t::const_iterator it = ms.begin(), prev = it; it != ms.end(); prev = it++){
+      if(*it < *prev)
+         return false;
+   }
+   mseq = ms.extract_sequence();
+   if(!ms.empty() || mseq.size() != 100u)
+      return false;
+   ms.adopt_sequence(ordered_range, boost::move(mseq));
+   if(ms.size() != 100u || ms.count(49) != 2u)
+      return false;
+
+   //The search index is invalidated by adoption
+   typedef flat_set<int, std::less<int>, std::allocator<int>, flat_assoc_options< search_index<true> >::type> indexed_t;
+   indexed_t is;
+   is.insert(1);
+   is.rebuild_index();
+   indexed_t::sequence_type iseq;
+   iseq.push_back(5);
+   iseq.push_back(3);
+   is.adopt_sequence(boost::move(iseq));
+   const indexed_t &cis = is;
+   if(cis.find(1) != cis.end() || cis.find(3) != cis.begin() || cis.lower_bound(4) != cis.begin() + 1)
+      return false;
+   return true;
+}
+
+//Checks range insertion, merging of ordered ranges and sequence adoption
+//against a sorted std::vector
+template<class FlatSet, class OrderedTag>
+bool flat_tree_sequence_storage_test_for(OrderedTag ordered_tag, bool unique)
+{
+   std::vector<int> ref;
+   FlatSet c;
+   std::list<int> l;
+   for(int i = 0; i != 40; ++i){
+      l.push_back((i*7) % 20);
+   }
+   c.insert(l.begin(), l.end());
+   ref.insert(ref.end(), l.begin(), l.end());
+
+   //Ordered bidirectional ranges are merged
+   l.clear();
+   for(int i = 10; i != 30; ++i){
+      l.push_back(i);
+      ref.push_back(i);
+   }
+   c.insert(ordered_tag, l.begin(), l.end());
+   std::sort(ref.begin(), ref.end());
+   if(unique){
+      ref.erase(std::unique(ref.begin(), ref.end()), ref.end());
+   }
+   if(c.size() != ref.size() || !std::equal(c.begin(), c.end(), ref.begin()))
+      return false;
+   if(c.capacity() < c.size() || *c.nth(5) != ref[5] ||
+      c.index_of(c.find(15)) != std::size_t(std::lower_bound(ref.begin(), ref.end(), 15) - ref.begin()))
+      return false;
+
+   //Extraction and adoption
+   typename FlatSet::sequence_type seq(c.extract_sequence());
+   if(!c.empty() || seq.size() != ref.size())
+      return false;
+   std::reverse(seq.begin(), seq.end());
+   c.adopt_sequence(boost::move(seq));
+   if(c.size() != ref.size() || !std::equal(c.begin(), c.end(), ref.begin()))
+      return false;
+   return hash_value(c) == hash_value(FlatSet(c)) &&
+          c.count(15) == std::size_t(std::count(ref.begin(), ref.end(), 15));
+}
+
+bool flat_tree_sequence_storage_test()
+{
+   typedef flat_assoc_options
+      < sequence_storage<small_vector_sequence>, sequence_capacity<8> >::type    small_t;
+   typedef flat_assoc_options
+      < sequence_storage<static_vector_sequence>, sequence_capacity<64> >::type  static_t;
+   typedef flat_assoc_options
+      < sequence_storage<deque_sequence>, search_index<true> >::type             deque_t;
+
+   if(!flat_tree_sequence_storage_test_for< flat_set<int, std::less<int>, std::allocator<int>, small_t> >(ordered_unique_range, true) ||
+      !flat_tree_sequence_storage_test_for< flat_multiset<int, std::less<int>, std::allocator<int>, small_t> >(ordered_range, false) ||
+      !flat_tree_sequence_storage_test_for< flat_set<int, std::less<int>, std::allocator<int>, static_t> >(ordered_unique_range, true) ||
+      !flat_tree_sequence_storage_test_for< flat_multiset<int, std::less<int>, std::allocator<int>, static_t> >(ordered_range, false) ||
+      !flat_tree_sequence_storage_test_for< flat_set<int, std::less<int>, std::allocator<int>, deque_t> >(ordered_unique_range, true) ||
+      !flat_tree_sequence_storage_test_for< flat_multiset<int, std::less<int>, std::allocator<int>, deque_t> >(ordered_range, false))
+      return false;
+
+   //Up to sequence_capacity elements are stored inside small_vector and static_vector based sets
+   {
+      flat_set<int, std::less<int>, std::allocator<int>, small_t> s;
+      for(int i = 8; i != 0; --i){
+         s.insert(i);
+      }
+      const char *const p = static_cast<const char *>(static_cast<const void*>(&*s.begin()));
+      const char *const o = static_cast<const char *>(static_cast<const void*>(&s));
+      if(s.capacity() < 8u || p < o || p >= o + sizeof(s))
+         return false;
+   }
+   {
+      flat_set<int, std::less<int>, std::allocator<int>, static_t> s;
+      for(int i = 64; i != 0; --i){
+         s.insert(i);
+      }
+      const char *const p = static_cast<const char *>(static_cast<const void*>(&*s.begin()));
+      const char *const o = static_cast<const char *>(static_cast<const void*>(&s));
+      if(s.capacity() != 64u || s.size() != 64u || p < o || p >= o + sizeof(s))
+         return false;
+   }
+   //Elements of a deque based set are not reallocated when inserted at the end
+   {
+      flat_set<int, std::less<int>, std::allocator<int>, deque_t> s;
+      s.insert(0);
+      const int *const first = &*s.begin();
+      for(int i = 1; i != 1000; ++i){
+         s.insert(s.end(), i);
+      }
+      s.rebuild_index();
+      const flat_set<int, std::less<int>, std::allocator<int>, deque_t> &cs = s;
+      if(&*s.begin() != first || cs.find(500) != cs.begin() + 500 || cs.lower_bound(1000) != cs.end())
+         return false;
+   }
+   return true;
+}
+
 bool flat_tree_ordered_insertion_test()
 {
    using namespace boost::container;
@@ -399,7 +699,7 @@ bool flat_tree_ordered_insertion_test()
 }}}
 
 
-template<class VoidAllocator>
+template<class VoidAllocator, class Options = flat_assoc_defaults>
 struct GetAllocatorSet
 {
    template<class ValueType>
@@ -409,28 +709,30 @@ struct GetAllocatorSet
                        , std::less<ValueType>
                        , typename allocator_traits<VoidAllocator>
                            ::template portable_rebind_alloc<ValueType>::type
+                       , Options
                         > set_type;
 
       typedef flat_multiset < ValueType
                             , std::less<ValueType>
                             , typename allocator_traits<VoidAllocator>
                                  ::template portable_rebind_alloc<ValueType>::type
+                            , Options
                             > multiset_type;
    };
 };
 
-template<class VoidAllocator>
+template<class VoidAllocator, class Options>
 int test_set_variants()
 {
-   typedef typename GetAllocatorSet<VoidAllocator>::template apply<int>::set_type MySet;
-   typedef typename GetAllocatorSet<VoidAllocator>::template apply<test::movable_int>::set_type MyMoveSet;
-   typedef typename GetAllocatorSet<VoidAllocator>::template apply<test::movable_and_copyable_int>::set_type MyCopyMoveSet;
-   typedef typename GetAllocatorSet<VoidAllocator>::template apply<test::copyable_int>::set_type MyCopySet;
+   typedef typename GetAllocatorSet<VoidAllocator, Options>::template apply<int>::set_type MySet;
+   typedef typename GetAllocatorSet<VoidAllocator, Options>::template apply<test::movable_int>::set_type MyMoveSet;
+   typedef typename GetAllocatorSet<VoidAllocator, Options>::template apply<test::movable_and_copyable_int>::set_type MyCopyMoveSet;
+   typedef typename GetAllocatorSet<VoidAllocator, Options>::template apply<test::copyable_int>::set_type MyCopySet;
 
-   typedef typename GetAllocatorSet<VoidAllocator>::template apply<int>::multiset_type MyMultiSet;
-   typedef typename GetAllocatorSet<VoidAllocator>::template apply<test::movable_int>::multiset_type MyMoveMultiSet;
-   typedef typename GetAllocatorSet<VoidAllocator>::template apply<test::movable_and_copyable_int>::multiset_type MyCopyMoveMultiSet;
-   typedef typename GetAllocatorSet<VoidAllocator>::template apply<test::copyable_int>::multiset_type MyCopyMultiSet;
+   typedef typename GetAllocatorSet<VoidAllocator, Options>::template apply<int>::multiset_type MyMultiSet;
+   typedef typename GetAllocatorSet<VoidAllocator, Options>::template apply<test::movable_int>::multiset_type MyMoveMultiSet;
+   typedef typename GetAllocatorSet<VoidAllocator, Options>::template apply<test::movable_and_copyable_int>::multiset_type MyCopyMoveMultiSet;
+   typedef typename GetAllocatorSet<VoidAllocator, Options>::template apply<test::copyable_int>::multiset_type MyCopyMultiSet;
 
    typedef std::set<int>                                          MyStdSet;
    typedef std::multiset<int>                                     MyStdMultiSet;
@@ -474,6 +776,10 @@ int test_set_variants()
    return 0;
 }
 
+template<class VoidAllocator>
+int test_set_variants()
+{  return test_set_variants<VoidAllocator, flat_assoc_defaults>();  }
+
 
 template<typename FlatSetType>
 bool test_support_for_initialization_list_for()
@@ -575,6 +881,39 @@ int main()
       return 1;
    }
 
+   ////////////////////////////////////
+   //    Extract/adopt sequence test
+   ////////////////////////////////////
+   if(!flat_tree_extract_adopt_test()){
+      return 1;
+   }
+
+   ////////////////////////////////////
+   //    Search index test
+   ////////////////////////////////////
+   if(!flat_tree_search_index_test()){
+      return 1;
+   }
+
+   ////////////////////////////////////
+   //    Heterogeneous lookup testing
+   ////////////////////////////////////
+   {
+      typedef boost::container::test::transparent_key   key_t;
+      typedef boost::container::test::transparent_less  less_t;
+      flat_set<key_t, less_t> set_;
+      flat_multiset<key_t, less_t> multiset_;
+      for(int i = 0; i != 10; i += 2){
+         set_.insert(key_t(i));
+         multiset_.insert(key_t(i));
+         multiset_.insert(key_t(i));
+      }
+      if(!boost::container::test::test_heterogeneous_lookup(set_))
+         return 1;
+      if(!boost::container::test::test_heterogeneous_lookup(multiset_))
+         return 1;
+   }
+
    ////////////////////////////////////
    //    Testing allocator implementations
    ////////////////////////////////////
@@ -599,6 +938,40 @@ int main()
       return 1;
    }
 
+   ////////////////////////////////////
+   //    Testing sequence storages
+   ////////////////////////////////////
+   //       small_vector
+   if(test_set_variants< new_allocator<void>, flat_assoc_options
+         < sequence_storage<small_vector_sequence>, sequence_capacity<8> >::type >()){
+      std::cerr << "test_set_variants< small_vector_sequence > failed" << std::endl;
+      return 1;
+   }
+   //       static_vector
+   if(test_set_variants< new_allocator<void>, flat_assoc_options
+         < sequence_storage<static_vector_sequence>, sequence_capacity<512> >::type >()){
+      std::cerr << "test_set_variants< static_vector_sequence > failed" << std::endl;
+      return 1;
+   }
+   //       deque
+   if(test_set_variants< new_allocator<void>, flat_assoc_options
+         < sequence_storage<deque_sequence> >::type >()){
+      std::cerr << "test_set_variants< deque_sequence > failed" << std::endl;
+      return 1;
+   }
+   if(!flat_tree_sequence_storage_test()){
+      return 1;
+   }
+
+   ////////////////////////////////////
+   //    Set algebra testing
+   ////////////////////////////////////
+   if(!boost::container::test::test_set_algebra< flat_set<int> >())
+      return 1;
+   if(!boost::container::test::test_set_algebra< flat_set<int, std::less<int>, new_allocator<int>
+         , flat_assoc_options< sequence_storage<deque_sequence> >::type > >())
+      return 1;
+
    ////////////////////////////////////
    //    Emplace testing
    ////////////////////////////////////
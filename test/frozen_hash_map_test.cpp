@@ -0,0 +1,420 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/frozen_hash_set.hpp>
+#include <boost/container/frozen_hash_map.hpp>
+#include <boost/container/flat_set.hpp>
+#include <boost/container/flat_map.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/container/string.hpp>
+#include <boost/container/allocator.hpp>
+#include <boost/container/node_allocator.hpp>
+#include <boost/container/adaptive_pool.hpp>
+
+#include "dummy_test_allocator.hpp"
+#include "movable_int.hpp"
+#include "input_from_forward_iterator.hpp"
+
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <iostream>
+
+using namespace boost::container;
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+template class frozen_hash_set
+   < test::movable_and_copyable_int
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , test::simple_allocator<test::movable_and_copyable_int>
+   >;
+
+template class frozen_hash_set
+   < test::movable_and_copyable_int
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , std::allocator<test::movable_and_copyable_int>
+   >;
+
+template class frozen_hash_map
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , test::simple_allocator< std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   >;
+
+template class frozen_hash_map
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , std::allocator< std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   >;
+
+}} //boost::container
+
+//Sends every key to one of three hash values
+struct bad_hash
+{
+   template<class T>
+   std::size_t operator()(const T &t) const
+   {  return boost::hash<T>()(t) % 3u;  }
+};
+
+//Appends a value without copying the key or the mapped value
+template<class MovableValue>
+void push_movable_value(vector<MovableValue> &v, int k, int m)
+{
+   typename MovableValue::first_type key(k);
+   typename MovableValue::second_type mapped(m);
+   MovableValue val(boost::move(key), boost::move(mapped));
+   v.push_back(boost::move(val));
+}
+
+template<class MyMap>
+bool check_equal_map(const MyMap &fmap, const std::map<int, int> &smap)
+{
+   typedef typename MyMap::key_type key_type;
+   if(fmap.size() != smap.size() || fmap.empty() != smap.empty())
+      return false;
+   if(typename MyMap::size_type(fmap.cend() - fmap.cbegin()) != fmap.size())
+      return false;
+   //Every element is found in its own position
+   for(typename MyMap::const_iterator it = fmap.cbegin(); it != fmap.cend(); ++it){
+      std::map<int, int>::const_iterator sit = smap.find(it->first.get_int());
+      if(sit == smap.end() || sit->second != it->second.get_int() || fmap.find(it->first) != it)
+         return false;
+   }
+   for(std::map<int, int>::const_iterator it = smap.begin(); it != smap.end(); ++it){
+      const key_type k(it->first);
+      if(fmap.count(k) != 1u || fmap.at(k).get_int() != it->second)
+         return false;
+      if(fmap.equal_range(k).second - fmap.equal_range(k).first != 1)
+         return false;
+   }
+   return true;
+}
+
+template<class MyMap>
+bool check_missing_keys(const MyMap &fmap, int first, int last)
+{
+   typedef typename MyMap::key_type key_type;
+   for(int i = first; i != last; ++i){
+      const key_type k(i);
+      if(fmap.find(k) != fmap.cend() || fmap.count(k) || fmap.equal_range(k).first != fmap.equal_range(k).second)
+         return false;
+   }
+   bool thrown = false;
+   BOOST_TRY{
+      fmap.at(key_type(first));
+   }
+   BOOST_CATCH(const std::out_of_range &){
+      thrown = true;
+   }
+   BOOST_CATCH_END
+   return thrown;
+}
+
+template<class MyMap>
+int frozen_hash_map_test()
+{
+   typedef typename MyMap::key_type             IntType;
+   typedef typename MyMap::mapped_type          MappedType;
+   typedef typename MyMap::movable_value_type   movable_value_type;
+   typedef typename MyMap::allocator_type       allocator_type;
+
+   //Sizes around the bucket size and bigger tables
+   const int sizes[] = { 0, 1, 2, 3, 4, 5, 7, 8, 9, 31, 100, 1000, 20000 };
+   for(std::size_t s = 0; s != sizeof(sizes)/sizeof(*sizes); ++s){
+      const int n = sizes[s];
+      vector<movable_value_type> v;
+      std::map<int, int> smap;
+      for(int i = 0; i < n; ++i){
+         IntType k(i*3);
+         MappedType m(-i);
+         v.push_back(movable_value_type(boost::move(k), boost::move(m)));
+         smap[i*3] = -i;
+      }
+
+      //Elements are moved from the range
+      MyMap fmap(boost::make_move_iterator(v.begin()), boost::make_move_iterator(v.end()));
+      if(!check_equal_map(fmap, smap))
+         return 1;
+      if(n && (!check_missing_keys(fmap, -50, 0) || !check_missing_keys(fmap, n*3, n*3 + 50)))
+         return 1;
+      for(int i = 0; i < n; ++i){
+         if(fmap.count(IntType(i*3 + 1)) || fmap.count(IntType(i*3 + 2)))
+            return 1;
+      }
+      if(n && fmap.bucket_count() == 0u)
+         return 1;
+
+      //Move construction and assignment
+      MyMap fmap2(boost::move(fmap));
+      if(!fmap.empty() || fmap.cbegin() != fmap.cend() || fmap.count(IntType(0)) || !check_equal_map(fmap2, smap))
+         return 1;
+      fmap = boost::move(fmap2);
+      if(!fmap2.empty() || !check_equal_map(fmap, smap))
+         return 1;
+      MyMap fmap3(boost::move(fmap), fmap.get_allocator());
+      if(!check_equal_map(fmap3, smap))
+         return 1;
+      fmap.swap(fmap3);
+      if(!fmap3.empty() || !check_equal_map(fmap, smap))
+         return 1;
+   }
+
+   //Duplicated keys in an unordered range: the first element is kept
+   {
+      vector<movable_value_type> v;
+      std::map<int, int> smap;
+      for(int i = 0; i < 300; ++i){
+         const int k = (i*7) % 101;
+         push_movable_value(v, k, i);
+         smap.insert(std::pair<const int, int>(k, i));
+      }
+      MyMap fmap(boost::make_move_iterator(v.begin()), boost::make_move_iterator(v.end()));
+      if(!check_equal_map(fmap, smap) || !check_missing_keys(fmap, 101, 200))
+         return 1;
+   }
+
+   //Single pass ranges
+   {
+      vector<movable_value_type> v;
+      std::map<int, int> smap;
+      for(int i = 0; i < 100; ++i){
+         push_movable_value(v, i, i);
+         smap[i] = i;
+      }
+      MyMap fmap( test::make_input_from_forward_iterator(boost::make_move_iterator(v.begin()))
+                , test::make_input_from_forward_iterator(boost::make_move_iterator(v.end())));
+      if(!check_equal_map(fmap, smap))
+         return 1;
+   }
+
+   //Keys with the same hash value are stored in overflow slots
+   {
+      typedef frozen_hash_map<IntType, MappedType, bad_hash, std::equal_to<IntType>, allocator_type> bad_hash_map;
+      vector<movable_value_type> v;
+      std::map<int, int> smap;
+      for(int i = 0; i < 50; ++i){
+         push_movable_value(v, i, i);
+         smap[i] = i;
+      }
+      bad_hash_map hmap(ordered_unique_range, boost::make_move_iterator(v.begin()), boost::make_move_iterator(v.end()));
+      if(!check_equal_map(hmap, smap) || !check_missing_keys(hmap, 50, 100))
+         return 1;
+      bad_hash_map hmap2(boost::move(hmap));
+      if(!hmap.empty() || !check_equal_map(hmap2, smap))
+         return 1;
+      //Duplicates of a key, and of keys with the same hash value, are dropped
+      v.clear();
+      smap.clear();
+      for(int i = 0; i < 60; ++i){
+         const int k = (i*7) % 20;
+         push_movable_value(v, k, i);
+         smap.insert(std::pair<const int, int>(k, i));
+      }
+      bad_hash_map hmap3(boost::make_move_iterator(v.begin()), boost::make_move_iterator(v.end()));
+      if(!check_equal_map(hmap3, smap) || !check_missing_keys(hmap3, 20, 40))
+         return 1;
+   }
+   return 0;
+}
+
+template<class MyMap>
+int frozen_hash_map_copyable_test()
+{
+   typedef typename MyMap::key_type             IntType;
+   typedef typename MyMap::mapped_type          MappedType;
+   typedef typename MyMap::value_type           value_type;
+
+   flat_map<IntType, MappedType> fm;
+   std::map<int, int> smap;
+   for(int i = 0; i < 500; ++i){
+      fm.insert(value_type(IntType(i), MappedType(i*2)));
+      smap[i] = i*2;
+   }
+   MyMap fmap(fm);
+   if(!check_equal_map(fmap, smap))
+      return 1;
+
+   //Copies reproduce the layout
+   MyMap fmap2(fmap);
+   if(!check_equal_map(fmap2, smap) || !(fmap2 == fmap) || fmap2 != fmap)
+      return 1;
+   if(!std::equal(fmap.cbegin(), fmap.cend(), fmap2.cbegin()))
+      return 1;
+   MyMap fmap3(fmap, fmap.get_allocator());
+   if(!check_equal_map(fmap3, smap))
+      return 1;
+   MyMap fmap4;
+   fmap4 = fmap;
+   if(fmap4 != fmap || hash_value(fmap4) != hash_value(fmap))
+      return 1;
+
+   //Same elements built from a different range compare equal
+   vector<value_type> v(fm.rbegin(), fm.rend());
+   MyMap fmap5(ordered_unique_range, v.begin(), v.end());
+   if(fmap5 != fmap || hash_value(fmap5) != hash_value(fmap))
+      return 1;
+   fm.erase(fm.begin());
+   fm.insert(value_type(IntType(0), MappedType(1)));
+   MyMap fmap6(fm);
+   if(fmap6 == fmap || fmap6.size() != fmap.size())
+      return 1;
+   return 0;
+}
+
+template<class MySet>
+int frozen_hash_set_test()
+{
+   typedef typename MySet::value_type           IntType;
+
+   flat_set<IntType> fs;
+   std::set<int> sset;
+   for(int i = 0; i < 1000; ++i){
+      fs.insert(IntType(i*i));
+      sset.insert(i*i);
+   }
+   MySet fset(fs);
+   if(fset.size() != sset.size())
+      return 1;
+   for(typename MySet::const_iterator it = fset.cbegin(); it != fset.cend(); ++it){
+      if(!sset.count(it->get_int()) || fset.find(*it) != it)
+         return 1;
+   }
+   for(int i = 0; i < 1000*1000; i += 7){
+      if(fset.count(IntType(i)) != sset.count(i))
+         return 1;
+   }
+   MySet fset2(fs.begin(), fs.end());
+   if(fset2 != fset)
+      return 1;
+   return 0;
+}
+
+template<class VoidAllocator>
+int test_map_variants()
+{
+   typedef typename allocator_traits<VoidAllocator>::template portable_rebind_alloc
+      < std::pair<test::movable_int, test::movable_int> >::type MoveAlloc;
+   typedef typename allocator_traits<VoidAllocator>::template portable_rebind_alloc
+      < std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >::type MoveCopyAlloc;
+   typedef typename allocator_traits<VoidAllocator>::template portable_rebind_alloc
+      < std::pair<test::copyable_int, test::copyable_int> >::type CopyAlloc;
+   typedef typename allocator_traits<VoidAllocator>::template portable_rebind_alloc
+      < test::copyable_int >::type SetAlloc;
+
+   typedef frozen_hash_map< test::movable_int, test::movable_int
+                          , boost::hash<test::movable_int>, std::equal_to<test::movable_int>, MoveAlloc> MyMoveMap;
+   typedef frozen_hash_map< test::movable_and_copyable_int, test::movable_and_copyable_int
+                          , boost::hash<test::movable_and_copyable_int>
+                          , std::equal_to<test::movable_and_copyable_int>, MoveCopyAlloc> MyMoveCopyMap;
+   typedef frozen_hash_map< test::copyable_int, test::copyable_int
+                          , boost::hash<test::copyable_int>, std::equal_to<test::copyable_int>, CopyAlloc> MyCopyMap;
+   typedef frozen_hash_set< test::copyable_int
+                          , boost::hash<test::copyable_int>, std::equal_to<test::copyable_int>, SetAlloc> MyCopySet;
+
+   if (0 != frozen_hash_map_test<MyMoveMap>()){
+      std::cout << "Error in frozen_hash_map_test<MyMoveMap>" << std::endl;
+      return 1;
+   }
+   if (0 != frozen_hash_map_test<MyMoveCopyMap>()){
+      std::cout << "Error in frozen_hash_map_test<MyMoveCopyMap>" << std::endl;
+      return 1;
+   }
+   if (0 != frozen_hash_map_test<MyCopyMap>()){
+      std::cout << "Error in frozen_hash_map_test<MyCopyMap>" << std::endl;
+      return 1;
+   }
+   if (0 != frozen_hash_map_copyable_test<MyMoveCopyMap>()){
+      std::cout << "Error in frozen_hash_map_copyable_test<MyMoveCopyMap>" << std::endl;
+      return 1;
+   }
+   if (0 != frozen_hash_map_copyable_test<MyCopyMap>()){
+      std::cout << "Error in frozen_hash_map_copyable_test<MyCopyMap>" << std::endl;
+      return 1;
+   }
+   if (0 != frozen_hash_set_test<MyCopySet>()){
+      std::cout << "Error in frozen_hash_set_test<MyCopySet>" << std::endl;
+      return 1;
+   }
+   return 0;
+}
+
+int main()
+{
+   //Allocator argument container
+   {
+      frozen_hash_map<int, int> map_((frozen_hash_map<int, int>::allocator_type()));
+      frozen_hash_set<int> set_((frozen_hash_set<int>::allocator_type()));
+      if(!map_.empty() || map_.begin() != map_.end() || map_.count(0) || set_.find(0) != set_.end())
+         return 1;
+   }
+   //String keys
+   {
+      flat_map<string, int> fm;
+      for(int i = 0; i != 2000; ++i){
+         fm[string(std::size_t(i % 40 + 1), char('a' + i % 26)) + char('A' + i/26 % 26) + char('A' + i/676)] = i;
+      }
+      frozen_hash_map<string, int> fmap(fm);
+      if(fmap.size() != fm.size())
+         return 1;
+      for(flat_map<string, int>::const_iterator it = fm.begin(); it != fm.end(); ++it){
+         if(fmap.at(it->first) != it->second)
+            return 1;
+      }
+      if(fmap.count(string("not a key")) || fmap.count(string()))
+         return 1;
+   }
+   #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   {
+      frozen_hash_map<int, int> fmap = { {1, 1}, {2, 2}, {3, 3}, {1, 4} };
+      frozen_hash_set<int> fset = { 5, 6, 7, 5 };
+      if(fmap.size() != 3u || fmap.at(1) != 1 || fset.size() != 3u || !fset.count(7) || fset.count(4))
+         return 1;
+   }
+   #endif
+
+   ////////////////////////////////////
+   //    Testing allocator implementations
+   ////////////////////////////////////
+   //       std::allocator
+   if(test_map_variants< std::allocator<void> >()){
+      std::cerr << "test_map_variants< std::allocator<void> > failed" << std::endl;
+      return 1;
+   }
+   //       boost::container::allocator
+   if(test_map_variants< allocator<void> >()){
+      std::cerr << "test_map_variants< allocator<void> > failed" << std::endl;
+      return 1;
+   }
+   //       boost::container::node_allocator
+   if(test_map_variants< node_allocator<void> >()){
+      std::cerr << "test_map_variants< node_allocator<void> > failed" << std::endl;
+      return 1;
+   }
+   //       boost::container::adaptive_pool
+   if(test_map_variants< adaptive_pool<void> >()){
+      std::cerr << "test_map_variants< adaptive_pool<void> > failed" << std::endl;
+      return 1;
+   }
+
+   return 0;
+}
+
+#include <boost/container/detail/config_end.hpp>
@@ -0,0 +1,722 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2004-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/container/detail/config_begin.hpp>
+#include <set>
+#include <map>
+#include <vector>
+#include <boost/container/hash_set.hpp>
+#include <boost/container/hash_map.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/container/list.hpp>
+#include <boost/container/allocator.hpp>
+#include <boost/container/node_allocator.hpp>
+#include <boost/container/adaptive_pool.hpp>
+
+#include "movable_int.hpp"
+#include "dummy_test_allocator.hpp"
+#include "propagate_allocator_test.hpp"
+
+using namespace boost::container;
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+
+//hash_set
+template class hash_set
+   < test::movable_and_copyable_int
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , test::simple_allocator<test::movable_and_copyable_int>
+   >;
+
+template class hash_set
+   < test::movable_and_copyable_int
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , std::allocator<test::movable_and_copyable_int>
+   >;
+
+template class hash_set
+   < test::movable_and_copyable_int
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , node_allocator<test::movable_and_copyable_int>
+   >;
+
+//hash_multiset
+template class hash_multiset
+   < test::movable_and_copyable_int
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , std::allocator<test::movable_and_copyable_int>
+   >;
+
+template class hash_multiset
+   < test::movable_and_copyable_int
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , adaptive_pool<test::movable_and_copyable_int>
+   >;
+
+//hash_map
+template class hash_map
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , std::allocator<std::pair<const test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   >;
+
+template class hash_map
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , allocator<std::pair<const test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   >;
+
+//hash_multimap
+template class hash_multimap
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , node_allocator<std::pair<const test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   >;
+
+namespace container_detail {
+
+//Instantiate base class as previous instantiations don't instantiate inherited members
+template class hash_table
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , identity<test::movable_and_copyable_int>
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , std::allocator<test::movable_and_copyable_int>
+   >;
+
+template class hash_table
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , identity<test::movable_and_copyable_int>
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , allocator<test::movable_and_copyable_int>
+   >;
+
+template class hash_table
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , identity<test::movable_and_copyable_int>
+   , boost::hash<test::movable_and_copyable_int>
+   , std::equal_to<test::movable_and_copyable_int>
+   , node_allocator<test::movable_and_copyable_int>
+   >;
+
+}  //container_detail {
+
+}} //boost::container
+
+//Hash that sends every key to few buckets to stress collision handling
+struct bad_hash
+{
+   template<class T>
+   std::size_t operator()(const T &t) const
+   {  return boost::hash<T>()(t) % 3u;  }
+};
+
+//Counts live allocations to detect leaked nodes
+struct allocation_counter
+{
+   static std::size_t live;
+};
+
+std::size_t allocation_counter::live = 0u;
+
+template<class T>
+class counting_allocator
+{
+   public:
+   typedef T value_type;
+
+   counting_allocator()
+   {}
+
+   template<class U>
+   counting_allocator(const counting_allocator<U> &)
+   {}
+
+   T* allocate(std::size_t n)
+   {
+      T *const p = std::allocator<T>().allocate(n);
+      ++allocation_counter::live;
+      return p;
+   }
+
+   void deallocate(T*p, std::size_t n)
+   {
+      --allocation_counter::live;
+      std::allocator<T>().deallocate(p, n);
+   }
+
+   friend bool operator==(const counting_allocator &, const counting_allocator &)
+   {  return true;  }
+
+   friend bool operator!=(const counting_allocator &, const counting_allocator &)
+   {  return false;  }
+};
+
+//Equality predicate that throws on request
+struct throwing_equal_to
+{
+   static bool throw_now;
+
+   bool operator()(int a, int b) const
+   {
+      if(throw_now)
+         throw 0;
+      return a == b;
+   }
+};
+
+bool throwing_equal_to::throw_now = false;
+
+//Nodes built by single element insertions and emplacements must be freed if
+//the equality predicate throws while looking for their group
+int hash_multiset_equal_throw_test()
+{
+   typedef hash_multiset<int, boost::hash<int>, throwing_equal_to, counting_allocator<int> > multiset_t;
+   {
+      multiset_t ms;
+      ms.reserve(16u);
+      ms.insert(1);
+      const std::size_t live = allocation_counter::live;
+      const int one = 1;
+      throwing_equal_to::throw_now = true;
+      for(int i = 0; i != 3; ++i){
+         bool thrown = false;
+         BOOST_TRY{
+            switch(i){
+               case 0: ms.insert(one);  break;
+               case 1: ms.insert(1);    break;
+               default: ms.emplace(1);  break;
+            }
+         }
+         BOOST_CATCH(...){
+            thrown = true;
+         }
+         BOOST_CATCH_END
+         if(!thrown || ms.size() != 1u || allocation_counter::live != live){
+            throwing_equal_to::throw_now = false;
+            return 1;
+         }
+      }
+      throwing_equal_to::throw_now = false;
+      ms.insert(one);
+      if(ms.count(1) != 2u)
+         return 1;
+   }
+   return allocation_counter::live == 0u ? 0 : 1;
+}
+
+template<class C>
+void test_move()
+{
+   //Now test move semantics
+   C original;
+   original.emplace();
+   C move_ctor(boost::move(original));
+   C move_assign;
+   move_assign.emplace();
+   move_assign = boost::move(move_ctor);
+   move_assign.swap(original);
+}
+
+//Checks that the contents of the hash container are the same as in the
+//std multiset and that the bucket interface is consistent
+template<class HashCont, class StdCont>
+bool check_equal_contents(const HashCont &h, const StdCont &s)
+{
+   if(h.size() != s.size())
+      return false;
+   StdCont tmp;
+   std::size_t n = 0;
+   for(typename HashCont::const_iterator it = h.begin(), itend = h.end(); it != itend; ++it, ++n){
+      tmp.insert(it->get_int());
+   }
+   if(n != h.size() || tmp != s)
+      return false;
+   //Each element must be found in its bucket
+   std::size_t bucket_total = 0;
+   for(std::size_t b = 0, bmax = h.bucket_count(); b != bmax; ++b){
+      std::size_t cnt = 0;
+      for(typename HashCont::const_local_iterator it = h.begin(b), itend = h.end(b); it != itend; ++it, ++cnt){
+         if(h.bucket(*it) != b)
+            return false;
+      }
+      if(cnt != h.bucket_size(b))
+         return false;
+      bucket_total += cnt;
+   }
+   if(bucket_total != h.size())
+      return false;
+   if(h.bucket_count() && h.load_factor() > h.max_load_factor())
+      return false;
+   //Equivalent elements must be adjacent
+   for(typename StdCont::const_iterator it = s.begin(), itend = s.end(); it != itend; it = s.upper_bound(*it)){
+      typedef typename HashCont::value_type value_type;
+      std::pair<typename HashCont::const_iterator, typename HashCont::const_iterator> r = h.equal_range(value_type(*it));
+      std::size_t d = 0;
+      for(; r.first != r.second; ++r.first, ++d){
+         if(r.first->get_int() != *it)
+            return false;
+      }
+      if(d != s.count(*it) || d != h.count(value_type(*it)))
+         return false;
+   }
+   return true;
+}
+
+template<class MyHashMultiSet, class StdMultiSet>
+int hash_copy_test(const MyHashMultiSet &, const StdMultiSet &, container_detail::false_)
+{  return 0;  }
+
+template<class MyHashMultiSet, class StdMultiSet>
+int hash_copy_test(const MyHashMultiSet &hmset, const StdMultiSet &smset, container_detail::true_)
+{
+   //Copy, move and equality
+   MyHashMultiSet hmset2(hmset);
+   if(!(hmset2 == hmset) || hmset2 != hmset || !check_equal_contents(hmset2, smset))
+      return 1;
+   hmset2.erase(hmset2.begin());
+   if(hmset2 == hmset)
+      return 1;
+   hmset2 = hmset;
+   if(hmset2 != hmset)
+      return 1;
+   MyHashMultiSet hmset3(boost::move(hmset2));
+   if(!hmset2.empty() || hmset3 != hmset)
+      return 1;
+   //A rehashed container with the same elements still compares equal
+   hmset3.rehash(16u);
+   if(hmset3 != hmset)
+      return 1;
+   hmset2.swap(hmset3);
+   if(!hmset3.empty() || hmset2 != hmset || !check_equal_contents(hmset2, smset))
+      return 1;
+   return 0;
+}
+
+template<class MyHashSet, class MyHashMultiSet, bool Copyable>
+int hash_set_test()
+{
+   typedef typename MyHashSet::value_type IntType;
+   const int MaxElem = 200;
+   typedef std::multiset<int> MyStdMultiSet;
+
+   //Single insertion and lookup
+   {
+      MyHashSet hset;
+      MyHashMultiSet hmset;
+      MyStdMultiSet sset, smset;
+      if(hset.bucket_count() != 0 || !hset.empty())
+         return 1;
+      for(int i = 0; i < MaxElem; ++i){
+         IntType move_me(i/2);
+         bool inserted = hset.insert(boost::move(move_me)).second;
+         if(inserted != (i%2 == 0))
+            return 1;
+         if(inserted)
+            sset.insert(i/2);
+         IntType move_me2(i/2);
+         hmset.insert(boost::move(move_me2));
+         smset.insert(i/2);
+      }
+      if(!check_equal_contents(hset, sset) || !check_equal_contents(hmset, smset))
+         return 1;
+      for(int i = 0; i < MaxElem; ++i){
+         if((hset.find(IntType(i)) != hset.end()) != (i < MaxElem/2))
+            return 1;
+      }
+
+      //Erase by key
+      for(int i = 0; i < MaxElem/2; i += 3){
+         if(hset.erase(IntType(i)) != 1u || hmset.erase(IntType(i)) != 2u)
+            return 1;
+         sset.erase(i);
+         smset.erase(i);
+      }
+      if(hset.erase(IntType(MaxElem)) != 0)
+         return 1;
+      if(!check_equal_contents(hset, sset) || !check_equal_contents(hmset, smset))
+         return 1;
+
+      //Erase by iterator
+      while(!hset.empty()){
+         int v = hset.begin()->get_int();
+         hset.erase(hset.cbegin());
+         sset.erase(v);
+         if(!check_equal_contents(hset, sset))
+            return 1;
+      }
+
+      //Erase by range
+      typename MyHashMultiSet::iterator it = hmset.begin();
+      for(int i = 0; i < 10; ++i){
+         smset.erase(smset.find(it->get_int()));
+         ++it;
+      }
+      hmset.erase(hmset.begin(), it);
+      if(!check_equal_contents(hmset, smset))
+         return 1;
+      hmset.erase(hmset.begin(), hmset.end());
+      if(!hmset.empty())
+         return 1;
+   }
+
+   //Range insertion (bulk path for forward iterators) and input iterators
+   {
+      std::vector<int> src;
+      for(int i = 0; i < MaxElem; ++i){
+         src.push_back((i*7)%(MaxElem/4));
+      }
+      MyStdMultiSet sset(src.begin(), src.end()), smset(src.begin(), src.end());
+      //Remove duplicates
+      for(MyStdMultiSet::iterator sit = sset.begin(); sit != sset.end(); ){
+         MyStdMultiSet::iterator next = sset.upper_bound(*sit);
+         sset.erase(++sit, next);
+         sit = next;
+      }
+
+      boost::container::vector<IntType> vsrc;
+      boost::container::list<IntType> lsrc;
+      for(std::size_t i = 0; i < src.size(); ++i){
+         IntType move_me(src[i]);
+         vsrc.push_back(boost::move(move_me));
+         IntType move_me2(src[i]);
+         lsrc.push_back(boost::move(move_me2));
+      }
+
+      MyHashSet hset;
+      hset.insert(boost::make_move_iterator(vsrc.begin()), boost::make_move_iterator(vsrc.end()));
+      MyHashMultiSet hmset;
+      hmset.insert(boost::make_move_iterator(lsrc.begin()), boost::make_move_iterator(lsrc.end()));
+      if(!check_equal_contents(hset, sset) || !check_equal_contents(hmset, smset))
+         return 1;
+
+      //Insert again, nothing must be added to the unique container
+      boost::container::vector<IntType> vsrc2;
+      for(std::size_t i = 0; i < src.size(); ++i){
+         IntType move_me(src[i]);
+         vsrc2.push_back(boost::move(move_me));
+      }
+      hset.insert(boost::make_move_iterator(vsrc2.begin()), boost::make_move_iterator(vsrc2.end()));
+      if(!check_equal_contents(hset, sset))
+         return 1;
+
+      //Rehash and reserve must preserve contents
+      hset.rehash(1024u);
+      if(hset.bucket_count() < 1024u || !check_equal_contents(hset, sset))
+         return 1;
+      hset.rehash(0u);
+      if(!check_equal_contents(hset, sset))
+         return 1;
+      hmset.max_load_factor(0.5f);
+      hmset.reserve(MaxElem*4);
+      if(hmset.bucket_count() < MaxElem*8 || !check_equal_contents(hmset, smset))
+         return 1;
+
+      //Move and swap
+      MyHashMultiSet hmset2(boost::move(hmset));
+      if(!hmset.empty() || !check_equal_contents(hmset2, smset))
+         return 1;
+      hmset2.rehash(16u);
+      if(!check_equal_contents(hmset2, smset))
+         return 1;
+      hmset.swap(hmset2);
+      if(!hmset2.empty() || !check_equal_contents(hmset, smset))
+         return 1;
+      if(0 != hash_copy_test(hmset, smset, container_detail::bool_<Copyable>()))
+         return 1;
+      hmset2 = boost::move(hmset);
+      if(!check_equal_contents(hmset2, smset))
+         return 1;
+      hmset2.clear();
+      if(!hmset2.empty() || hmset2.begin() != hmset2.end())
+         return 1;
+      hmset2.insert(boost::make_move_iterator(vsrc.begin()), boost::make_move_iterator(vsrc.begin()));
+      if(!hmset2.empty())
+         return 1;
+   }
+
+   //Emplacement
+   {
+      MyHashSet hset;
+      MyHashMultiSet hmset;
+      for(int i = 0; i < MaxElem; ++i){
+         hset.emplace(i/4);
+         hset.emplace_hint(hset.begin(), i/4);
+         hmset.emplace(i/4);
+         hmset.emplace_hint(hmset.begin(), i/4);
+      }
+      if(hset.size() != std::size_t(MaxElem/4) || hmset.size() != std::size_t(MaxElem*2))
+         return 1;
+   }
+   return 0;
+}
+
+template<class MyHashMap, class MyHashMultiMap>
+int hash_map_test()
+{
+   typedef typename MyHashMap::key_type      IntType;
+   typedef typename MyHashMap::mapped_type   MappedType;
+   typedef typename MyHashMap::movable_value_type movable_value_type;
+   const int MaxElem = 100;
+
+   {
+      MyHashMap hmap;
+      MyHashMultiMap hmmap;
+      std::map<int, int> smap;
+      for(int i = 0; i < MaxElem; ++i){
+         IntType k(i);
+         MappedType v(i*2);
+         hmap[boost::move(k)] = boost::move(v);
+         smap[i] = i*2;
+         IntType k2(i % 10);
+         MappedType v2(i);
+         hmmap.insert(movable_value_type(boost::move(k2), boost::move(v2)));
+      }
+      if(hmap.size() != smap.size() || hmmap.size() != std::size_t(MaxElem))
+         return 1;
+      for(std::map<int, int>::const_iterator it = smap.begin(); it != smap.end(); ++it){
+         IntType k(it->first);
+         if(hmap.at(k).get_int() != it->second || hmap.find(k)->second.get_int() != it->second)
+            return 1;
+      }
+      for(int i = 0; i < 10; ++i){
+         if(hmmap.count(IntType(i)) != std::size_t(MaxElem/10))
+            return 1;
+         std::pair<typename MyHashMultiMap::iterator, typename MyHashMultiMap::iterator> r = hmmap.equal_range(IntType(i));
+         for(; r.first != r.second; ++r.first){
+            if(r.first->first.get_int() != i || r.first->second.get_int() % 10 != i)
+               return 1;
+         }
+      }
+      //Default constructed mapped value for new keys
+      IntType k(MaxElem);
+      if(hmap[boost::move(k)].get_int() != 0 || hmap.size() != std::size_t(MaxElem + 1))
+         return 1;
+      //Uniqueness
+      IntType k2(0);
+      MappedType v2(-1);
+      if(hmap.insert(movable_value_type(boost::move(k2), boost::move(v2))).second || hmap.at(IntType(0)).get_int() != 0)
+         return 1;
+      BOOST_TRY{
+         hmap.at(IntType(-1));
+         return 1;
+      }
+      BOOST_CATCH(std::out_of_range&){
+      }
+      BOOST_CATCH_END
+
+      MyHashMap hmap2(hmap);
+      if(hmap2 != hmap)
+         return 1;
+      hmap2[IntType(0)] = MappedType(1);
+      if(hmap2 == hmap)
+         return 1;
+      MyHashMultiMap hmmap2(boost::move(hmmap));
+      if(!hmmap.empty() || hmmap2.size() != std::size_t(MaxElem))
+         return 1;
+   }
+   return 0;
+}
+
+template<class VoidAllocator>
+struct GetAllocatorHash
+{
+   template<class ValueType>
+   struct apply
+   {
+      typedef hash_set < ValueType
+                       , boost::hash<ValueType>
+                       , std::equal_to<ValueType>
+                       , typename allocator_traits<VoidAllocator>
+                           ::template portable_rebind_alloc<ValueType>::type
+                       > set_type;
+
+      typedef hash_multiset < ValueType
+                       , bad_hash
+                       , std::equal_to<ValueType>
+                       , typename allocator_traits<VoidAllocator>
+                           ::template portable_rebind_alloc<ValueType>::type
+                       > multiset_type;
+
+      typedef hash_map < ValueType
+                       , ValueType
+                       , boost::hash<ValueType>
+                       , std::equal_to<ValueType>
+                       , typename allocator_traits<VoidAllocator>
+                           ::template portable_rebind_alloc<std::pair<const ValueType, ValueType> >::type
+                       > map_type;
+
+      typedef hash_multimap < ValueType
+                       , ValueType
+                       , bad_hash
+                       , std::equal_to<ValueType>
+                       , typename allocator_traits<VoidAllocator>
+                           ::template portable_rebind_alloc<std::pair<const ValueType, ValueType> >::type
+                       > multimap_type;
+   };
+};
+
+template<class VoidAllocator>
+int test_hash_variants()
+{
+   typedef typename GetAllocatorHash<VoidAllocator>::template apply<test::movable_int>::set_type           MyMoveSet;
+   typedef typename GetAllocatorHash<VoidAllocator>::template apply<test::movable_int>::multiset_type      MyMoveMultiSet;
+   typedef typename GetAllocatorHash<VoidAllocator>::template apply<test::movable_and_copyable_int>::set_type      MyCopyMoveSet;
+   typedef typename GetAllocatorHash<VoidAllocator>::template apply<test::movable_and_copyable_int>::multiset_type MyCopyMoveMultiSet;
+   typedef typename GetAllocatorHash<VoidAllocator>::template apply<test::copyable_int>::set_type          MyCopySet;
+   typedef typename GetAllocatorHash<VoidAllocator>::template apply<test::copyable_int>::multiset_type     MyCopyMultiSet;
+
+   typedef typename GetAllocatorHash<VoidAllocator>::template apply<test::movable_and_copyable_int>::map_type      MyCopyMoveMap;
+   typedef typename GetAllocatorHash<VoidAllocator>::template apply<test::movable_and_copyable_int>::multimap_type MyCopyMoveMultiMap;
+   typedef typename GetAllocatorHash<VoidAllocator>::template apply<test::copyable_int>::map_type          MyCopyMap;
+   typedef typename GetAllocatorHash<VoidAllocator>::template apply<test::copyable_int>::multimap_type     MyCopyMultiMap;
+
+   if(0 != hash_set_test<MyMoveSet, MyMoveMultiSet, false>()){
+      std::cout << "Error in hash_set_test<MyMoveSet>" << std::endl;
+      return 1;
+   }
+   if(0 != hash_set_test<MyCopyMoveSet, MyCopyMoveMultiSet, true>()){
+      std::cout << "Error in hash_set_test<MyCopyMoveSet>" << std::endl;
+      return 1;
+   }
+   if(0 != hash_set_test<MyCopySet, MyCopyMultiSet, true>()){
+      std::cout << "Error in hash_set_test<MyCopySet>" << std::endl;
+      return 1;
+   }
+   if(0 != hash_map_test<MyCopyMoveMap, MyCopyMoveMultiMap>()){
+      std::cout << "Error in hash_map_test<MyCopyMoveMap>" << std::endl;
+      return 1;
+   }
+   if(0 != hash_map_test<MyCopyMap, MyCopyMultiMap>()){
+      std::cout << "Error in hash_map_test<MyCopyMap>" << std::endl;
+      return 1;
+   }
+   return 0;
+}
+
+struct boost_container_hash_set;
+struct boost_container_hash_multimap;
+
+namespace boost {
+namespace container {
+namespace test {
+
+template<>
+struct alloc_propagate_base<boost_container_hash_set>
+{
+   template <class T, class Allocator>
+   struct apply
+   {
+      typedef boost::container::hash_set<T, boost::hash<T>, std::equal_to<T>, Allocator> type;
+   };
+};
+
+template<>
+struct alloc_propagate_base<boost_container_hash_multimap>
+{
+   template <class T, class Allocator>
+   struct apply
+   {
+      typedef typename boost::container::allocator_traits<Allocator>::
+         template portable_rebind_alloc<std::pair<const T, T> >::type TypeAllocator;
+      typedef boost::container::hash_multimap<T, T, boost::hash<T>, std::equal_to<T>, TypeAllocator> type;
+   };
+};
+
+}}}   //boost::container::test
+
+int main ()
+{
+   //Allocator argument container
+   {
+      hash_set<int> set_((hash_set<int>::allocator_type()));
+      hash_multiset<int> multiset_((hash_multiset<int>::allocator_type()));
+      hash_map<int, int> map_((hash_map<int, int>::allocator_type()));
+      hash_multimap<int, int> multimap_((hash_multimap<int, int>::allocator_type()));
+   }
+   //Now test move semantics
+   {
+      test_move<hash_set<int> >();
+      test_move<hash_multiset<int> >();
+      test_move<hash_map<int, int> >();
+      test_move<hash_multimap<int, int> >();
+   }
+
+   ////////////////////////////////////
+   //    Testing allocator implementations
+   ////////////////////////////////////
+   //       std:allocator
+   if(test_hash_variants< std::allocator<void> >()){
+      std::cerr << "test_hash_variants< std::allocator<void> > failed" << std::endl;
+      return 1;
+   }
+   //       boost::container::allocator
+   if(test_hash_variants< allocator<void> >()){
+      std::cerr << "test_hash_variants< allocator<void> > failed" << std::endl;
+      return 1;
+   }
+   //       boost::container::node_allocator
+   if(test_hash_variants< node_allocator<void> >()){
+      std::cerr << "test_hash_variants< node_allocator<void> > failed" << std::endl;
+      return 1;
+   }
+   //       boost::container::adaptive_pool
+   if(test_hash_variants< adaptive_pool<void> >()){
+      std::cerr << "test_hash_variants< adaptive_pool<void> > failed" << std::endl;
+      return 1;
+   }
+
+   ////////////////////////////////////
+   //    Allocator propagation testing
+   ////////////////////////////////////
+   if(!boost::container::test::test_propagate_allocator<boost_container_hash_set>())
+      return 1;
+
+   if(!boost::container::test::test_propagate_allocator<boost_container_hash_multimap>())
+      return 1;
+
+   if(hash_multiset_equal_throw_test()){
+      std::cerr << "hash_multiset_equal_throw_test failed" << std::endl;
+      return 1;
+   }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   {
+      hash_set<int> s = { 1, 2, 3, 2, 1 };
+      hash_multiset<int> ms = { 1, 2, 3, 2, 1 };
+      if(s.size() != 3u || ms.size() != 5u || ms.count(2) != 2u)
+         return 1;
+      s = { 4, 5 };
+      if(s.size() != 2u || s.count(1) != 0u)
+         return 1;
+   }
+#endif
+
+   return 0;
+}
+
+#include <boost/container/detail/config_end.hpp>
@@ -0,0 +1,279 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/container/deque.hpp>
+#include <boost/container/list.hpp>
+#include <boost/container/slist.hpp>
+#include <boost/container/stable_vector.hpp>
+#include <boost/container/static_vector.hpp>
+#include <boost/container/small_vector.hpp>
+#include <boost/container/string.hpp>
+#include <boost/container/set.hpp>
+#include <boost/container/map.hpp>
+#include <boost/container/flat_set.hpp>
+#include <boost/container/flat_map.hpp>
+#include <boost/container/hash_set.hpp>
+#include <boost/container/hash_map.hpp>
+#include <boost/container/flat_hash_set.hpp>
+#include <boost/container/flat_hash_map.hpp>
+#include <boost/container/detail/hash.hpp>
+
+#include <cstring>
+
+using namespace boost::container;
+
+//Equal containers must have equal hash values with boost::hash and std::hash
+template<class C>
+bool check_equal_hash(const C &a, const C &b)
+{
+   if(!(a == b) || ::boost::hash<C>()(a) != ::boost::hash<C>()(b) || hash_value(a) != ::boost::hash<C>()(a))
+      return false;
+   #if defined(BOOST_CONTAINER_HAS_STD_HASH)
+   if(std::hash<C>()(a) != ::boost::hash<C>()(a) || std::hash<C>()(b) != std::hash<C>()(a))
+      return false;
+   #endif
+   return true;
+}
+
+//Different containers should hash differently (the values used by the tests don't collide)
+template<class C>
+bool check_different_hash(const C &a, const C &b)
+{
+   return !(a == b) && ::boost::hash<C>()(a) != ::boost::hash<C>()(b);
+}
+
+bool test_hash_bytes()
+{
+   unsigned char model[256];
+   for(std::size_t i = 0; i != sizeof(model); ++i){
+      model[i] = static_cast<unsigned char>(i*37u + 11u);
+   }
+   //Exercise short inputs, the 16 byte loop and the 48 byte loop
+   for(std::size_t len = 0; len != 200u; ++len){
+      const std::size_t h = container_detail::hash_bytes(model, len);
+      //The result must not depend on the alignment of the input
+      for(std::size_t off = 1; off != 8u; ++off){
+         unsigned char buf[256 + 8];
+         std::memcpy(buf + off, model, len);
+         if(container_detail::hash_bytes(buf + off, len) != h)
+            return false;
+      }
+      //Every byte contributes to the hash value
+      for(std::size_t i = 0; i != len; ++i){
+         unsigned char buf[256];
+         std::memcpy(buf, model, len);
+         buf[i] ^= 1u;
+         if(container_detail::hash_bytes(buf, len) == h)
+            return false;
+      }
+      //Length is part of the hash value
+      if(len && container_detail::hash_bytes(model, len - 1u) == h)
+         return false;
+   }
+   return true;
+}
+
+template<class T>
+struct value_maker
+{
+   static T make(int i)
+   {  return T(i);  }
+};
+
+template<>
+struct value_maker<string>
+{
+   static string make(int i)
+   {  return string(std::size_t(i % 50), char('a' + i % 26));  }
+};
+
+template<class C>
+bool test_sequence()
+{
+   typedef value_maker<typename C::value_type> maker;
+   C a, b;
+   for(int i = 0; i != 100; ++i){
+      a.insert(a.end(), maker::make(i));
+   }
+   for(int i = 99; i >= 0; --i){
+      b.insert(b.begin(), maker::make(i));
+   }
+   if(!check_equal_hash(a, b) || !check_equal_hash(C(), C()))
+      return false;
+   *b.begin() = maker::make(101);
+   if(!check_different_hash(a, b))
+      return false;
+   C c(a);
+   c.erase(c.begin());
+   return check_different_hash(a, c);
+}
+
+template<class C>
+bool test_ordered_set()
+{
+   C a, b;
+   for(int i = 0; i != 100; ++i){
+      a.insert(typename C::value_type(i));
+      b.insert(typename C::value_type(99 - i));
+   }
+   if(!check_equal_hash(a, b))
+      return false;
+   b.erase(b.begin());
+   return check_different_hash(a, b);
+}
+
+template<class C>
+bool test_map()
+{
+   C a, b;
+   for(int i = 0; i != 100; ++i){
+      a.insert(typename C::value_type(i, -i));
+      b.insert(typename C::value_type(99 - i, i - 99));
+   }
+   if(!check_equal_hash(a, b))
+      return false;
+   C c;
+   for(int i = 0; i != 100; ++i){
+      c.insert(typename C::value_type(i, i == 50 ? 0 : -i));
+   }
+   return check_different_hash(a, c);
+}
+
+template<class C>
+bool test_unordered_set()
+{
+   C a, b;
+   for(int i = 0; i != 300; ++i){
+      a.insert(typename C::value_type(i));
+   }
+   //Different insertion order and bucket count
+   b.rehash(2000u);
+   for(int i = 299; i >= 0; --i){
+      b.insert(typename C::value_type(i));
+   }
+   if(!check_equal_hash(a, b))
+      return false;
+   b.erase(typename C::value_type(0));
+   b.insert(typename C::value_type(300));
+   return check_different_hash(a, b);
+}
+
+int main()
+{
+   if(!test_hash_bytes())
+      return 1;
+
+   //Contiguous ranges of trivial types are hashed as raw memory
+   if(!test_sequence< vector<int> >())
+      return 1;
+   if(!test_sequence< vector<string> >())
+      return 1;
+   if(!test_sequence< static_vector<int, 100> >())
+      return 1;
+   if(!test_sequence< small_vector<int, 10> >())
+      return 1;
+   if(!test_sequence< deque<int> >())
+      return 1;
+   if(!test_sequence< list<int> >())
+      return 1;
+   if(!test_sequence< stable_vector<int> >())
+      return 1;
+   {
+      slist<int> a, b;
+      for(int i = 0; i != 100; ++i){
+         a.push_front(i);
+      }
+      for(int i = 0; i != 100; ++i){
+         b.push_front(99 - i);
+      }
+      b.reverse();
+      if(!check_equal_hash(a, b))
+         return 1;
+      b.front() = -1;
+      if(!check_different_hash(a, b))
+         return 1;
+   }
+
+   //Strings
+   {
+      string a("a string long enough to avoid the short string optimization");
+      string b;
+      b.reserve(1000u);
+      b.assign(a.begin(), a.end());
+      if(!check_equal_hash(a, b))
+         return 1;
+      b[10] = 'X';
+      if(!check_different_hash(a, b))
+         return 1;
+      wstring wa(L"wide"), wb(L"wide");
+      if(!check_equal_hash(wa, wb))
+         return 1;
+      if(!check_different_hash(string("ab"), string("ba")))
+         return 1;
+   }
+
+   //Ordered associative containers
+   if(!test_ordered_set< set<int> >())
+      return 1;
+   if(!test_ordered_set< multiset<int> >())
+      return 1;
+   if(!test_ordered_set< flat_set<int> >())
+      return 1;
+   if(!test_ordered_set< flat_multiset<int> >())
+      return 1;
+   if(!test_map< map<int, int> >())
+      return 1;
+   if(!test_map< multimap<int, int> >())
+      return 1;
+   if(!test_map< flat_map<int, int> >())
+      return 1;
+   if(!test_map< flat_multimap<int, int> >())
+      return 1;
+
+   //Unordered containers hash independently of the iteration order
+   if(!test_unordered_set< hash_set<int> >())
+      return 1;
+   if(!test_unordered_set< hash_multiset<int> >())
+      return 1;
+   if(!test_unordered_set< flat_hash_set<int> >())
+      return 1;
+   {
+      hash_map<int, int> a, b;
+      flat_hash_map<int, int> fa, fb;
+      for(int i = 0; i != 300; ++i){
+         a.insert(hash_map<int, int>::value_type(i, -i));
+         b.insert(hash_map<int, int>::value_type(299 - i, i - 299));
+         fa.insert(flat_hash_map<int, int>::value_type(i, -i));
+         fb.insert(flat_hash_map<int, int>::value_type(299 - i, i - 299));
+      }
+      if(!check_equal_hash(a, b) || !check_equal_hash(fa, fb))
+         return 1;
+      b[0] = 1;
+      fb[0] = 1;
+      if(!check_different_hash(a, b) || !check_different_hash(fa, fb))
+         return 1;
+   }
+
+   //Composite keys
+   {
+      flat_hash_set< vector<int> > s;
+      for(int i = 0; i != 100; ++i){
+         s.insert(vector<int>(std::size_t(i), i));
+      }
+      if(s.size() != 100u || !s.count(vector<int>(10u, 10)) || s.count(vector<int>(10u, 11)))
+         return 1;
+   }
+
+   return 0;
+}
+
+#include <boost/container/detail/config_end.hpp>
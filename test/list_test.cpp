@@ -10,6 +10,7 @@
 
 #include <boost/container/detail/config_begin.hpp>
 #include <boost/container/list.hpp>
+#include <boost/container/options.hpp>
 #include <boost/container/allocator.hpp>
 #include <boost/container/node_allocator.hpp>
 #include <boost/container/adaptive_pool.hpp>
@@ -19,6 +20,7 @@
 #include "movable_int.hpp"
 #include "list_test.hpp"
 #include "propagate_allocator_test.hpp"
+#include "container_common_tests.hpp"
 #include "emplace_test.hpp"
 #include "../../intrusive/test/iterator_test.hpp"
 
@@ -52,6 +54,11 @@ template class boost::container::list
    < test::movable_and_copyable_int
    , node_allocator<test::movable_and_copyable_int> >;
 
+template class boost::container::list
+   < test::movable_and_copyable_int
+   , std::allocator<test::movable_and_copyable_int>
+   , list_options< private_node_pool<16u> >::type >;
+
 namespace container_detail {
 
 template class iterator_from_iiterator
@@ -207,6 +214,21 @@ int main ()
       return 1;
    }
 
+   ////////////////////////////////////
+   //    Private node pool testing
+   ////////////////////////////////////
+   {
+      typedef list_options< private_node_pool<16u> >::type pool_options_t;
+      if(!test::test_private_node_pool_list< list<int, std::allocator<int>, pool_options_t> >()){
+         std::cerr << "test_private_node_pool_list< std::allocator<int> > failed" << std::endl;
+         return 1;
+      }
+      if(!test::test_private_node_pool_list< list<test::movable_and_copyable_int, node_allocator<test::movable_and_copyable_int>, pool_options_t> >()){
+         std::cerr << "test_private_node_pool_list< node_allocator<movable_and_copyable_int> > failed" << std::endl;
+         return 1;
+      }
+   }
+
    ////////////////////////////////////
    //    Emplace testing
    ////////////////////////////////////
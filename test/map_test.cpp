@@ -21,6 +21,7 @@
 #include "map_test.hpp"
 #include "propagate_allocator_test.hpp"
 #include "emplace_test.hpp"
+#include "container_common_tests.hpp"
 #include "../../intrusive/test/iterator_test.hpp"
 
 using namespace boost::container;
@@ -236,6 +237,103 @@ void test_move()
    move_assign.swap(original);
 }
 
+template<boost::container::tree_type_enum tree_type_value>
+bool test_node_handle()
+{
+   typedef test::movable_int mapped_t;
+   typedef std::pair<const int, mapped_t> value_t;
+   typedef typename tree_assoc_options< tree_type<tree_type_value> >::type options_t;
+   typedef map<int, mapped_t, std::less<int>, std::allocator<value_t>, options_t>         map_t;
+   typedef map<int, mapped_t, std::greater<int>, std::allocator<value_t>, options_t>      greater_map_t;
+   typedef multimap<int, mapped_t, std::less<int>, std::allocator<value_t>, options_t>    multimap_t;
+
+   map_t m;
+   for(int i = 0; i != 10; ++i){
+      m.emplace(i, i);
+   }
+   //Extraction, the key can be modified
+   typename map_t::node_type nh(m.extract(3));
+   if(nh.empty() || nh.key() != 3 || nh.mapped().get_int() != 3 || nh.value().first != 3 || m.size() != 9u)
+      return false;
+   nh.key() = 30;
+   typename map_t::insert_return_type r(m.insert(boost::move(nh)));
+   if(!r.inserted || r.position->first != 30 || r.position->second.get_int() != 3 || !r.node.empty() || m.count(3))
+      return false;
+   //Failed insertion returns the node
+   nh = m.extract(m.begin());
+   m.emplace(0, 100);
+   r = m.insert(boost::move(nh));
+   if(r.inserted || r.position->second.get_int() != 100 || r.node.empty() || r.node.mapped().get_int() != 0)
+      return false;
+   typename map_t::node_type empty_nh;
+   r = m.insert(boost::move(empty_nh));
+   if(r.inserted || r.position != m.end())
+      return false;
+   //Hinted insertion and multimap compatible node handles
+   multimap_t mm;
+   mm.emplace(1, 1);
+   nh = m.extract(1);
+   mm.insert(boost::move(nh));
+   if(mm.count(1) != 2u || m.count(1))
+      return false;
+   nh = mm.extract(mm.begin());
+   typename map_t::iterator it = m.insert(m.end(), boost::move(nh));
+   if(it->first != 1 || it->second.get_int() != 1 || mm.size() != 1u)
+      return false;
+   nh = m.extract(9);
+   typename multimap_t::iterator mit = mm.insert(mm.end(), boost::move(nh));
+   if(mit->first != 9 || mit->second.get_int() != 9 || mm.size() != 2u)
+      return false;
+
+   //Merge
+   greater_map_t gm;
+   gm.emplace(1, 1);
+   gm.emplace(40, 40);
+   m.merge(gm);
+   if(gm.size() != 1u || gm.begin()->first != 1 || m.count(40) != 1u)
+      return false;
+   const typename map_t::size_type m_size = m.size();
+   m.merge(mm);
+   if(mm.size() != 1u || m.size() != m_size + 1u || m.find(9)->second.get_int() != 9)
+      return false;
+   mm.merge(m);
+   if(!m.empty() || mm.size() != m_size + 2u || mm.count(1) != 2u)
+      return false;
+   return true;
+}
+
+template<boost::container::tree_type_enum tree_type_value>
+bool test_order_statistics()
+{
+   typedef typename tree_assoc_options
+      < tree_type<tree_type_value>, order_statistics<true> >::type options_t;
+   typedef map<int, int, std::less<int>, std::allocator<std::pair<const int, int> >, options_t> map_t;
+
+   //Keys 0, 3, 6... inserted out of order
+   map_t m;
+   for(int i = 0; i != 100; ++i){
+      const int k = (i*37) % 100;
+      m[3*k] = k;
+   }
+   for(int i = 0; i != 100; ++i){
+      typename map_t::iterator it = m.nth(typename map_t::size_type(i));
+      if(it->first != 3*i || m.index_of(it) != typename map_t::size_type(i))
+         return false;
+      //Rank of a key not present
+      if(m.index_of(m.lower_bound(3*i + 1)) != typename map_t::size_type(i + 1))
+         return false;
+   }
+   //Erase odd keys
+   for(int i = 0; i != 100; i += 2){
+      m.erase(3*(i + 1));
+   }
+   for(int i = 0; i != 50; ++i){
+      if(m.nth(typename map_t::size_type(i))->first != 6*i)
+         return false;
+   }
+   return m.nth(m.size()) == m.end() && m.index_of(m.end()) == m.size();
+}
+
 template<class VoidAllocator, boost::container::tree_type_enum tree_type_value>
 struct GetAllocatorMap
 {
@@ -368,6 +466,27 @@ int main ()
       test_move<multimap<recursive_multimap, recursive_multimap> >();
    }
 
+   ////////////////////////////////////
+   //    Heterogeneous lookup testing
+   ////////////////////////////////////
+   {
+      typedef boost::container::test::transparent_key   key_t;
+      typedef boost::container::test::transparent_less  less_t;
+      typedef map<key_t, int, less_t>        map_t;
+      typedef multimap<key_t, int, less_t>   multimap_t;
+      map_t map_;
+      multimap_t multimap_;
+      for(int i = 0; i != 10; i += 2){
+         map_.insert(map_t::value_type(key_t(i), i));
+         multimap_.insert(multimap_t::value_type(key_t(i), i));
+         multimap_.insert(multimap_t::value_type(key_t(i), i));
+      }
+      if(!boost::container::test::test_heterogeneous_lookup(map_))
+         return 1;
+      if(!boost::container::test::test_heterogeneous_lookup(multimap_))
+         return 1;
+   }
+
    ////////////////////////////////////
    //    Testing allocator implementations
    ////////////////////////////////////
@@ -410,6 +529,29 @@ int main ()
       std::cerr << "test_map_variants< std::allocator<void>, splay_tree > failed" << std::endl;
       return 1;
    }
+   //    B-TREE
+   if(test_map_variants< std::allocator<void>, btree >()){
+      std::cerr << "test_map_variants< std::allocator<void>, btree > failed" << std::endl;
+      return 1;
+   }
+
+   ////////////////////////////////////
+   //    Node handle and merge testing
+   ////////////////////////////////////
+   if(!test_node_handle<red_black_tree>())
+      return 1;
+   if(!test_node_handle<avl_tree>())
+      return 1;
+   if(!test_node_handle<btree>())
+      return 1;
+
+   ////////////////////////////////////
+   //    Order statistics testing
+   ////////////////////////////////////
+   if(!test_order_statistics<red_black_tree>())
+      return 1;
+   if(!test_order_statistics<avl_tree>())
+      return 1;
 
    ////////////////////////////////////
    //    Emplace testing
@@ -14,6 +14,7 @@
 #include <boost/container/detail/config_begin.hpp>
 #include "check_equal_containers.hpp"
 #include "print_container.hpp"
+#include "container_common_tests.hpp"
 #include <boost/container/detail/pair.hpp>
 #include <boost/move/iterator.hpp>
 #include <boost/move/utility_core.hpp>
@@ -655,6 +656,12 @@ int map_test()
          if(boostmultimap.count(IntType(i)) != typename MyBoostMultiMap::size_type(j+1))
             return 1;
       }
+
+      if(!boost::container::test::test_find_batch(boostmap, 100) ||
+         !boost::container::test::test_find_batch(boostmultimap, 100)){
+         std::cout << "Error in find_batch" << std::endl;
+         return 1;
+      }
    }
 
    if(map_test_copyable<MyBoostMap, MyStdMap, MyBoostMultiMap, MyStdMultiMap>
@@ -0,0 +1,206 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/config.hpp>
+#include <iostream>
+
+#if defined(BOOST_HAS_UNISTD_H)
+
+#include <boost/container/mmap_allocator.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/container/devector.hpp>
+#include <boost/container/is_trivially_relocatable.hpp>
+
+#include <boost/static_assert.hpp>
+#include "movable_int.hpp"
+#include "vector_test.hpp"
+
+using namespace boost::container;
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+template class mmap_allocator<int>;
+
+template class mmap_allocator<test::movable_and_copyable_int, mmap_prefault>;
+
+template class boost::container::vector
+   < test::movable_and_copyable_int
+   , mmap_allocator<test::movable_and_copyable_int> >;
+
+template class boost::container::devector
+   < test::movable_and_copyable_int
+   , mmap_allocator<test::movable_and_copyable_int> >;
+
+}}
+
+BOOST_STATIC_ASSERT(( is_trivially_relocatable< vector<int, mmap_allocator<int> > >::value ));
+
+template<class VoidAllocator>
+struct GetAllocatorCont
+{
+   template<class ValueType>
+   struct apply
+   {
+      typedef vector< ValueType
+                    , typename allocator_traits<VoidAllocator>
+                        ::template portable_rebind_alloc<ValueType>::type
+                    > type;
+   };
+};
+
+template<class VoidAllocator>
+int test_cont_variants()
+{
+   typedef typename GetAllocatorCont<VoidAllocator>::template apply<int>::type MyCont;
+   typedef typename GetAllocatorCont<VoidAllocator>::template apply<test::movable_int>::type MyMoveCont;
+   typedef typename GetAllocatorCont<VoidAllocator>::template apply<test::movable_and_copyable_int>::type MyCopyMoveCont;
+   typedef typename GetAllocatorCont<VoidAllocator>::template apply<test::copyable_int>::type MyCopyCont;
+
+   if(test::vector_test<MyCont>())
+      return 1;
+   if(test::vector_test<MyMoveCont>())
+      return 1;
+   if(test::vector_test<MyCopyMoveCont>())
+      return 1;
+   if(test::vector_test<MyCopyCont>())
+      return 1;
+   return 0;
+}
+
+//Grows a vector well beyond the mmap threshold checking the elements
+//and that the buffer is expanded in place while the reservation lasts
+template<class Vector>
+bool test_expand_in_place()
+{
+   typedef typename Vector::value_type IntType;
+   Vector v;
+   //Force a mapped block
+   v.reserve(100000u);
+   const IntType *const data = v.data();
+   const std::size_t reserve_factor = MmapAlloc_reserve_factor;
+   const std::size_t n_in_place = reserve_factor > 1u ? 1000000u : 100000u;
+   for(std::size_t i = 0; i != n_in_place; ++i){
+      v.push_back(IntType(int(i)));
+   }
+   if(v.data() != data)
+      return false;
+   //Beyond the reservation the block is expanded or reallocated
+   for(std::size_t i = n_in_place; i != 4u*n_in_place; ++i){
+      v.push_back(IntType(int(i)));
+   }
+   for(std::size_t i = 0; i != v.size(); ++i){
+      if(!(v[i] == int(i)))
+         return false;
+   }
+   //Pages of the tail are returned but the elements are kept
+   v.resize(1000u);
+   v.shrink_to_fit();
+   if(v.capacity() < 1000u || v.capacity() >= 2u*n_in_place)
+      return false;
+   for(std::size_t i = 0; i != v.size(); ++i){
+      if(!(v[i] == int(i)))
+         return false;
+   }
+   //The freed pages can be used again
+   v.resize(n_in_place);
+   for(std::size_t i = 1000u; i != v.size(); ++i){
+      if(!(v[i] == 0))
+         return false;
+   }
+   return true;
+}
+
+//devector expands the buffer in place when it grows at the back
+bool test_devector()
+{
+   typedef devector<int, mmap_allocator<int> > devector_t;
+   devector_t d;
+   for(int i = 0; i != 200000; ++i){
+      if(i % 3)
+         d.push_back(i);
+      else
+         d.push_front(-i);
+   }
+   int expected_front = -199998;
+   for(int i = 0; i != 1000; ++i){
+      if(d.front() != expected_front)
+         return false;
+      d.pop_front();
+      expected_front += 3;
+   }
+   return d.size() == 199000u;
+}
+
+int main()
+{
+   //Stateless allocators always compare equal
+   {
+      mmap_allocator<int> a;
+      mmap_allocator<void> vd(a);
+      mmap_allocator<char> c(vd);
+      if(!(a == mmap_allocator<int>(c)) || a != mmap_allocator<int>())
+         return 1;
+   }
+
+   ////////////////////////////////////
+   //    Testing allocator flags
+   ////////////////////////////////////
+   if(test_cont_variants< mmap_allocator<void> >()){
+      std::cerr << "test_cont_variants< mmap_allocator<void> > failed" << std::endl;
+      return 1;
+   }
+   if(test_cont_variants< mmap_allocator<void, 0u> >()){
+      std::cerr << "test_cont_variants< mmap_allocator<void, 0u> > failed" << std::endl;
+      return 1;
+   }
+
+   ////////////////////////////////////
+   //    In place expansion test
+   ////////////////////////////////////
+   if(!test_expand_in_place< vector<int, mmap_allocator<int> > >()){
+      std::cerr << "test_expand_in_place< mmap_allocator<int> > failed" << std::endl;
+      return 1;
+   }
+   if(!test_expand_in_place< vector<int, mmap_allocator<int, 0u> > >()){
+      std::cerr << "test_expand_in_place< mmap_allocator<int, 0u> > failed" << std::endl;
+      return 1;
+   }
+   if(!test_expand_in_place< vector<int, mmap_allocator<int, mmap_huge_pages | mmap_populate> > >()){
+      std::cerr << "test_expand_in_place< mmap_allocator<int, mmap_huge_pages | mmap_populate> > failed" << std::endl;
+      return 1;
+   }
+   if(!test_expand_in_place< vector<test::movable_int, mmap_allocator<test::movable_int, mmap_prefault> > >()){
+      std::cerr << "test_expand_in_place< mmap_allocator<test::movable_int, mmap_prefault> > failed" << std::endl;
+      return 1;
+   }
+
+   ////////////////////////////////////
+   //    devector test
+   ////////////////////////////////////
+   if(!test_devector()){
+      std::cerr << "test_devector failed" << std::endl;
+      return 1;
+   }
+   return 0;
+}
+
+#else
+
+int main()
+{
+   std::cout << "mmap_allocator is not available in this platform" << std::endl;
+   return 0;
+}
+
+#endif   //#if defined(BOOST_HAS_UNISTD_H)
+
+#include <boost/container/detail/config_end.hpp>
@@ -16,6 +16,7 @@
 #include <boost/move/utility_core.hpp>
 #include <ostream>
 #include <climits>
+#include <cstddef>
 #include <boost/assert.hpp>
 
 namespace boost {
@@ -97,6 +98,9 @@ class movable_int
    friend bool operator==(int l, const movable_int &r)
    {  return l == r.get_int();   }
 
+   friend std::size_t hash_value(const movable_int &v)
+   {  return std::size_t(v.get_int());  }
+
    private:
    int m_int;
 };
@@ -193,6 +197,9 @@ class movable_and_copyable_int
    friend bool operator==(int l, const movable_and_copyable_int &r)
    {  return l == r.get_int();   }
 
+   friend std::size_t hash_value(const movable_and_copyable_int &v)
+   {  return std::size_t(v.get_int());  }
+
    private:
    int m_int;
 };
@@ -280,6 +287,9 @@ class copyable_int
    friend bool operator==(int l, const copyable_int &r)
    {  return l == r.get_int();   }
 
+   friend std::size_t hash_value(const copyable_int &v)
+   {  return std::size_t(v.get_int());  }
+
    private:
    int m_int;
 };
@@ -9,6 +9,8 @@
 //////////////////////////////////////////////////////////////////////////////
 #include <boost/container/detail/config_begin.hpp>
 #include <set>
+#include <vector>
+#include <algorithm>
 #include <boost/container/set.hpp>
 #include <boost/container/allocator.hpp>
 #include <boost/container/node_allocator.hpp>
@@ -20,6 +22,7 @@
 #include "set_test.hpp"
 #include "propagate_allocator_test.hpp"
 #include "emplace_test.hpp"
+#include "container_common_tests.hpp"
 #include "../../intrusive/test/iterator_test.hpp"
 
 using namespace boost::container;
@@ -103,6 +106,36 @@ template class multiset
    , node_allocator<test::movable_and_copyable_int>
    >;
 
+//B-tree based set and multiset
+template class set
+   < test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , test::simple_allocator<test::movable_and_copyable_int>
+   , tree_assoc_options< tree_type<btree> >::type
+   >;
+
+template class multiset
+   < test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , test::simple_allocator<test::movable_and_copyable_int>
+   , tree_assoc_options< tree_type<btree> >::type
+   >;
+
+//Sets with a private node pool
+template class set
+   < test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , std::allocator<test::movable_and_copyable_int>
+   , tree_assoc_options< private_node_pool<32u> >::type
+   >;
+
+template class multiset
+   < test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , node_allocator<test::movable_and_copyable_int>
+   , tree_assoc_options< tree_type<avl_tree>, private_node_pool<32u> >::type
+   >;
+
 namespace container_detail {
 
 //Instantiate base class as previous instantiations don't instantiate inherited members
@@ -160,6 +193,34 @@ template class tree
    , tree_assoc_defaults
    >;
 
+template class tree
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , identity<test::movable_and_copyable_int>
+   , std::less<test::movable_and_copyable_int>
+   , test::simple_allocator<test::movable_and_copyable_int>
+   , tree_assoc_options< tree_type<btree> >::type
+   >;
+
+//Trees keeping order statistics
+template class tree
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , identity<test::movable_and_copyable_int>
+   , std::less<test::movable_and_copyable_int>
+   , node_allocator<test::movable_and_copyable_int>
+   , tree_assoc_options< order_statistics<true> >::type
+   >;
+
+template class tree
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , identity<test::movable_and_copyable_int>
+   , std::less<test::movable_and_copyable_int>
+   , std::allocator<test::movable_and_copyable_int>
+   , tree_assoc_options< tree_type<avl_tree>, order_statistics<true> >::type
+   >;
+
 }  //container_detail {
 
 }} //boost::container
@@ -213,6 +274,200 @@ void test_move()
    move_assign.swap(original);
 }
 
+template<boost::container::tree_type_enum tree_type_value>
+bool test_node_handle()
+{
+   typedef typename tree_assoc_options< tree_type<tree_type_value> >::type options_t;
+   typedef set<int, std::less<int>, std::allocator<int>, options_t>        set_t;
+   typedef set<int, std::greater<int>, std::allocator<int>, options_t>     greater_set_t;
+   typedef multiset<int, std::less<int>, std::allocator<int>, options_t>   multiset_t;
+
+   set_t s;
+   for(int i = 0; i != 10; ++i){
+      s.insert(i);
+   }
+   //Extraction
+   typename set_t::node_type nh(s.extract(3));
+   if(nh.empty() || !nh || nh.value() != 3 || s.size() != 9u || s.count(3))
+      return false;
+   if(!s.extract(3).empty())
+      return false;
+   //Successful insertion
+   typename set_t::insert_return_type r(s.insert(boost::move(nh)));
+   if(!r.inserted || *r.position != 3 || !r.node.empty() || !nh.empty() || s.size() != 10u)
+      return false;
+   //Failed insertion returns the node
+   nh = s.extract(s.find(5));
+   s.insert(5);
+   r = s.insert(boost::move(nh));
+   if(r.inserted || *r.position != 5 || r.node.empty() || r.node.value() != 5 || s.size() != 10u)
+      return false;
+   //Empty node handle
+   typename set_t::node_type empty_nh;
+   r = s.insert(boost::move(empty_nh));
+   if(r.inserted || r.position != s.end() || !r.node.empty())
+      return false;
+   //Hinted insertion, node handles from multisets are compatible
+   multiset_t ms;
+   ms.insert(10);
+   ms.insert(10);
+   nh = ms.extract(ms.begin());
+   typename set_t::iterator it = s.insert(s.end(), boost::move(nh));
+   if(*it != 10 || s.size() != 11u || ms.size() != 1u)
+      return false;
+   nh = s.extract(10);
+   typename multiset_t::iterator mit = ms.insert(boost::move(nh));
+   if(*mit != 10 || ms.count(10) != 2u || s.size() != 10u)
+      return false;
+   nh = s.extract(s.begin());
+   mit = ms.insert(ms.begin(), boost::move(nh));
+   if(*mit != 0 || ms.size() != 3u || s.size() != 9u)
+      return false;
+
+   //Merge with a different comparison function keeps duplicated keys in the source
+   greater_set_t gs;
+   gs.insert(3);
+   gs.insert(20);
+   gs.insert(21);
+   s.merge(gs);
+   if(s.size() != 11u || gs.size() != 1u || *gs.begin() != 3 || !s.count(20) || !s.count(21))
+      return false;
+   s.merge(ms);
+   if(s.size() != 13u || ms.size() != 1u || *ms.begin() != 10)
+      return false;
+   //Merging in a multiset transfers all the elements
+   ms.merge(s);
+   if(!s.empty() || ms.size() != 14u || ms.count(10) != 2u)
+      return false;
+   ms.merge(ms);
+   if(ms.size() != 14u)
+      return false;
+   int prev = -1;
+   for(mit = ms.begin(); mit != ms.end(); ++mit){
+      if(*mit < prev)
+         return false;
+      prev = *mit;
+   }
+   return true;
+}
+
+template<boost::container::tree_type_enum tree_type_value>
+bool test_ordered_range_construction()
+{
+   typedef typename tree_assoc_options< tree_type<tree_type_value> >::type options_t;
+   typedef set<int, std::less<int>, std::allocator<int>, options_t>        set_t;
+   typedef multiset<int, std::less<int>, std::allocator<int>, options_t>   multiset_t;
+
+   //Trees of every shape up to several complete levels
+   for(int n = 0; n != 70; ++n){
+      std::vector<int> values;
+      for(int i = 0; i != n; ++i){
+         values.push_back(i/2);
+      }
+      multiset_t ms(ordered_range, values.begin(), values.end());
+      if(ms.size() != values.size() || !std::equal(ms.begin(), ms.end(), values.begin()))
+         return false;
+      values.erase(std::unique(values.begin(), values.end()), values.end());
+      set_t s(ordered_unique_range, values.begin(), values.end());
+      if(s.size() != values.size() || !std::equal(s.begin(), s.end(), values.begin()))
+         return false;
+      //The built tree must stay valid after insertions and erasures
+      for(int i = 0; i != n; ++i){
+         ms.insert(-1 - i);
+         ms.insert(n + i);
+         s.erase(i);
+         if(ms.count(-1 - i) != 1u || ms.count(n + i) != 1u || s.count(i))
+            return false;
+      }
+      if(!s.empty() || ms.size() != 3u*std::size_t(n))
+         return false;
+      int prev = -n;
+      for(typename multiset_t::iterator it = ms.begin(); it != ms.end(); ++it){
+         if(*it < prev)
+            return false;
+         prev = *it;
+      }
+   }
+   return true;
+}
+
+//nth(i) and index_of() must match a walk over the elements
+template<class Container>
+bool check_nth_index_of(Container &c)
+{
+   typename Container::size_type i = 0u;
+   for(typename Container::iterator it = c.begin(); it != c.end(); ++it, ++i){
+      const typename Container::const_iterator cit(it);
+      if(c.nth(i) != it || boost::container::test::as_const(c).nth(i) != cit)
+         return false;
+      if(c.index_of(it) != i || boost::container::test::as_const(c).index_of(cit) != i)
+         return false;
+   }
+   return c.nth(c.size()) == c.end() && c.index_of(c.end()) == c.size();
+}
+
+template<boost::container::tree_type_enum tree_type_value, bool order_statistics_value>
+bool test_order_statistics()
+{
+   typedef typename tree_assoc_options
+      < tree_type<tree_type_value>, order_statistics<order_statistics_value> >::type options_t;
+   typedef multiset<int, std::less<int>, std::allocator<int>, options_t>   multiset_t;
+   typedef set<int, std::less<int>, std::allocator<int>, options_t>        set_t;
+
+   //Pseudo-random insertions and erasures exercise every rebalancing path
+   multiset_t ms;
+   unsigned seed = 1u;
+   for(int round = 0; round != 20; ++round){
+      for(int i = 0; i != 50; ++i){
+         seed = seed*1103515245u + 12345u;
+         const int v = int((seed >> 16u) % 200u);
+         switch(i % 3){
+            case 0: ms.insert(v);  break;
+            case 1: ms.insert(ms.lower_bound(v), v);  break;
+            default: ms.emplace(v);  break;
+         }
+      }
+      for(int i = 0; i != 20 && !ms.empty(); ++i){
+         seed = seed*1103515245u + 12345u;
+         const typename multiset_t::size_type n = (seed >> 16u) % ms.size();
+         if(i % 2){
+            ms.erase(ms.nth(n));
+         }
+         else{
+            ms.erase(*ms.nth(n));
+         }
+      }
+      if(!check_nth_index_of(ms))
+         return false;
+   }
+   //Range erasure
+   ms.erase(ms.nth(ms.size()/4u), ms.nth(ms.size()/2u));
+   if(!check_nth_index_of(ms))
+      return false;
+   //Copies
+   multiset_t ms2(ms);
+   if(!check_nth_index_of(ms2))
+      return false;
+   ms2.erase(ms2.begin(), ms2.nth(ms2.size()/2u));
+   ms2 = ms;
+   if(!check_nth_index_of(ms2))
+      return false;
+   //Ordered range construction, node handles and merge
+   std::vector<int> values(ms.begin(), ms.end());
+   values.erase(std::unique(values.begin(), values.end()), values.end());
+   set_t s(ordered_unique_range, values.begin(), values.end());
+   if(!check_nth_index_of(s))
+      return false;
+   for(int i = 0; i != 10; ++i){
+      typename set_t::node_type nh(s.extract(s.nth(s.size()/2u)));
+      ms2.insert(boost::move(nh));
+   }
+   if(!check_nth_index_of(s) || !check_nth_index_of(ms2))
+      return false;
+   s.merge(ms2);
+   return check_nth_index_of(s) && check_nth_index_of(ms2);
+}
+
 struct boost_container_set;
 struct boost_container_multiset;
 
@@ -342,6 +597,25 @@ int main ()
       test_move<multiset<recursive_multiset> >();
    }
 
+   ////////////////////////////////////
+   //    Heterogeneous lookup testing
+   ////////////////////////////////////
+   {
+      typedef boost::container::test::transparent_key   key_t;
+      typedef boost::container::test::transparent_less  less_t;
+      set<key_t, less_t> set_;
+      multiset<key_t, less_t> multiset_;
+      for(int i = 0; i != 10; i += 2){
+         set_.insert(key_t(i));
+         multiset_.insert(key_t(i));
+         multiset_.insert(key_t(i));
+      }
+      if(!boost::container::test::test_heterogeneous_lookup(set_))
+         return 1;
+      if(!boost::container::test::test_heterogeneous_lookup(multiset_))
+         return 1;
+   }
+
    ////////////////////////////////////
    //    Testing allocator implementations
    ////////////////////////////////////
@@ -384,6 +658,76 @@ int main ()
       std::cerr << "test_set_variants< std::allocator<void>, splay_tree > failed" << std::endl;
       return 1;
    }
+   //    B-TREE
+   if(test_set_variants< std::allocator<void>, btree >()){
+      std::cerr << "test_set_variants< std::allocator<void>, btree > failed" << std::endl;
+      return 1;
+   }
+
+   ////////////////////////////////////
+   //    Node handle and merge testing
+   ////////////////////////////////////
+   if(!test_node_handle<red_black_tree>())
+      return 1;
+   if(!test_node_handle<avl_tree>())
+      return 1;
+   if(!test_node_handle<btree>())
+      return 1;
+
+   ////////////////////////////////////
+   //    Ordered range construction testing
+   ////////////////////////////////////
+   if(!test_ordered_range_construction<red_black_tree>())
+      return 1;
+   if(!test_ordered_range_construction<avl_tree>())
+      return 1;
+   if(!test_ordered_range_construction<splay_tree>())
+      return 1;
+   if(!test_ordered_range_construction<scapegoat_tree>())
+      return 1;
+
+   ////////////////////////////////////
+   //    Order statistics testing
+   ////////////////////////////////////
+   if(!test_order_statistics<red_black_tree, true>())
+      return 1;
+   if(!test_order_statistics<avl_tree, true>())
+      return 1;
+   if(!test_order_statistics<red_black_tree, false>())
+      return 1;
+   if(!test_order_statistics<btree, false>())
+      return 1;
+
+   ////////////////////////////////////
+   //    Set algebra testing
+   ////////////////////////////////////
+   if(!boost::container::test::test_set_algebra
+         < set<int, std::less<int>, std::allocator<int>, tree_assoc_options< tree_type<red_black_tree> >::type > >())
+      return 1;
+   if(!boost::container::test::test_set_algebra
+         < set<int, std::less<int>, std::allocator<int>, tree_assoc_options< tree_type<avl_tree> >::type > >())
+      return 1;
+   if(!boost::container::test::test_set_algebra
+         < set<int, std::less<int>, std::allocator<int>, tree_assoc_options< tree_type<splay_tree> >::type > >())
+      return 1;
+   if(!boost::container::test::test_set_algebra
+         < set<int, std::less<int>, std::allocator<int>, tree_assoc_options< tree_type<scapegoat_tree> >::type > >())
+      return 1;
+   if(!boost::container::test::test_set_algebra
+         < set<int, std::less<int>, std::allocator<int>, tree_assoc_options< tree_type<btree> >::type > >())
+      return 1;
+
+   ////////////////////////////////////
+   //    Private node pool testing
+   ////////////////////////////////////
+   if(!boost::container::test::test_private_node_pool_set
+         < set<int, std::less<int>, std::allocator<int>, tree_assoc_options< private_node_pool<32u> >::type > >())
+      return 1;
+   if(!boost::container::test::test_private_node_pool_set
+         < multiset< test::movable_and_copyable_int, std::less<test::movable_and_copyable_int>
+                   , node_allocator<test::movable_and_copyable_int>
+                   , tree_assoc_options< tree_type<avl_tree>, private_node_pool<32u> >::type > >())
+      return 1;
 
    ////////////////////////////////////
    //    Emplace testing
@@ -14,6 +14,7 @@
 #include <boost/container/detail/config_begin.hpp>
 #include "check_equal_containers.hpp"
 #include "print_container.hpp"
+#include "container_common_tests.hpp"
 #include <boost/move/utility_core.hpp>
 #include <boost/move/iterator.hpp>
 #include <boost/move/make_unique.hpp>
@@ -697,6 +698,12 @@ int set_test ()
       }
    }
 
+   if(!boost::container::test::test_find_batch(boostset, 100) ||
+      !boost::container::test::test_find_batch(boostmultiset, 100)){
+      std::cout << "Error in find_batch" << std::endl;
+      return 1;
+   }
+
    if(set_test_copyable<MyBoostSet, MyStdSet, MyBoostMultiSet, MyStdMultiSet>
       (container_detail::bool_<boost::container::test::is_copyable<IntType>::value>())){
       return 1;
@@ -9,6 +9,7 @@
 //////////////////////////////////////////////////////////////////////////////
 #include <boost/container/detail/config_begin.hpp>
 #include <boost/container/slist.hpp>
+#include <boost/container/options.hpp>
 #include <boost/container/allocator.hpp>
 #include <boost/container/node_allocator.hpp>
 #include <boost/container/adaptive_pool.hpp>
@@ -18,6 +19,7 @@
 #include "movable_int.hpp"
 #include "list_test.hpp"
 #include "propagate_allocator_test.hpp"
+#include "container_common_tests.hpp"
 #include "emplace_test.hpp"
 #include "../../intrusive/test/iterator_test.hpp"
 
@@ -51,6 +53,11 @@ template class boost::container::slist
    < test::movable_and_copyable_int
    , node_allocator<test::movable_and_copyable_int> >;
 
+template class boost::container::slist
+   < test::movable_and_copyable_int
+   , std::allocator<test::movable_and_copyable_int>
+   , list_options< private_node_pool<16u> >::type >;
+
 }}
 
 class recursive_slist
@@ -213,6 +220,21 @@ int main ()
       return 1;
    }
 
+   ////////////////////////////////////
+   //    Private node pool testing
+   ////////////////////////////////////
+   {
+      typedef list_options< private_node_pool<16u> >::type pool_options_t;
+      if(!test::test_private_node_pool_list< slist<int, std::allocator<int>, pool_options_t> >()){
+         std::cerr << "test_private_node_pool_list< std::allocator<int> > failed" << std::endl;
+         return 1;
+      }
+      if(!test::test_private_node_pool_list< slist<test::movable_and_copyable_int, node_allocator<test::movable_and_copyable_int>, pool_options_t> >()){
+         std::cerr << "test_private_node_pool_list< node_allocator<movable_and_copyable_int> > failed" << std::endl;
+         return 1;
+      }
+   }
+
    ////////////////////////////////////
    //    Emplace testing
    ////////////////////////////////////
@@ -0,0 +1,231 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/container/detail/config_begin.hpp>
+#include <memory>
+#include <map>
+#include <iostream>
+
+#include <boost/container/slot_map.hpp>
+#include <boost/container/allocator.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/container/is_trivially_relocatable.hpp>
+
+#include <boost/move/utility_core.hpp>
+#include <boost/static_assert.hpp>
+#include "movable_int.hpp"
+#include "dummy_test_allocator.hpp"
+
+using namespace boost::container;
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+template class boost::container::slot_map
+   < test::movable_and_copyable_int
+   , test::simple_allocator<test::movable_and_copyable_int> >;
+
+template class boost::container::slot_map
+   < test::movable_and_copyable_int
+   , std::allocator<test::movable_and_copyable_int> >;
+
+template class boost::container::slot_map
+   < test::movable_and_copyable_int
+   , allocator<test::movable_and_copyable_int> >;
+
+}}
+
+BOOST_STATIC_ASSERT(( is_trivially_relocatable< slot_map<int> >::value ));
+
+//Pseudo-random sequence so that results are reproducible
+unsigned next_random(unsigned &seed)
+{
+   seed = seed*1103515245u + 12345u;
+   return (seed >> 16u) & 0x7fffu;
+}
+
+//Checks that every live key finds its value, that erased keys are detected
+//and that key_of() is consistent with the iteration order
+template<class SlotMap>
+bool check_keys( const SlotMap &m, const std::map<typename SlotMap::key_type, int> &live
+               , const vector<typename SlotMap::key_type> &erased)
+{
+   typedef typename SlotMap::key_type key_type;
+   typedef typename std::map<key_type, int>::const_iterator map_it;
+   if(m.size() != live.size() || m.empty() != live.empty())
+      return false;
+   for(map_it it = live.begin(), itend = live.end(); it != itend; ++it){
+      if(m.count(it->first) != 1u || !(m[it->first] == it->second) ||
+         !(m.at(it->first) == it->second) || !(*m.find(it->first) == it->second))
+         return false;
+   }
+   for(std::size_t i = 0; i != erased.size(); ++i){
+      if(m.count(erased[i]) != 0u || m.find(erased[i]) != m.end())
+         return false;
+   }
+   for(typename SlotMap::const_iterator it = m.begin(), itend = m.end(); it != itend; ++it){
+      if(m.find(m.key_of(it)) != it)
+         return false;
+   }
+   return true;
+}
+
+//Mixes insertions and erasures by key and by iterator and compares the result with std::map
+template<class SlotMap>
+bool test_insert_erase()
+{
+   typedef typename SlotMap::key_type   key_type;
+   typedef typename SlotMap::value_type IntType;
+   SlotMap m;
+   std::map<key_type, int> live;
+   vector<key_type> erased;
+   unsigned seed = 3u;
+   for(int i = 0; i != 20000; ++i){
+      const unsigned op = next_random(seed) % 5u;
+      if(op < 3u || live.empty()){
+         IntType v(i);
+         const key_type k = (op == 0u) ? m.emplace(i) : m.insert(boost::move(v));
+         if(!live.insert(std::make_pair(k, i)).second)
+            return false;
+      }
+      else if(op == 3u){
+         typename std::map<key_type, int>::iterator it = live.begin();
+         std::advance(it, next_random(seed) % live.size());
+         if(m.erase(it->first) != 1u || m.erase(it->first) != 0u)
+            return false;
+         erased.push_back(it->first);
+         live.erase(it);
+      }
+      else{
+         const typename SlotMap::iterator it = m.begin() + next_random(seed) % m.size();
+         const key_type k = m.key_of(it);
+         if(live.find(k) == live.end() || !(*it == live[k]))
+            return false;
+         const typename SlotMap::iterator next = m.erase(it);
+         //The last value takes the place of the erased one
+         if(next != it || (next != m.end() && m.key_of(next) == k))
+            return false;
+         erased.push_back(k);
+         live.erase(k);
+      }
+      if(i % 1000 == 0 && !check_keys(m, live, erased))
+         return false;
+   }
+   if(!check_keys(m, live, erased))
+      return false;
+
+   //Move and swap keep keys valid
+   SlotMap mv(boost::move(m));
+   if(!m.empty() || !check_keys(mv, live, erased))
+      return false;
+   m = boost::move(mv);
+   if(!mv.empty() || !check_keys(m, live, erased))
+      return false;
+   m.swap(mv);
+   if(!m.empty() || !check_keys(mv, live, erased))
+      return false;
+   m.swap(mv);
+
+   //Clear invalidates all keys and slots are reused
+   for(typename std::map<key_type, int>::const_iterator it = live.begin(); it != live.end(); ++it){
+      erased.push_back(it->first);
+   }
+   live.clear();
+   m.clear();
+   if(!check_keys(m, live, erased))
+      return false;
+   const key_type k = m.insert(IntType(-1));
+   live.insert(std::make_pair(k, -1));
+   bool thrown = false;
+   try{
+      m.at(erased.back());
+   }
+   catch(...){
+      thrown = true;
+   }
+   return thrown && check_keys(m, live, erased) && m.count(key_type()) == 0u;
+}
+
+//Values are stored contiguously, in insertion order while there are no erasures
+bool test_dense_storage()
+{
+   typedef slot_map<int> slot_map_t;
+   slot_map_t m;
+   m.reserve(100u);
+   if(m.capacity() < 100u)
+      return false;
+   vector<slot_map_t::key_type> keys;
+   for(int i = 0; i != 100; ++i){
+      keys.push_back(m.insert(i));
+   }
+   for(int i = 0; i != 100; ++i){
+      if(m.data()[i] != i || &m[keys[i]] != m.data() + i)
+         return false;
+   }
+   //Erasing the first value moves the last one to the front
+   m.erase(keys[0]);
+   if(*m.begin() != 99 || m.size() != 99u || &m[keys[99]] != m.data())
+      return false;
+   //The freed slot is reused with a new generation
+   const slot_map_t::key_type k = m.insert(1000);
+   if(k.index != keys[0].index || k.generation == keys[0].generation || m.count(keys[0]))
+      return false;
+   m.shrink_to_fit();
+   if(m[k] != 1000 || *m.rbegin() != 1000)
+      return false;
+   //Copies keep keys valid
+   slot_map_t c(m);
+   c[k] = 2000;
+   for(int i = 1; i != 100; ++i){
+      if(c[keys[i]] != i)
+         return false;
+   }
+   m = c;
+   return m[k] == 2000 && m.count(keys[0]) == 0u && m.size() == 100u;
+}
+
+int main()
+{
+   {
+      //Now test move semantics
+      slot_map<int> original;
+      slot_map<int> move_ctor(boost::move(original));
+      slot_map<int> move_assign;
+      move_assign = boost::move(move_ctor);
+      move_assign.swap(original);
+   }
+
+   ////////////////////////////////////
+   //    Insertion and erasure testing
+   ////////////////////////////////////
+   if(!test_insert_erase< slot_map<int> >()){
+      std::cerr << "test_insert_erase< slot_map<int> > failed" << std::endl;
+      return 1;
+   }
+   if(!test_insert_erase< slot_map<test::movable_int> >()){
+      std::cerr << "test_insert_erase< slot_map<test::movable_int> > failed" << std::endl;
+      return 1;
+   }
+   if(!test_insert_erase< slot_map<test::movable_and_copyable_int, allocator<test::movable_and_copyable_int> > >()){
+      std::cerr << "test_insert_erase< slot_map<test::movable_and_copyable_int, allocator<> > > failed" << std::endl;
+      return 1;
+   }
+
+   ////////////////////////////////////
+   //    Dense storage testing
+   ////////////////////////////////////
+   if(!test_dense_storage()){
+      std::cerr << "test_dense_storage failed" << std::endl;
+      return 1;
+   }
+   return 0;
+}
+
+#include <boost/container/detail/config_end.hpp>
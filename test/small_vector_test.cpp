@@ -64,6 +64,12 @@ template class boost::container::small_vector
    , 10
    , node_allocator<test::movable_and_copyable_int> >;
 
+template class boost::container::small_vector
+   < test::movable_and_copyable_int
+   , 10
+   , std::allocator<test::movable_and_copyable_int>
+   , vector_options< growth_factor<growth_factor_60> >::type >;
+
 }}
 
 struct boost_container_small_vector;
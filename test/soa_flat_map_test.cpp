@@ -0,0 +1,320 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2015-2015. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/soa_flat_map.hpp>
+#include <boost/container/flat_map.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/container/allocator.hpp>
+
+#include "dummy_test_allocator.hpp"
+#include "movable_int.hpp"
+#include "container_common_tests.hpp"
+
+#include <map>
+#include <stdexcept>
+#include <iostream>
+
+using namespace boost::container;
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+template class soa_flat_map
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , test::simple_allocator< std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   >;
+
+template class soa_flat_map
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , std::allocator< std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   >;
+
+template class soa_flat_map
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , allocator< std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int> >
+   >;
+
+}} //boost::container
+
+template<class MyMap>
+bool check_equal_map(const MyMap &smap, const std::map<int, int> &stdmap)
+{
+   typedef typename MyMap::key_type key_type;
+   if(smap.size() != stdmap.size() || smap.empty() != stdmap.empty())
+      return false;
+   if(smap.keys().size() != smap.size() || smap.values().size() != smap.size())
+      return false;
+   if(typename MyMap::size_type(smap.cend() - smap.cbegin()) != smap.size())
+      return false;
+   typename MyMap::const_iterator it = smap.cbegin();
+   for(std::map<int, int>::const_iterator sit = stdmap.begin(); sit != stdmap.end(); ++sit, ++it){
+      if(!(it->first == sit->first) || !((*it).second == sit->second))
+         return false;
+      const key_type k(sit->first);
+      if(smap.find(k) != it || smap.count(k) != 1u || !(smap.at(k) == sit->second))
+         return false;
+   }
+   return true;
+}
+
+template<class MyMap>
+bool check_lookups(MyMap &smap, const std::map<int, int> &stdmap, int first, int last)
+{
+   typedef typename MyMap::key_type key_type;
+   const MyMap &csmap = smap;
+   for(int i = first; i != last; ++i){
+      const key_type k(i);
+      const std::ptrdiff_t lb = std::distance(stdmap.begin(), stdmap.lower_bound(i));
+      const std::ptrdiff_t ub = std::distance(stdmap.begin(), stdmap.upper_bound(i));
+      if(smap.lower_bound(k) - smap.begin() != lb || csmap.lower_bound(k) - csmap.begin() != lb)
+         return false;
+      if(smap.upper_bound(k) - smap.begin() != ub || csmap.upper_bound(k) - csmap.begin() != ub)
+         return false;
+      if(smap.equal_range(k).first - smap.begin() != lb || csmap.equal_range(k).second - csmap.begin() != ub)
+         return false;
+      const bool present = lb != ub;
+      if(present != (smap.find(k) != smap.end()) || present != (csmap.count(k) != 0u))
+         return false;
+   }
+   return true;
+}
+
+template<class MyMap>
+int soa_flat_map_test()
+{
+   typedef typename MyMap::key_type                key_type;
+   typedef typename MyMap::mapped_type             mapped_type;
+   typedef typename MyMap::key_container_type      key_container_type;
+   typedef typename MyMap::mapped_container_type   mapped_container_type;
+
+   MyMap smap;
+   std::map<int, int> stdmap;
+
+   //operator[] and emplace in unsorted order
+   for(int i = 0; i < 100; ++i){
+      const int k = (i*37) % 101;
+      key_type key(k);
+      smap[boost::move(key)] = mapped_type(-k);
+      stdmap[k] = -k;
+      if(smap.emplace(key_type(k), mapped_type(0)).second)
+         return 1;
+   }
+   if(!check_equal_map(smap, stdmap) || !check_lookups(smap, stdmap, -10, 120))
+      return 1;
+
+   //Hinted insertion, good and bad hints
+   {
+      typename MyMap::iterator it = smap.emplace_hint(smap.end(), key_type(200), mapped_type(1));
+      stdmap[200] = 1;
+      if(!(it->first == 200) || it != smap.end() - 1)
+         return 1;
+      it = smap.emplace_hint(smap.begin(), key_type(150), mapped_type(2));
+      stdmap[150] = 2;
+      if(!(it->first == 150) || !((*it).second == 2))
+         return 1;
+      it = smap.emplace_hint(smap.begin(), key_type(150), mapped_type(3));
+      if(!((*it).second == 2))
+         return 1;
+   }
+   if(!check_equal_map(smap, stdmap))
+      return 1;
+
+   //Mapped values are modified through iterators
+   {
+      std::map<int, int>::iterator sit = stdmap.begin();
+      for(typename MyMap::iterator it = smap.begin(); it != smap.end(); ++it, ++sit){
+         it->second = mapped_type(sit->first + 1000);
+         sit->second = sit->first + 1000;
+      }
+   }
+   if(!check_equal_map(smap, stdmap))
+      return 1;
+
+   //Reverse iteration
+   {
+      std::map<int, int>::const_reverse_iterator sit = stdmap.rbegin();
+      for(typename MyMap::const_reverse_iterator it = smap.crbegin(); it != smap.crend(); ++it, ++sit){
+         if(!(it->first == sit->first) || !((*it).second == sit->second))
+            return 1;
+      }
+   }
+
+   //Erasure
+   {
+      if(smap.erase(key_type(36)) != 1u || smap.erase(key_type(36)) != 0u)
+         return 1;
+      stdmap.erase(36);
+      typename MyMap::iterator it = smap.erase(smap.begin());
+      stdmap.erase(stdmap.begin());
+      if(it != smap.begin())
+         return 1;
+      it = smap.erase(smap.begin() + 10, smap.begin() + 20);
+      std::map<int, int>::iterator sit = stdmap.begin();
+      std::advance(sit, 10);
+      std::map<int, int>::iterator sit2 = sit;
+      std::advance(sit2, 10);
+      stdmap.erase(sit, sit2);
+      if(it != smap.begin() + 10)
+         return 1;
+   }
+   if(!check_equal_map(smap, stdmap) || !check_lookups(smap, stdmap, -10, 220))
+      return 1;
+
+   //Missing keys
+   {
+      bool thrown = false;
+      BOOST_TRY{
+         smap.at(key_type(-1));
+      }
+      BOOST_CATCH(const std::out_of_range &){
+         thrown = true;
+      }
+      BOOST_CATCH_END
+      if(!thrown)
+         return 1;
+   }
+
+   //Copy, move and swap
+   {
+      MyMap copy(smap);
+      if(copy != smap || !check_equal_map(copy, stdmap))
+         return 1;
+      MyMap moved(boost::move(copy));
+      if(!copy.empty() || moved != smap)
+         return 1;
+      MyMap other;
+      other = boost::move(moved);
+      if(!moved.empty() || other != smap)
+         return 1;
+      other.swap(moved);
+      if(!other.empty() || moved != smap)
+         return 1;
+      other = smap;
+      if(other != smap || other < smap || smap < other || !(other <= smap))
+         return 1;
+      other[key_type(10000)] = mapped_type(0);
+      if(!(smap < other) || !(other > smap) || other == smap)
+         return 1;
+   }
+
+   //Range insertion of unsorted elements with duplicates: the first one is kept,
+   //existing elements win over inserted ones
+   {
+      std::map<int, int> src;
+      vector< std::pair<int, int> > v;
+      for(int i = 0; i < 300; ++i){
+         const int k = (i*7) % 131;
+         v.push_back(std::pair<int, int>(k, i));
+         src.insert(std::pair<const int, int>(k, i));
+         stdmap.insert(std::pair<const int, int>(k, i));
+      }
+      MyMap m2(v.begin(), v.end());
+      if(!check_equal_map(m2, src))
+         return 1;
+      smap.insert(v.begin(), v.end());
+      if(!check_equal_map(smap, stdmap) || !check_lookups(smap, stdmap, -10, 220))
+         return 1;
+      //Sorted tail bigger than every key: appended
+      v.clear();
+      for(int i = 0; i < 10; ++i){
+         v.push_back(std::pair<int, int>(1000 + i, i));
+         stdmap[1000 + i] = i;
+      }
+      smap.insert(v.begin(), v.end());
+      if(!check_equal_map(smap, stdmap))
+         return 1;
+   }
+
+   //Adoption and extraction of both sequences
+   {
+      key_container_type keys;
+      mapped_container_type values;
+      smap.extract_sequences(keys, values);
+      if(!smap.empty() || keys.size() != stdmap.size() || values.size() != stdmap.size())
+         return 1;
+      const key_type *const kp = &keys[0];
+      smap.adopt_sequences(ordered_unique_range, boost::move(keys), boost::move(values));
+      if(&smap.keys()[0] != kp || !check_equal_map(smap, stdmap))
+         return 1;
+
+      //Unsorted sequences with duplicates
+      std::map<int, int> src;
+      keys.clear();
+      values.clear();
+      for(int i = 0; i < 500; ++i){
+         const int k = (i*13) % 257;
+         keys.push_back(key_type(k));
+         values.push_back(mapped_type(i));
+         src.insert(std::pair<const int, int>(k, i));
+      }
+      MyMap adopted(boost::move(keys), boost::move(values));
+      if(!check_equal_map(adopted, src) || !check_lookups(adopted, src, -5, 300))
+         return 1;
+
+      //Different sizes are rejected
+      keys.clear();
+      values.clear();
+      keys.push_back(key_type(1));
+      bool thrown = false;
+      BOOST_TRY{
+         adopted.adopt_sequences(boost::move(keys), boost::move(values));
+      }
+      BOOST_CATCH(const std::length_error &){
+         thrown = true;
+      }
+      BOOST_CATCH_END
+      if(!thrown)
+         return 1;
+   }
+
+   smap.clear();
+   stdmap.clear();
+   if(!check_equal_map(smap, stdmap) || smap.begin() != smap.end())
+      return 1;
+   return 0;
+}
+
+int main()
+{
+   using namespace boost::container::test;
+
+   if(soa_flat_map_test< soa_flat_map<int, int> >())
+      return 1;
+   if(soa_flat_map_test< soa_flat_map<movable_and_copyable_int, movable_and_copyable_int> >())
+      return 1;
+   if(soa_flat_map_test< soa_flat_map<int, int, std::less<int>, allocator< std::pair<int, int> > > >())
+      return 1;
+
+   ////////////////////////////////////
+   //    Heterogeneous lookup testing
+   ////////////////////////////////////
+   {
+      typedef boost::container::test::transparent_key   key_t;
+      typedef boost::container::test::transparent_less  less_t;
+      soa_flat_map<key_t, int, less_t> m;
+      for(int i = 0; i != 10; i += 2){
+         m[key_t(i)] = i;
+      }
+      if(!boost::container::test::test_heterogeneous_lookup(m))
+         return 1;
+   }
+
+   return 0;
+}
+
+#include <boost/container/detail/config_end.hpp>
@@ -53,6 +53,11 @@ template class stable_vector
    < test::movable_and_copyable_int
    , node_allocator<test::movable_and_copyable_int> >;
 
+template class stable_vector
+   < test::movable_and_copyable_int
+   , std::allocator<test::movable_and_copyable_int>
+   , vector_options< growth_factor<growth_factor_50> >::type >;
+
 template class stable_vector_iterator<int*, false>;
 template class stable_vector_iterator<int*, true >;
 
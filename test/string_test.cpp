@@ -45,6 +45,8 @@ template class basic_string<char,    std::char_traits<char>, test::simple_alloca
 template class basic_string<wchar_t, std::char_traits<wchar_t>, test::simple_allocator<wchar_t> >;
 template class basic_string<char,    std::char_traits<char>, std::allocator<char> >;
 template class basic_string<wchar_t, std::char_traits<wchar_t>, std::allocator<wchar_t> >;
+template class basic_string<char,    std::char_traits<char>, std::allocator<char>
+                           , vector_options< growth_factor<growth_factor_50> >::type >;
 
 //Explicit instantiation of container::vectors of container::strings
 template class vector<DummyString, DummyStringAllocator>;
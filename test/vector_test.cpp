@@ -16,6 +16,7 @@
 #include <boost/container/adaptive_pool.hpp>
 
 #include <boost/move/utility_core.hpp>
+#include <boost/static_assert.hpp>
 #include "check_equal_containers.hpp"
 #include "movable_int.hpp"
 #include "expand_bwd_test_allocator.hpp"
@@ -56,6 +57,16 @@ template class boost::container::vector
    < test::movable_and_copyable_int
    , node_allocator<test::movable_and_copyable_int> >;
 
+template class boost::container::vector
+   < test::movable_and_copyable_int
+   , std::allocator<test::movable_and_copyable_int>
+   , vector_options< growth_factor<growth_factor_50> >::type >;
+
+template class boost::container::vector
+   < test::movable_and_copyable_int
+   , std::allocator<test::movable_and_copyable_int>
+   , vector_options< growth_factor< growth_increment<16u> > >::type >;
+
 namespace container_detail {
 
 #ifndef BOOST_CONTAINER_VECTOR_ITERATOR_IS_POINTER
@@ -146,6 +157,110 @@ int test_cont_variants()
    return 0;
 }
 
+//Checks that each reallocation of push_back selects the capacity of GrowthFactor
+template<class GrowthFactor>
+bool test_growth_factor(std::size_t (*expected)(std::size_t))
+{
+   typedef typename vector_options< growth_factor<GrowthFactor> >::type options_t;
+   typedef vector<int, std::allocator<int>, options_t> vector_t;
+   vector_t v;
+   v.reserve(10u);
+   for(int i = 0; i != 1000; ++i){
+      const std::size_t old_cap = v.capacity();
+      v.push_back(i);
+      if(old_cap != v.capacity() && v.capacity() != expected(old_cap))
+         return false;
+   }
+   return test::vector_test<vector_t>() == 0;
+}
+
+std::size_t expected_growth_50(std::size_t cap)
+{  return cap + cap/2u;  }
+
+std::size_t expected_growth_60(std::size_t cap)
+{  return cap + cap*3u/5u;  }
+
+std::size_t expected_growth_100(std::size_t cap)
+{  return cap*2u;  }
+
+std::size_t expected_growth_increment_16(std::size_t cap)
+{  return cap + 16u;  }
+
+//Owns a heap allocated int and counts copies, it can be relocated with memcpy
+class heap_int
+{
+   public:
+   static std::size_t copies;
+
+   explicit heap_int(int i = 0)
+      : m_ptr(new int(i))
+   {}
+
+   heap_int(const heap_int &x)
+      : m_ptr(new int(*x.m_ptr))
+   {  ++copies;  }
+
+   heap_int &operator=(const heap_int &x)
+   {  *m_ptr = *x.m_ptr;   return *this;  }
+
+   ~heap_int()
+   {  delete m_ptr;  }
+
+   int get() const
+   {  return *m_ptr;  }
+
+   private:
+   int *m_ptr;
+};
+
+std::size_t heap_int::copies = 0u;
+
+namespace boost {
+namespace container {
+
+template<>
+struct is_trivially_relocatable<heap_int>
+{
+   static const bool value = true;
+};
+
+}}
+
+BOOST_STATIC_ASSERT(( is_trivially_relocatable< vector<int> >::value ));
+BOOST_STATIC_ASSERT(( is_trivially_relocatable< vector<heap_int> >::value ));
+BOOST_STATIC_ASSERT(( is_trivially_relocatable< std::pair<int, heap_int> >::value ));
+
+bool test_trivially_relocatable()
+{
+   typedef vector<heap_int> vector_t;
+   vector_t v;
+   for(int i = 0; i != 100; ++i){
+      v.emplace_back(i);
+   }
+   v.shrink_to_fit();
+   //Reallocations and insertions in the middle don't copy old elements
+   v.emplace(v.begin() + 50, -1);
+   v.emplace(v.begin(), -2);
+   if(heap_int::copies != 0u || v.size() != 102u)
+      return false;
+   //The inserted value is taken from an element that is relocated
+   v.insert(v.begin(), v[10]);
+   if(heap_int::copies != 1u || v[0].get() != 9 || v[11].get() != 9)
+      return false;
+   v.erase(v.begin());
+   v.erase(v.begin());
+   v.erase(v.begin() + 50);
+   v.erase(v.begin() + 90, v.end());
+   v.erase(v.begin(), v.begin() + 10);
+   if(heap_int::copies != 1u || v.size() != 80u)
+      return false;
+   for(int i = 0; i != 80; ++i){
+      if(v[i].get() != i + 10)
+         return false;
+   }
+   return true;
+}
+
 struct boost_container_vector;
 
 namespace boost { namespace container {   namespace test {
@@ -233,6 +348,25 @@ int main()
    if(test_expand_bwd())
       return 1;
 
+   ////////////////////////////////////
+   //    Trivially relocatable test
+   ////////////////////////////////////
+   if(!test_trivially_relocatable()){
+      std::cerr << "Trivially relocatable test failed" << std::endl;
+      return 1;
+   }
+
+   ////////////////////////////////////
+   //    Growth factor test
+   ////////////////////////////////////
+   if(!test_growth_factor<growth_factor_50>(&expected_growth_50) ||
+      !test_growth_factor<growth_factor_60>(&expected_growth_60) ||
+      !test_growth_factor<growth_factor_100>(&expected_growth_100) ||
+      !test_growth_factor< growth_increment<16u> >(&expected_growth_increment_16)){
+      std::cerr << "Growth factor test failed" << std::endl;
+      return 1;
+   }
+
    ////////////////////////////////////
    //    Default init test
    ////////////////////////////////////